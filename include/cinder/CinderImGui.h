@@ -43,6 +43,7 @@ namespace cinder {
 	namespace gl {
 		class Texture2d;
 		typedef std::shared_ptr<Texture2d> Texture2dRef;
+		class Profiler;
 	}
 }
 
@@ -132,6 +133,8 @@ namespace ImGui {
 	CI_API bool ListBox( const char* label, int* currIndex, const std::vector<std::string>& values, int height_in_items = -1 );
 
 	CI_API void	Image( const ci::gl::Texture2dRef& texture, const ci::vec2& size, const ci::vec2& uv0 = ci::vec2( 0, 0 ), const ci::vec2& uv1 = ci::vec2( 1, 1 ), const ci::vec4& tint_col = ci::vec4( 1, 1, 1, 1 ), const ci::vec4& border_col = ci::vec4( 0, 0, 0, 0 ) );
+	//! Draws a window with the per-scope statistics of \a profiler, or of the global gl::Profiler when null. \a open works as in ImGui::Begin().
+	CI_API void	ProfilerWindow( const char* label = "Profiler", ci::gl::Profiler* profiler = nullptr, bool* open = nullptr );
 
 	struct CI_API ScopedWindow : public ci::Noncopyable {
 		ScopedWindow( const char* label );
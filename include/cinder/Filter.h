@@ -24,6 +24,8 @@
 
 #include "cinder/CinderMath.h"
 
+#include <vector>
+
 namespace cinder {
 
 class CI_API FilterBase {
@@ -35,6 +37,10 @@ class CI_API FilterBase {
 	void			setSupport( float aSupport ) { mSupport = aSupport; }
 	
 	virtual float	operator()( float x ) const = 0;
+	//! Appends the values that operator()() depends on besides the support to \a params and returns \c true, so that weights sampled from this filter
+	//! can be cached and reused for filters of the same type with equal values. Returns \c false by default, which disables caching. Subclasses
+	//! of a filter that returns \c true must override this too if they add state of their own.
+	virtual bool	getCacheParams( std::vector<float> * /*params*/ ) const { return false; }
  protected:
 	float			mSupport;
 };
@@ -49,6 +55,8 @@ class CI_API FilterBox : public FilterBase {
 		else if ( x < 0.5f ) return 1.0f;
 		return 0.0f;
 	}
+
+	virtual bool getCacheParams( std::vector<float> * /*params*/ ) const { return true; }
 };
 
 // triangle, Bartlett window, 2nd order (linear) b-spline
@@ -62,6 +70,8 @@ class CI_API FilterTriangle : public FilterBase {
 		else if ( x < 1.0f ) return 1.0f - x;
 		return 0.0f;
 	}
+
+	virtual bool getCacheParams( std::vector<float> * /*params*/ ) const { return true; }
 };
 
 // 3rd order (quadratic) b-spline
@@ -78,6 +88,8 @@ class CI_API FilterQuadratic : public FilterBase {
 		else if ( x < 1.5f ) { t = x - 1.5f; return 0.5f * t * t; }
 		return 0.0f;
 	}
+
+	virtual bool getCacheParams( std::vector<float> * /*params*/ ) const { return true; }
 };
 
 // 4th order (cubic) b-spline
@@ -95,6 +107,8 @@ class CI_API FilterCubic : public FilterBase {
 		else if ( x < 2.0f ) { t = 2.0f - x; return t * t * t / 6.0f; }
 		return 0.0f;
 	}
+
+	virtual bool getCacheParams( std::vector<float> * /*params*/ ) const { return true; }
 };
 
 // Catmull-Rom spline, Overhauser spline
@@ -110,6 +124,8 @@ class CI_API FilterCatmullRom : public FilterBase {
 		else if ( x < 2.0f ) return 0.5f * ( 4.0f + x * ( -8.0f + x * ( 5.0f - x ) ) );
 		return 0.0f;
 	}
+
+	virtual bool getCacheParams( std::vector<float> * /*params*/ ) const { return true; }
 };
 
 // Mitchell & Netravali's two-parameter cubic
@@ -134,6 +150,11 @@ class CI_API FilterMitchell : public FilterBase {
 		else if ( x < 2.0f ) return mQ0 + x * ( mQ1 + x * ( mQ2 + x * mQ3 ) );
 		return 0.0f;
 	}
+
+	virtual bool getCacheParams( std::vector<float> *params ) const {
+		params->insert( params->end(), { mQ0, mQ1, mQ2, mQ3, mP0, mP2, mP3 } );
+		return true;
+	}
 	
  private:
 	float mQ0, mQ1, mQ2, mQ3;
@@ -151,6 +172,8 @@ class CI_API FilterSincBlackman : public FilterBase {
 		x /= mSupport;
 		return v * ( 0.42f + 0.50f * math<float>::cos( 3.14159265358979323846f * x ) + 0.08f * math<float>::cos( 6.2831853071795862f * x ) );
 	}
+
+	virtual bool getCacheParams( std::vector<float> * /*params*/ ) const { return true; }
 };
 
 // sinc filter, windowed by blackman
@@ -161,6 +184,8 @@ class CI_API FilterGaussian : public FilterBase {
 	virtual float operator()( float x ) const {
 		return ( math<float>::exp( -2.0f * x * x ) * math<float>::sqrt( 2.0f / 3.14159265358979323846f ) );
 	}
+
+	virtual bool getCacheParams( std::vector<float> * /*params*/ ) const { return true; }
 };
 
 #if ! defined( CINDER_COCOA_TOUCH )
@@ -179,6 +204,8 @@ class CI_API FilterBesselBlackman : public FilterBase {
 		x /= mSupport;
 		return v * ( 0.42f + 0.50f * math<float>::cos( 3.14159265358979323846f * x ) + 0.08f * math<float>::cos( 6.2831853071795862f * x ) );		
 	}
+
+	virtual bool getCacheParams( std::vector<float> * /*params*/ ) const { return true; }
 };
 #endif
 
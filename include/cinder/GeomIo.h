@@ -37,6 +37,7 @@
 #include <map>
 #include <algorithm>
 #include <array>
+#include <functional>
 
 // Forward declarations in cinder::
 namespace cinder {
@@ -78,6 +79,50 @@ CI_API void calculateTangents( size_t numIndices, const uint32_t *indices, size_
 //! Utility function for calculating tangents and bitangents from indexed geometry and 3D texture coordinates. \a resultBitangents may be NULL if not needed.
 CI_API void calculateTangents( size_t numIndices, const uint32_t *indices, size_t numVertices, const vec3 *positions, const vec3 *normals, const vec3 *texCoords, std::vector<vec3> *resultTangents, std::vector<vec3> *resultBitangents );
 
+//! Determines how much each triangle contributes to the normals of its vertices in calculateNormals().
+enum class NormalWeighting {
+	//! Every triangle contributes equally
+	UNIFORM,
+	//! Triangles contribute in proportion to their area
+	AREA,
+	//! Triangles contribute in proportion to the angle of the corner at the vertex, which is independent of how the surface is tessellated
+	ANGLE
+};
+
+/*! Utility function for welding vertices whose \a positions lie within \a epsilon of one another, using a spatial hash. An \a epsilon of \c 0 only welds identical positions.
+	\a resultRemap receives, for every vertex, the index of the lowest-indexed vertex it welds to, which always maps to itself. If \a equalFn is supplied it is also
+	called with pairs of candidate vertices and must return \c true for them to weld, which allows other attributes to be compared. Returns the number of unique vertices. */
+CI_API size_t calculateWeldRemap( size_t numVertices, const vec3 *positions, float epsilon, std::vector<uint32_t> *resultRemap, const std::function<bool ( uint32_t, uint32_t )> &equalFn = nullptr );
+/*! Utility function for calculating normals from indexed triangles. Each triangle contributes its face normal to its three vertices according to \a weighting.
+	If \a weldRemap is supplied (see calculateWeldRemap()), vertices that share a remapped index share their normal, which smooths across seams. Runs on up to ip::getMaxThreads() threads. */
+CI_API void calculateNormals( size_t numIndices, const uint32_t *indices, size_t numVertices, const vec3 *positions, NormalWeighting weighting, std::vector<vec3> *resultNormals, const uint32_t *weldRemap = nullptr );
+
+//! Post-transform vertex cache efficiency of indexed triangles, as simulated by calculateVertexCacheStats()
+struct CI_API VertexCacheStats {
+	VertexCacheStats() : mAcmr( 0 ), mAtvr( 0 ) {}
+
+	//! Average cache miss ratio, the number of vertices transformed per triangle. Ranges from 3 down to about 0.5 for large regular meshes.
+	float	mAcmr;
+	//! Average transform to vertex ratio, the number of vertices transformed per referenced vertex. 1 is ideal.
+	float	mAtvr;
+};
+
+//! Utility function which simulates a FIFO post-transform vertex cache of \a cacheSize entries over indexed triangles, so that index orders can be compared without a GPU.
+CI_API VertexCacheStats calculateVertexCacheStats( size_t numIndices, const uint32_t *indices, size_t numVertices, size_t cacheSize = 16 );
+//! Utility function which reorders indexed triangles for a post-transform vertex cache of \a cacheSize entries, using Tipsify (Sander et al. 2007). \a resultIndices may equal \a indices.
+CI_API void optimizeVertexCache( size_t numIndices, const uint32_t *indices, size_t numVertices, uint32_t *resultIndices, size_t cacheSize = 16 );
+/*! Utility function which reorders clusters of vertex cache optimized triangles so that those facing away from the center of the mesh are drawn first, which reduces overdraw.
+	Clusters begin where the cache is flushed and are split further wherever that keeps the ACMR at about \a threshold times the original. \a resultIndices may equal \a indices. */
+CI_API void optimizeOverdraw( size_t numIndices, const uint32_t *indices, size_t numVertices, const vec3 *positions, uint32_t *resultIndices, size_t cacheSize = 16, float threshold = 1.05f );
+//! Utility function which orders vertices by their first use in \a indices, followed by any unreferenced vertices, for vertex fetch locality. \a resultRemap receives the new index of every vertex.
+CI_API void calculateVertexFetchRemap( size_t numIndices, const uint32_t *indices, size_t numVertices, std::vector<uint32_t> *resultRemap );
+/*! Utility function which reduces indexed triangles by quadric error edge collapses (Garland and Heckbert 1997), until no more than \a targetNumIndices remain
+	or the next collapse would move the surface by more than \a targetError, relative to the largest extent of \a positions. Vertices only collapse onto
+	neighboring vertices, so the result indexes the original vertices and every attribute keeps its values. Borders are kept, and vertices that share a
+	position but differ in other attributes, along seams, only collapse along the seam. Writes to \a resultIndices, which may equal \a indices, and returns
+	the number of indices written. \a resultError receives the largest error of a collapse, relative to the extent. Runs on up to ip::getMaxThreads() threads. */
+CI_API size_t simplify( size_t numIndices, const uint32_t *indices, size_t numVertices, const vec3 *positions, size_t targetNumIndices, float targetError, uint32_t *resultIndices, float *resultError = nullptr );
+
 struct CI_API AttribInfo {
 	AttribInfo( const Attrib &attrib, uint8_t dims, size_t stride, size_t offset, uint32_t instanceDivisor = 0 )
 		: mAttrib( attrib ), mDims( dims ), mDataType( DataType::FLOAT ), mStride( stride ), mOffset( offset ), mInstanceDivisor( instanceDivisor )
@@ -1428,6 +1473,89 @@ class CI_API Subdivide : public Modifier {
 	void		process( SourceModsContext *ctx, const AttribSet &requestedAttribs ) const override;
 };
 
+//! Merges vertices whose POSITIONs lie within \a epsilon of one another and remaps the indices to match, using a spatial hash.
+//! Unless positionsOnly() is enabled, every other attribute must match within \a epsilon as well. Merged vertices keep the attributes of the lowest-indexed vertex.
+//! Requires TRIANGLES and always produces indexed geometry. As the result isn't known until processing, getNumVertices() reports the upstream count as an upper bound.
+class CI_API Weld : public Modifier {
+  public:
+	Weld( float epsilon = 0 )
+		: mEpsilon( epsilon ), mPositionsOnly( false )
+	{}
+
+	Weld&		epsilon( float epsilon ) { mEpsilon = epsilon; return *this; }
+	//! Merges vertices based on their positions alone, discarding differing attributes such as UV seams or hard edges. Disabled by default.
+	Weld&		positionsOnly( bool enable = true ) { mPositionsOnly = enable; return *this; }
+
+	size_t		getNumIndices( const Modifier::Params &upstreamParams ) const override;
+
+	Modifier*	clone() const override { return new Weld( *this ); }
+	void		process( SourceModsContext *ctx, const AttribSet &requestedAttribs ) const override;
+
+  protected:
+	float		mEpsilon;
+	bool		mPositionsOnly;
+};
+
+//! Reorders triangles for the post-transform vertex cache, then clusters of them to reduce overdraw, then the vertices in order of first use for vertex fetch locality.
+//! Requires TRIANGLES and always produces indexed geometry. Overdraw optimization requires 3D POSITIONs. The cache statistics before and after can be reported through stats().
+class CI_API Optimize : public Modifier {
+  public:
+	Optimize()
+		: mCacheSize( 16 ), mOverdraw( true ), mOverdrawThreshold( 1.05f ), mVertexFetch( true ), mStatsBefore( nullptr ), mStatsAfter( nullptr )
+	{}
+
+	//! Sets the number of entries in the simulated FIFO vertex cache. Default is 16.
+	Optimize&	cacheSize( size_t size ) { mCacheSize = std::max<size_t>( 3, size ); return *this; }
+	//! Enables overdraw optimization, which may raise the ACMR to about \a threshold times the vertex cache optimized order. Enabled by default with a \a threshold of \c 1.05.
+	Optimize&	overdraw( bool enable = true, float threshold = 1.05f ) { mOverdraw = enable; mOverdrawThreshold = threshold; return *this; }
+	//! Enables reordering the vertices in order of first use. Enabled by default.
+	Optimize&	vertexFetch( bool enable = true ) { mVertexFetch = enable; return *this; }
+	//! Reports the simulated vertex cache statistics before and after optimization to \a before and \a after, either of which may be \c nullptr.
+	Optimize&	stats( VertexCacheStats *before, VertexCacheStats *after ) { mStatsBefore = before; mStatsAfter = after; return *this; }
+
+	size_t		getNumIndices( const Modifier::Params &upstreamParams ) const override;
+
+	Modifier*	clone() const override { return new Optimize( *this ); }
+	void		process( SourceModsContext *ctx, const AttribSet &requestedAttribs ) const override;
+
+  protected:
+	size_t				mCacheSize;
+	bool				mOverdraw;
+	float				mOverdrawThreshold;
+	bool				mVertexFetch;
+	VertexCacheStats	*mStatsBefore, *mStatsAfter;
+};
+
+//! Reduces TRIANGLES by quadric error edge collapses; see geom::simplify(). Vertices only move onto neighboring vertices, so every attribute keeps its values. Unreferenced vertices are removed.
+//! Always produces indexed geometry and requires 3D POSITIONs.
+class CI_API Simplify : public Modifier {
+  public:
+	//! Reduces to \a targetRatio of the triangles, as far as an error of \a targetError relative to the largest extent of the mesh allows.
+	Simplify( float targetRatio = 0.5f, float targetError = 0.01f )
+		: mTargetRatio( targetRatio ), mTargetTriangles( 0 ), mTargetError( targetError ), mResultError( nullptr )
+	{}
+
+	//! Sets the fraction of the triangles to keep. Default is \c 0.5.
+	Simplify&	targetRatio( float ratio ) { mTargetRatio = ratio; mTargetTriangles = 0; return *this; }
+	//! Sets the number of triangles to keep, in place of a ratio.
+	Simplify&	targetTriangles( size_t numTriangles ) { mTargetTriangles = numTriangles; return *this; }
+	//! Sets the largest error permitted, relative to the largest extent of the mesh. Default is \c 0.01.
+	Simplify&	targetError( float error ) { mTargetError = error; return *this; }
+	//! Reports the largest error of a collapse, relative to the largest extent of the mesh, to \a result.
+	Simplify&	resultError( float *result ) { mResultError = result; return *this; }
+
+	size_t		getNumIndices( const Modifier::Params &upstreamParams ) const override;
+
+	Modifier*	clone() const override { return new Simplify( *this ); }
+	void		process( SourceModsContext *ctx, const AttribSet &requestedAttribs ) const override;
+
+  protected:
+	float		mTargetRatio;
+	size_t		mTargetTriangles;
+	float		mTargetError;
+	float		*mResultError;
+};
+
 
 ////////////////////////////////////////////////////////////////////////////////
 //! Base class for SourceMods<> and SourceModsPtr<>
@@ -0,0 +1,175 @@
+/*
+ Copyright (c) 2026, The Cinder Project
+
+ This code is intended to be used with the Cinder C++ library, http://libcinder.org
+
+ Redistribution and use in source and binary forms, with or without modification, are permitted provided that
+ the following conditions are met:
+
+    * Redistributions of source code must retain the above copyright notice, this list of conditions and
+	the following disclaimer.
+    * Redistributions in binary form must reproduce the above copyright notice, this list of conditions and
+	the following disclaimer in the documentation and/or other materials provided with the distribution.
+
+ THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED
+ WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A
+ PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR
+ ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+ TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+ NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ POSSIBILITY OF SUCH DAMAGE.
+*/
+
+#pragma once
+
+#include "cinder/Cinder.h"
+#include "cinder/ImageIo.h"
+#include "cinder/Noncopyable.h"
+#include "cinder/Surface.h"
+
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <exception>
+#include <functional>
+#include <mutex>
+#include <queue>
+#include <thread>
+#include <vector>
+
+namespace cinder {
+
+typedef std::shared_ptr<class ImageDecodeRequest>	ImageDecodeRequestRef;
+
+//! Handle to an image queued on an ImageDecodeService, which can be used to follow its progress or cancel it.
+class CI_API ImageDecodeRequest : private Noncopyable {
+  public:
+	enum State {
+		QUEUED,		//! Waiting for a decoding thread
+		DECODING,	//! Being decoded on a decoding thread
+		DECODED,	//! Decoded, waiting for its callback to be called
+		COMPLETED,	//! Its callback has been called
+		FAILED,		//! Decoding threw an exception. Its callback has been called with a null result
+		CANCELED	//! Canceled before its callback was called
+	};
+
+	//! Returns the current State of the request
+	State	getState() const	{ return (State)mState.load(); }
+	//! Returns whether decoding has finished, failed or was canceled. The callback may still be pending.
+	bool	isDecoded() const	{ return getState() >= DECODED; }
+	//! Returns the priority the request was queued with. Higher priorities are decoded first.
+	int		getPriority() const	{ return mPriority; }
+
+	//! Cancels the request. A queued request is never decoded, and the callback of a request that is being decoded is discarded. If called from the thread that callbacks are delivered on, the callback is guaranteed not to be called after cancel() returns.
+	void	cancel();
+	//! Blocks until decoding has finished, failed or was canceled. The callback is called later on the thread callbacks are delivered on, so it's safe to call wait() from the App's thread.
+	void	wait() const;
+
+	//! Returns the exception thrown while decoding, or a null exception_ptr
+	std::exception_ptr	getException() const	{ return mException; }
+
+  private:
+	ImageDecodeRequest( const std::function<void ()> &decodeFn, const std::function<void ()> &completeFn, int priority );
+
+	//! Called on a decoding thread. The service marks the request DECODED once it has been dispatched.
+	void	decode();
+	//! Called on the thread callbacks are delivered on
+	void	complete();
+	bool	setState( State expected, State desired );
+
+	std::function<void ()>		mDecodeFn, mCompleteFn;
+	int							mPriority;
+	std::atomic<int>			mState;
+	std::exception_ptr			mException;
+	mutable std::mutex			mMutex;
+	mutable std::condition_variable	mDecodedCond;
+
+	friend class ImageDecodeService;
+};
+
+//! Decodes images on a bounded pool of background threads, using the handlers registered with ImageIoRegistrar, so that loading assets never blocks the App's thread.
+//!
+//! Requests are decoded in order of priority, and in the order they were queued for equal priorities. Completion callbacks are
+//! posted to the App's io_service (see app::AppBase::dispatchAsync()) and so are called on the App's thread. Without an App,
+//! or when Options::dispatchToApp() is disabled, callbacks are called from update() instead.
+class CI_API ImageDecodeService : private Noncopyable {
+  public:
+	struct CI_API Options {
+		Options() : mNumThreads( 0 ), mDispatchToApp( true ) {}
+
+		//! Sets the maximum number of decoding threads. 0 (the default) uses one less than the number of hardware threads, between 1 and 4.
+		Options& numThreads( size_t numThreads )	{ mNumThreads = numThreads; return *this; }
+		//! Sets whether callbacks are posted to the App's io_service when there is an App (\default true). Otherwise they're called from update().
+		Options& dispatchToApp( bool enable )		{ mDispatchToApp = enable; return *this; }
+
+		size_t	getNumThreads() const		{ return mNumThreads; }
+		bool	isDispatchToApp() const		{ return mDispatchToApp; }
+
+	  private:
+		size_t	mNumThreads;
+		bool	mDispatchToApp;
+	};
+
+	explicit ImageDecodeService( const Options &options = Options() );
+	//! Cancels any requests that haven't been decoded and waits for the decoding threads to finish.
+	~ImageDecodeService();
+
+	//! Returns the global instance of ImageDecodeService, used by loadImageAsync()
+	static ImageDecodeService&	instance();
+
+	//! Queues the image at \a path for decoding. \a callback receives the ImageSource, or null if loading failed. The ImageSource is created on a decoding thread, which for the stb_image and tinyexr handlers decodes the pixels.
+	ImageDecodeRequestRef	loadImage( const fs::path &path, const std::function<void ( ImageSourceRef )> &callback, const ImageSource::Options &options = ImageSource::Options(), const std::string &extension = "", int priority = 0 );
+	//! Queues the image in \a dataSource for decoding. \a callback receives the ImageSource, or null if loading failed.
+	ImageDecodeRequestRef	loadImage( const DataSourceRef &dataSource, const std::function<void ( ImageSourceRef )> &callback, const ImageSource::Options &options = ImageSource::Options(), const std::string &extension = "", int priority = 0 );
+	//! Queues the image at \a path for decoding into a Surface, which is fully decoded on a decoding thread. \a callback receives the Surface, or null if loading failed.
+	template<typename T>
+	ImageDecodeRequestRef	loadSurface( const fs::path &path, const std::function<void ( std::shared_ptr<SurfaceT<T>> )> &callback, int priority = 0 );
+	//! Queues the image at \a path for decoding into a Surface with an alpha channel based on \a alpha, and the channel order \a constraints selects when this is called.
+	template<typename T>
+	ImageDecodeRequestRef	loadSurface( const fs::path &path, const std::function<void ( std::shared_ptr<SurfaceT<T>> )> &callback, const SurfaceConstraints &constraints, bool alpha, int priority = 0 );
+	//! Queues the image in \a dataSource for decoding into a Surface. \a callback receives the Surface, or null if loading failed.
+	template<typename T>
+	ImageDecodeRequestRef	loadSurface( const DataSourceRef &dataSource, const std::function<void ( std::shared_ptr<SurfaceT<T>> )> &callback, int priority = 0 );
+
+	//! Queues \a decodeFn to be called on a decoding thread, followed by \a completeFn on the thread callbacks are delivered on. If \a decodeFn throws, the exception is available from the request and \a completeFn is still called.
+	ImageDecodeRequestRef	enqueue( const std::function<void ()> &decodeFn, const std::function<void ()> &completeFn, int priority = 0 );
+
+	//! Cancels all requests that are queued or being decoded, and any decoded requests waiting for update()
+	void	cancelAll();
+	//! Calls the callbacks of decoded requests that aren't posted to the App. Returns the number of callbacks called.
+	size_t	update();
+
+	//! Returns the number of requests waiting for a decoding thread
+	size_t	getNumQueued() const;
+	//! Returns the maximum number of decoding threads
+	size_t	getNumThreads() const	{ return mNumThreads; }
+
+  private:
+	struct QueuedRequest {
+		int						mPriority;
+		uint64_t				mSequence;
+		ImageDecodeRequestRef	mRequest;
+
+		bool operator<( const QueuedRequest &rhs ) const	{ return mPriority < rhs.mPriority || ( mPriority == rhs.mPriority && mSequence > rhs.mSequence ); }
+	};
+
+	template<typename T>
+	ImageDecodeRequestRef	loadSurface( const std::function<ImageSourceRef ()> &loadFn, const std::function<void ( std::shared_ptr<SurfaceT<T>> )> &callback, const SurfaceConstraints *constraints, bool alpha, int priority );
+
+	void	threadEntry();
+	void	dispatch( const ImageDecodeRequestRef &request );
+
+	size_t								mNumThreads;
+	bool								mDispatchToApp;
+	std::vector<std::thread>			mThreads;
+	std::priority_queue<QueuedRequest>	mQueue;
+	uint64_t							mSequence;
+	std::vector<ImageDecodeRequestRef>	mDecoding;
+	std::deque<ImageDecodeRequestRef>	mDecoded;
+	bool								mShouldQuit;
+	mutable std::mutex					mMutex;
+	std::condition_variable				mQueueCond;
+};
+
+} // namespace cinder
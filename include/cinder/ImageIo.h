@@ -41,6 +41,7 @@ typedef std::shared_ptr<class ImageSource>		ImageSourceRef;
 typedef std::shared_ptr<class ImageLoader>		ImageLoaderRef;
 typedef std::shared_ptr<class ImageTarget>		ImageTargetRef;
 typedef std::shared_ptr<class ImageTargetFile>	ImageTargetFileRef;
+typedef std::shared_ptr<class ImageDecodeRequest>	ImageDecodeRequestRef;
 
 class CI_API ImageIo {
   public:
@@ -185,11 +186,10 @@ class CI_API ImageTarget : public ImageIo {
 	ImageTarget() {}	
 };
 
-#if defined( CINDER_UWP )
-//! Asynchronously loads an image from the file path \a path. Callback function \a callback will be called on main UI thread. Optional \a extension parameter allows specification of a file type. For example, "jpg" would force the file to load as a JPEG
-
-void loadImageAsync(const fs::path path, std::function<void (ImageSourceRef)> callback, ImageSource::Options options = ImageSource::Options(), std::string extension = "" );
-#endif
+//! Asynchronously loads an image from the file path \a path on ImageDecodeService::instance(). Callback function \a callback will be called on the App's thread, with a null ImageSourceRef if loading failed. Optional \a extension parameter allows specification of a file type. For example, "jpg" would force the file to load as a JPEG. Requests with a higher \a priority are decoded first.
+CI_API ImageDecodeRequestRef	loadImageAsync( const fs::path &path, const std::function<void (ImageSourceRef)> &callback, ImageSource::Options options = ImageSource::Options(), std::string extension = "", int priority = 0 );
+//! Asynchronously loads an image from \a dataSource on ImageDecodeService::instance(). Callback function \a callback will be called on the App's thread, with a null ImageSourceRef if loading failed.
+CI_API ImageDecodeRequestRef	loadImageAsync( const DataSourceRef &dataSource, const std::function<void (ImageSourceRef)> &callback, ImageSource::Options options = ImageSource::Options(), std::string extension = "", int priority = 0 );
 
 
 //! Loads an image from the file path \a path. Optional \a extension parameter allows specification of a file type. For example, "jpg" would force the file to load as a JPEG
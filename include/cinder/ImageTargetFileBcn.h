@@ -0,0 +1,83 @@
+/*
+ Copyright (c) 2026, The Cinder Project
+
+ This code is intended to be used with the Cinder C++ library, http://libcinder.org
+
+ Redistribution and use in source and binary forms, with or without modification, are permitted provided that
+ the following conditions are met:
+
+    * Redistributions of source code must retain the above copyright notice, this list of conditions and
+	the following disclaimer.
+    * Redistributions in binary form must reproduce the above copyright notice, this list of conditions and
+	the following disclaimer in the documentation and/or other materials provided with the distribution.
+
+ THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED
+ WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A
+ PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR
+ ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+ TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+ NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ POSSIBILITY OF SUCH DAMAGE.
+*/
+
+#pragma once
+
+#include "cinder/ImageIo.h"
+#include "cinder/Surface.h"
+#include "cinder/ip/BlockCompress.h"
+
+namespace cinder {
+
+typedef std::shared_ptr<class ImageTargetFileBcn> ImageTargetFileBcnRef;
+
+/** Writes images block-compressed as BC1, BC3, BC4, BC5 or BC7 in DDS or KTX (version 1) files, suitable for gl::Texture2d::createFromDds() and createFromKtx().
+	Registered for the "dds" and "ktx" extensions, where the block format follows the image: BC4 for grayscale, BC3 with alpha, BC1 otherwise,
+	and ImageTarget::Options::quality() below 0.5 encodes with ip::BlockQuality::FAST, 0.95 and above with BEST. Use create() with a Format to choose explicitly. **/
+class CI_API ImageTargetFileBcn : public ImageTarget {
+  public:
+	struct CI_API Format {
+		Format() : mBlockFormatDefault( true ), mBlockFormat( ip::BlockFormat::BC1 ), mQuality( ip::BlockQuality::NORMAL ), mMipmaps( true ) {}
+
+		//! Sets the block format. Default chooses by the image's color model and alpha.
+		Format&		blockFormat( ip::BlockFormat format ) { mBlockFormat = format; mBlockFormatDefault = false; return *this; }
+		//! Sets the encoder quality preset. Default is \c ip::BlockQuality::NORMAL
+		Format&		quality( ip::BlockQuality quality ) { mQuality = quality; return *this; }
+		//! Sets whether a full mipmap chain is generated with ip::resize() and written. Default is \c true
+		Format&		mipmaps( bool enable = true ) { mMipmaps = enable; return *this; }
+
+		bool				isBlockFormatDefault() const { return mBlockFormatDefault; }
+		ip::BlockFormat		getBlockFormat() const { return mBlockFormat; }
+		ip::BlockQuality	getQuality() const { return mQuality; }
+		bool				getMipmaps() const { return mMipmaps; }
+
+	  protected:
+		bool				mBlockFormatDefault;
+		ip::BlockFormat		mBlockFormat;
+		ip::BlockQuality	mQuality;
+		bool				mMipmaps;
+	};
+
+	static ImageTargetRef		create( DataTargetRef dataTarget, ImageSourceRef imageSource, ImageTarget::Options options, const std::string &extensionData );
+	//! Creates an ImageTarget writing \a imageSource with \a format to a \a container file, which is either \c "dds" or \c "ktx". Pass the result to writeImage().
+	static ImageTargetRef		create( DataTargetRef dataTarget, ImageSourceRef imageSource, const Format &format, const std::string &container );
+
+	void*	getRowPointer( int32_t row ) override;
+	void	finalize() override;
+
+	static void		registerSelf();
+
+  protected:
+	ImageTargetFileBcn( DataTargetRef dataTarget, ImageSourceRef imageSource, const Format &format, const std::string &container );
+
+	void	writeDds( const std::vector<std::vector<uint8_t>> &levels );
+	void	writeKtx( const std::vector<std::vector<uint8_t>> &levels );
+
+	DataTargetRef		mDataTarget;
+	Format				mFormat;
+	std::string			mContainer;
+	Surface8u			mSurface;
+	bool				mSourceHasAlpha;
+};
+
+} // namespace cinder
@@ -0,0 +1,62 @@
+/*
+ Copyright (c) 2026, The Cinder Project
+
+ This code is intended to be used with the Cinder C++ library, http://libcinder.org
+
+ Redistribution and use in source and binary forms, with or without modification, are permitted provided that
+ the following conditions are met:
+
+    * Redistributions of source code must retain the above copyright notice, this list of conditions and
+	the following disclaimer.
+    * Redistributions in binary form must reproduce the above copyright notice, this list of conditions and
+	the following disclaimer in the documentation and/or other materials provided with the distribution.
+
+ THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED
+ WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A
+ PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR
+ ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+ TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+ NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ POSSIBILITY OF SUCH DAMAGE.
+*/
+
+#pragma once
+
+#include "cinder/Cinder.h"
+#include "cinder/Filesystem.h"
+#include "cinder/Noncopyable.h"
+
+#include <cstdint>
+#include <memory>
+
+namespace cinder {
+
+typedef std::shared_ptr<class MappedFile>	MappedFileRef;
+
+//! Read-only memory mapping of an entire file. Pages are read from disk as they are first touched, and may be dropped again under memory pressure.
+class CI_API MappedFile : private Noncopyable {
+  public:
+	//! Returns an empty MappedFileRef if \a path can't be mapped, such as when it doesn't exist or is empty.
+	static MappedFileRef	create( const fs::path &path );
+	~MappedFile();
+
+	const uint8_t*	getData() const		{ return mData; }
+	size_t			getSize() const		{ return mSize; }
+
+	//! Faults in the pages spanning \a size bytes from \a begin, so that they are resident by the time they are read.
+	void	willNeed( const uint8_t *begin, size_t size ) const;
+
+  private:
+	MappedFile();
+
+#if defined( CINDER_MSW )
+	void			*mFile, *mMapping;
+#else
+	int				mFd;
+#endif
+	const uint8_t	*mData;
+	size_t			mSize;
+};
+
+} // namespace cinder
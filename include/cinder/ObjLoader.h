@@ -43,6 +43,9 @@ namespace cinder {
  * myCubeRef = gl::Batch::create( loader, gl::getStockShader( gl::ShaderDef().color() ) );
  * myCubeRef->draw();
  * \endcode
+ *
+ * Files are mapped into memory (or read whole from streams) and parsed in parallel 1 MiB chunks; vertices are deduplicated through a hash
+ * table when the output is first needed. \see loadObjCached() to skip parsing on later loads.
 **/
 
 class CI_API ObjLoader : public geom::Source {
@@ -113,6 +116,25 @@ class CI_API ObjLoader : public geom::Source {
 	//! Returns a vector<> of the Groups in the OBJ.
 	const std::vector<Group>&		getGroups() const { return mGroups; }
 
+	//! How long each phase of loading took
+	struct CI_API Timing {
+		//! Time spent mapping the file, or reading the stream into memory
+		double		mReadSeconds;
+		//! Time spent splitting the file into chunks and counting the vertices in each
+		double		mCountSeconds;
+		//! Time spent parsing the chunks in parallel
+		double		mParseSeconds;
+		//! Time spent assembling groups and faces from the chunks
+		double		mMergeSeconds;
+		//! Time spent deduplicating vertices and triangulating faces, the last time the output was built. 0 until it's first needed.
+		double		mLoadSeconds;
+
+		double		getTotalSeconds() const { return mReadSeconds + mCountSeconds + mParseSeconds + mMergeSeconds + mLoadSeconds; }
+	};
+
+	//! Returns how long each phase of loading took
+	const Timing&	getTiming() const { return mTiming; }
+
 	size_t			getNumVertices() const override { load(); return mOutputVertices.size(); }
 	size_t			getNumIndices() const override { load(); return mOutputIndices.size(); }
 	geom::Primitive	getPrimitive() const override { return geom::Primitive::TRIANGLES; }
@@ -122,21 +144,18 @@ class CI_API ObjLoader : public geom::Source {
 	Source*			clone() const override { return new ObjLoader( *this ); }
 
   private:
-	typedef std::tuple<int,int> VertexPair;
-	typedef std::tuple<int,int,int> VertexTriple;
+	class VertexHash;
 
-	void	parse( bool includeNormals, bool includeTexCoords );
- 	void	parseFace( Group *group, const Material *material, const std::string &s, bool includeNormals, bool includeTexCoords );
+	void	parse( const DataSourceRef &dataSource, bool includeNormals, bool includeTexCoords );
+	void	parse( const char *data, size_t size, bool includeNormals, bool includeTexCoords );
     void    parseMaterial( std::shared_ptr<IStreamCinder> material );
 
 	void	load() const;
 
-	void	loadGroupNormalsTextures( const Group &group, std::map<VertexTriple,int> &uniqueVerts ) const;
-	void	loadGroupNormals( const Group &group, std::map<VertexPair,int> &uniqueVerts ) const;
-	void	loadGroupTextures( const Group &group, std::map<VertexPair,int> &uniqueVerts ) const;
-	void	loadGroup( const Group &group, std::map<int,int> &uniqueVerts ) const;
-
-	std::shared_ptr<IStreamCinder>	mStream;
+	void	loadGroupNormalsTextures( const Group &group, VertexHash &uniqueVerts ) const;
+	void	loadGroupNormals( const Group &group, VertexHash &uniqueVerts ) const;
+	void	loadGroupTextures( const Group &group, VertexHash &uniqueVerts ) const;
+	void	loadGroup( const Group &group, VertexHash &uniqueVerts ) const;
 
 	std::vector<vec3>			    mInternalVertices, mInternalNormals;
 	std::vector<vec2>			    mInternalTexCoords;
@@ -154,6 +173,7 @@ class CI_API ObjLoader : public geom::Source {
 	std::vector<Group>				mGroups;
 	std::map<std::string, Material>	mMaterials;
 
+	mutable Timing					mTiming;
 };
 
 //! Writes \a source to a new OBJ file to \a dataTarget.
@@ -164,4 +184,10 @@ CI_API inline void	writeObj( const DataTargetRef &dataTarget, const geom::Source
 	writeObj( dataTarget, *source, includeNormals, includeTexCoords );
 }
 
+/** Returns the OBJ file at \a path as a geom::Source, loaded from the version 3 TriMesh file at \a cachePath when that is at least as new as the OBJ, which maps it
+	in milliseconds. Otherwise the OBJ is parsed and written to \a cachePath for next time, through a temporary file that replaces it once complete. The cache holds
+	every group, with the attributes that were included when it was written. An empty \a cachePath appends ".msh" to \a path, preceded by ".nonormals" and
+	".notexcoords" when \a includeNormals or \a includeTexCoords is FALSE, so that each combination has its own cache; an explicit \a cachePath is only valid for one. **/
+CI_API geom::SourceRef	loadObjCached( const fs::path &path, const fs::path &cachePath = fs::path(), bool includeNormals = true, bool includeTexCoords = true );
+
 } // namespace cinder
@@ -34,6 +34,8 @@
 #include "cinder/Filesystem.h"
 #include "cinder/Exception.h"
 
+#include <functional>
+
 namespace cinder {
 
 template<typename T>
@@ -99,6 +101,7 @@ class CI_API SurfaceConstraintsDefault : public SurfaceConstraints {
 
 typedef std::shared_ptr<class ImageSource> ImageSourceRef;
 typedef std::shared_ptr<class ImageTarget> ImageTargetRef;
+typedef std::shared_ptr<class ImageDecodeRequest> ImageDecodeRequestRef;
 
 template<typename T>
 //! An in-memory representation of an image. \ImplShared
@@ -146,13 +149,14 @@ class CI_API SurfaceT {
 	static std::shared_ptr<SurfaceT<T>>	create( const SurfaceT<T> &surface )
 	{ return std::make_shared<SurfaceT<T>>( surface ); }
 
-#if defined( CINDER_UWP )
-	/** \brief Constructs asynchronously a Surface from an images located at \a path. The loaded Surface is returned in \a surface.
-		If you are creating a Surface from an image that is located outside of the WinRT Windows Store App folder, you must use this method.
+	//! Asynchronously loads the image at \a path into a new Surface on ImageDecodeService::instance(). \a callback is called on the App's thread, with a null SurfaceRef if loading failed. Requests with a higher \a priority are decoded first.
+	static ImageDecodeRequestRef	loadImageAsync( const fs::path &path, const std::function<void ( std::shared_ptr<SurfaceT<T>> )> &callback, int priority = 0 );
+	/** \brief Asynchronously loads the image at \a path on ImageDecodeService::instance(). \a surface is assigned the result on the App's thread, and must outlive the request.
+		On UWP, you must use this method if you are creating a Surface from an image that is located outside of the Windows Store App folder.
 	**/
-	static void loadImageAsync(const fs::path path, SurfaceT &surface, const SurfaceConstraints &constraints = SurfaceConstraintsDefault() );
-	static void loadImageAsync(const fs::path path, SurfaceT &surface, const SurfaceConstraints &constraints = SurfaceConstraintsDefault(), bool alpha = true );
-#endif
+	static ImageDecodeRequestRef	loadImageAsync( const fs::path path, SurfaceT &surface, const SurfaceConstraints &constraints = SurfaceConstraintsDefault() );
+	//! Asynchronously loads the image at \a path into \a surface, including an alpha channel based on \a alpha.
+	static ImageDecodeRequestRef	loadImageAsync( const fs::path path, SurfaceT &surface, const SurfaceConstraints &constraints, bool alpha );
 
 	SurfaceT<T>&	operator=( const SurfaceT<T> &rhs );
 	SurfaceT<T>&	operator=( SurfaceT<T> &&rhs );
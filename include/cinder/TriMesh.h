@@ -34,6 +34,7 @@
 #include "cinder/Color.h"
 #include "cinder/Rect.h"
 #include "cinder/GeomIo.h"
+#include "cinder/MappedFile.h"
 
 namespace cinder {
 
@@ -66,6 +67,28 @@ class CI_API TriMesh : public geom::Source {
 		uint8_t		mTexCoords0Dims, mTexCoords1Dims, mTexCoords2Dims, mTexCoords3Dims;
 	};
 
+	//! Options for writing the version 3 format, whose blocks can be used in place from a memory mapping. \see MappedTriMesh
+	class CI_API WriteOptions {
+	  public:
+		WriteOptions();
+
+		//! Limits the attributes written to \a attribs. By default every attribute is written.
+		WriteOptions&	attribs( const std::set<geom::Attrib> &attribs );
+		//! Stores positions as 16-bit fractions of their bounding box, within 1 / 131070 of its extent on each axis. Default is \c false.
+		WriteOptions&	quantizePositions( bool quantize = true ) { mQuantizePositions = quantize; return *this; }
+		//! Stores normals, tangents and bitangents as 2 16-bit octahedral coordinates, within 0.01 degrees. Zero vectors don't survive. Default is \c false.
+		WriteOptions&	quantizeNormals( bool quantize = true ) { mQuantizeNormals = quantize; return *this; }
+		//! Stores texture coordinates as half floats, with 11 significant bits. Default is \c false.
+		WriteOptions&	quantizeTexCoords( bool quantize = true ) { mQuantizeTexCoords = quantize; return *this; }
+		//! Enables or disables all quantization at once.
+		WriteOptions&	quantize( bool quantize = true ) { mQuantizePositions = mQuantizeNormals = mQuantizeTexCoords = quantize; return *this; }
+		//! Stores indices as variable length differences from the previous index, which suits meshes in vertex cache order. Default is \c false.
+		WriteOptions&	compressIndices( bool compress = true ) { mCompressIndices = compress; return *this; }
+
+		uint32_t	mAttribMask;
+		bool		mQuantizePositions, mQuantizeNormals, mQuantizeTexCoords, mCompressIndices;
+	};
+
 	static TriMeshRef	create() { return TriMeshRef( new TriMesh( Format().positions().normals().texCoords() ) ); }
 	static TriMeshRef	create( const Format &format ) { return TriMeshRef( new TriMesh( format ) ); }
 	static TriMeshRef	create( const geom::Source &source ) { return TriMeshRef( new TriMesh( source ) ); }
@@ -306,12 +329,18 @@ class CI_API TriMesh : public geom::Source {
 	void		write( const DataTargetRef &dataTarget, bool writeNormals, bool writeTangents ) const;
 	//! Writes this TriMesh out to a binary data file. You can specify which attributes to write by supplying a list of \a attribs.
 	void		write( const DataTargetRef &dataTarget, const std::set<geom::Attrib> &attribs ) const;
+	/*! Writes this TriMesh out to a binary data file in the version 3 format, optionally quantized and compressed according to \a options. Each
+		attribute is a separate block, aligned so that MappedTriMesh can use it in place. read() accepts every version. */
+	void		write( const DataTargetRef &dataTarget, const WriteOptions &options ) const;
 
 	/*! Adds or replaces normals by calculating them from the vertices and faces. If \a smooth is TRUE,
 		similar vertices are grouped together to calculate their average. This will not change the mesh,
 		nor will it affect texture mapping. If \a weighted is TRUE, larger polygons contribute more to
 		the calculated normal. Renormalization requires 3D vertices. */
 	bool		recalculateNormals( bool smooth = false, bool weighted = false );
+	/*! Adds or replaces normals by calculating them from the vertices and faces, with each face contributing according to \a weighting.
+		If \a smooth is TRUE, vertices sharing a position share a normal. Renormalization requires 3D vertices. */
+	bool		recalculateNormals( geom::NormalWeighting weighting, bool smooth = false );
 	//! Adds or replaces tangents by calculating them from the normals and texture coordinates. Requires 3D normals and 2D texture coordinates.
 	bool		recalculateTangents();
 	//! Adds or replaces bitangents by calculating them from the normals and tangents. Requires 3D normals and tangents.
@@ -320,6 +349,21 @@ class CI_API TriMesh : public geom::Source {
 	/*! Subdivide each triangle of the TriMesh into \a division times division triangles. Division less than 2 leaves the mesh unaltered.
 		Optionally, vertices are normalized if \a normalize is TRUE. */
 	void		subdivide( int division = 2, bool normalize = false );
+	/*! Merges vertices whose positions lie within \a epsilon of one another and remaps the indices to match. Unless \a positionsOnly is TRUE,
+		every other attribute must match within \a epsilon as well. Merged vertices keep the attributes of the lowest-indexed vertex. A non-indexed mesh becomes indexed. Requires 3D vertices. */
+	void		weld( float epsilon = 0, bool positionsOnly = false );
+	/*! Reorders the triangles for a post-transform vertex cache of \a cacheSize entries, then clusters of them to reduce overdraw while keeping the
+		ACMR at about \a overdrawThreshold times that order, then the vertices in order of first use if \a vertexFetch is TRUE. An \a overdrawThreshold
+		of 0 skips overdraw optimization, which requires 3D vertices. geom::calculateVertexCacheStats() measures the result. */
+	void		optimize( size_t cacheSize = 16, float overdrawThreshold = 1.05f, bool vertexFetch = true );
+	/*! Reduces the triangles to \a targetRatio of their number by quadric error edge collapses, as far as an error of \a targetError relative to the largest
+		extent of the mesh allows, and returns the error reached. Vertices only move onto neighboring vertices, so every attribute keeps its values, and
+		borders are kept. Unreferenced vertices are removed. Requires 3D vertices. \see geom::simplify() */
+	float		simplify( float targetRatio = 0.5f, float targetError = 0.01f );
+	/*! Returns the indices of \a numLevels levels of detail starting with this mesh's own, each simplified to \a ratio times the triangles of the previous level,
+		as far as \a targetError allows. Every level indexes this mesh's vertices unchanged, so one vertex buffer can serve the whole chain. \a resultErrors
+		receives the error of each level, relative to the largest extent of the mesh. Requires 3D vertices. */
+	std::vector<std::vector<uint32_t>>	calcLodChain( size_t numLevels, float ratio = 0.5f, float targetError = 1.0f, std::vector<float> *resultErrors = nullptr ) const;
 
 	//! Create TriMesh from vectors of vertex data.
 /*	static TriMesh		create( std::vector<uint32_t> &indices, const std::vector<ColorAf> &colors,
@@ -341,6 +385,7 @@ class CI_API TriMesh : public geom::Source {
 	//! Returns whether or not the vertex, color etc. at both indices is the same.
 	bool		verticesEqual( uint32_t indexA, uint32_t indexB ) const;
 
+	void		readImplV3( const DataSourceRef &dataSource );
 	void		readImplV2( const IStreamRef &in );
 	void		readImplV1( const IStreamRef &in );
 
@@ -366,6 +411,60 @@ class CI_API TriMesh : public geom::Source {
 	std::vector<uint32_t>	mIndices;
 	
 	friend class TriMeshGeomTarget;
+	friend class MappedTriMesh;
+};
+
+typedef std::shared_ptr<class MappedTriMesh>	MappedTriMeshRef;
+
+/*! A TriMesh file in the version 3 format, mapped into memory when it is a file and loaded otherwise. Blocks stored as floats and uncompressed
+	indices are used in place; quantized blocks and compressed indices are decoded as they are loaded, on up to ip::getMaxThreads() threads.
+	As a geom::Source it loads into a TriMesh like any other, and gl::VboMesh::create() uploads it straight from the mapping. \see TriMesh::WriteOptions */
+class CI_API MappedTriMesh : public geom::Source {
+  public:
+	//! Throws cinder::Exception if \a dataSource isn't a valid version 3 TriMesh file.
+	static MappedTriMeshRef	create( const DataSourceRef &dataSource ) { return MappedTriMeshRef( new MappedTriMesh( dataSource ) ); }
+
+	//! Throws cinder::Exception if \a dataSource isn't a valid version 3 TriMesh file.
+	MappedTriMesh( const DataSourceRef &dataSource );
+
+	//! Returns a pointer to the floats of \a attr in the mapping, or \c nullptr if \a attr is quantized or absent.
+	const float*		getAttribData( geom::Attrib attr ) const;
+	//! Writes getNumVertices() * getAttribDims( \a attr ) floats of \a attr to \a result, decoding it if it's quantized.
+	void				decodeAttrib( geom::Attrib attr, float *result ) const;
+	//! Returns a pointer to the indices in the mapping, or \c nullptr if they're compressed or absent. Unlike decodeIndices(), their range isn't checked.
+	const uint32_t*		getIndexData() const;
+	//! Writes getNumIndices() indices to \a result, decoding them if they're compressed. Throws a cinder::Exception if an index is out of range of the vertices.
+	void				decodeIndices( uint32_t *result ) const;
+	//! Returns the size of the file in bytes.
+	size_t				getFileSize() const { return mSize; }
+
+	// geom::Source virtuals
+	size_t				getNumVertices() const override { return mNumVertices; }
+	size_t				getNumIndices() const override { return mNumIndices; }
+	geom::Primitive		getPrimitive() const override { return geom::Primitive::TRIANGLES; }
+	uint8_t				getAttribDims( geom::Attrib attr ) const override;
+	geom::AttribSet		getAvailableAttribs() const override;
+	void				loadInto( geom::Target *target, const geom::AttribSet &requestedAttribs ) const override;
+	MappedTriMesh*		clone() const override { return new MappedTriMesh( *this ); }
+
+  protected:
+	struct Block {
+		uint8_t			mDims, mEncoding;
+		size_t			mCount;
+		const uint8_t	*mData;
+		size_t			mSize;
+		float			mMin[4], mScale[4];
+	};
+
+	const Block*	findBlock( geom::Attrib attr ) const;
+
+	MappedFileRef					mFile;
+	BufferRef						mBuffer;
+	const uint8_t					*mData;
+	size_t							mSize;
+	size_t							mNumVertices, mNumIndices;
+	std::map<geom::Attrib, Block>	mBlocks;
+	Block							mIndices;
 };
 
 } // namespace cinder
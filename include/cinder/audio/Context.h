@@ -26,6 +26,7 @@
 #include "cinder/audio/Node.h"
 #include "cinder/audio/InputNode.h"
 #include "cinder/audio/OutputNode.h"
+#include "cinder/audio/dsp/CommandQueue.h"
 #include "cinder/Timer.h"
 
 #include <list>
@@ -36,6 +37,7 @@
 namespace cinder { namespace audio {
 
 class DeviceManager;
+class ParallelGraphProcessor;
 
 //! \brief Manages the creation, connections, and lifecycle of audio::Node's.
 
@@ -116,14 +118,30 @@ class CI_API Context : public std::enable_shared_from_this<Context> {
 	//! If \a \a callFuncBeforeProcess is true, then `func` will be called at the beginning of the processing block, if false will be called at the end.
 	//! \note Should be called from the user thread. Currently only one event can be scheduled on a node at a time. \a node is owned until the scheduled event completes.
 	void scheduleEvent( double when, const NodeRef &node, bool callFuncBeforeProcess, const std::function<void ()> &func );
-	//! Immediately cancels any events scheduled with scheduleEvent().
+	//! Cancels any events scheduled with scheduleEvent(), before the next processing block begins.
 	void cancelScheduledEvents( const NodeRef &node );
+
+	//! \brief Executes \a command on the audio thread at the start of the next processing block, without blocking on getMutex().
+	//!
+	//! Commands are executed in the order they were enqueued. If called from the audio thread, or if the Context is disabled, \a command is
+	//! executed immediately. Anything captured by \a command is released on a user thread during a later call to enqueueCommand().
+	void enqueueCommand( const std::function<void ()> &command );
 	//! \deprecated  use scheduleEvent() instead.
 	void schedule( double when, const NodeRef &node, bool callFuncBeforeProcess, const std::function<void ()> &func )	{ scheduleEvent( when, node, callFuncBeforeProcess, func ); }
 
+	//! \brief Sets the number of threads used to process the Node graph, including the audio thread. Default is 1.
+	//!
+	//! When greater than one, independent subgraphs (ex. the Node's of each Voice before they are summed) are pulled concurrently on
+	//! a pool of worker threads at the start of each processing block, see ParallelGraphProcessor. Inputs are still summed on the
+	//! audio thread in the same order, so output is identical to single-threaded processing. Passing 0 uses the number of hardware threads.
+	//! \note Node's within a subgraph must not be shared as a Param processor with other parts of the graph.
+	void	setNumProcessingThreads( size_t numThreads );
+	//! Returns the number of threads used to process the Node graph, including the audio thread.
+	size_t	getNumProcessingThreads() const;
+
 	//! Returns the mutex used to synchronize the audio thread. This is also used internally by the Node class when making connections.
 	std::mutex& getMutex() const			{ return mMutex; }
-	//! Returns true if the current thread is the thread used for audio processing, false otherwise.
+	//! Returns true if the current thread is the thread used for audio processing (or one of its parallel processing threads), false otherwise.
 	bool isAudioThread() const;
 
 	//! OutputNode implementations should call this before each rendering block.
@@ -160,6 +178,7 @@ class CI_API Context : public std::enable_shared_from_this<Context> {
 	void	preProcessScheduledEvents();
 	void	postProcessScheduledEvents();
 	void	incrementFrameCount();
+	void	updateParallelPartition();
 
 	static void registerClearStatics();
 
@@ -179,9 +198,20 @@ class CI_API Context : public std::enable_shared_from_this<Context> {
 	mutable std::mutex		mMutex;
 	std::thread::id			mAudioThreadId;
 
+	// user thread -> audio thread mutations, drained in preProcess(). mCommandMutex only serializes producers, it is never taken by the audio thread.
+	dsp::CommandQueue		mCommandQueue;
+	std::mutex				mCommandMutex;
+
+	// only set when processing with more than one thread. Node's mark the partition dirty with mMutex locked whenever their
+	// connections change, and it is rebuilt on the audio thread at the start of the next block.
+	std::unique_ptr<ParallelGraphProcessor>	mParallelProcessor;
+	std::atomic<bool>						mParallelPartitionDirty;
+
 	// - Context is stored in Node classes as a weak_ptr, so it needs to (for now) be created as a shared_ptr
 	static std::shared_ptr<Context>			sMasterContext;
 	static std::unique_ptr<DeviceManager>	sDeviceManager; // TODO: consider turning DeviceManager into a HardwareContext class
+
+	friend class Node;
 };
 
 template<typename NodeT>
@@ -0,0 +1,148 @@
+/*
+ Copyright (c) 2026, The Cinder Project
+
+ This code is intended to be used with the Cinder C++ library, http://libcinder.org
+
+ Redistribution and use in source and binary forms, with or without modification, are permitted provided that
+ the following conditions are met:
+
+    * Redistributions of source code must retain the above copyright notice, this list of conditions and
+	the following disclaimer.
+    * Redistributions in binary form must reproduce the above copyright notice, this list of conditions and
+	the following disclaimer in the documentation and/or other materials provided with the distribution.
+
+ THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED
+ WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A
+ PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR
+ ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+ TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+ NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ POSSIBILITY OF SUCH DAMAGE.
+*/
+
+#pragma once
+
+#include "cinder/audio/Context.h"
+#include "cinder/audio/Target.h"
+
+namespace cinder { namespace audio {
+
+typedef std::shared_ptr<class ContextOffline>		ContextOfflineRef;
+typedef std::shared_ptr<class OutputOfflineNode>	OutputOfflineNodeRef;
+
+//! \brief OutputNode that pulls its inputs on demand instead of from a hardware callback.
+//!
+//! Rendering happens synchronously on the thread that calls one of the render methods, which becomes the Context's audio thread
+//! for the duration of the call. Blocks are processed as fast as the CPU allows, and because the Context's frame count is
+//! advanced exactly as it is for an OutputDeviceNode, events scheduled with Context::scheduleEvent() and Param ramps are
+//! applied at the same sample positions as they would be in realtime. Clip detection is disabled by default, since silencing
+//! a rendered block is rarely what you want when writing to disk.
+//!
+//! \note Nodes that rely on a background thread to keep up with realtime playback (ex. FilePlayerNode with read async enabled)
+//! may underrun when rendering faster than realtime. Disable asynchronous reading on those Nodes for deterministic results.
+//! FilePlayerNode's that stream from a FileBlockCache are the exception, they wait for their blocks to be loaded instead.
+class CI_API OutputOfflineNode : public OutputNode {
+  public:
+	struct Format : public Node::Format {
+		Format() : mSampleRate( 44100 ), mFramesPerBlock( 512 )
+		{
+			Node::Format::channels( 2 );
+		}
+
+		//! Sets the samplerate that the Context will render at. Default is 44100.
+		Format&		sampleRate( size_t sampleRate )			{ mSampleRate = sampleRate; return *this; }
+		//! Sets the number of frames processed per block. Default is 512. Larger blocks reduce per-block overhead when rendering to disk.
+		Format&		framesPerBlock( size_t framesPerBlock )	{ mFramesPerBlock = framesPerBlock; return *this; }
+
+		size_t		getSampleRate() const					{ return mSampleRate; }
+		size_t		getFramesPerBlock() const				{ return mFramesPerBlock; }
+
+		// reimpl Node::Format
+		Format&		channels( size_t ch )					{ Node::Format::channels( ch ); return *this; }
+		Format&		channelMode( ChannelMode mode )			{ Node::Format::channelMode( mode ); return *this; }
+		Format&		autoEnable( bool autoEnable = true )	{ Node::Format::autoEnable( autoEnable ); return *this; }
+
+	  protected:
+		size_t		mSampleRate, mFramesPerBlock;
+	};
+
+	OutputOfflineNode( const Format &format = Format() );
+	virtual ~OutputOfflineNode();
+
+	//! Returns the samplerate specified at construction.
+	size_t getOutputSampleRate() override		{ return mSampleRate; }
+	//! Returns the frames per block specified at construction.
+	size_t getOutputFramesPerBlock() override	{ return mFramesPerBlock; }
+
+	//! Sets the TargetFile that rendered frames are written to, by renderBlock() as well as renderFrames() and renderSeconds(). Pass an empty TargetFileRef to stop writing.
+	//! \note the number of channels of \a targetFile should match getNumChannels().
+	void					setTargetFile( const TargetFileRef &targetFile );
+	//! Returns the TargetFile that rendered blocks are written to, or an empty TargetFileRef if none is set.
+	const TargetFileRef&	getTargetFile() const	{ return mTargetFile; }
+
+	//! Processes one block of audio, writes it to the TargetFile and returns the rendered Buffer, which is valid until the next block is rendered. Returns \a nullptr if this Node is not enabled.
+	//! Frames left over from a previous renderFrames() are written first.
+	const Buffer*	renderBlock();
+	//! Renders \a numFrames frames of audio, in blocks of getOutputFramesPerBlock(). The frames of the last block beyond \a numFrames are kept and come first on the
+	//! next call, so that consecutive calls produce one continuous stream. Returns the number of frames rendered.
+	uint64_t		renderFrames( uint64_t numFrames );
+	//! Renders \a seconds of audio, as measured against getOutputSampleRate(). Returns the number of frames rendered.
+	uint64_t		renderSeconds( double seconds );
+
+	//! Returns the total number of frames rendered by this Node. The Context may be ahead by the frames kept from the last block of renderFrames().
+	uint64_t		getNumRenderedFrames() const	{ return mNumRenderedFrames; }
+	//! Returns the ratio of audio time rendered to wall-clock time spent during the last call to renderFrames() or renderSeconds(). A value of 10 means audio was rendered ten times faster than realtime.
+	double			getLastRealtimeFactor() const	{ return mLastRealtimeFactor; }
+
+  protected:
+	bool supportsProcessInPlace() const	override	{ return false; }
+	void uninitialize() override;
+
+  private:
+	const Buffer*	processBlock();
+	void			emitFrames( const Buffer *buffer, size_t numFrames, size_t frameOffset );
+	void			emitPendingFrames( size_t numFrames );
+
+	size_t			mSampleRate, mFramesPerBlock;
+	TargetFileRef	mTargetFile;
+	size_t			mNumPendingFrames;	// processed frames at the end of the internal buffer that haven't been emitted yet
+	uint64_t		mNumRenderedFrames;
+	double			mLastRealtimeFactor;
+};
+
+//! \brief Context that renders its audio graph faster than realtime, without any hardware I/O.
+//!
+//! Useful for rendering Node graphs to disk in batch jobs or on headless machines. The ContextOffline must be owned by a
+//! std::shared_ptr, since Node's hold a weak reference to it. Its output is an OutputOfflineNode configured by the Format
+//! passed at construction; audio is produced by calling one of the render methods on getOutputOffline(). Example:
+//! \code
+//! auto ctx = std::make_shared<audio::ContextOffline>( audio::OutputOfflineNode::Format().sampleRate( 48000 ).framesPerBlock( 4096 ) );
+//! auto osc = ctx->makeNode( new audio::GenSineNode( 440 ) );
+//! osc >> ctx->getOutput();
+//! osc->enable();
+//! ctx->enable();
+//! ctx->getOutputOffline()->setTargetFile( audio::TargetFile::create( "out.wav", 48000, 2, audio::SampleType::FLOAT_32 ) );
+//! ctx->getOutputOffline()->renderSeconds( 60 );
+//! \endcode
+class CI_API ContextOffline : public Context {
+  public:
+	ContextOffline( const OutputOfflineNode::Format &format = OutputOfflineNode::Format() );
+	virtual ~ContextOffline();
+
+	//! Always throws AudioContextExc, ContextOffline has no access to hardware devices.
+	OutputDeviceNodeRef	createOutputDeviceNode( const DeviceRef &device = nullptr, const Node::Format &format = Node::Format() ) override;
+	//! Always throws AudioContextExc, ContextOffline has no access to hardware devices.
+	InputDeviceNodeRef	createInputDeviceNode( const DeviceRef &device = nullptr, const Node::Format &format = Node::Format() ) override;
+
+	//! Overridden to create an OutputOfflineNode with the Format passed at construction if no output has been set.
+	const OutputNodeRef&	getOutput() override;
+	//! Returns the current output as an OutputOfflineNode, or an empty reference if setOutput() was called with a different type of OutputNode.
+	OutputOfflineNodeRef	getOutputOffline();
+
+  private:
+	OutputOfflineNode::Format	mFormat;
+	bool						mOutputCreated;
+};
+
+} } // namespace cinder::audio
@@ -0,0 +1,105 @@
+/*
+ Copyright (c) 2026, The Cinder Project
+
+ This code is intended to be used with the Cinder C++ library, http://libcinder.org
+
+ Redistribution and use in source and binary forms, with or without modification, are permitted provided that
+ the following conditions are met:
+
+    * Redistributions of source code must retain the above copyright notice, this list of conditions and
+	the following disclaimer.
+    * Redistributions in binary form must reproduce the above copyright notice, this list of conditions and
+	the following disclaimer in the documentation and/or other materials provided with the distribution.
+
+ THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED
+ WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A
+ PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR
+ ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+ TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+ NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ POSSIBILITY OF SUCH DAMAGE.
+*/
+
+#pragma once
+
+#include "cinder/audio/Node.h"
+#include "cinder/audio/Source.h"
+
+#include <condition_variable>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace cinder { namespace audio {
+
+namespace dsp {
+	class Convolver;
+}
+
+typedef std::shared_ptr<class ConvolverNode>	ConvolverNodeRef;
+
+//! \brief Convolves its input with an impulse response, for example to apply the reverb of a recorded space.
+//!
+//! Convolution is done in the frequency domain with a non-uniformly partitioned overlap-add scheme, so that impulse responses of
+//! several seconds are practical:
+//! - The first tail block size samples of the impulse response are convolved in partitions of the head block size, without latency.
+//! - The next tail block size samples are convolved in partitions of the head block size, one tail block ahead of when they are heard.
+//! - The rest is convolved in partitions of the tail block size on a background thread, which has the duration of one tail block to
+//!   finish each block. The audio thread only waits for it if it falls behind.
+//!
+//! If the impulse response has one channel it is applied to every channel, otherwise input channel \a n is convolved with impulse
+//! response channel \a n modulo the number of impulse response channels.
+class CI_API ConvolverNode : public Node {
+  public:
+	//! Constructs a ConvolverNode with an optional \a impulseResponse and \a format.
+	ConvolverNode( const BufferRef &impulseResponse = BufferRef(), const Format &format = Format() );
+	virtual ~ConvolverNode();
+
+	//! Sets the impulse response. The Node's output is silent until one is set.
+	void	setImpulseResponse( const BufferRef &impulseResponse );
+	//! Loads the impulse response from \a sourceFile, converting it to the Context's samplerate if necessary.
+	void	loadImpulseResponse( const SourceFileRef &sourceFile );
+	//! Returns the impulse response, or an empty BufferRef if none is set.
+	const BufferRef&	getImpulseResponse() const		{ return mImpulseResponse; }
+
+	//! Sets the partition sizes, which must be powers of two and \a headBlockSize must not be larger than \a tailBlockSize. Smaller head
+	//! blocks cost more cpu on the audio thread, larger tail blocks move more of the work to the background thread. Defaults are 256 and 8192.
+	void	setBlockSizes( size_t headBlockSize, size_t tailBlockSize );
+	//! Returns the partition size used for the start of the impulse response.
+	size_t	getHeadBlockSize() const	{ return mHeadBlockSize; }
+	//! Returns the partition size used for the tail of the impulse response, which is convolved on a background thread.
+	size_t	getTailBlockSize() const	{ return mTailBlockSize; }
+
+	//! Clears the convolution history, silencing any reverb that is still ringing out.
+	void	reset();
+
+  protected:
+	void initialize()				override;
+	void uninitialize()				override;
+	void process( Buffer *buffer )	override;
+
+  private:
+	struct ChannelState;
+
+	std::vector<std::unique_ptr<ChannelState>>	makeChannels() const;
+	void	setChannelsImpl( std::vector<std::unique_ptr<ChannelState>> &&channels );
+	void	processTails( Buffer *buffer );
+	void	tailThreadLoop();
+	void	startTails();
+	void	waitForTails();
+
+	BufferRef							mImpulseResponse;
+	size_t								mHeadBlockSize, mTailBlockSize;
+	std::vector<std::unique_ptr<ChannelState>>	mChannels;
+	size_t								mTailInputFill, mTail0WriteIndex, mTailWriteIndex;
+	bool								mHasTail0, mHasTail;
+
+	std::unique_ptr<std::thread>		mTailThread;
+	std::mutex							mTailMutex;
+	std::condition_variable				mTailCond;
+	bool								mTailPending, mTailThreadShouldQuit;
+};
+
+} } // namespace cinder::audio
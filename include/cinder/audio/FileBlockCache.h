@@ -0,0 +1,174 @@
+/*
+ Copyright (c) 2026, The Cinder Project
+
+ This code is intended to be used with the Cinder C++ library, http://libcinder.org
+
+ Redistribution and use in source and binary forms, with or without modification, are permitted provided that
+ the following conditions are met:
+
+    * Redistributions of source code must retain the above copyright notice, this list of conditions and
+	the following disclaimer.
+    * Redistributions in binary form must reproduce the above copyright notice, this list of conditions and
+	the following disclaimer in the documentation and/or other materials provided with the distribution.
+
+ THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED
+ WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A
+ PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR
+ ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+ TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+ NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ POSSIBILITY OF SUCH DAMAGE.
+*/
+
+#pragma once
+
+#include "cinder/audio/Source.h"
+#include "cinder/Noncopyable.h"
+
+#include <condition_variable>
+#include <list>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+namespace cinder { namespace audio {
+
+typedef std::shared_ptr<class FileBlockCache>		FileBlockCacheRef;
+
+//! \brief Bounded, least-recently-used cache of decoded audio file blocks, shared by any number of streaming readers.
+//!
+//! Files are split into blocks of Format::getFramesPerBlock() frames, which are decoded on demand by a small pool of I/O
+//! threads and kept until the cache grows beyond Format::getMaxBytes(). Readers open a Stream for each SourceFile they play.
+//! Streams of the same file path and samplerate share decoded blocks, so many players of one file cost the memory of one
+//! and the I/O threads serve all of them, regardless of how many Streams are open.
+//!
+//! Uncompressed WAV files whose samplerate matches the requested one are memory-mapped instead of decoded. Their samples
+//! are converted directly from the mapping on the reading thread and don't count towards the cache size; the I/O threads
+//! only fault in the pages a Stream is about to read.
+//!
+//! FilePlayerNode uses a FileBlockCache in place of its own read thread when constructed with one, see
+//! FilePlayerNode::FilePlayerNode( const SourceFileRef&, const FileBlockCacheRef&, const Node::Format& ).
+class CI_API FileBlockCache : public std::enable_shared_from_this<FileBlockCache>, private Noncopyable {
+  public:
+	struct Format {
+		Format() : mMaxBytes( 256 * 1024 * 1024 ), mFramesPerBlock( 32768 ), mNumIoThreads( 2 ), mMemoryMapping( true ) {}
+
+		//! Sets the number of bytes of decoded samples that the cache may hold before evicting blocks. Default is 256 MB.
+		Format&		maxBytes( size_t bytes )			{ mMaxBytes = bytes; return *this; }
+		//! Sets the number of frames per decoded block. Default is 32768.
+		Format&		framesPerBlock( size_t frames )		{ mFramesPerBlock = frames; return *this; }
+		//! Sets the number of I/O threads that decode blocks. Default is 2.
+		Format&		numIoThreads( size_t count )		{ mNumIoThreads = count; return *this; }
+		//! Sets whether uncompressed WAV files are memory-mapped instead of decoded. Default is true.
+		Format&		memoryMapping( bool enable )		{ mMemoryMapping = enable; return *this; }
+
+		size_t	getMaxBytes() const			{ return mMaxBytes; }
+		size_t	getFramesPerBlock() const	{ return mFramesPerBlock; }
+		size_t	getNumIoThreads() const		{ return mNumIoThreads; }
+		bool	isMemoryMappingEnabled() const	{ return mMemoryMapping; }
+
+	  protected:
+		size_t	mMaxBytes, mFramesPerBlock, mNumIoThreads;
+		bool	mMemoryMapping;
+	};
+
+	class Stream;
+
+	//! Creates a new FileBlockCache configured with \a format.
+	static FileBlockCacheRef	create( const Format &format = Format() );
+	//! Returns the FileBlockCache that is shared process-wide, created with a default Format on first use.
+	static FileBlockCacheRef	getDefault();
+
+	~FileBlockCache();
+
+	//! Opens a Stream that reads \a sourceFile at \a sampleRate. If \a sampleRate is 0, \a sourceFile's samplerate is used. \a sourceFile itself is never read from.
+	std::unique_ptr<Stream>	openStream( const SourceFileRef &sourceFile, size_t sampleRate = 0 );
+
+	const Format&	getFormat() const	{ return mFormat; }
+	//! Returns the number of bytes of decoded samples currently held by the cache.
+	size_t	getNumBytesCached() const;
+	//! Returns the number of decoded blocks currently held by the cache.
+	size_t	getNumBlocksCached() const;
+	//! Returns the number of distinct files that the cache currently has open.
+	size_t	getNumFilesOpen() const;
+	//! Returns the number of open Streams that read from a memory-mapped file.
+	size_t	getNumMemoryMappedStreams() const;
+	//! Evicts all blocks that aren't currently being read by a Stream.
+	void	clear();
+
+  private:
+	struct FileEntry;
+	struct Block;
+	struct StreamState;
+	struct BlockKeyHash {
+		size_t operator()( const std::pair<const FileEntry *, size_t> &key ) const;
+	};
+
+	typedef std::list<std::shared_ptr<Block>>	BlockList;
+
+	FileBlockCache( const Format &format );
+
+	std::shared_ptr<FileEntry>	openFile( const SourceFileRef &sourceFile, size_t sampleRate );
+	void	closeFile( const std::shared_ptr<FileEntry> &file );
+	std::shared_ptr<Block>		acquireBlock( const std::shared_ptr<FileEntry> &file, size_t blockIndex );
+	void	evictImpl( size_t maxBytes );
+	void	ioThreadLoop();
+	std::shared_ptr<StreamState>	claimStreamImpl();
+	void	serviceStream( StreamState *state );
+	void	wakeIoThreads();
+
+	Format		mFormat;
+
+	mutable std::mutex		mMutex;		// guards files, blocks and the LRU list
+	std::unordered_map<std::string, std::shared_ptr<FileEntry>>	mFiles;
+	std::unordered_map<std::pair<const FileEntry *, size_t>, BlockList::iterator, BlockKeyHash>	mBlocks;
+	BlockList				mLruBlocks;	// most recently used first
+	size_t					mNumBytes;
+
+	std::mutex				mStreamsMutex;	// guards mStreams and the servicing state of each StreamState
+	std::condition_variable	mWakeCond, mServicedCond;
+	std::vector<std::shared_ptr<StreamState>>	mStreams;
+	size_t					mScanBegin;
+	bool					mQuit;
+	std::vector<std::thread>	mIoThreads;
+
+	friend class Stream;
+};
+
+//! \brief Reads one SourceFile through a FileBlockCache. Created with FileBlockCache::openStream().
+//!
+//! read() and prefetch() are meant to be called from a single reading thread, typically the audio thread, and never block.
+class CI_API FileBlockCache::Stream : private Noncopyable {
+  public:
+	~Stream();
+
+	//! Returns the length of the stream in frames, at the samplerate it was opened with.
+	size_t	getNumFrames() const;
+	//! Returns the number of channels in the stream.
+	size_t	getNumChannels() const;
+	//! Returns true if samples are converted directly from a memory-mapped file rather than read from decoded blocks.
+	bool	isMemoryMapped() const;
+
+	//! Copies up to \a numFrames frames starting at \a readPos into \a buffer at \a bufferFrameOffset. Returns the number of frames copied,
+	//! which is less than \a numFrames if a block hasn't been loaded yet or the end of the stream is reached. Never blocks.
+	size_t	read( Buffer *buffer, size_t bufferFrameOffset, size_t readPos, size_t numFrames );
+	//! Same as read(), except that it waits for missing blocks to be loaded. Only returns less than \a numFrames at the end of the stream. Not suitable for realtime use.
+	size_t	readBlocking( Buffer *buffer, size_t bufferFrameOffset, size_t readPos, size_t numFrames );
+	//! Asks the I/O threads to load the blocks needed to continue reading from \a readPos. If \a loopEnd is greater than
+	//! \a loopBegin, reading is expected to wrap around from \a loopEnd to \a loopBegin. Never blocks.
+	void	prefetch( size_t readPos, size_t loopBegin = 0, size_t loopEnd = 0 );
+
+  private:
+	Stream( const FileBlockCacheRef &cache, const std::shared_ptr<StreamState> &state );
+
+	FileBlockCacheRef						mCache;
+	std::shared_ptr<StreamState>			mState;
+
+	friend class FileBlockCache;
+};
+
+} } // namespace cinder::audio
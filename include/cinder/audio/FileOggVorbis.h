@@ -46,6 +46,7 @@ class SourceFileOggVorbis : public SourceFile {
 	virtual ~SourceFileOggVorbis();
 
 	SourceFileRef	cloneWithSampleRate( size_t sampleRate ) const	override;
+	DataSourceRef	getDataSource() const							override	{ return mDataSource; }
 
 	size_t		getNumChannels() const	override		{ return mNumChannels; }
 	size_t		getSampleRateNative() const	override	{ return mSampleRate; }
@@ -0,0 +1,54 @@
+/*
+ Copyright (c) 2026, The Cinder Project
+
+ This code is intended to be used with the Cinder C++ library, http://libcinder.org
+
+ Redistribution and use in source and binary forms, with or without modification, are permitted provided that
+ the following conditions are met:
+
+    * Redistributions of source code must retain the above copyright notice, this list of conditions and
+	the following disclaimer.
+    * Redistributions in binary form must reproduce the above copyright notice, this list of conditions and
+	the following disclaimer in the documentation and/or other materials provided with the distribution.
+
+ THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED
+ WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A
+ PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR
+ ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+ TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+ NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ POSSIBILITY OF SUCH DAMAGE.
+*/
+
+#pragma once
+
+#include "cinder/audio/Target.h"
+#include "cinder/Stream.h"
+
+#include <vector>
+
+namespace cinder { namespace audio {
+
+//! \brief TargetFile implementation for writing uncompressed RIFF wave files.
+//!
+//! Platform independent, used for .wav files on platforms without a native encoder (ex. Linux). Supports SampleType::INT_16,
+//! INT_24 and FLOAT_32. The header's chunk sizes are patched when the TargetFileWav is destroyed, so the DataTarget's stream must be seekable.
+class CI_API TargetFileWav : public TargetFile {
+  public:
+	TargetFileWav( const DataTargetRef &dataTarget, size_t sampleRate, size_t numChannels, SampleType sampleType );
+	virtual ~TargetFileWav();
+
+	void performWrite( const Buffer *buffer, size_t numFrames, size_t frameOffset ) override;
+
+  private:
+	void writeHeader();
+
+	ci::DataTargetRef		mDataTarget;
+	ci::OStreamRef			mStream;
+	uint64_t				mNumFramesWritten;
+	std::vector<char>		mEncodeBuffer;
+	BufferInterleaved		mInterleavedBuffer;
+};
+
+} } // namespace cinder::audio
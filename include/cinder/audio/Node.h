@@ -237,6 +237,7 @@ class CI_API Node : public std::enable_shared_from_this<Node>, private Noncopyab
 	bool					mInitialized;
 	bool					mAutoEnabled;
 	bool					mProcessInPlace;
+	bool					mSummingForParallelProcessing; // set by ParallelGraphProcessor when it switches an in-place subgraph root to summing
 	ChannelMode				mChannelMode;
 	size_t					mNumChannels;
 
@@ -251,6 +252,7 @@ class CI_API Node : public std::enable_shared_from_this<Node>, private Noncopyab
 
 	friend class Context;
 	friend class Param;
+	friend class ParallelGraphProcessor;
 };
 
 //! Enable connection syntax: `input >> output`, which is equivelant to `input->connect( output )`. Enables chaining.  \return the connected \a output
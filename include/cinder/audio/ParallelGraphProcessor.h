@@ -0,0 +1,106 @@
+/*
+ Copyright (c) 2026, The Cinder Project
+
+ This code is intended to be used with the Cinder C++ library, http://libcinder.org
+
+ Redistribution and use in source and binary forms, with or without modification, are permitted provided that
+ the following conditions are met:
+
+    * Redistributions of source code must retain the above copyright notice, this list of conditions and
+	the following disclaimer.
+    * Redistributions in binary form must reproduce the above copyright notice, this list of conditions and
+	the following disclaimer in the documentation and/or other materials provided with the distribution.
+
+ THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED
+ WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A
+ PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR
+ ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+ TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+ NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ POSSIBILITY OF SUCH DAMAGE.
+*/
+
+#pragma once
+
+#include "cinder/audio/Node.h"
+#include "cinder/Noncopyable.h"
+
+#include <atomic>
+#include <condition_variable>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace cinder { namespace audio {
+
+//! \brief Processes independent parts of a Context's Node graph concurrently, on a pool of worker threads.
+//!
+//! partition() searches the graph for Node's that sum more than one input and splits off each input whose upstream Node's
+//! feed nothing else, so that it can be pulled without touching any other part of the graph. These subgraphs are pulled at
+//! the start of each processing block by process(), spread across the worker threads and the audio thread. Every subgraph
+//! root is made to process out-of-place, so that when the Context's OutputNode later pulls the graph as usual, the roots
+//! return their cached results and summing happens on the audio thread in the same order as in single-threaded mode.
+//! Subgraphs that contain other subgraphs are processed in a later stage, after the ones they depend on have finished.
+//!
+//! Each stage's subgraphs are split into one slice per thread, balanced by the number of Node's they contain. A thread
+//! works through its own slice first and then takes work from the other slices until the stage is finished.
+//!
+//! Used internally by Context, see Context::setNumProcessingThreads().
+class CI_API ParallelGraphProcessor : private Noncopyable {
+  public:
+	//! Creates a ParallelGraphProcessor that uses \a numThreads threads, including the audio thread that calls process().
+	ParallelGraphProcessor( size_t numThreads );
+	~ParallelGraphProcessor();
+
+	//! Returns the number of threads used for processing, including the audio thread.
+	size_t	getNumThreads() const		{ return mNumThreads; }
+	//! Returns the number of subgraphs found by the last call to partition().
+	size_t	getNumSubgraphs() const		{ return mSubgraphs.size(); }
+	//! Returns the number of stages found by the last call to partition(). Stages are processed one after another.
+	size_t	getNumStages() const		{ return mStageOffsets.empty() ? 0 : mStageOffsets.size() - 1; }
+
+	//! Rebuilds the subgraphs from the Node's reachable from \a pulledNodes. \note Must be synchronized with the Context's mutex.
+	void	partition( const std::vector<NodeRef> &pulledNodes );
+	//! Removes all subgraphs, releasing the Node's they reference. Roots that partition() switched to out-of-place processing are switched back. \note Must be synchronized with the Context's mutex.
+	void	clear();
+	//! Pulls all subgraphs for the current processing block. Called by the Context on the audio thread, before the graph is pulled.
+	void	process();
+
+	//! Returns the ParallelGraphProcessor that the calling thread is a worker for, or \a nullptr if it isn't a worker thread.
+	static const ParallelGraphProcessor*	getCurrentWorkerProcessor();
+
+  private:
+	struct Subgraph {
+		NodeRef		mRoot;
+		size_t		mNumNodes;
+		size_t		mStage;
+	};
+
+	// Subgraphs of one stage that are assigned to a thread, aligned to avoid false sharing between threads.
+	struct alignas( 64 ) Slice {
+		std::atomic<size_t>	mNext;
+		size_t				mBegin, mEnd;
+	};
+
+	void	workerThreadFn( size_t threadIndex );
+	void	processStages( size_t threadIndex, size_t numStages );
+	void	processSubgraph( const Subgraph &subgraph );
+
+	size_t								mNumThreads;
+	std::vector<std::thread>			mThreads;
+	std::vector<Subgraph>				mSubgraphs;		// sorted by stage
+	std::vector<size_t>					mStageOffsets;	// index into mSubgraphs where each stage begins, plus the end index
+	std::unique_ptr<Slice[]>			mSlices;		// mNumThreads slices per stage
+	std::unique_ptr<std::atomic<size_t>[]>	mStageArrivals;	// number of threads that have finished each stage
+
+	std::atomic<uint64_t>				mGeneration;	// incremented by process() to start a block on the worker threads
+	std::atomic<size_t>					mNumSleeping;
+	std::atomic<bool>					mQuit;
+	bool								mWorkerPriorityMatched;
+	std::mutex							mWakeMutex;
+	std::condition_variable				mWakeCondition;
+};
+
+} } // namespace cinder::audio
@@ -154,7 +154,7 @@ class CI_API Param {
 
 	//! Resets Param, blowing away any Event's or processing Node. \note Must be called from a non-audio thread.
 	void reset();
-	//! Returns the number of Event's that are currently scheduled.
+	//! Returns the number of Event's that are currently scheduled. \note Ramps applied since the last processing block began are not yet counted.
 	size_t getNumEvents() const;
 
 	//! Evaluates the Param for the current processing block, with current time determined from the parent Node's Context.
@@ -175,11 +175,14 @@ class CI_API Param {
 
 	// non-locking protected methods
 	void		initInternalBuffer();
-	void		resetImpl();
+	void		resetImpl( NodeRef *releasedProcessor = nullptr );
 	void		removeEventsAt( double time );
 	ContextRef	getContext() const;
+	// hands event to the audio thread via Context::enqueueCommand()
+	void		enqueueEvent( const EventRef &event, bool replaceExisting );
 
 	std::list<EventRef>	mEvents;
+	EventRef			mLastEvent; // latest Event scheduled from the user thread, accessed with std::atomic_load / atomic_store
 	std::atomic<float>	mValue;
 	bool				mIsVaryingThisBlock;
 	Node*				mParentNode;
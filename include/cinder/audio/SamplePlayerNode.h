@@ -25,6 +25,7 @@
 
 #include "cinder/audio/InputNode.h"
 #include "cinder/audio/Source.h"
+#include "cinder/audio/FileBlockCache.h"
 #include "cinder/audio/dsp/RingBuffer.h"
 
 #include <thread>
@@ -132,17 +133,22 @@ class CI_API FilePlayerNode : public SamplePlayerNode {
 	FilePlayerNode( const Format &format = Format() );
 	//! Constructs a FilePlayerNode that plays \a sourceFile and optionally specifying \a isReadAsync (default = true). Can also provide an optional \a format. \note \a sourceFile's samplerate is forced to match this Node's Context.
 	FilePlayerNode( const SourceFileRef &sourceFile, bool isReadAsync = true, const Format &format = Node::Format() );
+	//! Constructs a FilePlayerNode that streams \a sourceFile through \a blockCache instead of reading it on its own thread. Players of the same file share
+	//! decoded blocks and the cache's I/O threads. If \a blockCache is empty, FileBlockCache::getDefault() is used. Can also provide an optional \a format.
+	FilePlayerNode( const SourceFileRef &sourceFile, const FileBlockCacheRef &blockCache, const Format &format = Node::Format() );
 	virtual ~FilePlayerNode();
 
 	void stop() override;
 	void seek( size_t readPositionFrames ) override;
 
-	//! Returns whether reading occurs asynchronously (default is false). If true, file reading is done from an internal thread, if false it is done directly on the audio thread.
+	//! Returns whether reading occurs asynchronously (default is false). If true, file reading is done from an internal thread, if false it is done directly on the audio thread. Always true when streaming from a FileBlockCache.
 	bool isReadAsync() const	{ return mIsReadAsync; }
 
 	//! \note \a sourceFile's samplerate is forced to match this Node's Context. Resets the loop points to 0:getNumFrames()).
 	void setSourceFile( const SourceFileRef &sourceFile );
 	const SourceFileRef& getSourceFile() const	{ return mSourceFile; }
+	//! Returns the FileBlockCache that this FilePlayerNode streams from, or an empty FileBlockCacheRef if it uses its own read thread.
+	const FileBlockCacheRef& getBlockCache() const	{ return mBlockCache; }
 
 	//! Returns the frame of the last buffer underrun or 0 if none since the last time this method was called.
 	uint64_t getLastUnderrun();
@@ -156,6 +162,8 @@ class CI_API FilePlayerNode : public SamplePlayerNode {
 	void disableProcessing()		override;
 	void process( Buffer *buffer )	override;
 
+	void processCached( Buffer *buffer );
+	size_t readCached( Buffer *buffer, size_t bufferFrameOffset, size_t readPos, size_t numFrames );
 	void readAsyncImpl();
 	void readImpl();
 	void seekImpl( size_t readPos );
@@ -173,6 +181,10 @@ class CI_API FilePlayerNode : public SamplePlayerNode {
 	std::mutex									mAsyncReadMutex;
 	std::condition_variable						mIssueAsyncReadCond;
 	bool										mIsReadAsync, mAsyncReadShouldQuit;
+
+	FileBlockCacheRef							mBlockCache;
+	std::unique_ptr<FileBlockCache::Stream>		mStream;
+	bool										mReadBlocking;	// true when rendering offline, where waiting for blocks is preferable to underruns
 };
 
 } } // namespace cinder::audio
@@ -91,6 +91,8 @@ class CI_API SourceFile : public Source {
 	SourceFileRef clone() const		{ return cloneWithSampleRate( getSampleRate() ); }
 	//! Returns an copy of this Source with all properties identical except the sampleRate. This is useful if the SourceFile must match a samplerate that was unknown when it was first constructed.
 	virtual SourceFileRef cloneWithSampleRate( size_t sampleRate ) const = 0;
+	//! Returns the DataSource that this SourceFile reads from, or an empty DataSourceRef if the implementation doesn't provide it.
+	virtual DataSourceRef getDataSource() const		{ return DataSourceRef(); }
 
 	//! Loads and returns the entire contents of this SourceFile. \return a BufferRef containing the file contents.
 	BufferRef loadBuffer();
@@ -48,6 +48,7 @@ class SourceFileCoreAudio : public SourceFile {
 	virtual ~SourceFileCoreAudio();
 
 	SourceFileRef	cloneWithSampleRate( size_t sampleRate ) const		override;
+	DataSourceRef	getDataSource() const								override	{ return mDataSource; }
 
 	size_t	getNumChannels() const		override	{ return mNumChannels; }
 	size_t	getSampleRateNative() const	override	{ return mSampleRateNative; }
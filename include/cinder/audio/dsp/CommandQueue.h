@@ -0,0 +1,104 @@
+/*
+ Copyright (c) 2026, The Cinder Project
+
+ This code is intended to be used with the Cinder C++ library, http://libcinder.org
+
+ Redistribution and use in source and binary forms, with or without modification, are permitted provided that
+ the following conditions are met:
+
+    * Redistributions of source code must retain the above copyright notice, this list of conditions and
+	the following disclaimer.
+    * Redistributions in binary form must reproduce the above copyright notice, this list of conditions and
+	the following disclaimer in the documentation and/or other materials provided with the distribution.
+
+ THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED
+ WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A
+ PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR
+ ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+ TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+ NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ POSSIBILITY OF SUCH DAMAGE.
+*/
+
+#pragma once
+
+#include "cinder/audio/dsp/RingBuffer.h"
+#include "cinder/Noncopyable.h"
+
+#include <functional>
+
+namespace cinder { namespace audio { namespace dsp {
+
+//! \brief Wait-free single producer / single consumer queue of commands, used to hand work off to the audio thread without locking.
+//!
+//! Commands are heap allocated by the producer and passed by pointer through a RingBufferT. Once executed by the consumer,
+//! they are passed back through a second RingBufferT so that they are destroyed on the producer's thread (the next time
+//! push() or collect() is called), keeping deallocation of anything captured by the command off of the consumer thread.
+//!
+//! \note push() and collect() must only be called from one thread at a time, as must process().
+class CommandQueue : private Noncopyable {
+  public:
+	typedef std::function<void ()>	Command;
+
+	//! Constructs a CommandQueue that can hold up to \a capacity unprocessed commands.
+	CommandQueue( size_t capacity = 4096 )
+		: mPending( capacity ), mCompleted( capacity )
+	{}
+
+	~CommandQueue()
+	{
+		Command *command;
+		while( mPending.read( &command, 1 ) )
+			delete command;
+
+		collect();
+	}
+
+	//! Pushes \a command onto the queue. \return `false` if the queue is full, in which case \a command was not queued. \note Only safe to call from the producer thread.
+	bool push( const Command &command )
+	{
+		collect();
+
+		if( ! mPending.getAvailableWrite() )
+			return false;
+
+		Command *c = new Command( command );
+		mPending.write( &c, 1 );
+		return true;
+	}
+
+	//! Executes all commands queued at the time of calling, in the order they were pushed. \return the number of commands executed. \note Only safe to call from the consumer thread.
+	size_t process()
+	{
+		// Commands pushed while processing are left for the next call, otherwise a busy producer could keep the consumer here indefinitely.
+		const size_t result = mPending.getAvailableRead();
+		for( size_t i = 0; i < result; i++ ) {
+			Command *command;
+			mPending.read( &command, 1 );
+			(*command)();
+
+			// push() collects before every write, so this can only fail if the producer has abandoned the queue
+			if( ! mCompleted.write( &command, 1 ) )
+				delete command;
+		}
+
+		return result;
+	}
+
+	//! Destroys all commands that have already been processed. \note Only safe to call from the producer thread.
+	void collect()
+	{
+		Command *command;
+		while( mCompleted.read( &command, 1 ) )
+			delete command;
+	}
+
+	//! Returns the maximum number of unprocessed commands the queue can hold.
+	size_t getCapacity() const	{ return mPending.getSize(); }
+
+  private:
+	RingBufferT<Command *>	mPending, mCompleted;
+};
+
+} } } // namespace cinder::audio::dsp
@@ -97,6 +97,11 @@ void convert( const int16_t *sourceArray, FloatT *destArray, size_t length )
 		destArray[i] = (FloatT)sourceArray[i] * floatNormalizer;
 }
 
+//! Converts a float array to int16_t, clamping to the int16_t range. Dispatched to the current SimdLevel. \see setSimdLevel()
+CI_API void convert( const float *sourceArray, int16_t *destArray, size_t length );
+//! Converts an int16_t array to float. Dispatched to the current SimdLevel. \see setSimdLevel()
+CI_API void convert( const int16_t *sourceArray, float *destArray, size_t length );
+
 //! Converts between two BufferT's of different precision (ex. float to double).  The number of frames converted is the lesser of the two. The number of channels converted is the lesser of the two.
 template <typename SourceT, typename DestT>
 void convertBuffer( const BufferT<SourceT> *sourceBuffer, BufferT<DestT> *destBuffer )
@@ -205,12 +210,22 @@ void deinterleaveInt24ToFloat( const char *interleavedInt24SourceArray, FloatT *
 		size_t x = ch;
 		FloatT *destChannel = &nonInterleavedFloatDestArray[ch * numFramesPerChannel];
 		for( size_t i = 0; i < numCopyFrames; i++ ) {
-			int32_t sample = (int32_t)( ( (int32_t)interleavedInt24SourceArray[2] ) << 16 ) | ( ( (int32_t)(uint8_t)interleavedInt24SourceArray[1] ) << 8 ) | ( (int32_t)(uint8_t)interleavedInt24SourceArray[0] );
+			const char *source = &interleavedInt24SourceArray[x * 3];
+			int32_t sample = (int32_t)( ( (int32_t)source[2] ) << 16 ) | ( ( (int32_t)(uint8_t)source[1] ) << 8 ) | ( (int32_t)(uint8_t)source[0] );
 			destChannel[i] = (FloatT)sample * floatNormalizer;
 			x += numChannels;
 		}
 	}
 }
+//! Interleaves \a numCopyFrames of the float \a nonInterleavedSourceArray, placing the result in \a interleavedDestArray. Dispatched to the current SimdLevel. \see setSimdLevel()
+CI_API void interleave( const float *nonInterleavedSourceArray, float *interleavedDestArray, size_t numFramesPerChannel, size_t numChannels, size_t numCopyFrames );
+//! De-interleaves \a numCopyFrames of the float \a interleavedSourceArray, placing the result in \a nonInterleavedDestArray. Dispatched to the current SimdLevel. \see setSimdLevel()
+CI_API void deinterleave( const float *interleavedSourceArray, float *nonInterleavedDestArray, size_t numFramesPerChannel, size_t numChannels, size_t numCopyFrames );
+//! Interleaves and converts \a numCopyFrames of the float \a nonInterleavedFloatSourceArray to 16-bit int, clamping to the int16_t range. Dispatched to the current SimdLevel. \see setSimdLevel()
+CI_API void interleave( const float *nonInterleavedFloatSourceArray, int16_t *interleavedInt16DestArray, size_t numFramesPerChannel, size_t numChannels, size_t numCopyFrames );
+//! De-interleaves and converts \a numCopyFrames of the 16-bit int \a interleavedInt16SourceArray to float. Dispatched to the current SimdLevel. \see setSimdLevel()
+CI_API void deinterleave( const int16_t *interleavedInt16SourceArray, float *nonInterleavedFloatDestArray, size_t numFramesPerChannel, size_t numChannels, size_t numCopyFrames );
+
 //! Interleaves \a nonInterleavedSource, placing the result in \a interleavedDest.
 template<typename T>
 void interleaveBuffer( const BufferT<T> *nonInterleavedSource, BufferInterleavedT<T> *interleavedDest )
@@ -0,0 +1,62 @@
+/*
+ Copyright (c) 2026, The Cinder Project
+
+ This code is intended to be used with the Cinder C++ library, http://libcinder.org
+
+ Redistribution and use in source and binary forms, with or without modification, are permitted provided that
+ the following conditions are met:
+
+    * Redistributions of source code must retain the above copyright notice, this list of conditions and
+	the following disclaimer.
+    * Redistributions in binary form must reproduce the above copyright notice, this list of conditions and
+	the following disclaimer in the documentation and/or other materials provided with the distribution.
+
+ THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED
+ WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A
+ PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR
+ ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+ TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+ NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ POSSIBILITY OF SUCH DAMAGE.
+*/
+
+#pragma once
+
+#include "cinder/audio/dsp/Fft.h"
+
+#include <memory>
+#include <vector>
+
+namespace cinder { namespace audio { namespace dsp {
+
+//! \brief Uniformly partitioned FFT convolution with zero latency.
+//!
+//! The impulse response is split into partitions of getBlockSize() samples, whose spectra are computed once at construction.
+//! Input spectra are kept in a frequency-domain delay line, so each completed input block costs one forward FFT and one complex
+//! multiply-accumulate per partition. Output is produced without latency: an incomplete input block is transformed on every call
+//! to process() and only multiplied with the first partition, the older blocks' contribution is summed once per block.
+class CI_API Convolver {
+  public:
+	//! Constructs a Convolver for \a impulseResponseLength samples of \a impulseResponse, partitioned into blocks of \a blockSize samples. \a blockSize must be a power of two.
+	Convolver( size_t blockSize, const float *impulseResponse, size_t impulseResponseLength );
+
+	//! Convolves \a numFrames samples of \a input with the impulse response, writing the result to \a output. \a input and \a output may be the same array. Any \a numFrames is allowed.
+	void	process( const float *input, float *output, size_t numFrames );
+	//! Clears all input history, as if no samples had been processed.
+	void	reset();
+
+	//! Returns the partition size in samples.
+	size_t	getBlockSize() const		{ return mBlockSize; }
+	//! Returns the number of partitions that the impulse response was split into.
+	size_t	getNumPartitions() const	{ return mIrSpectra.size(); }
+
+  private:
+	size_t							mBlockSize, mInputFill, mCurrentSegment;
+	std::unique_ptr<Fft>			mFft;
+	std::vector<BufferSpectral>		mIrSpectra, mInputSpectra;
+	BufferSpectral					mPreMultiplied, mConvolved;
+	Buffer							mFftBuffer, mInputBuffer, mOverlap;
+};
+
+} } } // namespace cinder::audio::dsp
@@ -87,4 +87,22 @@ CI_API void normalize( float *array, size_t length, float maxValue = 1 );
 //! returns the spectral centroid of the frequency magnitude spectrum in \a magArray, computed the provided \a sampleRate. \a magArrayLength is expected to be half of the FFT size used to compute the magnitude spectrum.
 CI_API float spectralCentroid( const float *magArray, size_t magArrayLength, size_t sampleRate );
 
+//! Instruction sets that the vector math routines above and the float / int16 routines in Converter.h can be dispatched to at runtime.
+//! \note When CINDER_AUDIO_VDSP is defined, the vector math routines use the Accelerate framework regardless of the SimdLevel.
+enum class SimdLevel {
+	NONE,	//! portable scalar loops
+	SSE2,
+	AVX2,
+	NEON
+};
+
+//! Returns whether \a level is available in this build and supported by the current CPU.
+CI_API bool			isSimdLevelSupported( SimdLevel level );
+//! Returns the best SimdLevel available, which is the one used by default.
+CI_API SimdLevel	getSupportedSimdLevel();
+//! Returns the SimdLevel currently in use.
+CI_API SimdLevel	getSimdLevel();
+//! Sets the SimdLevel used for subsequent calls, mainly useful for testing and benchmarking. If \a level is not supported, SimdLevel::NONE is used instead.
+CI_API void			setSimdLevel( SimdLevel level );
+
 } } } // namespace cinder::audio::dsp
@@ -0,0 +1,56 @@
+/*
+ Copyright (c) 2026, The Cinder Project
+
+ This code is intended to be used with the Cinder C++ library, http://libcinder.org
+
+ Redistribution and use in source and binary forms, with or without modification, are permitted provided that
+ the following conditions are met:
+
+    * Redistributions of source code must retain the above copyright notice, this list of conditions and
+	the following disclaimer.
+    * Redistributions in binary form must reproduce the above copyright notice, this list of conditions and
+	the following disclaimer in the documentation and/or other materials provided with the distribution.
+
+ THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED
+ WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A
+ PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR
+ ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+ TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+ NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ POSSIBILITY OF SUCH DAMAGE.
+*/
+
+#pragma once
+
+#include "cinder/audio/dsp/Dsp.h"
+
+#include <cstdint>
+
+namespace cinder { namespace audio { namespace dsp { namespace simd {
+
+//! Table of vector kernels for one SimdLevel. The public routines in Dsp.h and Converter.h forward to the table returned by getKernels().
+struct Kernels {
+	void	(*fill)( float value, float *array, size_t length );
+	void	(*addScalar)( const float *array, float scalar, float *result, size_t length );
+	void	(*add)( const float *arrayA, const float *arrayB, float *result, size_t length );
+	void	(*sub)( const float *arrayA, const float *arrayB, float *result, size_t length );
+	void	(*mulScalar)( const float *array, float scalar, float *result, size_t length );
+	void	(*mul)( const float *arrayA, const float *arrayB, float *result, size_t length );
+	void	(*addMul)( const float *arrayA, const float *arrayB, float scalar, float *result, size_t length );
+	float	(*sum)( const float *array, size_t length );
+	float	(*sumSquares)( const float *array, size_t length );
+	float	(*max)( const float *array, size_t length ); // length must be > 0
+
+	void	(*floatToInt16)( const float *sourceArray, int16_t *destArray, size_t length );
+	void	(*int16ToFloat)( const int16_t *sourceArray, float *destArray, size_t length );
+	void	(*interleave)( const float *nonInterleavedSourceArray, float *interleavedDestArray, size_t numFramesPerChannel, size_t numChannels, size_t numCopyFrames );
+	void	(*deinterleave)( const float *interleavedSourceArray, float *nonInterleavedDestArray, size_t numFramesPerChannel, size_t numChannels, size_t numCopyFrames );
+	void	(*interleaveInt16)( const float *nonInterleavedSourceArray, int16_t *interleavedDestArray, size_t numFramesPerChannel, size_t numChannels, size_t numCopyFrames );
+	void	(*deinterleaveInt16)( const int16_t *interleavedSourceArray, float *nonInterleavedDestArray, size_t numFramesPerChannel, size_t numChannels, size_t numCopyFrames );
+};
+
+//! Returns the kernels for the current SimdLevel. \see setSimdLevel()
+const Kernels& getKernels();
+
+} } } } // namespace cinder::audio::dsp::simd
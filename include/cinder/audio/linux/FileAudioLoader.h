@@ -40,6 +40,7 @@ class SourceFileAudioLoader : public SourceFile {
 	virtual ~SourceFileAudioLoader();
 
 	SourceFileRef	cloneWithSampleRate( size_t sampleRate ) const	override;
+	DataSourceRef	getDataSource() const							override	{ return mDataSource; }
 
 	size_t			getNumChannels() const override;
 	size_t			getSampleRateNative() const override;
@@ -44,6 +44,7 @@ class SourceFileMediaFoundation : public SourceFile {
 	virtual ~SourceFileMediaFoundation();
 
 	SourceFileRef	cloneWithSampleRate( size_t sampleRate ) const	override;
+	DataSourceRef	getDataSource() const							override	{ return mDataSource; }
 
 	size_t		getNumChannels() const override			{ return mNumChannels; }
 	size_t		getSampleRateNative() const override	{ return mSampleRate; }
@@ -0,0 +1,145 @@
+/*
+ Copyright (c) 2026, The Cinder Project
+
+ This code is intended to be used with the Cinder C++ library, http://libcinder.org
+
+ Redistribution and use in source and binary forms, with or without modification, are permitted provided that
+ the following conditions are met:
+
+    * Redistributions of source code must retain the above copyright notice, this list of conditions and
+	the following disclaimer.
+    * Redistributions in binary form must reproduce the above copyright notice, this list of conditions and
+	the following disclaimer in the documentation and/or other materials provided with the distribution.
+
+ THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED
+ WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A
+ PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR
+ ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+ TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+ NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ POSSIBILITY OF SUCH DAMAGE.
+*/
+
+#pragma once
+
+#if ! defined( CINDER_GL_ES )
+
+#include "cinder/gl/Pbo.h"
+#include "cinder/gl/Sync.h"
+#include "cinder/gl/Fbo.h"
+#include "cinder/ConcurrentCircularBuffer.h"
+#include "cinder/Surface.h"
+
+#include <atomic>
+#include <deque>
+#include <functional>
+#include <thread>
+#include <vector>
+
+namespace cinder { namespace gl {
+
+template<typename T>
+class AsyncReadbackT;
+typedef AsyncReadbackT<uint8_t>						AsyncReadback8u;
+typedef std::shared_ptr<AsyncReadback8u>			AsyncReadback8uRef;
+typedef AsyncReadbackT<float>						AsyncReadback32f;
+typedef std::shared_ptr<AsyncReadback32f>			AsyncReadback32fRef;
+
+//! Reads pixels from an Fbo or the window without stalling the pipeline. Each read is issued with glReadPixels() into one of a ring of Pbos and fenced with a gl::Sync;
+//! update() retires the reads whose fences have signaled, typically a frame or two later, and delivers them as Surfaces in the order they were issued.
+//! Surfaces are delivered to the callback, to an optional encoder running on worker threads, or else queued for popSurface(). Reads only block when all Pbos are still in flight.
+template<typename T>
+class CI_API AsyncReadbackT {
+  public:
+	//! Called with each completed Surface and the id returned by the read that produced it
+	typedef std::function<void( const SurfaceT<T> &surface, uint64_t id )>	SurfaceFn;
+
+	struct CI_API Format {
+		Format() : mDepth( 3 ), mAlpha( true ), mNumEncoderThreads( 1 ), mMaxQueuedEncodes( 8 ) {}
+
+		//! Sets the number of Pbos in the ring, which is the number of reads that may be in flight before a read blocks. \default 3.
+		Format&		depth( size_t depth ) { mDepth = depth; return *this; }
+		//! Sets whether Surfaces are read with an alpha channel. \default true.
+		Format&		alpha( bool alpha ) { mAlpha = alpha; return *this; }
+		//! Sets a function called on the thread calling update() with each completed Surface. When neither a callback nor an encoder is set, Surfaces are queued for popSurface().
+		Format&		callback( const SurfaceFn &callback ) { mCallback = callback; return *this; }
+		//! Sets a function called on \a numThreads worker threads with each completed Surface, for example to compress and write it to disk. With more than one thread, Surfaces may be encoded out of order.
+		//! At most \a maxQueued Surfaces wait for an encoder; beyond that update() blocks, so that a slow encoder throttles the app instead of exhausting memory.
+		Format&		encoder( const SurfaceFn &encoder, size_t numThreads = 1, size_t maxQueued = 8 ) { mEncoder = encoder; mNumEncoderThreads = numThreads; mMaxQueuedEncodes = maxQueued; return *this; }
+
+		size_t				getDepth() const { return mDepth; }
+		bool				hasAlpha() const { return mAlpha; }
+		const SurfaceFn&	getCallback() const { return mCallback; }
+		const SurfaceFn&	getEncoder() const { return mEncoder; }
+		size_t				getNumEncoderThreads() const { return mNumEncoderThreads; }
+		size_t				getMaxQueuedEncodes() const { return mMaxQueuedEncodes; }
+
+	  protected:
+		size_t		mDepth;
+		bool		mAlpha;
+		SurfaceFn	mCallback, mEncoder;
+		size_t		mNumEncoderThreads, mMaxQueuedEncodes;
+	};
+
+	static std::shared_ptr<AsyncReadbackT>	create( const Format &format = Format() );
+	//! Delivers every pending read and waits for the encoders to finish before returning
+	~AsyncReadbackT();
+
+	//! Starts reading \a attachment of \a fbo within \a area (cropped to the bounds of the attachment, upper-left origin). Returns an id that is passed along with the resulting Surface.
+	uint64_t	read( const FboRef &fbo, const Area &area, GLenum attachment = GL_COLOR_ATTACHMENT0 );
+	//! Starts reading all of \a fbo's \c GL_COLOR_ATTACHMENT0. Returns an id that is passed along with the resulting Surface.
+	uint64_t	read( const FboRef &fbo ) { return read( fbo, fbo->getBounds() ); }
+	//! Starts reading \a area (upper-left origin, in pixels) of the default framebuffer, whose height is \a windowHeightPixels. Analogous to app::copyWindowSurface(). Returns an id that is passed along with the resulting Surface.
+	uint64_t	readWindow( const Area &area, int32_t windowHeightPixels );
+
+	//! Delivers the reads that have completed, oldest first. Call once per frame. Returns the number of Surfaces delivered.
+	size_t		update();
+	//! Waits for every pending read and delivers it. If \a waitForEncoders also waits for the encoders to finish the Surfaces queued for them.
+	void		flush( bool waitForEncoders = true );
+
+	//! Pops the oldest Surface that wasn't consumed by a callback or an encoder into \a surface and its id into \a id. Returns false if there is none.
+	bool		popSurface( SurfaceT<T> *surface, uint64_t *id = nullptr );
+	//! Returns the number of reads issued but not yet delivered
+	size_t		getNumPending() const { return mNumPending; }
+	//! Returns the number of delivered Surfaces waiting in popSurface()'s queue
+	size_t		getNumQueued() const { return mQueue.size(); }
+	//! Returns the number of times a read had to wait for the oldest Pbo because all of them were in flight
+	size_t		getNumStalls() const { return mNumStalls; }
+
+	const Format&	getFormat() const { return mFormat; }
+
+  protected:
+	AsyncReadbackT( const Format &format );
+
+	struct Slot {
+		PboRef		mPbo;
+		SyncRef		mFence;
+		ivec2		mSize;
+		uint64_t	mId;
+	};
+
+	//! Issues a read of \a readArea (lower-left origin) from the currently bound read framebuffer
+	uint64_t	readImpl( const Area &readArea );
+	//! Maps the oldest pending slot, waiting for its fence if \a wait, and delivers its Surface. Returns false if it isn't ready.
+	bool		retireOldest( bool wait );
+	void		deliver( const SurfaceT<T> &surface, uint64_t id );
+	void		encoderThreadFn();
+
+	Format								mFormat;
+	std::vector<Slot>					mSlots;
+	size_t								mOldest, mNumPending, mNumStalls;
+	uint64_t							mNextId;
+	std::deque<std::pair<SurfaceT<T>, uint64_t>>	mQueue;
+
+	std::unique_ptr<ConcurrentCircularBuffer<std::pair<SurfaceT<T>, uint64_t>>>	mEncodeQueue;
+	std::vector<std::thread>			mEncoderThreads;
+	std::atomic<size_t>					mNumEncodesOutstanding;
+	std::mutex							mEncodeMutex;
+	std::condition_variable				mEncodeDoneCond;
+	std::atomic<bool>					mEncodersQuit;
+};
+
+} } // namespace cinder::gl
+
+#endif // ! defined( CINDER_GL_ES )
@@ -28,7 +28,9 @@
 #include "cinder/Matrix44.h"
 #include "cinder/Vector.h"
 #include "cinder/gl/Shader.h"
+#include "cinder/gl/StateStack.h"
 
+#include <array>
 #include <vector>
 #include <map>
 
@@ -52,10 +54,34 @@ class Fbo;
 typedef std::shared_ptr<Fbo>			FboRef;
 class VertBatch;
 typedef std::shared_ptr<VertBatch>		VertBatchRef;
+class StreamingBuffer;
+typedef std::shared_ptr<StreamingBuffer>	StreamingBufferRef;
 class Renderbuffer;
 
 class TextureBase;
 
+//! Counts of the state changes made through a Context, split into those that reached OpenGL and those elided because the cached state already matched. \sa Context::getStateCounters()
+struct CI_API StateCounters {
+	enum Category { BUFFER, RENDERBUFFER, FRAMEBUFFER, VAO, GLSL_PROG, TEXTURE, SAMPLER, CAPABILITY, BLEND, DEPTH, VIEWPORT, RASTER, NUM_CATEGORIES };
+
+	StateCounters()		{ clear(); }
+
+	//! Returns the number of GL calls issued for \a category
+	uint32_t	getNumIssued( Category category ) const		{ return mIssued[category]; }
+	//! Returns the number of GL calls elided for \a category
+	uint32_t	getNumElided( Category category ) const		{ return mElided[category]; }
+	//! Returns the number of GL calls issued across all categories
+	uint32_t	getNumIssued() const;
+	//! Returns the number of GL calls elided across all categories
+	uint32_t	getNumElided() const;
+	void		clear()		{ mIssued.fill( 0 ); mElided.fill( 0 ); }
+
+	//! Returns a human-readable name for \a category, such as \c "texture"
+	static const char*	getCategoryName( Category category );
+
+	std::array<uint32_t,NUM_CATEGORIES>		mIssued, mElided;
+};
+
 class CI_API Context {
   public:
 	struct CI_API PlatformData {
@@ -482,6 +508,17 @@ class CI_API Context {
 	//! Returns a reference to the immediate mode emulation structure. Generally use gl::begin() and friends instead.
 	VertBatch&		immediate() { return *mImmediateMode; }
 
+	//! Enables batching of gl::drawLine(), drawSolidRect(), drawCube(), draw( PolyLine2 ), draw( Path2d ) and draw( std::vector<vec3> ), streamed through a persistently mapped StreamingBuffer. Consecutive draws sharing a GlslProg and view and projection matrices become a single draw call. State changes made through the Context issue the pending batch first; raw OpenGL calls require flushStreamingDraw(). Disabled by default.
+	void			enableStreamingDraw( bool enable = true );
+	//! Returns whether immediate draws are batched. \sa enableStreamingDraw()
+	bool			isStreamingDrawEnabled() const { return mStreamingDrawEnabled; }
+	//! Issues any pending batched draws. Called automatically before state changes made through the Context and at the end of each frame.
+	void			flushStreamingDraw() { if( ! mStreamingDrawVertices.empty() ) flushStreamingDrawImpl(); }
+	//! Returns the GlslProg used by the pending batch, or \c nullptr if nothing is pending
+	const GlslProg*	getStreamingDrawGlslProg() const { return mStreamingDrawGlslProg; }
+	//! Appends \a numVertices vertices of \a mode primitives, which must be \c GL_LINES or \c GL_TRIANGLES, to the streaming batch for the current GlslProg. Positions and normals are transformed by the current model matrix and vertices without \a colors use the current color.
+	void			streamingDraw( GLenum mode, const vec3 *positions, size_t numVertices, const vec3 *normals = nullptr, const vec2 *texCoords = nullptr, const ColorAf *colors = nullptr );
+
 #if defined( CINDER_GL_HAS_DEBUG_OUTPUT )
   #if defined( CINDER_MSW )
 	static void __stdcall 	debugMessageCallback( GLenum source, GLenum type, GLuint id, GLenum severity, GLsizei length, const GLchar *message, void *userParam );
@@ -490,68 +527,76 @@ class CI_API Context {
 #endif
 #endif
 
+	//! Returns the state changes made so far in the current frame
+	const StateCounters&	getStateCounters() const { return mStateCounters; }
+	//! Returns the state changes made during the last complete frame. \sa endStateCountersFrame()
+	const StateCounters&	getLastFrameStateCounters() const { return mLastFrameStateCounters; }
+	//! Moves the current frame's counters to getLastFrameStateCounters() and resets them. Called automatically by RendererGl at the end of each frame.
+	void					endStateCountersFrame() { mLastFrameStateCounters = mStateCounters; mStateCounters.clear(); }
+	//! Records that a state change of \a category was either \a issued to OpenGL or elided, and returns \a issued
+	bool					countStateChange( StateCounters::Category category, bool issued ) { ++( issued ? mStateCounters.mIssued : mStateCounters.mElided )[category]; return issued; }
+
   protected:
 	//! Returns \c true if \a value is different from the previous top of the stack
-	template<typename T>
-	bool		pushStackState( std::vector<T> &stack, T value );
+	template<typename T, size_t N>
+	bool		pushStackState( StateStack<T,N> &stack, T value );
 	//! Returns \c true if the new top of \a stack is different from the previous top, or the stack is empty
-	template<typename T>
-	bool		popStackState( std::vector<T> &stack );
+	template<typename T, size_t N>
+	bool		popStackState( StateStack<T,N> &stack );
 	//! Returns \c true if \a value is different from the previous top of the stack
-	template<typename T>
-	bool		setStackState( std::vector<T> &stack, T value );
+	template<typename T, size_t N>
+	bool		setStackState( StateStack<T,N> &stack, T value );
 	//! Returns \c true if \a result is valid; will return \c false when \a stack was empty
-	template<typename T>
-	bool		getStackState( std::vector<T> &stack, T *result );
+	template<typename T, size_t N>
+	bool		getStackState( StateStack<T,N> &stack, T *result );
+	//! Returns the binding stack for \a target on \a textureUnit, growing the per-unit stacks as needed
+	StateStack<GLint>&	getTextureBindingStack( GLenum target, uint8_t textureUnit );
 
 	void allocateDefaultVboAndVao();
 
 	std::map<ShaderDef,GlslProgRef>		mStockShaders;
 	
-	std::map<GLenum,std::vector<int>>	mBufferBindingStack;
-	std::map<GLenum,std::vector<int>>	mRenderbufferBindingStack;
-	std::vector<const GlslProg*>		mGlslProgStack;
-	std::vector<Vao*>					mVaoStack;
+	KeyedStateStacks<int,NUM_BUFFER_TARGETS,bufferTargetIndex>	mBufferBindingStack;
+	StateStack<int>						mRenderbufferBindingStack;
+	StateStack<const GlslProg*>			mGlslProgStack;
+	StateStack<Vao*>					mVaoStack;
 	
 #if defined( CINDER_GL_HAS_TRANSFORM_FEEDBACK )
 	TransformFeedbackObjRef				mCachedTransformFeedbackObj;
 #endif // defined( CINDER_GL_HAS_TRANSFORM_FEEDBACK )
 	
 	// Blend state stacks
-	std::vector<GLint>					mBlendSrcRgbStack, mBlendDstRgbStack;
-	std::vector<GLint>					mBlendSrcAlphaStack, mBlendDstAlphaStack;
-
-// #if defined( CINDER_GL_ES_2 ) && (! defined( CINDER_COCOA_TOUCH )) && (! defined( CINDER_GL_ANGLE ))
-// 	std::vector<GLint>			mFramebufferStack;
-// #else
-// 	std::vector<GLint>			mReadFramebufferStack, mDrawFramebufferStack;
-// #endif
+	StateStack<GLint>					mBlendSrcRgbStack, mBlendDstRgbStack;
+	StateStack<GLint>					mBlendSrcAlphaStack, mBlendDstAlphaStack;
+
 #if defined( CINDER_GL_HAS_FBO_MULTISAMPLING )
-	std::vector<GLint>			mReadFramebufferStack, mDrawFramebufferStack;
+	StateStack<GLint>			mReadFramebufferStack, mDrawFramebufferStack;
 #else
-	std::vector<GLint>			mFramebufferStack;
+	StateStack<GLint>			mFramebufferStack;
 #endif
 
-	std::vector<GLenum>			mCullFaceStack;
-	std::vector<GLenum>			mFrontFaceStack;
+	StateStack<GLenum>			mCullFaceStack;
+	StateStack<GLenum>			mFrontFaceStack;
 
 #if ! defined( CINDER_GL_ES )
-	std::vector<GLenum>			mLogicOpStack;
-	std::vector<GLenum>			mPolygonModeStack;
+	StateStack<GLenum>			mLogicOpStack;
+	StateStack<GLenum>			mPolygonModeStack;
 #endif
 
-	std::vector<GLboolean>		mDepthMaskStack;
-	std::vector<GLenum>			mDepthFuncStack;
+	StateStack<GLboolean>		mDepthMaskStack;
+	StateStack<GLenum>			mDepthFuncStack;
 	
-	std::map<GLenum,std::vector<GLboolean>>	mBoolStateStack;
-	// map<TextureUnit,map<TextureTarget,vector<Binding ID Stack>>>
-	std::map<uint8_t,std::map<GLenum,std::vector<GLint>>>	mTextureBindingStack;
-	std::vector<uint8_t>					mActiveTextureStack;
+	KeyedStateStacks<GLboolean,NUM_CAPABILITIES,capabilityIndex>	mBoolStateStack;
+	// indexed by texture unit; a deque so that growing it leaves references to existing units valid
+	std::deque<KeyedStateStacks<GLint,NUM_TEXTURE_TARGETS,textureTargetIndex>>	mTextureBindingStack;
+	StateStack<uint8_t>					mActiveTextureStack;
 	
 #if defined( CINDER_GL_HAS_SAMPLERS )
-	std::vector<std::vector<GLuint>>	mSamplerBindingStack;
+	std::deque<StateStack<GLuint>>		mSamplerBindingStack;
 #endif	
 	
+	StateCounters				mStateCounters, mLastFrameStateCounters;
+
 	VaoRef						mDefaultVao;
 	VboRef						mDefaultArrayVbo[4], mDefaultElementVbo;
 	uint8_t						mDefaultArrayVboIdx;
@@ -563,11 +608,20 @@ class CI_API Context {
 	Context( const std::shared_ptr<PlatformData> &platformData );
 
 	void	allocateDrawTextureVboAndVao();
+	void	flushStreamingDrawImpl();
+
+	//! Batched vertices are pre-transformed by the model matrix so that draws with different model matrices can share a batch
+	struct StreamingDrawVertex {
+		vec4		position;
+		vec3		normal;
+		vec2		texCoord;
+		ColorAf		color;
+	};
 
 	std::shared_ptr<PlatformData>	mPlatformData;
 	
-	std::vector<std::pair<ivec2,ivec2>>		mViewportStack;
-	std::vector<std::pair<ivec2,ivec2>>		mScissorStack;
+	StateStack<std::pair<ivec2,ivec2>>		mViewportStack;
+	StateStack<std::pair<ivec2,ivec2>>		mScissorStack;
 
 	VaoRef						mImmVao; // Immediate-mode VAO
 	VboRef						mImmVbo; // Immediate-mode VBO
@@ -576,7 +630,18 @@ class CI_API Context {
 	std::vector<mat4>		mModelMatrixStack;
 	std::vector<mat4>		mViewMatrixStack;	
 	std::vector<mat4>		mProjectionMatrixStack;
-	std::vector<float>		mLineWidthStack;
+	StateStack<float>		mLineWidthStack;
+
+	// Streaming draw
+	bool								mStreamingDrawEnabled;
+	StreamingBufferRef					mStreamingDrawBuffer;
+	VaoRef								mStreamingDrawVao;
+	std::array<int,4>					mStreamingDrawVaoLocations; // position, normal, texCoord and color locations the VAO is set up for
+	GLuint								mStreamingDrawVaoBufferId;
+	std::vector<StreamingDrawVertex>	mStreamingDrawVertices;
+	const GlslProg*						mStreamingDrawGlslProg;
+	GLenum								mStreamingDrawMode;
+	mat4								mStreamingDrawViewMatrix, mStreamingDrawProjectionMatrix;
 
 	// Debug
 	GLenum						mDebugLogSeverity;
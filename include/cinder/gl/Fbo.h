@@ -171,9 +171,9 @@ class CI_API Fbo : public std::enable_shared_from_this<Fbo> {
 	//! Sets the debugging label associated with the Fbo. Calls glObjectLabel() when available.
 	void				setLabel( const std::string &label );
 	
-	//! Returns a copy of the pixels in \a attachment within \a area (cropped to the bounding rectangle of the attachment) as a Surface8u. \a attachment ignored on ES 2.
+	//! Returns a copy of the pixels in \a attachment within \a area (cropped to the bounding rectangle of the attachment) as a Surface8u. \a attachment ignored on ES 2. Stalls until the GPU has finished rendering; see gl::AsyncReadback8u for reading every frame.
 	Surface8u		readPixels8u( const Area &area, GLenum attachment = GL_COLOR_ATTACHMENT0 ) const;
-	//! Returns a copy of the pixels in \a attachment within \a area (cropped to the bounding rectangle of the attachment) as a Surface32f. \a attachment ignored on ES 2.
+	//! Returns a copy of the pixels in \a attachment within \a area (cropped to the bounding rectangle of the attachment) as a Surface32f. \a attachment ignored on ES 2. Stalls until the GPU has finished rendering; see gl::AsyncReadback32f for reading every frame.
 	Surface32f		readPixels32f( const Area &area, GLenum attachment = GL_COLOR_ATTACHMENT0 ) const;
 	
 	//! \brief Defines the Format of the Fbo, which is passed in via create().
@@ -303,6 +303,7 @@ class CI_API Fbo : public std::enable_shared_from_this<Fbo> {
 	mutable bool		mNeedsResolve, mNeedsMipmapUpdate;
 	
 	friend CI_API std::ostream& operator<<( std::ostream &os, const Fbo &rhs );
+	template<typename T> friend class AsyncReadbackT;
 };
 
 CI_API std::ostream& operator<<( std::ostream &os, const Fbo &rhs );
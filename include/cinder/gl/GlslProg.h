@@ -48,7 +48,9 @@ namespace cinder { namespace gl {
 	
 typedef std::shared_ptr<class GlslProg> GlslProgRef;
 
+class Context;
 class UniformValueCache;
+class UniformNameIndex;
 class ShaderPreprocessor;
 
 class CI_API GlslProg {
@@ -438,6 +440,50 @@ class CI_API GlslProg {
 	//! Returns a const pointer to the Uniform that matches \a name. Returns nullptr if the uniform doesn't exist. The uniform location (accounting for indices, like "example[2]") is stored in \a resultLocation if it's non-null.
 	const Uniform*					findUniform( const std::string &name, int *resultLocation ) const;
 
+	//! A Uniform resolved once by getUniformHandle(), which sets values without any name lookup or type check. Values still pass through the uniform value cache. Only valid for the GlslProg that created it, and only while that GlslProg is alive.
+	template<typename T>
+	class UniformHandle {
+	  public:
+		typedef T	value_type;
+
+		UniformHandle() : mGlslProg( nullptr ), mUniform( nullptr ), mLocation( -1 ) {}
+
+		//! Returns whether the handle refers to an active Uniform.
+		bool				isValid() const { return mUniform != nullptr; }
+		explicit operator	bool() const { return isValid(); }
+		//! Returns the location the handle sets, accounting for indices like "example[2]". Returns -1 for an invalid handle.
+		GLint				getLocation() const { return mLocation; }
+		//! Returns the active Uniform the handle refers to, or nullptr for an invalid handle.
+		const Uniform*		getUniform() const { return mUniform; }
+
+	  private:
+		UniformHandle( const GlslProg *glslProg, const Uniform *uniform, GLint location )
+			: mGlslProg( glslProg ), mUniform( uniform ), mLocation( location )
+		{}
+
+		const GlslProg	*mGlslProg;
+		const Uniform	*mUniform;
+		GLint			mLocation;
+
+		friend class GlslProg;
+	};
+
+	//! Resolves the Uniform that matches \a name and checks its type against \a T once, returning a handle for setting it later. Returns an invalid handle and logs an error if the uniform doesn't exist or its type doesn't match.
+	template<typename T>
+	UniformHandle<T>	getUniformHandle( const std::string &name ) const;
+	//! Sets the uniform referred to by \a handle. Does nothing for an invalid handle.
+	template<typename T>
+	void	uniform( const UniformHandle<T> &handle, const typename UniformHandle<T>::value_type &data ) const;
+	//! Sets \a count elements of the array uniform referred to by \a handle, starting at the handle's index. Does nothing for an invalid handle.
+	template<typename T>
+	void	uniform( const UniformHandle<T> &handle, const typename UniformHandle<T>::value_type *data, int count ) const;
+	void	uniform( const UniformHandle<mat2> &handle, const mat2 &data, bool transpose = false ) const;
+	void	uniform( const UniformHandle<mat3> &handle, const mat3 &data, bool transpose = false ) const;
+	void	uniform( const UniformHandle<mat4> &handle, const mat4 &data, bool transpose = false ) const;
+	void	uniform( const UniformHandle<mat2> &handle, const mat2 *data, int count, bool transpose = false ) const;
+	void	uniform( const UniformHandle<mat3> &handle, const mat3 *data, int count, bool transpose = false ) const;
+	void	uniform( const UniformHandle<mat4> &handle, const mat4 *data, int count, bool transpose = false ) const;
+
 #if defined( CINDER_GL_HAS_UNIFORM_BLOCKS )
 	//! Analogous to glUniformBlockBinding()
 	void	uniformBlock( const std::string &name, GLint binding ) const;
@@ -472,7 +518,10 @@ class CI_API GlslProg {
 	GlslProg( const Format &format );
 
 	void			bindImpl() const;
-	GLuint			loadShader( const std::string &shaderSource, const fs::path &shaderPath, GLint shaderType, const ShaderPreprocessorRef &preprocessor );
+	//! Returns \a shaderSource expanded by \a preprocessor, or unchanged if \a preprocessor is null.
+	std::string		preprocessShader( const std::string &shaderSource, const fs::path &shaderPath, const ShaderPreprocessorRef &preprocessor );
+	//! Compiles \a preprocessedSource and attaches it to the program. \a shaderSource is only used for error messages.
+	GLuint			loadShader( const std::string &preprocessedSource, const std::string &shaderSource, GLint shaderType );
 	void			link();
 	
 	//! Caches all active Attributes after linking.
@@ -550,6 +599,9 @@ class CI_API GlslProg {
 	std::vector<Attribute>						mAttributes;
 	std::vector<Uniform>						mUniforms;
 	mutable std::unique_ptr<UniformValueCache>	mUniformValueCache;
+	std::unique_ptr<UniformNameIndex>			mUniformNameIndex;
+	// set by the Context while a streaming draw batch using this GlslProg is pending, so that uniform updates can issue it first
+	mutable Context*							mStreamingDrawContext;
 #if defined( CINDER_GL_HAS_UNIFORM_BLOCKS )
 	std::vector<UniformBlock>				mUniformBlocks;
 #endif
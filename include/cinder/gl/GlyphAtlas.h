@@ -0,0 +1,204 @@
+/*
+ Copyright (c) 2026, The Cinder Project
+
+ This code is intended to be used with the Cinder C++ library, http://libcinder.org
+
+ Redistribution and use in source and binary forms, with or without modification, are permitted provided that
+ the following conditions are met:
+
+    * Redistributions of source code must retain the above copyright notice, this list of conditions and
+	the following disclaimer.
+    * Redistributions in binary form must reproduce the above copyright notice, this list of conditions and
+	the following disclaimer in the documentation and/or other materials provided with the distribution.
+
+ THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED
+ WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A
+ PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR
+ ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+ TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+ NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ POSSIBILITY OF SUCH DAMAGE.
+*/
+
+#pragma once
+
+#include "cinder/gl/platform.h"
+
+#if ( defined( CINDER_ANDROID ) || defined( CINDER_LINUX ) ) && defined( CINDER_GL_HAS_DRAW_INSTANCED )
+
+#include "cinder/gl/GlslProg.h"
+#include "cinder/gl/Texture.h"
+#include "cinder/gl/Vao.h"
+#include "cinder/gl/Vbo.h"
+#include "cinder/Font.h"
+#include "cinder/Area.h"
+
+#include <string>
+#include <unordered_map>
+#include <unordered_set>
+#include <utility>
+#include <vector>
+
+namespace cinder { namespace gl {
+
+typedef std::shared_ptr<class GlyphAtlas>	GlyphAtlasRef;
+typedef std::shared_ptr<class TextRun>		TextRunRef;
+
+/** A set of single-channel textures ("pages") that glyphs of a Font are rasterized into with FreeType the first time they're needed,
+	rather than up front as TextureFont does. When every page is full, the least recently used page is cleared and reused.
+	Coverage is stored in the red channel of each page. **/
+class CI_API GlyphAtlas {
+  public:
+	struct CI_API Format {
+		Format() : mPageWidth( 1024 ), mPageHeight( 1024 ), mMaxPages( 4 ), mPadding( 1 ) {}
+
+		//! Sets the size of each page in pixels. The width is rounded up to a multiple of 4. Default \c 1024 x \c 1024
+		Format&		pageSize( int32_t width, int32_t height ) { mPageWidth = width; mPageHeight = height; return *this; }
+		//! Sets the maximum number of pages, after which the least recently used page is evicted to make room. Default \c 4
+		Format&		maxPages( size_t maxPages ) { mMaxPages = maxPages; return *this; }
+		//! Sets the number of empty pixels kept around each glyph to prevent bleeding under linear filtering. Default \c 1
+		Format&		padding( int32_t padding ) { mPadding = padding; return *this; }
+
+		int32_t		getPageWidth() const { return mPageWidth; }
+		int32_t		getPageHeight() const { return mPageHeight; }
+		size_t		getMaxPages() const { return mMaxPages; }
+		int32_t		getPadding() const { return mPadding; }
+
+	  protected:
+		int32_t		mPageWidth, mPageHeight;
+		size_t		mMaxPages;
+		int32_t		mPadding;
+	};
+
+	//! Where a rasterized glyph lives in the atlas
+	struct Entry {
+		//! Index of the page texture, see getTexture()
+		uint32_t	mPage;
+		//! Pixel bounds of the glyph within its page. Empty for glyphs without any coverage, such as spaces.
+		Area		mArea;
+		//! Offset from the glyph's pen position on the baseline to the upper-left of mArea, in pixels
+		ivec2		mOffset;
+	};
+
+	static GlyphAtlasRef	create( const Font &font, const Format &format = Format() );
+
+	/** Returns the Entry for \a glyph, rasterizing it first if it isn't resident. Returns nullptr if the glyph is larger than a page or
+		can't be rasterized, which is remembered so later calls fail without retrying, or if every page is full and has been used since the
+		last call to beginBatch(). The Entry is valid until the next eviction. **/
+	const Entry*	acquire( Font::Glyph glyph );
+	//! Marks the start of a set of acquire() calls whose results must stay resident together. Pages used since the last call to beginBatch() are never evicted.
+	void			beginBatch() { mBatchStart = mClock; }
+	//! Marks \a page as used now, keeping it from being evicted in favor of less recently used pages
+	void			touch( uint32_t page ) { mPages[page].mLastUsed = ++mClock; }
+	//! Uploads any glyphs rasterized since the last call to the page textures, creating the textures of new pages. Called automatically by TextRun::draw().
+	void			upload();
+
+	//! Returns the texture of page \a page, which is created by the first upload() after the page is
+	const Texture2dRef&	getTexture( uint32_t page ) const { return mPages[page].mTexture; }
+	//! Returns the number of pages allocated so far
+	size_t				getNumPages() const { return mPages.size(); }
+	//! Returns the number of glyphs currently resident
+	size_t				getNumGlyphs() const { return mEntries.size(); }
+	//! Returns the number of glyphs that are larger than a page or couldn't be rasterized
+	size_t				getNumFailedGlyphs() const { return mFailedGlyphs.size(); }
+	//! Returns the number of pages evicted since the GlyphAtlas was created. Anything holding Entries should reacquire them when this changes.
+	uint64_t			getNumEvictions() const { return mNumEvictions; }
+
+	const Font&			getFont() const { return mFont; }
+	const Format&		getFormat() const { return mFormat; }
+
+	/** Returns the shader TextRuns drawing from this atlas use by default. Custom shaders receive per-glyph instanced attributes \c ciGlyphRect (x, y, width, height in pixels),
+		\c ciGlyphTexCoords (upper-left and lower-right) and \c ciGlyphColor, and build each quad's corners from \c gl_VertexID, which ranges over \c 0 - \c 3 as a triangle strip. **/
+	const GlslProgRef&	getDefaultGlslProg();
+
+  protected:
+	GlyphAtlas( const Font &font, const Format &format );
+
+	struct Shelf {
+		int32_t		mY, mHeight, mX;
+	};
+
+	struct Page {
+		Texture2dRef				mTexture;
+		std::vector<uint8_t>		mPixels;
+		std::vector<Shelf>			mShelves;
+		std::vector<Font::Glyph>	mGlyphs;
+		int32_t						mNextShelfY;
+		int32_t						mDirtyBegin, mDirtyEnd; // rows
+		uint64_t					mLastUsed;
+	};
+
+	//! Returns whether a \a width x \a height glyph fits in a page, including its padding
+	bool		fitsInPage( int32_t width, int32_t height ) const;
+	//! Returns the page and position for a \a width x \a height glyph, allocating or evicting a page if needed. Returns false if there's no room.
+	bool		allocate( int32_t width, int32_t height, uint32_t *page, ivec2 *position );
+	//! Finds room for a \a width x \a height rectangle in \a page on its shelves
+	bool		allocateInPage( Page &page, int32_t width, int32_t height, ivec2 *position );
+	void		addPage();
+	void		evictPage( uint32_t page );
+
+	Font										mFont;
+	Format										mFormat;
+	std::vector<Page>							mPages;
+	std::unordered_map<Font::Glyph, Entry>		mEntries;
+	std::unordered_set<Font::Glyph>				mFailedGlyphs;
+	uint64_t									mClock, mBatchStart, mNumEvictions;
+	GlslProgRef									mDefaultGlsl;
+};
+
+/** A retained run of glyphs drawn from a GlyphAtlas. The glyphs' placement, texture coordinates and colors are uploaded once,
+	and the run is redrawn with one instanced draw call per atlas page it uses, which is a single call unless the atlas has spilled onto several pages.
+	The run rebuilds itself automatically when the atlas evicts a page. **/
+class CI_API TextRun {
+  public:
+	//! Creates an empty TextRun drawing from \a atlas
+	static TextRunRef	create( const GlyphAtlasRef &atlas );
+	//! Creates a TextRun containing \a str laid out on a single baseline in \a color
+	static TextRunRef	create( const GlyphAtlasRef &atlas, const std::string &str, const ColorA8u &color = ColorA8u( 255, 255, 255, 255 ) );
+
+	//! Appends the glyphs in \a glyphPlacements, which are pairs of glyphs and pen positions as returned by TextureFont::getGlyphPlacements() or TextBox::measureGlyphs(), offset by \a offset
+	void	append( const std::vector<std::pair<Font::Glyph,vec2>> &glyphPlacements, const vec2 &offset = vec2(), const ColorA8u &color = ColorA8u( 255, 255, 255, 255 ) );
+	//! Appends \a str laid out on a single baseline, offset by \a offset
+	void	append( const std::string &str, const vec2 &offset = vec2(), const ColorA8u &color = ColorA8u( 255, 255, 255, 255 ) );
+	//! Removes all glyphs
+	void	clear();
+
+	//! Draws the run with its first baseline at \a baseline, multiplied by the current color. Uses the atlas's getDefaultGlslProg() unless \a glsl is supplied.
+	void	draw( const vec2 &baseline = vec2(), const GlslProgRef &glsl = nullptr );
+
+	//! Returns the number of glyphs in the run, including blank ones such as spaces
+	size_t					getNumGlyphs() const { return mGlyphs.size(); }
+	const GlyphAtlasRef&	getAtlas() const { return mAtlas; }
+
+  protected:
+	TextRun( const GlyphAtlasRef &atlas );
+
+	struct Glyph {
+		Font::Glyph		mGlyph;
+		vec2			mPosition;
+		ColorA8u		mColor;
+	};
+
+	struct Instance {
+		vec4		mRect;
+		vec4		mTexCoords;
+		ColorA8u	mColor;
+	};
+
+	//! Reacquires every glyph from the atlas and uploads the instances, sorted by page
+	void	build();
+
+	GlyphAtlasRef								mAtlas;
+	std::vector<Glyph>							mGlyphs;
+	std::vector<std::pair<uint32_t,uint32_t>>	mPageRanges; // page, number of instances
+	VboRef										mInstanceVbo;
+	VaoRef										mVao;
+	GlslProgRef									mVaoGlsl;
+	bool										mDirty;
+	uint64_t									mBuiltEvictions;
+};
+
+} } // namespace cinder::gl
+
+#endif // ( defined( CINDER_ANDROID ) || defined( CINDER_LINUX ) ) && defined( CINDER_GL_HAS_DRAW_INSTANCED )
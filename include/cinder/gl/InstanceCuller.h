@@ -0,0 +1,174 @@
+/*
+ Copyright (c) 2026, The Cinder Project
+
+ This code is intended to be used with the Cinder C++ library, http://libcinder.org
+
+ Redistribution and use in source and binary forms, with or without modification, are permitted provided that
+ the following conditions are met:
+
+    * Redistributions of source code must retain the above copyright notice, this list of conditions and
+	the following disclaimer.
+    * Redistributions in binary form must reproduce the above copyright notice, this list of conditions and
+	the following disclaimer in the documentation and/or other materials provided with the distribution.
+
+ THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED
+ WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A
+ PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR
+ ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+ TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+ NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ POSSIBILITY OF SUCH DAMAGE.
+*/
+
+#pragma once
+
+#include "cinder/gl/platform.h"
+
+#if defined( CINDER_GL_HAS_MULTI_DRAW_INDIRECT )
+
+#include "cinder/gl/GlslProg.h"
+#include "cinder/gl/Vbo.h"
+#include "cinder/Camera.h"
+#include "cinder/Frustum.h"
+
+#include <limits>
+#include <vector>
+
+namespace cinder { namespace gl {
+
+typedef std::shared_ptr<class InstanceCuller>	InstanceCullerRef;
+
+/** Culls large numbers of instances against a Frustum on the GPU, compacting the ids of the visible ones into a buffer and writing one indirect draw command per level of detail.
+	Each instance is a world space bounding box plus an id. Instances outside the frustum are dropped; the rest are assigned the first LOD whose maximum distance from the eye exceeds
+	the distance to the box's center, and those beyond the last LOD are dropped too. The vertex shader receives the id of each drawn instance through an instanced \c uint attribute
+	fed from getVisibleIdsVbo(), which setupVisibleIdsAttrib() configures on the current Vao:
+	\code
+	in uint ciInstanceId;
+	layout( std430, binding = 0 ) buffer Transforms { mat4 uModelMatrices[]; };
+	...
+	gl_Position = ciViewProjection * uModelMatrices[ciInstanceId] * ciPosition;
+	\endcode
+	Culling runs in a compute shader, or on the CPU with SIMD on all ip::getMaxThreads() threads when Format::cpu() is set, and both produce the same set of visible instances.
+	The order of the ids within each LOD is unspecified on the GPU and ascending by instance on the CPU. Requires OpenGL 4.3. **/
+class CI_API InstanceCuller {
+  public:
+	//! A world space axis-aligned bounding box and the id the vertex shader receives for it, laid out as it is (std430) in the compute shader's storage buffer
+	struct Instance {
+		Instance() : mId( 0 ), mPad( 0 ) {}
+		Instance( const vec3 &center, const vec3 &extents, uint32_t id ) : mCenter( center ), mId( id ), mExtents( extents ), mPad( 0 ) {}
+		//! Creates an Instance from \a box
+		Instance( const AxisAlignedBox &box, uint32_t id ) : mCenter( box.getCenter() ), mId( id ), mExtents( box.getExtents() ), mPad( 0 ) {}
+
+		vec3		mCenter;
+		uint32_t	mId;
+		//! Half the size of the box
+		vec3		mExtents;
+		float		mPad;
+	};
+
+	//! Maximum number of levels of detail
+	static const size_t MAX_LODS = 8;
+
+	struct CI_API Format {
+		Format();
+
+		//! Adds a level of detail drawing \a numIndices indices starting at \a firstIndex with \a baseVertex added to each, for instances closer to the eye than \a maxDistance. LODs must be added in order of increasing distance. Without any LODs, a single one with 0 indices is used, which draws nothing but still counts the visible instances.
+		Format&		lod( GLuint numIndices, GLuint firstIndex = 0, GLint baseVertex = 0, float maxDistance = std::numeric_limits<float>::max() );
+		//! Sets the type of the indices drawn, either \c GL_UNSIGNED_INT (the default) or \c GL_UNSIGNED_SHORT
+		Format&		indexType( GLenum type ) { mIndexType = type; return *this; }
+		//! Culls on the CPU rather than in a compute shader, uploading the visible ids and draw commands each frame. Default is \c false.
+		Format&		cpu( bool enable = true ) { mCpu = enable; return *this; }
+		//! Sets the compute shader's work group size. Default is \c 256.
+		Format&		workGroupSize( GLuint size ) { mWorkGroupSize = size; return *this; }
+
+		struct Lod {
+			GLuint	mNumIndices, mFirstIndex;
+			GLint	mBaseVertex;
+			float	mMaxDistance;
+		};
+
+		const std::vector<Lod>&	getLods() const { return mLods; }
+		GLenum					getIndexType() const { return mIndexType; }
+		bool					isCpu() const { return mCpu; }
+		GLuint					getWorkGroupSize() const { return mWorkGroupSize; }
+
+	  protected:
+		std::vector<Lod>	mLods;
+		GLenum				mIndexType;
+		bool				mCpu;
+		GLuint				mWorkGroupSize;
+	};
+
+	static InstanceCullerRef	create( const Format &format = Format() );
+
+	//! Replaces every instance
+	void		setInstances( const std::vector<Instance> &instances ) { setInstances( instances.data(), instances.size() ); }
+	//! Replaces every instance with the \a count instances at \a instances
+	void		setInstances( const Instance *instances, size_t count );
+	//! Replaces the instance at \a index, which must be less than getNumInstances(). Only the range of changed instances is uploaded before the next cull().
+	void		setInstance( size_t index, const Instance &instance );
+	//! Returns the instances
+	const std::vector<Instance>&	getInstances() const { return mInstances; }
+	//! Returns the number of instances
+	size_t		getNumInstances() const { return mInstances.size(); }
+
+	//! Culls every instance against \a camera's world space frustum, selecting LODs by distance from its eye point
+	void		cull( const Camera &camera );
+	//! Culls every instance against \a frustum, selecting LODs by distance from \a eye
+	void		cull( const Frustumf &frustum, const vec3 &eye );
+
+	//! Draws the visible instances with one glMultiDrawElementsIndirect() covering every LOD, using the currently bound GlslProg and Vao, which must include the visible ids attribute. \see setupVisibleIdsAttrib()
+	void		draw( GLenum mode = GL_TRIANGLES );
+	//! Enables the attribute at \a location on the currently bound Vao as an instanced \c uint sourced from getVisibleIdsVbo(). The Vbo keeps its name as it grows, so this only needs calling once per Vao.
+	void		setupVisibleIdsAttrib( GLint location );
+
+	//! Returns the buffer of visible instance ids. LOD \c i's ids begin at element \c i * getCapacity(), which is the \c baseInstance of its draw command.
+	const VboRef&	getVisibleIdsVbo() const { return mVisibleIdsVbo; }
+	//! Returns the buffer of DrawElementsIndirectCommand's, one per LOD
+	const VboRef&	getIndirectVbo() const { return mIndirectVbo; }
+	//! Returns the number of instances each LOD's region of getVisibleIdsVbo() can hold
+	size_t			getCapacity() const { return mCapacity; }
+
+	//! Returns the number of visible instances in each LOD after the last cull(). On the GPU path this reads back the draw commands, stalling until culling completes.
+	std::vector<uint32_t>	readVisibleCounts() const;
+	//! Returns the ids of the visible instances in each LOD after the last cull(). On the GPU path this reads back the visible ids, stalling until culling completes.
+	std::vector<std::vector<uint32_t>>	readVisibleIds() const;
+
+	const Format&	getFormat() const { return mFormat; }
+
+	/** Culls \a count \a instances against \a frustum on the CPU, appending the ids of the visible ones to \a visible[lod] for the LOD selected by distance from \a eye against \a lodMaxDistances.
+		This is the same test the compute shader runs, vectorized 4 instances at a time and spread across ip::getMaxThreads() threads. It doesn't need a gl::Context. **/
+	static void		cullInstances( const Frustumf &frustum, const vec3 &eye, const Instance *instances, size_t count, const std::vector<float> &lodMaxDistances, std::vector<std::vector<uint32_t>> *visible );
+
+  protected:
+	InstanceCuller( const Format &format );
+
+	//! Analogous to DrawElementsIndirectCommand in the OpenGL spec
+	struct DrawCommand {
+		GLuint	mCount, mInstanceCount, mFirstIndex;
+		GLint	mBaseVertex;
+		GLuint	mBaseInstance;
+	};
+
+	void	upload();
+	void	cullGpu( const Frustumf &frustum, const vec3 &eye );
+	void	cullCpu( const Frustumf &frustum, const vec3 &eye );
+
+	Format						mFormat;
+	std::vector<float>			mLodMaxDistancesSq;
+	std::vector<Instance>		mInstances;
+	std::vector<DrawCommand>	mCommands;
+	size_t						mCapacity;
+	size_t						mDirtyBegin, mDirtyEnd;
+
+	VboRef						mInstancesVbo, mVisibleIdsVbo, mIndirectVbo;
+	GlslProgRef					mCullGlsl;
+
+	// the CPU path's results, kept for readVisibleIds()
+	std::vector<std::vector<uint32_t>>	mCpuVisible;
+};
+
+} } // namespace cinder::gl
+
+#endif // defined( CINDER_GL_HAS_MULTI_DRAW_INDIRECT )
@@ -0,0 +1,167 @@
+/*
+ Copyright (c) 2026, The Cinder Project
+
+ This code is intended to be used with the Cinder C++ library, http://libcinder.org
+
+ Redistribution and use in source and binary forms, with or without modification, are permitted provided that
+ the following conditions are met:
+
+    * Redistributions of source code must retain the above copyright notice, this list of conditions and
+	the following disclaimer.
+    * Redistributions in binary form must reproduce the above copyright notice, this list of conditions and
+	the following disclaimer in the documentation and/or other materials provided with the distribution.
+
+ THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED
+ WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A
+ PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR
+ ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+ TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+ NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ POSSIBILITY OF SUCH DAMAGE.
+*/
+
+#pragma once
+
+#include "cinder/gl/platform.h"
+
+#if defined( CINDER_GL_HAS_MULTI_DRAW_INDIRECT )
+
+#include "cinder/gl/GlslProg.h"
+#include "cinder/gl/Ssbo.h"
+#include "cinder/gl/Vao.h"
+#include "cinder/gl/Vbo.h"
+#include "cinder/gl/VboMesh.h"
+#include "cinder/GeomIo.h"
+#include "cinder/Color.h"
+
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace cinder { namespace gl {
+
+typedef std::shared_ptr<class MegaBatch>	MegaBatchRef;
+
+/** Packs many static meshes that share a vertex layout into shared vertex and index buffers, and draws every visible one with a single glMultiDrawElementsIndirect().
+	Each object's model matrix and color are stored in a shader storage buffer, which the vertex shader indexes with the per-draw \c ciDrawId attribute:
+	\code
+	in uint ciDrawId;
+	struct DrawData { mat4 modelMatrix; vec4 color; };
+	layout( std430, binding = 0 ) buffer DrawDataBuffer { DrawData uDrawData[]; };
+	...
+	gl_Position = ciViewProjection * uDrawData[ciDrawId].modelMatrix * ciPosition;
+	\endcode
+	The default cinder uniforms are set as they are for a Batch, so the current view and projection matrices apply. Requires OpenGL 4.3. **/
+class CI_API MegaBatch {
+  public:
+	//! Per-object data as it's laid out (std430) in the shader storage buffer
+	struct DrawData {
+		mat4		mModelMatrix;
+		ColorAf		mColor;
+	};
+
+	struct CI_API Format {
+		Format();
+
+		//! Adds a vertex attribute of \a dims floats shared by all objects, or changes the dimensions of an existing one. Defaults to 3D positions and normals and 2D texture coordinates.
+		Format&		attrib( geom::Attrib attrib, uint8_t dims );
+		//! Removes all vertex attributes, typically before specifying new ones with attrib()
+		Format&		clearAttribs() { mAttribs.clear(); return *this; }
+		//! Sets the shader storage buffer binding of the per-object DrawData. Default is \c 0.
+		Format&		storageBinding( GLuint binding ) { mStorageBinding = binding; return *this; }
+		//! Sets the name of the \c uint vertex attribute that receives each object's index. Default is \c "ciDrawId".
+		Format&		drawIdAttrib( const std::string &name ) { mDrawIdAttrib = name; return *this; }
+
+		const std::vector<std::pair<geom::Attrib,uint8_t>>&	getAttribs() const { return mAttribs; }
+		GLuint				getStorageBinding() const { return mStorageBinding; }
+		const std::string&	getDrawIdAttrib() const { return mDrawIdAttrib; }
+
+	  protected:
+		std::vector<std::pair<geom::Attrib,uint8_t>>	mAttribs;
+		GLuint											mStorageBinding;
+		std::string										mDrawIdAttrib;
+	};
+
+	static MegaBatchRef	create( const GlslProgRef &glsl, const Format &format = Format() );
+
+	//! Appends \a source as a new object and returns its index. Geometry is converted to triangles and attributes missing from \a source are zero-filled. Throws geom::ExcIllegalPrimitiveType for non-triangle geometry.
+	uint32_t	add( const geom::Source &source, const mat4 &modelMatrix = mat4(), const ColorAf &color = ColorAf::white() );
+	//! Appends the geometry of \a vboMesh, which is downloaded from the GPU, as a new object and returns its index
+	uint32_t	add( const VboMeshRef &vboMesh, const mat4 &modelMatrix = mat4(), const ColorAf &color = ColorAf::white() );
+	//! Removes all objects, retaining the GPU buffers for reuse
+	void		clear();
+
+	//! Sets the model matrix of \a object
+	void			setModelMatrix( uint32_t object, const mat4 &modelMatrix );
+	//! Returns the model matrix of \a object
+	const mat4&		getModelMatrix( uint32_t object ) const { return mDrawData[object].mModelMatrix; }
+	//! Sets the color of \a object
+	void			setColor( uint32_t object, const ColorAf &color );
+	//! Returns the color of \a object
+	const ColorAf&	getColor( uint32_t object ) const { return mDrawData[object].mColor; }
+	//! Shows or hides \a object. Hidden objects are left out of the indirect draw commands.
+	void			setVisible( uint32_t object, bool visible = true );
+	//! Returns whether \a object is drawn
+	bool			isVisible( uint32_t object ) const { return mObjects[object].mVisible; }
+
+	//! Draws every visible object with a single glMultiDrawElementsIndirect(), first uploading anything that changed since the previous draw
+	void		draw();
+
+	//! Returns the number of objects, visible or not
+	size_t		getNumObjects() const { return mObjects.size(); }
+	//! Returns the number of visible objects
+	size_t		getNumVisible() const { return mNumVisible; }
+	//! Returns the total number of vertices across all objects
+	size_t		getNumVertices() const { return mNumVertices; }
+	//! Returns the total number of indices across all objects
+	size_t		getNumIndices() const { return mIndices.size(); }
+
+	//! Returns the shader the MegaBatch draws with
+	const GlslProgRef&	getGlslProg() const { return mGlsl; }
+	//! Replaces the shader the MegaBatch draws with
+	void				replaceGlslProg( const GlslProgRef &glsl );
+
+  protected:
+	MegaBatch( const GlslProgRef &glsl, const Format &format );
+
+	//! Analogous to DrawElementsIndirectCommand in the OpenGL spec
+	struct DrawCommand {
+		GLuint	mCount, mInstanceCount, mFirstIndex;
+		GLint	mBaseVertex;
+		GLuint	mBaseInstance;
+	};
+
+	struct Object {
+		uint32_t	mFirstIndex, mNumIndices, mBaseVertex;
+		bool		mVisible;
+	};
+
+	void	upload();
+	void	buildVao();
+
+	Format						mFormat;
+	GlslProgRef					mGlsl;
+	std::vector<size_t>			mAttribOffsets; // in floats
+	size_t						mVertexStride; // in floats
+
+	std::vector<Object>			mObjects;
+	std::vector<DrawData>		mDrawData;
+	std::vector<float>			mVertices;
+	std::vector<uint32_t>		mIndices;
+	std::vector<DrawCommand>	mCommands;
+	size_t						mNumVertices, mNumVisible;
+
+	// what's already been uploaded; geometry is append-only so only the tail since then needs to be
+	size_t						mUploadedVertices, mUploadedIndices, mUploadedObjects;
+	size_t						mDrawDataDirtyBegin, mDrawDataDirtyEnd;
+	bool						mCommandsDirty, mVaoDirty;
+
+	VboRef						mVertexVbo, mIndexVbo, mDrawIdVbo, mIndirectVbo;
+	SsboRef						mDrawDataSsbo;
+	VaoRef						mVao;
+};
+
+} } // namespace cinder::gl
+
+#endif // defined( CINDER_GL_HAS_MULTI_DRAW_INDIRECT )
@@ -0,0 +1,238 @@
+/*
+ Copyright (c) 2026, The Cinder Project
+
+ This code is intended to be used with the Cinder C++ library, http://libcinder.org
+
+ Redistribution and use in source and binary forms, with or without modification, are permitted provided that
+ the following conditions are met:
+
+    * Redistributions of source code must retain the above copyright notice, this list of conditions and
+	the following disclaimer.
+    * Redistributions in binary form must reproduce the above copyright notice, this list of conditions and
+	the following disclaimer in the documentation and/or other materials provided with the distribution.
+
+ THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED
+ WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A
+ PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR
+ ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+ TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+ NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ POSSIBILITY OF SUCH DAMAGE.
+*/
+
+#pragma once
+
+#include "cinder/gl/platform.h"
+#include "cinder/gl/Query.h"
+#include "cinder/Filesystem.h"
+#include "cinder/Noncopyable.h"
+
+#include <deque>
+#include <string>
+#include <vector>
+
+namespace cinder { namespace gl {
+
+//! Hierarchical frame profiler. Each named scope is timed on the CPU and, where timer queries are available, on the GPU, and
+//! nested scopes form a tree. GPU timestamps are read back a few frames late from a pool of \c GL_TIMESTAMP queries, so
+//! profiling doesn't stall the pipeline. Per-frame times are kept for the last Options::historySize() frames, from which getStats()
+//! computes means and percentiles. Frames can also be captured and exported as Chrome trace JSON (chrome://tracing or ui.perfetto.dev).
+//!
+//! Scopes are usually opened with CI_PROFILE_SCOPE(), which uses the global instance. All calls have to be made on the thread of the
+//! gl::Context the scopes are recorded in, and endFrame() has to be called once per frame, typically at the end of App::draw().
+class CI_API Profiler : private Noncopyable {
+  public:
+	struct CI_API Options {
+		Options() : mGpuTiming( true ), mMaxFramesInFlight( 4 ), mHistorySize( 240 ) {}
+
+		//! Sets whether scopes are timed on the GPU as well as on the CPU (\default true). Ignored when timer queries aren't supported.
+		Options& gpuTiming( bool enable = true )		{ mGpuTiming = enable; return *this; }
+		//! Sets the number of frames whose GPU times may be pending before endFrame() waits for the oldest (\default 4)
+		Options& maxFramesInFlight( size_t frames )		{ mMaxFramesInFlight = frames; return *this; }
+		//! Sets the number of frames statistics are computed from (\default 240)
+		Options& historySize( size_t frames )			{ mHistorySize = frames; return *this; }
+
+		bool	isGpuTiming() const				{ return mGpuTiming; }
+		size_t	getMaxFramesInFlight() const	{ return mMaxFramesInFlight; }
+		size_t	getHistorySize() const			{ return mHistorySize; }
+
+	  private:
+		bool	mGpuTiming;
+		size_t	mMaxFramesInFlight, mHistorySize;
+	};
+
+	//! Summary of a series of times, in milliseconds
+	struct Stats {
+		double	mMean = 0, mMin = 0, mMax = 0;
+		double	mP50 = 0, mP95 = 0, mP99 = 0;
+	};
+
+	//! Statistics of one scope over the frames of the history in which it was entered
+	struct ScopeStats {
+		//! The name passed to begin()
+		std::string		mName;
+		//! The names of the enclosing scopes and this one, separated by '/'
+		std::string		mPath;
+		//! The number of enclosing scopes
+		int				mDepth;
+		//! The number of frames the scope was entered in
+		size_t			mNumFrames;
+		//! The average number of times per frame the scope was entered, in the frames it was entered in
+		double			mCallsPerFrame;
+		//! Total CPU and GPU time per frame. GPU times are zero without GPU timing.
+		Stats			mCpu, mGpu;
+	};
+
+	//! Creates a Profiler. Most code uses the global instance returned by get() instead.
+	explicit Profiler( const Options &options = Options() );
+
+	//! Returns the global instance used by CI_PROFILE_SCOPE()
+	static Profiler*	get();
+
+	//! Opens a scope named \a name nested in the current one. \a name is copied the first time it's seen at this position in the tree.
+	void	begin( const char *name );
+	//! Closes the current scope
+	void	end();
+	//! Closes the current frame, which closes any scopes left open, and folds the frames whose GPU times are available into the statistics
+	void	endFrame();
+
+	//! Enables or disables recording (\default enabled). Takes effect at the next endFrame().
+	void	setEnabled( bool enable = true )	{ mEnableNextFrame = enable; }
+	//! Returns whether recording is enabled
+	bool	isEnabled() const					{ return mEnableNextFrame; }
+	//! Returns whether scopes are being timed on the GPU. Support is checked when a frame's first scope is opened, so a Profiler created
+	//! before the gl::Context (like the global instance) starts timing on the GPU once one is current.
+	bool	isGpuTiming() const					{ return mGpuTiming; }
+
+	//! Returns the statistics of every scope, in depth-first order
+	std::vector<ScopeStats>		getStats() const;
+	//! Returns the statistics of the CPU time between calls to endFrame()
+	Stats						getFrameStats() const;
+	//! Returns the CPU times between calls to endFrame() in milliseconds, oldest first
+	std::vector<float>			getFrameHistory() const;
+	//! Clears the statistics
+	void	clearStats();
+
+	//! Starts recording every frame into a capture of at most \a maxFrames frames, discarding any previous capture
+	void	startCapture( size_t maxFrames = 600 );
+	//! Stops adding frames to the capture
+	void	stopCapture()			{ mCapturing = false; }
+	//! Returns whether frames are being added to the capture
+	bool	isCapturing() const		{ return mCapturing; }
+	//! Returns the number of frames in the capture
+	size_t	getNumCapturedFrames() const	{ return mCapture.size(); }
+	//! Writes the captured frames as Chrome trace JSON. CPU scopes are on one track and GPU scopes on another, aligned to the CPU clock.
+	void	writeChromeTrace( std::ostream &os ) const;
+	//! Writes the captured frames as Chrome trace JSON to \a path
+	void	writeChromeTrace( const fs::path &path ) const;
+
+	//! Returns the number of times endFrame() had to wait for GPU times, which means Options::maxFramesInFlight() is too low
+	size_t	getNumStalls() const			{ return mNumStalls; }
+	//! Returns the number of query objects the pool has allocated
+	size_t	getNumQueriesAllocated() const	{ return mNumQueriesAllocated; }
+
+	//! Returns the Options the Profiler was created with
+	const Options&	getOptions() const		{ return mOptions; }
+
+  private:
+	struct Node {
+		std::string			mName;
+		int32_t				mParent, mDepth;
+		std::vector<int32_t>	mChildren;
+	};
+
+	struct Sample {
+		int32_t				mNode;
+		uint64_t			mCpuBegin, mCpuEnd;
+		uint64_t			mGpuBegin, mGpuEnd;
+#if ! defined( CINDER_GL_ES )
+		QueryRef			mGpuBeginQuery, mGpuEndQuery;
+#endif
+	};
+
+	struct Frame {
+		uint64_t			mIndex;
+		std::vector<Sample>	mSamples;
+		uint64_t			mCpuBegin, mCpuEnd;
+		bool				mGpuTimed;
+		//! GPU clock minus CPU clock in nanoseconds, measured while capturing
+		int64_t				mGpuOffset;
+#if ! defined( CINDER_GL_ES )
+		//! The query issued last, which is available once all of the frame's queries are
+		QueryRef			mLastQuery;
+#endif
+	};
+
+	struct History {
+		struct Entry {
+			uint64_t	mFrame;
+			float		mCpuMs, mGpuMs;
+			uint32_t	mCalls;
+		};
+		std::deque<Entry>	mEntries;
+	};
+
+	void		beginFrame();
+	int32_t		findChild( int32_t parent, const char *name );
+	bool		isReady( const Frame &frame ) const;
+	void		resolve( Frame &frame );
+	void		accumulate( const Frame &frame );
+	//! Returns whether \a entry is within the last Options::historySize() frames
+	bool		isInHistory( const History::Entry &entry ) const;
+	void		appendStats( int32_t node, std::vector<ScopeStats> *result ) const;
+#if ! defined( CINDER_GL_ES )
+	QueryRef	timestamp();
+#endif
+
+	Options					mOptions;
+	bool					mEnabled, mEnableNextFrame, mGpuTiming;
+
+	std::vector<Node>		mNodes;
+	std::vector<History>	mHistories;
+	std::deque<float>		mFrameHistory;
+	std::vector<size_t>		mStack;
+	Frame					mFrame;
+	std::deque<Frame>		mPendingFrames;
+
+	uint64_t				mNumFrames, mLastResolvedFrame;
+
+	bool					mCapturing;
+	size_t					mMaxCaptureFrames;
+	uint64_t				mCaptureStartFrame;
+	std::deque<Frame>		mCapture;
+
+#if ! defined( CINDER_GL_ES )
+	std::vector<QueryRef>	mQueryPool;
+#endif
+	size_t					mNumQueriesAllocated, mNumStalls;
+};
+
+//! Opens a Profiler scope for the duration of its lifetime
+class CI_API ScopedProfile : private Noncopyable {
+  public:
+	ScopedProfile( const char *name, Profiler *profiler = Profiler::get() )
+		: mProfiler( profiler )
+	{
+		mProfiler->begin( name );
+	}
+	~ScopedProfile()
+	{
+		mProfiler->end();
+	}
+
+  private:
+	Profiler	*mProfiler;
+};
+
+} } // namespace cinder::gl
+
+#define CI_PROFILE_CONCAT_IMPL( a, b )	a##b
+#define CI_PROFILE_CONCAT( a, b )		CI_PROFILE_CONCAT_IMPL( a, b )
+
+//! Profiles the rest of the enclosing block as a scope named \a name with the global gl::Profiler. Compiles to nothing when CINDER_DISABLE_PROFILER is defined.
+#if defined( CINDER_DISABLE_PROFILER )
+	#define CI_PROFILE_SCOPE( name )	do {} while( false )
+#else
+	#define CI_PROFILE_SCOPE( name )	::cinder::gl::ScopedProfile CI_PROFILE_CONCAT( ciProfileScope, __LINE__ )( name )
+#endif
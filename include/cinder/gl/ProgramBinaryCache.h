@@ -0,0 +1,119 @@
+/*
+ Copyright (c) 2026, The Cinder Project
+
+ This code is intended to be used with the Cinder C++ library, http://libcinder.org
+
+ Redistribution and use in source and binary forms, with or without modification, are permitted provided that
+ the following conditions are met:
+
+    * Redistributions of source code must retain the above copyright notice, this list of conditions and
+	the following disclaimer.
+    * Redistributions in binary form must reproduce the above copyright notice, this list of conditions and
+	the following disclaimer in the documentation and/or other materials provided with the distribution.
+
+ THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED
+ WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A
+ PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR
+ ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+ TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+ NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ POSSIBILITY OF SUCH DAMAGE.
+*/
+
+#pragma once
+
+#include "cinder/gl/platform.h"
+#include "cinder/Filesystem.h"
+
+#include <iosfwd>
+#include <string>
+#include <vector>
+
+namespace cinder { namespace gl {
+
+//! Opt-in on-disk cache of linked GlslProg binaries, stored with glGetProgramBinary() and restored with glProgramBinary() so that later runs skip compiling and linking.
+//! Each program is keyed by a hash of its preprocessed shader sources, the ShaderPreprocessor defines and version, its attribute, fragment data and transform feedback bindings, and the driver's vendor, renderer and version strings. Editing a shader or updating the driver therefore misses the cache instead of loading a stale binary, and a binary the driver rejects is deleted and rebuilt from source.
+//! Requires GL 4.1, \c GL_ARB_get_program_binary or ES 3.0; otherwise GlslProg always compiles from source. Not thread-safe; use from the thread that creates GlslProgs.
+class CI_API ProgramBinaryCache {
+  public:
+	//! How long each step of creating a GlslProg took, recorded while timing is enabled
+	struct CI_API ProgramTiming {
+		//! The GlslProg's label, its vertex shader's file name, or when neither is present its cache key in hexadecimal (\c "program <handle>" when the cache is disabled)
+		std::string	mName;
+		//! The cache key, which is also the name of the binary in the cache directory. 0 when the cache is disabled.
+		uint64_t	mKey;
+		//! Whether the program was restored from the cache rather than compiled from source
+		bool		mLoadedFromCache;
+		//! Time spent expanding the sources with the ShaderPreprocessor and computing the key
+		double		mPreprocessSeconds;
+		//! Time spent compiling shaders, 0 when loaded from the cache
+		double		mCompileSeconds;
+		//! Time spent linking, 0 when loaded from the cache
+		double		mLinkSeconds;
+		//! Time spent reading the binary and in glProgramBinary(), including failed attempts
+		double		mLoadSeconds;
+		//! Time spent retrieving the binary and writing it to the cache
+		double		mSaveSeconds;
+
+		double		getTotalSeconds() const { return mPreprocessSeconds + mCompileSeconds + mLinkSeconds + mLoadSeconds + mSaveSeconds; }
+	};
+
+	//! Returns the process-wide cache, which is disabled by default
+	static ProgramBinaryCache*	get();
+
+	//! Enables the cache, storing binaries in \a directory, which is created when the first binary is saved
+	void				enable( const fs::path &directory );
+	//! Disables the cache. GlslProgs created afterwards compile from source and nothing is written.
+	void				disable();
+	//! Returns whether the cache is enabled and supported by the current context
+	bool				isEnabled() const;
+	//! Returns the directory binaries are stored in
+	const fs::path&		getDirectory() const { return mDirectory; }
+	//! Deletes every binary in the cache directory
+	void				clear();
+
+	//! Enables recording a ProgramTiming for every GlslProg created. Independent of whether the cache is enabled.
+	void				enableTiming( bool enable = true ) { mTimingEnabled = enable; }
+	//! Returns whether ProgramTimings are recorded. \default false.
+	bool				isTimingEnabled() const { return mTimingEnabled; }
+	//! Enables logging each ProgramTiming at info level as it is recorded. Implies enableTiming().
+	void				enableTimingLog( bool enable = true ) { mTimingLogEnabled = enable; if( enable ) mTimingEnabled = true; }
+	//! Returns the ProgramTimings recorded since timing was enabled or clearTimings() was called
+	const std::vector<ProgramTiming>&	getTimings() const { return mTimings; }
+	//! Clears the recorded ProgramTimings
+	void				clearTimings() { mTimings.clear(); }
+	//! Writes a table of the recorded ProgramTimings and their totals to \a os
+	void				printTimings( std::ostream &os ) const;
+
+	//! Returns the number of programs restored from the cache since it was enabled
+	size_t				getNumHits() const { return mNumHits; }
+	//! Returns the number of programs compiled from source since the cache was enabled
+	size_t				getNumMisses() const { return mNumMisses; }
+
+	//! Returns a hash of \a data seeded with \a hash, used to build cache keys. FNV-1a, stable across platforms and runs.
+	static uint64_t		hash( const void *data, size_t size, uint64_t hash = 14695981039346656037ULL );
+	//! Returns a hash of \a str including its length, so that consecutive strings can't alias
+	static uint64_t		hash( const std::string &str, uint64_t hash = 14695981039346656037ULL );
+	//! Returns \a key mixed with the driver's vendor, renderer and version strings
+	static uint64_t		hashDriver( uint64_t key );
+
+	//! Replaces \a program's executable with the binary cached for \a key. Returns false, leaving \a program untouched, if there is none or it's no longer accepted. Called by GlslProg.
+	bool				load( GLuint program, uint64_t key );
+	//! Writes the binary of the linked \a program for \a key. Failures are logged and otherwise ignored. Called by GlslProg.
+	void				save( GLuint program, uint64_t key );
+	//! Records \a timing if timing is enabled. Called by GlslProg.
+	void				addTiming( const ProgramTiming &timing );
+
+  private:
+	ProgramBinaryCache();
+
+	fs::path	getBinaryPath( uint64_t key ) const;
+
+	bool						mEnabled, mTimingEnabled, mTimingLogEnabled;
+	fs::path					mDirectory;
+	std::vector<ProgramTiming>	mTimings;
+	size_t						mNumHits, mNumMisses;
+};
+
+} } // namespace cinder::gl
@@ -0,0 +1,254 @@
+/*
+ Copyright (c) 2026, The Cinder Project
+
+ This code is intended to be used with the Cinder C++ library, http://libcinder.org
+
+ Redistribution and use in source and binary forms, with or without modification, are permitted provided that
+ the following conditions are met:
+
+    * Redistributions of source code must retain the above copyright notice, this list of conditions and
+	the following disclaimer.
+    * Redistributions in binary form must reproduce the above copyright notice, this list of conditions and
+	the following disclaimer in the documentation and/or other materials provided with the distribution.
+
+ THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED
+ WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A
+ PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR
+ ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+ TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+ NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ POSSIBILITY OF SUCH DAMAGE.
+*/
+
+#pragma once
+
+#include "cinder/gl/platform.h"
+#include "cinder/CinderAssert.h"
+
+#include <array>
+#include <deque>
+#include <vector>
+
+namespace cinder { namespace gl {
+
+//! A stack of GL state values used by the Context. The first \a InlineCapacity values are stored inline; deeper nesting spills into a heap-allocated overflow that is retained once grown, so pushing and popping doesn't allocate in steady state.
+template<typename T, size_t InlineCapacity = 8>
+class StateStack {
+  public:
+	StateStack() : mSize( 0 ) {}
+
+	bool		empty() const	{ return mSize == 0; }
+	size_t		size() const	{ return mSize; }
+	T&			back()			{ CI_ASSERT( mSize > 0 ); return at( mSize - 1 ); }
+	const T&	back() const	{ CI_ASSERT( mSize > 0 ); return at( mSize - 1 ); }
+
+	void		push_back( const T &value )
+	{
+		if( mSize < InlineCapacity )
+			mInline[mSize] = value;
+		else if( mSize - InlineCapacity < mOverflow.size() )
+			mOverflow[mSize - InlineCapacity] = value;
+		else
+			mOverflow.push_back( value );
+		++mSize;
+	}
+
+	void		pop_back()		{ CI_ASSERT( mSize > 0 ); --mSize; }
+	void		clear()			{ mSize = 0; }
+
+  private:
+	T&			at( size_t index )			{ return ( index < InlineCapacity ) ? mInline[index] : mOverflow[index - InlineCapacity]; }
+	const T&	at( size_t index ) const	{ return ( index < InlineCapacity ) ? mInline[index] : mOverflow[index - InlineCapacity]; }
+
+	std::array<T,InlineCapacity>	mInline;
+	std::vector<T>					mOverflow;
+	size_t							mSize;
+};
+
+//! A StateStack per GLenum key, such as a buffer target or capability. Keys that \a IndexFn maps into [0, \a NumKeys) are stored in a flat array; any other key is kept in a short list that's searched linearly. Stacks are never removed, so references remain valid for the lifetime of the container.
+template<typename T, size_t NumKeys, int (*IndexFn)( GLenum )>
+class KeyedStateStacks {
+  public:
+	//! Returns the stack for \a key, which is empty the first time it's requested
+	StateStack<T>&	operator[]( GLenum key )
+	{
+		const int index = IndexFn( key );
+		if( index >= 0 )
+			return mStacks[index];
+
+		for( auto &other : mOtherStacks ) {
+			if( other.first == key )
+				return other.second;
+		}
+		mOtherStacks.emplace_back( key, StateStack<T>() );
+		return mOtherStacks.back().second;
+	}
+
+  private:
+	std::array<StateStack<T>,NumKeys>				mStacks;
+	std::deque<std::pair<GLenum,StateStack<T>>>		mOtherStacks;
+};
+
+//! Compact indices of the buffer targets the Context tracks in a flat array
+enum BufferTargetIndex {
+	BUFFER_TARGET_ARRAY, BUFFER_TARGET_ELEMENT_ARRAY, BUFFER_TARGET_PIXEL_PACK, BUFFER_TARGET_PIXEL_UNPACK,
+	BUFFER_TARGET_UNIFORM, BUFFER_TARGET_TRANSFORM_FEEDBACK, BUFFER_TARGET_COPY_READ, BUFFER_TARGET_COPY_WRITE,
+	BUFFER_TARGET_TEXTURE, BUFFER_TARGET_SHADER_STORAGE, BUFFER_TARGET_DRAW_INDIRECT, BUFFER_TARGET_DISPATCH_INDIRECT,
+	BUFFER_TARGET_ATOMIC_COUNTER, BUFFER_TARGET_QUERY,
+	NUM_BUFFER_TARGETS
+};
+
+//! Returns the BufferTargetIndex of \a target, or \c -1 if it has none
+inline int bufferTargetIndex( GLenum target )
+{
+	switch( target ) {
+		case GL_ARRAY_BUFFER:					return BUFFER_TARGET_ARRAY;
+		case GL_ELEMENT_ARRAY_BUFFER:			return BUFFER_TARGET_ELEMENT_ARRAY;
+#if defined( GL_PIXEL_PACK_BUFFER )
+		case GL_PIXEL_PACK_BUFFER:				return BUFFER_TARGET_PIXEL_PACK;
+		case GL_PIXEL_UNPACK_BUFFER:			return BUFFER_TARGET_PIXEL_UNPACK;
+#endif
+#if defined( GL_UNIFORM_BUFFER )
+		case GL_UNIFORM_BUFFER:					return BUFFER_TARGET_UNIFORM;
+#endif
+#if defined( GL_TRANSFORM_FEEDBACK_BUFFER )
+		case GL_TRANSFORM_FEEDBACK_BUFFER:		return BUFFER_TARGET_TRANSFORM_FEEDBACK;
+#endif
+#if defined( GL_COPY_READ_BUFFER )
+		case GL_COPY_READ_BUFFER:				return BUFFER_TARGET_COPY_READ;
+		case GL_COPY_WRITE_BUFFER:				return BUFFER_TARGET_COPY_WRITE;
+#endif
+#if defined( GL_TEXTURE_BUFFER )
+		case GL_TEXTURE_BUFFER:					return BUFFER_TARGET_TEXTURE;
+#endif
+#if defined( GL_SHADER_STORAGE_BUFFER )
+		case GL_SHADER_STORAGE_BUFFER:			return BUFFER_TARGET_SHADER_STORAGE;
+#endif
+#if defined( GL_DRAW_INDIRECT_BUFFER )
+		case GL_DRAW_INDIRECT_BUFFER:			return BUFFER_TARGET_DRAW_INDIRECT;
+#endif
+#if defined( GL_DISPATCH_INDIRECT_BUFFER )
+		case GL_DISPATCH_INDIRECT_BUFFER:		return BUFFER_TARGET_DISPATCH_INDIRECT;
+#endif
+#if defined( GL_ATOMIC_COUNTER_BUFFER )
+		case GL_ATOMIC_COUNTER_BUFFER:			return BUFFER_TARGET_ATOMIC_COUNTER;
+#endif
+#if defined( GL_QUERY_BUFFER )
+		case GL_QUERY_BUFFER:					return BUFFER_TARGET_QUERY;
+#endif
+		default:								return -1;
+	}
+}
+
+//! Compact indices of the texture targets the Context tracks in a flat array per texture unit
+enum TextureTargetIndex {
+	TEXTURE_TARGET_2D, TEXTURE_TARGET_CUBE_MAP, TEXTURE_TARGET_3D, TEXTURE_TARGET_2D_ARRAY,
+	TEXTURE_TARGET_1D, TEXTURE_TARGET_1D_ARRAY, TEXTURE_TARGET_RECTANGLE, TEXTURE_TARGET_CUBE_MAP_ARRAY,
+	TEXTURE_TARGET_BUFFER, TEXTURE_TARGET_2D_MULTISAMPLE, TEXTURE_TARGET_2D_MULTISAMPLE_ARRAY, TEXTURE_TARGET_EXTERNAL,
+	NUM_TEXTURE_TARGETS
+};
+
+//! Returns the TextureTargetIndex of \a target, or \c -1 if it has none
+inline int textureTargetIndex( GLenum target )
+{
+	switch( target ) {
+		case GL_TEXTURE_2D:						return TEXTURE_TARGET_2D;
+		case GL_TEXTURE_CUBE_MAP:				return TEXTURE_TARGET_CUBE_MAP;
+#if defined( GL_TEXTURE_3D )
+		case GL_TEXTURE_3D:						return TEXTURE_TARGET_3D;
+#endif
+#if defined( GL_TEXTURE_2D_ARRAY )
+		case GL_TEXTURE_2D_ARRAY:				return TEXTURE_TARGET_2D_ARRAY;
+#endif
+#if defined( GL_TEXTURE_1D )
+		case GL_TEXTURE_1D:						return TEXTURE_TARGET_1D;
+#endif
+#if defined( GL_TEXTURE_1D_ARRAY )
+		case GL_TEXTURE_1D_ARRAY:				return TEXTURE_TARGET_1D_ARRAY;
+#endif
+#if defined( GL_TEXTURE_RECTANGLE )
+		case GL_TEXTURE_RECTANGLE:				return TEXTURE_TARGET_RECTANGLE;
+#endif
+#if defined( GL_TEXTURE_CUBE_MAP_ARRAY )
+		case GL_TEXTURE_CUBE_MAP_ARRAY:			return TEXTURE_TARGET_CUBE_MAP_ARRAY;
+#endif
+#if defined( GL_TEXTURE_BUFFER )
+		case GL_TEXTURE_BUFFER:					return TEXTURE_TARGET_BUFFER;
+#endif
+#if defined( GL_TEXTURE_2D_MULTISAMPLE )
+		case GL_TEXTURE_2D_MULTISAMPLE:			return TEXTURE_TARGET_2D_MULTISAMPLE;
+#endif
+#if defined( GL_TEXTURE_2D_MULTISAMPLE_ARRAY )
+		case GL_TEXTURE_2D_MULTISAMPLE_ARRAY:	return TEXTURE_TARGET_2D_MULTISAMPLE_ARRAY;
+#endif
+#if defined( GL_TEXTURE_EXTERNAL_OES )
+		case GL_TEXTURE_EXTERNAL_OES:			return TEXTURE_TARGET_EXTERNAL;
+#endif
+		default:								return -1;
+	}
+}
+
+//! Compact indices of the capabilities (and \c GL_DEPTH_WRITEMASK) the Context tracks in a flat array
+enum CapabilityIndex {
+	CAPABILITY_BLEND, CAPABILITY_CULL_FACE, CAPABILITY_DEPTH_TEST, CAPABILITY_DEPTH_WRITEMASK,
+	CAPABILITY_SCISSOR_TEST, CAPABILITY_STENCIL_TEST, CAPABILITY_DITHER, CAPABILITY_POLYGON_OFFSET_FILL,
+	CAPABILITY_SAMPLE_ALPHA_TO_COVERAGE, CAPABILITY_SAMPLE_COVERAGE, CAPABILITY_RASTERIZER_DISCARD, CAPABILITY_PRIMITIVE_RESTART_FIXED_INDEX,
+	CAPABILITY_MULTISAMPLE, CAPABILITY_LINE_SMOOTH, CAPABILITY_POLYGON_SMOOTH, CAPABILITY_PROGRAM_POINT_SIZE,
+	CAPABILITY_FRAMEBUFFER_SRGB, CAPABILITY_DEPTH_CLAMP, CAPABILITY_TEXTURE_CUBE_MAP_SEAMLESS, CAPABILITY_COLOR_LOGIC_OP,
+	CAPABILITY_PRIMITIVE_RESTART,
+	NUM_CAPABILITIES
+};
+
+//! Returns the CapabilityIndex of \a cap, or \c -1 if it has none
+inline int capabilityIndex( GLenum cap )
+{
+	switch( cap ) {
+		case GL_BLEND:							return CAPABILITY_BLEND;
+		case GL_CULL_FACE:						return CAPABILITY_CULL_FACE;
+		case GL_DEPTH_TEST:						return CAPABILITY_DEPTH_TEST;
+		case GL_DEPTH_WRITEMASK:				return CAPABILITY_DEPTH_WRITEMASK;
+		case GL_SCISSOR_TEST:					return CAPABILITY_SCISSOR_TEST;
+		case GL_STENCIL_TEST:					return CAPABILITY_STENCIL_TEST;
+		case GL_DITHER:							return CAPABILITY_DITHER;
+		case GL_POLYGON_OFFSET_FILL:			return CAPABILITY_POLYGON_OFFSET_FILL;
+		case GL_SAMPLE_ALPHA_TO_COVERAGE:		return CAPABILITY_SAMPLE_ALPHA_TO_COVERAGE;
+		case GL_SAMPLE_COVERAGE:				return CAPABILITY_SAMPLE_COVERAGE;
+#if defined( GL_RASTERIZER_DISCARD )
+		case GL_RASTERIZER_DISCARD:				return CAPABILITY_RASTERIZER_DISCARD;
+#endif
+#if defined( GL_PRIMITIVE_RESTART_FIXED_INDEX )
+		case GL_PRIMITIVE_RESTART_FIXED_INDEX:	return CAPABILITY_PRIMITIVE_RESTART_FIXED_INDEX;
+#endif
+#if defined( GL_MULTISAMPLE )
+		case GL_MULTISAMPLE:					return CAPABILITY_MULTISAMPLE;
+#endif
+#if defined( GL_LINE_SMOOTH )
+		case GL_LINE_SMOOTH:					return CAPABILITY_LINE_SMOOTH;
+#endif
+#if defined( GL_POLYGON_SMOOTH )
+		case GL_POLYGON_SMOOTH:					return CAPABILITY_POLYGON_SMOOTH;
+#endif
+#if defined( GL_PROGRAM_POINT_SIZE )
+		case GL_PROGRAM_POINT_SIZE:				return CAPABILITY_PROGRAM_POINT_SIZE;
+#endif
+#if defined( GL_FRAMEBUFFER_SRGB )
+		case GL_FRAMEBUFFER_SRGB:				return CAPABILITY_FRAMEBUFFER_SRGB;
+#endif
+#if defined( GL_DEPTH_CLAMP )
+		case GL_DEPTH_CLAMP:					return CAPABILITY_DEPTH_CLAMP;
+#endif
+#if defined( GL_TEXTURE_CUBE_MAP_SEAMLESS )
+		case GL_TEXTURE_CUBE_MAP_SEAMLESS:		return CAPABILITY_TEXTURE_CUBE_MAP_SEAMLESS;
+#endif
+#if defined( GL_COLOR_LOGIC_OP )
+		case GL_COLOR_LOGIC_OP:					return CAPABILITY_COLOR_LOGIC_OP;
+#endif
+#if defined( GL_PRIMITIVE_RESTART )
+		case GL_PRIMITIVE_RESTART:				return CAPABILITY_PRIMITIVE_RESTART;
+#endif
+		default:								return -1;
+	}
+}
+
+} } // namespace cinder::gl
@@ -0,0 +1,74 @@
+/*
+ Copyright (c) 2026, The Cinder Project
+
+ This code is intended to be used with the Cinder C++ library, http://libcinder.org
+
+ Redistribution and use in source and binary forms, with or without modification, are permitted provided that
+ the following conditions are met:
+
+    * Redistributions of source code must retain the above copyright notice, this list of conditions and
+	the following disclaimer.
+    * Redistributions in binary form must reproduce the above copyright notice, this list of conditions and
+	the following disclaimer in the documentation and/or other materials provided with the distribution.
+
+ THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED
+ WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A
+ PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR
+ ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+ TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+ NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ POSSIBILITY OF SUCH DAMAGE.
+*/
+
+#pragma once
+
+#include "cinder/gl/Vbo.h"
+#include "cinder/gl/Sync.h"
+
+#include <vector>
+
+namespace cinder { namespace gl {
+
+typedef std::shared_ptr<class StreamingBuffer>	StreamingBufferRef;
+
+//! A ring of buffer memory for data that is written once and drawn once, such as per-frame vertices. The ring is divided into segments, each guarded by a gl::Sync fence, so writes never stall on the GPU unless they catch up with a segment still in flight.
+//! When GL 4.4 or \c GL_ARB_buffer_storage is available the ring is persistently mapped and writes are a plain \c memcpy; otherwise writes use unsynchronized glMapBufferRange() or glBufferSubData().
+class CI_API StreamingBuffer {
+  public:
+	//! Creates a ring of \a size bytes for \a target divided into \a numSegments fenced segments. \a size is rounded up to a multiple of \a numSegments.
+	static StreamingBufferRef	create( GLenum target, GLsizeiptr size, size_t numSegments = 3 );
+	~StreamingBuffer();
+
+	//! Copies \a size bytes from \a data into the ring and returns their offset within getBuffer(), which is a multiple of \a alignment. Grows the ring if \a size exceeds a segment.
+	GLintptr			write( const void *data, GLsizeiptr size, GLsizeiptr alignment = 4 );
+
+	//! Returns the buffer backing the ring. Note that it is replaced when the ring grows.
+	const VboRef&		getBuffer() const { return mBuffer; }
+	//! Returns the size of the ring in bytes
+	GLsizeiptr			getSize() const { return mSize; }
+	//! Returns the size of each fenced segment in bytes, which is the largest single write that does not grow the ring
+	GLsizeiptr			getSegmentSize() const { return mSize / (GLsizeiptr)mNumSegments; }
+	//! Returns whether the ring is persistently mapped, as opposed to falling back to glMapBufferRange() or glBufferSubData()
+	bool				isPersistentlyMapped() const { return mMappedData != nullptr; }
+
+  protected:
+	StreamingBuffer( GLenum target, GLsizeiptr size, size_t numSegments );
+
+	void	allocate( GLsizeiptr size );
+	void	release();
+	//! Fences the segment the write head is leaving and waits for \a segment to be released by the GPU
+	void	beginSegment( size_t segment );
+
+	GLenum				mTarget;
+	VboRef				mBuffer;
+	GLsizeiptr			mSize;
+	GLintptr			mHead;
+	size_t				mNumSegments, mCurrentSegment;
+	uint8_t				*mMappedData;
+#if ! defined( CINDER_GL_ES ) || defined( CINDER_GL_ES_3 )
+	std::vector<SyncRef>	mSegmentFences;
+#endif
+};
+
+} } // namespace cinder::gl
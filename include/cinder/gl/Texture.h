@@ -505,6 +505,8 @@ class CI_API Texture2d : public TextureBase {
 		Format& swizzleMask( GLint r, GLint g, GLint b, GLint a ) { setSwizzleMask( r, g, b, a ); return *this; }
 		//! Specifies whether the Texture should store scanlines top-down in memory. Default is \c false. Also marks Texture as top-down when \c true.
 		Format& loadTopDown( bool loadTopDown = true ) { mLoadTopDown = loadTopDown; return *this; }
+		//! Returns whether the Texture stores scanlines top-down in memory
+		bool	isLoadTopDown() const { return mLoadTopDown; }
 		//! Sets whether the storage for the cannot be changed in the future (making glTexImage2D() calls illegal). More efficient when possible. Default is \c false.
 		Format& immutableStorage( bool immutable = true ) { setImmutableStorage( immutable ); return *this; }
 #if ! defined( CINDER_GL_ES )
@@ -0,0 +1,236 @@
+/*
+ Copyright (c) 2026, The Cinder Project
+
+ This code is intended to be used with the Cinder C++ library, http://libcinder.org
+
+ Redistribution and use in source and binary forms, with or without modification, are permitted provided that
+ the following conditions are met:
+
+    * Redistributions of source code must retain the above copyright notice, this list of conditions and
+	the following disclaimer.
+    * Redistributions in binary form must reproduce the above copyright notice, this list of conditions and
+	the following disclaimer in the documentation and/or other materials provided with the distribution.
+
+ THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED
+ WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A
+ PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR
+ ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+ TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+ NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ POSSIBILITY OF SUCH DAMAGE.
+*/
+
+#pragma once
+
+#include "cinder/gl/platform.h"
+
+#if ! defined( CINDER_GL_ES ) || defined( CINDER_GL_ES_3 )
+
+#include "cinder/gl/Texture.h"
+#include "cinder/gl/Sync.h"
+#include "cinder/ImageDecodeService.h"
+#include "cinder/Timer.h"
+
+#include <atomic>
+#include <condition_variable>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace cinder { namespace gl {
+
+class Context;
+class StreamingBuffer;
+typedef std::shared_ptr<Context>					ContextRef;
+typedef std::shared_ptr<class TextureStreamRequest>		TextureStreamRequestRef;
+typedef std::shared_ptr<class TextureStreamingService>	TextureStreamingServiceRef;
+
+//! Handle to a Texture queued on a TextureStreamingService, which can be used to follow its progress or cancel it.
+class CI_API TextureStreamRequest : private Noncopyable {
+  public:
+	enum State {
+		QUEUED,		//! Waiting for room in the memory budget
+		DECODING,	//! Queued on or being decoded by a decoding thread
+		UPLOADING,	//! Decoded, being uploaded by the upload thread or waiting for its fence
+		COMPLETED,	//! Its Texture is ready and its callback has been called
+		FAILED,		//! Decoding or uploading threw an exception. Its callback has been called with a null Texture
+		CANCELED	//! Canceled before its callback was called
+	};
+
+	//! Returns the current State of the request
+	State	getState() const	{ return (State)mState.load(); }
+	//! Returns the priority the request was queued with. Higher priorities are decoded and uploaded first.
+	int		getPriority() const	{ return mPriority; }
+
+	//! Cancels the request. Call from the thread that calls TextureStreamingService::update(); the callback is guaranteed not to be called after cancel() returns.
+	void	cancel();
+
+	//! Returns the Texture once the request has COMPLETED, or null
+	const Texture2dRef&	getTexture() const		{ return mTexture; }
+	//! Returns the exception thrown while decoding or uploading, or a null exception_ptr
+	std::exception_ptr	getException() const	{ return mException; }
+
+  private:
+	TextureStreamRequest( const std::function<ImageSourceRef ()> &loadFn, const std::function<void ( Texture2dRef )> &callback, const Texture2d::Format &format, int priority );
+
+	bool	setState( State expected, State desired );
+	//! Moves the request to the terminal \a state unless it has already finished or been canceled
+	bool	finish( State state );
+
+	std::function<ImageSourceRef ()>		mLoadFn;
+	std::function<void ( Texture2dRef )>	mCallback;
+	Texture2d::Format						mFormat;
+	int										mPriority;
+	std::atomic<int>						mState;
+	ImageDecodeRequestRef					mDecodeRequest;
+	Texture2dRef							mTexture;
+	std::exception_ptr						mException;
+
+	friend class TextureStreamingService;
+};
+
+//! Loads images into Textures without blocking the App's thread. Images are decoded on the threads of an ImageDecodeService and uploaded through
+//! a ring of pixel buffer memory (see StreamingBuffer) by a background thread with its own gl::Context, which shares resources with the Context
+//! the service is created on. Each Texture is fenced with a gl::Sync, and is only handed to its callback by update() once the GPU has finished the upload.
+//!
+//! Requests are decoded and uploaded in order of priority. When Options::memoryBudget() is set, requests wait in the QUEUED state while the
+//! Textures the service has published and still alive, plus the images being decoded and uploaded, exceed the budget.
+//! The service must be created, updated and destroyed on the thread of the Context it shares with, typically the App's thread.
+class CI_API TextureStreamingService : private Noncopyable {
+  public:
+	struct CI_API Options {
+		Options() : mNumDecodeThreads( 0 ), mPboRingSize( 32 * 1024 * 1024 ), mMemoryBudget( 0 ) {}
+
+		//! Sets the number of decoding threads. 0 (the default) uses the ImageDecodeService default.
+		Options& numDecodeThreads( size_t numThreads )	{ mNumDecodeThreads = numThreads; return *this; }
+		//! Sets the size in bytes of the pixel buffer ring used for uploads (\default 32MB). The ring grows to fit images larger than a third of it.
+		Options& pboRingSize( size_t size )				{ mPboRingSize = size; return *this; }
+		//! Sets the number of bytes of Texture memory that the service tries to stay under (\default 0, unlimited). Mipmapped Textures are counted with their full chain.
+		Options& memoryBudget( size_t bytes )			{ mMemoryBudget = bytes; return *this; }
+
+		size_t	getNumDecodeThreads() const		{ return mNumDecodeThreads; }
+		size_t	getPboRingSize() const			{ return mPboRingSize; }
+		size_t	getMemoryBudget() const			{ return mMemoryBudget; }
+
+	  private:
+		size_t	mNumDecodeThreads, mPboRingSize, mMemoryBudget;
+	};
+
+	//! Statistics returned by getStats(). Rates are averaged over roughly the last half second of update() calls.
+	struct Stats {
+		//! Number of requests waiting for room in the memory budget
+		size_t		mNumQueued = 0;
+		//! Number of requests queued on or being decoded by the decoding threads
+		size_t		mNumDecoding = 0;
+		//! Number of decoded requests waiting for the upload thread
+		size_t		mNumUploadQueued = 0;
+		//! Number of uploaded requests waiting for their fence
+		size_t		mNumAwaitingFence = 0;
+		//! Bytes of Textures published by the service that are still alive
+		size_t		mResidentBytes = 0;
+		//! Bytes of images being decoded or uploaded
+		size_t		mInFlightBytes = 0;
+		//! Bytes decoded per second
+		double		mDecodeBytesPerSecond = 0;
+		//! Bytes uploaded per second
+		double		mUploadBytesPerSecond = 0;
+		//! Total number of bytes uploaded
+		uint64_t	mTotalBytesUploaded = 0;
+		//! Total number of requests that completed and failed
+		size_t		mNumCompleted = 0, mNumFailed = 0;
+	};
+
+	//! Creates a service whose upload Context shares resources with the current Context. Must be called on the thread of the current Context.
+	static TextureStreamingServiceRef	create( const Options &options = Options() )	{ return TextureStreamingServiceRef( new TextureStreamingService( options ) ); }
+	//! Cancels any requests that haven't completed and waits for the decoding and upload threads to finish.
+	~TextureStreamingService();
+
+	//! Queues the image at \a path. \a callback receives the Texture, or null if loading failed, from update().
+	TextureStreamRequestRef		load( const fs::path &path, const std::function<void ( Texture2dRef )> &callback, const Texture2d::Format &format = Texture2d::Format(), int priority = 0 );
+	//! Queues the image in \a dataSource. \a callback receives the Texture, or null if loading failed, from update().
+	TextureStreamRequestRef		load( const DataSourceRef &dataSource, const std::function<void ( Texture2dRef )> &callback, const Texture2d::Format &format = Texture2d::Format(), int priority = 0 );
+
+	//! Publishes the Textures whose uploads have finished, calls their callbacks and admits queued requests within the memory budget. Call once per frame. Returns the number of callbacks called.
+	size_t	update();
+	//! Cancels all requests that haven't completed
+	void	cancelAll();
+
+	//! Returns the current Stats
+	Stats	getStats() const;
+	//! Returns the Options the service was created with
+	const Options&	getOptions() const	{ return mOptions; }
+
+  private:
+	TextureStreamingService( const Options &options );
+
+	struct DecodedImage {
+		TextureStreamRequestRef		mRequest;
+		std::vector<uint8_t>		mData;
+		int32_t						mWidth, mHeight;
+		bool						mAlpha, mFloat;
+		size_t						mTextureBytes;
+		uint64_t					mSequence;
+
+		bool operator<( const DecodedImage &rhs ) const;
+	};
+
+	struct UploadedImage {
+		TextureStreamRequestRef		mRequest;
+		Texture2dRef				mTexture;
+		SyncRef						mFence;
+		size_t						mTextureBytes;
+	};
+
+	struct ResidentTexture {
+		std::weak_ptr<Texture2d>	mTexture;
+		size_t						mBytes;
+	};
+
+	struct QueuedRequest {
+		TextureStreamRequestRef		mRequest;
+		uint64_t					mSequence;
+
+		bool operator<( const QueuedRequest &rhs ) const;
+	};
+
+	TextureStreamRequestRef		enqueue( const std::function<ImageSourceRef ()> &loadFn, const std::function<void ( Texture2dRef )> &callback, const Texture2d::Format &format, int priority );
+	void	admit();
+	void	decode( const TextureStreamRequestRef &request );
+	void	uploadThreadEntry( ContextRef context );
+	void	upload( DecodedImage &image, StreamingBuffer *ring );
+	void	fail( const TextureStreamRequestRef &request, std::exception_ptr exception, size_t inFlightBytes );
+	void	updateRates();
+
+	Options								mOptions;
+	std::unique_ptr<ImageDecodeService>	mDecoder;
+
+	// main thread only
+	std::vector<QueuedRequest>			mQueued;
+	std::vector<TextureStreamRequestRef>	mDecoding;
+	std::vector<UploadedImage>			mAwaitingFence;
+	std::vector<ResidentTexture>		mResident;
+	size_t								mResidentBytes;
+	uint64_t							mSequence;
+	size_t								mNumCompleted, mNumFailed;
+	Timer								mRateTimer;
+	uint64_t							mRateDecodedBytes, mRateUploadedBytes;
+	double								mDecodeBytesPerSecond, mUploadBytesPerSecond;
+
+	// shared with the decoding and upload threads
+	mutable std::mutex					mMutex;
+	std::condition_variable				mUploadCond;
+	std::vector<DecodedImage>			mUploadQueue;
+	std::vector<UploadedImage>			mUploaded;
+	std::vector<std::pair<TextureStreamRequestRef, size_t>>	mFailed;
+	uint64_t							mUploadSequence;
+	std::atomic<size_t>					mInFlightBytes;
+	std::atomic<uint64_t>				mDecodedBytes, mUploadedBytes;
+	bool								mQuit;
+	std::thread							mUploadThread;
+};
+
+} } // namespace cinder::gl
+
+#endif // ! defined( CINDER_GL_ES ) || defined( CINDER_GL_ES_3 )
@@ -83,6 +83,10 @@ class CI_API VboMesh {
 	static VboMeshRef	create( const geom::Source &source, const std::vector<VboMesh::Layout> &vertexArrayLayouts );
 	//! Creates a VboMesh which represents the geom::Source \a source using 1 or more Vbo/VboMesh::Layout pairs. A null VboRef requests allocation.
 	static VboMeshRef	create( const geom::Source &source, const std::vector<std::pair<VboMesh::Layout,VboRef>> &vertexArrayLayouts, const VboRef &indexVbo = nullptr );
+	//! Creates a VboMesh from a version 3 TriMesh file with one planar VBO per attribute. Unquantized data is uploaded straight from the mapping; quantized data is decoded into the mapped VBO.
+	static VboMeshRef	create( const MappedTriMesh &mesh );
+	//! Creates a VboMesh from the \a requestedAttribs of a version 3 TriMesh file with one planar VBO per attribute.
+	static VboMeshRef	create( const MappedTriMesh &mesh, const geom::AttribSet &requestedAttribs );
 	//! Creates a VboMesh which represents the user's vertex buffer objects. Allows optional \a indexVbo to enable indexed vertices; creates a static index VBO if none provided.
 	static VboMeshRef	create( uint32_t numVertices, GLenum glPrimitive, const std::vector<std::pair<geom::BufferLayout,VboRef>> &vertexArrayBuffers, uint32_t numIndices = 0, GLenum indexType = GL_UNSIGNED_SHORT, const VboRef &indexVbo = VboRef() );
 	//! Creates a VboMesh which represents the user's vertex buffer objects. Allows optional \a indexVbo to enable indexed vertices; creates a static index VBO if none provided.
@@ -27,21 +27,29 @@
 #include "cinder/gl/draw.h"
 #include "cinder/gl/scoped.h"
 
+#include "cinder/gl/AsyncReadback.h"
 #include "cinder/gl/Batch.h"
 #include "cinder/gl/BufferTexture.h"
 #include "cinder/gl/Context.h"
 #include "cinder/gl/Environment.h"
 #include "cinder/gl/Fbo.h"
 #include "cinder/gl/GlslProg.h"
+#include "cinder/gl/GlyphAtlas.h"
+#include "cinder/gl/InstanceCuller.h"
+#include "cinder/gl/MegaBatch.h"
 #include "cinder/gl/Pbo.h"
+#include "cinder/gl/Profiler.h"
+#include "cinder/gl/ProgramBinaryCache.h"
 #include "cinder/gl/Query.h"
 #include "cinder/gl/Sampler.h"
 #include "cinder/gl/Shader.h"
 #include "cinder/gl/ShaderPreprocessor.h"
 #include "cinder/gl/Ssbo.h"
+#include "cinder/gl/StreamingBuffer.h"
 #include "cinder/gl/Sync.h"
 #include "cinder/gl/Texture.h"
 #include "cinder/gl/TextureFont.h"
+#include "cinder/gl/TextureStreamingService.h"
 #include "cinder/gl/TransformFeedbackObj.h"
 #include "cinder/gl/Ubo.h"
 #include "cinder/gl/Vao.h"
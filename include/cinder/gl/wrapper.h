@@ -88,6 +88,11 @@ CI_API GlslProgRef& getStockShader( const class ShaderDef &shader );
 CI_API void bindStockShader( const class ShaderDef &shader );
 CI_API void setDefaultShaderVars();
 
+//! Batches consecutive immediate draws such as gl::drawLine() and gl::drawSolidRect() into a single draw call. Equivalent to calling gl::context()->enableStreamingDraw( \a enable ).
+CI_API void enableStreamingDraw( bool enable = true );
+//! Issues any pending batched immediate draws. Necessary before raw OpenGL calls that affect rendering while streaming draw is enabled.
+CI_API void flushStreamingDraw();
+
 CI_API void clear( const ColorA &color = ColorA::black(), bool clearDepthBuffer = true );
 	
 CI_API void clear( GLbitfield mask );
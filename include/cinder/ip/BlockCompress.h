@@ -0,0 +1,64 @@
+/*
+ Copyright (c) 2026, The Cinder Project
+
+ This code is intended to be used with the Cinder C++ library, http://libcinder.org
+
+ Redistribution and use in source and binary forms, with or without modification, are permitted provided that
+ the following conditions are met:
+
+    * Redistributions of source code must retain the above copyright notice, this list of conditions and
+	the following disclaimer.
+    * Redistributions in binary form must reproduce the above copyright notice, this list of conditions and
+	the following disclaimer in the documentation and/or other materials provided with the distribution.
+
+ THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED
+ WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A
+ PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR
+ ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+ TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+ NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ POSSIBILITY OF SUCH DAMAGE.
+*/
+
+#pragma once
+
+#include "cinder/Surface.h"
+
+// blockCompress() encodes rows of 4x4 blocks in parallel on up to ip::getMaxThreads() threads.
+
+namespace cinder { namespace ip {
+
+//! GPU block-compressed formats, each of which encodes 4x4 pixel blocks in a fixed number of bytes
+enum class BlockFormat {
+	BC1,	//!< RGB with optional 1-bit alpha in 8 bytes per block, aka DXT1
+	BC3,	//!< RGBA in 16 bytes per block: BC1 color plus BC4 alpha, aka DXT5
+	BC4,	//!< Red only in 8 bytes per block, aka RGTC1 or ATI1
+	BC5,	//!< Red and green in 16 bytes per block: two BC4 blocks, aka RGTC2 or ATI2
+	BC7		//!< RGBA in 16 bytes per block, aka BPTC
+};
+
+//! Trades encoding speed against quality for blockCompress()
+enum class BlockQuality {
+	FAST,	//!< Bounding box endpoints, no refinement
+	NORMAL,	//!< Principal axis endpoints with one least-squares refinement
+	BEST	//!< Several refinements and alternative encodings per block
+};
+
+//! Returns the number of bytes in each 4x4 block of \a format: 8 for BC1 and BC4, otherwise 16
+CI_API size_t		getBlockBytes( BlockFormat format );
+//! Returns the number of bytes needed to store a \a width x \a height image as \a format, with partial blocks at the edges rounded up
+CI_API size_t		getBlockCompressedSize( BlockFormat format, int32_t width, int32_t height );
+
+/** Encodes \a surface as \a format into \a dst, which must hold getBlockCompressedSize() bytes. Blocks are written left to right, top to bottom,
+	and partial blocks at the right and bottom edges repeat the edge pixels. BC4 encodes the red channel and BC5 the red and green channels.
+	BC1 uses its 1-bit alpha mode for blocks containing pixels whose alpha is below 128 when \a surface has alpha. BC7 uses mode 6 for every block. **/
+CI_API void			blockCompress( const Surface8u &surface, BlockFormat format, uint8_t *dst, BlockQuality quality = BlockQuality::NORMAL );
+//! Returns \a surface encoded as \a format. \see blockCompress()
+CI_API std::vector<uint8_t>	blockCompressCopy( const Surface8u &surface, BlockFormat format, BlockQuality quality = BlockQuality::NORMAL );
+
+/** Decodes \a width x \a height pixels of \a format from \a src into an RGBA Surface, following the D3D10 reference decoding.
+	BC4 decodes to ( r, 0, 0, 255 ) and BC5 to ( r, g, 0, 255 ). Only BC7's single-subset modes 4, 5 and 6 are supported; blocks in other modes decode as transparent black. **/
+CI_API Surface8u	blockDecompress( const uint8_t *src, BlockFormat format, int32_t width, int32_t height );
+
+} } // namespace cinder::ip
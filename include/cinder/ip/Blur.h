@@ -22,6 +22,8 @@
 
 #include "cinder/Surface.h"
 
+// stackBlur(), boxBlur() and gaussianBlur() process bands of rows and strips of columns in parallel on up to ip::getMaxThreads() threads.
+
 namespace cinder { namespace ip {
 
 //! Blur \a surface in-place using "stackBlur", a Gaussian-approximating algorithm by Mario Klingemann.
@@ -66,4 +68,44 @@ CI_API void			stackBlur( Channel32f *channel, const Area &area, int radius );
 //! Create a blurred copy of \a channel using "stackBlur", a Gaussian-approximating algorithm by Mario Klingemann.
 CI_API Channel32f	stackBlurCopy( const Channel32f &channel, int radius );
 
+//! Blur \a surface in-place by applying a box filter of width <tt>2 * radius + 1</tt> \a passes times, which approximates a Gaussian of standard deviation <tt>sqrt( passes * radius * (radius + 1) / 3 )</tt>. All channels including alpha are blurred, in floating point.
+template<typename T>
+CI_API void			boxBlur( SurfaceT<T> *surface, int radius, int passes = 3 );
+//! Blur \a surface in-place in \a area by applying a box filter of width <tt>2 * radius + 1</tt> \a passes times.
+template<typename T>
+CI_API void			boxBlur( SurfaceT<T> *surface, const Area &area, int radius, int passes = 3 );
+//! Create a copy of \a surface blurred by applying a box filter of width <tt>2 * radius + 1</tt> \a passes times.
+template<typename T>
+CI_API SurfaceT<T>	boxBlurCopy( const SurfaceT<T> &surface, int radius, int passes = 3 );
+
+//! Blur \a channel in-place by applying a box filter of width <tt>2 * radius + 1</tt> \a passes times, which approximates a Gaussian of standard deviation <tt>sqrt( passes * radius * (radius + 1) / 3 )</tt>.
+template<typename T>
+CI_API void			boxBlur( ChannelT<T> *channel, int radius, int passes = 3 );
+//! Blur \a channel in-place in \a area by applying a box filter of width <tt>2 * radius + 1</tt> \a passes times.
+template<typename T>
+CI_API void			boxBlur( ChannelT<T> *channel, const Area &area, int radius, int passes = 3 );
+//! Create a copy of \a channel blurred by applying a box filter of width <tt>2 * radius + 1</tt> \a passes times.
+template<typename T>
+CI_API ChannelT<T>	boxBlurCopy( const ChannelT<T> &channel, int radius, int passes = 3 );
+
+//! Blur \a surface in-place with a Gaussian of standard deviation \a sigma, truncated at <tt>3 * sigma</tt>. All channels including alpha are blurred, in floating point. Edge pixels are extended.
+template<typename T>
+CI_API void			gaussianBlur( SurfaceT<T> *surface, float sigma );
+//! Blur \a surface in-place in \a area with a Gaussian of standard deviation \a sigma. Only pixels inside \a area are sampled.
+template<typename T>
+CI_API void			gaussianBlur( SurfaceT<T> *surface, const Area &area, float sigma );
+//! Create a copy of \a surface blurred with a Gaussian of standard deviation \a sigma.
+template<typename T>
+CI_API SurfaceT<T>	gaussianBlurCopy( const SurfaceT<T> &surface, float sigma );
+
+//! Blur \a channel in-place with a Gaussian of standard deviation \a sigma, truncated at <tt>3 * sigma</tt>. Edge pixels are extended.
+template<typename T>
+CI_API void			gaussianBlur( ChannelT<T> *channel, float sigma );
+//! Blur \a channel in-place in \a area with a Gaussian of standard deviation \a sigma. Only pixels inside \a area are sampled.
+template<typename T>
+CI_API void			gaussianBlur( ChannelT<T> *channel, const Area &area, float sigma );
+//! Create a copy of \a channel blurred with a Gaussian of standard deviation \a sigma.
+template<typename T>
+CI_API ChannelT<T>	gaussianBlurCopy( const ChannelT<T> &channel, float sigma );
+
 } } // namespace cinder::ip
@@ -0,0 +1,40 @@
+/*
+ Copyright (c) 2026, The Cinder Project
+
+ This code is intended to be used with the Cinder C++ library, http://libcinder.org
+
+ Redistribution and use in source and binary forms, with or without modification, are permitted provided that
+ the following conditions are met:
+
+    * Redistributions of source code must retain the above copyright notice, this list of conditions and
+	the following disclaimer.
+    * Redistributions in binary form must reproduce the above copyright notice, this list of conditions and
+	the following disclaimer in the documentation and/or other materials provided with the distribution.
+
+ THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED
+ WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A
+ PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR
+ ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+ TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+ NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ POSSIBILITY OF SUCH DAMAGE.
+*/
+
+#pragma once
+
+#include "cinder/Cinder.h"
+
+#include <functional>
+
+namespace cinder { namespace ip {
+
+//! Sets the maximum number of threads that the ip routines which split their work into bands of rows (such as resize()) may use, including the calling thread. 0, the default, uses std::thread::hardware_concurrency(). 1 processes everything on the calling thread.
+CI_API void		setMaxThreads( size_t numThreads );
+//! Returns the maximum number of threads that ip routines may use, including the calling thread. Always at least 1. \see setMaxThreads()
+CI_API size_t	getMaxThreads();
+
+//! Calls \a fn( begin, end ) for consecutive ranges of [0, \a count) that are at most \a grainSize long, spread across up to getMaxThreads() threads. The calling thread also processes ranges and the function returns once all of them are complete. Safe to call from multiple threads and from within \a fn.
+CI_API void		parallelFor( size_t count, size_t grainSize, const std::function<void ( size_t begin, size_t end )> &fn );
+
+} } // namespace cinder::ip
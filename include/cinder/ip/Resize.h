@@ -28,6 +28,10 @@
 
 namespace cinder { namespace ip {
 
+// The resize() functions filter horizontally and then vertically, splitting the destination into bands of rows that are processed in parallel (see ip::setMaxThreads()).
+// The sampled filter weights for each combination of source size, destination size and filter are cached and reused by later calls, for filters
+// that identify themselves through FilterBase::getCacheParams().
+
 template<typename T>
 CI_API void resize( const SurfaceT<T> &srcSurface, SurfaceT<T> *dstSurface, const FilterBase &filter = FilterTriangle() );
 template<typename T>
@@ -40,4 +44,7 @@ CI_API SurfaceT<T> resizeCopy( const SurfaceT<T> &srcSurface, const Area &srcAre
 template<typename T>
 CI_API void resize( const ChannelT<T> &srcChannel, const Area &srcArea, ChannelT<T> *dstChannel, const Area &dstArea, const FilterBase &filter = FilterTriangle() );
 
+//! Releases the filter weight tables cached by resize().
+CI_API void resizeClearCache();
+
 } } // namespace cinder::ip
@@ -0,0 +1,86 @@
+/*
+ Copyright (c) 2026, The Cinder Project
+
+ This code is intended to be used with the Cinder C++ library, http://libcinder.org
+
+ Redistribution and use in source and binary forms, with or without modification, are permitted provided that
+ the following conditions are met:
+
+    * Redistributions of source code must retain the above copyright notice, this list of conditions and
+	the following disclaimer.
+    * Redistributions in binary form must reproduce the above copyright notice, this list of conditions and
+	the following disclaimer in the documentation and/or other materials provided with the distribution.
+
+ THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED
+ WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A
+ PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR
+ ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+ TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+ NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ POSSIBILITY OF SUCH DAMAGE.
+*/
+
+#pragma once
+
+#include "cinder/Surface.h"
+#include "cinder/Filter.h"
+
+#include <vector>
+
+namespace cinder { namespace ip {
+
+typedef std::shared_ptr<const class SeparableKernel>	SeparableKernelRef;
+
+//! The sampled weights of a separable filter along one axis. Destination sample \a i is the weighted sum of source samples [getStart( i ), getStart( i ) + getCount( i ) ).
+class CI_API SeparableKernel {
+  public:
+	//! Samples \a filter for resampling \a srcLength samples to \a dstLength samples, as resize() does. The filter is widened by the inverse scale when minifying, and renormalized where it overlaps the edges.
+	static SeparableKernelRef	createResample( int32_t srcLength, int32_t dstLength, const FilterBase &filter );
+	//! Creates a kernel that convolves \a length samples with \a weights, which are centered on each sample. \a weights must have an odd size and are normalized to sum to one. Weights that fall past the edges are applied to the edge sample.
+	static SeparableKernelRef	createConvolution( int32_t length, const std::vector<float> &weights );
+
+	int32_t			getSrcLength() const				{ return mSrcLength; }
+	int32_t			getDstLength() const				{ return (int32_t)mStart.size(); }
+	//! Returns the first source sample that contributes to destination sample \a i.
+	int32_t			getStart( int32_t i ) const			{ return mStart[i]; }
+	//! Returns the number of source samples that contribute to destination sample \a i.
+	int32_t			getCount( int32_t i ) const			{ return mCount[i]; }
+	//! Returns the getCount( i ) weights of destination sample \a i.
+	const float*	getWeights( int32_t i ) const		{ return &mWeights[i * mStride]; }
+	//! Returns the largest getCount() of any destination sample.
+	int32_t			getMaxCount() const					{ return mMaxCount; }
+	//! Returns the range of source samples [first, second) read by any destination sample.
+	std::pair<int32_t, int32_t>	getSrcRange() const		{ return { mMinStart, mMaxEnd }; }
+
+  private:
+	SeparableKernel( int32_t srcLength, const std::vector<int32_t> &start, const std::vector<std::vector<float>> &weights );
+
+	int32_t					mSrcLength, mMaxCount, mStride, mMinStart, mMaxEnd;
+	std::vector<int32_t>	mStart, mCount;
+	std::vector<float>		mWeights;	// mStride per destination sample, zero padded
+};
+
+//! Filters \a srcArea of \a srcSurface into \a dstArea of \a dstSurface, horizontally with \a kernelX and then vertically with \a kernelY, in floating point. The source lengths of the kernels must
+//! match the size of \a srcArea and their destination lengths the size of \a dstArea, and both areas must lie within their Surfaces. Bands of rows are processed in parallel (see ip::setMaxThreads()),
+//! so \a srcSurface and \a dstSurface must not share pixels. Surfaces with the same channel order filter all channels of a pixel at once, otherwise red, green, blue and (if both have it) alpha are filtered separately.
+template<typename T>
+CI_API void separableFilter( const SurfaceT<T> &srcSurface, const Area &srcArea, SurfaceT<T> *dstSurface, const Area &dstArea, const SeparableKernel &kernelX, const SeparableKernel &kernelY );
+//! Filters \a srcArea of \a srcChannel into \a dstArea of \a dstChannel. \see separableFilter( const SurfaceT<T>&, const Area&, SurfaceT<T>*, const Area&, const SeparableKernel&, const SeparableKernel& )
+template<typename T>
+CI_API void separableFilter( const ChannelT<T> &srcChannel, const Area &srcArea, ChannelT<T> *dstChannel, const Area &dstArea, const SeparableKernel &kernelX, const SeparableKernel &kernelY );
+
+namespace detail {
+
+//! Converts \a length samples to floats, using SIMD where available.
+CI_API void convertToFloat( const uint8_t *src, float *dst, size_t length );
+CI_API void convertToFloat( const uint16_t *src, float *dst, size_t length );
+CI_API void convertToFloat( const float *src, float *dst, size_t length );
+//! Converts \a length floats to samples, rounding to nearest and saturating for integer types, using SIMD where available.
+CI_API void convertFromFloat( const float *src, uint8_t *dst, size_t length );
+CI_API void convertFromFloat( const float *src, uint16_t *dst, size_t length );
+CI_API void convertFromFloat( const float *src, float *dst, size_t length );
+
+} // namespace detail
+
+} } // namespace cinder::ip
@@ -0,0 +1,5 @@
+if( NOT TARGET cinder )
+    include( "/root/repo/_gate_build/lib/linux/x86_64/ogl/Debug/cinderTargets.cmake" )
+endif()
+
+
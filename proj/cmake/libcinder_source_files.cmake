@@ -29,12 +29,15 @@ list( APPEND SRC_SET_CINDER
 	${CINDER_SRC_DIR}/cinder/Frustum.cpp
 	${CINDER_SRC_DIR}/cinder/GeomIo.cpp
 	${CINDER_SRC_DIR}/cinder/ImageFileTinyExr.cpp
+	${CINDER_SRC_DIR}/cinder/ImageDecodeService.cpp
 	${CINDER_SRC_DIR}/cinder/ImageIo.cpp
 	${CINDER_SRC_DIR}/cinder/ImageSourceFileRadiance.cpp
 	${CINDER_SRC_DIR}/cinder/ImageSourceFileStbImage.cpp
+	${CINDER_SRC_DIR}/cinder/ImageTargetFileBcn.cpp
 	${CINDER_SRC_DIR}/cinder/ImageTargetFileStbImage.cpp
 	${CINDER_SRC_DIR}/cinder/Json.cpp
 	${CINDER_SRC_DIR}/cinder/Log.cpp
+	${CINDER_SRC_DIR}/cinder/MappedFile.cpp
 	${CINDER_SRC_DIR}/cinder/Matrix.cpp
 	${CINDER_SRC_DIR}/cinder/MediaTime.cpp
 	${CINDER_SRC_DIR}/cinder/ObjLoader.cpp
@@ -102,9 +105,13 @@ if( NOT CINDER_DISABLE_AUDIO )
 	list( APPEND SRC_SET_CINDER_AUDIO
 		${CINDER_SRC_DIR}/cinder/audio/ChannelRouterNode.cpp
 		${CINDER_SRC_DIR}/cinder/audio/Context.cpp
+		${CINDER_SRC_DIR}/cinder/audio/ContextOffline.cpp
+		${CINDER_SRC_DIR}/cinder/audio/ConvolverNode.cpp
 		${CINDER_SRC_DIR}/cinder/audio/DelayNode.cpp
 		${CINDER_SRC_DIR}/cinder/audio/Device.cpp
+		${CINDER_SRC_DIR}/cinder/audio/FileBlockCache.cpp
 		${CINDER_SRC_DIR}/cinder/audio/FileOggVorbis.cpp
+		${CINDER_SRC_DIR}/cinder/audio/FileWav.cpp
 		${CINDER_SRC_DIR}/cinder/audio/FilterNode.cpp
 		${CINDER_SRC_DIR}/cinder/audio/GenNode.cpp
 		${CINDER_SRC_DIR}/cinder/audio/InputNode.cpp
@@ -113,6 +120,7 @@ if( NOT CINDER_DISABLE_AUDIO )
 		${CINDER_SRC_DIR}/cinder/audio/MonitorNode.cpp
 		${CINDER_SRC_DIR}/cinder/audio/OutputNode.cpp
 		${CINDER_SRC_DIR}/cinder/audio/PanNode.cpp
+		${CINDER_SRC_DIR}/cinder/audio/ParallelGraphProcessor.cpp
 		${CINDER_SRC_DIR}/cinder/audio/Param.cpp
 		${CINDER_SRC_DIR}/cinder/audio/SamplePlayerNode.cpp
 		${CINDER_SRC_DIR}/cinder/audio/SampleRecorderNode.cpp
@@ -125,8 +133,10 @@ if( NOT CINDER_DISABLE_AUDIO )
 
 	list( APPEND SRC_SET_CINDER_AUDIO_DSP
 		${CINDER_SRC_DIR}/cinder/audio/dsp/Biquad.cpp
+		${CINDER_SRC_DIR}/cinder/audio/dsp/Convolver.cpp
 		${CINDER_SRC_DIR}/cinder/audio/dsp/Converter.cpp
 		${CINDER_SRC_DIR}/cinder/audio/dsp/Dsp.cpp
+		${CINDER_SRC_DIR}/cinder/audio/dsp/DspSimd.cpp
 		${CINDER_SRC_DIR}/cinder/audio/dsp/Fft.cpp
 	)
 
@@ -142,6 +152,7 @@ endif()
 # ----------------------------------------------------------------------------------------------------------------------
 
 list( APPEND SRC_SET_CINDER_GL
+	${CINDER_SRC_DIR}/cinder/gl/AsyncReadback.cpp
 	${CINDER_SRC_DIR}/cinder/gl/Batch.cpp
 	${CINDER_SRC_DIR}/cinder/gl/BufferObj.cpp
 	${CINDER_SRC_DIR}/cinder/gl/BufferTexture.cpp
@@ -153,16 +164,23 @@ list( APPEND SRC_SET_CINDER_GL
 	${CINDER_SRC_DIR}/cinder/gl/EnvironmentEs.cpp
 	${CINDER_SRC_DIR}/cinder/gl/Fbo.cpp
 	${CINDER_SRC_DIR}/cinder/gl/GlslProg.cpp
+	${CINDER_SRC_DIR}/cinder/gl/GlyphAtlas.cpp
+	${CINDER_SRC_DIR}/cinder/gl/InstanceCuller.cpp
+	${CINDER_SRC_DIR}/cinder/gl/MegaBatch.cpp
 	${CINDER_SRC_DIR}/cinder/gl/Pbo.cpp
+	${CINDER_SRC_DIR}/cinder/gl/Profiler.cpp
+	${CINDER_SRC_DIR}/cinder/gl/ProgramBinaryCache.cpp
 	${CINDER_SRC_DIR}/cinder/gl/Query.cpp
 	${CINDER_SRC_DIR}/cinder/gl/scoped.cpp
 	${CINDER_SRC_DIR}/cinder/gl/Sampler.cpp
 	${CINDER_SRC_DIR}/cinder/gl/Shader.cpp
 	${CINDER_SRC_DIR}/cinder/gl/ShaderPreprocessor.cpp
+	${CINDER_SRC_DIR}/cinder/gl/StreamingBuffer.cpp
 	${CINDER_SRC_DIR}/cinder/gl/Sync.cpp
 	${CINDER_SRC_DIR}/cinder/gl/Texture.cpp
 	${CINDER_SRC_DIR}/cinder/gl/TextureFont.cpp
 	${CINDER_SRC_DIR}/cinder/gl/TextureFormatParsers.cpp
+	${CINDER_SRC_DIR}/cinder/gl/TextureStreamingService.cpp
 	${CINDER_SRC_DIR}/cinder/gl/TransformFeedbackObj.cpp
 	${CINDER_SRC_DIR}/cinder/gl/Ubo.cpp
 	${CINDER_SRC_DIR}/cinder/gl/Vao.cpp
@@ -184,6 +202,7 @@ source_group( "cinder\\gl" FILES    ${SRC_SET_CINDER_GL} )
 
 list( APPEND SRC_SET_CINDER_IP
 	${CINDER_SRC_DIR}/cinder/ip/Blend.cpp
+	${CINDER_SRC_DIR}/cinder/ip/BlockCompress.cpp
 	${CINDER_SRC_DIR}/cinder/ip/Blur.cpp
 	${CINDER_SRC_DIR}/cinder/ip/Checkerboard.cpp
 	${CINDER_SRC_DIR}/cinder/ip/Fill.cpp
@@ -193,7 +212,9 @@ list( APPEND SRC_SET_CINDER_IP
 	${CINDER_SRC_DIR}/cinder/ip/EdgeDetect.cpp
 	${CINDER_SRC_DIR}/cinder/ip/Flip.cpp
 	${CINDER_SRC_DIR}/cinder/ip/Hdr.cpp
+	${CINDER_SRC_DIR}/cinder/ip/Parallel.cpp
 	${CINDER_SRC_DIR}/cinder/ip/Resize.cpp
+	${CINDER_SRC_DIR}/cinder/ip/SeparableFilter.cpp
 	${CINDER_SRC_DIR}/cinder/ip/Trim.cpp
 )
 
@@ -8,6 +8,7 @@
 #include "cinder/app/KeyEvent.h"
 #include "cinder/gl/Texture.h"
 #include "cinder/gl/Context.h"
+#include "cinder/gl/Profiler.h"
 #include "cinder/Clipboard.h"
 
 #include <unordered_map>
@@ -344,6 +345,67 @@ namespace ImGui {
 	{
 		Image( (void*)(intptr_t)texture->getId(), size, uv0, uv1, tint_col, border_col );
 	}
+
+	void ProfilerWindow( const char* label, ci::gl::Profiler* profiler, bool* open )
+	{
+		if( ! profiler )
+			profiler = ci::gl::Profiler::get();
+		if( ! ImGui::Begin( label, open ) ) {
+			ImGui::End();
+			return;
+		}
+
+		const auto frameStats = profiler->getFrameStats();
+		const auto frameHistory = profiler->getFrameHistory();
+		ImGui::Text( "Frame  mean %.2f ms  p95 %.2f ms  max %.2f ms", frameStats.mMean, frameStats.mP95, frameStats.mMax );
+		if( ! frameHistory.empty() )
+			ImGui::PlotLines( "##frameHistory", frameHistory.data(), (int)frameHistory.size(), 0, nullptr, 0.0f, (float)frameStats.mMax, ImVec2( 0, 40 ) );
+
+		bool enabled = profiler->isEnabled();
+		if( ImGui::Checkbox( "Enabled", &enabled ) )
+			profiler->setEnabled( enabled );
+		ImGui::SameLine();
+		if( profiler->isCapturing() ) {
+			ImGui::Text( "Captured %d frames", (int)profiler->getNumCapturedFrames() );
+			ImGui::SameLine();
+			if( ImGui::Button( "Stop" ) )
+				profiler->stopCapture();
+		}
+		else if( ImGui::Button( "Capture" ) )
+			profiler->startCapture();
+		if( profiler->getNumStalls() > 0 )
+			ImGui::Text( "Waited for GPU times %d times", (int)profiler->getNumStalls() );
+		ImGui::Separator();
+
+		const bool gpu = profiler->isGpuTiming();
+		ImGui::Columns( 6, "##profilerScopes" );
+		for( const char* header : { "Scope", "Calls", "CPU mean", "CPU p95", "GPU mean", "GPU p95" } ) {
+			ImGui::TextUnformatted( header );
+			ImGui::NextColumn();
+		}
+		ImGui::Separator();
+		for( const auto& scope : profiler->getStats() ) {
+			ImGui::SetCursorPosX( ImGui::GetCursorPosX() + scope.mDepth * ImGui::GetStyle().IndentSpacing );
+			ImGui::TextUnformatted( scope.mName.c_str() );
+			ImGui::NextColumn();
+			ImGui::Text( "%.1f", scope.mCallsPerFrame );
+			ImGui::NextColumn();
+			ImGui::Text( "%.3f", scope.mCpu.mMean );
+			ImGui::NextColumn();
+			ImGui::Text( "%.3f", scope.mCpu.mP95 );
+			ImGui::NextColumn();
+			for( double ms : { scope.mGpu.mMean, scope.mGpu.mP95 } ) {
+				if( gpu )
+					ImGui::Text( "%.3f", ms );
+				else
+					ImGui::TextUnformatted( "-" );
+				ImGui::NextColumn();
+			}
+		}
+		ImGui::Columns( 1 );
+
+		ImGui::End();
+	}
 }
 
 
@@ -31,6 +31,7 @@
 #include "cinder/BSpline.h"
 #include "cinder/Matrix.h"
 #include "cinder/Sphere.h"
+#include "cinder/ip/Parallel.h"
 #include <algorithm>
 
 #if defined( CINDER_ANDROID )
@@ -390,17 +391,75 @@ void copyIndexDataForceTrianglesImpl( Primitive primitive, const uint32_t *sourc
 	}
 }
 
+// Grain of the parallel per-triangle and per-vertex loops below
+const size_t MESH_GRAIN_SIZE = 16384;
+
+// Sums what each triangle contributes to its three corners into the vertices they reference, or into their entries of 'remap' when that's
+// supplied. triangleFn( triangle, contributions[3] ) provides the contributions. On one thread the triangles scatter into the vertices as
+// they go. With more, the contributions are calculated in parallel and each vertex then gathers from a list of the corners that reference it,
+// so no two threads write to the same vertex. Both sum in triangle order, so the results are identical.
+template<typename T, typename FN>
+void accumulateTriangles( size_t numTriangles, const uint32_t *indices, size_t numVertices, const uint32_t *remap, T *result, const FN &triangleFn )
+{
+	const size_t numIndices = numTriangles * 3;
+	if( ip::getMaxThreads() == 1 || numTriangles <= MESH_GRAIN_SIZE ) {
+		std::fill( result, result + numVertices, T() );
+		T contributions[3];
+		for( size_t t = 0; t < numTriangles; ++t ) {
+			triangleFn( t, contributions );
+			const uint32_t *triangle = indices + t * 3;
+			if( remap ) {
+				result[remap[triangle[0]]] += contributions[0];
+				result[remap[triangle[1]]] += contributions[1];
+				result[remap[triangle[2]]] += contributions[2];
+			}
+			else {
+				result[triangle[0]] += contributions[0];
+				result[triangle[1]] += contributions[1];
+				result[triangle[2]] += contributions[2];
+			}
+		}
+		return;
+	}
+
+	vector<T> cornerContributions( numIndices );
+	ip::parallelFor( numTriangles, MESH_GRAIN_SIZE, [&]( size_t begin, size_t end ) {
+		for( size_t t = begin; t < end; ++t )
+			triangleFn( t, &cornerContributions[t * 3] );
+	} );
+
+	vector<uint32_t> offsets( numVertices + 1, 0 );
+	uint32_t *counts = offsets.data() + 1;
+	for( size_t i = 0; i < numIndices; ++i )
+		++counts[remap ? remap[indices[i]] : indices[i]];
+	for( size_t v = 1; v < numVertices; ++v )
+		counts[v] += counts[v - 1];
+
+	vector<uint32_t> corners( numIndices );
+	{
+		vector<uint32_t> cursors( offsets.begin(), offsets.end() - 1 );
+		for( size_t i = 0; i < numIndices; ++i )
+			corners[cursors[remap ? remap[indices[i]] : indices[i]]++] = (uint32_t)i;
+	}
+
+	ip::parallelFor( numVertices, MESH_GRAIN_SIZE, [&]( size_t begin, size_t end ) {
+		for( size_t v = begin; v < end; ++v ) {
+			T sum = T();
+			for( uint32_t c = offsets[v]; c < offsets[v + 1]; ++c )
+				sum += cornerContributions[corners[c]];
+			result[v] = sum;
+		}
+	} );
+}
+
 // Lengyel, Eric. "Computing Tangent Space Basis Vectors for an Arbitrary Mesh". 
 // Terathon Software 3D Graphics Library, 2001.
 // http://www.terathon.com/code/tangent.html
 template<typename TEXTYPE>
 void calculateTangentsImpl( size_t numIndices, const uint32_t *indices, size_t numVertices, const vec3 *positions, const vec3 *normals, const TEXTYPE *texCoords, vector<vec3> *resultTangents, vector<vec3> *resultBitangents )
 {
-	if( resultTangents )
-		resultTangents->assign( numVertices, vec3( 0 ) );
-
-	size_t numTriangles = numIndices / 3;
-	for( size_t i = 0; i < numTriangles; ++i ) {
+	resultTangents->resize( numVertices );
+	accumulateTriangles( numIndices / 3, indices, numVertices, nullptr, resultTangents->data(), [&]( size_t i, vec3 *contributions ) {
 		uint32_t index0 = indices[i * 3];
 		uint32_t index1 = indices[i * 3 + 1];
 		uint32_t index2 = indices[i * 3 + 2];
@@ -429,29 +488,102 @@ void calculateTangentsImpl( size_t numIndices, const uint32_t *indices, size_t n
 		if( r != 0.0f ) r = 1.0f / r;
 
 		vec3 tangent( (t2 * x1 - t1 * x2) * r, (t2 * y1 - t1 * y2) * r, (t2 * z1 - t1 * z2) * r );
+		contributions[0] = contributions[1] = contributions[2] = tangent;
+	} );
 
-		(*resultTangents)[index0] += tangent;
-		(*resultTangents)[index1] += tangent;
-		(*resultTangents)[index2] += tangent;
-	}
+	if( resultBitangents )
+		resultBitangents->resize( numVertices );
 
-	for( size_t i = 0; i < numVertices; ++i ) {
-		vec3 normal = normals[i];
-		vec3 tangent = (*resultTangents)[i];
-		(*resultTangents)[i] = ( tangent - normal * dot( normal, tangent ) );
+	ip::parallelFor( numVertices, MESH_GRAIN_SIZE, [&]( size_t begin, size_t end ) {
+		for( size_t i = begin; i < end; ++i ) {
+			vec3 normal = normals[i];
+			vec3 tangent = (*resultTangents)[i];
+			tangent = ( tangent - normal * dot( normal, tangent ) );
 
-		float len = length2( (*resultTangents)[i] );
-		if( len > 0.0f )
-			(*resultTangents)[i] /= sqrt( len );
-	}
+			float len = length2( tangent );
+			if( len > 0.0f )
+				tangent /= sqrt( len );
 
-	if( resultBitangents ) {
-		resultBitangents->reserve( numVertices );
-		for( size_t i = 0; i < numVertices; ++i )
-			resultBitangents->emplace_back( normalize( cross( normals[i], (*resultTangents)[i] ) ) );
-	}
+			(*resultTangents)[i] = tangent;
+			if( resultBitangents )
+				(*resultBitangents)[i] = normalize( cross( normal, tangent ) );
+		}
+	} );
 }
 
+uint64_t hashWeldCell( uint64_t x, uint64_t y, uint64_t z )
+{
+	uint64_t h = ( x * 0x9E3779B97F4A7C15ull ) ^ ( y * 0xC2B2AE3D27D4EB4Full ) ^ ( z * 0x165667B19E3779F9ull );
+	h ^= h >> 32;
+	h *= 0xD6E8FEB86659FD93ull;
+	return h ^ ( h >> 32 );
+}
+
+// A FIFO post-transform vertex cache: a vertex hits if it was inserted within the last 'cacheSize' misses. Hits don't refresh entries.
+class VertexCacheSim {
+  public:
+	VertexCacheSim( size_t numVertices, size_t cacheSize )
+		: mTimeStamps( numVertices, 0 ), mTime( uint32_t( cacheSize + 1 ) ), mCacheSize( uint32_t( cacheSize ) )
+	{}
+
+	//! Returns the number of misses, 0 to 3, of the triangle \a tri
+	uint32_t	triangle( const uint32_t *tri )
+	{
+		uint32_t misses = 0;
+		for( int k = 0; k < 3; ++k ) {
+			if( mTime - mTimeStamps[tri[k]] > mCacheSize ) {
+				mTimeStamps[tri[k]] = mTime++;
+				++misses;
+			}
+		}
+		return misses;
+	}
+
+	//! Empties the cache
+	void		flush() { mTime += mCacheSize + 1; }
+
+  private:
+	vector<uint32_t>	mTimeStamps;
+	uint32_t			mTime, mCacheSize;
+};
+
+// Sums of squared distances to planes, weighted by area (Garland and Heckbert 1997): Q(p) = p'Ap + 2b'p + c, with A symmetric
+struct Quadric {
+	Quadric()
+		: a00( 0 ), a11( 0 ), a22( 0 ), a01( 0 ), a12( 0 ), a02( 0 ), b0( 0 ), b1( 0 ), b2( 0 ), c( 0 ), w( 0 )
+	{}
+
+	// the plane through 'p' with unit normal 'n'
+	Quadric( const vec3 &n, const vec3 &p, float weight )
+	{
+		const float d = -dot( n, p );
+		a00 = n.x * n.x * weight; a11 = n.y * n.y * weight; a22 = n.z * n.z * weight;
+		a01 = n.x * n.y * weight; a12 = n.y * n.z * weight; a02 = n.x * n.z * weight;
+		b0 = n.x * d * weight; b1 = n.y * d * weight; b2 = n.z * d * weight;
+		c = d * d * weight;
+		w = weight;
+	}
+
+	Quadric& operator+=( const Quadric &rhs )
+	{
+		a00 += rhs.a00; a11 += rhs.a11; a22 += rhs.a22; a01 += rhs.a01; a12 += rhs.a12; a02 += rhs.a02;
+		b0 += rhs.b0; b1 += rhs.b1; b2 += rhs.b2; c += rhs.c; w += rhs.w;
+		return *this;
+	}
+
+	// the weighted mean of the squared distances from 'p' to the planes
+	float error( const vec3 &p ) const
+	{
+		const float rx = a00 * p.x + a01 * p.y + a02 * p.z + 2 * b0;
+		const float ry = a01 * p.x + a11 * p.y + a12 * p.z + 2 * b1;
+		const float rz = a02 * p.x + a12 * p.y + a22 * p.z + 2 * b2;
+		const float e = p.x * rx + p.y * ry + p.z * rz + c;
+		return ( w > 0 ) ? std::max( 0.0f, e ) / w : 0;
+	}
+
+	float	a00, a11, a22, a01, a12, a02, b0, b1, b2, c, w;
+};
+
 } // anonymous namespace
 
 void calculateTangents( size_t numIndices, const uint32_t *indices, size_t numVertices, const vec3 *positions, const vec3 *normals, const vec2 *texCoords, vector<vec3> *resultTangents, vector<vec3> *resultBitangents )
@@ -464,6 +596,669 @@ void calculateTangents( size_t numIndices, const uint32_t *indices, size_t numVe
 	calculateTangentsImpl( numIndices, indices, numVertices, positions, normals, texCoords, resultTangents, resultBitangents );
 }
 
+size_t calculateWeldRemap( size_t numVertices, const vec3 *positions, float epsilon, vector<uint32_t> *resultRemap, const function<bool ( uint32_t, uint32_t )> &equalFn )
+{
+	resultRemap->resize( numVertices );
+	if( numVertices == 0 )
+		return 0;
+
+	// Every position is hashed by the grid cell it falls in. Cells are 4 * epsilon wide, so anything within epsilon lies in the same cell or in a
+	// neighbor across a face no more than epsilon away, which for most positions means searching the one cell. An epsilon of 0 hashes the position itself.
+	const bool exact = epsilon <= 0;
+	const double invCellSize = exact ? 0 : 0.25 / epsilon;
+	const float epsilon2 = epsilon * epsilon;
+	auto cellOf = [=]( const vec3 &p ) {
+		return glm::i64vec3( glm::clamp( glm::floor( glm::dvec3( p ) * invCellSize ), -1e18, 1e18 ) );
+	};
+	auto exactHash = []( const vec3 &p ) {
+		// adding 0 turns -0 into +0 so that both hash alike
+		return hashWeldCell( glm::floatBitsToUint( p.x + 0.0f ), glm::floatBitsToUint( p.y + 0.0f ), glm::floatBitsToUint( p.z + 0.0f ) );
+	};
+
+	size_t numBuckets = 1;
+	while( numBuckets < numVertices )
+		numBuckets <<= 1;
+	const uint64_t bucketMask = numBuckets - 1;
+
+	vector<uint32_t> vertexBuckets( numVertices );
+	ip::parallelFor( numVertices, MESH_GRAIN_SIZE, [&]( size_t begin, size_t end ) {
+		for( size_t v = begin; v < end; ++v ) {
+			if( exact )
+				vertexBuckets[v] = uint32_t( exactHash( positions[v] ) & bucketMask );
+			else {
+				auto cell = cellOf( positions[v] );
+				vertexBuckets[v] = uint32_t( hashWeldCell( cell.x, cell.y, cell.z ) & bucketMask );
+			}
+		}
+	} );
+
+	// counting sort of the vertices by bucket, which keeps each bucket in ascending vertex order
+	vector<uint32_t> bucketOffsets( numBuckets + 1, 0 ), bucketVertices( numVertices );
+	for( size_t v = 0; v < numVertices; ++v )
+		++bucketOffsets[vertexBuckets[v] + 1];
+	for( size_t b = 1; b <= numBuckets; ++b )
+		bucketOffsets[b] += bucketOffsets[b - 1];
+	{
+		vector<uint32_t> cursors( bucketOffsets.begin(), bucketOffsets.end() - 1 );
+		for( size_t v = 0; v < numVertices; ++v )
+			bucketVertices[cursors[vertexBuckets[v]]++] = (uint32_t)v;
+	}
+
+	// each vertex finds the lowest-indexed vertex it matches; buckets are sorted, so the first match in a bucket is its lowest
+	uint32_t *remap = resultRemap->data();
+	ip::parallelFor( numVertices, MESH_GRAIN_SIZE, [&]( size_t begin, size_t end ) {
+		for( size_t v = begin; v < end; ++v ) {
+			const vec3 &p = positions[v];
+			uint32_t best = (uint32_t)v;
+			auto searchBucket = [&]( uint64_t bucket ) {
+				for( uint32_t e = bucketOffsets[bucket]; e < bucketOffsets[bucket + 1]; ++e ) {
+					uint32_t candidate = bucketVertices[e];
+					if( candidate >= best )
+						break;
+					bool near = exact ? ( positions[candidate] == p ) : ( length2( positions[candidate] - p ) <= epsilon2 );
+					if( near && ( ! equalFn || equalFn( candidate, (uint32_t)v ) ) ) {
+						best = candidate;
+						break;
+					}
+				}
+			};
+
+			if( exact )
+				searchBucket( vertexBuckets[v] );
+			else {
+				// neighbors are needed along axes where a face is within epsilon, a quarter of the cell, with some slack for rounding
+				auto cell = cellOf( p );
+				glm::dvec3 local = glm::dvec3( p ) * invCellSize - glm::dvec3( cell );
+				glm::i64vec3 side( local.x <= 0.2501 ? -1 : ( local.x >= 0.7499 ? 1 : 0 ), local.y <= 0.2501 ? -1 : ( local.y >= 0.7499 ? 1 : 0 ), local.z <= 0.2501 ? -1 : ( local.z >= 0.7499 ? 1 : 0 ) );
+				for( int n = 0; n < 8; ++n ) {
+					if( ( ( n & 1 ) && ! side.x ) || ( ( n & 2 ) && ! side.y ) || ( ( n & 4 ) && ! side.z ) )
+						continue;
+					glm::i64vec3 c = cell + glm::i64vec3( ( n & 1 ) ? side.x : 0, ( n & 2 ) ? side.y : 0, ( n & 4 ) ? side.z : 0 );
+					searchBucket( hashWeldCell( c.x, c.y, c.z ) & bucketMask );
+				}
+			}
+			remap[v] = best;
+		}
+	} );
+
+	// matches point to lower indices only, so one ascending pass resolves chains of matches to a single vertex
+	size_t numUnique = 0;
+	for( size_t v = 0; v < numVertices; ++v ) {
+		remap[v] = remap[remap[v]];
+		if( remap[v] == v )
+			++numUnique;
+	}
+
+	return numUnique;
+}
+
+void calculateNormals( size_t numIndices, const uint32_t *indices, size_t numVertices, const vec3 *positions, NormalWeighting weighting, vector<vec3> *resultNormals, const uint32_t *weldRemap )
+{
+	// Face normals are the cross product of two edges, whose length is twice the triangle's area. Triangles with a degenerate edge contribute nothing.
+	// Each vertex, or each remapped vertex, sums the contributions of its triangles.
+	resultNormals->resize( numVertices );
+	vec3 *result = resultNormals->data();
+	accumulateTriangles( numIndices / 3, indices, numVertices, weldRemap, result, [&]( size_t i, vec3 *contributions ) {
+		const vec3 &v0 = positions[indices[i * 3 + 0]];
+		const vec3 &v1 = positions[indices[i * 3 + 1]];
+		const vec3 &v2 = positions[indices[i * 3 + 2]];
+
+		vec3 e0 = v1 - v0;
+		vec3 e1 = v2 - v0;
+		vec3 e2 = v2 - v1;
+		float len0 = length2( e0 ), len1 = length2( e1 ), len2 = length2( e2 );
+
+		vec3 normal( 0 );
+		if( len0 >= FLT_EPSILON && len1 >= FLT_EPSILON && len2 >= FLT_EPSILON ) {
+			normal = cross( e0, e1 );
+			float normalLen = length2( normal );
+			if( weighting != NormalWeighting::AREA )
+				normal = ( normalLen > 0 ) ? normal / sqrt( normalLen ) : vec3( 0 );
+		}
+
+		if( weighting == NormalWeighting::ANGLE && normal != vec3( 0 ) ) {
+			float a0 = acos( glm::clamp( dot( e0, e1 ) / sqrt( len0 * len1 ), -1.0f, 1.0f ) );
+			float a1 = acos( glm::clamp( dot( -e0, e2 ) / sqrt( len0 * len2 ), -1.0f, 1.0f ) );
+			contributions[0] = normal * a0;
+			contributions[1] = normal * a1;
+			contributions[2] = normal * std::max( 0.0f, (float)M_PI - a0 - a1 );
+		}
+		else
+			contributions[0] = contributions[1] = contributions[2] = normal;
+	} );
+
+	ip::parallelFor( numVertices, MESH_GRAIN_SIZE, [&]( size_t begin, size_t end ) {
+		for( size_t v = begin; v < end; ++v ) {
+			float len = length2( result[v] );
+			result[v] = ( len > 0 ) ? result[v] / sqrt( len ) : vec3( 0 );
+		}
+	} );
+
+	// welded vertices share the normal summed for the vertex they remap to, which always maps to itself
+	if( weldRemap ) {
+		ip::parallelFor( numVertices, MESH_GRAIN_SIZE, [&]( size_t begin, size_t end ) {
+			for( size_t v = begin; v < end; ++v )
+				if( weldRemap[v] != v )
+					result[v] = result[weldRemap[v]];
+		} );
+	}
+}
+
+VertexCacheStats calculateVertexCacheStats( size_t numIndices, const uint32_t *indices, size_t numVertices, size_t cacheSize )
+{
+	VertexCacheStats result;
+	const size_t numTriangles = numIndices / 3;
+	if( numTriangles == 0 )
+		return result;
+
+	VertexCacheSim cache( numVertices, cacheSize );
+	vector<uint8_t> referenced( numVertices, 0 );
+	size_t misses = 0, numReferenced = 0;
+	for( size_t t = 0; t < numTriangles; ++t ) {
+		misses += cache.triangle( indices + t * 3 );
+		for( int k = 0; k < 3; ++k ) {
+			numReferenced += referenced[indices[t * 3 + k]] ? 0 : 1;
+			referenced[indices[t * 3 + k]] = 1;
+		}
+	}
+
+	result.mAcmr = misses / (float)numTriangles;
+	result.mAtvr = misses / (float)numReferenced;
+	return result;
+}
+
+void optimizeVertexCache( size_t numIndices, const uint32_t *indices, size_t numVertices, uint32_t *resultIndices, size_t cacheSize )
+{
+	// Tipsify: triangles are emitted in fans around a vertex. The next fan is the most recently cached neighbor that will still be cached
+	// once its remaining triangles are emitted, otherwise any neighbor with triangles left. At a dead end the most recently emitted vertex
+	// with triangles left is fanned, and failing that the next one in input order, which flushes the cache.
+	const size_t numTriangles = numIndices / 3;
+	if( numTriangles == 0 )
+		return;
+
+	// triangles adjacent to each vertex
+	vector<uint32_t> adjacencyOffsets( numVertices + 1, 0 ), adjacency( numTriangles * 3 );
+	for( size_t i = 0; i < numTriangles * 3; ++i )
+		++adjacencyOffsets[indices[i] + 1];
+	for( size_t v = 1; v <= numVertices; ++v )
+		adjacencyOffsets[v] += adjacencyOffsets[v - 1];
+	{
+		vector<uint32_t> cursors( adjacencyOffsets.begin(), adjacencyOffsets.end() - 1 );
+		for( size_t i = 0; i < numTriangles * 3; ++i )
+			adjacency[cursors[indices[i]]++] = uint32_t( i / 3 );
+	}
+
+	vector<uint32_t> liveTriangles( numVertices ), cacheTimeStamps( numVertices, 0 );
+	for( size_t v = 0; v < numVertices; ++v )
+		liveTriangles[v] = adjacencyOffsets[v + 1] - adjacencyOffsets[v];
+
+	vector<uint8_t> emitted( numTriangles, 0 );
+	vector<uint32_t> deadEndStack, candidates, output;
+	deadEndStack.reserve( numTriangles * 3 );
+	output.reserve( numTriangles * 3 );
+	const int64_t k = (int64_t)cacheSize;
+	int64_t timeStamp = k + 1;
+	size_t inputCursor = 0;
+
+	int64_t fanning = indices[0];
+	while( fanning >= 0 ) {
+		candidates.clear();
+		for( uint32_t a = adjacencyOffsets[fanning]; a < adjacencyOffsets[fanning + 1]; ++a ) {
+			const uint32_t t = adjacency[a];
+			if( emitted[t] )
+				continue;
+			for( int c = 0; c < 3; ++c ) {
+				const uint32_t v = indices[t * 3 + c];
+				output.push_back( v );
+				deadEndStack.push_back( v );
+				candidates.push_back( v );
+				--liveTriangles[v];
+				if( timeStamp - cacheTimeStamps[v] > k )
+					cacheTimeStamps[v] = uint32_t( timeStamp++ );
+			}
+			emitted[t] = 1;
+		}
+
+		fanning = -1;
+		int64_t bestPriority = -1;
+		for( uint32_t v : candidates ) {
+			if( liveTriangles[v] == 0 )
+				continue;
+			int64_t priority = 0;
+			if( timeStamp - cacheTimeStamps[v] + 2 * (int64_t)liveTriangles[v] <= k )
+				priority = timeStamp - cacheTimeStamps[v];
+			if( priority > bestPriority ) {
+				bestPriority = priority;
+				fanning = v;
+			}
+		}
+
+		if( fanning < 0 ) {
+			while( ! deadEndStack.empty() && fanning < 0 ) {
+				const uint32_t v = deadEndStack.back();
+				deadEndStack.pop_back();
+				if( liveTriangles[v] > 0 )
+					fanning = v;
+			}
+			while( fanning < 0 && inputCursor < numVertices ) {
+				if( liveTriangles[inputCursor] > 0 )
+					fanning = (int64_t)inputCursor;
+				else
+					++inputCursor;
+			}
+		}
+	}
+
+	std::copy( output.begin(), output.end(), resultIndices );
+}
+
+void optimizeOverdraw( size_t numIndices, const uint32_t *indices, size_t numVertices, const vec3 *positions, uint32_t *resultIndices, size_t cacheSize, float threshold )
+{
+	// Following Sander et al. 2007: the triangles are split into clusters wherever every vertex misses the cache, and further wherever the ACMR
+	// so far falls under 'threshold' times that of the whole cluster. Clusters are then drawn in order of how much they face away from the
+	// center of the mesh, which tends to draw occluders first from any viewpoint. Cluster order costs the cache little, as each starts cold.
+	const size_t numTriangles = numIndices / 3;
+	if( numTriangles == 0 )
+		return;
+
+	vector<uint32_t> hardBoundaries( 1, 0 );
+	{
+		VertexCacheSim cache( numVertices, cacheSize );
+		cache.triangle( indices );
+		for( size_t t = 1; t < numTriangles; ++t )
+			if( cache.triangle( indices + t * 3 ) == 3 )
+				hardBoundaries.push_back( uint32_t( t ) );
+	}
+	hardBoundaries.push_back( uint32_t( numTriangles ) );
+
+	vector<uint32_t> boundaries;
+	VertexCacheSim cache( numVertices, cacheSize );
+	for( size_t h = 0; h + 1 < hardBoundaries.size(); ++h ) {
+		const uint32_t begin = hardBoundaries[h], end = hardBoundaries[h + 1];
+		size_t clusterMisses = 0;
+		cache.flush();
+		for( uint32_t t = begin; t < end; ++t )
+			clusterMisses += cache.triangle( indices + t * 3 );
+		const float clusterThreshold = threshold * clusterMisses / float( end - begin );
+
+		boundaries.push_back( begin );
+		cache.flush();
+		size_t runningMisses = 0;
+		uint32_t runningBegin = begin;
+		for( uint32_t t = begin; t < end; ++t ) {
+			runningMisses += cache.triangle( indices + t * 3 );
+			if( t + 1 < end && runningMisses <= clusterThreshold * ( t + 1 - runningBegin ) ) {
+				boundaries.push_back( t + 1 );
+				runningBegin = t + 1;
+				runningMisses = 0;
+				cache.flush();
+			}
+		}
+	}
+	boundaries.push_back( uint32_t( numTriangles ) );
+	const size_t numClusters = boundaries.size() - 1;
+
+	// area weighted centroids and normals; twice the area throughout, which cancels out
+	vector<vec3> clusterCentroids( numClusters ), clusterNormals( numClusters );
+	vec3 meshCentroid( 0 );
+	float meshArea = 0;
+	for( size_t c = 0; c < numClusters; ++c ) {
+		vec3 centroid( 0 ), normal( 0 );
+		float area = 0;
+		for( uint32_t t = boundaries[c]; t < boundaries[c + 1]; ++t ) {
+			const vec3 &v0 = positions[indices[t * 3 + 0]];
+			const vec3 &v1 = positions[indices[t * 3 + 1]];
+			const vec3 &v2 = positions[indices[t * 3 + 2]];
+			const vec3 n = cross( v1 - v0, v2 - v0 );
+			const float a = length( n );
+			centroid += ( v0 + v1 + v2 ) * ( a / 3 );
+			normal += n;
+			area += a;
+		}
+		meshCentroid += centroid;
+		meshArea += area;
+		clusterCentroids[c] = ( area > 0 ) ? centroid / area : vec3( 0 );
+		const float normalLen = length( normal );
+		clusterNormals[c] = ( normalLen > 0 ) ? normal / normalLen : vec3( 0 );
+	}
+	if( meshArea > 0 )
+		meshCentroid /= meshArea;
+
+	vector<pair<float,uint32_t>> sortKeys( numClusters );
+	for( size_t c = 0; c < numClusters; ++c )
+		sortKeys[c] = make_pair( -dot( clusterCentroids[c] - meshCentroid, clusterNormals[c] ), uint32_t( c ) );
+	std::stable_sort( sortKeys.begin(), sortKeys.end(), []( const pair<float,uint32_t> &a, const pair<float,uint32_t> &b ) { return a.first < b.first; } );
+
+	vector<uint32_t> output;
+	output.reserve( numTriangles * 3 );
+	for( const auto &key : sortKeys )
+		output.insert( output.end(), indices + boundaries[key.second] * 3, indices + boundaries[key.second + 1] * 3 );
+	std::copy( output.begin(), output.end(), resultIndices );
+}
+
+void calculateVertexFetchRemap( size_t numIndices, const uint32_t *indices, size_t numVertices, vector<uint32_t> *resultRemap )
+{
+	resultRemap->assign( numVertices, std::numeric_limits<uint32_t>::max() );
+	uint32_t next = 0;
+	for( size_t i = 0; i < numIndices; ++i )
+		if( (*resultRemap)[indices[i]] == std::numeric_limits<uint32_t>::max() )
+			(*resultRemap)[indices[i]] = next++;
+	for( size_t v = 0; v < numVertices; ++v )
+		if( (*resultRemap)[v] == std::numeric_limits<uint32_t>::max() )
+			(*resultRemap)[v] = next++;
+}
+
+size_t simplify( size_t numIndices, const uint32_t *indices, size_t numVertices, const vec3 *positions, size_t targetNumIndices, float targetError, uint32_t *resultIndices, float *resultError )
+{
+	// Half-edge collapses: a vertex moves onto a neighbor and its triangles follow, which removes the triangles of the edge. Each pass evaluates the
+	// cheaper valid direction of every edge in parallel, then performs collapses in order of error, skipping those whose neighborhood changed earlier
+	// in the pass, until the target is met. Results don't depend on the number of threads.
+
+	// positions scaled so that the largest extent is 1, which makes errors relative and keeps the quadrics well conditioned in float
+	vec3 boundsMin( std::numeric_limits<float>::max() ), boundsMax( -std::numeric_limits<float>::max() );
+	for( size_t i = 0; i < numIndices; ++i ) {
+		boundsMin = glm::min( boundsMin, positions[indices[i]] );
+		boundsMax = glm::max( boundsMax, positions[indices[i]] );
+	}
+	const vec3 extents = boundsMax - boundsMin;
+	const float maxExtent = std::max( extents.x, std::max( extents.y, extents.z ) );
+
+	// Vertices that share a position are one vertex to the simplifier, which collapses all of them at once; they differ in other attributes along seams.
+	// Positions within rounding of one another count as shared, such as the poles of a geom::Sphere.
+	vector<uint32_t> positionOf;
+	calculateWeldRemap( numVertices, positions, maxExtent * 1e-6f, &positionOf );
+	const float scale = ( maxExtent > 0 ) ? 1 / maxExtent : 1;
+	vector<vec3> normalized( numVertices );
+	ip::parallelFor( numVertices, MESH_GRAIN_SIZE, [&]( size_t begin, size_t end ) {
+		for( size_t v = begin; v < end; ++v )
+			normalized[v] = ( positions[v] - boundsMin ) * scale;
+	} );
+
+	auto isDegenerate = [&]( const uint32_t *tri ) {
+		return positionOf[tri[0]] == positionOf[tri[1]] || positionOf[tri[1]] == positionOf[tri[2]] || positionOf[tri[2]] == positionOf[tri[0]];
+	};
+	vector<uint32_t> triangles;
+	triangles.reserve( numIndices - numIndices % 3 );
+	for( size_t i = 0; i + 2 < numIndices; i += 3 )
+		if( ! isDegenerate( indices + i ) )
+			triangles.insert( triangles.end(), indices + i, indices + i + 3 );
+
+	vector<Quadric> quadrics( numVertices );
+	accumulateTriangles( triangles.size() / 3, triangles.data(), numVertices, positionOf.data(), quadrics.data(), [&]( size_t t, Quadric *contributions ) {
+		const vec3 &p0 = normalized[triangles[t * 3 + 0]];
+		const vec3 n = cross( normalized[triangles[t * 3 + 1]] - p0, normalized[triangles[t * 3 + 2]] - p0 );
+		const float len = length( n );
+		contributions[0] = contributions[1] = contributions[2] = ( len > 0 ) ? Quadric( n / len, p0, len * 0.5f ) : Quadric();
+	} );
+
+	// the triangles around each position
+	vector<uint32_t> adjacencyOffsets( numVertices + 1 ), adjacency;
+	auto buildAdjacency = [&] {
+		std::fill( adjacencyOffsets.begin(), adjacencyOffsets.end(), 0 );
+		for( uint32_t index : triangles )
+			++adjacencyOffsets[positionOf[index] + 1];
+		for( size_t v = 1; v <= numVertices; ++v )
+			adjacencyOffsets[v] += adjacencyOffsets[v - 1];
+		adjacency.resize( triangles.size() );
+		vector<uint32_t> cursors( adjacencyOffsets.begin(), adjacencyOffsets.end() - 1 );
+		for( size_t i = 0; i < triangles.size(); ++i )
+			adjacency[cursors[positionOf[triangles[i]]]++] = uint32_t( i / 3 );
+	};
+	auto cornerAt = [&]( uint32_t t, uint32_t position ) {
+		for( int k = 0; k < 3; ++k )
+			if( positionOf[triangles[t * 3 + k]] == position )
+				return k;
+		return -1;
+	};
+
+	// positions on a border or a non-manifold edge never move, so borders are kept exactly
+	buildAdjacency();
+	vector<uint8_t> locked( numVertices, 0 );
+	ip::parallelFor( numVertices, MESH_GRAIN_SIZE, [&]( size_t begin, size_t end ) {
+		for( size_t p = begin; p < end; ++p ) {
+			for( uint32_t a = adjacencyOffsets[p]; a < adjacencyOffsets[p + 1] && ! locked[p]; ++a ) {
+				for( int k = 0; k < 3; ++k ) {
+					const uint32_t q = positionOf[triangles[adjacency[a] * 3 + k]];
+					if( q == p )
+						continue;
+					int numShared = 0;
+					for( uint32_t b = adjacencyOffsets[p]; b < adjacencyOffsets[p + 1]; ++b )
+						numShared += ( cornerAt( adjacency[b], q ) >= 0 ) ? 1 : 0;
+					if( numShared != 2 )
+						locked[p] = 1;
+				}
+			}
+		}
+	} );
+
+	// Whether 'from' can collapse onto 'to' without flipping a triangle or joining surfaces, and with every attribute wedge of 'from' paired with
+	// a wedge of 'to' across the edge. Where 'to' has several wedges across the edge, as at the pole of a sphere, the first is taken.
+	// 'numRemoved' receives the number of triangles on the edge.
+	auto isValidCollapse = [&]( uint32_t from, uint32_t to, uint32_t *numRemoved, vector<uint32_t> *fromNeighbors, vector<uint32_t> *toNeighbors ) {
+		const size_t MAX_WEDGES = 8;
+		uint32_t wedges[MAX_WEDGES][2];
+		size_t numWedges = 0;
+		auto findWedge = [&]( uint32_t wedge ) {
+			for( size_t w = 0; w < numWedges; ++w )
+				if( wedges[w][0] == wedge )
+					return int( w );
+			return -1;
+		};
+
+		*numRemoved = 0;
+		for( uint32_t a = adjacencyOffsets[from]; a < adjacencyOffsets[from + 1]; ++a ) {
+			const uint32_t t = adjacency[a];
+			const int fromCorner = cornerAt( t, from ), toCorner = cornerAt( t, to );
+			if( toCorner < 0 )
+				continue;
+			++*numRemoved;
+			const uint32_t fromWedge = triangles[t * 3 + fromCorner], toWedge = triangles[t * 3 + toCorner];
+			if( findWedge( fromWedge ) < 0 ) {
+				if( numWedges == MAX_WEDGES )
+					return false;
+				wedges[numWedges][0] = fromWedge;
+				wedges[numWedges++][1] = toWedge;
+			}
+		}
+		if( *numRemoved == 0 )
+			return false;
+
+		fromNeighbors->clear();
+		for( uint32_t a = adjacencyOffsets[from]; a < adjacencyOffsets[from + 1]; ++a ) {
+			const uint32_t t = adjacency[a];
+			const int fromCorner = cornerAt( t, from );
+			for( int k = 0; k < 3; ++k )
+				if( k != fromCorner && positionOf[triangles[t * 3 + k]] != to )
+					fromNeighbors->push_back( positionOf[triangles[t * 3 + k]] );
+			if( cornerAt( t, to ) >= 0 )
+				continue;
+
+			if( findWedge( triangles[t * 3 + fromCorner] ) < 0 )
+				return false;
+
+			vec3 corners[3] = { normalized[triangles[t * 3]], normalized[triangles[t * 3 + 1]], normalized[triangles[t * 3 + 2]] };
+			const vec3 before = cross( corners[1] - corners[0], corners[2] - corners[0] );
+			corners[fromCorner] = normalized[to];
+			const vec3 after = cross( corners[1] - corners[0], corners[2] - corners[0] );
+			if( dot( before, after ) <= 0 )
+				return false;
+			// nor may it become a sliver, which rounding could otherwise let through with either orientation
+			const float longest = std::max( { length2( corners[1] - corners[0] ), length2( corners[2] - corners[0] ), length2( corners[2] - corners[1] ) } );
+			if( length2( after ) <= 1e-10f * longest * longest )
+				return false;
+		}
+
+		// the link condition: the only neighbors shared by both ends are those opposite the edge
+		toNeighbors->clear();
+		for( uint32_t a = adjacencyOffsets[to]; a < adjacencyOffsets[to + 1]; ++a )
+			for( int k = 0; k < 3; ++k )
+				toNeighbors->push_back( positionOf[triangles[adjacency[a] * 3 + k]] );
+		uint32_t numShared = 0;
+		if( fromNeighbors->size() * toNeighbors->size() <= 1024 ) {
+			// typical valences, where scanning beats sorting
+			for( auto f = fromNeighbors->begin(); f != fromNeighbors->end(); ++f )
+				if( std::find( fromNeighbors->begin(), f, *f ) == f && std::find( toNeighbors->begin(), toNeighbors->end(), *f ) != toNeighbors->end() )
+					++numShared;
+		}
+		else {
+			std::sort( fromNeighbors->begin(), fromNeighbors->end() );
+			fromNeighbors->erase( std::unique( fromNeighbors->begin(), fromNeighbors->end() ), fromNeighbors->end() );
+			std::sort( toNeighbors->begin(), toNeighbors->end() );
+			numShared = (uint32_t)std::count_if( fromNeighbors->begin(), fromNeighbors->end(), [&]( uint32_t n ) {
+				return std::binary_search( toNeighbors->begin(), toNeighbors->end(), n );
+			} );
+		}
+
+		return numShared <= *numRemoved;
+	};
+
+	struct Collapse {
+		float		mError;
+		uint32_t	mFrom, mTo, mNumRemoved;
+	};
+
+	const float errorLimit = targetError * targetError;
+	const size_t targetNumTriangles = targetNumIndices / 3;
+	float maxError = 0;
+	size_t considerShift = 0;
+	vector<Collapse> candidates, collapses, batch, chosen;
+	vector<uint8_t> changed( numVertices );
+	vector<uint32_t> wedgeTargets( numVertices );
+	for( size_t v = 0; v < numVertices; ++v )
+		wedgeTargets[v] = (uint32_t)v;
+
+	while( triangles.size() / 3 > targetNumTriangles ) {
+		const size_t numTriangles = triangles.size() / 3;
+		buildAdjacency();
+
+		// Interior edges are traversed once in each direction, so each is considered from the triangle that traverses it with ascending positions,
+		// in its cheaper direction. Border edges only connect locked positions.
+		candidates.resize( numTriangles * 3 );
+		ip::parallelFor( numTriangles, MESH_GRAIN_SIZE, [&]( size_t begin, size_t end ) {
+			for( size_t i = begin * 3; i < end * 3; ++i ) {
+				Collapse &candidate = candidates[i];
+				candidate.mFrom = candidate.mTo = 0;
+				const uint32_t a = positionOf[triangles[i]], b = positionOf[triangles[( i % 3 == 2 ) ? i - 2 : i + 1]];
+				if( a > b || ( locked[a] && locked[b] ) )
+					continue;
+
+				const float errorAB = locked[a] ? std::numeric_limits<float>::max() : quadrics[a].error( normalized[b] );
+				const float errorBA = locked[b] ? std::numeric_limits<float>::max() : quadrics[b].error( normalized[a] );
+				candidate.mError = std::min( errorAB, errorBA );
+				candidate.mFrom = ( errorAB <= errorBA ) ? a : b;
+				candidate.mTo = ( errorAB <= errorBA ) ? b : a;
+			}
+		} );
+
+		collapses.clear();
+		for( const auto &candidate : candidates )
+			if( candidate.mFrom != candidate.mTo && candidate.mError <= errorLimit )
+				collapses.push_back( candidate );
+
+		// only the cheapest collapses are considered; each removes two triangles, so there are twice as many as the pass needs, as many are passed over for overlapping one another
+		auto cheaper = []( const Collapse &a, const Collapse &b ) {
+			return std::tie( a.mError, a.mFrom, a.mTo ) < std::tie( b.mError, b.mFrom, b.mTo );
+		};
+		const size_t numToRemove = numTriangles - targetNumTriangles;
+		const size_t numCandidates = collapses.size();
+		const size_t numToConsider = std::min( numCandidates, std::max<size_t>( numToRemove, 1024 ) << considerShift );
+		if( numToConsider < numCandidates ) {
+			std::nth_element( collapses.begin(), collapses.begin() + numToConsider, collapses.end(), cheaper );
+			collapses.resize( numToConsider );
+		}
+		std::sort( collapses.begin(), collapses.end(), cheaper );
+
+		// Collapses are validated in parallel, in batches in order of error, against the mesh as it was at the start of the pass. A collapse changes
+		// the triangles around 'from', so neither end nor any neighbor of 'from' takes part in another this pass; that also keeps the mesh around
+		// every later collapse whose ends are unchanged as it was validated. An edge that can't collapse in its cheaper direction may in the other.
+		auto validate = [&]( vector<Collapse> *list ) {
+			ip::parallelFor( list->size(), MESH_GRAIN_SIZE / 16, [&]( size_t begin, size_t end ) {
+				vector<uint32_t> fromNeighbors, toNeighbors;
+				for( size_t c = begin; c < end; ++c ) {
+					Collapse &collapse = (*list)[c];
+					if( isValidCollapse( collapse.mFrom, collapse.mTo, &collapse.mNumRemoved, &fromNeighbors, &toNeighbors ) )
+						continue;
+					const float reverseError = locked[collapse.mTo] ? std::numeric_limits<float>::max() : quadrics[collapse.mTo].error( normalized[collapse.mFrom] );
+					if( reverseError <= errorLimit && isValidCollapse( collapse.mTo, collapse.mFrom, &collapse.mNumRemoved, &fromNeighbors, &toNeighbors ) ) {
+						std::swap( collapse.mFrom, collapse.mTo );
+						collapse.mError = reverseError;
+					}
+					else
+						collapse.mNumRemoved = 0;
+				}
+			} );
+		};
+
+		// Validity doesn't depend on how the list is batched, so batches only need to be large enough to keep every thread busy; larger ones
+		// validate more collapses that an earlier one in the batch then overlaps.
+		const size_t batchSize = ip::getMaxThreads() * 256;
+		std::fill( changed.begin(), changed.end(), 0 );
+		chosen.clear();
+		size_t numRemoved = 0;
+		for( size_t next = 0; next < collapses.size() && numRemoved < numToRemove; ) {
+			batch.clear();
+			for( ; next < collapses.size() && batch.size() < batchSize; ++next )
+				if( ! changed[collapses[next].mFrom] && ! changed[collapses[next].mTo] )
+					batch.push_back( collapses[next] );
+			validate( &batch );
+
+			for( const auto &collapse : batch ) {
+				if( numRemoved >= numToRemove )
+					break;
+				const uint32_t from = collapse.mFrom, to = collapse.mTo;
+				if( collapse.mNumRemoved == 0 || changed[from] || changed[to] )
+					continue;
+
+				for( uint32_t a = adjacencyOffsets[from]; a < adjacencyOffsets[from + 1]; ++a )
+					for( int k = 0; k < 3; ++k )
+						changed[positionOf[triangles[adjacency[a] * 3 + k]]] = 1;
+				changed[to] = 1;
+				chosen.push_back( collapse );
+				numRemoved += collapse.mNumRemoved;
+			}
+		}
+
+		for( const auto &collapse : chosen ) {
+			for( uint32_t a = adjacencyOffsets[collapse.mFrom]; a < adjacencyOffsets[collapse.mFrom + 1]; ++a ) {
+				const uint32_t t = adjacency[a];
+				const int toCorner = cornerAt( t, collapse.mTo );
+				if( toCorner >= 0 )
+					wedgeTargets[triangles[t * 3 + cornerAt( t, collapse.mFrom )]] = triangles[t * 3 + toCorner];
+			}
+			quadrics[collapse.mTo] += quadrics[collapse.mFrom];
+			maxError = std::max( maxError, collapse.mError );
+		}
+
+		// when none of the collapses considered were valid, the next pass looks further
+		if( chosen.empty() ) {
+			if( numToConsider == numCandidates )
+				break;
+			++considerShift;
+			continue;
+		}
+		considerShift = 0;
+
+		ip::parallelFor( triangles.size(), MESH_GRAIN_SIZE, [&]( size_t begin, size_t end ) {
+			for( size_t i = begin; i < end; ++i )
+				triangles[i] = wedgeTargets[triangles[i]];
+		} );
+		size_t numKept = 0;
+		for( size_t i = 0; i < triangles.size(); i += 3 ) {
+			if( ! isDegenerate( &triangles[i] ) ) {
+				std::copy( triangles.begin() + i, triangles.begin() + i + 3, triangles.begin() + numKept );
+				numKept += 3;
+			}
+		}
+		triangles.resize( numKept );
+	}
+
+	std::copy( triangles.begin(), triangles.end(), resultIndices );
+	if( resultError )
+		*resultError = sqrt( maxError );
+
+	return triangles.size();
+}
+
 ///////////////////////////////////////////////////////////////////////////////////////
 // Target
 void Target::copyIndexDataForceTriangles( Primitive primitive, const uint32_t *source, size_t numIndices, uint32_t indexOffset, uint32_t *target )
@@ -4396,7 +5191,7 @@ void Tangents::process( SourceModsContext *ctx, const AttribSet &requestedAttrib
 		if( requestedAttribs.count( geom::TANGENT ) )
 			ctx->copyAttrib( Attrib::TANGENT, 3, 0, (const float*)tangents.data(), numVertices );
 		if( bitangentPtr )
-			ctx->copyAttrib( Attrib::BITANGENT, 3, 0, (const float*)bitangentPtr, numVertices );
+			ctx->copyAttrib( Attrib::BITANGENT, 3, 0, (const float*)bitangentPtr->data(), numVertices );
 	}
 }
 
@@ -4621,6 +5416,226 @@ void Subdivide::process( SourceModsContext *ctx, const AttribSet &requestedAttri
 	ctx->copyIndices( ctx->getPrimitive(), outIndices.data(), outIndices.size(), 4 );
 }
 
+//////////////////////////////////////////////////////////////////////////////////////
+// Weld
+size_t Weld::getNumIndices( const Modifier::Params &upstreamParams ) const
+{
+	// non-indexed triangles become indexed
+	if( ( upstreamParams.getPrimitive() == Primitive::TRIANGLES ) && ( upstreamParams.getNumIndices() == 0 ) )
+		return upstreamParams.getNumVertices();
+	else
+		return upstreamParams.getNumIndices();
+}
+
+void Weld::process( SourceModsContext *ctx, const AttribSet &requestedAttribs ) const
+{
+	AttribSet request = requestedAttribs;
+	request.insert( POSITION );
+	ctx->processUpstream( request );
+
+	if( ctx->getPrimitive() != Primitive::TRIANGLES ) {
+		CI_LOG_E( "geom::Weld only supports TRIANGLES primitive." );
+		return;
+	}
+
+	if( ctx->getAttribDims( POSITION ) != 3 ) {
+		CI_LOG_E( "geom::Weld requires 3D POSITION." );
+		return;
+	}
+
+	const size_t numInVertices = ctx->getNumVertices();
+	const AttribSet attribs = ctx->getAvailableAttribs();
+
+	function<bool ( uint32_t, uint32_t )> equalFn;
+	if( ! mPositionsOnly ) {
+		vector<pair<const float*,uint8_t>> otherAttribs;
+		for( const auto &attr : attribs )
+			if( attr != POSITION )
+				otherAttribs.emplace_back( ctx->getAttribData( attr ), ctx->getAttribDims( attr ) );
+
+		const float epsilon = mEpsilon;
+		equalFn = [otherAttribs, epsilon]( uint32_t a, uint32_t b ) {
+			for( const auto &attrib : otherAttribs ) {
+				const float *dataA = attrib.first + a * attrib.second;
+				const float *dataB = attrib.first + b * attrib.second;
+				for( uint8_t dim = 0; dim < attrib.second; ++dim )
+					if( std::abs( dataA[dim] - dataB[dim] ) > epsilon )
+						return false;
+			}
+			return true;
+		};
+	}
+
+	vector<uint32_t> remap;
+	const size_t numOutVertices = calculateWeldRemap( numInVertices, reinterpret_cast<const vec3*>( ctx->getAttribData( POSITION ) ), mEpsilon, &remap, equalFn );
+
+	// surviving vertices keep their relative order
+	vector<uint32_t> outVertexIndices( numInVertices );
+	uint32_t numOut = 0;
+	for( size_t v = 0; v < numInVertices; ++v )
+		outVertexIndices[v] = ( remap[v] == v ) ? numOut++ : outVertexIndices[remap[v]];
+
+	vector<uint32_t> outIndices;
+	if( ctx->getNumIndices() ) {
+		const uint32_t *inIndices = ctx->getIndicesData();
+		outIndices.resize( ctx->getNumIndices() );
+		for( size_t i = 0; i < outIndices.size(); ++i )
+			outIndices[i] = outVertexIndices[inIndices[i]];
+	}
+	else
+		outIndices = outVertexIndices;
+
+	for( const auto &attr : attribs ) {
+		const uint8_t dims = ctx->getAttribDims( attr );
+		const float *inData = ctx->getAttribData( attr );
+		vector<float> outData( numOutVertices * dims );
+		for( size_t v = 0; v < numInVertices; ++v )
+			if( remap[v] == v )
+				std::copy( inData + v * dims, inData + ( v + 1 ) * dims, outData.data() + outVertexIndices[v] * dims );
+
+		ctx->copyAttrib( attr, dims, 0, outData.data(), numOutVertices );
+	}
+
+	ctx->copyIndices( Primitive::TRIANGLES, outIndices.data(), outIndices.size(), 4 );
+}
+
+//////////////////////////////////////////////////////////////////////////////////////
+// Optimize
+size_t Optimize::getNumIndices( const Modifier::Params &upstreamParams ) const
+{
+	// non-indexed triangles become indexed
+	if( ( upstreamParams.getPrimitive() == Primitive::TRIANGLES ) && ( upstreamParams.getNumIndices() == 0 ) )
+		return upstreamParams.getNumVertices();
+	else
+		return upstreamParams.getNumIndices();
+}
+
+void Optimize::process( SourceModsContext *ctx, const AttribSet &requestedAttribs ) const
+{
+	AttribSet request = requestedAttribs;
+	if( mOverdraw )
+		request.insert( POSITION );
+	ctx->processUpstream( request );
+
+	if( ctx->getPrimitive() != Primitive::TRIANGLES ) {
+		CI_LOG_E( "geom::Optimize only supports TRIANGLES primitive." );
+		return;
+	}
+
+	const size_t numVertices = ctx->getNumVertices();
+	vector<uint32_t> indices;
+	if( ctx->getNumIndices() )
+		indices.assign( ctx->getIndicesData(), ctx->getIndicesData() + ctx->getNumIndices() );
+	else {
+		indices.resize( numVertices );
+		for( size_t v = 0; v < numVertices; ++v )
+			indices[v] = (uint32_t)v;
+	}
+	indices.resize( indices.size() - indices.size() % 3 );
+
+	if( mStatsBefore )
+		*mStatsBefore = calculateVertexCacheStats( indices.size(), indices.data(), numVertices, mCacheSize );
+
+	optimizeVertexCache( indices.size(), indices.data(), numVertices, indices.data(), mCacheSize );
+	if( mOverdraw ) {
+		if( ctx->getAttribDims( POSITION ) == 3 )
+			optimizeOverdraw( indices.size(), indices.data(), numVertices, reinterpret_cast<const vec3*>( ctx->getAttribData( POSITION ) ), indices.data(), mCacheSize, mOverdrawThreshold );
+		else
+			CI_LOG_E( "geom::Optimize requires 3D POSITION for overdraw optimization." );
+	}
+
+	if( mVertexFetch ) {
+		vector<uint32_t> remap;
+		calculateVertexFetchRemap( indices.size(), indices.data(), numVertices, &remap );
+		for( auto &index : indices )
+			index = remap[index];
+
+		for( const auto &attr : ctx->getAvailableAttribs() ) {
+			const uint8_t dims = ctx->getAttribDims( attr );
+			const float *inData = ctx->getAttribData( attr );
+			vector<float> outData( numVertices * dims );
+			for( size_t v = 0; v < numVertices; ++v )
+				std::copy( inData + v * dims, inData + ( v + 1 ) * dims, outData.data() + remap[v] * dims );
+
+			ctx->copyAttrib( attr, dims, 0, outData.data(), numVertices );
+		}
+	}
+
+	if( mStatsAfter )
+		*mStatsAfter = calculateVertexCacheStats( indices.size(), indices.data(), numVertices, mCacheSize );
+
+	ctx->copyIndices( Primitive::TRIANGLES, indices.data(), indices.size(), 4 );
+}
+
+//////////////////////////////////////////////////////////////////////////////////////
+// Simplify
+size_t Simplify::getNumIndices( const Modifier::Params &upstreamParams ) const
+{
+	// at most as many as upstream; non-indexed triangles become indexed
+	if( ( upstreamParams.getPrimitive() == Primitive::TRIANGLES ) && ( upstreamParams.getNumIndices() == 0 ) )
+		return upstreamParams.getNumVertices();
+	else
+		return upstreamParams.getNumIndices();
+}
+
+void Simplify::process( SourceModsContext *ctx, const AttribSet &requestedAttribs ) const
+{
+	AttribSet request = requestedAttribs;
+	request.insert( POSITION );
+	ctx->processUpstream( request );
+
+	if( ctx->getPrimitive() != Primitive::TRIANGLES ) {
+		CI_LOG_E( "geom::Simplify only supports TRIANGLES primitive." );
+		return;
+	}
+
+	if( ctx->getAttribDims( POSITION ) != 3 ) {
+		CI_LOG_E( "geom::Simplify requires 3D POSITION." );
+		return;
+	}
+
+	const size_t numInVertices = ctx->getNumVertices();
+	vector<uint32_t> indices;
+	if( ctx->getNumIndices() )
+		indices.assign( ctx->getIndicesData(), ctx->getIndicesData() + ctx->getNumIndices() );
+	else {
+		indices.resize( numInVertices );
+		for( size_t v = 0; v < numInVertices; ++v )
+			indices[v] = (uint32_t)v;
+	}
+
+	const size_t targetNumTriangles = mTargetTriangles ? mTargetTriangles : size_t( indices.size() / 3 * std::max( 0.0f, mTargetRatio ) );
+	float error;
+	indices.resize( simplify( indices.size(), indices.data(), numInVertices, reinterpret_cast<const vec3*>( ctx->getAttribData( POSITION ) ), targetNumTriangles * 3, mTargetError, indices.data(), &error ) );
+	if( mResultError )
+		*mResultError = error;
+
+	// referenced vertices keep their relative order
+	const uint32_t UNREFERENCED = std::numeric_limits<uint32_t>::max();
+	vector<uint32_t> outVertexIndices( numInVertices, UNREFERENCED );
+	for( uint32_t index : indices )
+		outVertexIndices[index] = 0;
+	uint32_t numOutVertices = 0;
+	for( auto &outIndex : outVertexIndices )
+		if( outIndex != UNREFERENCED )
+			outIndex = numOutVertices++;
+	for( auto &index : indices )
+		index = outVertexIndices[index];
+
+	for( const auto &attr : ctx->getAvailableAttribs() ) {
+		const uint8_t dims = ctx->getAttribDims( attr );
+		const float *inData = ctx->getAttribData( attr );
+		vector<float> outData( numOutVertices * dims );
+		for( size_t v = 0; v < numInVertices; ++v )
+			if( outVertexIndices[v] != UNREFERENCED )
+				std::copy( inData + v * dims, inData + ( v + 1 ) * dims, outData.data() + outVertexIndices[v] * dims );
+
+		ctx->copyAttrib( attr, dims, 0, outData.data(), numOutVertices );
+	}
+
+	ctx->copyIndices( Primitive::TRIANGLES, indices.data(), indices.size(), 4 );
+}
+
 //////////////////////////////////////////////////////////////////////////////////////
 // SourceMods
 void SourceMods::copyImpl( const SourceMods &rhs )
@@ -0,0 +1,328 @@
+/*
+ Copyright (c) 2026, The Cinder Project
+
+ This code is intended to be used with the Cinder C++ library, http://libcinder.org
+
+ Redistribution and use in source and binary forms, with or without modification, are permitted provided that
+ the following conditions are met:
+
+    * Redistributions of source code must retain the above copyright notice, this list of conditions and
+	the following disclaimer.
+    * Redistributions in binary form must reproduce the above copyright notice, this list of conditions and
+	the following disclaimer in the documentation and/or other materials provided with the distribution.
+
+ THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED
+ WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A
+ PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR
+ ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+ TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+ NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ POSSIBILITY OF SUCH DAMAGE.
+*/
+
+#include "cinder/ImageDecodeService.h"
+#include "cinder/app/AppBase.h"
+#include "cinder/Log.h"
+#include "cinder/Thread.h"
+
+#include <algorithm>
+
+#if defined( CINDER_UWP )
+	#include <ppltasks.h>
+	#include "cinder/winrt/WinRTUtils.h"
+	#include "cinder/msw/CinderMsw.h"
+	using namespace Windows::Storage;
+	using namespace Concurrency;
+#endif
+
+using namespace std;
+
+namespace cinder {
+
+namespace {
+
+ImageSourceRef loadImageFromPath( const fs::path &path, const ImageSource::Options &options, const string &extension )
+{
+#if defined( CINDER_UWP )
+	// Files outside of the App's folder may only be opened through the StorageFile API, so on failure decode a temporary copy.
+	// Blocking on the copy is fine here, since this runs on a decoding thread.
+	try {
+		return loadImage( path, options, extension );
+	}
+	catch( const ImageIoExceptionFailedLoad & ) {
+		StorageFile^ file = winrt::copyFileToTempDirAsync( path ).get();
+		fs::path temp = fs::path( msw::toUtf8String( file->Path->Data() ) );
+		ImageSourceRef result = loadImage( temp, options, extension );
+		winrt::deleteFileAsync( temp );
+		return result;
+	}
+#else
+	return loadImage( path, options, extension );
+#endif
+}
+
+// Records the channel orders chosen by a SurfaceConstraints. Row bytes follow the default SurfaceConstraints.
+class ConstraintsSnapshot : public SurfaceConstraints {
+  public:
+	ConstraintsSnapshot( const SurfaceConstraints &constraints )
+		: mChannelOrder( constraints.getChannelOrder( false ) ), mChannelOrderAlpha( constraints.getChannelOrder( true ) )
+	{}
+
+	SurfaceChannelOrder getChannelOrder( bool alpha ) const override	{ return alpha ? mChannelOrderAlpha : mChannelOrder; }
+
+  private:
+	SurfaceChannelOrder		mChannelOrder, mChannelOrderAlpha;
+};
+
+} // anonymous namespace
+
+///////////////////////////////////////////////////////////////////////////////
+// ImageDecodeRequest
+ImageDecodeRequest::ImageDecodeRequest( const function<void ()> &decodeFn, const function<void ()> &completeFn, int priority )
+	: mDecodeFn( decodeFn ), mCompleteFn( completeFn ), mPriority( priority ), mState( QUEUED )
+{
+}
+
+bool ImageDecodeRequest::setState( State expected, State desired )
+{
+	int state = expected;
+	if( ! mState.compare_exchange_strong( state, desired ) )
+		return false;
+
+	if( desired >= DECODED ) {
+		// taking the lock orders the notification after any waiter has checked the state
+		lock_guard<mutex> lock( mMutex );
+		mDecodedCond.notify_all();
+	}
+
+	return true;
+}
+
+void ImageDecodeRequest::cancel()
+{
+	for( State state : { QUEUED, DECODING, DECODED } ) {
+		if( setState( state, CANCELED ) )
+			return;
+	}
+}
+
+void ImageDecodeRequest::wait() const
+{
+	unique_lock<mutex> lock( mMutex );
+	mDecodedCond.wait( lock, [this] { return isDecoded(); } );
+}
+
+void ImageDecodeRequest::decode()
+{
+	if( ! setState( QUEUED, DECODING ) )
+		return;
+
+	try {
+		mDecodeFn();
+	}
+	catch( const std::exception &exc ) {
+		CI_LOG_EXCEPTION( "failed to decode image", exc );
+		mException = current_exception();
+	}
+	catch( ... ) {
+		CI_LOG_E( "failed to decode image" );
+		mException = current_exception();
+	}
+
+	mDecodeFn = nullptr;
+}
+
+void ImageDecodeRequest::complete()
+{
+	if( setState( DECODED, mException ? FAILED : COMPLETED ) )
+		mCompleteFn();
+
+	mCompleteFn = nullptr;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// ImageDecodeService
+ImageDecodeService::ImageDecodeService( const Options &options )
+	: mNumThreads( options.getNumThreads() ), mDispatchToApp( options.isDispatchToApp() ), mSequence( 0 ), mShouldQuit( false )
+{
+	if( mNumThreads == 0 ) {
+		// leave a core for the App's thread
+		size_t hardwareThreads = thread::hardware_concurrency();
+		mNumThreads = std::min<size_t>( 4, std::max<size_t>( 1, hardwareThreads ? hardwareThreads - 1 : 1 ) );
+	}
+}
+
+ImageDecodeService::~ImageDecodeService()
+{
+	{
+		lock_guard<mutex> lock( mMutex );
+		mShouldQuit = true;
+		for( ; ! mQueue.empty(); mQueue.pop() )
+			mQueue.top().mRequest->cancel();
+	}
+
+	mQueueCond.notify_all();
+	for( auto &thread : mThreads )
+		thread.join();
+}
+
+ImageDecodeService& ImageDecodeService::instance()
+{
+	static ImageDecodeService sInstance;
+	return sInstance;
+}
+
+ImageDecodeRequestRef ImageDecodeService::enqueue( const function<void ()> &decodeFn, const function<void ()> &completeFn, int priority )
+{
+	ImageDecodeRequestRef result( new ImageDecodeRequest( decodeFn, completeFn, priority ) );
+
+	{
+		lock_guard<mutex> lock( mMutex );
+		// threads are started as they're first needed, so that an unused service costs nothing
+		if( mThreads.size() < mNumThreads && mThreads.size() <= mQueue.size() )
+			mThreads.emplace_back( &ImageDecodeService::threadEntry, this );
+
+		mQueue.push( QueuedRequest{ priority, mSequence++, result } );
+	}
+
+	mQueueCond.notify_one();
+	return result;
+}
+
+ImageDecodeRequestRef ImageDecodeService::loadImage( const fs::path &path, const function<void ( ImageSourceRef )> &callback, const ImageSource::Options &options, const string &extension, int priority )
+{
+	auto result = make_shared<ImageSourceRef>();
+	return enqueue( [=] { *result = loadImageFromPath( path, options, extension ); },
+					[=] { callback( *result ); }, priority );
+}
+
+ImageDecodeRequestRef ImageDecodeService::loadImage( const DataSourceRef &dataSource, const function<void ( ImageSourceRef )> &callback, const ImageSource::Options &options, const string &extension, int priority )
+{
+	auto result = make_shared<ImageSourceRef>();
+	return enqueue( [=] { *result = cinder::loadImage( dataSource, options, extension ); },
+					[=] { callback( *result ); }, priority );
+}
+
+template<typename T>
+ImageDecodeRequestRef ImageDecodeService::loadSurface( const fs::path &path, const function<void ( shared_ptr<SurfaceT<T>> )> &callback, int priority )
+{
+	return loadSurface<T>( [path] { return loadImageFromPath( path, ImageSource::Options(), "" ); }, callback, nullptr, false, priority );
+}
+
+template<typename T>
+ImageDecodeRequestRef ImageDecodeService::loadSurface( const fs::path &path, const function<void ( shared_ptr<SurfaceT<T>> )> &callback, const SurfaceConstraints &constraints, bool alpha, int priority )
+{
+	return loadSurface<T>( [path] { return loadImageFromPath( path, ImageSource::Options(), "" ); }, callback, &constraints, alpha, priority );
+}
+
+template<typename T>
+ImageDecodeRequestRef ImageDecodeService::loadSurface( const DataSourceRef &dataSource, const function<void ( shared_ptr<SurfaceT<T>> )> &callback, int priority )
+{
+	return loadSurface<T>( [dataSource] { return cinder::loadImage( dataSource ); }, callback, nullptr, false, priority );
+}
+
+template<typename T>
+ImageDecodeRequestRef ImageDecodeService::loadSurface( const function<ImageSourceRef ()> &loadFn, const function<void ( shared_ptr<SurfaceT<T>> )> &callback, const SurfaceConstraints *constraints, bool alpha, int priority )
+{
+	// the caller's constraints may be gone by the time the image is decoded
+	const ConstraintsSnapshot snapshot( constraints ? *constraints : SurfaceConstraintsDefault() );
+	const bool alphaFromSource = ! constraints;
+	auto result = make_shared<shared_ptr<SurfaceT<T>>>();
+	return enqueue( [=] {
+			ImageSourceRef imageSource = loadFn();
+			*result = SurfaceT<T>::create( imageSource, snapshot, alphaFromSource ? imageSource->hasAlpha() : alpha );
+		},
+		[=] { callback( *result ); }, priority );
+}
+
+void ImageDecodeService::cancelAll()
+{
+	lock_guard<mutex> lock( mMutex );
+	for( ; ! mQueue.empty(); mQueue.pop() )
+		mQueue.top().mRequest->cancel();
+	for( auto &request : mDecoding )
+		request->cancel();
+	for( auto &request : mDecoded )
+		request->cancel();
+	mDecoded.clear();
+}
+
+size_t ImageDecodeService::update()
+{
+	deque<ImageDecodeRequestRef> decoded;
+	{
+		lock_guard<mutex> lock( mMutex );
+		decoded.swap( mDecoded );
+	}
+
+	size_t result = 0;
+	for( auto &request : decoded ) {
+		if( request->getState() == ImageDecodeRequest::DECODED ) {
+			request->complete();
+			result++;
+		}
+	}
+
+	return result;
+}
+
+size_t ImageDecodeService::getNumQueued() const
+{
+	lock_guard<mutex> lock( mMutex );
+	return mQueue.size();
+}
+
+void ImageDecodeService::dispatch( const ImageDecodeRequestRef &request )
+{
+	// a request only becomes DECODED once it's been handed over, so that wait() returning means that update() will see it
+	auto app = app::AppBase::get();
+	if( mDispatchToApp && app ) {
+		if( request->setState( ImageDecodeRequest::DECODING, ImageDecodeRequest::DECODED ) )
+			app->dispatchAsync( [request] { request->complete(); } );
+	}
+	else {
+		lock_guard<mutex> lock( mMutex );
+		if( request->setState( ImageDecodeRequest::DECODING, ImageDecodeRequest::DECODED ) )
+			mDecoded.push_back( request );
+	}
+}
+
+void ImageDecodeService::threadEntry()
+{
+	ThreadSetup threadSetup;
+
+	while( true ) {
+		ImageDecodeRequestRef request;
+		{
+			unique_lock<mutex> lock( mMutex );
+			mQueueCond.wait( lock, [this] { return mShouldQuit || ! mQueue.empty(); } );
+			if( mShouldQuit )
+				break;
+
+			request = mQueue.top().mRequest;
+			mQueue.pop();
+			mDecoding.push_back( request );
+		}
+
+		request->decode();
+
+		{
+			lock_guard<mutex> lock( mMutex );
+			mDecoding.erase( find( mDecoding.begin(), mDecoding.end(), request ) );
+		}
+
+		dispatch( request );
+	}
+}
+
+#define ImageDecodeService_PROTOTYPES(T)\
+	template CI_API ImageDecodeRequestRef ImageDecodeService::loadSurface<T>( const fs::path &path, const function<void ( shared_ptr<SurfaceT<T>> )> &callback, int priority ); \
+	template CI_API ImageDecodeRequestRef ImageDecodeService::loadSurface<T>( const fs::path &path, const function<void ( shared_ptr<SurfaceT<T>> )> &callback, const SurfaceConstraints &constraints, bool alpha, int priority ); \
+	template CI_API ImageDecodeRequestRef ImageDecodeService::loadSurface<T>( const DataSourceRef &dataSource, const function<void ( shared_ptr<SurfaceT<T>> )> &callback, int priority );
+
+ImageDecodeService_PROTOTYPES(uint8_t)
+ImageDecodeService_PROTOTYPES(uint16_t)
+ImageDecodeService_PROTOTYPES(float)
+
+} // namespace cinder
@@ -23,6 +23,7 @@
 */
 
 #include "cinder/ImageIo.h"
+#include "cinder/ImageDecodeService.h"
 #include "cinder/Utilities.h"
 
 #include <iterator>
@@ -30,13 +31,6 @@
 
 #if defined( CINDER_COCOA )
 	#include "cinder/cocoa/CinderCocoa.h"
-#elif defined( CINDER_UWP )
-	#include <ppltasks.h>
-	#include "cinder/winrt/WinRTUtils.h"
-	#include "cinder/Utilities.h"
-	#include "cinder/msw/CinderMsw.h"
-	using namespace Windows::Storage;
-	using namespace Concurrency;
 #elif defined( CINDER_ANDROID )
 	#include "cinder/app/android/PlatformAndroid.h"	
 #endif
@@ -379,36 +373,15 @@ ImageSource::RowFunc ImageSource::setupRowFunc( ImageTargetRef target )
 }
 
 
-#if defined( CINDER_UWP )
-void loadImageAsync(const fs::path path, std::function<void (ImageSourceRef)> callback, ImageSource::Options options, std::string extension)
-{
-	auto loadImageTask = create_task([path, options, extension]() -> ImageSourceRef
-	{
-		return loadImage(path, options, extension);
-	});
-
-    auto c2 = loadImageTask.then([path, options, extension, callback](task<ImageSourceRef> previousTask)
-    {
-        // If we get an ImageIoExceptionFailedLoad, we try to copy the image to the Application temp folder and try again
-        try
-        {
-			// Image was loaded. This callback is on the main UI thread
-			callback(previousTask.get());
-        }
-        catch (const ImageIoExceptionFailedLoad&)
-        {
-			auto copyTask = winrt::copyFileToTempDirAsync(path);
-			copyTask.then([options, extension, callback](StorageFile^ file) 
-			{
-				fs::path temp = fs::path( msw::toUtf8String( file->Path->Data() ) );
-				// Image was loaded. This callback is on the main UI thread
-				callback(loadImage(temp, options, extension));
-				winrt::deleteFileAsync(temp);
-			});
-        }
-    });
+ImageDecodeRequestRef loadImageAsync( const fs::path &path, const function<void (ImageSourceRef)> &callback, ImageSource::Options options, string extension, int priority )
+{
+	return ImageDecodeService::instance().loadImage( path, callback, options, extension, priority );
+}
+
+ImageDecodeRequestRef loadImageAsync( const DataSourceRef &dataSource, const function<void (ImageSourceRef)> &callback, ImageSource::Options options, string extension, int priority )
+{
+	return ImageDecodeService::instance().loadImage( dataSource, callback, options, extension, priority );
 }
-#endif
 
 ///////////////////////////////////////////////////////////////////////////////
 ImageSourceRef loadImage( const fs::path &path, ImageSource::Options options, string extension )
@@ -0,0 +1,219 @@
+/*
+ Copyright (c) 2026, The Cinder Project
+
+ This code is intended to be used with the Cinder C++ library, http://libcinder.org
+
+ Redistribution and use in source and binary forms, with or without modification, are permitted provided that
+ the following conditions are met:
+
+    * Redistributions of source code must retain the above copyright notice, this list of conditions and
+	the following disclaimer.
+    * Redistributions in binary form must reproduce the above copyright notice, this list of conditions and
+	the following disclaimer in the documentation and/or other materials provided with the distribution.
+
+ THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED
+ WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A
+ PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR
+ ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+ TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+ NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ POSSIBILITY OF SUCH DAMAGE.
+*/
+
+#include "cinder/ImageTargetFileBcn.h"
+#include "cinder/ip/Resize.h"
+#include "cinder/Stream.h"
+
+#include <algorithm>
+
+using namespace std;
+
+namespace cinder {
+
+namespace {
+
+// Format constants written into the containers; these are file-format values, so they're spelled out rather than taken from a GL header
+const uint32_t GL_COMPRESSED_RGB_S3TC_DXT1		= 0x83F0;
+const uint32_t GL_COMPRESSED_RGBA_S3TC_DXT1		= 0x83F1;
+const uint32_t GL_COMPRESSED_RGBA_S3TC_DXT5		= 0x83F3;
+const uint32_t GL_COMPRESSED_RED_RGTC1_			= 0x8DBB;
+const uint32_t GL_COMPRESSED_RG_RGTC2_			= 0x8DBD;
+const uint32_t GL_COMPRESSED_RGBA_BPTC_UNORM_	= 0x8E8C;
+const uint32_t GL_RED_							= 0x1903;
+const uint32_t GL_RGB_							= 0x1907;
+const uint32_t GL_RGBA_							= 0x1908;
+const uint32_t GL_RG_							= 0x8227;
+
+uint32_t makeFourCc( char a, char b, char c, char d )
+{
+	return uint32_t( a ) | ( uint32_t( b ) << 8 ) | ( uint32_t( c ) << 16 ) | ( uint32_t( d ) << 24 );
+}
+
+int32_t levelSize( int32_t size, size_t level )
+{
+	return std::max<int32_t>( 1, size >> level );
+}
+
+} // anonymous namespace
+
+void ImageTargetFileBcn::registerSelf()
+{
+	static bool alreadyRegistered = false;
+	const int32_t PRIORITY = 2;
+
+	if( alreadyRegistered )
+		return;
+	alreadyRegistered = true;
+
+	ImageIoRegistrar::TargetCreationFunc func = ImageTargetFileBcn::create;
+	ImageIoRegistrar::registerTargetType( "dds", func, PRIORITY, "dds" );
+	ImageIoRegistrar::registerTargetType( "ktx", func, PRIORITY, "ktx" );
+}
+
+ImageTargetRef ImageTargetFileBcn::create( DataTargetRef dataTarget, ImageSourceRef imageSource, ImageTarget::Options options, const std::string &extensionData )
+{
+	Format format;
+	if( options.getQuality() < 0.5f )
+		format.quality( ip::BlockQuality::FAST );
+	else if( options.getQuality() >= 0.95f )
+		format.quality( ip::BlockQuality::BEST );
+
+	return ImageTargetRef( new ImageTargetFileBcn( dataTarget, imageSource, format, extensionData ) );
+}
+
+ImageTargetRef ImageTargetFileBcn::create( DataTargetRef dataTarget, ImageSourceRef imageSource, const Format &format, const std::string &container )
+{
+	return ImageTargetRef( new ImageTargetFileBcn( dataTarget, imageSource, format, container ) );
+}
+
+ImageTargetFileBcn::ImageTargetFileBcn( DataTargetRef dataTarget, ImageSourceRef imageSource, const Format &format, const std::string &container )
+	: mDataTarget( dataTarget ), mFormat( format ), mContainer( container ), mSourceHasAlpha( imageSource->hasAlpha() )
+{
+	transform( mContainer.begin(), mContainer.end(), mContainer.begin(), ::tolower );
+	if( mContainer != "dds" && mContainer != "ktx" )
+		throw ImageIoExceptionUnknownExtension( "ImageTargetFileBcn writes \"dds\" and \"ktx\", not \"" + container + "\"" );
+
+	if( mFormat.isBlockFormatDefault() ) {
+		if( imageSource->getColorModel() == ImageIo::CM_GRAY && ! mSourceHasAlpha )
+			mFormat.blockFormat( ip::BlockFormat::BC4 );
+		else
+			mFormat.blockFormat( mSourceHasAlpha ? ip::BlockFormat::BC3 : ip::BlockFormat::BC1 );
+	}
+
+	// the encoder reads any channel order, so always ask for RGBA and let the ImageSource convert
+	setSize( imageSource->getWidth(), imageSource->getHeight() );
+	setColorModel( ImageIo::CM_RGB );
+	setChannelOrder( ImageIo::RGBA );
+	setDataType( ImageIo::UINT8 );
+	mSurface = Surface8u( mWidth, mHeight, true, SurfaceChannelOrder::RGBA );
+	// BC1's 1-bit alpha only applies when the encoded surface has alpha
+	if( ! mSourceHasAlpha ) {
+		for( int32_t y = 0; y < mHeight; ++y ) {
+			uint8_t *row = mSurface.getData( ivec2( 0, y ) );
+			for( int32_t x = 0; x < mWidth; ++x )
+				row[x * 4 + 3] = 255;
+		}
+	}
+}
+
+void* ImageTargetFileBcn::getRowPointer( int32_t row )
+{
+	return mSurface.getData( ivec2( 0, row ) );
+}
+
+void ImageTargetFileBcn::finalize()
+{
+	const ip::BlockFormat blockFormat = mFormat.getBlockFormat();
+	size_t numLevels = 1;
+	if( mFormat.getMipmaps() ) {
+		while( ( mWidth >> numLevels ) > 0 || ( mHeight >> numLevels ) > 0 )
+			++numLevels;
+	}
+
+	vector<vector<uint8_t>> levels;
+	Surface8u level = mSurface;
+	for( size_t i = 0; i < numLevels; ++i ) {
+		if( i > 0 )
+			level = ip::resizeCopy( level, level.getBounds(), ivec2( levelSize( mWidth, i ), levelSize( mHeight, i ) ) );
+		levels.push_back( ip::blockCompressCopy( level, blockFormat, mFormat.getQuality() ) );
+	}
+
+	if( mContainer == "dds" )
+		writeDds( levels );
+	else
+		writeKtx( levels );
+}
+
+void ImageTargetFileBcn::writeDds( const vector<vector<uint8_t>> &levels )
+{
+	enum { DDSD_CAPS = 0x1, DDSD_HEIGHT = 0x2, DDSD_WIDTH = 0x4, DDSD_PIXELFORMAT = 0x1000, DDSD_MIPMAPCOUNT = 0x20000, DDSD_LINEARSIZE = 0x80000 };
+	enum { DDPF_FOURCC = 0x4 };
+	enum { DDSCAPS_COMPLEX = 0x8, DDSCAPS_TEXTURE = 0x1000, DDSCAPS_MIPMAP = 0x400000 };
+
+	// DDS_HEADER as 31 little-endian dwords; the pixel format starts at dword 18 and the caps at 26
+	uint32_t header[31] = {};
+	header[0] = 124;
+	header[1] = DDSD_CAPS | DDSD_HEIGHT | DDSD_WIDTH | DDSD_PIXELFORMAT | DDSD_LINEARSIZE | ( levels.size() > 1 ? DDSD_MIPMAPCOUNT : 0 );
+	header[2] = mHeight;
+	header[3] = mWidth;
+	header[4] = (uint32_t)levels[0].size();
+	header[6] = (uint32_t)levels.size();
+	header[18] = 32;
+	header[19] = DDPF_FOURCC;
+	header[26] = DDSCAPS_TEXTURE | ( levels.size() > 1 ? DDSCAPS_COMPLEX | DDSCAPS_MIPMAP : 0 );
+
+	// BC7 has no legacy FourCC, so it needs the DX10 extension header
+	uint32_t header10[5] = { 0, 3 /*D3D10_RESOURCE_DIMENSION_TEXTURE2D*/, 0, 1, 0 };
+	switch( mFormat.getBlockFormat() ) {
+		case ip::BlockFormat::BC1: header[20] = makeFourCc( 'D', 'X', 'T', '1' ); break;
+		case ip::BlockFormat::BC3: header[20] = makeFourCc( 'D', 'X', 'T', '5' ); break;
+		case ip::BlockFormat::BC4: header[20] = makeFourCc( 'A', 'T', 'I', '1' ); break;
+		case ip::BlockFormat::BC5: header[20] = makeFourCc( 'A', 'T', 'I', '2' ); break;
+		case ip::BlockFormat::BC7:
+			header[20] = makeFourCc( 'D', 'X', '1', '0' );
+			header10[0] = 98 /*DXGI_FORMAT_BC7_UNORM*/;
+		break;
+	}
+
+	OStreamRef stream = mDataTarget->getStream();
+	stream->writeData( "DDS ", 4 );
+	stream->writeData( header, sizeof(header) );
+	if( mFormat.getBlockFormat() == ip::BlockFormat::BC7 )
+		stream->writeData( header10, sizeof(header10) );
+	for( const auto &level : levels )
+		stream->writeData( level.data(), level.size() );
+}
+
+void ImageTargetFileBcn::writeKtx( const vector<vector<uint8_t>> &levels )
+{
+	static const uint8_t identifier[12] = { 0xAB, 0x4B, 0x54, 0x58, 0x20, 0x31, 0x31, 0xBB, 0x0D, 0x0A, 0x1A, 0x0A };
+
+	uint32_t internalFormat = 0, baseInternalFormat = 0;
+	switch( mFormat.getBlockFormat() ) {
+		case ip::BlockFormat::BC1:
+			// the encoder only emits transparent pixels when the source had alpha
+			internalFormat = mSourceHasAlpha ? GL_COMPRESSED_RGBA_S3TC_DXT1 : GL_COMPRESSED_RGB_S3TC_DXT1;
+			baseInternalFormat = mSourceHasAlpha ? GL_RGBA_ : GL_RGB_;
+		break;
+		case ip::BlockFormat::BC3: internalFormat = GL_COMPRESSED_RGBA_S3TC_DXT5; baseInternalFormat = GL_RGBA_; break;
+		case ip::BlockFormat::BC4: internalFormat = GL_COMPRESSED_RED_RGTC1_; baseInternalFormat = GL_RED_; break;
+		case ip::BlockFormat::BC5: internalFormat = GL_COMPRESSED_RG_RGTC2_; baseInternalFormat = GL_RG_; break;
+		case ip::BlockFormat::BC7: internalFormat = GL_COMPRESSED_RGBA_BPTC_UNORM_; baseInternalFormat = GL_RGBA_; break;
+	}
+
+	// glType, glTypeSize, glFormat, glInternalFormat, glBaseInternalFormat, width, height, depth, array elements, faces, mip levels, key/value bytes
+	const uint32_t header[13] = { 0x04030201, 0, 1, 0, internalFormat, baseInternalFormat, (uint32_t)mWidth, (uint32_t)mHeight, 0, 0, 1, (uint32_t)levels.size(), 0 };
+
+	OStreamRef stream = mDataTarget->getStream();
+	stream->writeData( identifier, sizeof(identifier) );
+	stream->writeData( header, sizeof(header) );
+	for( const auto &level : levels ) {
+		// every level is a whole number of 8 or 16-byte blocks, so no padding is needed
+		const uint32_t imageSize = (uint32_t)level.size();
+		stream->writeData( &imageSize, sizeof(imageSize) );
+		stream->writeData( level.data(), level.size() );
+	}
+}
+
+} // namespace cinder
@@ -0,0 +1,140 @@
+/*
+ Copyright (c) 2026, The Cinder Project
+
+ This code is intended to be used with the Cinder C++ library, http://libcinder.org
+
+ Redistribution and use in source and binary forms, with or without modification, are permitted provided that
+ the following conditions are met:
+
+    * Redistributions of source code must retain the above copyright notice, this list of conditions and
+	the following disclaimer.
+    * Redistributions in binary form must reproduce the above copyright notice, this list of conditions and
+	the following disclaimer in the documentation and/or other materials provided with the distribution.
+
+ THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED
+ WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A
+ PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR
+ ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+ TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+ NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ POSSIBILITY OF SUCH DAMAGE.
+*/
+
+#include "cinder/MappedFile.h"
+
+#if defined( CINDER_MSW )
+	#include <windows.h>
+#else
+	#include <fcntl.h>
+	#include <sys/mman.h>
+	#include <sys/stat.h>
+	#include <unistd.h>
+#endif
+
+namespace cinder {
+
+namespace {
+
+size_t getPageSize()
+{
+#if defined( CINDER_MSW )
+	SYSTEM_INFO info;
+	::GetSystemInfo( &info );
+	return info.dwPageSize;
+#else
+	return size_t( ::sysconf( _SC_PAGESIZE ) );
+#endif
+}
+
+} // anonymous namespace
+
+MappedFile::MappedFile()
+#if defined( CINDER_MSW )
+	: mFile( INVALID_HANDLE_VALUE ), mMapping( nullptr ),
+#else
+	: mFd( -1 ),
+#endif
+	mData( nullptr ), mSize( 0 )
+{
+}
+
+MappedFileRef MappedFile::create( const fs::path &path )
+{
+	MappedFileRef result( new MappedFile );
+
+#if defined( CINDER_MSW )
+	result->mFile = ::CreateFileW( path.wstring().c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr );
+	if( result->mFile == INVALID_HANDLE_VALUE )
+		return nullptr;
+
+	LARGE_INTEGER fileSize;
+	if( ! ::GetFileSizeEx( result->mFile, &fileSize ) || fileSize.QuadPart == 0 )
+		return nullptr;
+
+	result->mMapping = ::CreateFileMappingW( result->mFile, nullptr, PAGE_READONLY, 0, 0, nullptr );
+	if( ! result->mMapping )
+		return nullptr;
+
+	auto data = ::MapViewOfFile( result->mMapping, FILE_MAP_READ, 0, 0, 0 );
+	if( ! data )
+		return nullptr;
+
+	result->mData = static_cast<const uint8_t *>( data );
+	result->mSize = (size_t)fileSize.QuadPart;
+#else
+	result->mFd = ::open( path.string().c_str(), O_RDONLY );
+	if( result->mFd < 0 )
+		return nullptr;
+
+	struct stat fileStat;
+	if( ::fstat( result->mFd, &fileStat ) != 0 || fileStat.st_size <= 0 )
+		return nullptr;
+
+	void *data = ::mmap( nullptr, (size_t)fileStat.st_size, PROT_READ, MAP_SHARED, result->mFd, 0 );
+	if( data == MAP_FAILED )
+		return nullptr;
+
+	result->mData = static_cast<const uint8_t *>( data );
+	result->mSize = (size_t)fileStat.st_size;
+#endif
+
+	return result;
+}
+
+MappedFile::~MappedFile()
+{
+#if defined( CINDER_MSW )
+	if( mData )
+		::UnmapViewOfFile( mData );
+	if( mMapping )
+		::CloseHandle( mMapping );
+	if( mFile != INVALID_HANDLE_VALUE )
+		::CloseHandle( mFile );
+#else
+	if( mData )
+		::munmap( const_cast<uint8_t *>( mData ), mSize );
+	if( mFd >= 0 )
+		::close( mFd );
+#endif
+}
+
+void MappedFile::willNeed( const uint8_t *begin, size_t size ) const
+{
+	static const size_t pageSize = getPageSize();
+
+#if ! defined( CINDER_MSW )
+	// round down to the page that contains begin, madvise() requires a page aligned address
+	size_t pageOffset = size_t( begin - mData ) & ~( pageSize - 1 );
+	::madvise( const_cast<uint8_t *>( mData ) + pageOffset, size + size_t( begin - mData ) - pageOffset, MADV_WILLNEED );
+#endif
+
+	// the hint above is asynchronous, so also touch each page to make sure it is resident
+	volatile uint8_t sink = 0;
+	for( size_t i = 0; i < size; i += pageSize )
+		sink += begin[i];
+	if( size )
+		sink += begin[size - 1];
+}
+
+} // namespace cinder
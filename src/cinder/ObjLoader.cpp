@@ -24,34 +24,337 @@
 */
 
 #include "cinder/ObjLoader.h"
+#include "cinder/MappedFile.h"
+#include "cinder/TriMesh.h"
+#include "cinder/Timer.h"
+#include "cinder/Log.h"
+#include "cinder/ip/Parallel.h"
 
+#include <cstring>
 #include <sstream>
 using namespace std;
 
-// For stoi
-#if defined( CINDER_ANDROID )
-	#include "cinder/android/CinderAndroid.h"
-#endif
-
 namespace cinder {
 
+namespace {
+
+// files are parsed in chunks of about this many bytes, split at line boundaries
+const size_t OBJ_CHUNK_SIZE = 1 << 20;
+
+// a face's contribution to its group's mHasTexCoords and mHasNormals. The group's first face sets them from its last vertex, and later faces can only
+// clear mHasTexCoords, with an empty tex coord index, or set mHasNormals.
+enum : uint8_t { FACE_LAST_TEX_COORD = 1, FACE_LAST_NORMAL = 2, FACE_EMPTY_TEX_COORD = 4, FACE_NORMAL = 8 };
+
+enum class ObjStatement { UNKNOWN, VERTEX, TEX_COORD, NORMAL, FACE, GROUP, USE_MATERIAL };
+
+// a group or usemtl statement, and how many faces and vertices of its chunk precede it
+struct ObjMarker {
+	size_t			mFaceIndex;
+	size_t			mNumPositions, mNumTexCoords, mNumNormals;
+	bool			mIsGroup;
+	std::string		mName;
+};
+
+struct ObjChunk {
+	size_t						mBegin, mEnd;
+	// counted up front, so that each chunk knows where its vertices go
+	size_t						mNumPositions, mNumTexCoords, mNumNormals;
+	size_t						mPositionBase, mTexCoordBase, mNormalBase;
+
+	std::vector<ObjLoader::Face>	mFaces;
+	std::vector<uint8_t>		mFaceFlags;
+	std::vector<ObjMarker>		mMarkers;
+	// file offset of the first malformed face, or npos
+	size_t						mErrorOffset;
+};
+
+inline bool isSpace( char c )
+{
+	return c == ' ' || c == '\t';
+}
+
+inline bool isDigit( char c )
+{
+	return c >= '0' && c <= '9';
+}
+
+// returns the end of the line starting at \a p, and sets \a next past its \n, \r\n or \r
+inline const char* findLineEnd( const char *p, const char *end, const char **next )
+{
+	while( p < end && *p != '\n' && *p != '\r' )
+		++p;
+	*next = p;
+	if( p < end )
+		*next += ( *p == '\r' && p + 1 < end && p[1] == '\n' ) ? 2 : 1;
+	return p;
+}
+
+// Calls fn( lineBegin, lineEnd, lineOffset ) for each line in [begin, end), with \a lineOffset relative to \a begin. As with the IStreamCinder::readLine() loop
+// this replaces, a line that ends in a backslash continues on the next one, joined in \a scratch, unless it's empty or a comment.
+template<typename FnT>
+void forEachLine( const char *begin, const char *end, std::string *scratch, const FnT &fn )
+{
+	const char *p = begin;
+	while( p < end ) {
+		const char *lineBegin = p;
+		const char *lineEnd = findLineEnd( p, end, &p );
+		if( lineEnd > lineBegin && *lineBegin != '#' && lineEnd[-1] == '\\' && p < end ) {
+			scratch->assign( lineBegin, lineEnd );
+			while( ! scratch->empty() && scratch->back() == '\\' && p < end ) {
+				scratch->pop_back();
+				const char *segment = p;
+				lineEnd = findLineEnd( p, end, &p );
+				scratch->append( segment, lineEnd );
+			}
+			fn( scratch->data(), scratch->data() + scratch->size(), size_t( lineBegin - begin ) );
+		}
+		else
+			fn( lineBegin, lineEnd, size_t( lineBegin - begin ) );
+	}
+}
+
+// returns the offset of the first line that starts at or after \a offset and isn't the continuation of a previous one
+size_t findChunkStart( const char *data, size_t size, size_t offset )
+{
+	while( offset < size ) {
+		const char *newline = static_cast<const char*>( memchr( data + offset, '\n', size - offset ) );
+		if( ! newline )
+			return size;
+		const char *lineEnd = ( newline > data && newline[-1] == '\r' ) ? newline - 1 : newline;
+		offset = size_t( newline - data ) + 1;
+		if( lineEnd == data || lineEnd[-1] != '\\' )
+			return offset;
+	}
+
+	return size;
+}
+
+// skips leading whitespace and the statement's tag, returning its kind
+ObjStatement parseStatement( const char **p, const char *end )
+{
+	while( *p < end && isSpace( **p ) )
+		++*p;
+	const char *tag = *p;
+	while( *p < end && ! isSpace( **p ) )
+		++*p;
+
+	const size_t length = *p - tag;
+	if( length == 1 && tag[0] == 'v' )
+		return ObjStatement::VERTEX;
+	else if( length == 2 && tag[0] == 'v' && tag[1] == 't' )
+		return ObjStatement::TEX_COORD;
+	else if( length == 2 && tag[0] == 'v' && tag[1] == 'n' )
+		return ObjStatement::NORMAL;
+	else if( length == 1 && tag[0] == 'f' )
+		return ObjStatement::FACE;
+	else if( length == 1 && tag[0] == 'g' )
+		return ObjStatement::GROUP;
+	else if( length == 6 && memcmp( tag, "usemtl", 6 ) == 0 )
+		return ObjStatement::USE_MATERIAL;
+	else
+		return ObjStatement::UNKNOWN;
+}
+
+// Parses the number at \a p into \a result, returning its end, or \a p if there isn't one. Plain decimals are converted exactly, by the fast path of
+// Clinger's algorithm; anything else (more digits than fit, large exponents, inf, nan or hex) goes through strtof().
+const char* parseFloat( const char *p, const char *end, float *result )
+{
+	static const float sPowersOf10f[] = { 1e0f, 1e1f, 1e2f, 1e3f, 1e4f, 1e5f, 1e6f, 1e7f, 1e8f, 1e9f, 1e10f };
+	static const double sPowersOf10[] = { 1e0, 1e1, 1e2, 1e3, 1e4, 1e5, 1e6, 1e7, 1e8, 1e9, 1e10, 1e11, 1e12, 1e13, 1e14, 1e15, 1e16, 1e17, 1e18, 1e19, 1e20, 1e21, 1e22 };
+
+	const char *s = p;
+	bool negative = false;
+	if( s < end && ( *s == '-' || *s == '+' ) )
+		negative = *s++ == '-';
+
+	uint64_t mantissa = 0;
+	int numDigits = 0, exponent = 0;
+	bool hasDigits = false;
+	for( ; s < end && isDigit( *s ); ++s, hasDigits = true ) {
+		mantissa = mantissa * 10 + ( *s - '0' );
+		numDigits += ( mantissa != 0 ) ? 1 : 0;
+	}
+	if( s < end && *s == '.' ) {
+		for( ++s; s < end && isDigit( *s ); ++s, hasDigits = true ) {
+			mantissa = mantissa * 10 + ( *s - '0' );
+			numDigits += ( mantissa != 0 ) ? 1 : 0;
+			--exponent;
+		}
+	}
+	if( hasDigits && s < end && ( *s == 'e' || *s == 'E' ) ) {
+		const char *e = s + 1;
+		bool negativeExponent = false;
+		if( e < end && ( *e == '-' || *e == '+' ) )
+			negativeExponent = *e++ == '-';
+		if( e < end && isDigit( *e ) ) {
+			int value = 0;
+			for( ; e < end && isDigit( *e ); ++e )
+				value = std::min( value * 10 + ( *e - '0' ), 100000 );
+			exponent += negativeExponent ? -value : value;
+			s = e;
+		}
+	}
+	const bool exact = hasDigits && numDigits <= 19;
+
+	if( exact && mantissa <= ( 1u << 24 ) && exponent >= -10 && exponent <= 10 ) {
+		const float value = ( exponent < 0 ) ? float( mantissa ) / sPowersOf10f[-exponent] : float( mantissa ) * sPowersOf10f[exponent];
+		*result = negative ? -value : value;
+		return s;
+	}
+	else if( exact && mantissa <= ( uint64_t( 1 ) << 53 ) && exponent >= -22 && exponent <= 22 ) {
+		const double value = ( exponent < 0 ) ? double( mantissa ) / sPowersOf10[-exponent] : double( mantissa ) * sPowersOf10[exponent];
+		*result = float( negative ? -value : value );
+		return s;
+	}
+
+	// strtof() needs a terminated string
+	char token[128];
+	size_t length = 0;
+	while( p + length < end && length < sizeof( token ) - 1 && ! isSpace( p[length] ) && p[length] != '/' )
+		++length;
+	memcpy( token, p, length );
+	token[length] = 0;
+	char *tokenEnd;
+	const float value = strtof( token, &tokenEnd );
+	if( tokenEnd == token )
+		return p;
+	*result = value;
+	return p + ( tokenEnd - token );
+}
+
+// parses up to \a count whitespace separated floats, leaving the rest of \a result as it is when there are fewer
+void parseFloats( const char *p, const char *end, float *result, int count )
+{
+	for( int i = 0; i < count; ++i ) {
+		while( p < end && isSpace( *p ) )
+			++p;
+		const char *next = parseFloat( p, end, &result[i] );
+		if( next == p )
+			return;
+		p = next;
+	}
+}
+
+// parses the OBJ index at \a p and converts it to a 0-based one, where negative indices count back from \a numSoFar. Returns false when it's
+// malformed or out of [0, \a numTotal).
+bool parseIndex( const char **p, const char *end, size_t numSoFar, size_t numTotal, int32_t *result )
+{
+	const char *s = *p;
+	bool negative = false;
+	if( s < end && ( *s == '-' || *s == '+' ) )
+		negative = *s++ == '-';
+	if( s == end || ! isDigit( *s ) )
+		return false;
+
+	int64_t value = 0;
+	for( ; s < end && isDigit( *s ); ++s )
+		value = std::min<int64_t>( value * 10 + ( *s - '0' ), int64_t( 1 ) << 40 );
+	*p = s;
+
+	const int64_t index = negative ? int64_t( numSoFar ) - value : value - 1;
+	if( value == 0 || index < 0 || index >= int64_t( numTotal ) )
+		return false;
+	*result = int32_t( index );
+	return true;
+}
+
+} // anonymous namespace
+
+// Open-addressing hash of (position, tex coord, normal) index triples to output vertices, with linear probing. Unused members of the triple are 0.
+class ObjLoader::VertexHash {
+  public:
+	VertexHash( size_t expectedSize )
+		: mSize( 0 )
+	{
+		size_t capacity = 64;
+		while( capacity < expectedSize * 2 )
+			capacity *= 2;
+		mEntries.assign( capacity, Entry{ -1, 0, 0, 0 } );
+	}
+
+	//! Returns the output vertex of the triple, which is \a index when the triple is new, and sets \a inserted accordingly
+	uint32_t	insert( int32_t position, int32_t texCoord, int32_t normal, uint32_t index, bool *inserted )
+	{
+		if( ( mSize + 1 ) * 2 > mEntries.size() )
+			rehash( mEntries.size() * 2 );
+
+		const size_t mask = mEntries.size() - 1;
+		for( size_t slot = hash( position, texCoord, normal ) & mask; ; slot = ( slot + 1 ) & mask ) {
+			Entry &entry = mEntries[slot];
+			if( entry.mPosition < 0 ) {
+				entry = Entry{ position, texCoord, normal, index };
+				++mSize;
+				*inserted = true;
+				return index;
+			}
+			else if( entry.mPosition == position && entry.mTexCoord == texCoord && entry.mNormal == normal ) {
+				*inserted = false;
+				return entry.mIndex;
+			}
+		}
+	}
+
+  private:
+	struct Entry {
+		int32_t		mPosition, mTexCoord, mNormal;
+		uint32_t	mIndex;
+	};
+
+	static size_t	hash( int32_t position, int32_t texCoord, int32_t normal )
+	{
+		uint64_t result = uint64_t( uint32_t( position ) ) * 0x9E3779B97F4A7C15ull;
+		result ^= uint64_t( uint32_t( texCoord ) ) * 0xC2B2AE3D27D4EB4Full;
+		result ^= uint64_t( uint32_t( normal ) ) * 0x165667B19E3779F9ull;
+		return size_t( result ^ ( result >> 32 ) );
+	}
+
+	void	rehash( size_t capacity )
+	{
+		std::vector<Entry> entries( capacity, Entry{ -1, 0, 0, 0 } );
+		const size_t mask = capacity - 1;
+		for( const Entry &entry : mEntries ) {
+			if( entry.mPosition < 0 )
+				continue;
+			size_t slot = hash( entry.mPosition, entry.mTexCoord, entry.mNormal ) & mask;
+			while( entries[slot].mPosition >= 0 )
+				slot = ( slot + 1 ) & mask;
+			entries[slot] = entry;
+		}
+		mEntries.swap( entries );
+	}
+
+	std::vector<Entry>	mEntries;
+	size_t				mSize;
+};
+
 ObjLoader::ObjLoader( shared_ptr<IStreamCinder> stream, bool includeNormals, bool includeTexCoords, bool optimize )
-	: mStream( stream ), mOutputCached( false ), mOptimizeVertices( optimize ), mGroupIndex( numeric_limits<size_t>::max() )
+	: mOutputCached( false ), mOptimizeVertices( optimize ), mGroupIndex( numeric_limits<size_t>::max() ), mTiming()
 {
-	parse( includeNormals, includeTexCoords );
+	Timer timer( true );
+	std::vector<char> data;
+	char block[64 * 1024];
+	while( ! stream->isEof() ) {
+		size_t bytesRead = stream->readDataAvailable( block, sizeof( block ) );
+		if( bytesRead == 0 )
+			break;
+		data.insert( data.end(), block, block + bytesRead );
+	}
+	mTiming.mReadSeconds = timer.getSeconds();
+
+	parse( data.data(), data.size(), includeNormals, includeTexCoords );
 }
 
 ObjLoader::ObjLoader( DataSourceRef dataSource, bool includeNormals, bool includeTexCoords, bool optimize )
-	: mStream( dataSource->createStream() ), mOutputCached( false ), mOptimizeVertices( optimize ), mGroupIndex( numeric_limits<size_t>::max() )
+	: mOutputCached( false ), mOptimizeVertices( optimize ), mGroupIndex( numeric_limits<size_t>::max() ), mTiming()
 {
-	parse( includeNormals, includeTexCoords );
+	parse( dataSource, includeNormals, includeTexCoords );
 }
 
 ObjLoader::ObjLoader( DataSourceRef dataSource, DataSourceRef materialSource, bool includeNormals, bool includeTexCoords, bool optimize )
-	: mStream( dataSource->createStream() ), mOutputCached( false ), mOptimizeVertices( optimize ), mGroupIndex( numeric_limits<size_t>::max() )
+	: mOutputCached( false ), mOptimizeVertices( optimize ), mGroupIndex( numeric_limits<size_t>::max() ), mTiming()
 {
 	parseMaterial( materialSource->createStream() );
-	parse( includeNormals, includeTexCoords );
+	parse( dataSource, includeNormals, includeTexCoords );
 }
 
 ObjLoader& ObjLoader::groupIndex( size_t groupIndex )
@@ -181,141 +484,231 @@ void ObjLoader::parseMaterial( std::shared_ptr<IStreamCinder> material )
         mMaterials[m.mName] = m;
 }
 
-void ObjLoader::parse( bool includeNormals, bool includeTexCoords )
+void ObjLoader::parse( const DataSourceRef &dataSource, bool includeNormals, bool includeTexCoords )
 {
-	Group *currentGroup;
-	mGroups.push_back( Group() );
-	currentGroup = &mGroups[mGroups.size()-1];
-	currentGroup->mBaseVertexOffset = currentGroup->mBaseTexCoordOffset = currentGroup->mBaseNormalOffset = 0;
-
-    const Material *currentMaterial = 0;
-
-	size_t lineNumber = 0;
-	while( ! mStream->isEof() ) {
-		lineNumber++;
-		string line = mStream->readLine(), tag;
-        if( line.empty() || line[0] == '#' )
-            continue;
-
-		while( line.back() == '\\' && ! mStream->isEof() ) {
-			auto next = mStream->readLine();
-			line = line.substr( 0, line.size() - 1 ) + next;
-		}
-
-		stringstream ss( line );
-		ss >> tag;
-		if( tag == "v" ) { // vertex
-			vec3 v;
-			ss >> v.x >> v.y >> v.z;
-			mInternalVertices.push_back( v );
-		}
-		else if( tag == "vt" ) { // vertex texture coordinates
-			if( includeTexCoords ) {
-				vec2 tex;
-				ss >> tex.x >> tex.y;
-				mInternalTexCoords.push_back( tex );
-			}
-		}
-		else if( tag == "vn" ) { // vertex normals
-			if ( includeNormals ) {
-				vec3 v;
-				ss >> v.x >> v.y >> v.z;
-				mInternalNormals.push_back( normalize( v ) );
-			}
-		}
-		else if( tag == "f" ) { // face
-			parseFace( currentGroup, currentMaterial, line, includeNormals, includeTexCoords );
-		}
-		else if( tag == "g" ) { // group
-			if( ! currentGroup->mFaces.empty() )
-				mGroups.push_back( Group() );
-			currentGroup = &mGroups[mGroups.size()-1];
-			currentGroup->mBaseVertexOffset = (int32_t)mInternalVertices.size();
-			currentGroup->mBaseTexCoordOffset = (int32_t)mInternalTexCoords.size();
-			currentGroup->mBaseNormalOffset = (int32_t)mInternalNormals.size();
-			currentGroup->mName = line.substr( line.find( ' ' ) + 1 );
-		}
-        else if( tag == "usemtl") { // material
-            string tag;
-            ss >> tag;
-            std::map<std::string, Material>::const_iterator m = mMaterials.find(tag);
-            if( m != mMaterials.end() ) {
-                currentMaterial = &m->second;
-            }
-        }
-	}
+	// map files rather than reading them, falling back to the source's buffer for everything else
+	Timer timer( true );
+	MappedFileRef file;
+	BufferRef buffer;
+	if( dataSource->isFilePath() )
+		file = MappedFile::create( dataSource->getFilePath() );
+	if( ! file )
+		buffer = dataSource->getBuffer();
+	mTiming.mReadSeconds = timer.getSeconds();
+
+	if( file )
+		parse( reinterpret_cast<const char*>( file->getData() ), file->getSize(), includeNormals, includeTexCoords );
+	else
+		parse( static_cast<const char*>( buffer->getData() ), buffer->getSize(), includeNormals, includeTexCoords );
 }
 
-void ObjLoader::parseFace( Group *group, const Material *material, const std::string &s, bool includeNormals, bool includeTexCoords )
+void ObjLoader::parse( const char *data, size_t size, bool includeNormals, bool includeTexCoords )
 {
-	ObjLoader::Face result;
-	result.mNumVertices = 0;
-    result.mMaterial = material;
-
-	size_t offset = 2; // account for "f "
-	size_t length = s.length();
-	while( offset < length ) {
-		size_t endOfTriple, firstSlashOffset, secondSlashOffset;
+	// split into chunks at line boundaries and count the vertices in each, so that they can be parsed straight into place
+	Timer timer( true );
+	std::vector<ObjChunk> chunks;
+	for( size_t begin = 0; begin < size; ) {
+		const size_t end = ( size - begin > OBJ_CHUNK_SIZE ) ? findChunkStart( data, size, begin + OBJ_CHUNK_SIZE ) : size;
+		chunks.emplace_back();
+		chunks.back().mBegin = begin;
+		chunks.back().mEnd = end;
+		chunks.back().mErrorOffset = string::npos;
+		begin = end;
+	}
 
-		while( s[offset] == ' ' )
-			++offset;
+	ip::parallelFor( chunks.size(), 1, [&]( size_t chunkBegin, size_t chunkEnd ) {
+		std::string scratch;
+		for( size_t c = chunkBegin; c < chunkEnd; ++c ) {
+			ObjChunk &chunk = chunks[c];
+			chunk.mNumPositions = chunk.mNumTexCoords = chunk.mNumNormals = 0;
+			forEachLine( data + chunk.mBegin, data + chunk.mEnd, &scratch, [&]( const char *p, const char *end, size_t ) {
+				switch( parseStatement( &p, end ) ) {
+					case ObjStatement::VERTEX:		++chunk.mNumPositions;	break;
+					case ObjStatement::TEX_COORD:	++chunk.mNumTexCoords;	break;
+					case ObjStatement::NORMAL:		++chunk.mNumNormals;	break;
+					default:												break;
+				}
+			} );
+		}
+	} );
 
-		// find the end of this triple "v/vt/vn"
-		endOfTriple = s.find( ' ', offset );
-		if( endOfTriple == string::npos ) endOfTriple = length;
-		firstSlashOffset = s.find( '/', offset );
-		if( firstSlashOffset != string::npos ) {
-			secondSlashOffset = s.find( '/', firstSlashOffset + 1 );
-			if( secondSlashOffset > endOfTriple ) secondSlashOffset = string::npos;
+	size_t numPositions = 0, numTexCoords = 0, numNormals = 0;
+	for( auto &chunk : chunks ) {
+		chunk.mPositionBase = numPositions;
+		chunk.mTexCoordBase = numTexCoords;
+		chunk.mNormalBase = numNormals;
+		numPositions += chunk.mNumPositions;
+		numTexCoords += chunk.mNumTexCoords;
+		numNormals += chunk.mNumNormals;
+	}
+	mInternalVertices.resize( numPositions );
+	mInternalTexCoords.resize( includeTexCoords ? numTexCoords : 0 );
+	mInternalNormals.resize( includeNormals ? numNormals : 0 );
+	mTiming.mCountSeconds = timer.getSeconds();
+
+	// parse each chunk's vertices into place, and its faces, groups and materials into the chunk
+	timer.start();
+	ip::parallelFor( chunks.size(), 1, [&]( size_t chunkBegin, size_t chunkEnd ) {
+		std::string scratch;
+		for( size_t c = chunkBegin; c < chunkEnd; ++c ) {
+			ObjChunk &chunk = chunks[c];
+			size_t chunkPositions = 0, chunkTexCoords = 0, chunkNormals = 0;
+			forEachLine( data + chunk.mBegin, data + chunk.mEnd, &scratch, [&]( const char *lineBegin, const char *end, size_t lineOffset ) {
+				const char *p = lineBegin;
+				const ObjStatement statement = parseStatement( &p, end );
+				switch( statement ) {
+					case ObjStatement::VERTEX:
+						parseFloats( p, end, &mInternalVertices[chunk.mPositionBase + chunkPositions++].x, 3 );
+					break;
+					case ObjStatement::TEX_COORD:
+						if( includeTexCoords )
+							parseFloats( p, end, &mInternalTexCoords[chunk.mTexCoordBase + chunkTexCoords].x, 2 );
+						++chunkTexCoords;
+					break;
+					case ObjStatement::NORMAL:
+						if( includeNormals ) {
+							vec3 &normal = mInternalNormals[chunk.mNormalBase + chunkNormals];
+							parseFloats( p, end, &normal.x, 3 );
+							normal = normalize( normal );
+						}
+						++chunkNormals;
+					break;
+					case ObjStatement::FACE: {
+						Face face;
+						face.mNumVertices = 0;
+						face.mMaterial = nullptr;
+						uint8_t flags = 0;
+						bool malformed = false;
+						while( ! malformed ) {
+							while( p < end && isSpace( *p ) )
+								++p;
+							if( p == end )
+								break;
+
+							int32_t index;
+							bool hasTexCoord = false, hasNormal = false;
+							malformed = ! parseIndex( &p, end, chunk.mPositionBase + chunkPositions, numPositions, &index );
+							face.mVertexIndices.push_back( index );
+							if( ! malformed && p < end && *p == '/' ) {
+								if( ++p < end && *p != '/' && ! isSpace( *p ) ) {
+									malformed = ! parseIndex( &p, end, chunk.mTexCoordBase + chunkTexCoords, numTexCoords, &index );
+									if( includeTexCoords ) {
+										face.mTexCoordIndices.push_back( index );
+										hasTexCoord = true;
+									}
+								}
+								else if( includeTexCoords )
+									flags |= FACE_EMPTY_TEX_COORD;
+
+								if( ! malformed && p < end && *p == '/' ) {
+									++p;
+									malformed = ! parseIndex( &p, end, chunk.mNormalBase + chunkNormals, numNormals, &index );
+									if( includeNormals ) {
+										face.mNormalIndices.push_back( index );
+										hasNormal = true;
+									}
+								}
+							}
+							malformed = malformed || ( p < end && ! isSpace( *p ) );
+
+							flags = ( flags & ~( FACE_LAST_TEX_COORD | FACE_LAST_NORMAL ) ) | ( hasTexCoord ? FACE_LAST_TEX_COORD : 0 ) | ( hasNormal ? FACE_LAST_NORMAL | FACE_NORMAL : 0 );
+							face.mNumVertices++;
+						}
+
+						if( malformed )
+							chunk.mErrorOffset = std::min( chunk.mErrorOffset, chunk.mBegin + lineOffset );
+						else {
+							chunk.mFaces.push_back( std::move( face ) );
+							chunk.mFaceFlags.push_back( flags );
+						}
+					}
+					break;
+					case ObjStatement::GROUP:
+					case ObjStatement::USE_MATERIAL: {
+						ObjMarker marker;
+						marker.mFaceIndex = chunk.mFaces.size();
+						marker.mNumPositions = chunkPositions;
+						marker.mNumTexCoords = chunkTexCoords;
+						marker.mNumNormals = chunkNormals;
+						marker.mIsGroup = statement == ObjStatement::GROUP;
+						if( marker.mIsGroup ) { // everything after the first space
+							const char *space = std::find( lineBegin, end, ' ' );
+							marker.mName.assign( ( space != end ) ? space + 1 : lineBegin, end );
+						}
+						else {
+							while( p < end && isSpace( *p ) )
+								++p;
+							const char *name = p;
+							while( p < end && ! isSpace( *p ) )
+								++p;
+							marker.mName.assign( name, p );
+						}
+						chunk.mMarkers.push_back( std::move( marker ) );
+					}
+					break;
+					default:
+					break;
+				}
+			} );
 		}
-		else
-			secondSlashOffset = string::npos;
+	} );
+	mTiming.mParseSeconds = timer.getSeconds();
 
-		// process the vertex index
-		int vertexIndex = (firstSlashOffset != string::npos) ?
-            stoi( s.substr( offset, firstSlashOffset - offset ) ) :
-            stoi( s.substr( offset, endOfTriple - offset));
+	for( const auto &chunk : chunks ) {
+		if( chunk.mErrorOffset != string::npos )
+			throw Exception( "ObjLoader: malformed face at byte offset " + to_string( chunk.mErrorOffset ) );
+	}
 
-		if( vertexIndex < 0 )
-			result.mVertexIndices.push_back( group->mBaseVertexOffset + vertexIndex );
-		else
-			result.mVertexIndices.push_back( vertexIndex - 1 );
-
-		// process the tex coord index
-		if( includeTexCoords && ( firstSlashOffset != string::npos ) ) {
-			size_t numSize = ( secondSlashOffset == string::npos ) ? ( endOfTriple - firstSlashOffset - 1 ) : secondSlashOffset - firstSlashOffset - 1;
-			if( numSize > 0 ) {
-				int texCoordIndex = stoi( s.substr( firstSlashOffset + 1, numSize ) );
-				if( texCoordIndex < 0 )
-					result.mTexCoordIndices.push_back( group->mBaseTexCoordOffset + texCoordIndex );
-				else
-					result.mTexCoordIndices.push_back( texCoordIndex - 1 );
-				if( group->mFaces.empty() )
-					group->mHasTexCoords = true;
+	// assemble the groups in file order
+	timer.start();
+	auto appendGroup = [this]() {
+		mGroups.push_back( Group() );
+		mGroups.back().mBaseVertexOffset = mGroups.back().mBaseTexCoordOffset = mGroups.back().mBaseNormalOffset = 0;
+		mGroups.back().mHasTexCoords = mGroups.back().mHasNormals = false;
+	};
+	appendGroup();
+
+	const Material *currentMaterial = nullptr;
+	for( auto &chunk : chunks ) {
+		size_t f = 0;
+		auto appendFaces = [&]( size_t end ) {
+			Group &group = mGroups.back();
+			for( ; f < end; ++f ) {
+				Face &face = chunk.mFaces[f];
+				const uint8_t flags = chunk.mFaceFlags[f];
+				if( face.mNumVertices > 0 && group.mFaces.empty() ) {
+					group.mHasTexCoords = ( flags & FACE_LAST_TEX_COORD ) != 0;
+					group.mHasNormals = ( flags & FACE_LAST_NORMAL ) != 0;
+				}
+				else if( face.mNumVertices > 0 ) {
+					group.mHasTexCoords = group.mHasTexCoords && ! ( flags & FACE_EMPTY_TEX_COORD );
+					group.mHasNormals = group.mHasNormals || ( flags & FACE_NORMAL );
+				}
+				face.mMaterial = currentMaterial;
+				group.mFaces.push_back( std::move( face ) );
+			}
+		};
+
+		for( const auto &marker : chunk.mMarkers ) {
+			appendFaces( marker.mFaceIndex );
+			if( marker.mIsGroup ) {
+				if( ! mGroups.back().mFaces.empty() )
+					appendGroup();
+				Group &group = mGroups.back();
+				group.mBaseVertexOffset = int32_t( chunk.mPositionBase + marker.mNumPositions );
+				group.mBaseTexCoordOffset = includeTexCoords ? int32_t( chunk.mTexCoordBase + marker.mNumTexCoords ) : 0;
+				group.mBaseNormalOffset = includeNormals ? int32_t( chunk.mNormalBase + marker.mNumNormals ) : 0;
+				group.mName = marker.mName;
+			}
+			else {
+				auto material = mMaterials.find( marker.mName );
+				if( material != mMaterials.end() )
+					currentMaterial = &material->second;
 			}
-			else
-				group->mHasTexCoords = false;
-		}
-		else if( group->mFaces.empty() ) // if this is the first face, let's note that this group has no tex coords
-			group->mHasTexCoords = false;
-
-		// process the normal index
-		if( includeNormals && ( secondSlashOffset != string::npos ) ) {
-			int normalIndex = stoi( s.substr( secondSlashOffset + 1, endOfTriple - secondSlashOffset - 1 ) );
-			if( normalIndex < 0 )
-				result.mNormalIndices.push_back( group->mBaseNormalOffset + normalIndex );
-			else
-				result.mNormalIndices.push_back( normalIndex - 1 );
-			group->mHasNormals = true;
 		}
-		else if( group->mFaces.empty() ) // if this is the first face, let's note that this group has no normals
-			group->mHasNormals = false;
-
-		offset = endOfTriple + 1;
-		result.mNumVertices++;
+		appendFaces( chunk.mFaces.size() );
 	}
-
-	group->mFaces.push_back( result );
+	mTiming.mMergeSeconds = timer.getSeconds();
 }
 
 void ObjLoader::load() const
@@ -323,6 +716,7 @@ void ObjLoader::load() const
 	if( mOutputCached )
 		return;
 
+	Timer timer( true );
 	mOutputVertices.clear();
 	mOutputNormals.clear();
 	mOutputTexCoords.clear();
@@ -361,53 +755,54 @@ void ObjLoader::load() const
 
 	if( normals && texCoords ) {
 		if( hasGroupIndex ) {
-			map<VertexTriple,int> uniqueVerts;
+			VertexHash uniqueVerts( mInternalVertices.size() );
 			loadGroupNormalsTextures( mGroups[mGroupIndex], uniqueVerts );
 		}
 		else {
-			map<VertexTriple,int> uniqueVerts;
+			VertexHash uniqueVerts( mInternalVertices.size() );
 			for( vector<Group>::const_iterator groupIt = mGroups.begin(); groupIt != mGroups.end(); ++groupIt )
 				loadGroupNormalsTextures( *groupIt, uniqueVerts );
 		}
 	}
 	else if( normals ) {
 		if( hasGroupIndex ) {
-			map<VertexPair,int> uniqueVerts;
+			VertexHash uniqueVerts( mInternalVertices.size() );
 			loadGroupNormals( mGroups[mGroupIndex], uniqueVerts );
 		}
 		else {
-			map<VertexPair,int> uniqueVerts;
+			VertexHash uniqueVerts( mInternalVertices.size() );
 			for( vector<Group>::const_iterator groupIt = mGroups.begin(); groupIt != mGroups.end(); ++groupIt )
 				loadGroupNormals( *groupIt, uniqueVerts );
 		}
 	}
 	else if( texCoords ) {
 		if( hasGroupIndex ) {
-			map<VertexPair,int> uniqueVerts;
+			VertexHash uniqueVerts( mInternalVertices.size() );
 			loadGroupTextures( mGroups[mGroupIndex], uniqueVerts );
 		}
 		else {
-			map<VertexPair,int> uniqueVerts;
+			VertexHash uniqueVerts( mInternalVertices.size() );
 			for( vector<Group>::const_iterator groupIt = mGroups.begin(); groupIt != mGroups.end(); ++groupIt )
 				loadGroupTextures( *groupIt, uniqueVerts );
 		}
 	}
 	else {
 		if( hasGroupIndex ) {
-			map<int,int> uniqueVerts;
+			VertexHash uniqueVerts( mInternalVertices.size() );
 			loadGroup( mGroups[mGroupIndex], uniqueVerts );
 		}
 		else {
-			map<int,int> uniqueVerts;
+			VertexHash uniqueVerts( mInternalVertices.size() );
 			for( vector<Group>::const_iterator groupIt = mGroups.begin(); groupIt != mGroups.end(); ++groupIt )
 				loadGroup( *groupIt, uniqueVerts );
 		}
 	}
 
 	mOutputCached = true;
+	mTiming.mLoadSeconds = timer.getSeconds();
 }
 
-void ObjLoader::loadGroupNormalsTextures( const Group &group, map<VertexTriple,int> &uniqueVerts ) const
+void ObjLoader::loadGroupNormalsTextures( const Group &group, VertexHash &uniqueVerts ) const
 {
     bool hasColors = mMaterials.size() > 0;
 	for( size_t f = 0; f < group.mFaces.size(); ++f ) {
@@ -441,9 +836,9 @@ void ObjLoader::loadGroupNormalsTextures( const Group &group, map<VertexTriple,i
 		faceIndices.reserve( group.mFaces[f].mNumVertices );
 		for( int v = 0; v < group.mFaces[f].mNumVertices; ++v ) {
 			if( ! forceUnique ) {
-				VertexTriple vTriple = make_tuple( group.mFaces[f].mVertexIndices[v], group.mFaces[f].mTexCoordIndices[v], group.mFaces[f].mNormalIndices[v] );
-				pair<map<VertexTriple,int>::iterator,bool> result = uniqueVerts.insert( make_pair( vTriple, mOutputVertices.size() ) );
-				if( result.second ) { // we've got a new, unique vertex here, so let's append it
+				bool inserted;
+				uint32_t index = uniqueVerts.insert( group.mFaces[f].mVertexIndices[v], group.mFaces[f].mTexCoordIndices[v], group.mFaces[f].mNormalIndices[v], (uint32_t)mOutputVertices.size(), &inserted );
+				if( inserted ) { // we've got a new, unique vertex here, so let's append it
 					mOutputVertices.push_back( mInternalVertices[group.mFaces[f].mVertexIndices[v]] );
 					mOutputNormals.push_back( mInternalNormals[group.mFaces[f].mNormalIndices[v]] );
 					mOutputTexCoords.push_back( mInternalTexCoords[group.mFaces[f].mTexCoordIndices[v]] );
@@ -451,7 +846,7 @@ void ObjLoader::loadGroupNormalsTextures( const Group &group, map<VertexTriple,i
 						mOutputColors.push_back( rgb );
 				}
 				// the unique ID of the vertex is appended for this vert
-				faceIndices.push_back( result.first->second );
+				faceIndices.push_back( index );
 			}
 			else { // have to force unique because this group lacks either normals or texCoords
 				faceIndices.push_back( (int32_t)mOutputVertices.size() );
@@ -477,7 +872,7 @@ void ObjLoader::loadGroupNormalsTextures( const Group &group, map<VertexTriple,i
 	}
 }
 
-void ObjLoader::loadGroupNormals( const Group &group, map<VertexPair,int> &uniqueVerts ) const
+void ObjLoader::loadGroupNormals( const Group &group, VertexHash &uniqueVerts ) const
 {
     bool hasColors = mMaterials.size() > 0;
 	for( size_t f = 0; f < group.mFaces.size(); ++f ) {
@@ -508,16 +903,16 @@ void ObjLoader::loadGroupNormals( const Group &group, map<VertexPair,int> &uniqu
 		faceIndices.reserve( group.mFaces[f].mNumVertices );
 		for( int v = 0; v < group.mFaces[f].mNumVertices; ++v ) {
 			if( ! forceUnique ) {
-				VertexPair vPair = make_tuple( group.mFaces[f].mVertexIndices[v], group.mFaces[f].mNormalIndices[v] );
-				pair<map<VertexPair,int>::iterator,bool> result = uniqueVerts.insert( make_pair( vPair, mOutputVertices.size() ) );
-				if( result.second ) { // we've got a new, unique vertex here, so let's append it
+				bool inserted;
+				uint32_t index = uniqueVerts.insert( group.mFaces[f].mVertexIndices[v], 0, group.mFaces[f].mNormalIndices[v], (uint32_t)mOutputVertices.size(), &inserted );
+				if( inserted ) { // we've got a new, unique vertex here, so let's append it
 					mOutputVertices.push_back( mInternalVertices[group.mFaces[f].mVertexIndices[v]] );
 					mOutputNormals.push_back( mInternalNormals[group.mFaces[f].mNormalIndices[v]] );
                     if( hasColors )
                         mOutputColors.push_back( rgb );
 				}
 				// the unique ID of the vertex is appended for this vert
-				faceIndices.push_back( result.first->second );
+				faceIndices.push_back( index );
 			}
 			else { // have to force unique because this group lacks normals
 				faceIndices.push_back( (int32_t)mOutputVertices.size() );
@@ -539,7 +934,7 @@ void ObjLoader::loadGroupNormals( const Group &group, map<VertexPair,int> &uniqu
 	}
 }
 
-void ObjLoader::loadGroupTextures( const Group &group, map<VertexPair,int> &uniqueVerts ) const
+void ObjLoader::loadGroupTextures( const Group &group, VertexHash &uniqueVerts ) const
 {
     bool hasColors = mMaterials.size() > 0;
 	for( size_t f = 0; f < group.mFaces.size(); ++f ) {
@@ -565,16 +960,16 @@ void ObjLoader::loadGroupTextures( const Group &group, map<VertexPair,int> &uniq
 		faceIndices.reserve( group.mFaces[f].mNumVertices );
 		for( int v = 0; v < group.mFaces[f].mNumVertices; ++v ) {
 			if( ! forceUnique ) {
-				VertexPair vPair = make_tuple( group.mFaces[f].mVertexIndices[v], group.mFaces[f].mTexCoordIndices[v] );
-				pair<map<VertexPair,int>::iterator,bool> result = uniqueVerts.insert( make_pair( vPair, mOutputVertices.size() ) );
-				if( result.second ) { // we've got a new, unique vertex here, so let's append it
+				bool inserted;
+				uint32_t index = uniqueVerts.insert( group.mFaces[f].mVertexIndices[v], group.mFaces[f].mTexCoordIndices[v], 0, (uint32_t)mOutputVertices.size(), &inserted );
+				if( inserted ) { // we've got a new, unique vertex here, so let's append it
 					mOutputVertices.push_back( mInternalVertices[group.mFaces[f].mVertexIndices[v]] );
 					mOutputTexCoords.push_back( mInternalTexCoords[group.mFaces[f].mTexCoordIndices[v]] );
                     if( hasColors )
                         mOutputColors.push_back( rgb );
 				}
 				// the unique ID of the vertex is appended for this vert
-				faceIndices.push_back( result.first->second );
+				faceIndices.push_back( index );
 			}
 			else { // have to force unique because this group lacks texCoords
 				faceIndices.push_back( (int32_t)mOutputVertices.size() );
@@ -596,7 +991,7 @@ void ObjLoader::loadGroupTextures( const Group &group, map<VertexPair,int> &uniq
 	}
 }
 
-void ObjLoader::loadGroup( const Group &group, map<int,int> &uniqueVerts ) const
+void ObjLoader::loadGroup( const Group &group, VertexHash &uniqueVerts ) const
 {
     bool hasColors = mMaterials.size() > 0;
 	for( size_t f = 0; f < group.mFaces.size(); ++f ) {
@@ -617,14 +1012,15 @@ void ObjLoader::loadGroup( const Group &group, map<int,int> &uniqueVerts ) const
 		vector<int> faceIndices;
 		faceIndices.reserve( group.mFaces[f].mNumVertices );
 		for( int v = 0; v < group.mFaces[f].mNumVertices; ++v ) {
-			pair<map<int,int>::iterator,bool> result = uniqueVerts.insert( make_pair( group.mFaces[f].mVertexIndices[v], mOutputVertices.size() ) );
-			if( result.second ) { // we've got a new, unique vertex here, so let's append it
+			bool inserted;
+			uint32_t index = uniqueVerts.insert( group.mFaces[f].mVertexIndices[v], 0, 0, (uint32_t)mOutputVertices.size(), &inserted );
+			if( inserted ) { // we've got a new, unique vertex here, so let's append it
 				mOutputVertices.push_back( mInternalVertices[group.mFaces[f].mVertexIndices[v]] );
                 if( hasColors )
                     mOutputColors.push_back( rgb );
 			}
 			// the unique ID of the vertex is appended for this vert
-			faceIndices.push_back( result.first->second );
+			faceIndices.push_back( index );
 		}
 
 		int32_t triangles = (int32_t)faceIndices.size() - 2;
@@ -772,4 +1168,34 @@ void writeObj( const DataTargetRef &dataTarget, const geom::Source &source, bool
 		target->generateIndices( geom::Primitive::TRIANGLES, source.getNumVertices() );
 }
 
+geom::SourceRef loadObjCached( const fs::path &path, const fs::path &cachePath, bool includeNormals, bool includeTexCoords )
+{
+	// the default name tells apart caches written with different attributes
+	const fs::path cache = cachePath.empty()
+		? fs::path( path.string() + ( includeNormals ? "" : ".nonormals" ) + ( includeTexCoords ? "" : ".notexcoords" ) + ".msh" ) : cachePath;
+	if( fs::exists( cache ) && fs::last_write_time( cache ) >= fs::last_write_time( path ) ) {
+		try {
+			return MappedTriMesh::create( loadFile( cache ) );
+		}
+		catch( const Exception &exc ) {
+			CI_LOG_W( "ignoring invalid OBJ cache " << cache << ": " << exc.what() );
+		}
+	}
+
+	// written next to the cache and renamed over it, so that an interrupted write never leaves a truncated cache that looks up to date
+	TriMeshRef result = TriMesh::create( ObjLoader( loadFile( path ), includeNormals, includeTexCoords ) );
+	const fs::path temp = cache.string() + ".tmp";
+	try {
+		result->write( writeFile( temp ), TriMesh::WriteOptions() );
+		fs::rename( temp, cache );
+	}
+	catch( const std::exception &exc ) {
+		CI_LOG_W( "failed to write OBJ cache " << cache << ": " << exc.what() );
+		std::error_code ec;
+		fs::remove( temp, ec );
+	}
+
+	return result;
+}
+
 } // namespace cinder
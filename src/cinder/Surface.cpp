@@ -37,6 +37,7 @@
 #endif
 
 #include "cinder/ChanTraits.h"
+#include "cinder/ImageDecodeService.h"
 #include "cinder/ImageIo.h"
 #include "cinder/ip/Fill.h"
 
@@ -271,43 +272,26 @@ SurfaceT<T>::SurfaceT( ImageSourceRef imageSource, const SurfaceConstraints &con
 	init( imageSource, constraints, alpha );
 }
 
-#if defined( CINDER_UWP )
 template<typename T>
-void SurfaceT<T>::loadImageAsync(const fs::path path, SurfaceT &surface, const SurfaceConstraints &constraints )
+ImageDecodeRequestRef SurfaceT<T>::loadImageAsync( const fs::path &path, const std::function<void ( std::shared_ptr<SurfaceT<T>> )> &callback, int priority )
 {
-	loadImageAsync( path, surface, constraints, surface.hasAlpha() );
+	return ImageDecodeService::instance().loadSurface<T>( path, callback, priority );
 }
 
 template<typename T>
-void SurfaceT<T>::loadImageAsync(const fs::path path, SurfaceT &surface, const SurfaceConstraints &constraints, bool alpha )
+ImageDecodeRequestRef SurfaceT<T>::loadImageAsync( const fs::path path, SurfaceT &surface, const SurfaceConstraints &constraints )
 {
-	auto loadImageTask = create_task([path]() -> ImageSourceRef
-	{
-		return loadImage(path);
-	});
-
-	  // Task-based continuation.
-    auto c2 = loadImageTask.then([path, &surface,constraints,alpha](task<ImageSourceRef> previousTask)
-    {
-        // We do expect to get here because task-based continuations 
-        // are scheduled even when the antecedent task throws. 
-        try
-        {
-			surface = SurfaceT(previousTask.get(),constraints, alpha);
-        }
-        catch (const ImageIoExceptionFailedLoad&)
-        {
-			auto copyTask = winrt::copyFileToTempDirAsync(path);
-			copyTask.then([path, &surface,constraints,alpha](StorageFile^ file) 
-			{
-				fs::path temp = fs::path( msw::toUtf8String( file->Path->Data() ) );
-				surface = SurfaceT(loadImage(fs::path(temp)),constraints, alpha);
-				winrt::deleteFileAsync(temp);
-			});
-        }
-    });
+	return loadImageAsync( path, surface, constraints, surface.hasAlpha() );
+}
+
+template<typename T>
+ImageDecodeRequestRef SurfaceT<T>::loadImageAsync( const fs::path path, SurfaceT &surface, const SurfaceConstraints &constraints, bool alpha )
+{
+	return ImageDecodeService::instance().loadSurface<T>( path, [&surface]( std::shared_ptr<SurfaceT<T>> result ) {
+		if( result )
+			surface = *result;
+	}, constraints, alpha );
 }
-#endif
 
 template<typename T>
 SurfaceT<T>& SurfaceT<T>::operator=( const SurfaceT<T> &rhs )
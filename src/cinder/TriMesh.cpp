@@ -25,6 +25,10 @@
 
 #include "cinder/TriMesh.h"
 #include "cinder/Exception.h"
+#include "cinder/ip/Parallel.h"
+#include "glm/gtc/packing.hpp"
+
+#include <cstring>
 #if defined( CINDER_ANDROID )
 	#include "cinder/android/CinderAndroid.h"
 #endif 
@@ -446,6 +450,141 @@ AxisAlignedBox TriMesh::calcBoundingBox( const mat4 &transform ) const
 	return AxisAlignedBox( min, max );
 }
 
+namespace {
+
+// Version 3 layout, in native byte order, which is little-endian on every platform Cinder supports: a V3Header, a table of V3Blocks, then the data of each block at an offset from the start of the file
+// that is a multiple of V3_ALIGNMENT, so that a mapping of the file can be used in place. Vertex attributes all hold the number of positions.
+const uint8_t	V3_VERSION		= 3;
+const size_t	V3_ALIGNMENT	= 64;
+const size_t	V3_INDEX_CHUNK	= 1 << 16;	// compressed indices restart every chunk, so that chunks decode in parallel
+
+enum V3Encoding : uint8_t {
+	V3_FLOAT32,			// dims floats per vertex
+	V3_UNORM16,			// dims uint16_t fractions of the bounds per vertex, as value = min + q * scale
+	V3_OCTAHEDRAL16,	// 2 int16_t octahedral coordinates per unit vector
+	V3_HALF,			// dims half floats per vertex
+	V3_INDEX32,			// uint32_t indices
+	V3_INDEX_VARINT		// uint64_t offsets of numChunks + 1 chunks from the start of the block, then per chunk the zigzag LEB128 differences from the previous index
+};
+
+struct V3Header {
+	uint8_t		mVersion;		// the only field in common with earlier versions
+	uint8_t		mReserved[3];
+	uint32_t	mNumBlocks;
+	uint64_t	mNumVertices;
+	uint64_t	mNumIndices;
+};
+
+struct V3Block {
+	uint32_t	mAttribMask;	// TriMesh::toMask(), or 0 for the indices
+	uint8_t		mDims;
+	uint8_t		mEncoding;
+	uint16_t	mReserved;
+	uint64_t	mCount;			// vertices, or indices
+	uint64_t	mOffset;
+	uint64_t	mSize;
+	float		mMin[4], mScale[4];
+};
+
+static_assert( sizeof( V3Header ) == 24 && sizeof( V3Block ) == 64, "TriMesh version 3 headers must be packed" );
+
+const size_t CODEC_GRAIN_SIZE = 16384;
+
+size_t alignV3( size_t offset )
+{
+	return ( offset + V3_ALIGNMENT - 1 ) & ~( V3_ALIGNMENT - 1 );
+}
+
+size_t calcNumIndexChunks( size_t numIndices )
+{
+	return ( numIndices + V3_INDEX_CHUNK - 1 ) / V3_INDEX_CHUNK;
+}
+
+// maps the unit sphere onto the octahedron |x| + |y| + |z| = 1, then unfolds its lower half over the corners of the square [-1, 1]^2
+vec2 octahedralEncode( const vec3 &n )
+{
+	const float sum = std::abs( n.x ) + std::abs( n.y ) + std::abs( n.z );
+	if( sum == 0 )
+		return vec2( 0 );
+	vec2 p = vec2( n ) / sum;
+	if( n.z < 0 )
+		p = ( vec2( 1 ) - abs( vec2( p.y, p.x ) ) ) * vec2( p.x >= 0 ? 1 : -1, p.y >= 0 ? 1 : -1 );
+	return p;
+}
+
+vec3 octahedralDecode( const vec2 &p )
+{
+	vec3 n( p.x, p.y, 1 - std::abs( p.x ) - std::abs( p.y ) );
+	if( n.z < 0 ) {
+		const vec2 folded = ( vec2( 1 ) - abs( vec2( n.y, n.x ) ) ) * vec2( n.x >= 0 ? 1 : -1, n.y >= 0 ? 1 : -1 );
+		n.x = folded.x;
+		n.y = folded.y;
+	}
+	return normalize( n );
+}
+
+// quantizes \a n, choosing whichever neighboring grid point decodes closest to it rather than the nearest one
+void octahedralEncode16( const vec3 &n, int16_t *result )
+{
+	const vec2 p = octahedralEncode( n ) * 32767.0f;
+	float bestDot = -2;
+	for( int i = 0; i < 4; ++i ) {
+		const vec2 q = glm::clamp( vec2( ( i & 1 ) ? std::ceil( p.x ) : std::floor( p.x ), ( i & 2 ) ? std::ceil( p.y ) : std::floor( p.y ) ), vec2( -32767 ), vec2( 32767 ) );
+		const float d = dot( octahedralDecode( q / 32767.0f ), n );
+		if( d > bestDot ) {
+			bestDot = d;
+			result[0] = (int16_t)q.x;
+			result[1] = (int16_t)q.y;
+		}
+	}
+}
+
+void encodeIndexChunk( const uint32_t *indices, size_t numIndices, std::vector<uint8_t> *result )
+{
+	result->clear();
+	uint32_t previous = 0;
+	for( size_t i = 0; i < numIndices; ++i ) {
+		const int32_t delta = int32_t( indices[i] - previous );
+		uint32_t zigzag = ( uint32_t( delta ) << 1 ) ^ uint32_t( delta >> 31 );
+		while( zigzag >= 0x80 ) {
+			result->push_back( uint8_t( zigzag | 0x80 ) );
+			zigzag >>= 7;
+		}
+		result->push_back( uint8_t( zigzag ) );
+		previous = indices[i];
+	}
+}
+
+// returns whether every index refers to one of the vertices
+bool indicesInRange( const uint32_t *indices, size_t numIndices, uint64_t numVertices )
+{
+	uint32_t maxIndex = 0;
+	for( size_t i = 0; i < numIndices; ++i )
+		maxIndex = std::max( maxIndex, indices[i] );
+	return numIndices == 0 || maxIndex < numVertices;
+}
+
+// stops at \a end on malformed data, leaving the rest of \a result as it was
+void decodeIndexChunk( const uint8_t *data, const uint8_t *end, size_t numIndices, uint32_t *result )
+{
+	uint32_t previous = 0;
+	for( size_t i = 0; i < numIndices; ++i ) {
+		uint32_t zigzag = 0;
+		for( int shift = 0; ; shift += 7 ) {
+			if( data == end || shift > 28 )
+				return;
+			const uint8_t byte = *data++;
+			zigzag |= uint32_t( byte & 0x7f ) << shift;
+			if( ! ( byte & 0x80 ) )
+				break;
+		}
+		previous += uint32_t( zigzag >> 1 ) ^ ( 0 - ( zigzag & 1 ) );
+		result[i] = previous;
+	}
+}
+
+} // anonymous namespace
+
 void TriMesh::read( const DataSourceRef &dataSource )
 {
 	IStreamRef in = dataSource->createStream();
@@ -461,11 +600,28 @@ void TriMesh::read( const DataSourceRef &dataSource )
 		clear();
 		readImplV2( in );
 	}
+	else if( versionNumber == V3_VERSION ) {
+		in.reset();
+		readImplV3( dataSource );
+	}
 	else {
-		throw Exception( "TriMesh::read() error: wrong version number. expected version = 1 or 2, version read: " + std::to_string( versionNumber ) );
+		throw Exception( "TriMesh::read() error: wrong version number. expected version = 1, 2 or 3, version read: " + std::to_string( versionNumber ) );
 	}
 }
 
+TriMesh::WriteOptions::WriteOptions()
+	: mAttribMask( ~0u ), mQuantizePositions( false ), mQuantizeNormals( false ), mQuantizeTexCoords( false ), mCompressIndices( false )
+{
+}
+
+TriMesh::WriteOptions& TriMesh::WriteOptions::attribs( const std::set<geom::Attrib> &attribs )
+{
+	mAttribMask = 0;
+	for( auto &attrib : attribs )
+		mAttribMask |= toMask( attrib );
+	return *this;
+}
+
 void TriMesh::write( const DataTargetRef &dataTarget, bool writeNormals, bool writeTangents ) const
 {
 	uint32_t mask = ~0u;
@@ -515,6 +671,199 @@ void TriMesh::write( const DataTargetRef &dataTarget, uint32_t writeMask ) const
 	writeAttrib( toMask( geom::BITANGENT ), mBitangentsDims, mBitangents.size() * 3, mBitangents.data() );
 }
 
+void TriMesh::write( const DataTargetRef &dataTarget, const WriteOptions &options ) const
+{
+	// blocks stored as floats are written straight from the mesh, the others from 'mStorage'
+	struct PendingBlock {
+		V3Block					mBlock;
+		const void				*mData;
+		std::vector<uint8_t>	mStorage;
+	};
+	std::vector<PendingBlock> blocks;
+
+	const size_t numVertices = getNumVertices();
+	const struct {
+		geom::Attrib	mAttrib;
+		uint8_t			mDims;
+		const float		*mData;
+		size_t			mNumFloats;
+	} attribs[] = {
+		{ geom::POSITION, mPositionsDims, mPositions.data(), mPositions.size() },
+		{ geom::COLOR, mColorsDims, mColors.data(), mColors.size() },
+		{ geom::NORMAL, mNormalsDims, reinterpret_cast<const float*>( mNormals.data() ), mNormals.size() * 3 },
+		{ geom::TEX_COORD_0, mTexCoords0Dims, mTexCoords0.data(), mTexCoords0.size() },
+		{ geom::TEX_COORD_1, mTexCoords1Dims, mTexCoords1.data(), mTexCoords1.size() },
+		{ geom::TEX_COORD_2, mTexCoords2Dims, mTexCoords2.data(), mTexCoords2.size() },
+		{ geom::TEX_COORD_3, mTexCoords3Dims, mTexCoords3.data(), mTexCoords3.size() },
+		{ geom::TANGENT, mTangentsDims, reinterpret_cast<const float*>( mTangents.data() ), mTangents.size() * 3 },
+		{ geom::BITANGENT, mBitangentsDims, reinterpret_cast<const float*>( mBitangents.data() ), mBitangents.size() * 3 }
+	};
+
+	for( const auto &attrib : attribs ) {
+		// an attribute with a different number of elements than there are positions can't be a vertex attribute
+		if( ! ( options.mAttribMask & toMask( attrib.mAttrib ) ) || attrib.mDims == 0 || attrib.mDims > 4 || attrib.mNumFloats == 0 || attrib.mNumFloats != numVertices * attrib.mDims )
+			continue;
+
+		blocks.emplace_back();
+		PendingBlock &pending = blocks.back();
+		V3Block &block = pending.mBlock;
+		memset( &block, 0, sizeof( block ) );
+		block.mAttribMask = toMask( attrib.mAttrib );
+		block.mDims = attrib.mDims;
+		block.mCount = numVertices;
+
+		const uint8_t dims = attrib.mDims;
+		const float *data = attrib.mData;
+		const bool isUnitVector = attrib.mAttrib == geom::NORMAL || attrib.mAttrib == geom::TANGENT || attrib.mAttrib == geom::BITANGENT;
+		const bool isTexCoord = attrib.mAttrib == geom::TEX_COORD_0 || attrib.mAttrib == geom::TEX_COORD_1 || attrib.mAttrib == geom::TEX_COORD_2 || attrib.mAttrib == geom::TEX_COORD_3;
+		if( attrib.mAttrib == geom::POSITION && options.mQuantizePositions ) {
+			block.mEncoding = V3_UNORM16;
+			float invScale[4];
+			for( uint8_t c = 0; c < dims; ++c ) {
+				float min = std::numeric_limits<float>::max(), max = -std::numeric_limits<float>::max();
+				for( size_t v = 0; v < numVertices; ++v ) {
+					min = std::min( min, data[v * dims + c] );
+					max = std::max( max, data[v * dims + c] );
+				}
+				block.mMin[c] = min;
+				block.mScale[c] = ( max - min ) / 65535.0f;
+				invScale[c] = ( max > min ) ? 65535.0f / ( max - min ) : 0;
+			}
+			pending.mStorage.resize( numVertices * dims * sizeof( uint16_t ) );
+			uint16_t *result = reinterpret_cast<uint16_t*>( pending.mStorage.data() );
+			ip::parallelFor( numVertices * dims, CODEC_GRAIN_SIZE, [&]( size_t begin, size_t end ) {
+				for( size_t i = begin; i < end; ++i )
+					result[i] = (uint16_t)glm::clamp( std::round( ( data[i] - block.mMin[i % dims] ) * invScale[i % dims] ), 0.0f, 65535.0f );
+			} );
+		}
+		else if( isUnitVector && dims == 3 && options.mQuantizeNormals ) {
+			block.mEncoding = V3_OCTAHEDRAL16;
+			pending.mStorage.resize( numVertices * 2 * sizeof( int16_t ) );
+			int16_t *result = reinterpret_cast<int16_t*>( pending.mStorage.data() );
+			ip::parallelFor( numVertices, CODEC_GRAIN_SIZE, [&]( size_t begin, size_t end ) {
+				for( size_t v = begin; v < end; ++v )
+					octahedralEncode16( vec3( data[v * 3], data[v * 3 + 1], data[v * 3 + 2] ), &result[v * 2] );
+			} );
+		}
+		else if( isTexCoord && options.mQuantizeTexCoords ) {
+			block.mEncoding = V3_HALF;
+			pending.mStorage.resize( numVertices * dims * sizeof( uint16_t ) );
+			uint16_t *result = reinterpret_cast<uint16_t*>( pending.mStorage.data() );
+			ip::parallelFor( numVertices * dims, CODEC_GRAIN_SIZE, [&]( size_t begin, size_t end ) {
+				for( size_t i = begin; i < end; ++i )
+					result[i] = glm::packHalf1x16( data[i] );
+			} );
+		}
+		else {
+			block.mEncoding = V3_FLOAT32;
+			pending.mData = data;
+			block.mSize = attrib.mNumFloats * sizeof( float );
+		}
+
+		if( block.mEncoding != V3_FLOAT32 ) {
+			pending.mData = pending.mStorage.data();
+			block.mSize = pending.mStorage.size();
+		}
+	}
+
+	if( ! mIndices.empty() ) {
+		blocks.emplace_back();
+		PendingBlock &pending = blocks.back();
+		V3Block &block = pending.mBlock;
+		memset( &block, 0, sizeof( block ) );
+		block.mCount = mIndices.size();
+		if( options.mCompressIndices ) {
+			block.mEncoding = V3_INDEX_VARINT;
+			const size_t numChunks = calcNumIndexChunks( mIndices.size() );
+			std::vector<std::vector<uint8_t>> chunks( numChunks );
+			ip::parallelFor( numChunks, 1, [&]( size_t begin, size_t end ) {
+				for( size_t c = begin; c < end; ++c )
+					encodeIndexChunk( mIndices.data() + c * V3_INDEX_CHUNK, std::min( V3_INDEX_CHUNK, mIndices.size() - c * V3_INDEX_CHUNK ), &chunks[c] );
+			} );
+
+			std::vector<uint64_t> offsets( numChunks + 1 );
+			offsets[0] = offsets.size() * sizeof( uint64_t );
+			for( size_t c = 0; c < numChunks; ++c )
+				offsets[c + 1] = offsets[c] + chunks[c].size();
+			pending.mStorage.resize( offsets.back() );
+			memcpy( pending.mStorage.data(), offsets.data(), offsets.size() * sizeof( uint64_t ) );
+			for( size_t c = 0; c < numChunks; ++c )
+				std::copy( chunks[c].begin(), chunks[c].end(), pending.mStorage.begin() + offsets[c] );
+			pending.mData = pending.mStorage.data();
+			block.mSize = pending.mStorage.size();
+		}
+		else {
+			block.mEncoding = V3_INDEX32;
+			pending.mData = mIndices.data();
+			block.mSize = mIndices.size() * sizeof( uint32_t );
+		}
+	}
+
+	V3Header header;
+	memset( &header, 0, sizeof( header ) );
+	header.mVersion = V3_VERSION;
+	header.mNumBlocks = (uint32_t)blocks.size();
+	header.mNumVertices = numVertices;
+	header.mNumIndices = mIndices.size();
+
+	size_t offset = alignV3( sizeof( V3Header ) + blocks.size() * sizeof( V3Block ) );
+	for( auto &pending : blocks ) {
+		pending.mBlock.mOffset = offset;
+		offset = alignV3( offset + (size_t)pending.mBlock.mSize );
+	}
+
+	OStreamRef out = dataTarget->getStream();
+	out->writeData( &header, sizeof( header ) );
+	for( const auto &pending : blocks )
+		out->writeData( &pending.mBlock, sizeof( V3Block ) );
+
+	static const uint8_t padding[V3_ALIGNMENT] = {};
+	size_t written = sizeof( V3Header ) + blocks.size() * sizeof( V3Block );
+	for( const auto &pending : blocks ) {
+		if( pending.mBlock.mOffset > written ) // zero-length writes throw
+			out->writeData( padding, (size_t)pending.mBlock.mOffset - written );
+		out->writeData( pending.mData, (size_t)pending.mBlock.mSize );
+		written = (size_t)( pending.mBlock.mOffset + pending.mBlock.mSize );
+	}
+}
+
+void TriMesh::readImplV3( const DataSourceRef &dataSource )
+{
+	MappedTriMesh mesh( dataSource );
+
+	clear();
+	mTexCoords3.clear();
+	mPositionsDims = mColorsDims = mNormalsDims = mTangentsDims = mBitangentsDims = 0;
+	mTexCoords0Dims = mTexCoords1Dims = mTexCoords2Dims = mTexCoords3Dims = 0;
+
+	const size_t numVertices = mesh.getNumVertices();
+	auto readFloats = [&]( geom::Attrib attr, uint8_t *dims, std::vector<float> *data ) {
+		*dims = mesh.getAttribDims( attr );
+		data->resize( numVertices * *dims );
+		if( *dims )
+			mesh.decodeAttrib( attr, data->data() );
+	};
+	auto readVec3s = [&]( geom::Attrib attr, uint8_t *dims, std::vector<vec3> *data ) {
+		*dims = ( mesh.getAttribDims( attr ) == 3 ) ? 3 : 0;
+		data->resize( *dims ? numVertices : 0 );
+		if( *dims )
+			mesh.decodeAttrib( attr, reinterpret_cast<float*>( data->data() ) );
+	};
+
+	readFloats( geom::POSITION, &mPositionsDims, &mPositions );
+	readFloats( geom::COLOR, &mColorsDims, &mColors );
+	readVec3s( geom::NORMAL, &mNormalsDims, &mNormals );
+	readFloats( geom::TEX_COORD_0, &mTexCoords0Dims, &mTexCoords0 );
+	readFloats( geom::TEX_COORD_1, &mTexCoords1Dims, &mTexCoords1 );
+	readFloats( geom::TEX_COORD_2, &mTexCoords2Dims, &mTexCoords2 );
+	readFloats( geom::TEX_COORD_3, &mTexCoords3Dims, &mTexCoords3 );
+	readVec3s( geom::TANGENT, &mTangentsDims, &mTangents );
+	readVec3s( geom::BITANGENT, &mBitangentsDims, &mBitangents );
+
+	mIndices.resize( mesh.getNumIndices() );
+	mesh.decodeIndices( mIndices.data() );
+}
+
 // used in 0.9.0
 void TriMesh::readImplV2( const IStreamRef &in )
 {
@@ -632,84 +981,25 @@ void TriMesh::readImplV1( const IStreamRef &in )
 }
 
 bool TriMesh::recalculateNormals( bool smooth, bool weighted )
+{
+	return recalculateNormals( weighted ? geom::NormalWeighting::AREA : geom::NormalWeighting::UNIFORM, smooth );
+}
+
+bool TriMesh::recalculateNormals( geom::NormalWeighting weighting, bool smooth )
 {
 	// requires valid indices and 3D vertices
 	if( mIndices.empty() || mPositions.empty() || mPositionsDims != 3 )
 		return false;
 
 	size_t numPositions = mPositions.size() / 3;
-	mNormals.assign( numPositions, vec3() );
+	const vec3 *positions = reinterpret_cast<const vec3*>( mPositions.data() );
 
 	// for smooth renormalization, we first find all unique vertices and keep track of them
 	std::vector<uint32_t> uniquePositions;
-	if( smooth ) {
-		uniquePositions.assign( numPositions, 0 );
-
-		for( uint32_t i = 0; i < numPositions; ++i ) {
-			if( uniquePositions[i] == 0 ) {
-				uniquePositions[i] = i + 1;
-				const vec3 &v0 = *(const vec3*)(&mPositions[i * 3]);
-				for( size_t j = i + 1; j < numPositions; ++j ) {
-					const vec3 &v1 = *(const vec3*)(&mPositions[j * 3]);
-					if( length2( v1 - v0 ) < FLT_EPSILON )
-						uniquePositions[j] = uniquePositions[i];
-				}
-			}
-		}
-	}
-
-	// perform surface normalization
-	uint32_t index0, index1, index2;
-	size_t numTriangles = getNumTriangles();
-	for( size_t i = 0; i < numTriangles; ++i ) {
-		if( smooth ) {
-			index0 = uniquePositions[mIndices[i * 3 + 0]] - 1;
-			index1 = uniquePositions[mIndices[i * 3 + 1]] - 1;
-			index2 = uniquePositions[mIndices[i * 3 + 2]] - 1;
-		}
-		else {
-			index0 = mIndices[i*3+0];
-			index1 = mIndices[i*3+1];
-			index2 = mIndices[i*3+2];
-		}
-
-		const vec3 &v0 = *(const vec3*)(&mPositions[index0 * 3]);
-		const vec3 &v1 = *(const vec3*)(&mPositions[index1 * 3]);
-		const vec3 &v2 = *(const vec3*)(&mPositions[index2 * 3]);
-
-		vec3 e0 = v1 - v0;
-		vec3 e1 = v2 - v0;
-		vec3 e2 = v2 - v1;
-
-		if( length2( e0 ) < FLT_EPSILON )
-			continue;
-		if( length2( e1 ) < FLT_EPSILON )
-			continue;
-		if( length2( e2 ) < FLT_EPSILON )
-			continue;
+	if( smooth )
+		geom::calculateWeldRemap( numPositions, positions, sqrt( FLT_EPSILON ), &uniquePositions );
 
-		vec3 normal = cross( e0, e1 );
-
-		// if not weighted, every normal has an equal contribution
-		if( ! weighted )
-			normal = normalize( normal );
-
-		mNormals[ index0 ] += normal;
-		mNormals[ index1 ] += normal;
-		mNormals[ index2 ] += normal;
-	}
-
-	// now normalize the summed normals
-	for( auto &normal : mNormals ) {
-		normal = normalize( normal );
-	}
-
-	// copy normals to corresponding non-unique vertices
-	if( smooth ) {
-		for( size_t i = 0; i < numPositions; ++i ) {
-			mNormals[i] = mNormals[uniquePositions[i]-1];
-		}
-	}
+	geom::calculateNormals( mIndices.size(), mIndices.data(), numPositions, positions, weighting, &mNormals, smooth ? uniquePositions.data() : nullptr );
 
 	mNormalsDims = 3;
 
@@ -743,17 +1033,204 @@ bool TriMesh::recalculateBitangents()
 	if( ! ( hasTangents() || recalculateTangents() ) )
 		return false;
 
-	mBitangents.assign( mNormals.size(), vec3() );
+	mBitangents.resize( mNormals.size() );
 
-	size_t n = getNumVertices();
-	for( size_t i = 0; i < n; ++i )
-		mBitangents[i] = normalize( cross( mNormals[i], mTangents[i] ) );
+	ip::parallelFor( getNumVertices(), 16384, [this]( size_t begin, size_t end ) {
+		for( size_t i = begin; i < end; ++i )
+			mBitangents[i] = normalize( cross( mNormals[i], mTangents[i] ) );
+	} );
 
 	mBitangentsDims = 3;
 
 	return true;
 }
 
+namespace {
+
+// Moves the attributes of every vertex that maps to itself in 'remap' to its slot in 'outIndices' and drops the rest.
+// Slots never exceed the original index, so this works in place.
+template<typename T>
+void compactVertices( std::vector<T> *data, size_t dims, const std::vector<uint32_t> &remap, const std::vector<uint32_t> &outIndices, size_t numOutVertices )
+{
+	if( data->empty() )
+		return;
+
+	for( size_t v = 0; v < remap.size(); ++v )
+		if( remap[v] == v )
+			std::copy( data->begin() + v * dims, data->begin() + ( v + 1 ) * dims, data->begin() + outIndices[v] * dims );
+	data->resize( numOutVertices * dims );
+}
+
+// Moves the attributes of every vertex v to slot 'remap[v]'; 'remap' is a permutation.
+template<typename T>
+void reorderVertices( std::vector<T> *data, size_t dims, const std::vector<uint32_t> &remap )
+{
+	if( data->empty() )
+		return;
+
+	std::vector<T> result( data->size() );
+	for( size_t v = 0; v < remap.size(); ++v )
+		std::copy( data->begin() + v * dims, data->begin() + ( v + 1 ) * dims, result.begin() + remap[v] * dims );
+	data->swap( result );
+}
+
+} // anonymous namespace
+
+void TriMesh::weld( float epsilon, bool positionsOnly )
+{
+	if( mPositions.empty() || mPositionsDims != 3 )
+		return;
+
+	const size_t numVertices = getNumVertices();
+
+	std::function<bool ( uint32_t, uint32_t )> equalFn;
+	if( ! positionsOnly ) {
+		equalFn = [this, epsilon]( uint32_t a, uint32_t b ) {
+			auto equal = [=]( const float *data, size_t dims ) {
+				for( size_t dim = 0; dim < dims; ++dim )
+					if( std::abs( data[a * dims + dim] - data[b * dims + dim] ) > epsilon )
+						return false;
+				return true;
+			};
+
+			return ( mColors.empty() || equal( mColors.data(), mColorsDims ) )
+				&& ( mNormals.empty() || equal( &mNormals[0].x, 3 ) )
+				&& ( mTangents.empty() || equal( &mTangents[0].x, 3 ) )
+				&& ( mBitangents.empty() || equal( &mBitangents[0].x, 3 ) )
+				&& ( mTexCoords0.empty() || equal( mTexCoords0.data(), mTexCoords0Dims ) )
+				&& ( mTexCoords1.empty() || equal( mTexCoords1.data(), mTexCoords1Dims ) )
+				&& ( mTexCoords2.empty() || equal( mTexCoords2.data(), mTexCoords2Dims ) )
+				&& ( mTexCoords3.empty() || equal( mTexCoords3.data(), mTexCoords3Dims ) );
+		};
+	}
+
+	std::vector<uint32_t> remap;
+	const size_t numOutVertices = geom::calculateWeldRemap( numVertices, reinterpret_cast<const vec3*>( mPositions.data() ), epsilon, &remap, equalFn );
+	if( numOutVertices == numVertices )
+		return;
+
+	// surviving vertices keep their relative order
+	std::vector<uint32_t> outIndices( numVertices );
+	uint32_t numOut = 0;
+	for( size_t v = 0; v < numVertices; ++v )
+		outIndices[v] = ( remap[v] == v ) ? numOut++ : outIndices[remap[v]];
+
+	// non-indexed triangles become indexed, as with geom::Weld
+	if( mIndices.empty() )
+		mIndices = outIndices;
+	else {
+		for( auto &index : mIndices )
+			index = outIndices[index];
+	}
+
+	compactVertices( &mPositions, mPositionsDims, remap, outIndices, numOutVertices );
+	compactVertices( &mColors, mColorsDims, remap, outIndices, numOutVertices );
+	compactVertices( &mNormals, 1, remap, outIndices, numOutVertices );
+	compactVertices( &mTangents, 1, remap, outIndices, numOutVertices );
+	compactVertices( &mBitangents, 1, remap, outIndices, numOutVertices );
+	compactVertices( &mTexCoords0, mTexCoords0Dims, remap, outIndices, numOutVertices );
+	compactVertices( &mTexCoords1, mTexCoords1Dims, remap, outIndices, numOutVertices );
+	compactVertices( &mTexCoords2, mTexCoords2Dims, remap, outIndices, numOutVertices );
+	compactVertices( &mTexCoords3, mTexCoords3Dims, remap, outIndices, numOutVertices );
+}
+
+void TriMesh::optimize( size_t cacheSize, float overdrawThreshold, bool vertexFetch )
+{
+	if( mIndices.size() < 3 )
+		return;
+
+	cacheSize = std::max<size_t>( 3, cacheSize );
+	const size_t numVertices = getNumVertices();
+	geom::optimizeVertexCache( mIndices.size(), mIndices.data(), numVertices, mIndices.data(), cacheSize );
+	if( overdrawThreshold > 0 && mPositionsDims == 3 )
+		geom::optimizeOverdraw( mIndices.size(), mIndices.data(), numVertices, reinterpret_cast<const vec3*>( mPositions.data() ), mIndices.data(), cacheSize, overdrawThreshold );
+
+	if( ! vertexFetch )
+		return;
+
+	std::vector<uint32_t> remap;
+	geom::calculateVertexFetchRemap( mIndices.size(), mIndices.data(), numVertices, &remap );
+	for( auto &index : mIndices )
+		index = remap[index];
+
+	reorderVertices( &mPositions, mPositionsDims, remap );
+	reorderVertices( &mColors, mColorsDims, remap );
+	reorderVertices( &mNormals, 1, remap );
+	reorderVertices( &mTangents, 1, remap );
+	reorderVertices( &mBitangents, 1, remap );
+	reorderVertices( &mTexCoords0, mTexCoords0Dims, remap );
+	reorderVertices( &mTexCoords1, mTexCoords1Dims, remap );
+	reorderVertices( &mTexCoords2, mTexCoords2Dims, remap );
+	reorderVertices( &mTexCoords3, mTexCoords3Dims, remap );
+}
+
+float TriMesh::simplify( float targetRatio, float targetError )
+{
+	if( mPositions.empty() || mPositionsDims != 3 || mIndices.size() < 3 )
+		return 0;
+
+	const size_t numVertices = getNumVertices();
+	const size_t targetNumIndices = size_t( getNumTriangles() * std::max( 0.0f, targetRatio ) ) * 3;
+	float error;
+	mIndices.resize( geom::simplify( mIndices.size(), mIndices.data(), numVertices, reinterpret_cast<const vec3*>( mPositions.data() ), targetNumIndices, targetError, mIndices.data(), &error ) );
+
+	// compactVertices() keeps the vertices that map to themselves
+	std::vector<uint32_t> remap( numVertices, std::numeric_limits<uint32_t>::max() );
+	for( uint32_t index : mIndices )
+		remap[index] = index;
+	std::vector<uint32_t> outIndices( numVertices );
+	uint32_t numOutVertices = 0;
+	for( size_t v = 0; v < numVertices; ++v )
+		outIndices[v] = ( remap[v] == v ) ? numOutVertices++ : 0;
+	for( auto &index : mIndices )
+		index = outIndices[index];
+
+	compactVertices( &mPositions, mPositionsDims, remap, outIndices, numOutVertices );
+	compactVertices( &mColors, mColorsDims, remap, outIndices, numOutVertices );
+	compactVertices( &mNormals, 1, remap, outIndices, numOutVertices );
+	compactVertices( &mTangents, 1, remap, outIndices, numOutVertices );
+	compactVertices( &mBitangents, 1, remap, outIndices, numOutVertices );
+	compactVertices( &mTexCoords0, mTexCoords0Dims, remap, outIndices, numOutVertices );
+	compactVertices( &mTexCoords1, mTexCoords1Dims, remap, outIndices, numOutVertices );
+	compactVertices( &mTexCoords2, mTexCoords2Dims, remap, outIndices, numOutVertices );
+	compactVertices( &mTexCoords3, mTexCoords3Dims, remap, outIndices, numOutVertices );
+
+	return error;
+}
+
+std::vector<std::vector<uint32_t>> TriMesh::calcLodChain( size_t numLevels, float ratio, float targetError, std::vector<float> *resultErrors ) const
+{
+	std::vector<std::vector<uint32_t>> result;
+	if( resultErrors )
+		resultErrors->clear();
+	if( numLevels == 0 )
+		return result;
+
+	result.reserve( numLevels );
+	result.push_back( mIndices );
+	if( resultErrors )
+		resultErrors->push_back( 0 );
+	if( mPositions.empty() || mPositionsDims != 3 )
+		return result;
+
+	// each level is simplified from the previous one, which is much faster than starting over; its error is taken as the sum of the steps
+	float error = 0;
+	for( size_t level = 1; level < numLevels; ++level ) {
+		const size_t previous = level - 1;
+		std::vector<uint32_t> indices( result[previous].size() );
+		const size_t targetNumIndices = size_t( result[previous].size() / 3 * std::max( 0.0f, ratio ) ) * 3;
+		float stepError;
+		indices.resize( geom::simplify( result[previous].size(), result[previous].data(), getNumVertices(), reinterpret_cast<const vec3*>( mPositions.data() ), targetNumIndices, std::max( 0.0f, targetError - error ), indices.data(), &stepError ) );
+		error += stepError;
+
+		result.push_back( std::move( indices ) );
+		if( resultErrors )
+			resultErrors->push_back( error );
+	}
+
+	return result;
+}
+
 //! TODO: optimize memory allocations
 void TriMesh::subdivide( int division, bool normalize )
 {
@@ -1298,4 +1775,220 @@ geom::Attrib TriMesh::fromMask( uint32_t attrib )
 	}
 }
 
+/////////////////////////////////////////////////////////////////////////////////////////////////
+// MappedTriMesh
+MappedTriMesh::MappedTriMesh( const DataSourceRef &dataSource )
+	: mData( nullptr ), mSize( 0 ), mNumVertices( 0 ), mNumIndices( 0 )
+{
+	memset( &mIndices, 0, sizeof( mIndices ) );
+
+	if( dataSource->isFilePath() )
+		mFile = MappedFile::create( dataSource->getFilePath() );
+	if( mFile ) {
+		mData = mFile->getData();
+		mSize = mFile->getSize();
+	}
+	else {
+		mBuffer = dataSource->getBuffer();
+		mData = static_cast<const uint8_t*>( mBuffer->getData() );
+		mSize = mBuffer->getSize();
+	}
+
+	V3Header header;
+	if( mSize < sizeof( header ) )
+		throw Exception( "MappedTriMesh error: file is too short" );
+	memcpy( &header, mData, sizeof( header ) );
+	if( header.mVersion != V3_VERSION )
+		throw Exception( "MappedTriMesh error: wrong version number. expected version = 3, version read: " + std::to_string( header.mVersion ) );
+	if( header.mNumBlocks > ( mSize - sizeof( header ) ) / sizeof( V3Block ) )
+		throw Exception( "MappedTriMesh error: truncated block table" );
+	mNumVertices = (size_t)header.mNumVertices;
+	mNumIndices = (size_t)header.mNumIndices;
+
+	for( uint32_t b = 0; b < header.mNumBlocks; ++b ) {
+		V3Block block;
+		memcpy( &block, mData + sizeof( header ) + b * sizeof( V3Block ), sizeof( block ) );
+		if( block.mOffset > mSize || block.mSize > mSize - block.mOffset || block.mOffset % 4 )
+			throw Exception( "MappedTriMesh error: block " + std::to_string( b ) + " lies outside the file" );
+
+		Block result;
+		result.mDims = block.mDims;
+		result.mEncoding = block.mEncoding;
+		result.mCount = (size_t)block.mCount;
+		result.mData = mData + block.mOffset;
+		result.mSize = (size_t)block.mSize;
+		std::copy( block.mMin, block.mMin + 4, result.mMin );
+		std::copy( block.mScale, block.mScale + 4, result.mScale );
+
+		// every block must hold exactly what its encoding implies
+		size_t expectedSize = 0;
+		switch( block.mEncoding ) {
+			case V3_FLOAT32:		expectedSize = result.mCount * result.mDims * sizeof( float );		break;
+			case V3_UNORM16:		expectedSize = result.mCount * result.mDims * sizeof( uint16_t );	break;
+			case V3_OCTAHEDRAL16:	expectedSize = ( result.mDims == 3 ) ? result.mCount * 2 * sizeof( int16_t ) : 0;	break;
+			case V3_HALF:			expectedSize = result.mCount * result.mDims * sizeof( uint16_t );	break;
+			case V3_INDEX32:		expectedSize = result.mCount * sizeof( uint32_t );					break;
+			case V3_INDEX_VARINT: {
+				const size_t numChunks = calcNumIndexChunks( result.mCount );
+				const size_t tableSize = ( numChunks + 1 ) * sizeof( uint64_t );
+				if( tableSize <= result.mSize && block.mOffset % sizeof( uint64_t ) == 0 ) {
+					const uint64_t *offsets = reinterpret_cast<const uint64_t*>( result.mData );
+					bool ordered = offsets[0] == tableSize && offsets[numChunks] == result.mSize;
+					for( size_t c = 0; c < numChunks && ordered; ++c )
+						ordered = offsets[c] <= offsets[c + 1];
+					expectedSize = ordered ? result.mSize : 0;
+				}
+			}
+			break;
+			default:
+			break;
+		}
+		const bool isIndices = block.mEncoding == V3_INDEX32 || block.mEncoding == V3_INDEX_VARINT;
+		if( expectedSize == 0 || expectedSize != result.mSize || isIndices != ( block.mAttribMask == 0 ) )
+			throw Exception( "MappedTriMesh error: invalid block " + std::to_string( b ) );
+
+		if( isIndices ) {
+			if( result.mCount != mNumIndices )
+				throw Exception( "MappedTriMesh error: index count mismatch" );
+			mIndices = result;
+		}
+		else {
+			if( result.mCount != mNumVertices || result.mDims == 0 || result.mDims > 4 )
+				throw Exception( "MappedTriMesh error: invalid vertex attribute block " + std::to_string( b ) );
+			mBlocks[TriMesh::fromMask( block.mAttribMask )] = result;
+		}
+	}
+
+	if( mNumIndices && ! mIndices.mData )
+		throw Exception( "MappedTriMesh error: missing indices" );
+}
+
+const MappedTriMesh::Block* MappedTriMesh::findBlock( geom::Attrib attr ) const
+{
+	auto blockIt = mBlocks.find( attr );
+	return ( blockIt != mBlocks.end() ) ? &blockIt->second : nullptr;
+}
+
+uint8_t MappedTriMesh::getAttribDims( geom::Attrib attr ) const
+{
+	const Block *block = findBlock( attr );
+	return block ? block->mDims : 0;
+}
+
+geom::AttribSet MappedTriMesh::getAvailableAttribs() const
+{
+	geom::AttribSet result;
+	for( const auto &block : mBlocks )
+		result.insert( block.first );
+	return result;
+}
+
+const float* MappedTriMesh::getAttribData( geom::Attrib attr ) const
+{
+	const Block *block = findBlock( attr );
+	return ( block && block->mEncoding == V3_FLOAT32 ) ? reinterpret_cast<const float*>( block->mData ) : nullptr;
+}
+
+void MappedTriMesh::decodeAttrib( geom::Attrib attr, float *result ) const
+{
+	const Block *block = findBlock( attr );
+	if( ! block )
+		return;
+
+	const uint8_t dims = block->mDims;
+	switch( block->mEncoding ) {
+		case V3_FLOAT32:
+			ip::parallelFor( block->mSize, CODEC_GRAIN_SIZE * sizeof( float ), [&]( size_t begin, size_t end ) {
+				memcpy( reinterpret_cast<uint8_t*>( result ) + begin, block->mData + begin, end - begin );
+			} );
+		break;
+		case V3_UNORM16: {
+			const uint16_t *data = reinterpret_cast<const uint16_t*>( block->mData );
+			ip::parallelFor( block->mCount * dims, CODEC_GRAIN_SIZE, [&]( size_t begin, size_t end ) {
+				for( size_t i = begin; i < end; ++i )
+					result[i] = block->mMin[i % dims] + data[i] * block->mScale[i % dims];
+			} );
+		}
+		break;
+		case V3_OCTAHEDRAL16: {
+			const int16_t *data = reinterpret_cast<const int16_t*>( block->mData );
+			ip::parallelFor( block->mCount, CODEC_GRAIN_SIZE, [&]( size_t begin, size_t end ) {
+				for( size_t v = begin; v < end; ++v ) {
+					const vec3 n = octahedralDecode( vec2( data[v * 2], data[v * 2 + 1] ) / 32767.0f );
+					result[v * 3] = n.x;
+					result[v * 3 + 1] = n.y;
+					result[v * 3 + 2] = n.z;
+				}
+			} );
+		}
+		break;
+		case V3_HALF: {
+			const uint16_t *data = reinterpret_cast<const uint16_t*>( block->mData );
+			ip::parallelFor( block->mCount * dims, CODEC_GRAIN_SIZE, [&]( size_t begin, size_t end ) {
+				for( size_t i = begin; i < end; ++i )
+					result[i] = glm::unpackHalf1x16( data[i] );
+			} );
+		}
+		break;
+	}
+}
+
+const uint32_t* MappedTriMesh::getIndexData() const
+{
+	return ( mIndices.mEncoding == V3_INDEX32 ) ? reinterpret_cast<const uint32_t*>( mIndices.mData ) : nullptr;
+}
+
+void MappedTriMesh::decodeIndices( uint32_t *result ) const
+{
+	if( ! mIndices.mData )
+		return;
+
+	// checked a chunk at a time while it's in cache, so that a corrupt file can't index past the vertices
+	const auto checkRange = [this]( const uint32_t *indices, size_t numIndices ) {
+		if( ! indicesInRange( indices, numIndices, mNumVertices ) )
+			throw Exception( "MappedTriMesh error: index out of range" );
+	};
+
+	if( mIndices.mEncoding == V3_INDEX32 ) {
+		ip::parallelFor( mIndices.mCount, CODEC_GRAIN_SIZE, [&]( size_t begin, size_t end ) {
+			memcpy( result + begin, mIndices.mData + begin * sizeof( uint32_t ), ( end - begin ) * sizeof( uint32_t ) );
+			checkRange( result + begin, end - begin );
+		} );
+	}
+	else {
+		const uint64_t *offsets = reinterpret_cast<const uint64_t*>( mIndices.mData );
+		ip::parallelFor( calcNumIndexChunks( mIndices.mCount ), 1, [&]( size_t begin, size_t end ) {
+			for( size_t c = begin; c < end; ++c ) {
+				const size_t first = c * V3_INDEX_CHUNK, count = std::min( V3_INDEX_CHUNK, mIndices.mCount - first );
+				std::fill( result + first, result + first + count, 0 );
+				decodeIndexChunk( mIndices.mData + offsets[c], mIndices.mData + offsets[c + 1], count, result + first );
+				checkRange( result + first, count );
+			}
+		} );
+	}
+}
+
+void MappedTriMesh::loadInto( geom::Target *target, const geom::AttribSet &requestedAttribs ) const
+{
+	std::vector<float> decoded;
+	for( const auto &block : mBlocks ) {
+		if( ! requestedAttribs.count( block.first ) )
+			continue;
+		const float *data = getAttribData( block.first );
+		if( ! data ) {
+			decoded.resize( mNumVertices * block.second.mDims );
+			decodeAttrib( block.first, decoded.data() );
+			data = decoded.data();
+		}
+		target->copyAttrib( block.first, block.second.mDims, 0, data, mNumVertices );
+	}
+
+	if( mNumIndices ) {
+		// decoded even when uncompressed, for the range check
+		std::vector<uint32_t> indices( mNumIndices );
+		decodeIndices( indices.data() );
+		target->copyIndices( geom::Primitive::TRIANGLES, indices.data(), mNumIndices, 4 /* bytes per index */ );
+	}
+}
+
 } // namespace cinder
@@ -22,6 +22,7 @@
 */
 
 #include "cinder/app/RendererGl.h"
+#include "cinder/gl/Context.h"
 #include "cinder/ip/Flip.h"
 
 #if defined( CINDER_COCOA ) && ( ! defined( __OBJC__ ) )
@@ -85,6 +86,8 @@ void RendererGl::startDraw()
 
 void RendererGl::finishDraw()
 {
+	gl::context()->flushStreamingDraw();
+	gl::context()->endStateCountersFrame();
 	if( mFinishDrawFn )
 		mFinishDrawFn( this );
 	else
@@ -165,6 +168,8 @@ void RendererGl::startDraw()
 
 void RendererGl::finishDraw()
 {
+	gl::context()->flushStreamingDraw();
+	gl::context()->endStateCountersFrame();
 	if( mFinishDrawFn )
 		mFinishDrawFn( this );
 	else
@@ -270,6 +275,8 @@ void RendererGl::swapBuffers()
 
 void RendererGl::finishDraw()
 {
+	gl::context()->flushStreamingDraw();
+	gl::context()->endStateCountersFrame();
 	if( mFinishDrawFn )
 		mFinishDrawFn( this );
 	else
@@ -338,6 +345,8 @@ void RendererGl::swapBuffers()
 
 void RendererGl::finishDraw()
 {
+	gl::context()->flushStreamingDraw();
+	gl::context()->endStateCountersFrame();
 	if( mFinishDrawFn )
 		mFinishDrawFn( this );
 	else
@@ -399,6 +408,8 @@ void RendererGl::swapBuffers()
 
 void RendererGl::finishDraw()
 {
+	gl::context()->flushStreamingDraw();
+	gl::context()->endStateCountersFrame();
 	if( mFinishDrawFn )
 		mFinishDrawFn( this );
 	else
@@ -468,6 +479,8 @@ void RendererGl::swapBuffers()
 
 void RendererGl::finishDraw()
 {
+	gl::context()->flushStreamingDraw();
+	gl::context()->endStateCountersFrame();
 	if( mFinishDrawFn )
 		mFinishDrawFn( this );
 	else
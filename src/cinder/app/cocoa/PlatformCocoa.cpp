@@ -30,6 +30,7 @@
 #include "cinder/ImageTargetFileQuartz.h"
 #include "cinder/ImageSourceFileRadiance.h"
 #include "cinder/ImageFileTinyExr.h"
+#include "cinder/ImageTargetFileBcn.h"
 
 #if defined( CINDER_MAC )
 	#import <Cocoa/Cocoa.h>
@@ -62,6 +63,7 @@ PlatformCocoa::PlatformCocoa()
 	ImageSourceFileRadiance::registerSelf();
 	ImageSourceFileTinyExr::registerSelf();
 	ImageTargetFileTinyExr::registerSelf();
+	ImageTargetFileBcn::registerSelf();
 }
 
 void PlatformCocoa::prepareLaunch()
@@ -27,6 +27,7 @@
 #include "cinder/ImageSourceFileStbImage.h"
 #include "cinder/ImageTargetFileStbImage.h"
 #include "cinder/ImageFileTinyExr.h"
+#include "cinder/ImageTargetFileBcn.h"
 #include "cinder/Utilities.h"
 #include "cinder/Log.h"
 
@@ -59,6 +60,7 @@ PlatformLinux::PlatformLinux()
 	ImageTargetFileStbImage::registerSelf();
 	ImageSourceFileTinyExr::registerSelf();
 	ImageTargetFileTinyExr::registerSelf();
+	ImageTargetFileBcn::registerSelf();
 }
 
 PlatformLinux::~PlatformLinux()
@@ -31,6 +31,7 @@
 #include "cinder/ImageTargetFileWic.h"
 #include "cinder/ImageSourceFileRadiance.h"
 #include "cinder/ImageFileTinyExr.h"
+#include "cinder/ImageTargetFileBcn.h"
 
 #include <wrl/client.h>
 #include <agile.h>
@@ -61,6 +62,7 @@ PlatformWinRt::PlatformWinRt()
 	ImageSourceFileRadiance::registerSelf();
 	ImageSourceFileTinyExr::registerSelf();
 	ImageTargetFileTinyExr::registerSelf();
+	ImageTargetFileBcn::registerSelf();
 }
 
 DataSourceRef PlatformWinRt::loadResource( const fs::path &resourcePath  )
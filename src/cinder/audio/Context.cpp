@@ -23,6 +23,7 @@
 
 #include "cinder/audio/Context.h"
 #include "cinder/audio/InputNode.h"
+#include "cinder/audio/ParallelGraphProcessor.h"
 #include "cinder/audio/Utilities.h"
 #include "cinder/audio/dsp/Converter.h"
 
@@ -132,7 +133,7 @@ void Context::setMaster( Context *masterContext, DeviceManager *deviceManager )
 }
 
 Context::Context()
-	: mEnabled( false ), mAutoPullRequired( false ), mAutoPullCacheDirty( false ), mNumProcessedFrames( 0 ), mTimeDuringLastProcessLoop( -1.0 )
+	: mEnabled( false ), mAutoPullRequired( false ), mAutoPullCacheDirty( false ), mNumProcessedFrames( 0 ), mTimeDuringLastProcessLoop( -1.0 ), mParallelPartitionDirty( false )
 {
 	if( ! sIsRegisteredForCleanup )
 		registerClearStatics();
@@ -142,6 +143,9 @@ Context::~Context()
 {
 	disable();
 	lock_guard<mutex> lock( mMutex );
+	if( mParallelProcessor )
+		mParallelProcessor->clear();
+
 	uninitializeAllNodes();
 }
 
@@ -183,6 +187,52 @@ void Context::connectionsDidChange( const NodeRef & /*node*/ )
 {
 }
 
+void Context::setNumProcessingThreads( size_t numThreads )
+{
+	if( numThreads == 0 )
+		numThreads = std::max<size_t>( thread::hardware_concurrency(), 1 );
+
+	if( numThreads == getNumProcessingThreads() )
+		return;
+
+	// The new worker threads are started and the old ones joined outside of the lock, so the audio thread is only blocked while partitioning.
+	unique_ptr<ParallelGraphProcessor> processor;
+	if( numThreads > 1 )
+		processor.reset( new ParallelGraphProcessor( numThreads ) );
+
+	{
+		lock_guard<mutex> lock( mMutex );
+		// restores the processing mode of the old subgraph roots
+		if( mParallelProcessor )
+			mParallelProcessor->clear();
+
+		swap( processor, mParallelProcessor );
+		updateParallelPartition();
+	}
+}
+
+size_t Context::getNumProcessingThreads() const
+{
+	return mParallelProcessor ? mParallelProcessor->getNumThreads() : 1;
+}
+
+void Context::updateParallelPartition()
+{
+	mParallelPartitionDirty = false;
+	if( ! mParallelProcessor )
+		return;
+
+	if( ! mOutput ) {
+		mParallelProcessor->clear();
+		return;
+	}
+
+	vector<NodeRef> pulledNodes = { mOutput };
+	pulledNodes.insert( pulledNodes.end(), mAutoPulledNodes.begin(), mAutoPulledNodes.end() );
+
+	mParallelProcessor->partition( pulledNodes );
+}
+
 void Context::initializeAllNodes()
 {
 	set<NodeRef> traversedNodes;
@@ -227,6 +277,10 @@ void Context::setOutput( const OutputNodeRef &output )
 
 	if( mOutput )
 		initializeAllNodes();
+
+	// setOutput() may be called with mMutex already locked (ex. when the default output is created while configuring a connection),
+	// so the subgraphs are updated at the start of the next processing block.
+	mParallelPartitionDirty = true;
 }
 
 const OutputNodeRef& Context::getOutput()
@@ -288,6 +342,9 @@ void Context::uninitRecursive( const NodeRef &node, set<NodeRef> &traversedNodes
 
 bool Context::isAudioThread() const
 {
+	if( mParallelProcessor && ParallelGraphProcessor::getCurrentWorkerProcessor() == mParallelProcessor.get() )
+		return true;
+
 	return mAudioThreadId == std::this_thread::get_id();
 }
 
@@ -296,7 +353,15 @@ void Context::preProcess()
 	mProcessTimer.start();
 	mAudioThreadId = std::this_thread::get_id();
 
+	mCommandQueue.process();
 	preProcessScheduledEvents();
+
+	if( mParallelProcessor ) {
+		if( mParallelPartitionDirty )
+			updateParallelPartition();
+
+		mParallelProcessor->process();
+	}
 }
 
 void Context::postProcess()
@@ -359,10 +424,36 @@ const std::vector<Node *>& Context::getAutoPulledNodes()
 		mAutoPullCache.clear();
 		for( const NodeRef &node : mAutoPulledNodes )
 			mAutoPullCache.push_back( node.get() );
+
+		mAutoPullCacheDirty = false;
 	}
 	return mAutoPullCache;
 }
 
+// ----------------------------------------------------------------------------------------------------
+// Command Queue
+// ----------------------------------------------------------------------------------------------------
+
+void Context::enqueueCommand( const std::function<void ()> &command )
+{
+	if( isAudioThread() ) {
+		command();
+		return;
+	}
+
+	if( mEnabled ) {
+		lock_guard<mutex> lock( mCommandMutex );
+		if( mCommandQueue.push( command ) )
+			return;
+	}
+
+	// Nothing is draining the queue (or it is full because the audio thread stalled), so synchronize with the audio thread
+	// and execute directly. Flush anything still queued first so that commands are executed in the order they were enqueued.
+	lock_guard<mutex> lock( mMutex );
+	mCommandQueue.process();
+	command();
+}
+
 // ----------------------------------------------------------------------------------------------------
 // Event Scheduling
 // ----------------------------------------------------------------------------------------------------
@@ -381,27 +472,30 @@ void Context::scheduleEvent( double when, const NodeRef &node, bool callFuncBefo
 		cancelScheduledEvents( node );
 	}
 
-	lock_guard<mutex> lock( mMutex );
 	node->mEventScheduled = true;
-	mScheduledEvents.push_back( ScheduledEvent( eventFrameThreshold, node, callFuncBeforeProcess, func ) );
+	enqueueCommand( [this, eventFrameThreshold, node, callFuncBeforeProcess, func] {
+		node->mEventScheduled = true;
+		mScheduledEvents.push_back( ScheduledEvent( eventFrameThreshold, node, callFuncBeforeProcess, func ) );
+	} );
 }
 
 void Context::cancelScheduledEvents( const NodeRef &node )
 {
-	lock_guard<mutex> lock( mMutex );
-
-	for( auto eventIt = mScheduledEvents.begin(); eventIt != mScheduledEvents.end(); ++eventIt ) {
-		if( eventIt->mNode == node ) {
-			// reset process frame range to an entire block
-			auto &range = eventIt->mNode->mProcessFramesRange;
-			range.first = 0;
-			range.second = getFramesPerBlock();
-
-			eventIt->mNode->mEventScheduled = false;
-			mScheduledEvents.erase( eventIt );
-			break;
+	node->mEventScheduled = false;
+	enqueueCommand( [this, node] {
+		for( auto eventIt = mScheduledEvents.begin(); eventIt != mScheduledEvents.end(); ++eventIt ) {
+			if( eventIt->mNode == node ) {
+				// reset process frame range to an entire block
+				auto &range = eventIt->mNode->mProcessFramesRange;
+				range.first = 0;
+				range.second = getFramesPerBlock();
+
+				eventIt->mNode->mEventScheduled = false;
+				mScheduledEvents.erase( eventIt );
+				break;
+			}
 		}
-	}
+	} );
 }
 
 // note: we should be synchronized with mMutex by the OutputDeviceNode impl, so mScheduledEvents is safe to modify
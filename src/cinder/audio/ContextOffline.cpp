@@ -0,0 +1,192 @@
+/*
+ Copyright (c) 2026, The Cinder Project
+
+ This code is intended to be used with the Cinder C++ library, http://libcinder.org
+
+ Redistribution and use in source and binary forms, with or without modification, are permitted provided that
+ the following conditions are met:
+
+    * Redistributions of source code must retain the above copyright notice, this list of conditions and
+	the following disclaimer.
+    * Redistributions in binary form must reproduce the above copyright notice, this list of conditions and
+	the following disclaimer in the documentation and/or other materials provided with the distribution.
+
+ THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED
+ WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A
+ PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR
+ ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+ TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+ NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ POSSIBILITY OF SUCH DAMAGE.
+*/
+
+#include "cinder/audio/ContextOffline.h"
+#include "cinder/audio/Exception.h"
+#include "cinder/Timer.h"
+
+#include <cmath>
+
+using namespace std;
+
+namespace cinder { namespace audio {
+
+// ----------------------------------------------------------------------------------------------------
+// OutputOfflineNode
+// ----------------------------------------------------------------------------------------------------
+
+OutputOfflineNode::OutputOfflineNode( const Format &format )
+	: OutputNode( format ), mSampleRate( format.getSampleRate() ), mFramesPerBlock( format.getFramesPerBlock() ),
+		mNumPendingFrames( 0 ), mNumRenderedFrames( 0 ), mLastRealtimeFactor( 0 )
+{
+	if( ! mSampleRate || ! mFramesPerBlock )
+		throw AudioFormatExc( "OutputOfflineNode requires a non-zero samplerate and frames per block." );
+
+	// silencing a clipped block is meant to protect speakers, which doesn't apply when rendering to disk.
+	mClipDetectionEnabled = false;
+}
+
+OutputOfflineNode::~OutputOfflineNode()
+{
+}
+
+void OutputOfflineNode::uninitialize()
+{
+	// the internal buffer may be resized before rendering resumes
+	mNumPendingFrames = 0;
+}
+
+void OutputOfflineNode::setTargetFile( const TargetFileRef &targetFile )
+{
+	if( targetFile && targetFile->getNumChannels() != getNumChannels() )
+		throw AudioFormatExc( string( "TargetFile has " ) + to_string( targetFile->getNumChannels() ) + " channels, OutputOfflineNode has " + to_string( getNumChannels() ) + "." );
+
+	auto ctx = getContext();
+	if( ctx ) {
+		lock_guard<mutex> lock( ctx->getMutex() );
+		mTargetFile = targetFile;
+	}
+	else
+		mTargetFile = targetFile;
+}
+
+const Buffer* OutputOfflineNode::renderBlock()
+{
+	emitPendingFrames( mNumPendingFrames );
+
+	const Buffer *result = processBlock();
+	if( result )
+		emitFrames( result, mFramesPerBlock, 0 );
+
+	return result;
+}
+
+void OutputOfflineNode::emitFrames( const Buffer *buffer, size_t numFrames, size_t frameOffset )
+{
+	if( mTargetFile )
+		mTargetFile->write( buffer, numFrames, frameOffset );
+
+	mNumRenderedFrames += numFrames;
+}
+
+void OutputOfflineNode::emitPendingFrames( size_t numFrames )
+{
+	CI_ASSERT( numFrames <= mNumPendingFrames );
+
+	emitFrames( getInternalBuffer(), numFrames, mFramesPerBlock - mNumPendingFrames );
+	mNumPendingFrames -= numFrames;
+}
+
+const Buffer* OutputOfflineNode::processBlock()
+{
+	auto ctx = getContext();
+	if( ! ctx || ! isEnabled() )
+		return nullptr;
+
+	lock_guard<mutex> lock( ctx->getMutex() );
+
+	ctx->preProcess();
+
+	auto internalBuffer = getInternalBuffer();
+	internalBuffer->zero();
+	pullInputs( internalBuffer );
+
+	if( checkNotClipping() )
+		internalBuffer->zero();
+
+	ctx->postProcess();
+
+	return internalBuffer;
+}
+
+uint64_t OutputOfflineNode::renderFrames( uint64_t numFrames )
+{
+	Timer timer( true );
+
+	// the frames left over from the last call were already processed, so they come before any new block
+	uint64_t numRendered = std::min<uint64_t>( mNumPendingFrames, numFrames );
+	emitPendingFrames( (size_t)numRendered );
+
+	while( numRendered < numFrames ) {
+		const Buffer *rendered = processBlock();
+		if( ! rendered )
+			break;
+
+		size_t numBlockFrames = (size_t)std::min<uint64_t>( mFramesPerBlock, numFrames - numRendered );
+		emitFrames( rendered, numBlockFrames, 0 );
+		mNumPendingFrames = mFramesPerBlock - numBlockFrames;
+		numRendered += numBlockFrames;
+	}
+
+	timer.stop();
+	double elapsedSeconds = timer.getSeconds();
+	mLastRealtimeFactor = elapsedSeconds > 0 ? ( (double)numRendered / (double)mSampleRate ) / elapsedSeconds : 0;
+
+	return numRendered;
+}
+
+uint64_t OutputOfflineNode::renderSeconds( double seconds )
+{
+	return renderFrames( (uint64_t)std::llround( seconds * (double)mSampleRate ) );
+}
+
+// ----------------------------------------------------------------------------------------------------
+// ContextOffline
+// ----------------------------------------------------------------------------------------------------
+
+ContextOffline::ContextOffline( const OutputOfflineNode::Format &format )
+	: mFormat( format ), mOutputCreated( false )
+{
+}
+
+ContextOffline::~ContextOffline()
+{
+}
+
+OutputDeviceNodeRef ContextOffline::createOutputDeviceNode( const DeviceRef & /*device*/, const Node::Format & /*format*/ )
+{
+	throw AudioContextExc( "ContextOffline does not support hardware output devices." );
+}
+
+InputDeviceNodeRef ContextOffline::createInputDeviceNode( const DeviceRef & /*device*/, const Node::Format & /*format*/ )
+{
+	throw AudioContextExc( "ContextOffline does not support hardware input devices." );
+}
+
+const OutputNodeRef& ContextOffline::getOutput()
+{
+	// mark as created first, setOutput() initializes Nodes that query the output for their format.
+	if( ! mOutputCreated ) {
+		mOutputCreated = true;
+		setOutput( makeNode( new OutputOfflineNode( mFormat ) ) );
+	}
+
+	return Context::getOutput();
+}
+
+OutputOfflineNodeRef ContextOffline::getOutputOffline()
+{
+	return dynamic_pointer_cast<OutputOfflineNode>( getOutput() );
+}
+
+} } // namespace cinder::audio
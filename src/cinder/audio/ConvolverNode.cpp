@@ -0,0 +1,298 @@
+/*
+ Copyright (c) 2026, The Cinder Project
+
+ This code is intended to be used with the Cinder C++ library, http://libcinder.org
+
+ Redistribution and use in source and binary forms, with or without modification, are permitted provided that
+ the following conditions are met:
+
+    * Redistributions of source code must retain the above copyright notice, this list of conditions and
+	the following disclaimer.
+    * Redistributions in binary form must reproduce the above copyright notice, this list of conditions and
+	the following disclaimer in the documentation and/or other materials provided with the distribution.
+
+ THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED
+ WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A
+ PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR
+ ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+ TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+ NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ POSSIBILITY OF SUCH DAMAGE.
+*/
+
+#include "cinder/audio/ConvolverNode.h"
+#include "cinder/audio/Context.h"
+#include "cinder/audio/Exception.h"
+#include "cinder/audio/dsp/Convolver.h"
+#include "cinder/CinderMath.h"
+
+#include <algorithm>
+
+using namespace std;
+
+namespace cinder { namespace audio {
+
+// The convolvers and buffers for one channel. Partitions of the impulse response:
+// - head:	[0, T) in blocks of H, processed on the audio thread
+// - tail0:	[T, 2T) in blocks of H, processed on the audio thread one tail block ahead
+// - tail:	[2T, end) in blocks of T, processed on the background thread one tail block ahead
+// where H is the head block size and T the tail block size. The tail outputs are double buffered, one is summed into the output
+// while the other is written to.
+struct ConvolverNode::ChannelState {
+	unique_ptr<dsp::Convolver>	mHead, mTail0, mTail;
+	Buffer						mInput;			// copy of the block's input, since processing happens in-place
+	Buffer						mTailInput;		// input of the current tail block
+	Buffer						mBackgroundInput;	// input of the previous tail block, read by the background thread
+	Buffer						mTail0Output[2], mTailOutput[2];
+};
+
+ConvolverNode::ConvolverNode( const BufferRef &impulseResponse, const Format &format )
+	: Node( format ), mImpulseResponse( impulseResponse ), mHeadBlockSize( 256 ), mTailBlockSize( 8192 ), mTailInputFill( 0 ),
+		mTail0WriteIndex( 0 ), mTailWriteIndex( 0 ), mHasTail0( false ), mHasTail( false ), mTailPending( false ), mTailThreadShouldQuit( false )
+{
+}
+
+ConvolverNode::~ConvolverNode()
+{
+	vector<unique_ptr<ChannelState>> noChannels;
+	setChannelsImpl( move( noChannels ) );
+}
+
+void ConvolverNode::setImpulseResponse( const BufferRef &impulseResponse )
+{
+	mImpulseResponse = impulseResponse;
+
+	if( isInitialized() ) {
+		// the impulse response is partitioned and transformed before locking, so that the audio thread isn't held up
+		auto channels = makeChannels();
+
+		lock_guard<mutex> lock( getContext()->getMutex() );
+		setChannelsImpl( move( channels ) );
+	}
+}
+
+void ConvolverNode::loadImpulseResponse( const SourceFileRef &sourceFile )
+{
+	size_t sampleRate = getSampleRate();
+	if( sampleRate == sourceFile->getSampleRate() )
+		setImpulseResponse( sourceFile->loadBuffer() );
+	else
+		setImpulseResponse( sourceFile->cloneWithSampleRate( sampleRate )->loadBuffer() );
+}
+
+void ConvolverNode::setBlockSizes( size_t headBlockSize, size_t tailBlockSize )
+{
+	if( headBlockSize < 2 || ! isPowerOf2( headBlockSize ) || ! isPowerOf2( tailBlockSize ) || headBlockSize > tailBlockSize )
+		throw AudioExc( "ConvolverNode block sizes must be powers of two, with the head block size not larger than the tail block size" );
+
+	mHeadBlockSize = headBlockSize;
+	mTailBlockSize = tailBlockSize;
+
+	setImpulseResponse( mImpulseResponse );
+}
+
+void ConvolverNode::reset()
+{
+	lock_guard<mutex> lock( getContext()->getMutex() );
+
+	waitForTails();
+
+	for( auto &channel : mChannels ) {
+		for( auto convolver : { channel->mHead.get(), channel->mTail0.get(), channel->mTail.get() } ) {
+			if( convolver )
+				convolver->reset();
+		}
+
+		for( auto buffer : { &channel->mTailInput, &channel->mBackgroundInput, &channel->mTail0Output[0], &channel->mTail0Output[1], &channel->mTailOutput[0], &channel->mTailOutput[1] } )
+			buffer->zero();
+	}
+
+	mTailInputFill = 0;
+}
+
+void ConvolverNode::initialize()
+{
+	setChannelsImpl( makeChannels() );
+}
+
+void ConvolverNode::uninitialize()
+{
+	vector<unique_ptr<ChannelState>> noChannels;
+	setChannelsImpl( move( noChannels ) );
+}
+
+vector<unique_ptr<ConvolverNode::ChannelState>> ConvolverNode::makeChannels() const
+{
+	vector<unique_ptr<ChannelState>> result;
+
+	auto impulseResponse = mImpulseResponse;
+	if( ! impulseResponse || ! impulseResponse->getNumFrames() )
+		return result;
+
+	const size_t irLength = impulseResponse->getNumFrames();
+	const size_t tailBlockSize = mTailBlockSize;
+
+	for( size_t ch = 0; ch < getNumChannels(); ch++ ) {
+		const float *ir = impulseResponse->getChannel( ch % impulseResponse->getNumChannels() );
+
+		unique_ptr<ChannelState> channel( new ChannelState );
+		channel->mInput = Buffer( getFramesPerBlock() );
+		channel->mHead.reset( new dsp::Convolver( mHeadBlockSize, ir, min( irLength, tailBlockSize ) ) );
+
+		if( irLength > tailBlockSize ) {
+			channel->mTail0.reset( new dsp::Convolver( mHeadBlockSize, ir + tailBlockSize, min( irLength - tailBlockSize, tailBlockSize ) ) );
+			channel->mTailInput = Buffer( tailBlockSize );
+			channel->mTail0Output[0] = Buffer( tailBlockSize );
+			channel->mTail0Output[1] = Buffer( tailBlockSize );
+		}
+
+		if( irLength > 2 * tailBlockSize ) {
+			channel->mTail.reset( new dsp::Convolver( tailBlockSize, ir + 2 * tailBlockSize, irLength - 2 * tailBlockSize ) );
+			channel->mBackgroundInput = Buffer( tailBlockSize );
+			channel->mTailOutput[0] = Buffer( tailBlockSize );
+			channel->mTailOutput[1] = Buffer( tailBlockSize );
+		}
+
+		result.push_back( move( channel ) );
+	}
+
+	return result;
+}
+
+void ConvolverNode::setChannelsImpl( vector<unique_ptr<ChannelState>> &&channels )
+{
+	if( mTailThread ) {
+		{
+			lock_guard<mutex> lock( mTailMutex );
+			mTailThreadShouldQuit = true;
+		}
+		mTailCond.notify_all();
+		mTailThread->join();
+		mTailThread.reset();
+	}
+
+	mChannels = move( channels );
+	mHasTail0 = ! mChannels.empty() && mChannels[0]->mTail0;
+	mHasTail = ! mChannels.empty() && mChannels[0]->mTail;
+	mTailInputFill = 0;
+	mTail0WriteIndex = mTailWriteIndex = 0;
+	mTailPending = false;
+
+	if( mHasTail ) {
+		mTailThreadShouldQuit = false;
+		mTailThread.reset( new thread( &ConvolverNode::tailThreadLoop, this ) );
+	}
+}
+
+void ConvolverNode::process( Buffer *buffer )
+{
+	if( mChannels.size() != buffer->getNumChannels() ) {
+		buffer->zero();
+		return;
+	}
+
+	const size_t numFrames = buffer->getNumFrames();
+	for( size_t ch = 0; ch < buffer->getNumChannels(); ch++ ) {
+		auto &channel = mChannels[ch];
+		float *data = buffer->getChannel( ch );
+
+		if( mHasTail0 )
+			copy( data, data + numFrames, channel->mInput.getData() );
+
+		channel->mHead->process( data, data, numFrames );
+	}
+
+	if( mHasTail0 )
+		processTails( buffer );
+}
+
+void ConvolverNode::processTails( Buffer *buffer )
+{
+	const size_t numFrames = buffer->getNumFrames();
+	const size_t headBlockSize = mHeadBlockSize;
+	const size_t tailBlockSize = mTailBlockSize;
+
+	size_t numProcessed = 0;
+	while( numProcessed < numFrames ) {
+		// process up to the next head block boundary, which is where tail0 is convolved
+		const size_t tailPos = mTailInputFill;
+		const size_t numProcessing = min( numFrames - numProcessed, headBlockSize - tailPos % headBlockSize );
+
+		for( size_t ch = 0; ch < mChannels.size(); ch++ ) {
+			auto &channel = mChannels[ch];
+			float *output = buffer->getChannel( ch ) + numProcessed;
+
+			// sum the tails that were computed during the previous tail block
+			dsp::add( output, channel->mTail0Output[1 - mTail0WriteIndex].getData() + tailPos, output, numProcessing );
+			if( mHasTail )
+				dsp::add( output, channel->mTailOutput[1 - mTailWriteIndex].getData() + tailPos, output, numProcessing );
+
+			const float *input = channel->mInput.getData() + numProcessed;
+			copy( input, input + numProcessing, channel->mTailInput.getData() + tailPos );
+		}
+
+		mTailInputFill += numProcessing;
+
+		if( mTailInputFill % headBlockSize == 0 ) {
+			const size_t blockOffset = mTailInputFill - headBlockSize;
+			for( auto &channel : mChannels )
+				channel->mTail0->process( channel->mTailInput.getData() + blockOffset, channel->mTail0Output[mTail0WriteIndex].getData() + blockOffset, headBlockSize );
+		}
+
+		if( mTailInputFill == tailBlockSize ) {
+			mTail0WriteIndex = 1 - mTail0WriteIndex;
+
+			if( mHasTail ) {
+				// the background thread had a whole tail block to finish the previous one, normally this doesn't wait
+				waitForTails();
+				mTailWriteIndex = 1 - mTailWriteIndex;
+				for( auto &channel : mChannels )
+					channel->mBackgroundInput.copy( channel->mTailInput );
+
+				startTails();
+			}
+
+			mTailInputFill = 0;
+		}
+
+		numProcessed += numProcessing;
+	}
+}
+
+void ConvolverNode::startTails()
+{
+	{
+		lock_guard<mutex> lock( mTailMutex );
+		mTailPending = true;
+	}
+	mTailCond.notify_all();
+}
+
+void ConvolverNode::waitForTails()
+{
+	unique_lock<mutex> lock( mTailMutex );
+	mTailCond.wait( lock, [this] { return ! mTailPending; } );
+}
+
+void ConvolverNode::tailThreadLoop()
+{
+	unique_lock<mutex> lock( mTailMutex );
+	while( true ) {
+		mTailCond.wait( lock, [this] { return mTailPending || mTailThreadShouldQuit; } );
+		if( mTailThreadShouldQuit )
+			return;
+
+		lock.unlock();
+
+		const size_t writeIndex = mTailWriteIndex;
+		for( auto &channel : mChannels )
+			channel->mTail->process( channel->mBackgroundInput.getData(), channel->mTailOutput[writeIndex].getData(), mTailBlockSize );
+
+		lock.lock();
+		mTailPending = false;
+		mTailCond.notify_all();
+	}
+}
+
+} } // namespace cinder::audio
@@ -0,0 +1,748 @@
+/*
+ Copyright (c) 2026, The Cinder Project
+
+ This code is intended to be used with the Cinder C++ library, http://libcinder.org
+
+ Redistribution and use in source and binary forms, with or without modification, are permitted provided that
+ the following conditions are met:
+
+    * Redistributions of source code must retain the above copyright notice, this list of conditions and
+	the following disclaimer.
+    * Redistributions in binary form must reproduce the above copyright notice, this list of conditions and
+	the following disclaimer in the documentation and/or other materials provided with the distribution.
+
+ THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED
+ WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A
+ PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR
+ ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+ TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+ NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ POSSIBILITY OF SUCH DAMAGE.
+*/
+
+#include "cinder/audio/FileBlockCache.h"
+#include "cinder/audio/dsp/Converter.h"
+#include "cinder/CinderAssert.h"
+#include "cinder/Log.h"
+#include "cinder/MappedFile.h"
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <cstring>
+#include <limits>
+
+using namespace std;
+
+namespace cinder { namespace audio {
+
+namespace {
+
+const size_t INVALID_BLOCK		= numeric_limits<size_t>::max();
+const size_t NUM_STREAM_SLOTS	= 4;	// enough for the current block, the next one and both sides of a loop point
+
+// ----------------------------------------------------------------------------------------------------
+// WAV parsing
+// ----------------------------------------------------------------------------------------------------
+
+enum class WavSampleFormat { INT_16, INT_24, INT_32, FLOAT_32 };
+
+struct WavLayout {
+	const uint8_t	*mData = nullptr;
+	size_t			mNumFrames = 0, mNumChannels = 0, mSampleRate = 0, mBytesPerFrame = 0;
+	WavSampleFormat	mSampleFormat = WavSampleFormat::INT_16;
+};
+
+uint16_t readUInt16( const uint8_t *data )	{ return uint16_t( data[0] | ( data[1] << 8 ) ); }
+uint32_t readUInt32( const uint8_t *data )	{ return uint32_t( data[0] ) | ( uint32_t( data[1] ) << 8 ) | ( uint32_t( data[2] ) << 16 ) | ( uint32_t( data[3] ) << 24 ); }
+
+//! Parses the RIFF header of a PCM or IEEE float WAV file. Returns false if the file is compressed, malformed or in a sample format that can't be read directly.
+bool parseWav( const uint8_t *data, size_t size, WavLayout *result )
+{
+	if( size < 12 || memcmp( data, "RIFF", 4 ) != 0 || memcmp( data + 8, "WAVE", 4 ) != 0 )
+		return false;
+
+	uint16_t formatCode = 0, bitsPerSample = 0, blockAlign = 0;
+	size_t pos = 12;
+	while( pos + 8 <= size ) {
+		const uint8_t *chunk = data + pos;
+		size_t chunkSize = readUInt32( chunk + 4 );
+		size_t chunkBegin = pos + 8;
+
+		if( memcmp( chunk, "fmt ", 4 ) == 0 ) {
+			if( chunkSize < 16 || chunkBegin + chunkSize > size )
+				return false;
+
+			const uint8_t *fmt = data + chunkBegin;
+			formatCode = readUInt16( fmt );
+			result->mNumChannels = readUInt16( fmt + 2 );
+			result->mSampleRate = readUInt32( fmt + 4 );
+			blockAlign = readUInt16( fmt + 12 );
+			bitsPerSample = readUInt16( fmt + 14 );
+
+			// WAVE_FORMAT_EXTENSIBLE stores the actual format code at the start of the SubFormat GUID
+			if( formatCode == 0xFFFE ) {
+				if( chunkSize < 40 )
+					return false;
+				formatCode = readUInt16( fmt + 24 );
+			}
+		}
+		else if( memcmp( chunk, "data", 4 ) == 0 ) {
+			if( ! formatCode || ! result->mNumChannels || ! blockAlign )
+				return false;
+
+			if( formatCode == 1 && bitsPerSample == 16 )
+				result->mSampleFormat = WavSampleFormat::INT_16;
+			else if( formatCode == 1 && bitsPerSample == 24 )
+				result->mSampleFormat = WavSampleFormat::INT_24;
+			else if( formatCode == 1 && bitsPerSample == 32 )
+				result->mSampleFormat = WavSampleFormat::INT_32;
+			else if( formatCode == 3 && bitsPerSample == 32 )
+				result->mSampleFormat = WavSampleFormat::FLOAT_32;
+			else
+				return false;
+
+			if( blockAlign != result->mNumChannels * bitsPerSample / 8 )
+				return false;
+
+			// samples are read in place, so they must be aligned for their type
+			size_t alignment = result->mSampleFormat == WavSampleFormat::INT_24 ? 1 : bitsPerSample / 8;
+			if( chunkBegin % alignment != 0 )
+				return false;
+
+			// tolerate files that were truncated or never had their data chunk size finalized
+			size_t dataSize = min( chunkSize, size - chunkBegin );
+
+			result->mData = data + chunkBegin;
+			result->mBytesPerFrame = blockAlign;
+			result->mNumFrames = dataSize / blockAlign;
+			return result->mNumFrames > 0;
+		}
+
+		// chunks are padded to an even size
+		pos = chunkBegin + chunkSize + ( chunkSize & 1 );
+	}
+
+	return false;
+}
+
+void convertWavFrames( const WavLayout &wav, size_t readPos, Buffer *buffer, size_t bufferFrameOffset, size_t numFrames )
+{
+	const uint8_t *source = wav.mData + readPos * wav.mBytesPerFrame;
+	float *dest = buffer->getData() + bufferFrameOffset;
+	const size_t destFramesPerChannel = buffer->getNumFrames();
+	const size_t numChannels = wav.mNumChannels;
+
+	switch( wav.mSampleFormat ) {
+		case WavSampleFormat::INT_16:
+			dsp::deinterleave( reinterpret_cast<const int16_t *>( source ), dest, destFramesPerChannel, numChannels, numFrames );
+			break;
+		case WavSampleFormat::INT_24:
+			dsp::deinterleaveInt24ToFloat( reinterpret_cast<const char *>( source ), dest, destFramesPerChannel, numChannels, numFrames );
+			break;
+		case WavSampleFormat::INT_32: {
+			const float floatNormalizer = 1.0f / 2147483648.0f;
+			const int32_t *sourceInt32 = reinterpret_cast<const int32_t *>( source );
+			for( size_t ch = 0; ch < numChannels; ch++ ) {
+				float *destChannel = dest + ch * destFramesPerChannel;
+				for( size_t i = 0; i < numFrames; i++ )
+					destChannel[i] = (float)sourceInt32[i * numChannels + ch] * floatNormalizer;
+			}
+			break;
+		}
+		case WavSampleFormat::FLOAT_32:
+			dsp::deinterleave( reinterpret_cast<const float *>( source ), dest, destFramesPerChannel, numChannels, numFrames );
+			break;
+	}
+}
+
+//! Fills \a result with the indices of the blocks that a reader at \a readPos touches within the next \a framesPerBlock frames, wrapping at the loop end if there is one. Returns the number of indices.
+size_t collectWantedBlocks( size_t readPos, size_t loopBegin, size_t loopEnd, size_t numFrames, size_t framesPerBlock, size_t *result )
+{
+	loopEnd = min( loopEnd, numFrames );
+	const bool looping = loopEnd > loopBegin;
+
+	size_t count = 0;
+	size_t pos = readPos;
+	size_t remaining = framesPerBlock + 1; // + 1 so that the next block is requested while the current one is still being read from its first frame
+	bool wrapped = false;
+	while( remaining && count < NUM_STREAM_SLOTS ) {
+		size_t end = ( looping && pos < loopEnd ) ? loopEnd : numFrames;
+		if( pos >= end ) {
+			if( ! looping || wrapped )
+				break;
+
+			pos = loopBegin;
+			wrapped = true;
+			continue;
+		}
+
+		size_t blockIndex = pos / framesPerBlock;
+		if( find( result, result + count, blockIndex ) == result + count )
+			result[count++] = blockIndex;
+
+		size_t blockEnd = min( ( blockIndex + 1 ) * framesPerBlock, end );
+		size_t advance = min( remaining, blockEnd - pos );
+		remaining -= advance;
+		pos += advance;
+	}
+
+	return count;
+}
+
+} // anonymous namespace
+
+// ----------------------------------------------------------------------------------------------------
+// Private Types
+// ----------------------------------------------------------------------------------------------------
+
+struct FileBlockCache::FileEntry {
+	string					mKey;
+	SourceFileRef			mSource;	// keeps the SourceFile alive so that its address, which keys non-file sources, can't be reused
+	size_t					mSampleRate, mNumFrames, mNumChannels;
+
+	// decoded path, only used by I/O threads
+	SourceFileRef			mDecoder;
+	BufferDynamic			mDecodeBuffer;
+	mutex					mDecodeMutex;
+
+	// memory-mapped path
+	MappedFileRef			mMappedFile;
+	WavLayout				mWav;
+
+	// guarded by FileBlockCache::mMutex
+	size_t					mNumStreams = 0, mNumBlocks = 0;
+	bool					mRegistered = false;
+};
+
+struct FileBlockCache::Block {
+	const FileEntry		*mFile;
+	size_t				mIndex;
+	Buffer				mBuffer;
+
+	size_t	getNumBytes() const		{ return mBuffer.getSize() * sizeof( float ); }
+};
+
+// A Slot holds one block that the Stream's reader can copy from. The reader marks the slot in use before checking its index,
+// and an I/O thread invalidates the index and waits until the slot isn't in use before replacing the block. Both sides use
+// sequentially consistent operations, so either the reader sees the invalid index or the I/O thread sees the slot in use.
+struct FileBlockCache::StreamState {
+	struct Slot {
+		atomic<size_t>		mIndex = { INVALID_BLOCK };
+		atomic<bool>		mInUse = { false };
+		const Block			*mBlock = nullptr;
+		shared_ptr<Block>	mHolder;	// only touched by the I/O thread servicing this stream
+	};
+
+	StreamState( const shared_ptr<FileEntry> &file )
+		: mFile( file )
+	{
+		fill( begin( mLastWanted ), end( mLastWanted ), INVALID_BLOCK );
+	}
+
+	//! Copies from the slot holding \a blockIndex, returns the number of frames copied or 0 if no slot holds it.
+	size_t copyFromSlot( size_t blockIndex, size_t blockFrameOffset, Buffer *buffer, size_t bufferFrameOffset, size_t numFrames )
+	{
+		for( auto &slot : mSlots ) {
+			slot.mInUse.store( true );
+			if( slot.mIndex.load() == blockIndex ) {
+				const Buffer &blockBuffer = slot.mBlock->mBuffer;
+				size_t numCopyFrames = blockFrameOffset < blockBuffer.getNumFrames() ? min( numFrames, blockBuffer.getNumFrames() - blockFrameOffset ) : 0;
+				buffer->copyOffset( blockBuffer, numCopyFrames, bufferFrameOffset, blockFrameOffset );
+				slot.mInUse.store( false );
+				return numCopyFrames;
+			}
+			slot.mInUse.store( false );
+		}
+
+		return 0;
+	}
+
+	const shared_ptr<FileEntry>		mFile;
+	Slot							mSlots[NUM_STREAM_SLOTS];
+
+	// written by the reader, read by the I/O thread servicing this stream
+	atomic<size_t>					mRequestPos = { 0 }, mRequestLoopBegin = { 0 }, mRequestLoopEnd = { 0 };
+	atomic<bool>					mNeedsService = { false };
+
+	// only touched by the reader
+	size_t							mLastWanted[NUM_STREAM_SLOTS];
+
+	// guarded by FileBlockCache::mStreamsMutex
+	bool							mServicing = false;
+
+	// signaled whenever a block is installed, for readBlocking()
+	mutex							mReadyMutex;
+	condition_variable				mReadyCond;
+};
+
+size_t FileBlockCache::BlockKeyHash::operator()( const pair<const FileEntry *, size_t> &key ) const
+{
+	return hash<const void *>()( key.first ) ^ ( hash<size_t>()( key.second ) * 0x9E3779B97F4A7C15ull );
+}
+
+// ----------------------------------------------------------------------------------------------------
+// FileBlockCache
+// ----------------------------------------------------------------------------------------------------
+
+// static
+FileBlockCacheRef FileBlockCache::create( const Format &format )
+{
+	return FileBlockCacheRef( new FileBlockCache( format ) );
+}
+
+// static
+FileBlockCacheRef FileBlockCache::getDefault()
+{
+	static FileBlockCacheRef sDefault = create();
+	return sDefault;
+}
+
+FileBlockCache::FileBlockCache( const Format &format )
+	: mFormat( format ), mNumBytes( 0 ), mScanBegin( 0 ), mQuit( false )
+{
+	mFormat.framesPerBlock( max<size_t>( mFormat.getFramesPerBlock(), 1 ) );
+	mFormat.numIoThreads( max<size_t>( mFormat.getNumIoThreads(), 1 ) );
+
+	for( size_t i = 0; i < mFormat.getNumIoThreads(); i++ )
+		mIoThreads.emplace_back( &FileBlockCache::ioThreadLoop, this );
+}
+
+FileBlockCache::~FileBlockCache()
+{
+	{
+		lock_guard<mutex> lock( mStreamsMutex );
+		mQuit = true;
+	}
+	mWakeCond.notify_all();
+
+	for( auto &thread : mIoThreads )
+		thread.join();
+}
+
+unique_ptr<FileBlockCache::Stream> FileBlockCache::openStream( const SourceFileRef &sourceFile, size_t sampleRate )
+{
+	CI_ASSERT( sourceFile );
+
+	if( ! sampleRate )
+		sampleRate = sourceFile->getSampleRate();
+
+	auto state = make_shared<StreamState>( openFile( sourceFile, sampleRate ) );
+	{
+		lock_guard<mutex> lock( mStreamsMutex );
+		mStreams.push_back( state );
+	}
+
+	return unique_ptr<Stream>( new Stream( shared_from_this(), state ) );
+}
+
+size_t FileBlockCache::getNumBytesCached() const
+{
+	lock_guard<mutex> lock( mMutex );
+	return mNumBytes;
+}
+
+size_t FileBlockCache::getNumBlocksCached() const
+{
+	lock_guard<mutex> lock( mMutex );
+	return mLruBlocks.size();
+}
+
+size_t FileBlockCache::getNumFilesOpen() const
+{
+	lock_guard<mutex> lock( mMutex );
+	return mFiles.size();
+}
+
+size_t FileBlockCache::getNumMemoryMappedStreams() const
+{
+	lock_guard<mutex> lock( mMutex );
+
+	size_t result = 0;
+	for( const auto &file : mFiles ) {
+		if( file.second->mMappedFile )
+			result += file.second->mNumStreams;
+	}
+
+	return result;
+}
+
+void FileBlockCache::clear()
+{
+	lock_guard<mutex> lock( mMutex );
+	evictImpl( 0 );
+}
+
+shared_ptr<FileBlockCache::FileEntry> FileBlockCache::openFile( const SourceFileRef &sourceFile, size_t sampleRate )
+{
+	// Files are shared by path where possible, so that separately loaded SourceFiles of the same file share blocks.
+	auto dataSource = sourceFile->getDataSource();
+	fs::path filePath = dataSource && dataSource->isFilePath() ? dataSource->getFilePath() : fs::path();
+
+	string key = ( filePath.empty() ? "source:" + to_string( (uintptr_t)sourceFile.get() ) : "path:" + filePath.string() ) + "@" + to_string( sampleRate );
+
+	{
+		lock_guard<mutex> lock( mMutex );
+		auto fileIt = mFiles.find( key );
+		if( fileIt != mFiles.end() ) {
+			fileIt->second->mNumStreams++;
+			return fileIt->second;
+		}
+	}
+
+	// Opening the file can be slow, so it happens without holding the lock and the entry is only registered afterwards.
+	auto file = make_shared<FileEntry>();
+	file->mKey = key;
+	file->mSource = sourceFile;
+	file->mSampleRate = sampleRate;
+
+	if( mFormat.isMemoryMappingEnabled() && ! filePath.empty() ) {
+		file->mMappedFile = MappedFile::create( filePath );
+		if( file->mMappedFile && ( ! parseWav( file->mMappedFile->getData(), file->mMappedFile->getSize(), &file->mWav ) || file->mWav.mSampleRate != sampleRate ) )
+			file->mMappedFile.reset();
+	}
+
+	if( file->mMappedFile ) {
+		file->mNumFrames = file->mWav.mNumFrames;
+		file->mNumChannels = file->mWav.mNumChannels;
+	}
+	else {
+		file->mDecoder = sourceFile->cloneWithSampleRate( sampleRate );
+		file->mNumFrames = file->mDecoder->getNumFrames();
+		file->mNumChannels = file->mDecoder->getNumChannels();
+		file->mDecodeBuffer.setSize( file->mDecoder->getMaxFramesPerRead(), file->mNumChannels );
+	}
+
+	lock_guard<mutex> lock( mMutex );
+
+	// another thread may have opened the same file in the meantime, in which case its entry is used instead
+	auto result = mFiles.insert( make_pair( key, file ) );
+	result.first->second->mRegistered = true;
+	result.first->second->mNumStreams++;
+	return result.first->second;
+}
+
+void FileBlockCache::closeFile( const shared_ptr<FileEntry> &file )
+{
+	lock_guard<mutex> lock( mMutex );
+
+	CI_ASSERT( file->mNumStreams > 0 );
+	if( --file->mNumStreams == 0 && file->mNumBlocks == 0 && file->mRegistered ) {
+		file->mRegistered = false;
+		mFiles.erase( file->mKey );
+	}
+}
+
+shared_ptr<FileBlockCache::Block> FileBlockCache::acquireBlock( const shared_ptr<FileEntry> &file, size_t blockIndex )
+{
+	const auto key = make_pair<const FileEntry *, size_t>( file.get(), size_t( blockIndex ) );
+
+	auto findBlock = [&]() -> shared_ptr<Block> {
+		lock_guard<mutex> lock( mMutex );
+		auto blockIt = mBlocks.find( key );
+		if( blockIt == mBlocks.end() )
+			return nullptr;
+
+		// move to the front of the LRU list
+		mLruBlocks.splice( mLruBlocks.begin(), mLruBlocks, blockIt->second );
+		return *blockIt->second;
+	};
+
+	auto block = findBlock();
+	if( block )
+		return block;
+
+	// Only one thread decodes from a file at a time. If another thread was already decoding this block, it is in the cache by
+	// the time the decode lock is acquired.
+	lock_guard<mutex> decodeLock( file->mDecodeMutex );
+
+	block = findBlock();
+	if( block )
+		return block;
+
+	const size_t framesPerBlock = mFormat.getFramesPerBlock();
+	const size_t blockBegin = blockIndex * framesPerBlock;
+	const size_t blockFrames = min( framesPerBlock, file->mNumFrames - blockBegin );
+
+	block = make_shared<Block>();
+	block->mFile = file.get();
+	block->mIndex = blockIndex;
+	block->mBuffer = Buffer( blockFrames, file->mNumChannels );
+
+	try {
+		auto &decoder = file->mDecoder;
+
+		// Blocks are usually requested in order, in which case the decoder is already in position. Not seeking avoids resetting
+		// its samplerate converter, which would otherwise cause a discontinuity at every block boundary.
+		if( decoder->getReadPosition() != blockBegin )
+			decoder->seek( blockBegin );
+
+		size_t numRead = 0;
+		while( numRead < blockFrames && decoder->getReadPosition() < decoder->getNumFrames() ) {
+			file->mDecodeBuffer.setNumFrames( min( decoder->getMaxFramesPerRead(), blockFrames - numRead ) );
+			size_t count = decoder->read( &file->mDecodeBuffer );
+			if( ! count )
+				break;
+
+			count = min( count, blockFrames - numRead );
+			block->mBuffer.copyOffset( file->mDecodeBuffer, count, numRead, 0 );
+			numRead += count;
+		}
+	}
+	catch( std::exception &exc ) {
+		// leave the block silent, so that readers waiting on it make progress
+		CI_LOG_E( "failed to decode block " << blockIndex << " of " << file->mKey << ": " << exc.what() );
+	}
+
+	lock_guard<mutex> lock( mMutex );
+
+	// if the last Stream of this file closed while decoding, the block isn't cached since nothing would remove the entry
+	if( file->mRegistered ) {
+		mLruBlocks.push_front( block );
+		mBlocks[key] = mLruBlocks.begin();
+		mNumBytes += block->getNumBytes();
+		file->mNumBlocks++;
+
+		evictImpl( mFormat.getMaxBytes() );
+	}
+
+	return block;
+}
+
+void FileBlockCache::evictImpl( size_t maxBytes )
+{
+	auto blockIt = mLruBlocks.end();
+	while( mNumBytes > maxBytes && blockIt != mLruBlocks.begin() ) {
+		--blockIt;
+
+		// blocks held by a Stream slot, or about to be installed in one, are in use and can't be evicted
+		if( blockIt->use_count() > 1 )
+			continue;
+
+		const auto &block = *blockIt;
+		auto file = const_cast<FileEntry *>( block->mFile );
+
+		mNumBytes -= block->getNumBytes();
+		mBlocks.erase( make_pair( block->mFile, block->mIndex ) );
+		blockIt = mLruBlocks.erase( blockIt );
+
+		if( --file->mNumBlocks == 0 && file->mNumStreams == 0 ) {
+			file->mRegistered = false;
+			string key = file->mKey;
+			mFiles.erase( key ); // destroys file
+		}
+	}
+}
+
+void FileBlockCache::wakeIoThreads()
+{
+	// Called from the reader's thread without locking mStreamsMutex, so a wakeup can be missed while an I/O thread is about to
+	// wait. I/O threads therefore wait with a short timeout while Streams are open.
+	mWakeCond.notify_one();
+}
+
+shared_ptr<FileBlockCache::StreamState> FileBlockCache::claimStreamImpl()
+{
+	const size_t numStreams = mStreams.size();
+	for( size_t i = 0; i < numStreams; i++ ) {
+		// start where the last scan ended, so that streams are serviced round-robin
+		const auto &state = mStreams[( mScanBegin + i ) % numStreams];
+		if( ! state->mServicing && state->mNeedsService.exchange( false ) ) {
+			state->mServicing = true;
+			mScanBegin = ( mScanBegin + i + 1 ) % numStreams;
+			return state;
+		}
+	}
+
+	return nullptr;
+}
+
+void FileBlockCache::ioThreadLoop()
+{
+	while( true ) {
+		shared_ptr<StreamState> state;
+		{
+			unique_lock<mutex> lock( mStreamsMutex );
+			while( true ) {
+				if( mQuit )
+					return;
+
+				state = claimStreamImpl();
+				if( state )
+					break;
+
+				if( mStreams.empty() )
+					mWakeCond.wait( lock );
+				else
+					mWakeCond.wait_for( lock, chrono::milliseconds( 10 ) );
+			}
+		}
+
+		serviceStream( state.get() );
+
+		{
+			lock_guard<mutex> lock( mStreamsMutex );
+			state->mServicing = false;
+		}
+		mServicedCond.notify_all();
+	}
+}
+
+void FileBlockCache::serviceStream( StreamState *state )
+{
+	const auto &file = state->mFile;
+	const size_t framesPerBlock = mFormat.getFramesPerBlock();
+
+	size_t wanted[NUM_STREAM_SLOTS];
+	size_t numWanted = collectWantedBlocks( state->mRequestPos, state->mRequestLoopBegin, state->mRequestLoopEnd, file->mNumFrames, framesPerBlock, wanted );
+
+	if( file->mMappedFile ) {
+		for( size_t i = 0; i < numWanted; i++ ) {
+			size_t blockBegin = wanted[i] * framesPerBlock;
+			size_t blockFrames = min( framesPerBlock, file->mNumFrames - blockBegin );
+			file->mMappedFile->willNeed( file->mWav.mData + blockBegin * file->mWav.mBytesPerFrame, blockFrames * file->mWav.mBytesPerFrame );
+		}
+		return;
+	}
+
+	auto isWanted = [&]( size_t blockIndex ) {
+		return find( wanted, wanted + numWanted, blockIndex ) != wanted + numWanted;
+	};
+
+	for( size_t i = 0; i < numWanted; i++ ) {
+		auto &slots = state->mSlots;
+		auto isInstalled = [&]( const StreamState::Slot &slot ) { return slot.mIndex.load() == wanted[i]; };
+		if( any_of( begin( slots ), end( slots ), isInstalled ) )
+			continue;
+
+		auto block = acquireBlock( file, wanted[i] );
+
+		// there are as many slots as wanted blocks at most, so at least one holds a block that is no longer wanted
+		auto slotIt = find_if( begin( slots ), end( slots ), [&]( const StreamState::Slot &slot ) { return ! isWanted( slot.mIndex.load() ); } );
+		CI_ASSERT( slotIt != end( slots ) );
+
+		slotIt->mIndex.store( INVALID_BLOCK );
+		while( slotIt->mInUse.load() )
+			this_thread::yield();
+
+		slotIt->mHolder = block;
+		slotIt->mBlock = block.get();
+		slotIt->mIndex.store( wanted[i] );
+
+		lock_guard<mutex> lock( state->mReadyMutex );
+		state->mReadyCond.notify_all();
+	}
+}
+
+// ----------------------------------------------------------------------------------------------------
+// FileBlockCache::Stream
+// ----------------------------------------------------------------------------------------------------
+
+FileBlockCache::Stream::Stream( const FileBlockCacheRef &cache, const shared_ptr<StreamState> &state )
+	: mCache( cache ), mState( state )
+{
+}
+
+FileBlockCache::Stream::~Stream()
+{
+	{
+		// wait for an I/O thread that is still servicing this stream, so that its blocks are no longer pinned once it returns
+		unique_lock<mutex> lock( mCache->mStreamsMutex );
+		auto &streams = mCache->mStreams;
+		streams.erase( remove( streams.begin(), streams.end(), mState ), streams.end() );
+		mCache->mServicedCond.wait( lock, [this] { return ! mState->mServicing; } );
+	}
+
+	for( auto &slot : mState->mSlots )
+		slot.mHolder.reset();
+
+	mCache->closeFile( mState->mFile );
+}
+
+size_t FileBlockCache::Stream::getNumFrames() const
+{
+	return mState->mFile->mNumFrames;
+}
+
+size_t FileBlockCache::Stream::getNumChannels() const
+{
+	return mState->mFile->mNumChannels;
+}
+
+bool FileBlockCache::Stream::isMemoryMapped() const
+{
+	return (bool)mState->mFile->mMappedFile;
+}
+
+size_t FileBlockCache::Stream::read( Buffer *buffer, size_t bufferFrameOffset, size_t readPos, size_t numFrames )
+{
+	const auto &file = mState->mFile;
+	CI_ASSERT( buffer->getNumChannels() == file->mNumChannels );
+	CI_ASSERT( bufferFrameOffset + numFrames <= buffer->getNumFrames() );
+
+	if( readPos >= file->mNumFrames )
+		return 0;
+
+	numFrames = min( numFrames, file->mNumFrames - readPos );
+
+	if( file->mMappedFile ) {
+		convertWavFrames( file->mWav, readPos, buffer, bufferFrameOffset, numFrames );
+		return numFrames;
+	}
+
+	const size_t framesPerBlock = mCache->mFormat.getFramesPerBlock();
+	size_t numCopied = 0;
+	while( numCopied < numFrames ) {
+		size_t pos = readPos + numCopied;
+		size_t count = mState->copyFromSlot( pos / framesPerBlock, pos % framesPerBlock, buffer, bufferFrameOffset + numCopied, numFrames - numCopied );
+		if( ! count )
+			break;
+
+		numCopied += count;
+	}
+
+	return numCopied;
+}
+
+size_t FileBlockCache::Stream::readBlocking( Buffer *buffer, size_t bufferFrameOffset, size_t readPos, size_t numFrames )
+{
+	size_t numCopied = 0;
+	while( true ) {
+		numCopied += read( buffer, bufferFrameOffset + numCopied, readPos + numCopied, numFrames - numCopied );
+		if( numCopied == numFrames || readPos + numCopied >= getNumFrames() )
+			return numCopied;
+
+		// the missing block is requested directly, prefetch() could skip the request if the wanted blocks haven't changed
+		mState->mRequestPos = readPos + numCopied;
+		mState->mNeedsService = true;
+		mCache->wakeIoThreads();
+
+		unique_lock<mutex> lock( mState->mReadyMutex );
+		mState->mReadyCond.wait_for( lock, chrono::milliseconds( 1 ) );
+	}
+}
+
+void FileBlockCache::Stream::prefetch( size_t readPos, size_t loopBegin, size_t loopEnd )
+{
+	const auto &file = mState->mFile;
+
+	size_t wanted[NUM_STREAM_SLOTS];
+	fill( begin( wanted ), end( wanted ), INVALID_BLOCK );
+	collectWantedBlocks( readPos, loopBegin, loopEnd, file->mNumFrames, mCache->mFormat.getFramesPerBlock(), wanted );
+
+	// only wake the I/O threads when the set of wanted blocks has changed
+	if( equal( begin( wanted ), end( wanted ), begin( mState->mLastWanted ) ) )
+		return;
+
+	copy( begin( wanted ), end( wanted ), begin( mState->mLastWanted ) );
+
+	mState->mRequestLoopBegin = loopBegin;
+	mState->mRequestLoopEnd = loopEnd;
+	mState->mRequestPos = readPos;
+	mState->mNeedsService = true;
+	mCache->wakeIoThreads();
+}
+
+} } // namespace cinder::audio
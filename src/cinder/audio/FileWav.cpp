@@ -0,0 +1,132 @@
+/*
+ Copyright (c) 2026, The Cinder Project
+
+ This code is intended to be used with the Cinder C++ library, http://libcinder.org
+
+ Redistribution and use in source and binary forms, with or without modification, are permitted provided that
+ the following conditions are met:
+
+    * Redistributions of source code must retain the above copyright notice, this list of conditions and
+	the following disclaimer.
+    * Redistributions in binary form must reproduce the above copyright notice, this list of conditions and
+	the following disclaimer in the documentation and/or other materials provided with the distribution.
+
+ THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED
+ WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A
+ PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR
+ ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+ TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+ NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ POSSIBILITY OF SUCH DAMAGE.
+*/
+
+#include "cinder/audio/FileWav.h"
+#include "cinder/audio/Exception.h"
+#include "cinder/audio/dsp/Converter.h"
+#include "cinder/CinderAssert.h"
+
+#include <algorithm>
+
+using namespace std;
+
+namespace cinder { namespace audio {
+
+namespace {
+
+const uint16_t WAVE_FORMAT_PCM			= 1;
+const uint16_t WAVE_FORMAT_IEEE_FLOAT	= 3;
+const off_t HEADER_SIZE					= 44;
+const off_t RIFF_SIZE_OFFSET			= 4;
+const off_t DATA_SIZE_OFFSET			= 40;
+
+} // anonymous namespace
+
+TargetFileWav::TargetFileWav( const DataTargetRef &dataTarget, size_t sampleRate, size_t numChannels, SampleType sampleType )
+	: TargetFile( sampleRate, numChannels, sampleType ), mDataTarget( dataTarget ), mNumFramesWritten( 0 )
+{
+	CI_ASSERT( mDataTarget );
+	mStream = mDataTarget->getStream();
+	if( ! mStream )
+		throw AudioFileExc( "TargetFileWav: could not open stream for writing." );
+
+	writeHeader();
+}
+
+TargetFileWav::~TargetFileWav()
+{
+	// patch the RIFF and data chunk sizes now that the number of frames is known.
+	try {
+		const uint32_t dataSize = uint32_t( mNumFramesWritten * mNumChannels * sampleSize( mSampleType ) );
+
+		mStream->seekAbsolute( RIFF_SIZE_OFFSET );
+		mStream->writeLittle( uint32_t( HEADER_SIZE - 8 + dataSize ) );
+		mStream->seekAbsolute( DATA_SIZE_OFFSET );
+		mStream->writeLittle( dataSize );
+		mStream->seekAbsolute( HEADER_SIZE + dataSize );
+	}
+	catch( ... ) {
+		// destructor cannot throw, the file is left with zero sized chunks.
+	}
+}
+
+void TargetFileWav::writeHeader()
+{
+	const uint16_t bytesPerSample = (uint16_t)sampleSize( mSampleType );
+	const uint16_t blockAlign = uint16_t( mNumChannels * bytesPerSample );
+
+	mStream->writeData( "RIFF", 4 );
+	mStream->writeLittle( uint32_t( 0 ) ); // patched in destructor
+	mStream->writeData( "WAVE", 4 );
+
+	mStream->writeData( "fmt ", 4 );
+	mStream->writeLittle( uint32_t( 16 ) );
+	mStream->writeLittle( mSampleType == SampleType::FLOAT_32 ? WAVE_FORMAT_IEEE_FLOAT : WAVE_FORMAT_PCM );
+	mStream->writeLittle( uint16_t( mNumChannels ) );
+	mStream->writeLittle( uint32_t( mSampleRate ) );
+	mStream->writeLittle( uint32_t( mSampleRate * blockAlign ) );
+	mStream->writeLittle( blockAlign );
+	mStream->writeLittle( uint16_t( bytesPerSample * 8 ) );
+
+	mStream->writeData( "data", 4 );
+	mStream->writeLittle( uint32_t( 0 ) ); // patched in destructor
+}
+
+// note: sample data is written in host byte order, which is little endian on all supported platforms.
+void TargetFileWav::performWrite( const Buffer *buffer, size_t numFrames, size_t frameOffset )
+{
+	CI_ASSERT( buffer->getNumChannels() >= mNumChannels );
+
+	if( mInterleavedBuffer.getNumFrames() < numFrames || mInterleavedBuffer.getNumChannels() != mNumChannels )
+		mInterleavedBuffer = BufferInterleaved( numFrames, mNumChannels );
+
+	const size_t numSamples = numFrames * mNumChannels;
+	float *interleaved = mInterleavedBuffer.getData();
+	dsp::interleave( buffer->getData() + frameOffset, interleaved, buffer->getNumFrames(), mNumChannels, numFrames );
+
+	if( mSampleType == SampleType::FLOAT_32 ) {
+		mStream->writeData( interleaved, numSamples * sizeof( float ) );
+	}
+	else {
+		for( size_t i = 0; i < numSamples; i++ )
+			interleaved[i] = std::max( -1.0f, std::min( 1.0f, interleaved[i] ) );
+
+		const size_t numBytes = numSamples * sampleSize( mSampleType );
+		if( mEncodeBuffer.size() < numBytes )
+			mEncodeBuffer.resize( numBytes );
+
+		if( mSampleType == SampleType::INT_16 ) {
+			int16_t *dest = reinterpret_cast<int16_t *>( mEncodeBuffer.data() );
+			for( size_t i = 0; i < numSamples; i++ )
+				dest[i] = int16_t( interleaved[i] * 32767.0f );
+		}
+		else
+			dsp::convertFloatToInt24( interleaved, mEncodeBuffer.data(), numSamples );
+
+		mStream->writeData( mEncodeBuffer.data(), numBytes );
+	}
+
+	mNumFramesWritten += numFrames;
+}
+
+} } // namespace cinder::audio
@@ -42,7 +42,7 @@ namespace cinder { namespace audio {
 
 Node::Node( const Format &format )
 	: mInitialized( false ), mEnabled( false ), mEventScheduled( false ), mChannelMode( format.getChannelMode() ),
-		mNumChannels( 1 ), mAutoEnabled( true ), mProcessInPlace( true ), mLastProcessedFrame( numeric_limits<uint64_t>::max() )
+		mNumChannels( 1 ), mAutoEnabled( true ), mProcessInPlace( true ), mSummingForParallelProcessing( false ), mLastProcessedFrame( numeric_limits<uint64_t>::max() )
 {
 	if( format.getChannels() ) {
 		mNumChannels = format.getChannels();
@@ -69,7 +69,17 @@ void Node::connect( const NodeRef &output )
 	if( checkCycle( thisRef, output ) )
 		throw NodeCycleExc( thisRef, output );
 
-	mOutputs.push_back( output ); // set output first, so that it is visible in configureConnections()
+	// set output first, so that it is visible in configureConnections(). Outputs are read on the audio thread when the Context
+	// partitions the graph for parallel processing, so they are modified with the Context's mutex locked.
+	{
+		auto ctx = getContext();
+		unique_lock<mutex> lock;
+		if( ctx )
+			lock = unique_lock<mutex>( ctx->getMutex() );
+
+		mOutputs.push_back( output );
+	}
+
 	output->connectInput( thisRef );
 
 	output->notifyConnectionsDidChange();
@@ -80,10 +90,17 @@ void Node::disconnect( const NodeRef &output )
 	if( ! output )
 		return;
 
-	for( auto weakOutIt = mOutputs.begin(); weakOutIt != mOutputs.end(); ++weakOutIt ) {
-		if( weakOutIt->lock() == output ) {
-			mOutputs.erase( weakOutIt );
-			break;
+	{
+		auto ctx = getContext();
+		unique_lock<mutex> lock;
+		if( ctx )
+			lock = unique_lock<mutex>( ctx->getMutex() );
+
+		for( auto weakOutIt = mOutputs.begin(); weakOutIt != mOutputs.end(); ++weakOutIt ) {
+			if( weakOutIt->lock() == output ) {
+				mOutputs.erase( weakOutIt );
+				break;
+			}
 		}
 	}
 
@@ -113,7 +130,15 @@ void Node::disconnectAllInputs()
 	for( auto &input : mInputs )
 		input->disconnectOutput( thisRef );
 
-	mInputs.clear();
+	auto ctx = getContext();
+	if( ctx ) {
+		lock_guard<mutex> lock( ctx->getMutex() );
+		mInputs.clear();
+		ctx->mParallelPartitionDirty = true;
+	}
+	else
+		mInputs.clear();
+
 	notifyConnectionsDidChange();
 }
 
@@ -127,6 +152,9 @@ void Node::connectInput( const NodeRef &input )
 
 	mInputs.insert( input );
 	configureConnections();
+
+	// the audio thread repartitions the graph before processing the next block, see Context::setNumProcessingThreads()
+	ctx->mParallelPartitionDirty = true;
 }
 
 void Node::disconnectInput( const NodeRef &input )
@@ -143,6 +171,8 @@ void Node::disconnectInput( const NodeRef &input )
 			break;
 		}
 	}
+
+	ctx->mParallelPartitionDirty = true;
 }
 
 void Node::disconnectOutput( const NodeRef &output )
@@ -478,6 +508,7 @@ void Node::setupProcessWithSumming()
 	CI_ASSERT( getContext() );
 
 	mProcessInPlace = false;
+	mSummingForParallelProcessing = false;
 	size_t framesPerBlock = getFramesPerBlock();
 
 	mInternalBuffer.setSize( framesPerBlock, mNumChannels );
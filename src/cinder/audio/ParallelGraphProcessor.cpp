@@ -0,0 +1,349 @@
+/*
+ Copyright (c) 2026, The Cinder Project
+
+ This code is intended to be used with the Cinder C++ library, http://libcinder.org
+
+ Redistribution and use in source and binary forms, with or without modification, are permitted provided that
+ the following conditions are met:
+
+    * Redistributions of source code must retain the above copyright notice, this list of conditions and
+	the following disclaimer.
+    * Redistributions in binary form must reproduce the above copyright notice, this list of conditions and
+	the following disclaimer in the documentation and/or other materials provided with the distribution.
+
+ THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED
+ WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A
+ PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR
+ ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+ TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+ NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ POSSIBILITY OF SUCH DAMAGE.
+*/
+
+#include "cinder/audio/ParallelGraphProcessor.h"
+#include "cinder/audio/InputNode.h"
+#include "cinder/CinderAssert.h"
+
+#include <algorithm>
+#include <functional>
+#include <unordered_map>
+
+#if defined( CINDER_MSW )
+	#include <windows.h>
+#else
+	#include <pthread.h>
+#endif
+
+using namespace std;
+
+namespace cinder { namespace audio {
+
+namespace {
+
+// Number of times a worker checks for a new block before it goes to sleep. Offline and small-block rendering usually starts
+// the next block within this time, in which case the worker avoids the latency of being woken up.
+const size_t NUM_SPINS_BEFORE_SLEEP = 4096;
+
+thread_local const ParallelGraphProcessor *sCurrentWorkerProcessor = nullptr;
+
+// Gives each worker thread the same scheduling priority as the calling (audio) thread, so that the audio thread is never
+// left waiting on a worker that has been preempted by normal priority threads. Fails silently if not permitted.
+void matchThreadPriority( vector<thread> &threads )
+{
+#if defined( CINDER_MSW )
+	int priority = ::GetThreadPriority( ::GetCurrentThread() );
+	for( auto &t : threads )
+		::SetThreadPriority( t.native_handle(), priority );
+#else
+	int policy;
+	sched_param param;
+	if( ::pthread_getschedparam( ::pthread_self(), &policy, &param ) != 0 )
+		return;
+
+	for( auto &t : threads )
+		::pthread_setschedparam( t.native_handle(), policy, &param );
+#endif
+}
+
+} // anonymous namespace
+
+ParallelGraphProcessor::ParallelGraphProcessor( size_t numThreads )
+	: mNumThreads( std::max<size_t>( numThreads, 1 ) ), mGeneration( 0 ), mNumSleeping( 0 ), mQuit( false ), mWorkerPriorityMatched( false )
+{
+	for( size_t i = 1; i < mNumThreads; i++ )
+		mThreads.emplace_back( &ParallelGraphProcessor::workerThreadFn, this, i );
+}
+
+ParallelGraphProcessor::~ParallelGraphProcessor()
+{
+	{
+		lock_guard<mutex> lock( mWakeMutex );
+		mQuit = true;
+	}
+	mWakeCondition.notify_all();
+
+	for( auto &t : mThreads )
+		t.join();
+}
+
+const ParallelGraphProcessor* ParallelGraphProcessor::getCurrentWorkerProcessor()
+{
+	return sCurrentWorkerProcessor;
+}
+
+void ParallelGraphProcessor::clear()
+{
+	// Roots that partition() switched from in-place processing go back to it, unless they have since been reconfigured to sum
+	// or connected to a second output (which doesn't reconfigure a Node that is already summing).
+	for( const auto &subgraph : mSubgraphs ) {
+		Node *root = subgraph.mRoot.get();
+		if( root->mSummingForParallelProcessing ) {
+			root->mSummingForParallelProcessing = false;
+			if( root->getNumConnectedOutputs() <= 1 )
+				root->mProcessInPlace = true;
+		}
+	}
+
+	mSubgraphs.clear();
+	mStageOffsets.clear();
+	mSlices.reset();
+	mStageArrivals.reset();
+}
+
+void ParallelGraphProcessor::partition( const vector<NodeRef> &pulledNodes )
+{
+	clear();
+
+	// Collect every Node reachable from pulledNodes, ordered so that inputs come before the Node's that pull them.
+	vector<NodeRef> sortedNodes;
+	unordered_map<Node *, bool> visited;
+	function<void ( const NodeRef & )> visit = [&]( const NodeRef &node ) {
+		if( ! node || ! visited.emplace( node.get(), true ).second )
+			return;
+
+		for( const auto &input : node->getInputs() )
+			visit( input );
+
+		sortedNodes.push_back( node );
+	};
+
+	for( const auto &node : pulledNodes )
+		visit( node );
+
+	// A Node is exclusive when its only output is the Node that pulls it and every Node upstream of it is exclusive as well,
+	// in which case nothing else in the graph can observe it being pulled on another thread. Feedback cycles and hardware
+	// input are always left to the audio thread.
+	struct NodeInfo {
+		bool	mExclusive;
+		bool	mRoot;
+		size_t	mNumNodes;
+		size_t	mStage;
+	};
+
+	unordered_map<Node *, NodeInfo> infos;
+	infos.reserve( sortedNodes.size() );
+	for( const auto &node : sortedNodes ) {
+		NodeInfo info = { true, false, 1, 0 };
+		if( node->getNumConnectedOutputs() != 1 || node->supportsCycles() || dynamic_cast<InputDeviceNode *>( node.get() ) )
+			info.mExclusive = false;
+
+		for( const auto &input : node->getInputs() ) {
+			// an input that hasn't been visited yet closes a feedback cycle
+			auto inputInfoIt = infos.find( input.get() );
+			if( inputInfoIt == infos.end() ) {
+				info.mExclusive = false;
+				continue;
+			}
+
+			info.mExclusive = info.mExclusive && inputInfoIt->second.mExclusive;
+			info.mNumNodes += inputInfoIt->second.mNumNodes;
+		}
+
+		infos[node.get()] = info;
+	}
+
+	// Subgraph roots are the exclusive inputs of Node's that sum at least two of them. A subgraph that contains other
+	// subgraphs must wait for them, so its stage is one more than the highest stage it contains.
+	for( const auto &node : sortedNodes ) {
+		size_t numExclusiveInputs = 0;
+		for( const auto &input : node->getInputs() ) {
+			if( infos.at( input.get() ).mExclusive )
+				numExclusiveInputs++;
+		}
+
+		if( numExclusiveInputs < 2 )
+			continue;
+
+		for( const auto &input : node->getInputs() ) {
+			NodeInfo &inputInfo = infos.at( input.get() );
+			if( inputInfo.mExclusive )
+				inputInfo.mRoot = true;
+		}
+	}
+
+	for( const auto &node : sortedNodes ) {
+		NodeInfo &info = infos.at( node.get() );
+		if( ! info.mExclusive )
+			continue;
+
+		for( const auto &input : node->getInputs() ) {
+			const NodeInfo &inputInfo = infos.at( input.get() );
+			info.mStage = std::max( info.mStage, inputInfo.mRoot ? inputInfo.mStage + 1 : inputInfo.mStage );
+		}
+
+		if( info.mRoot )
+			mSubgraphs.push_back( { node, info.mNumNodes, info.mStage } );
+	}
+
+	if( mSubgraphs.empty() )
+		return;
+
+	// Roots must process out-of-place, so that their results are cached for the rest of the block. This also resizes their
+	// buffers if the frames per block changed. Roots that processed in-place are marked so that clear() can restore them.
+	for( const auto &subgraph : mSubgraphs ) {
+		Node *root = subgraph.mRoot.get();
+		const bool processedInPlace = root->getProcessesInPlace();
+		root->setupProcessWithSumming();
+		root->mSummingForParallelProcessing = processedInPlace;
+	}
+
+	stable_sort( mSubgraphs.begin(), mSubgraphs.end(), []( const Subgraph &a, const Subgraph &b ) {
+		return a.mStage != b.mStage ? a.mStage < b.mStage : a.mNumNodes > b.mNumNodes;
+	} );
+
+	const size_t numStages = mSubgraphs.back().mStage + 1;
+	mStageOffsets.resize( numStages + 1, mSubgraphs.size() );
+	for( size_t i = mSubgraphs.size(); i > 0; i-- )
+		mStageOffsets[mSubgraphs[i - 1].mStage] = i - 1;
+
+	// Within each stage, assign the largest remaining subgraph to the thread with the least Node's so far, then store each
+	// thread's subgraphs contiguously so that they make up its Slice.
+	mSlices.reset( new Slice[numStages * mNumThreads] );
+	mStageArrivals.reset( new atomic<size_t>[numStages] );
+
+	vector<vector<Subgraph>> threadSubgraphs( mNumThreads );
+	vector<size_t> threadNumNodes( mNumThreads );
+	for( size_t stage = 0; stage < numStages; stage++ ) {
+		for( size_t t = 0; t < mNumThreads; t++ ) {
+			threadSubgraphs[t].clear();
+			threadNumNodes[t] = 0;
+		}
+
+		for( size_t i = mStageOffsets[stage]; i < mStageOffsets[stage + 1]; i++ ) {
+			size_t t = size_t( min_element( threadNumNodes.begin(), threadNumNodes.end() ) - threadNumNodes.begin() );
+			threadSubgraphs[t].push_back( mSubgraphs[i] );
+			threadNumNodes[t] += mSubgraphs[i].mNumNodes;
+		}
+
+		size_t index = mStageOffsets[stage];
+		for( size_t t = 0; t < mNumThreads; t++ ) {
+			Slice &slice = mSlices[stage * mNumThreads + t];
+			slice.mBegin = index;
+			for( const auto &subgraph : threadSubgraphs[t] )
+				mSubgraphs[index++] = subgraph;
+
+			slice.mEnd = index;
+			slice.mNext = slice.mBegin;
+		}
+	}
+}
+
+void ParallelGraphProcessor::process()
+{
+	const size_t numStages = getNumStages();
+	if( numStages == 0 )
+		return;
+
+	if( ! mWorkerPriorityMatched ) {
+		matchThreadPriority( mThreads );
+		mWorkerPriorityMatched = true;
+	}
+
+	for( size_t stage = 0; stage < numStages; stage++ ) {
+		mStageArrivals[stage].store( 0, memory_order_relaxed );
+		for( size_t t = 0; t < mNumThreads; t++ ) {
+			Slice &slice = mSlices[stage * mNumThreads + t];
+			slice.mNext.store( slice.mBegin, memory_order_relaxed );
+		}
+	}
+
+	// Start the block on the workers, only waking the ones that have gone to sleep.
+	mGeneration.fetch_add( 1 );
+	if( mNumSleeping.load() > 0 ) {
+		lock_guard<mutex> lock( mWakeMutex );
+		mWakeCondition.notify_all();
+	}
+
+	processStages( 0, numStages );
+
+	// All subgraphs must be finished before the graph is pulled.
+	while( mStageArrivals[numStages - 1].load( memory_order_acquire ) < mNumThreads )
+		this_thread::yield();
+}
+
+void ParallelGraphProcessor::workerThreadFn( size_t threadIndex )
+{
+	sCurrentWorkerProcessor = this;
+
+	uint64_t lastGeneration = 0;
+	while( true ) {
+		size_t numSpins = 0;
+		while( mGeneration.load() == lastGeneration && ! mQuit ) {
+			if( ++numSpins < NUM_SPINS_BEFORE_SLEEP ) {
+				this_thread::yield();
+				continue;
+			}
+
+			mNumSleeping++;
+			{
+				unique_lock<mutex> lock( mWakeMutex );
+				mWakeCondition.wait( lock, [&] { return mGeneration.load() != lastGeneration || mQuit; } );
+			}
+			mNumSleeping--;
+		}
+
+		if( mQuit )
+			return;
+
+		// process() waits for every worker to finish before starting another block, so there is exactly one new generation.
+		lastGeneration++;
+		processStages( threadIndex, getNumStages() );
+	}
+}
+
+void ParallelGraphProcessor::processStages( size_t threadIndex, size_t numStages )
+{
+	for( size_t stage = 0; stage < numStages; stage++ ) {
+		// Work through this thread's own slice first, then take what is left from the others.
+		for( size_t i = 0; i < mNumThreads; i++ ) {
+			Slice &slice = mSlices[stage * mNumThreads + ( threadIndex + i ) % mNumThreads];
+			while( true ) {
+				size_t index = slice.mNext.fetch_add( 1, memory_order_relaxed );
+				if( index >= slice.mEnd )
+					break;
+
+				processSubgraph( mSubgraphs[index] );
+			}
+		}
+
+		mStageArrivals[stage].fetch_add( 1, memory_order_acq_rel );
+
+		// After the last stage, only the audio thread waits (in process()), so that workers never touch the stage data
+		// once it may be repartitioned.
+		if( stage + 1 < numStages ) {
+			while( mStageArrivals[stage].load( memory_order_acquire ) < mNumThreads )
+				this_thread::yield();
+		}
+	}
+}
+
+void ParallelGraphProcessor::processSubgraph( const Subgraph &subgraph )
+{
+	// If the root was reconfigured to process in-place since partition(), leave it to be pulled by the audio thread.
+	Node *root = subgraph.mRoot.get();
+	if( ! root->getProcessesInPlace() )
+		root->pullInputs( root->getInternalBuffer() );
+}
+
+} } // namespace cinder::audio
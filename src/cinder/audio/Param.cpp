@@ -71,9 +71,16 @@ Param::Param( Node *parentNode, float initialValue )
 
 void Param::setValue( float value )
 {
-	lock_guard<mutex> lock( getContext()->getMutex() );
-	resetImpl();
+	// set immediately so getValue() reflects the change, and again on the audio thread in case an Event overwrites it before the reset is processed.
 	mValue = value;
+	std::atomic_store( &mLastEvent, EventRef() );
+
+	NodeRef parent = mParentNode->shared_from_this();
+	NodeRef processor;
+	getContext()->enqueueCommand( [this, parent, value, processor]() mutable {
+		resetImpl( &processor );
+		mValue = value;
+	} );
 }
 
 EventRef Param::applyRamp( float valueEnd, double rampSeconds, const Options &options )
@@ -89,13 +96,7 @@ EventRef Param::applyRamp( float valueEnd, double rampSeconds, const Options &op
 	if( ! options.getLabel().empty() )
 		event->mLabel = options.getLabel();
 
-	lock_guard<mutex> lock( ctx->getMutex() );
-
-	removeEventsAt( timeBegin );
-	if( mProcessor )
-		mProcessor.reset();
-
-	mEvents.push_back( event );
+	enqueueEvent( event, true );
 	return event;
 }
 
@@ -112,13 +113,7 @@ EventRef Param::applyRamp( float valueBegin, float valueEnd, double rampSeconds,
 	if( ! options.getLabel().empty() )
 		event->mLabel = options.getLabel();
 
-	lock_guard<mutex> lock( ctx->getMutex() );
-
-	removeEventsAt( timeBegin );
-	if( mProcessor )
-		mProcessor.reset();
-
-	mEvents.push_back( event );
+	enqueueEvent( event, true );
 	return event;
 }
 
@@ -126,7 +121,6 @@ EventRef Param::appendRamp( float valueEnd, double rampSeconds, const Options &o
 {
 	initInternalBuffer();
 
-	auto ctx = getContext();
 	auto endTimeAndValue = findEndTimeAndValue();
 	double timeBegin = ( options.getBeginTime() >= 0 ? options.getBeginTime() : endTimeAndValue.first + options.getDelay() );
 	double timeEnd = timeBegin + rampSeconds;
@@ -136,8 +130,7 @@ EventRef Param::appendRamp( float valueEnd, double rampSeconds, const Options &o
 	if( ! options.getLabel().empty() )
 		event->mLabel = options.getLabel();
 
-	lock_guard<mutex> lock( ctx->getMutex() );
-	mEvents.push_back( event );
+	enqueueEvent( event, false );
 	return event;
 }
 
@@ -145,7 +138,6 @@ EventRef Param::appendRamp( float valueBegin, float valueEnd, double rampSeconds
 {
 	initInternalBuffer();
 
-	auto ctx = getContext();
 	auto endTimeAndValue = findEndTimeAndValue();
 	double timeBegin = ( options.getBeginTime() >= 0 ? options.getBeginTime() : endTimeAndValue.first + options.getDelay() );
 	double timeEnd = timeBegin + rampSeconds;
@@ -155,8 +147,7 @@ EventRef Param::appendRamp( float valueBegin, float valueEnd, double rampSeconds
 	if( ! options.getLabel().empty() )
 		event->mLabel = options.getLabel();
 
-	lock_guard<mutex> lock( ctx->getMutex() );
-	mEvents.push_back( event );
+	enqueueEvent( event, false );
 	return event;
 }
 
@@ -166,6 +157,7 @@ void Param::setProcessor( const NodeRef &node )
 		return;
 
 	initInternalBuffer();
+	std::atomic_store( &mLastEvent, EventRef() );
 
 	lock_guard<mutex> lock( getContext()->getMutex() );
 
@@ -181,10 +173,14 @@ void Param::setProcessor( const NodeRef &node )
 
 void Param::reset()
 {
-	lock_guard<mutex> lock( getContext()->getMutex() );
-	resetImpl();
-}
+	std::atomic_store( &mLastEvent, EventRef() );
 
+	NodeRef parent = mParentNode->shared_from_this();
+	NodeRef processor;
+	getContext()->enqueueCommand( [this, parent, processor]() mutable {
+		resetImpl( &processor );
+	} );
+}
 
 size_t Param::getNumEvents() const
 {
@@ -195,27 +191,22 @@ size_t Param::getNumEvents() const
 float Param::findDuration() const
 {
 	auto ctx = getContext();
-	lock_guard<mutex> lock( ctx->getMutex() );
+	auto endTimeAndValue = findEndTimeAndValue();
 
-	if( mEvents.empty() )
-		return 0;
-	else {
-		const EventRef &event = mEvents.back();
-		return static_cast<float>(event->mTimeEnd - ctx->getNumProcessedSeconds());
-	}
+	return static_cast<float>( endTimeAndValue.first - ctx->getNumProcessedSeconds() );
 }
 
 pair<double, float> Param::findEndTimeAndValue() const
 {
+	// mEvents belongs to the audio thread, so the latest Event is tracked separately on the user thread
 	auto ctx = getContext();
-	lock_guard<mutex> lock( ctx->getMutex() );
+	const double currentTime = ctx->getNumProcessedSeconds();
+	const EventRef event = std::atomic_load( &mLastEvent );
 
-	if( mEvents.empty() )
-		return make_pair( ctx->getNumProcessedSeconds(), mValue.load() );
-	else {
-		const EventRef &event = mEvents.back();
+	if( ! event || event->isComplete() || event->mIsCanceled || event->mTimeEnd <= currentTime )
+		return make_pair( currentTime, mValue.load() );
+	else
 		return make_pair( event->mTimeEnd, event->mValueEnd );
-	}
 }
 
 const float* Param::getValueArray()
@@ -331,7 +322,7 @@ bool Param::eval( double timeBegin, float *array, size_t arrayLength, size_t sam
 // Protected
 // ----------------------------------------------------------------------------------------------------
 
-void Param::resetImpl()
+void Param::resetImpl( NodeRef *releasedProcessor )
 {
 	if( ! mEvents.empty() ) {
 		for( auto &event : mEvents )
@@ -340,22 +331,40 @@ void Param::resetImpl()
 		mEvents.clear();
 	}
 
+	if( releasedProcessor )
+		releasedProcessor->swap( mProcessor );
+
 	mProcessor.reset();
 }
 
+void Param::enqueueEvent( const EventRef &event, bool replaceExisting )
+{
+	std::atomic_store( &mLastEvent, event );
+
+	// The command holds a reference to the parent Node so this Param outlives it, and takes ownership of any
+	// processor Node it replaces so that it is released on the user thread rather than the audio thread.
+	NodeRef parent = mParentNode->shared_from_this();
+	NodeRef processor;
+	getContext()->enqueueCommand( [this, parent, event, replaceExisting, processor]() mutable {
+		if( replaceExisting ) {
+			removeEventsAt( event->mTimeBegin );
+			processor.swap( mProcessor );
+		}
+
+		mEvents.push_back( event );
+	} );
+}
+
 void Param::removeEventsAt( double time )
 {
-	auto context = mParentNode->getContext();
-	bool contextDisabled = ! context || ! context->isEnabled();
+	// Called on the audio thread (or synchronized with it), so replaced Events can be removed right away. This keeps mEvents
+	// short when many ramps are applied within the same processing block.
 	for( auto eventIt = mEvents.begin(); eventIt != mEvents.end(); /* */ ) {
 		Event &event = **eventIt;
 		if( event.getTimeBegin() >= time ) {
-			if( contextDisabled ) {
-				eventIt = mEvents.erase( eventIt );
-			}
-			else {
-				event.cancel();
-			}
+			event.cancel();
+			eventIt = mEvents.erase( eventIt );
+			continue;
 		}
 		else if( event.getTimeEnd() >= time ) {
 			// Handle cancel later to allow the ramp to continue until the cancel point. Only reset cancel time if it is newer than a previous setting.
@@ -365,6 +374,8 @@ void Param::removeEventsAt( double time )
 			else
 				event.mTimeCancel = time;
 		}
+
+		++eventIt;
 	}
 }
 
@@ -23,6 +23,7 @@
 
 #include "cinder/audio/SamplePlayerNode.h"
 #include "cinder/audio/Context.h"
+#include "cinder/audio/ContextOffline.h"
 #include "cinder/CinderMath.h"
 
 using namespace ci;
@@ -217,13 +218,13 @@ void BufferPlayerNode::process( Buffer *buffer )
 // ----------------------------------------------------------------------------------------------------
 
 FilePlayerNode::FilePlayerNode( const Format &format )
-	: SamplePlayerNode( format ), mRingBufferPaddingFactor( 2 ), mLastUnderrun( 0 ), mLastOverrun( 0 ), mIsReadAsync( true )
+	: SamplePlayerNode( format ), mRingBufferPaddingFactor( 2 ), mLastUnderrun( 0 ), mLastOverrun( 0 ), mIsReadAsync( true ), mReadBlocking( false )
 {
 }
 
 FilePlayerNode::FilePlayerNode( const SourceFileRef &sourceFile, bool isReadAsync, const Format &format )
 	: SamplePlayerNode( format ), mSourceFile( sourceFile ), mIsReadAsync( isReadAsync ), mRingBufferPaddingFactor( 2 ),
-		mLastUnderrun( 0 ), mLastOverrun( 0 )
+		mLastUnderrun( 0 ), mLastOverrun( 0 ), mReadBlocking( false )
 {
 	if( mSourceFile ) {
 		mNumFrames = mSourceFile->getNumFrames();
@@ -233,6 +234,12 @@ FilePlayerNode::FilePlayerNode( const SourceFileRef &sourceFile, bool isReadAsyn
 	}
 }
 
+FilePlayerNode::FilePlayerNode( const SourceFileRef &sourceFile, const FileBlockCacheRef &blockCache, const Format &format )
+	: FilePlayerNode( sourceFile, true, format )
+{
+	mBlockCache = blockCache ? blockCache : FileBlockCache::getDefault();
+}
+
 FilePlayerNode::~FilePlayerNode()
 {
 	if( isInitialized() )
@@ -241,6 +248,22 @@ FilePlayerNode::~FilePlayerNode()
 
 void FilePlayerNode::initialize()
 {
+	if( mBlockCache ) {
+		// The cache's I/O threads do all reading. When rendering offline, the audio thread waits for them instead of underrunning.
+		mReadBlocking = dynamic_pointer_cast<ContextOffline>( getContext() ) != nullptr;
+
+		if( mSourceFile ) {
+			mStream = mBlockCache->openStream( mSourceFile, getSampleRate() );
+			mNumFrames = mStream->getNumFrames();
+			mStream->prefetch( mReadPos );
+		}
+
+		if( ! mLoopEnd  || mLoopEnd > mNumFrames )
+			mLoopEnd = mNumFrames;
+
+		return;
+	}
+
 	if( mSourceFile ) {
 		// Ensure the SourceFile's output samplerate matches ours.
 		size_t sampleRate = getSampleRate();
@@ -270,6 +293,7 @@ void FilePlayerNode::uninitialize()
 {
 	destroyReadThreadImpl();
 	mRingBuffers.clear();
+	mStream.reset();
 }
 
 void FilePlayerNode::enableProcessing()
@@ -333,13 +357,18 @@ void FilePlayerNode::setSourceFile( const SourceFileRef &sourceFile )
 
 	// ensure the source's samplerate matches the context
 	size_t sampleRate = getSampleRate();
-	if( sourceFile->getSampleRate() == sampleRate )
+	if( sourceFile->getSampleRate() == sampleRate || mBlockCache )
 		mSourceFile = sourceFile;
 	else
 		mSourceFile = sourceFile->cloneWithSampleRate( sampleRate );
 
 	// reset num frames and loop markers
-	mNumFrames = mSourceFile->getNumFrames();
+	if( mBlockCache && isInitialized() ) {
+		mStream = mBlockCache->openStream( mSourceFile, sampleRate );
+		mNumFrames = mStream->getNumFrames();
+	}
+	else
+		mNumFrames = mSourceFile->getNumFrames();
 	mLoopBegin = 0;
 	mLoopEnd = mNumFrames;
 
@@ -368,6 +397,11 @@ uint64_t FilePlayerNode::getLastOverrun()
 
 void FilePlayerNode::process( Buffer *buffer )
 {
+	if( mStream ) {
+		processCached( buffer );
+		return;
+	}
+
 	size_t numFrames = buffer->getNumFrames();
 	size_t readPos = mReadPos;
 	size_t numReadAvail = mRingBuffers[0].getAvailableRead();
@@ -400,6 +434,57 @@ void FilePlayerNode::process( Buffer *buffer )
 	}
 }
 
+void FilePlayerNode::processCached( Buffer *buffer )
+{
+	const auto &frameRange = getProcessFramesRange();
+
+	size_t readPos = mReadPos;
+	size_t numFrames = frameRange.second - frameRange.first;
+	size_t readEnd = mLoop ? mLoopEnd.load() : mNumFrames;
+
+	size_t readCount = 0;
+	if( readPos <= readEnd ) {
+		readCount = min( readEnd - readPos, numFrames );
+		readCached( buffer, frameRange.first, readPos, readCount );
+	}
+
+	if( readCount < numFrames  ) {
+		// End of File. If looping read from the beginning, otherwise disable and mark mIsEof.
+		if( mLoop ) {
+			size_t readBegin = mLoopBegin;
+			size_t readLeft = min( numFrames - readCount, mNumFrames - readBegin );
+
+			readCached( buffer, frameRange.first + readCount, readBegin, readLeft );
+			mReadPos.store( readBegin + readLeft );
+		}
+		else {
+			mIsEof = true;
+			mReadPos = mNumFrames;
+			disable();
+		}
+	}
+	else
+		mReadPos += readCount;
+
+	if( mLoop )
+		mStream->prefetch( mReadPos, mLoopBegin, readEnd );
+	else
+		mStream->prefetch( mReadPos );
+}
+
+size_t FilePlayerNode::readCached( Buffer *buffer, size_t bufferFrameOffset, size_t readPos, size_t numFrames )
+{
+	size_t numRead = mReadBlocking ? mStream->readBlocking( buffer, bufferFrameOffset, readPos, numFrames ) : mStream->read( buffer, bufferFrameOffset, readPos, numFrames );
+	if( numRead < numFrames ) {
+		// the block isn't loaded yet, play silence in its place rather than stalling the audio thread
+		buffer->zero( bufferFrameOffset + numRead, numFrames - numRead );
+		if( readPos + numRead < mNumFrames )
+			mLastUnderrun = getContext()->getNumProcessedFrames();
+	}
+
+	return numRead;
+}
+
 void FilePlayerNode::readAsyncImpl()
 {
 	size_t lastReadPos = mReadPos;
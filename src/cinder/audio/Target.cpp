@@ -24,6 +24,7 @@
 #include "cinder/audio/Target.h"
 #include "cinder/CinderAssert.h"
 #include "cinder/audio/FileOggVorbis.h"
+#include "cinder/audio/FileWav.h"
 
 #include "cinder/Utilities.h"
 
@@ -61,6 +62,9 @@ std::unique_ptr<TargetFile> TargetFile::create( const DataTargetRef &dataTarget,
 #elif defined( CINDER_MSW )
 	return std::unique_ptr<TargetFile>( new msw::TargetFileMediaFoundation( dataTarget, sampleRate, numChannels, sampleType, ext ) );
 #else
+	if( ext == "wav" )
+		return std::unique_ptr<TargetFile>( new TargetFileWav( dataTarget, sampleRate, numChannels, sampleType ) );
+
 	return nullptr;
 #endif
 }
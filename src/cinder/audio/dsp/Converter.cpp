@@ -24,6 +24,7 @@
 #include "cinder/audio/dsp/Converter.h"
 #include "cinder/audio/dsp/Dsp.h"
 #include "cinder/audio/dsp/ConverterR8brain.h"
+#include "cinder/audio/dsp/DspSimd.h"
 #include "cinder/CinderAssert.h"
 
 #if defined( CINDER_COCOA )
@@ -37,6 +38,40 @@ using namespace std;
 
 namespace cinder { namespace audio { namespace dsp {
 
+// ----------------------------------------------------------------------------------------------------
+// float / int16 conversion and interleaving, forwarded to the kernels for the current SimdLevel
+// ----------------------------------------------------------------------------------------------------
+
+void convert( const float *sourceArray, int16_t *destArray, size_t length )
+{
+	simd::getKernels().floatToInt16( sourceArray, destArray, length );
+}
+
+void convert( const int16_t *sourceArray, float *destArray, size_t length )
+{
+	simd::getKernels().int16ToFloat( sourceArray, destArray, length );
+}
+
+void interleave( const float *nonInterleavedSourceArray, float *interleavedDestArray, size_t numFramesPerChannel, size_t numChannels, size_t numCopyFrames )
+{
+	simd::getKernels().interleave( nonInterleavedSourceArray, interleavedDestArray, numFramesPerChannel, numChannels, numCopyFrames );
+}
+
+void deinterleave( const float *interleavedSourceArray, float *nonInterleavedDestArray, size_t numFramesPerChannel, size_t numChannels, size_t numCopyFrames )
+{
+	simd::getKernels().deinterleave( interleavedSourceArray, nonInterleavedDestArray, numFramesPerChannel, numChannels, numCopyFrames );
+}
+
+void interleave( const float *nonInterleavedFloatSourceArray, int16_t *interleavedInt16DestArray, size_t numFramesPerChannel, size_t numChannels, size_t numCopyFrames )
+{
+	simd::getKernels().interleaveInt16( nonInterleavedFloatSourceArray, interleavedInt16DestArray, numFramesPerChannel, numChannels, numCopyFrames );
+}
+
+void deinterleave( const int16_t *interleavedInt16SourceArray, float *nonInterleavedFloatDestArray, size_t numFramesPerChannel, size_t numChannels, size_t numCopyFrames )
+{
+	simd::getKernels().deinterleaveInt16( interleavedInt16SourceArray, nonInterleavedFloatDestArray, numFramesPerChannel, numChannels, numCopyFrames );
+}
+
 unique_ptr<Converter> Converter::create( size_t sourceSampleRate, size_t destSampleRate, size_t sourceNumChannels, size_t destNumChannels, size_t sourceMaxFramesPerBlock )
 {
 #if defined( CINDER_COCOA )
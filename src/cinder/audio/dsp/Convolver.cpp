@@ -0,0 +1,155 @@
+/*
+ Copyright (c) 2026, The Cinder Project
+
+ This code is intended to be used with the Cinder C++ library, http://libcinder.org
+
+ Redistribution and use in source and binary forms, with or without modification, are permitted provided that
+ the following conditions are met:
+
+    * Redistributions of source code must retain the above copyright notice, this list of conditions and
+	the following disclaimer.
+    * Redistributions in binary form must reproduce the above copyright notice, this list of conditions and
+	the following disclaimer in the documentation and/or other materials provided with the distribution.
+
+ THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED
+ WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A
+ PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR
+ ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+ TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+ NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ POSSIBILITY OF SUCH DAMAGE.
+*/
+
+#include "cinder/audio/dsp/Convolver.h"
+#include "cinder/audio/Exception.h"
+#include "cinder/CinderAssert.h"
+#include "cinder/CinderMath.h"
+
+#include <algorithm>
+
+using namespace std;
+
+namespace cinder { namespace audio { namespace dsp {
+
+namespace {
+
+// Spectra are packed as returned by Fft::forward(), with the (real valued) nyquist bin stored in imag[0].
+void complexMultiplyAccumulate( const BufferSpectral &a, const BufferSpectral &b, BufferSpectral *result )
+{
+	const size_t size = result->getNumFrames();
+	const float *aReal = a.getReal();
+	const float *aImag = a.getImag();
+	const float *bReal = b.getReal();
+	const float *bImag = b.getImag();
+	float *real = result->getReal();
+	float *imag = result->getImag();
+
+	real[0] += aReal[0] * bReal[0];
+	imag[0] += aImag[0] * bImag[0];
+
+	for( size_t k = 1; k < size; k++ ) {
+		real[k] += aReal[k] * bReal[k] - aImag[k] * bImag[k];
+		imag[k] += aReal[k] * bImag[k] + aImag[k] * bReal[k];
+	}
+}
+
+} // anonymous namespace
+
+Convolver::Convolver( size_t blockSize, const float *impulseResponse, size_t impulseResponseLength )
+	: mBlockSize( blockSize ), mInputFill( 0 ), mCurrentSegment( 0 )
+{
+	if( mBlockSize < 2 || ! isPowerOf2( mBlockSize ) )
+		throw AudioExc( "Convolver block size must be a power of two" );
+
+	const size_t segmentSize = mBlockSize * 2;
+	mFft.reset( new Fft( segmentSize ) );
+	mFftBuffer = Buffer( segmentSize );
+	mInputBuffer = Buffer( mBlockSize );
+	mOverlap = Buffer( mBlockSize );
+	mPreMultiplied = BufferSpectral( segmentSize );
+	mConvolved = BufferSpectral( segmentSize );
+
+	// Fft::forward() doesn't scale the same on all platforms, so measure it with an impulse and divide it out of the impulse response
+	// spectra. Then inverse( forward( x ) * spectrum( h ) ) is exactly x convolved with h.
+	mFftBuffer[0] = 1;
+	mFft->forward( &mFftBuffer, &mConvolved );
+	const float spectrumScale = 1.0f / mConvolved.getReal()[0];
+
+	const size_t numPartitions = max<size_t>( 1, ( impulseResponseLength + mBlockSize - 1 ) / mBlockSize );
+	for( size_t i = 0; i < numPartitions; i++ ) {
+		size_t partitionBegin = i * mBlockSize;
+		size_t partitionLength = partitionBegin < impulseResponseLength ? min( mBlockSize, impulseResponseLength - partitionBegin ) : 0;
+
+		mFftBuffer.zero();
+		copy( impulseResponse + partitionBegin, impulseResponse + partitionBegin + partitionLength, mFftBuffer.getData() );
+
+		mIrSpectra.emplace_back( segmentSize );
+		mFft->forward( &mFftBuffer, &mIrSpectra.back() );
+		dsp::mul( mIrSpectra.back().getData(), spectrumScale, mIrSpectra.back().getData(), mIrSpectra.back().getSize() );
+
+		mInputSpectra.emplace_back( segmentSize );
+	}
+
+	reset();
+}
+
+void Convolver::reset()
+{
+	for( auto &spectrum : mInputSpectra )
+		spectrum.zero();
+
+	mInputBuffer.zero();
+	mOverlap.zero();
+	mPreMultiplied.zero();
+	mInputFill = 0;
+	mCurrentSegment = 0;
+}
+
+void Convolver::process( const float *input, float *output, size_t numFrames )
+{
+	const size_t numPartitions = mIrSpectra.size();
+
+	size_t numProcessed = 0;
+	while( numProcessed < numFrames ) {
+		const bool inputWasEmpty = mInputFill == 0;
+		const size_t inputPos = mInputFill;
+		const size_t numProcessing = min( numFrames - numProcessed, mBlockSize - mInputFill );
+
+		// the input is copied before output is written, which allows them to alias
+		copy( input + numProcessed, input + numProcessed + numProcessing, mInputBuffer.getData() + inputPos );
+
+		mFftBuffer.zero();
+		copy( mInputBuffer.getData(), mInputBuffer.getData() + mBlockSize, mFftBuffer.getData() );
+		mFft->forward( &mFftBuffer, &mInputSpectra[mCurrentSegment] );
+
+		// the older input blocks don't change until this one is complete, so their contribution is only summed once per block
+		if( inputWasEmpty ) {
+			mPreMultiplied.zero();
+			for( size_t i = 1; i < numPartitions; i++ ) {
+				const size_t inputIndex = ( mCurrentSegment + i ) % numPartitions;
+				complexMultiplyAccumulate( mIrSpectra[i], mInputSpectra[inputIndex], &mPreMultiplied );
+			}
+		}
+
+		mConvolved.copy( mPreMultiplied );
+		complexMultiplyAccumulate( mIrSpectra[0], mInputSpectra[mCurrentSegment], &mConvolved );
+
+		mFft->inverse( &mConvolved, &mFftBuffer );
+
+		dsp::add( mFftBuffer.getData() + inputPos, mOverlap.getData() + inputPos, output + numProcessed, numProcessing );
+
+		mInputFill += numProcessing;
+		if( mInputFill == mBlockSize ) {
+			// keep the second half of the segment to overlap with the next block, and make room for the next input spectrum
+			copy( mFftBuffer.getData() + mBlockSize, mFftBuffer.getData() + 2 * mBlockSize, mOverlap.getData() );
+			mInputBuffer.zero();
+			mInputFill = 0;
+			mCurrentSegment = mCurrentSegment > 0 ? mCurrentSegment - 1 : numPartitions - 1;
+		}
+
+		numProcessed += numProcessing;
+	}
+}
+
+} } } // namespace cinder::audio::dsp
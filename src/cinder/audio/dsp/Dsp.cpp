@@ -22,6 +22,7 @@
 */
 
 #include "cinder/audio/dsp/Dsp.h"
+#include "cinder/audio/dsp/DspSimd.h"
 
 #include "cinder/CinderMath.h"
 
@@ -166,65 +167,52 @@ void addMul( const float *arrayA, const float *arrayB, float scalar, float *resu
 
 #else // ! defined( CINDER_AUDIO_VDSP )
 
+// The portable routines forward to the kernels for the current SimdLevel, see DspSimd.cpp
+
 void fill( float value, float *array, size_t length )
 {
-	for( size_t i = 0; i < length; i++ )
-		array[i] = value;
+	simd::getKernels().fill( value, array, length );
 }
 
 float sum( const float *array, size_t length )
 {
-	float result( 0.0f );
-	for( size_t i = 0; i < length; i++ )
-		result += array[i];
-	return result;
+	return simd::getKernels().sum( array, length );
 }
 
 void add( const float *array, float scalar, float *result, size_t length )
 {
-	for( size_t i = 0; i < length; i++ )
-		result[i] = array[i] + scalar;
+	simd::getKernels().addScalar( array, scalar, result, length );
 }
 
 void add( const float *arrayA, const float *arrayB, float *result, size_t length )
 {
-	for( size_t i = 0; i < length; i++ )
-		result[i] = arrayA[i] + arrayB[i];
+	simd::getKernels().add( arrayA, arrayB, result, length );
 }
 
 void sub( const float *array, float scalar, float *result, size_t length )
 {
-	for( size_t i = 0; i < length; i++ )
-		result[i] = array[i] - scalar;
+	simd::getKernels().addScalar( array, -scalar, result, length );
 }
 
 void sub( const float *arrayA, const float *arrayB, float *result, size_t length )
 {
-	for( size_t i = 0; i < length; i++ )
-		result[i] = arrayA[i] - arrayB[i];
+	simd::getKernels().sub( arrayA, arrayB, result, length );
 }
 
 float rms( const float *array, size_t length )
 {
-	float sumSquared( 0.0f );
-	for( size_t i = 0; i < length; i++ ) {
-		float val = array[i];
-		sumSquared += val * val;
-	}
-
+	float sumSquared = simd::getKernels().sumSquares( array, length );
 	return math<float>::sqrt( sumSquared / (float)length );
 }
 
 void mul( const float *array, float scalar, float *result, size_t length )
 {
-	for( size_t i = 0; i < length; i++ )
-		result[i] = array[i] * scalar;
+	simd::getKernels().mulScalar( array, scalar, result, length );
 }
 
 void mul( const float *arrayA, const float *arrayB, float *result, size_t length )
 {
-	for( size_t i = 0; i < length; i++ )
-		result[i] = arrayA[i] * arrayB[i];
+	simd::getKernels().mul( arrayA, arrayB, result, length );
 }
 
 void divide( const float *array, float scalar, float *result, size_t length )
@@ -240,19 +228,22 @@ void divide( const float *arrayA, const float *arrayB, float *result, size_t len
 
 void addMul( const float *arrayA, const float *arrayB, float scalar, float *result, size_t length )
 {
-	for( size_t i = 0; i < length; i++ )
-		result[i] = ( arrayA[i] + arrayB[i] ) * scalar;
+	simd::getKernels().addMul( arrayA, arrayB, scalar, result, length );
 }
 
 #endif // ! defined( CINDER_AUDIO_VDSP )
 
 void normalize( float *array, size_t length, float maxValue )
 {
-	float max = 0;
-	for( size_t i = 0; i < length; i++ ) {
-		if( max < array[i] )
-			max = array[i];
-	}
+	if( ! length )
+		return;
+
+#if defined( CINDER_AUDIO_VDSP )
+	float max;
+	vDSP_maxv( array, 1, &max, length );
+#else
+	float max = simd::getKernels().max( array, length );
+#endif
 
 	if( max > 0.00001f ) {
 		mul( array, maxValue / max, array, length );
@@ -0,0 +1,1166 @@
+/*
+ Copyright (c) 2026, The Cinder Project
+
+ This code is intended to be used with the Cinder C++ library, http://libcinder.org
+
+ Redistribution and use in source and binary forms, with or without modification, are permitted provided that
+ the following conditions are met:
+
+    * Redistributions of source code must retain the above copyright notice, this list of conditions and
+	the following disclaimer.
+    * Redistributions in binary form must reproduce the above copyright notice, this list of conditions and
+	the following disclaimer in the documentation and/or other materials provided with the distribution.
+
+ THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED
+ WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A
+ PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR
+ ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+ TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+ NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ POSSIBILITY OF SUCH DAMAGE.
+*/
+
+#include "cinder/audio/dsp/DspSimd.h"
+
+#include <algorithm>
+#include <atomic>
+#include <cstring>
+
+#if defined( __SSE2__ ) || defined( _M_X64 ) || ( defined( _M_IX86_FP ) && _M_IX86_FP >= 2 )
+	#define CINDER_AUDIO_SSE2
+	#include <emmintrin.h>
+	#include <xmmintrin.h>
+
+	// AVX2 kernels are compiled for a specific target and only selected after checking the CPU at runtime.
+	#if defined( _MSC_VER ) && ! defined( __clang__ )
+		#define CINDER_AUDIO_AVX2
+		#define CI_TARGET_AVX2
+		#include <immintrin.h>
+		#include <intrin.h>
+	#elif defined( __GNUC__ ) || defined( __clang__ )
+		#define CINDER_AUDIO_AVX2
+		#define CI_TARGET_AVX2 __attribute__(( target( "avx2" ) ))
+		#include <immintrin.h>
+	#endif
+#elif defined( __ARM_NEON ) || defined( __ARM_NEON__ )
+	#define CINDER_AUDIO_NEON
+	#include <arm_neon.h>
+#endif
+
+using namespace std;
+
+namespace cinder { namespace audio { namespace dsp { namespace simd {
+
+namespace {
+
+const float INT16_NORMALIZER		= 32768.0f;
+const float INT16_INV_NORMALIZER	= 3.0517578125e-05f;	// 1.0 / 32768.0
+
+// Float to int16 conversion used by all levels: scale, clamp to the int16 range, then truncate toward zero.
+inline int16_t floatToInt16Sample( float value )
+{
+	float scaled = std::min( std::max( value * INT16_NORMALIZER, -32768.0f ), 32767.0f );
+	return int16_t( scaled );
+}
+
+// ----------------------------------------------------------------------------------------------------
+// Scalar
+// ----------------------------------------------------------------------------------------------------
+
+void fillScalar( float value, float *array, size_t length )
+{
+	for( size_t i = 0; i < length; i++ )
+		array[i] = value;
+}
+
+void addScalarScalar( const float *array, float scalar, float *result, size_t length )
+{
+	for( size_t i = 0; i < length; i++ )
+		result[i] = array[i] + scalar;
+}
+
+void addScalar( const float *arrayA, const float *arrayB, float *result, size_t length )
+{
+	for( size_t i = 0; i < length; i++ )
+		result[i] = arrayA[i] + arrayB[i];
+}
+
+void subScalar( const float *arrayA, const float *arrayB, float *result, size_t length )
+{
+	for( size_t i = 0; i < length; i++ )
+		result[i] = arrayA[i] - arrayB[i];
+}
+
+void mulScalarScalar( const float *array, float scalar, float *result, size_t length )
+{
+	for( size_t i = 0; i < length; i++ )
+		result[i] = array[i] * scalar;
+}
+
+void mulScalar( const float *arrayA, const float *arrayB, float *result, size_t length )
+{
+	for( size_t i = 0; i < length; i++ )
+		result[i] = arrayA[i] * arrayB[i];
+}
+
+void addMulScalar( const float *arrayA, const float *arrayB, float scalar, float *result, size_t length )
+{
+	for( size_t i = 0; i < length; i++ )
+		result[i] = ( arrayA[i] + arrayB[i] ) * scalar;
+}
+
+float sumScalar( const float *array, size_t length )
+{
+	float result = 0;
+	for( size_t i = 0; i < length; i++ )
+		result += array[i];
+	return result;
+}
+
+float sumSquaresScalar( const float *array, size_t length )
+{
+	float result = 0;
+	for( size_t i = 0; i < length; i++ )
+		result += array[i] * array[i];
+	return result;
+}
+
+float maxScalar( const float *array, size_t length )
+{
+	float result = array[0];
+	for( size_t i = 1; i < length; i++ )
+		result = std::max( result, array[i] );
+	return result;
+}
+
+void floatToInt16Scalar( const float *sourceArray, int16_t *destArray, size_t length )
+{
+	for( size_t i = 0; i < length; i++ )
+		destArray[i] = floatToInt16Sample( sourceArray[i] );
+}
+
+void int16ToFloatScalar( const int16_t *sourceArray, float *destArray, size_t length )
+{
+	for( size_t i = 0; i < length; i++ )
+		destArray[i] = (float)sourceArray[i] * INT16_INV_NORMALIZER;
+}
+
+// Interleaving helpers that process channels [channelBegin, channelEnd) and frames [frameBegin, numCopyFrames), used for the
+// channels and frames that are left over after vectorized processing.
+
+void interleaveRemainder( const float *source, float *dest, size_t numFramesPerChannel, size_t numChannels, size_t numCopyFrames, size_t channelBegin, size_t channelEnd, size_t frameBegin )
+{
+	for( size_t ch = channelBegin; ch < channelEnd; ch++ ) {
+		const float *sourceChannel = &source[ch * numFramesPerChannel];
+		for( size_t i = frameBegin; i < numCopyFrames; i++ )
+			dest[i * numChannels + ch] = sourceChannel[i];
+	}
+}
+
+void deinterleaveRemainder( const float *source, float *dest, size_t numFramesPerChannel, size_t numChannels, size_t numCopyFrames, size_t channelBegin, size_t channelEnd, size_t frameBegin )
+{
+	for( size_t ch = channelBegin; ch < channelEnd; ch++ ) {
+		float *destChannel = &dest[ch * numFramesPerChannel];
+		for( size_t i = frameBegin; i < numCopyFrames; i++ )
+			destChannel[i] = source[i * numChannels + ch];
+	}
+}
+
+void interleaveInt16Remainder( const float *source, int16_t *dest, size_t numFramesPerChannel, size_t numChannels, size_t numCopyFrames, size_t channelBegin, size_t channelEnd, size_t frameBegin )
+{
+	for( size_t ch = channelBegin; ch < channelEnd; ch++ ) {
+		const float *sourceChannel = &source[ch * numFramesPerChannel];
+		for( size_t i = frameBegin; i < numCopyFrames; i++ )
+			dest[i * numChannels + ch] = floatToInt16Sample( sourceChannel[i] );
+	}
+}
+
+void deinterleaveInt16Remainder( const int16_t *source, float *dest, size_t numFramesPerChannel, size_t numChannels, size_t numCopyFrames, size_t channelBegin, size_t channelEnd, size_t frameBegin )
+{
+	for( size_t ch = channelBegin; ch < channelEnd; ch++ ) {
+		float *destChannel = &dest[ch * numFramesPerChannel];
+		for( size_t i = frameBegin; i < numCopyFrames; i++ )
+			destChannel[i] = (float)source[i * numChannels + ch] * INT16_INV_NORMALIZER;
+	}
+}
+
+void interleaveScalar( const float *source, float *dest, size_t numFramesPerChannel, size_t numChannels, size_t numCopyFrames )
+{
+	interleaveRemainder( source, dest, numFramesPerChannel, numChannels, numCopyFrames, 0, numChannels, 0 );
+}
+
+void deinterleaveScalar( const float *source, float *dest, size_t numFramesPerChannel, size_t numChannels, size_t numCopyFrames )
+{
+	deinterleaveRemainder( source, dest, numFramesPerChannel, numChannels, numCopyFrames, 0, numChannels, 0 );
+}
+
+void interleaveInt16Scalar( const float *source, int16_t *dest, size_t numFramesPerChannel, size_t numChannels, size_t numCopyFrames )
+{
+	interleaveInt16Remainder( source, dest, numFramesPerChannel, numChannels, numCopyFrames, 0, numChannels, 0 );
+}
+
+void deinterleaveInt16Scalar( const int16_t *source, float *dest, size_t numFramesPerChannel, size_t numChannels, size_t numCopyFrames )
+{
+	deinterleaveInt16Remainder( source, dest, numFramesPerChannel, numChannels, numCopyFrames, 0, numChannels, 0 );
+}
+
+const Kernels sKernelsScalar = {
+	fillScalar, addScalarScalar, addScalar, subScalar, mulScalarScalar, mulScalar, addMulScalar, sumScalar, sumSquaresScalar, maxScalar,
+	floatToInt16Scalar, int16ToFloatScalar, interleaveScalar, deinterleaveScalar, interleaveInt16Scalar, deinterleaveInt16Scalar
+};
+
+#if defined( CINDER_AUDIO_SSE2 )
+
+// ----------------------------------------------------------------------------------------------------
+// SSE2
+// ----------------------------------------------------------------------------------------------------
+
+inline float horizontalSum( __m128 v )
+{
+	__m128 shuf = _mm_shuffle_ps( v, v, _MM_SHUFFLE( 2, 3, 0, 1 ) );
+	__m128 sums = _mm_add_ps( v, shuf );
+	shuf = _mm_movehl_ps( shuf, sums );
+	sums = _mm_add_ss( sums, shuf );
+	return _mm_cvtss_f32( sums );
+}
+
+inline float horizontalMax( __m128 v )
+{
+	__m128 shuf = _mm_shuffle_ps( v, v, _MM_SHUFFLE( 2, 3, 0, 1 ) );
+	__m128 maxs = _mm_max_ps( v, shuf );
+	shuf = _mm_movehl_ps( shuf, maxs );
+	maxs = _mm_max_ss( maxs, shuf );
+	return _mm_cvtss_f32( maxs );
+}
+
+// scales by 32768, clamps and truncates 4 floats to int32
+inline __m128i floatToInt16Range( __m128 v )
+{
+	v = _mm_mul_ps( v, _mm_set1_ps( INT16_NORMALIZER ) );
+	v = _mm_min_ps( _mm_max_ps( v, _mm_set1_ps( -32768.0f ) ), _mm_set1_ps( 32767.0f ) );
+	return _mm_cvttps_epi32( v );
+}
+
+// sign extends the 4 int16 in the low half of v and scales to float
+inline __m128 int16ToFloatLow( __m128i v )
+{
+	__m128i ints = _mm_srai_epi32( _mm_unpacklo_epi16( v, v ), 16 );
+	return _mm_mul_ps( _mm_cvtepi32_ps( ints ), _mm_set1_ps( INT16_INV_NORMALIZER ) );
+}
+
+inline __m128 int16ToFloatHigh( __m128i v )
+{
+	__m128i ints = _mm_srai_epi32( _mm_unpackhi_epi16( v, v ), 16 );
+	return _mm_mul_ps( _mm_cvtepi32_ps( ints ), _mm_set1_ps( INT16_INV_NORMALIZER ) );
+}
+
+void fillSse2( float value, float *array, size_t length )
+{
+	const __m128 v = _mm_set1_ps( value );
+	size_t i = 0;
+	for( ; i + 4 <= length; i += 4 )
+		_mm_storeu_ps( array + i, v );
+	for( ; i < length; i++ )
+		array[i] = value;
+}
+
+void addScalarSse2( const float *array, float scalar, float *result, size_t length )
+{
+	const __m128 s = _mm_set1_ps( scalar );
+	size_t i = 0;
+	for( ; i + 4 <= length; i += 4 )
+		_mm_storeu_ps( result + i, _mm_add_ps( _mm_loadu_ps( array + i ), s ) );
+	for( ; i < length; i++ )
+		result[i] = array[i] + scalar;
+}
+
+void addSse2( const float *arrayA, const float *arrayB, float *result, size_t length )
+{
+	size_t i = 0;
+	for( ; i + 4 <= length; i += 4 )
+		_mm_storeu_ps( result + i, _mm_add_ps( _mm_loadu_ps( arrayA + i ), _mm_loadu_ps( arrayB + i ) ) );
+	for( ; i < length; i++ )
+		result[i] = arrayA[i] + arrayB[i];
+}
+
+void subSse2( const float *arrayA, const float *arrayB, float *result, size_t length )
+{
+	size_t i = 0;
+	for( ; i + 4 <= length; i += 4 )
+		_mm_storeu_ps( result + i, _mm_sub_ps( _mm_loadu_ps( arrayA + i ), _mm_loadu_ps( arrayB + i ) ) );
+	for( ; i < length; i++ )
+		result[i] = arrayA[i] - arrayB[i];
+}
+
+void mulScalarSse2( const float *array, float scalar, float *result, size_t length )
+{
+	const __m128 s = _mm_set1_ps( scalar );
+	size_t i = 0;
+	for( ; i + 4 <= length; i += 4 )
+		_mm_storeu_ps( result + i, _mm_mul_ps( _mm_loadu_ps( array + i ), s ) );
+	for( ; i < length; i++ )
+		result[i] = array[i] * scalar;
+}
+
+void mulSse2( const float *arrayA, const float *arrayB, float *result, size_t length )
+{
+	size_t i = 0;
+	for( ; i + 4 <= length; i += 4 )
+		_mm_storeu_ps( result + i, _mm_mul_ps( _mm_loadu_ps( arrayA + i ), _mm_loadu_ps( arrayB + i ) ) );
+	for( ; i < length; i++ )
+		result[i] = arrayA[i] * arrayB[i];
+}
+
+void addMulSse2( const float *arrayA, const float *arrayB, float scalar, float *result, size_t length )
+{
+	const __m128 s = _mm_set1_ps( scalar );
+	size_t i = 0;
+	for( ; i + 4 <= length; i += 4 )
+		_mm_storeu_ps( result + i, _mm_mul_ps( _mm_add_ps( _mm_loadu_ps( arrayA + i ), _mm_loadu_ps( arrayB + i ) ), s ) );
+	for( ; i < length; i++ )
+		result[i] = ( arrayA[i] + arrayB[i] ) * scalar;
+}
+
+float sumSse2( const float *array, size_t length )
+{
+	__m128 acc0 = _mm_setzero_ps();
+	__m128 acc1 = _mm_setzero_ps();
+	size_t i = 0;
+	for( ; i + 8 <= length; i += 8 ) {
+		acc0 = _mm_add_ps( acc0, _mm_loadu_ps( array + i ) );
+		acc1 = _mm_add_ps( acc1, _mm_loadu_ps( array + i + 4 ) );
+	}
+
+	float result = horizontalSum( _mm_add_ps( acc0, acc1 ) );
+	for( ; i < length; i++ )
+		result += array[i];
+	return result;
+}
+
+float sumSquaresSse2( const float *array, size_t length )
+{
+	__m128 acc0 = _mm_setzero_ps();
+	__m128 acc1 = _mm_setzero_ps();
+	size_t i = 0;
+	for( ; i + 8 <= length; i += 8 ) {
+		__m128 a = _mm_loadu_ps( array + i );
+		__m128 b = _mm_loadu_ps( array + i + 4 );
+		acc0 = _mm_add_ps( acc0, _mm_mul_ps( a, a ) );
+		acc1 = _mm_add_ps( acc1, _mm_mul_ps( b, b ) );
+	}
+
+	float result = horizontalSum( _mm_add_ps( acc0, acc1 ) );
+	for( ; i < length; i++ )
+		result += array[i] * array[i];
+	return result;
+}
+
+float maxSse2( const float *array, size_t length )
+{
+	if( length < 4 )
+		return maxScalar( array, length );
+
+	__m128 acc = _mm_loadu_ps( array );
+	size_t i = 4;
+	for( ; i + 4 <= length; i += 4 )
+		acc = _mm_max_ps( acc, _mm_loadu_ps( array + i ) );
+
+	float result = horizontalMax( acc );
+	for( ; i < length; i++ )
+		result = std::max( result, array[i] );
+	return result;
+}
+
+void floatToInt16Sse2( const float *sourceArray, int16_t *destArray, size_t length )
+{
+	size_t i = 0;
+	for( ; i + 8 <= length; i += 8 ) {
+		__m128i a = floatToInt16Range( _mm_loadu_ps( sourceArray + i ) );
+		__m128i b = floatToInt16Range( _mm_loadu_ps( sourceArray + i + 4 ) );
+		_mm_storeu_si128( (__m128i *)( destArray + i ), _mm_packs_epi32( a, b ) );
+	}
+	for( ; i < length; i++ )
+		destArray[i] = floatToInt16Sample( sourceArray[i] );
+}
+
+void int16ToFloatSse2( const int16_t *sourceArray, float *destArray, size_t length )
+{
+	size_t i = 0;
+	for( ; i + 8 <= length; i += 8 ) {
+		__m128i v = _mm_loadu_si128( (const __m128i *)( sourceArray + i ) );
+		_mm_storeu_ps( destArray + i, int16ToFloatLow( v ) );
+		_mm_storeu_ps( destArray + i + 4, int16ToFloatHigh( v ) );
+	}
+	for( ; i < length; i++ )
+		destArray[i] = (float)sourceArray[i] * INT16_INV_NORMALIZER;
+}
+
+// Multichannel (de)interleaving is done in 4 channel x 4 frame tiles with a 4x4 transpose, which works for any channel count.
+
+void interleaveSse2( const float *source, float *dest, size_t numFramesPerChannel, size_t numChannels, size_t numCopyFrames )
+{
+	if( numChannels == 1 ) {
+		memcpy( dest, source, numCopyFrames * sizeof( float ) );
+		return;
+	}
+
+	const size_t numVectorFrames = numCopyFrames & ~size_t( 3 );
+
+	if( numChannels == 2 ) {
+		const float *left = source;
+		const float *right = source + numFramesPerChannel;
+		for( size_t i = 0; i < numVectorFrames; i += 4 ) {
+			__m128 l = _mm_loadu_ps( left + i );
+			__m128 r = _mm_loadu_ps( right + i );
+			_mm_storeu_ps( dest + 2 * i, _mm_unpacklo_ps( l, r ) );
+			_mm_storeu_ps( dest + 2 * i + 4, _mm_unpackhi_ps( l, r ) );
+		}
+
+		interleaveRemainder( source, dest, numFramesPerChannel, 2, numCopyFrames, 0, 2, numVectorFrames );
+		return;
+	}
+
+	const size_t numVectorChannels = numChannels & ~size_t( 3 );
+	for( size_t ch = 0; ch < numVectorChannels; ch += 4 ) {
+		const float *s0 = source + ch * numFramesPerChannel;
+		const float *s1 = s0 + numFramesPerChannel;
+		const float *s2 = s1 + numFramesPerChannel;
+		const float *s3 = s2 + numFramesPerChannel;
+		for( size_t i = 0; i < numVectorFrames; i += 4 ) {
+			__m128 r0 = _mm_loadu_ps( s0 + i );
+			__m128 r1 = _mm_loadu_ps( s1 + i );
+			__m128 r2 = _mm_loadu_ps( s2 + i );
+			__m128 r3 = _mm_loadu_ps( s3 + i );
+			_MM_TRANSPOSE4_PS( r0, r1, r2, r3 );
+
+			float *d = dest + i * numChannels + ch;
+			_mm_storeu_ps( d, r0 );
+			_mm_storeu_ps( d + numChannels, r1 );
+			_mm_storeu_ps( d + 2 * numChannels, r2 );
+			_mm_storeu_ps( d + 3 * numChannels, r3 );
+		}
+
+		interleaveRemainder( source, dest, numFramesPerChannel, numChannels, numCopyFrames, ch, ch + 4, numVectorFrames );
+	}
+
+	interleaveRemainder( source, dest, numFramesPerChannel, numChannels, numCopyFrames, numVectorChannels, numChannels, 0 );
+}
+
+void deinterleaveSse2( const float *source, float *dest, size_t numFramesPerChannel, size_t numChannels, size_t numCopyFrames )
+{
+	if( numChannels == 1 ) {
+		memcpy( dest, source, numCopyFrames * sizeof( float ) );
+		return;
+	}
+
+	const size_t numVectorFrames = numCopyFrames & ~size_t( 3 );
+
+	if( numChannels == 2 ) {
+		float *left = dest;
+		float *right = dest + numFramesPerChannel;
+		for( size_t i = 0; i < numVectorFrames; i += 4 ) {
+			__m128 a = _mm_loadu_ps( source + 2 * i );
+			__m128 b = _mm_loadu_ps( source + 2 * i + 4 );
+			_mm_storeu_ps( left + i, _mm_shuffle_ps( a, b, _MM_SHUFFLE( 2, 0, 2, 0 ) ) );
+			_mm_storeu_ps( right + i, _mm_shuffle_ps( a, b, _MM_SHUFFLE( 3, 1, 3, 1 ) ) );
+		}
+
+		deinterleaveRemainder( source, dest, numFramesPerChannel, 2, numCopyFrames, 0, 2, numVectorFrames );
+		return;
+	}
+
+	const size_t numVectorChannels = numChannels & ~size_t( 3 );
+	for( size_t ch = 0; ch < numVectorChannels; ch += 4 ) {
+		float *d0 = dest + ch * numFramesPerChannel;
+		float *d1 = d0 + numFramesPerChannel;
+		float *d2 = d1 + numFramesPerChannel;
+		float *d3 = d2 + numFramesPerChannel;
+		for( size_t i = 0; i < numVectorFrames; i += 4 ) {
+			const float *s = source + i * numChannels + ch;
+			__m128 r0 = _mm_loadu_ps( s );
+			__m128 r1 = _mm_loadu_ps( s + numChannels );
+			__m128 r2 = _mm_loadu_ps( s + 2 * numChannels );
+			__m128 r3 = _mm_loadu_ps( s + 3 * numChannels );
+			_MM_TRANSPOSE4_PS( r0, r1, r2, r3 );
+
+			_mm_storeu_ps( d0 + i, r0 );
+			_mm_storeu_ps( d1 + i, r1 );
+			_mm_storeu_ps( d2 + i, r2 );
+			_mm_storeu_ps( d3 + i, r3 );
+		}
+
+		deinterleaveRemainder( source, dest, numFramesPerChannel, numChannels, numCopyFrames, ch, ch + 4, numVectorFrames );
+	}
+
+	deinterleaveRemainder( source, dest, numFramesPerChannel, numChannels, numCopyFrames, numVectorChannels, numChannels, 0 );
+}
+
+void interleaveInt16Sse2( const float *source, int16_t *dest, size_t numFramesPerChannel, size_t numChannels, size_t numCopyFrames )
+{
+	if( numChannels == 1 ) {
+		floatToInt16Sse2( source, dest, numCopyFrames );
+		return;
+	}
+
+	const size_t numVectorFrames = numCopyFrames & ~size_t( 3 );
+	const size_t numVectorChannels = numChannels & ~size_t( 3 );
+
+	if( numChannels == 2 ) {
+		const float *left = source;
+		const float *right = source + numFramesPerChannel;
+		for( size_t i = 0; i < numVectorFrames; i += 4 ) {
+			__m128 l = _mm_loadu_ps( left + i );
+			__m128 r = _mm_loadu_ps( right + i );
+			__m128i a = floatToInt16Range( _mm_unpacklo_ps( l, r ) );
+			__m128i b = floatToInt16Range( _mm_unpackhi_ps( l, r ) );
+			_mm_storeu_si128( (__m128i *)( dest + 2 * i ), _mm_packs_epi32( a, b ) );
+		}
+
+		interleaveInt16Remainder( source, dest, numFramesPerChannel, 2, numCopyFrames, 0, 2, numVectorFrames );
+		return;
+	}
+
+	for( size_t ch = 0; ch < numVectorChannels; ch += 4 ) {
+		const float *s0 = source + ch * numFramesPerChannel;
+		const float *s1 = s0 + numFramesPerChannel;
+		const float *s2 = s1 + numFramesPerChannel;
+		const float *s3 = s2 + numFramesPerChannel;
+		for( size_t i = 0; i < numVectorFrames; i += 4 ) {
+			__m128 r0 = _mm_loadu_ps( s0 + i );
+			__m128 r1 = _mm_loadu_ps( s1 + i );
+			__m128 r2 = _mm_loadu_ps( s2 + i );
+			__m128 r3 = _mm_loadu_ps( s3 + i );
+			_MM_TRANSPOSE4_PS( r0, r1, r2, r3 );
+
+			__m128i p01 = _mm_packs_epi32( floatToInt16Range( r0 ), floatToInt16Range( r1 ) );
+			__m128i p23 = _mm_packs_epi32( floatToInt16Range( r2 ), floatToInt16Range( r3 ) );
+
+			int16_t *d = dest + i * numChannels + ch;
+			_mm_storel_epi64( (__m128i *)d, p01 );
+			_mm_storel_epi64( (__m128i *)( d + numChannels ), _mm_srli_si128( p01, 8 ) );
+			_mm_storel_epi64( (__m128i *)( d + 2 * numChannels ), p23 );
+			_mm_storel_epi64( (__m128i *)( d + 3 * numChannels ), _mm_srli_si128( p23, 8 ) );
+		}
+
+		interleaveInt16Remainder( source, dest, numFramesPerChannel, numChannels, numCopyFrames, ch, ch + 4, numVectorFrames );
+	}
+
+	interleaveInt16Remainder( source, dest, numFramesPerChannel, numChannels, numCopyFrames, numVectorChannels, numChannels, 0 );
+}
+
+void deinterleaveInt16Sse2( const int16_t *source, float *dest, size_t numFramesPerChannel, size_t numChannels, size_t numCopyFrames )
+{
+	if( numChannels == 1 ) {
+		int16ToFloatSse2( source, dest, numCopyFrames );
+		return;
+	}
+
+	const size_t numVectorFrames = numCopyFrames & ~size_t( 3 );
+	const size_t numVectorChannels = numChannels & ~size_t( 3 );
+
+	if( numChannels == 2 ) {
+		float *left = dest;
+		float *right = dest + numFramesPerChannel;
+		for( size_t i = 0; i < numVectorFrames; i += 4 ) {
+			__m128i v = _mm_loadu_si128( (const __m128i *)( source + 2 * i ) );
+			__m128 a = int16ToFloatLow( v );
+			__m128 b = int16ToFloatHigh( v );
+			_mm_storeu_ps( left + i, _mm_shuffle_ps( a, b, _MM_SHUFFLE( 2, 0, 2, 0 ) ) );
+			_mm_storeu_ps( right + i, _mm_shuffle_ps( a, b, _MM_SHUFFLE( 3, 1, 3, 1 ) ) );
+		}
+
+		deinterleaveInt16Remainder( source, dest, numFramesPerChannel, 2, numCopyFrames, 0, 2, numVectorFrames );
+		return;
+	}
+
+	for( size_t ch = 0; ch < numVectorChannels; ch += 4 ) {
+		float *d0 = dest + ch * numFramesPerChannel;
+		float *d1 = d0 + numFramesPerChannel;
+		float *d2 = d1 + numFramesPerChannel;
+		float *d3 = d2 + numFramesPerChannel;
+		for( size_t i = 0; i < numVectorFrames; i += 4 ) {
+			const int16_t *s = source + i * numChannels + ch;
+			__m128 r0 = int16ToFloatLow( _mm_loadl_epi64( (const __m128i *)s ) );
+			__m128 r1 = int16ToFloatLow( _mm_loadl_epi64( (const __m128i *)( s + numChannels ) ) );
+			__m128 r2 = int16ToFloatLow( _mm_loadl_epi64( (const __m128i *)( s + 2 * numChannels ) ) );
+			__m128 r3 = int16ToFloatLow( _mm_loadl_epi64( (const __m128i *)( s + 3 * numChannels ) ) );
+			_MM_TRANSPOSE4_PS( r0, r1, r2, r3 );
+
+			_mm_storeu_ps( d0 + i, r0 );
+			_mm_storeu_ps( d1 + i, r1 );
+			_mm_storeu_ps( d2 + i, r2 );
+			_mm_storeu_ps( d3 + i, r3 );
+		}
+
+		deinterleaveInt16Remainder( source, dest, numFramesPerChannel, numChannels, numCopyFrames, ch, ch + 4, numVectorFrames );
+	}
+
+	deinterleaveInt16Remainder( source, dest, numFramesPerChannel, numChannels, numCopyFrames, numVectorChannels, numChannels, 0 );
+}
+
+const Kernels sKernelsSse2 = {
+	fillSse2, addScalarSse2, addSse2, subSse2, mulScalarSse2, mulSse2, addMulSse2, sumSse2, sumSquaresSse2, maxSse2,
+	floatToInt16Sse2, int16ToFloatSse2, interleaveSse2, deinterleaveSse2, interleaveInt16Sse2, deinterleaveInt16Sse2
+};
+
+#endif // defined( CINDER_AUDIO_SSE2 )
+
+#if defined( CINDER_AUDIO_AVX2 )
+
+// ----------------------------------------------------------------------------------------------------
+// AVX2
+// ----------------------------------------------------------------------------------------------------
+// Only the contiguous kernels benefit from 8-wide vectors, (de)interleaving reuses the SSE2 tiles.
+
+CI_TARGET_AVX2 void fillAvx2( float value, float *array, size_t length )
+{
+	const __m256 v = _mm256_set1_ps( value );
+	size_t i = 0;
+	for( ; i + 8 <= length; i += 8 )
+		_mm256_storeu_ps( array + i, v );
+	for( ; i < length; i++ )
+		array[i] = value;
+}
+
+CI_TARGET_AVX2 void addScalarAvx2( const float *array, float scalar, float *result, size_t length )
+{
+	const __m256 s = _mm256_set1_ps( scalar );
+	size_t i = 0;
+	for( ; i + 8 <= length; i += 8 )
+		_mm256_storeu_ps( result + i, _mm256_add_ps( _mm256_loadu_ps( array + i ), s ) );
+	for( ; i < length; i++ )
+		result[i] = array[i] + scalar;
+}
+
+CI_TARGET_AVX2 void addAvx2( const float *arrayA, const float *arrayB, float *result, size_t length )
+{
+	size_t i = 0;
+	for( ; i + 8 <= length; i += 8 )
+		_mm256_storeu_ps( result + i, _mm256_add_ps( _mm256_loadu_ps( arrayA + i ), _mm256_loadu_ps( arrayB + i ) ) );
+	for( ; i < length; i++ )
+		result[i] = arrayA[i] + arrayB[i];
+}
+
+CI_TARGET_AVX2 void subAvx2( const float *arrayA, const float *arrayB, float *result, size_t length )
+{
+	size_t i = 0;
+	for( ; i + 8 <= length; i += 8 )
+		_mm256_storeu_ps( result + i, _mm256_sub_ps( _mm256_loadu_ps( arrayA + i ), _mm256_loadu_ps( arrayB + i ) ) );
+	for( ; i < length; i++ )
+		result[i] = arrayA[i] - arrayB[i];
+}
+
+CI_TARGET_AVX2 void mulScalarAvx2( const float *array, float scalar, float *result, size_t length )
+{
+	const __m256 s = _mm256_set1_ps( scalar );
+	size_t i = 0;
+	for( ; i + 8 <= length; i += 8 )
+		_mm256_storeu_ps( result + i, _mm256_mul_ps( _mm256_loadu_ps( array + i ), s ) );
+	for( ; i < length; i++ )
+		result[i] = array[i] * scalar;
+}
+
+CI_TARGET_AVX2 void mulAvx2( const float *arrayA, const float *arrayB, float *result, size_t length )
+{
+	size_t i = 0;
+	for( ; i + 8 <= length; i += 8 )
+		_mm256_storeu_ps( result + i, _mm256_mul_ps( _mm256_loadu_ps( arrayA + i ), _mm256_loadu_ps( arrayB + i ) ) );
+	for( ; i < length; i++ )
+		result[i] = arrayA[i] * arrayB[i];
+}
+
+CI_TARGET_AVX2 void addMulAvx2( const float *arrayA, const float *arrayB, float scalar, float *result, size_t length )
+{
+	const __m256 s = _mm256_set1_ps( scalar );
+	size_t i = 0;
+	for( ; i + 8 <= length; i += 8 )
+		_mm256_storeu_ps( result + i, _mm256_mul_ps( _mm256_add_ps( _mm256_loadu_ps( arrayA + i ), _mm256_loadu_ps( arrayB + i ) ), s ) );
+	for( ; i < length; i++ )
+		result[i] = ( arrayA[i] + arrayB[i] ) * scalar;
+}
+
+CI_TARGET_AVX2 float reduceAdd( __m256 v )
+{
+	__m128 sum = _mm_add_ps( _mm256_castps256_ps128( v ), _mm256_extractf128_ps( v, 1 ) );
+	__m128 shuf = _mm_shuffle_ps( sum, sum, _MM_SHUFFLE( 2, 3, 0, 1 ) );
+	sum = _mm_add_ps( sum, shuf );
+	shuf = _mm_movehl_ps( shuf, sum );
+	sum = _mm_add_ss( sum, shuf );
+	return _mm_cvtss_f32( sum );
+}
+
+CI_TARGET_AVX2 float sumAvx2( const float *array, size_t length )
+{
+	__m256 acc0 = _mm256_setzero_ps();
+	__m256 acc1 = _mm256_setzero_ps();
+	size_t i = 0;
+	for( ; i + 16 <= length; i += 16 ) {
+		acc0 = _mm256_add_ps( acc0, _mm256_loadu_ps( array + i ) );
+		acc1 = _mm256_add_ps( acc1, _mm256_loadu_ps( array + i + 8 ) );
+	}
+
+	float result = reduceAdd( _mm256_add_ps( acc0, acc1 ) );
+	for( ; i < length; i++ )
+		result += array[i];
+	return result;
+}
+
+CI_TARGET_AVX2 float sumSquaresAvx2( const float *array, size_t length )
+{
+	__m256 acc0 = _mm256_setzero_ps();
+	__m256 acc1 = _mm256_setzero_ps();
+	size_t i = 0;
+	for( ; i + 16 <= length; i += 16 ) {
+		__m256 a = _mm256_loadu_ps( array + i );
+		__m256 b = _mm256_loadu_ps( array + i + 8 );
+		acc0 = _mm256_add_ps( acc0, _mm256_mul_ps( a, a ) );
+		acc1 = _mm256_add_ps( acc1, _mm256_mul_ps( b, b ) );
+	}
+
+	float result = reduceAdd( _mm256_add_ps( acc0, acc1 ) );
+	for( ; i < length; i++ )
+		result += array[i] * array[i];
+	return result;
+}
+
+CI_TARGET_AVX2 float maxAvx2( const float *array, size_t length )
+{
+	if( length < 8 )
+		return maxScalar( array, length );
+
+	__m256 acc = _mm256_loadu_ps( array );
+	size_t i = 8;
+	for( ; i + 8 <= length; i += 8 )
+		acc = _mm256_max_ps( acc, _mm256_loadu_ps( array + i ) );
+
+	__m128 m = _mm_max_ps( _mm256_castps256_ps128( acc ), _mm256_extractf128_ps( acc, 1 ) );
+	float result = horizontalMax( m );
+	for( ; i < length; i++ )
+		result = std::max( result, array[i] );
+	return result;
+}
+
+CI_TARGET_AVX2 void floatToInt16Avx2( const float *sourceArray, int16_t *destArray, size_t length )
+{
+	const __m256 normalizer = _mm256_set1_ps( INT16_NORMALIZER );
+	const __m256 minValue = _mm256_set1_ps( -32768.0f );
+	const __m256 maxValue = _mm256_set1_ps( 32767.0f );
+
+	size_t i = 0;
+	for( ; i + 16 <= length; i += 16 ) {
+		__m256 a = _mm256_mul_ps( _mm256_loadu_ps( sourceArray + i ), normalizer );
+		__m256 b = _mm256_mul_ps( _mm256_loadu_ps( sourceArray + i + 8 ), normalizer );
+		a = _mm256_min_ps( _mm256_max_ps( a, minValue ), maxValue );
+		b = _mm256_min_ps( _mm256_max_ps( b, minValue ), maxValue );
+
+		// packs works within 128-bit lanes, so restore the order of the 64-bit quarters afterwards
+		__m256i packed = _mm256_packs_epi32( _mm256_cvttps_epi32( a ), _mm256_cvttps_epi32( b ) );
+		packed = _mm256_permute4x64_epi64( packed, _MM_SHUFFLE( 3, 1, 2, 0 ) );
+		_mm256_storeu_si256( (__m256i *)( destArray + i ), packed );
+	}
+	for( ; i < length; i++ )
+		destArray[i] = floatToInt16Sample( sourceArray[i] );
+}
+
+CI_TARGET_AVX2 void int16ToFloatAvx2( const int16_t *sourceArray, float *destArray, size_t length )
+{
+	const __m256 normalizer = _mm256_set1_ps( INT16_INV_NORMALIZER );
+
+	size_t i = 0;
+	for( ; i + 8 <= length; i += 8 ) {
+		__m256i ints = _mm256_cvtepi16_epi32( _mm_loadu_si128( (const __m128i *)( sourceArray + i ) ) );
+		_mm256_storeu_ps( destArray + i, _mm256_mul_ps( _mm256_cvtepi32_ps( ints ), normalizer ) );
+	}
+	for( ; i < length; i++ )
+		destArray[i] = (float)sourceArray[i] * INT16_INV_NORMALIZER;
+}
+
+CI_TARGET_AVX2 void interleaveInt16Avx2( const float *source, int16_t *dest, size_t numFramesPerChannel, size_t numChannels, size_t numCopyFrames )
+{
+	if( numChannels == 1 )
+		floatToInt16Avx2( source, dest, numCopyFrames );
+	else
+		interleaveInt16Sse2( source, dest, numFramesPerChannel, numChannels, numCopyFrames );
+}
+
+CI_TARGET_AVX2 void deinterleaveInt16Avx2( const int16_t *source, float *dest, size_t numFramesPerChannel, size_t numChannels, size_t numCopyFrames )
+{
+	if( numChannels == 1 )
+		int16ToFloatAvx2( source, dest, numCopyFrames );
+	else
+		deinterleaveInt16Sse2( source, dest, numFramesPerChannel, numChannels, numCopyFrames );
+}
+
+const Kernels sKernelsAvx2 = {
+	fillAvx2, addScalarAvx2, addAvx2, subAvx2, mulScalarAvx2, mulAvx2, addMulAvx2, sumAvx2, sumSquaresAvx2, maxAvx2,
+	floatToInt16Avx2, int16ToFloatAvx2, interleaveSse2, deinterleaveSse2, interleaveInt16Avx2, deinterleaveInt16Avx2
+};
+
+bool isAvx2Supported()
+{
+#if defined( _MSC_VER ) && ! defined( __clang__ )
+	int info[4];
+	__cpuid( info, 0 );
+	if( info[0] < 7 )
+		return false;
+
+	// AVX2 also requires the OS to save the ymm registers (OSXSAVE + XCR0 bits 1 and 2)
+	__cpuid( info, 1 );
+	const bool osxsave = ( info[2] & ( 1 << 27 ) ) != 0;
+	const bool avx = ( info[2] & ( 1 << 28 ) ) != 0;
+	if( ! osxsave || ! avx || ( _xgetbv( 0 ) & 0x6 ) != 0x6 )
+		return false;
+
+	__cpuidex( info, 7, 0 );
+	return ( info[1] & ( 1 << 5 ) ) != 0;
+#else
+	__builtin_cpu_init();
+	return __builtin_cpu_supports( "avx2" ) != 0;
+#endif
+}
+
+#endif // defined( CINDER_AUDIO_AVX2 )
+
+#if defined( CINDER_AUDIO_NEON )
+
+// ----------------------------------------------------------------------------------------------------
+// NEON
+// ----------------------------------------------------------------------------------------------------
+
+inline float horizontalSum( float32x4_t v )
+{
+	float32x2_t sum = vadd_f32( vget_low_f32( v ), vget_high_f32( v ) );
+	return vget_lane_f32( vpadd_f32( sum, sum ), 0 );
+}
+
+inline float horizontalMax( float32x4_t v )
+{
+	float32x2_t m = vmax_f32( vget_low_f32( v ), vget_high_f32( v ) );
+	return vget_lane_f32( vpmax_f32( m, m ), 0 );
+}
+
+inline int32x4_t floatToInt16Range( float32x4_t v )
+{
+	v = vmulq_n_f32( v, INT16_NORMALIZER );
+	v = vminq_f32( vmaxq_f32( v, vdupq_n_f32( -32768.0f ) ), vdupq_n_f32( 32767.0f ) );
+	return vcvtq_s32_f32( v );
+}
+
+void fillNeon( float value, float *array, size_t length )
+{
+	const float32x4_t v = vdupq_n_f32( value );
+	size_t i = 0;
+	for( ; i + 4 <= length; i += 4 )
+		vst1q_f32( array + i, v );
+	for( ; i < length; i++ )
+		array[i] = value;
+}
+
+void addScalarNeon( const float *array, float scalar, float *result, size_t length )
+{
+	const float32x4_t s = vdupq_n_f32( scalar );
+	size_t i = 0;
+	for( ; i + 4 <= length; i += 4 )
+		vst1q_f32( result + i, vaddq_f32( vld1q_f32( array + i ), s ) );
+	for( ; i < length; i++ )
+		result[i] = array[i] + scalar;
+}
+
+void addNeon( const float *arrayA, const float *arrayB, float *result, size_t length )
+{
+	size_t i = 0;
+	for( ; i + 4 <= length; i += 4 )
+		vst1q_f32( result + i, vaddq_f32( vld1q_f32( arrayA + i ), vld1q_f32( arrayB + i ) ) );
+	for( ; i < length; i++ )
+		result[i] = arrayA[i] + arrayB[i];
+}
+
+void subNeon( const float *arrayA, const float *arrayB, float *result, size_t length )
+{
+	size_t i = 0;
+	for( ; i + 4 <= length; i += 4 )
+		vst1q_f32( result + i, vsubq_f32( vld1q_f32( arrayA + i ), vld1q_f32( arrayB + i ) ) );
+	for( ; i < length; i++ )
+		result[i] = arrayA[i] - arrayB[i];
+}
+
+void mulScalarNeon( const float *array, float scalar, float *result, size_t length )
+{
+	size_t i = 0;
+	for( ; i + 4 <= length; i += 4 )
+		vst1q_f32( result + i, vmulq_n_f32( vld1q_f32( array + i ), scalar ) );
+	for( ; i < length; i++ )
+		result[i] = array[i] * scalar;
+}
+
+void mulNeon( const float *arrayA, const float *arrayB, float *result, size_t length )
+{
+	size_t i = 0;
+	for( ; i + 4 <= length; i += 4 )
+		vst1q_f32( result + i, vmulq_f32( vld1q_f32( arrayA + i ), vld1q_f32( arrayB + i ) ) );
+	for( ; i < length; i++ )
+		result[i] = arrayA[i] * arrayB[i];
+}
+
+void addMulNeon( const float *arrayA, const float *arrayB, float scalar, float *result, size_t length )
+{
+	size_t i = 0;
+	for( ; i + 4 <= length; i += 4 )
+		vst1q_f32( result + i, vmulq_n_f32( vaddq_f32( vld1q_f32( arrayA + i ), vld1q_f32( arrayB + i ) ), scalar ) );
+	for( ; i < length; i++ )
+		result[i] = ( arrayA[i] + arrayB[i] ) * scalar;
+}
+
+float sumNeon( const float *array, size_t length )
+{
+	float32x4_t acc0 = vdupq_n_f32( 0 );
+	float32x4_t acc1 = vdupq_n_f32( 0 );
+	size_t i = 0;
+	for( ; i + 8 <= length; i += 8 ) {
+		acc0 = vaddq_f32( acc0, vld1q_f32( array + i ) );
+		acc1 = vaddq_f32( acc1, vld1q_f32( array + i + 4 ) );
+	}
+
+	float result = horizontalSum( vaddq_f32( acc0, acc1 ) );
+	for( ; i < length; i++ )
+		result += array[i];
+	return result;
+}
+
+float sumSquaresNeon( const float *array, size_t length )
+{
+	float32x4_t acc0 = vdupq_n_f32( 0 );
+	float32x4_t acc1 = vdupq_n_f32( 0 );
+	size_t i = 0;
+	for( ; i + 8 <= length; i += 8 ) {
+		float32x4_t a = vld1q_f32( array + i );
+		float32x4_t b = vld1q_f32( array + i + 4 );
+		acc0 = vaddq_f32( acc0, vmulq_f32( a, a ) );
+		acc1 = vaddq_f32( acc1, vmulq_f32( b, b ) );
+	}
+
+	float result = horizontalSum( vaddq_f32( acc0, acc1 ) );
+	for( ; i < length; i++ )
+		result += array[i] * array[i];
+	return result;
+}
+
+float maxNeon( const float *array, size_t length )
+{
+	if( length < 4 )
+		return maxScalar( array, length );
+
+	float32x4_t acc = vld1q_f32( array );
+	size_t i = 4;
+	for( ; i + 4 <= length; i += 4 )
+		acc = vmaxq_f32( acc, vld1q_f32( array + i ) );
+
+	float result = horizontalMax( acc );
+	for( ; i < length; i++ )
+		result = std::max( result, array[i] );
+	return result;
+}
+
+void floatToInt16Neon( const float *sourceArray, int16_t *destArray, size_t length )
+{
+	size_t i = 0;
+	for( ; i + 8 <= length; i += 8 ) {
+		int16x4_t a = vqmovn_s32( floatToInt16Range( vld1q_f32( sourceArray + i ) ) );
+		int16x4_t b = vqmovn_s32( floatToInt16Range( vld1q_f32( sourceArray + i + 4 ) ) );
+		vst1q_s16( destArray + i, vcombine_s16( a, b ) );
+	}
+	for( ; i < length; i++ )
+		destArray[i] = floatToInt16Sample( sourceArray[i] );
+}
+
+void int16ToFloatNeon( const int16_t *sourceArray, float *destArray, size_t length )
+{
+	size_t i = 0;
+	for( ; i + 8 <= length; i += 8 ) {
+		int16x8_t v = vld1q_s16( sourceArray + i );
+		vst1q_f32( destArray + i, vmulq_n_f32( vcvtq_f32_s32( vmovl_s16( vget_low_s16( v ) ) ), INT16_INV_NORMALIZER ) );
+		vst1q_f32( destArray + i + 4, vmulq_n_f32( vcvtq_f32_s32( vmovl_s16( vget_high_s16( v ) ) ), INT16_INV_NORMALIZER ) );
+	}
+	for( ; i < length; i++ )
+		destArray[i] = (float)sourceArray[i] * INT16_INV_NORMALIZER;
+}
+
+// NEON has structured loads and stores for 2 and 4 channels, other channel counts fall back to scalar loops.
+
+void interleaveNeon( const float *source, float *dest, size_t numFramesPerChannel, size_t numChannels, size_t numCopyFrames )
+{
+	const size_t numVectorFrames = numCopyFrames & ~size_t( 3 );
+	if( numChannels == 1 ) {
+		memcpy( dest, source, numCopyFrames * sizeof( float ) );
+	}
+	else if( numChannels == 2 ) {
+		for( size_t i = 0; i < numVectorFrames; i += 4 ) {
+			float32x4x2_t v = { { vld1q_f32( source + i ), vld1q_f32( source + numFramesPerChannel + i ) } };
+			vst2q_f32( dest + 2 * i, v );
+		}
+		interleaveRemainder( source, dest, numFramesPerChannel, 2, numCopyFrames, 0, 2, numVectorFrames );
+	}
+	else if( numChannels == 4 ) {
+		for( size_t i = 0; i < numVectorFrames; i += 4 ) {
+			float32x4x4_t v = { { vld1q_f32( source + i ), vld1q_f32( source + numFramesPerChannel + i ),
+								vld1q_f32( source + 2 * numFramesPerChannel + i ), vld1q_f32( source + 3 * numFramesPerChannel + i ) } };
+			vst4q_f32( dest + 4 * i, v );
+		}
+		interleaveRemainder( source, dest, numFramesPerChannel, 4, numCopyFrames, 0, 4, numVectorFrames );
+	}
+	else
+		interleaveScalar( source, dest, numFramesPerChannel, numChannels, numCopyFrames );
+}
+
+void deinterleaveNeon( const float *source, float *dest, size_t numFramesPerChannel, size_t numChannels, size_t numCopyFrames )
+{
+	const size_t numVectorFrames = numCopyFrames & ~size_t( 3 );
+	if( numChannels == 1 ) {
+		memcpy( dest, source, numCopyFrames * sizeof( float ) );
+	}
+	else if( numChannels == 2 ) {
+		for( size_t i = 0; i < numVectorFrames; i += 4 ) {
+			float32x4x2_t v = vld2q_f32( source + 2 * i );
+			vst1q_f32( dest + i, v.val[0] );
+			vst1q_f32( dest + numFramesPerChannel + i, v.val[1] );
+		}
+		deinterleaveRemainder( source, dest, numFramesPerChannel, 2, numCopyFrames, 0, 2, numVectorFrames );
+	}
+	else if( numChannels == 4 ) {
+		for( size_t i = 0; i < numVectorFrames; i += 4 ) {
+			float32x4x4_t v = vld4q_f32( source + 4 * i );
+			for( size_t ch = 0; ch < 4; ch++ )
+				vst1q_f32( dest + ch * numFramesPerChannel + i, v.val[ch] );
+		}
+		deinterleaveRemainder( source, dest, numFramesPerChannel, 4, numCopyFrames, 0, 4, numVectorFrames );
+	}
+	else
+		deinterleaveScalar( source, dest, numFramesPerChannel, numChannels, numCopyFrames );
+}
+
+void interleaveInt16Neon( const float *source, int16_t *dest, size_t numFramesPerChannel, size_t numChannels, size_t numCopyFrames )
+{
+	const size_t numVectorFrames = numCopyFrames & ~size_t( 3 );
+	if( numChannels == 1 ) {
+		floatToInt16Neon( source, dest, numCopyFrames );
+	}
+	else if( numChannels == 2 ) {
+		for( size_t i = 0; i < numVectorFrames; i += 4 ) {
+			int16x4x2_t v = { { vqmovn_s32( floatToInt16Range( vld1q_f32( source + i ) ) ), vqmovn_s32( floatToInt16Range( vld1q_f32( source + numFramesPerChannel + i ) ) ) } };
+			vst2_s16( dest + 2 * i, v );
+		}
+		interleaveInt16Remainder( source, dest, numFramesPerChannel, 2, numCopyFrames, 0, 2, numVectorFrames );
+	}
+	else
+		interleaveInt16Scalar( source, dest, numFramesPerChannel, numChannels, numCopyFrames );
+}
+
+void deinterleaveInt16Neon( const int16_t *source, float *dest, size_t numFramesPerChannel, size_t numChannels, size_t numCopyFrames )
+{
+	const size_t numVectorFrames = numCopyFrames & ~size_t( 3 );
+	if( numChannels == 1 ) {
+		int16ToFloatNeon( source, dest, numCopyFrames );
+	}
+	else if( numChannels == 2 ) {
+		for( size_t i = 0; i < numVectorFrames; i += 4 ) {
+			int16x4x2_t v = vld2_s16( source + 2 * i );
+			vst1q_f32( dest + i, vmulq_n_f32( vcvtq_f32_s32( vmovl_s16( v.val[0] ) ), INT16_INV_NORMALIZER ) );
+			vst1q_f32( dest + numFramesPerChannel + i, vmulq_n_f32( vcvtq_f32_s32( vmovl_s16( v.val[1] ) ), INT16_INV_NORMALIZER ) );
+		}
+		deinterleaveInt16Remainder( source, dest, numFramesPerChannel, 2, numCopyFrames, 0, 2, numVectorFrames );
+	}
+	else
+		deinterleaveInt16Scalar( source, dest, numFramesPerChannel, numChannels, numCopyFrames );
+}
+
+const Kernels sKernelsNeon = {
+	fillNeon, addScalarNeon, addNeon, subNeon, mulScalarNeon, mulNeon, addMulNeon, sumNeon, sumSquaresNeon, maxNeon,
+	floatToInt16Neon, int16ToFloatNeon, interleaveNeon, deinterleaveNeon, interleaveInt16Neon, deinterleaveInt16Neon
+};
+
+#endif // defined( CINDER_AUDIO_NEON )
+
+// ----------------------------------------------------------------------------------------------------
+// Dispatch
+// ----------------------------------------------------------------------------------------------------
+
+const Kernels* findKernels( SimdLevel level )
+{
+	switch( level ) {
+#if defined( CINDER_AUDIO_SSE2 )
+		case SimdLevel::SSE2:	return &sKernelsSse2;
+#endif
+#if defined( CINDER_AUDIO_AVX2 )
+		case SimdLevel::AVX2:	return isAvx2Supported() ? &sKernelsAvx2 : nullptr;
+#endif
+#if defined( CINDER_AUDIO_NEON )
+		case SimdLevel::NEON:	return &sKernelsNeon;
+#endif
+		case SimdLevel::NONE:	return &sKernelsScalar;
+		default:				return nullptr;
+	}
+}
+
+struct Dispatch {
+	Dispatch()
+		: mSupportedLevel( SimdLevel::NONE )
+	{
+		for( SimdLevel level : { SimdLevel::SSE2, SimdLevel::AVX2, SimdLevel::NEON } ) {
+			if( findKernels( level ) )
+				mSupportedLevel = level;
+		}
+
+		mLevel = mSupportedLevel;
+		mKernels = findKernels( mSupportedLevel );
+	}
+
+	SimdLevel					mSupportedLevel;
+	std::atomic<SimdLevel>		mLevel;
+	std::atomic<const Kernels*>	mKernels;
+};
+
+Dispatch& getDispatch()
+{
+	static Dispatch sDispatch;
+	return sDispatch;
+}
+
+} // anonymous namespace
+
+const Kernels& getKernels()
+{
+	return *getDispatch().mKernels.load( std::memory_order_relaxed );
+}
+
+} // namespace simd
+
+bool isSimdLevelSupported( SimdLevel level )
+{
+	return simd::findKernels( level ) != nullptr;
+}
+
+SimdLevel getSupportedSimdLevel()
+{
+	return simd::getDispatch().mSupportedLevel;
+}
+
+SimdLevel getSimdLevel()
+{
+	return simd::getDispatch().mLevel;
+}
+
+void setSimdLevel( SimdLevel level )
+{
+	auto kernels = simd::findKernels( level );
+	if( ! kernels ) {
+		level = SimdLevel::NONE;
+		kernels = simd::findKernels( level );
+	}
+
+	auto &dispatch = simd::getDispatch();
+	dispatch.mLevel = level;
+	dispatch.mKernels = kernels;
+}
+
+} } } // namespace cinder::audio::dsp
@@ -26,6 +26,8 @@
 #include "cinder/audio/Exception.h"
 #include "cinder/CinderMath.h"
 
+#include <algorithm>
+
 #if defined( CINDER_AUDIO_FFT_OOURA )
 	#include "cinder/audio/dsp/ooura/fftsg.h"
 #endif
@@ -134,7 +136,8 @@ void Fft::inverse( const BufferSpectral *spectral, Buffer *waveform )
 	CI_ASSERT( waveform->getNumFrames() == mSize );
 	CI_ASSERT( spectral->getNumFrames() == mSizeOverTwo );
 
-	mBufferCopy.copy( *spectral );
+	// BufferSpectral's real and imaginary components are stored as two channels of mSizeOverTwo frames, copy both of them
+	std::copy( spectral->getData(), spectral->getData() + mSize, mBufferCopy.getData() );
 
 	float *real = mBufferCopy.getData();
 	float *imag = &mBufferCopy.getData()[mSizeOverTwo];
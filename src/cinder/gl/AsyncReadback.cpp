@@ -0,0 +1,238 @@
+/*
+ Copyright (c) 2026, The Cinder Project
+
+ This code is intended to be used with the Cinder C++ library, http://libcinder.org
+
+ Redistribution and use in source and binary forms, with or without modification, are permitted provided that
+ the following conditions are met:
+
+    * Redistributions of source code must retain the above copyright notice, this list of conditions and
+	the following disclaimer.
+    * Redistributions in binary form must reproduce the above copyright notice, this list of conditions and
+	the following disclaimer in the documentation and/or other materials provided with the distribution.
+
+ THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED
+ WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A
+ PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR
+ ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+ TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+ NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ POSSIBILITY OF SUCH DAMAGE.
+*/
+
+#include "cinder/gl/platform.h"
+
+#if ! defined( CINDER_GL_ES )
+
+#include "cinder/gl/AsyncReadback.h"
+#include "cinder/gl/scoped.h"
+#include "cinder/Log.h"
+
+#include <cstring>
+
+using namespace std;
+
+namespace cinder { namespace gl {
+
+template<typename T>
+shared_ptr<AsyncReadbackT<T>> AsyncReadbackT<T>::create( const Format &format )
+{
+	return shared_ptr<AsyncReadbackT<T>>( new AsyncReadbackT<T>( format ) );
+}
+
+template<typename T>
+AsyncReadbackT<T>::AsyncReadbackT( const Format &format )
+	: mFormat( format ), mOldest( 0 ), mNumPending( 0 ), mNumStalls( 0 ), mNextId( 0 ), mNumEncodesOutstanding( 0 ), mEncodersQuit( false )
+{
+	mSlots.resize( std::max<size_t>( 1, format.getDepth() ) );
+	for( auto &slot : mSlots )
+		slot.mPbo = Pbo::create( GL_PIXEL_PACK_BUFFER );
+
+	if( format.getEncoder() ) {
+		mEncodeQueue.reset( new ConcurrentCircularBuffer<pair<SurfaceT<T>, uint64_t>>( std::max<size_t>( 1, format.getMaxQueuedEncodes() ) ) );
+		for( size_t i = 0; i < std::max<size_t>( 1, format.getNumEncoderThreads() ); ++i )
+			mEncoderThreads.emplace_back( &AsyncReadbackT<T>::encoderThreadFn, this );
+	}
+}
+
+template<typename T>
+AsyncReadbackT<T>::~AsyncReadbackT()
+{
+	// the Pbos belong to a context that may be gone by now, in which case the pending reads are lost
+	if( gl::context() )
+		flush( true );
+
+	if( mEncodeQueue ) {
+		mEncodersQuit = true;
+		mEncodeQueue->cancel();
+		for( auto &thread : mEncoderThreads )
+			thread.join();
+	}
+}
+
+template<typename T>
+uint64_t AsyncReadbackT<T>::read( const FboRef &fbo, const Area &area, GLenum attachment )
+{
+	// resolve first, before our own bind so that we don't force a resolve unnecessarily
+	fbo->resolveTextures();
+	ScopedFramebuffer readScp( GL_READ_FRAMEBUFFER, fbo->getId() );
+
+	Area readArea = fbo->prepareReadPixels( area, attachment );
+	return readImpl( readArea );
+}
+
+template<typename T>
+uint64_t AsyncReadbackT<T>::readWindow( const Area &area, int32_t windowHeightPixels )
+{
+	ScopedFramebuffer readScp( GL_READ_FRAMEBUFFER, 0 );
+	return readImpl( Area( area.x1, windowHeightPixels - area.y2, area.x2, windowHeightPixels - area.y1 ) );
+}
+
+template<typename T>
+uint64_t AsyncReadbackT<T>::readImpl( const Area &readArea )
+{
+	const size_t numSlots = mSlots.size();
+	if( mNumPending == numSlots ) {
+		// the GPU is a full ring behind; wait for the oldest read rather than dropping a frame
+		++mNumStalls;
+		retireOldest( true );
+	}
+
+	Slot &slot = mSlots[( mOldest + mNumPending ) % numSlots];
+	slot.mSize = readArea.getSize();
+	slot.mId = mNextId++;
+
+	const GLenum dataFormat = mFormat.hasAlpha() ? GL_RGBA : GL_RGB;
+	const GLenum dataType = std::is_same<T, float>::value ? GL_FLOAT : GL_UNSIGNED_BYTE;
+	const size_t rowBytes = slot.mSize.x * ( mFormat.hasAlpha() ? 4 : 3 ) * sizeof( T );
+	const GLsizeiptr dataSize = (GLsizeiptr)( rowBytes * slot.mSize.y );
+
+	ScopedBuffer pboScp( slot.mPbo );
+	if( (GLsizeiptr)slot.mPbo->getSize() < dataSize )
+		slot.mPbo->bufferData( dataSize, nullptr, GL_STREAM_READ );
+
+	GLint oldPackAlignment;
+	glGetIntegerv( GL_PACK_ALIGNMENT, &oldPackAlignment );
+	glPixelStorei( GL_PACK_ALIGNMENT, 1 );
+	if( dataSize > 0 )
+		glReadPixels( readArea.x1, readArea.y1, slot.mSize.x, slot.mSize.y, dataFormat, dataType, nullptr );
+	glPixelStorei( GL_PACK_ALIGNMENT, oldPackAlignment );
+
+	slot.mFence = Sync::create();
+	++mNumPending;
+
+	return slot.mId;
+}
+
+template<typename T>
+bool AsyncReadbackT<T>::retireOldest( bool wait )
+{
+	if( mNumPending == 0 )
+		return false;
+
+	Slot &slot = mSlots[mOldest];
+	GLenum status = slot.mFence->clientWaitSync( GL_SYNC_FLUSH_COMMANDS_BIT, wait ? GL_TIMEOUT_IGNORED : 0 );
+	if( status == GL_TIMEOUT_EXPIRED )
+		return false;
+	if( status == GL_WAIT_FAILED )
+		CI_LOG_E( "glClientWaitSync failed, reading back anyway" );
+
+	slot.mFence.reset();
+	mOldest = ( mOldest + 1 ) % mSlots.size();
+	--mNumPending;
+
+	// glReadPixels returns pixels which are bottom-up, so the rows are flipped while copying out of the Pbo
+	SurfaceT<T> surface( slot.mSize.x, slot.mSize.y, mFormat.hasAlpha(), mFormat.hasAlpha() ? SurfaceChannelOrder::RGBA : SurfaceChannelOrder::RGB );
+	const size_t rowBytes = slot.mSize.x * ( mFormat.hasAlpha() ? 4 : 3 ) * sizeof( T );
+	if( rowBytes > 0 && slot.mSize.y > 0 ) {
+		const uint8_t *mapped = reinterpret_cast<const uint8_t*>( slot.mPbo->mapBufferRange( 0, rowBytes * slot.mSize.y, GL_MAP_READ_BIT ) );
+		if( mapped ) {
+			for( int32_t y = 0; y < slot.mSize.y; ++y )
+				memcpy( reinterpret_cast<uint8_t*>( surface.getData( ivec2( 0, y ) ) ), mapped + rowBytes * ( slot.mSize.y - 1 - y ), rowBytes );
+			slot.mPbo->unmap();
+		}
+		else
+			CI_LOG_E( "failed to map readback Pbo" );
+	}
+
+	deliver( surface, slot.mId );
+	return true;
+}
+
+template<typename T>
+void AsyncReadbackT<T>::deliver( const SurfaceT<T> &surface, uint64_t id )
+{
+	if( mEncodeQueue ) {
+		++mNumEncodesOutstanding;
+		mEncodeQueue->pushFront( make_pair( surface, id ) );
+	}
+	if( mFormat.getCallback() )
+		mFormat.getCallback()( surface, id );
+	else if( ! mEncodeQueue )
+		mQueue.emplace_back( surface, id );
+}
+
+template<typename T>
+size_t AsyncReadbackT<T>::update()
+{
+	size_t numDelivered = 0;
+	while( retireOldest( false ) )
+		++numDelivered;
+
+	return numDelivered;
+}
+
+template<typename T>
+void AsyncReadbackT<T>::flush( bool waitForEncoders )
+{
+	while( retireOldest( true ) )
+		;
+
+	if( waitForEncoders && mEncodeQueue ) {
+		unique_lock<mutex> lock( mEncodeMutex );
+		mEncodeDoneCond.wait( lock, [this] { return mNumEncodesOutstanding == 0; } );
+	}
+}
+
+template<typename T>
+bool AsyncReadbackT<T>::popSurface( SurfaceT<T> *surface, uint64_t *id )
+{
+	if( mQueue.empty() )
+		return false;
+
+	*surface = mQueue.front().first;
+	if( id )
+		*id = mQueue.front().second;
+	mQueue.pop_front();
+	return true;
+}
+
+template<typename T>
+void AsyncReadbackT<T>::encoderThreadFn()
+{
+	while( ! mEncodersQuit ) {
+		pair<SurfaceT<T>, uint64_t> item;
+		mEncodeQueue->popBack( &item );
+		if( mEncodersQuit )
+			break;
+
+		try {
+			mFormat.getEncoder()( item.first, item.second );
+		}
+		catch( const std::exception &exc ) {
+			CI_LOG_E( "encoder failed for frame " << item.second << ": " << exc.what() );
+		}
+
+		lock_guard<mutex> lock( mEncodeMutex );
+		if( --mNumEncodesOutstanding == 0 )
+			mEncodeDoneCond.notify_all();
+	}
+}
+
+template class CI_API AsyncReadbackT<uint8_t>;
+template class CI_API AsyncReadbackT<float>;
+
+} } // namespace cinder::gl
+
+#endif // ! defined( CINDER_GL_ES )
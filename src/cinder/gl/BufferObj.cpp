@@ -246,6 +246,16 @@ GLuint BufferObj::getBindingConstantForTarget( GLenum target )
 			return GL_QUERY_BUFFER_BINDING;
 		case GL_ATOMIC_COUNTER_BUFFER:
 			return GL_ATOMIC_COUNTER_BUFFER_BINDING;
+		case GL_COPY_READ_BUFFER:
+			return GL_COPY_READ_BUFFER_BINDING;
+		case GL_COPY_WRITE_BUFFER:
+			return GL_COPY_WRITE_BUFFER_BINDING;
+  #if defined( GL_SHADER_STORAGE_BUFFER )
+		case GL_SHADER_STORAGE_BUFFER:
+			return GL_SHADER_STORAGE_BUFFER_BINDING;
+		case GL_DISPATCH_INDIRECT_BUFFER:
+			return GL_DISPATCH_INDIRECT_BUFFER_BINDING;
+  #endif
 #endif
 		default:
 			return 0;
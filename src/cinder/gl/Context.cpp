@@ -29,6 +29,7 @@
 #include "cinder/gl/TransformFeedbackObj.h"
 #include "cinder/gl/Fbo.h"
 #include "cinder/gl/Batch.h"
+#include "cinder/gl/StreamingBuffer.h"
 #include "cinder/gl/ConstantConversions.h"
 #include "cinder/gl/scoped.h"
 #include "cinder/Log.h"
@@ -59,6 +60,7 @@ namespace cinder { namespace gl {
 Context::Context( const std::shared_ptr<PlatformData> &platformData )
 	: mPlatformData( platformData ),
 	mColor( ColorAf::white() ),
+	mStreamingDrawEnabled( false ), mStreamingDrawVaoBufferId( 0 ), mStreamingDrawGlslProg( nullptr ), mStreamingDrawMode( GL_TRIANGLES ),
 	mObjectTrackingEnabled( platformData->mObjectTracking )
 {
 	// set thread's active Context to 'this' in case anything calls gl::context() (like the GlslProg constructor)
@@ -72,13 +74,10 @@ Context::Context( const std::shared_ptr<PlatformData> &platformData )
 	mDefaultVao->setContext( this );
 	mDefaultVao->bindImpl( NULL );
 
-	mBufferBindingStack[GL_ARRAY_BUFFER] = vector<int>();
 	mBufferBindingStack[GL_ARRAY_BUFFER].push_back( 0 );
-	mBufferBindingStack[GL_ELEMENT_ARRAY_BUFFER] = vector<int>();
 	mBufferBindingStack[GL_ELEMENT_ARRAY_BUFFER].push_back( 0 );
 
-	mRenderbufferBindingStack[GL_RENDERBUFFER] = vector<int>();
-	mRenderbufferBindingStack[GL_RENDERBUFFER].push_back( 0 );
+	mRenderbufferBindingStack.push_back( 0 );
 	 
 	mReadFramebufferStack.push_back( 0 );
 	mDrawFramebufferStack.push_back( 0 );	
@@ -86,13 +85,12 @@ Context::Context( const std::shared_ptr<PlatformData> &platformData )
 	mFramebufferStack.push_back( 0 );
 #endif
 	mDefaultArrayVboIdx = 0;
+	mStreamingDrawVaoLocations.fill( -1 );
 
 	// initial state for depth mask is enabled
-	mBoolStateStack[GL_DEPTH_WRITEMASK] = vector<GLboolean>();
 	mBoolStateStack[GL_DEPTH_WRITEMASK].push_back( GL_TRUE );
 	
 	// initial state for depth test is disabled
-	mBoolStateStack[GL_DEPTH_TEST] = vector<GLboolean>();
 	mBoolStateStack[GL_DEPTH_TEST].push_back( GL_FALSE );
 	
 	// push default depth function
@@ -154,6 +152,10 @@ Context::Context( const std::shared_ptr<PlatformData> &platformData )
 
 Context::~Context()
 {
+	// a pending streaming draw batch is dropped
+	if( mStreamingDrawGlslProg )
+		mStreamingDrawGlslProg->mStreamingDrawContext = nullptr;
+
 	if( getCurrent() == this ) {
 		env()->makeContextCurrent( nullptr );
 
@@ -181,6 +183,11 @@ ContextRef Context::createFromExisting( const std::shared_ptr<PlatformData> &pla
 
 void Context::makeCurrent( bool force ) const
 {
+	// a batch can't be issued once its Context is no longer current
+	Context *prevCtx = getCurrent();
+	if( prevCtx && ( prevCtx != this ) )
+		prevCtx->flushStreamingDraw();
+
 #if defined( CINDER_COCOA ) || defined( CINDER_LINUX )
 	if( ! sThreadSpecificCurrentContextInitialized ) {
 		pthread_key_create( &sThreadSpecificCurrentContextKey, NULL );
@@ -228,7 +235,7 @@ void Context::reflectCurrent( Context *context )
 void Context::bindVao( Vao *vao )
 {
 	Vao *prevVao = getVao();
-	if( setStackState( mVaoStack, vao ) ) {
+	if( countStateChange( StateCounters::VAO, setStackState( mVaoStack, vao ) ) ) {
 		if( prevVao )
 			prevVao->unbindImpl( this );
 		if( vao )
@@ -239,7 +246,7 @@ void Context::bindVao( Vao *vao )
 void Context::pushVao( Vao *vao )
 {
 	Vao *prevVao = getVao();
-	if( pushStackState( mVaoStack, vao ) ) {
+	if( countStateChange( StateCounters::VAO, pushStackState( mVaoStack, vao ) ) ) {
 		if( prevVao )
 			prevVao->unbindImpl( this );
 		if( vao )
@@ -259,7 +266,7 @@ void Context::popVao()
 	if( ! mVaoStack.empty() ) {
 		mVaoStack.pop_back();
 		if( ! mVaoStack.empty() ) {
-			if( prevVao != mVaoStack.back() ) {
+			if( countStateChange( StateCounters::VAO, prevVao != mVaoStack.back() ) ) {
 				if( prevVao )
 					prevVao->unbindImpl( this );
 				if( mVaoStack.back() )
@@ -308,13 +315,13 @@ void Context::vaoDeleted( const Vao *vao )
 // Viewport
 void Context::viewport( const std::pair<ivec2, ivec2> &viewport )
 {
-	if( setStackState( mViewportStack, viewport ) )
+	if( countStateChange( StateCounters::VIEWPORT, setStackState( mViewportStack, viewport ) ) )
 		glViewport( viewport.first.x, viewport.first.y, viewport.second.x, viewport.second.y );
 }
 
 void Context::pushViewport( const std::pair<ivec2, ivec2> &viewport )
 {
-	if( pushStackState( mViewportStack, viewport ) )
+	if( countStateChange( StateCounters::VIEWPORT, pushStackState( mViewportStack, viewport ) ) )
 		glViewport( viewport.first.x, viewport.first.y, viewport.second.x, viewport.second.y );
 }
 
@@ -327,7 +334,7 @@ void Context::popViewport( bool forceRestore )
 {
 	if( mViewportStack.empty() )
 		CI_LOG_E( "Viewport stack underflow" );
-	else if( popStackState( mViewportStack ) || forceRestore ) {
+	else if( countStateChange( StateCounters::VIEWPORT, popStackState( mViewportStack ) || forceRestore ) ) {
 		auto viewport = getViewport();
 		glViewport( viewport.first.x, viewport.first.y, viewport.second.x, viewport.second.y );
 	}
@@ -350,13 +357,13 @@ std::pair<ivec2, ivec2> Context::getViewport()
 // Scissor Test
 void Context::setScissor( const std::pair<ivec2, ivec2> &scissor )
 {
-	if( setStackState( mScissorStack, scissor ) )
+	if( countStateChange( StateCounters::VIEWPORT, setStackState( mScissorStack, scissor ) ) )
 		glScissor( scissor.first.x, scissor.first.y, scissor.second.x, scissor.second.y );
 }
 
 void Context::pushScissor( const std::pair<ivec2, ivec2> &scissor )
 {
-	if( pushStackState( mScissorStack, scissor ) )
+	if( countStateChange( StateCounters::VIEWPORT, pushStackState( mScissorStack, scissor ) ) )
 		glScissor( scissor.first.x, scissor.first.y, scissor.second.x, scissor.second.y );
 }
 
@@ -369,7 +376,7 @@ void Context::popScissor( bool forceRestore )
 {
 	if( mScissorStack.empty() )
 		CI_LOG_E( "Scissor stack underflow" );
-	else if( popStackState( mScissorStack ) || forceRestore ) {
+	else if( countStateChange( StateCounters::VIEWPORT, popStackState( mScissorStack ) || forceRestore ) ) {
 		auto scissor = getScissor();
 		glScissor( scissor.first.x, scissor.first.y, scissor.second.x, scissor.second.y );
 	}
@@ -392,14 +399,14 @@ std::pair<ivec2, ivec2> Context::getScissor()
 // Face Culling
 void Context::cullFace( GLenum face )
 {
-	if( setStackState( mCullFaceStack, face ) ) {
+	if( countStateChange( StateCounters::RASTER, setStackState( mCullFaceStack, face ) ) ) {
 		glCullFace( face );
 	}
 }
 
 void Context::pushCullFace( GLenum face )
 {
-	if( pushStackState( mCullFaceStack, face ) ) {
+	if( countStateChange( StateCounters::RASTER, pushStackState( mCullFaceStack, face ) ) ) {
 		glCullFace( face );
 	}
 }
@@ -413,7 +420,7 @@ void Context::popCullFace( bool forceRestore )
 {
 	if( mCullFaceStack.empty() )
 		CI_LOG_E( "Cull face stack underflow" );
-	else if( popStackState( mCullFaceStack ) || forceRestore )
+	else if( countStateChange( StateCounters::RASTER, popStackState( mCullFaceStack ) || forceRestore ) )
 		glCullFace( getCullFace() );
 }
 
@@ -433,14 +440,14 @@ GLenum Context::getCullFace()
 // FrontFace
 void Context::frontFace( GLenum mode )
 {
-	if( setStackState( mFrontFaceStack, mode ) ) {
+	if( countStateChange( StateCounters::RASTER, setStackState( mFrontFaceStack, mode ) ) ) {
 		glFrontFace( mode );
 	}
 }
 
 void Context::pushFrontFace( GLenum mode )
 {
-	if( pushStackState( mFrontFaceStack, mode ) ) {
+	if( countStateChange( StateCounters::RASTER, pushStackState( mFrontFaceStack, mode ) ) ) {
 		glFrontFace( mode );
 	}
 }
@@ -454,7 +461,7 @@ void Context::popFrontFace( bool forceRestore )
 {
 	if( mFrontFaceStack.empty() )
 		CI_LOG_E( "Front face stack underflow" );
-	else if( popStackState( mFrontFaceStack ) || forceRestore )
+	else if( countStateChange( StateCounters::RASTER, popStackState( mFrontFaceStack ) || forceRestore ) )
 		glFrontFace( getFrontFace() );
 }
 
@@ -475,13 +482,13 @@ GLenum Context::getFrontFace()
 #if ! defined( CINDER_GL_ES )
 void Context::logicOp( GLenum mode )
 {
-	if( setStackState( mLogicOpStack, mode ) )
+	if( countStateChange( StateCounters::RASTER, setStackState( mLogicOpStack, mode ) ) )
 		glLogicOp( mode );
 }
 
 void Context::pushLogicOp( GLenum mode )
 {
-	if( pushStackState( mLogicOpStack, mode ) )
+	if( countStateChange( StateCounters::RASTER, pushStackState( mLogicOpStack, mode ) ) )
 		glLogicOp( mode );
 }
 
@@ -489,7 +496,7 @@ void Context::popLogicOp( bool forceRefresh )
 {
 	if( mLogicOpStack.empty() )
 		CI_LOG_E( "Logic Op stack underflow" );
-	else if( popStackState( mLogicOpStack ) || forceRefresh )
+	else if( countStateChange( StateCounters::RASTER, popStackState( mLogicOpStack ) || forceRefresh ) )
 		glLogicOp( getLogicOp() );
 }
 
@@ -511,7 +518,7 @@ GLenum Context::getLogicOp()
 void Context::bindBuffer( GLenum target, GLuint id )
 {
 	GLuint prevValue = getBufferBinding( target );
-	if( prevValue != id ) {
+	if( countStateChange( StateCounters::BUFFER, prevValue != id ) ) {
 		mBufferBindingStack[target].back() = id;
 		if( target == GL_ARRAY_BUFFER || target == GL_ELEMENT_ARRAY_BUFFER ) {
 			Vao* vao = getVao();
@@ -540,55 +547,51 @@ void Context::pushBufferBinding( GLenum target )
 void Context::popBufferBinding( GLenum target )
 {
 	GLuint prevValue = getBufferBinding( target );
-	auto cachedIt = mBufferBindingStack.find( target );
-	cachedIt->second.pop_back();
-	if( ! cachedIt->second.empty() && cachedIt->second.back() != prevValue ) {
+	auto &stack = mBufferBindingStack[target];
+	stack.pop_back();
+	if( ! stack.empty() && countStateChange( StateCounters::BUFFER, (GLuint)stack.back() != prevValue ) ) {
 		if( target == GL_ARRAY_BUFFER || target == GL_ELEMENT_ARRAY_BUFFER ) {
 			Vao* vao = getVao();
 			if( vao )
-				vao->reflectBindBufferImpl( target, cachedIt->second.back() );
+				vao->reflectBindBufferImpl( target, stack.back() );
 			else
-				glBindBuffer( target, cachedIt->second.back() );
+				glBindBuffer( target, stack.back() );
 		}
 		else
-			glBindBuffer( target, cachedIt->second.back() );
+			glBindBuffer( target, stack.back() );
 	}
 }
 
 GLuint Context::getBufferBinding( GLenum target )
 {
-	auto cachedIt = mBufferBindingStack.find( target );
-	if( (cachedIt == mBufferBindingStack.end()) || ( cachedIt->second.empty() ) || ( cachedIt->second.back() == -1 ) ) {
+	auto &stack = mBufferBindingStack[target];
+	if( stack.empty() || ( stack.back() == -1 ) ) {
 		GLint queriedInt = 0;
 		GLenum targetBinding = BufferObj::getBindingConstantForTarget( target );
-		if( targetBinding > 0 ) {
+		// targets without a binding query are assumed to start unbound
+		if( targetBinding > 0 )
 			glGetIntegerv( targetBinding, &queriedInt );
-		}
-		else
-			return 0; // warning?
 		
-		if( mBufferBindingStack[target].empty() ) { // bad - empty stack; push twice to allow for the pop later and not lead to an empty stack
-			mBufferBindingStack[target] = vector<GLint>();
-			mBufferBindingStack[target].push_back( queriedInt );
-			mBufferBindingStack[target].push_back( queriedInt );			
+		if( stack.empty() ) { // bad - empty stack; push twice to allow for the pop later and not lead to an empty stack
+			stack.push_back( queriedInt );
+			stack.push_back( queriedInt );
 		}
 		else
-			mBufferBindingStack[target].back() = queriedInt;
+			stack.back() = queriedInt;
 		return (GLuint)queriedInt;
 	}
 	else
-		return (GLuint)cachedIt->second.back();
+		return (GLuint)stack.back();
 }
 
 void Context::reflectBufferBinding( GLenum target, GLuint id )
 {
-	// first time we've met this target; start an empty stack
-	if( mBufferBindingStack.find(target) == mBufferBindingStack.end() ) {
-		mBufferBindingStack[target] = vector<int>();
-		mBufferBindingStack[target].push_back( id );
-	}
-	else if( ! mBufferBindingStack[target].empty() )
-		mBufferBindingStack[target].back() = id;
+	auto &stack = mBufferBindingStack[target];
+	// first time we've met this target; start the stack
+	if( stack.empty() )
+		stack.push_back( id );
+	else
+		stack.back() = id;
 }
 
 void Context::bufferCreated( const BufferObj *buffer )
@@ -604,12 +607,12 @@ void Context::bufferDeleted( const BufferObj *buffer )
 		mLiveBuffers.erase( buffer );
 
 	auto target = buffer->getTarget();
+	auto &stack = mBufferBindingStack[target];
 
 	// if 'id' was bound to 'target', mark 'target's binding as 0
-	auto existingIt = mBufferBindingStack.find( target );
-	if( existingIt != mBufferBindingStack.end() && ! existingIt->second.empty() ) {
-		if( mBufferBindingStack[target].back() == buffer->getId() ) {
-			mBufferBindingStack[target].back() = 0;
+	if( ! stack.empty() ) {
+		if( stack.back() == (int)buffer->getId() ) {
+			stack.back() = 0;
 			// alert the currently bound VAO
 			if( target == GL_ARRAY_BUFFER || target == GL_ELEMENT_ARRAY_BUFFER ) {
 				Vao* vao = getVao();
@@ -619,25 +622,23 @@ void Context::bufferDeleted( const BufferObj *buffer )
 		}
 	}
 	else
-		mBufferBindingStack[target].push_back( 0 );
+		stack.push_back( 0 );
 }
 
 void Context::invalidateBufferBindingCache( GLenum target )
 {
-	if( mBufferBindingStack.find(target) == mBufferBindingStack.end() ) {
-		mBufferBindingStack[target] = vector<int>();
-		mBufferBindingStack[target].push_back( -1 );
-	}
-	else if( ! mBufferBindingStack[target].empty() )
-		mBufferBindingStack[target].back() = -1;
+	auto &stack = mBufferBindingStack[target];
+	if( stack.empty() )
+		stack.push_back( -1 );
+	else
+		stack.back() = -1;
 }
 	
 void Context::restoreInvalidatedBufferBinding( GLenum target )
 {
-	if( mBufferBindingStack.find(target) != mBufferBindingStack.end() ) {
-		if( ! mBufferBindingStack[target].empty() )
-			glBindBuffer( target, mBufferBindingStack[target].back() );
-	}
+	auto &stack = mBufferBindingStack[target];
+	if( ! stack.empty() )
+		glBindBuffer( target, stack.back() );
 }
 
 //////////////////////////////////////////////////////////////////
@@ -645,8 +646,8 @@ void Context::restoreInvalidatedBufferBinding( GLenum target )
 void Context::bindRenderbuffer( GLenum target, GLuint id )
 {
 	GLuint prevValue = getRenderbufferBinding( target );
-	if( prevValue != id ) {
-		mRenderbufferBindingStack[target].back() = id;
+	if( countStateChange( StateCounters::RENDERBUFFER, prevValue != id ) ) {
+		mRenderbufferBindingStack.back() = id;
 		glBindRenderbuffer( target, id );
 	}
 }
@@ -660,54 +661,48 @@ void Context::pushRenderbufferBinding( GLenum target, GLuint id )
 void Context::pushRenderbufferBinding( GLenum target )
 {
 	GLuint curValue = getRenderbufferBinding( target );
-	mRenderbufferBindingStack[target].push_back( curValue );
+	mRenderbufferBindingStack.push_back( curValue );
 }
 
 void Context::popRenderbufferBinding( GLenum target )
 {
 	GLuint prevValue = getRenderbufferBinding( target );
-	auto cachedIt = mRenderbufferBindingStack.find( target );
-	cachedIt->second.pop_back();
-	if( ! cachedIt->second.empty() && cachedIt->second.back() != prevValue ) {
-		glBindRenderbuffer( target, cachedIt->second.back() );
+	mRenderbufferBindingStack.pop_back();
+	if( ! mRenderbufferBindingStack.empty() && countStateChange( StateCounters::RENDERBUFFER, (GLuint)mRenderbufferBindingStack.back() != prevValue ) ) {
+		glBindRenderbuffer( target, mRenderbufferBindingStack.back() );
 	}
 }
 
 GLuint Context::getRenderbufferBinding( GLenum target )
 {
-	// currently only GL_RENDERBUFFER is legal in GL
+	// currently only GL_RENDERBUFFER is legal in GL, so a single stack suffices
 	CI_ASSERT( target == GL_RENDERBUFFER );
 	
-	auto cachedIt = mRenderbufferBindingStack.find( target );
-	if( (cachedIt == mRenderbufferBindingStack.end()) || ( cachedIt->second.empty() ) || ( cachedIt->second.back() == -1 ) ) {
+	if( mRenderbufferBindingStack.empty() || ( mRenderbufferBindingStack.back() == -1 ) ) {
 		GLint queriedInt = 0;
 		glGetIntegerv( GL_RENDERBUFFER_BINDING, &queriedInt );
 		
-		if( mRenderbufferBindingStack[target].empty() ) { // bad - empty stack; push twice to allow for the pop later and not lead to an empty stack
-			mRenderbufferBindingStack[target] = vector<GLint>();
-			mRenderbufferBindingStack[target].push_back( queriedInt );
-			mRenderbufferBindingStack[target].push_back( queriedInt );			
+		if( mRenderbufferBindingStack.empty() ) { // bad - empty stack; push twice to allow for the pop later and not lead to an empty stack
+			mRenderbufferBindingStack.push_back( queriedInt );
+			mRenderbufferBindingStack.push_back( queriedInt );
 		}
 		else
-			mRenderbufferBindingStack[target].back() = queriedInt;
+			mRenderbufferBindingStack.back() = queriedInt;
 		return (GLuint)queriedInt;
 	}
 	else
-		return (GLuint)cachedIt->second.back();
+		return (GLuint)mRenderbufferBindingStack.back();
 }
 
 void Context::renderbufferDeleted( const Renderbuffer *buffer )
 {
-	GLenum target = GL_RENDERBUFFER;
-
-	// if 'id' was bound to 'target', mark 'target's binding as 0
-	auto existingIt = mRenderbufferBindingStack.find( target );
-	if( existingIt != mRenderbufferBindingStack.end() ) {
-		if( mRenderbufferBindingStack[target].back() == buffer->getId() )
-			mRenderbufferBindingStack[target].back() = 0;
+	// if 'id' was bound, mark the binding as 0
+	if( ! mRenderbufferBindingStack.empty() ) {
+		if( mRenderbufferBindingStack.back() == (int)buffer->getId() )
+			mRenderbufferBindingStack.back() = 0;
 	}
 	else
-		mRenderbufferBindingStack[target].push_back( 0 );
+		mRenderbufferBindingStack.push_back( 0 );
 }
 
 #if ! defined( CINDER_GL_ES_2 )
@@ -800,7 +795,7 @@ void Context::pushGlslProg( const GlslProg* prog )
 	const GlslProg* prevGlsl = getGlslProg();
 
 	mGlslProgStack.push_back( prog );
-	if( prog != prevGlsl ) {
+	if( countStateChange( StateCounters::GLSL_PROG, prog != prevGlsl ) ) {
 		if( prog )
 			prog->bindImpl();
 		else
@@ -820,7 +815,7 @@ void Context::popGlslProg( bool forceRestore )
 	if( ! mGlslProgStack.empty() ) {
 		mGlslProgStack.pop_back();
 		if( ! mGlslProgStack.empty() ) {
-			if( forceRestore || ( prevGlsl != mGlslProgStack.back() ) ) {
+			if( countStateChange( StateCounters::GLSL_PROG, forceRestore || ( prevGlsl != mGlslProgStack.back() ) ) ) {
 				if( mGlslProgStack.back() )
 					mGlslProgStack.back()->bindImpl();
 				else
@@ -836,7 +831,7 @@ void Context::popGlslProg( bool forceRestore )
 
 void Context::bindGlslProg( const GlslProg *prog )
 {
-	if( mGlslProgStack.empty() || (mGlslProgStack.back() != prog) ) {
+	if( countStateChange( StateCounters::GLSL_PROG, mGlslProgStack.empty() || (mGlslProgStack.back() != prog) ) ) {
 		if( ! mGlslProgStack.empty() )
 			mGlslProgStack.back() = prog;
 		if( prog )
@@ -875,12 +870,10 @@ void Context::bindTexture( GLenum target, GLuint textureId )
 
 void Context::bindTexture( GLenum target, GLuint textureId, uint8_t textureUnit )
 {
-	if( mTextureBindingStack.find( textureUnit ) == mTextureBindingStack.end() )
-		mTextureBindingStack[textureUnit] = std::map<GLenum,std::vector<GLint>>();
-
 	GLuint prevValue = getTextureBinding( target, textureUnit );
-	if( prevValue != textureId ) {
-		mTextureBindingStack[textureUnit][target].back() = textureId;
+	if( countStateChange( StateCounters::TEXTURE, prevValue != textureId ) ) {
+		flushStreamingDraw();
+		getTextureBindingStack( target, textureUnit ).back() = textureId;
 		ScopedActiveTexture actScp( textureUnit );
 		glBindTexture( target, textureId );
 	}
@@ -888,28 +881,18 @@ void Context::bindTexture( GLenum target, GLuint textureId, uint8_t textureUnit
 
 void Context::pushTextureBinding( GLenum target, uint8_t textureUnit )
 {
-	if( mTextureBindingStack.find( textureUnit ) == mTextureBindingStack.end() ) {
-		mTextureBindingStack[textureUnit] = std::map<GLenum,std::vector<GLint>>();
+	auto &stack = getTextureBindingStack( target, textureUnit );
+	if( stack.empty() ) {
 		GLenum targetBinding = Texture::getBindingConstantForTarget( target );
 		GLint queriedInt = -1;
 		if( targetBinding > 0 ) {
 			ScopedActiveTexture actScp( textureUnit );
 			glGetIntegerv( targetBinding, &queriedInt );
 		}
-		mTextureBindingStack[textureUnit][target].push_back( queriedInt );
-	}
-	else if( mTextureBindingStack[textureUnit].find( target ) == mTextureBindingStack[textureUnit].end() ) {
-		mTextureBindingStack[textureUnit][target] = std::vector<GLint>();
-		GLenum targetBinding = Texture::getBindingConstantForTarget( target );
-		GLint queriedInt = -1;
-		if( targetBinding > 0 ) {
-			ScopedActiveTexture actScp( textureUnit );
-			glGetIntegerv( targetBinding, &queriedInt );
-		}
-		mTextureBindingStack[textureUnit][target].push_back( queriedInt );
+		stack.push_back( queriedInt );
 	}
 	
-	mTextureBindingStack[textureUnit][target].push_back( mTextureBindingStack[textureUnit][target].back() );
+	stack.push_back( stack.back() );
 }
 
 void Context::pushTextureBinding( GLenum target, GLuint textureId, uint8_t textureUnit )
@@ -920,31 +903,27 @@ void Context::pushTextureBinding( GLenum target, GLuint textureId, uint8_t textu
 
 void Context::popTextureBinding( GLenum target, uint8_t textureUnit, bool forceRestore )
 {
-	if( mTextureBindingStack.find( textureUnit ) == mTextureBindingStack.end() ) {
-		mTextureBindingStack[textureUnit] = std::map<GLenum,std::vector<GLint>>();
+	auto &stack = getTextureBindingStack( target, textureUnit );
+	if( stack.empty() ) {
 		CI_LOG_E( "Popping unencountered texture binding target:" << gl::constantToString( target ) );
+		return;
 	}
 
-	auto cached = mTextureBindingStack[textureUnit].find( target );
-	if( ( cached != mTextureBindingStack[textureUnit].end() ) && ( ! cached->second.empty() ) ) {
-		GLint prevValue = cached->second.back();
-		cached->second.pop_back();
-		if( ! cached->second.empty() ) {
-			if( forceRestore || ( cached->second.back() != prevValue ) ) {
-				ScopedActiveTexture actScp( textureUnit );
-				glBindTexture( target, cached->second.back() );
-			}
+	GLint prevValue = stack.back();
+	stack.pop_back();
+	if( ! stack.empty() ) {
+		if( countStateChange( StateCounters::TEXTURE, forceRestore || ( stack.back() != prevValue ) ) ) {
+			flushStreamingDraw();
+			ScopedActiveTexture actScp( textureUnit );
+			glBindTexture( target, stack.back() );
 		}
 	}
 }
 
 GLuint Context::getTextureBinding( GLenum target, uint8_t textureUnit )
 {
-	if( mTextureBindingStack.find( textureUnit ) == mTextureBindingStack.end() )
-		mTextureBindingStack[textureUnit] = std::map<GLenum,std::vector<GLint>>();
-
-	auto cachedIt = mTextureBindingStack[textureUnit].find( target );
-	if( (cachedIt == mTextureBindingStack[textureUnit].end()) || ( cachedIt->second.empty() ) || ( cachedIt->second.back() == -1 ) ) {
+	auto &stack = getTextureBindingStack( target, textureUnit );
+	if( stack.empty() || ( stack.back() == -1 ) ) {
 		GLint queriedInt = 0;
 		GLenum targetBinding = Texture::getBindingConstantForTarget( target );
 		if( targetBinding > 0 ) {
@@ -954,17 +933,24 @@ GLuint Context::getTextureBinding( GLenum target, uint8_t textureUnit )
 		else
 			return 0; // warning?
 		
-		if( mTextureBindingStack[textureUnit][target].empty() ) { // bad - empty stack; push twice to allow for the pop later and not lead to an empty stack
-			mTextureBindingStack[textureUnit][target] = vector<GLint>();
-			mTextureBindingStack[textureUnit][target].push_back( queriedInt );
-			mTextureBindingStack[textureUnit][target].push_back( queriedInt );			
+		if( stack.empty() ) { // bad - empty stack; push twice to allow for the pop later and not lead to an empty stack
+			stack.push_back( queriedInt );
+			stack.push_back( queriedInt );
 		}
 		else
-			mTextureBindingStack[textureUnit][target].back() = queriedInt;
+			stack.back() = queriedInt;
 		return (GLuint)queriedInt;
 	}
 	else
-		return (GLuint)cachedIt->second.back();
+		return (GLuint)stack.back();
+}
+
+StateStack<GLint>& Context::getTextureBindingStack( GLenum target, uint8_t textureUnit )
+{
+	if( textureUnit >= mTextureBindingStack.size() )
+		mTextureBindingStack.resize( textureUnit + 1 );
+
+	return mTextureBindingStack[textureUnit][target];
 }
 
 void Context::textureCreated( const TextureBase *texture )
@@ -983,11 +969,10 @@ void Context::textureDeleted( const TextureBase *texture )
 		mLiveTextures.erase( texture );
 
 	for( auto &unit : mTextureBindingStack ) {
-		auto cachedIt = unit.second.find( target );
-		if( cachedIt != unit.second.end() && ( ! cachedIt->second.empty() ) && ( cachedIt->second.back() != textureId ) ) {
-		// GL will have set the binding to 0 for target, so let's do the same
-			unit.second[target].back() = 0;
-	}
+		auto &stack = unit[target];
+		// GL will have set the binding to 0 for target on any unit it was bound to, so let's do the same
+		if( ( ! stack.empty() ) && ( stack.back() == (GLint)textureId ) )
+			stack.back() = 0;
 	}
 }
 
@@ -995,13 +980,13 @@ void Context::textureDeleted( const TextureBase *texture )
 // ActiveTexture
 void Context::setActiveTexture( uint8_t textureUnit )
 {
-	if( setStackState<uint8_t>( mActiveTextureStack, textureUnit ) )
+	if( countStateChange( StateCounters::TEXTURE, setStackState<uint8_t>( mActiveTextureStack, textureUnit ) ) )
 		glActiveTexture( GL_TEXTURE0 + textureUnit );
 }
 
 void Context::pushActiveTexture( uint8_t textureUnit )
 {
-	if( pushStackState<uint8_t>( mActiveTextureStack, textureUnit ) )
+	if( countStateChange( StateCounters::TEXTURE, pushStackState<uint8_t>( mActiveTextureStack, textureUnit ) ) )
 		glActiveTexture( GL_TEXTURE0 + textureUnit );
 }
 
@@ -1015,7 +1000,7 @@ void Context::popActiveTexture( bool forceRefresh )
 {
 	if( mActiveTextureStack.empty() )
 		CI_LOG_E( "Active texture stack underflow" );
-	else if( popStackState<uint8_t>( mActiveTextureStack ) || forceRefresh )
+	else if( countStateChange( StateCounters::TEXTURE, popStackState<uint8_t>( mActiveTextureStack ) || forceRefresh ) )
 		glActiveTexture( GL_TEXTURE0 + getActiveTexture() );
 }
 
@@ -1038,7 +1023,8 @@ uint8_t Context::getActiveTexture()
 void Context::bindSampler( uint8_t textureUnit, GLuint samplerId )
 {
 	GLuint prevValue = getSamplerBinding( textureUnit );
-	if( prevValue != samplerId ) {
+	if( countStateChange( StateCounters::SAMPLER, prevValue != samplerId ) ) {
+		flushStreamingDraw();
 		mSamplerBindingStack[textureUnit].back() = samplerId;
 		glBindSampler( textureUnit, samplerId );
 	}
@@ -1048,8 +1034,10 @@ void Context::pushSamplerBinding( uint8_t textureUnit, GLuint samplerId )
 {
 	GLuint prevSampler = getSamplerBinding( textureUnit );
 	mSamplerBindingStack[textureUnit].push_back( samplerId );
-	if( prevSampler != samplerId )
+	if( countStateChange( StateCounters::SAMPLER, prevSampler != samplerId ) ) {
+		flushStreamingDraw();
 		glBindSampler( textureUnit, samplerId );
+	}
 }
 
 void Context::popSamplerBinding( uint8_t textureUnit, bool forceRestore )
@@ -1060,11 +1048,14 @@ void Context::popSamplerBinding( uint8_t textureUnit, bool forceRestore )
 	}
 
 	GLuint prevSampler = getSamplerBinding( textureUnit );
-	mSamplerBindingStack[textureUnit].pop_back();
-	if( mSamplerBindingStack[textureUnit].empty() )
+	auto &stack = mSamplerBindingStack[textureUnit];
+	stack.pop_back();
+	if( stack.empty() )
 		CI_LOG_E( "Stack underflow popping sampler binding on unit " << textureUnit );
-	else if( (mSamplerBindingStack[textureUnit].back() != prevSampler) || forceRestore )
-		glBindSampler( textureUnit, mSamplerBindingStack[textureUnit].back() ); 
+	else if( countStateChange( StateCounters::SAMPLER, (stack.back() != prevSampler) || forceRestore ) ) {
+		flushStreamingDraw();
+		glBindSampler( textureUnit, stack.back() );
+	}
 }
 
 GLuint Context::getSamplerBinding( uint8_t textureUnit )
@@ -1072,16 +1063,17 @@ GLuint Context::getSamplerBinding( uint8_t textureUnit )
 	if( textureUnit >= mSamplerBindingStack.size() )
 		mSamplerBindingStack.resize( textureUnit + 1 );
 
-	if( mSamplerBindingStack[textureUnit].empty() ) {
+	auto &stack = mSamplerBindingStack[textureUnit];
+	if( stack.empty() ) {
 		GLint queriedInt = 0;
 		ScopedActiveTexture actScp( textureUnit );
 		glGetIntegerv( GL_SAMPLER_BINDING, &queriedInt );
 		// push twice to allow for a pop later to not lead to an empty stack
-		mSamplerBindingStack[textureUnit].push_back( (GLuint)queriedInt ); 
-		mSamplerBindingStack[textureUnit].push_back( (GLuint)queriedInt );
+		stack.push_back( (GLuint)queriedInt );
+		stack.push_back( (GLuint)queriedInt );
 	}
 
-	return mSamplerBindingStack[textureUnit].back();
+	return stack.back();
 }
 #endif // defined( CINDER_GL_HAS_SAMPLERS )
 
@@ -1091,7 +1083,7 @@ void Context::bindFramebuffer( GLenum target, GLuint framebuffer )
 {
 #if ! defined( CINDER_GL_HAS_FBO_MULTISAMPLING )
 	if( target == GL_FRAMEBUFFER ) {
-		if( setStackState<GLint>( mFramebufferStack, framebuffer ) )
+		if( countStateChange( StateCounters::FRAMEBUFFER, setStackState<GLint>( mFramebufferStack, framebuffer ) ) )
 			glBindFramebuffer( target, framebuffer );
 	}
 	else {
@@ -1101,15 +1093,15 @@ void Context::bindFramebuffer( GLenum target, GLuint framebuffer )
 	if( target == GL_FRAMEBUFFER ) {
 		bool readRequiresBind = setStackState<GLint>( mReadFramebufferStack, framebuffer );
 		bool drawRequiresBind = setStackState<GLint>( mDrawFramebufferStack, framebuffer );
-		if( readRequiresBind || drawRequiresBind )
+		if( countStateChange( StateCounters::FRAMEBUFFER, readRequiresBind || drawRequiresBind ) )
 			glBindFramebuffer( GL_FRAMEBUFFER, framebuffer );
 	}
 	else if( target == GL_READ_FRAMEBUFFER ) {
-		if( setStackState<GLint>( mReadFramebufferStack, framebuffer ) )
+		if( countStateChange( StateCounters::FRAMEBUFFER, setStackState<GLint>( mReadFramebufferStack, framebuffer ) ) )
 			glBindFramebuffer( target, framebuffer );
 	}
 	else if( target == GL_DRAW_FRAMEBUFFER ) {
-		if( setStackState<GLint>( mDrawFramebufferStack, framebuffer ) )
+		if( countStateChange( StateCounters::FRAMEBUFFER, setStackState<GLint>( mDrawFramebufferStack, framebuffer ) ) )
 			glBindFramebuffer( target, framebuffer );		
 	}
 	else {
@@ -1138,15 +1130,15 @@ void Context::pushFramebuffer( const FboRef &fbo, GLenum target )
 void Context::pushFramebuffer( GLenum target, GLuint framebuffer )
 {
 #if ! defined( CINDER_GL_HAS_FBO_MULTISAMPLING )
-	if( pushStackState<GLint>( mFramebufferStack, framebuffer ) )
+	if( countStateChange( StateCounters::FRAMEBUFFER, pushStackState<GLint>( mFramebufferStack, framebuffer ) ) )
 		glBindFramebuffer( target, framebuffer );
 #else
 	if( target == GL_FRAMEBUFFER || target == GL_READ_FRAMEBUFFER ) {
-		if( pushStackState<GLint>( mReadFramebufferStack, framebuffer ) )
+		if( countStateChange( StateCounters::FRAMEBUFFER, pushStackState<GLint>( mReadFramebufferStack, framebuffer ) ) )
 			glBindFramebuffer( GL_READ_FRAMEBUFFER, framebuffer );
 	}
 	if( target == GL_FRAMEBUFFER || target == GL_DRAW_FRAMEBUFFER ) {
-		if( pushStackState<GLint>( mDrawFramebufferStack, framebuffer ) )
+		if( countStateChange( StateCounters::FRAMEBUFFER, pushStackState<GLint>( mDrawFramebufferStack, framebuffer ) ) )
 			glBindFramebuffer( GL_DRAW_FRAMEBUFFER, framebuffer );	
 	}
 #endif
@@ -1169,17 +1161,17 @@ void Context::pushFramebuffer( GLenum target )
 void Context::popFramebuffer( GLenum target )
 {
 #if ! defined( CINDER_GL_HAS_FBO_MULTISAMPLING )
-	if( popStackState<GLint>( mFramebufferStack ) )
+	if( countStateChange( StateCounters::FRAMEBUFFER, popStackState<GLint>( mFramebufferStack ) ) )
 		if( ! mFramebufferStack.empty() )
 			glBindFramebuffer( target, mFramebufferStack.back() );
 #else
 	if( target == GL_FRAMEBUFFER || target == GL_READ_FRAMEBUFFER ) {
-		if( popStackState<GLint>( mReadFramebufferStack ) )
+		if( countStateChange( StateCounters::FRAMEBUFFER, popStackState<GLint>( mReadFramebufferStack ) ) )
 			if( ! mReadFramebufferStack.empty() )
 				glBindFramebuffer( target, mReadFramebufferStack.back() );
 	}
 	if( target == GL_FRAMEBUFFER || target == GL_DRAW_FRAMEBUFFER ) {
-		if( popStackState<GLint>( mDrawFramebufferStack ) )
+		if( countStateChange( StateCounters::FRAMEBUFFER, popStackState<GLint>( mDrawFramebufferStack ) ) )
 			if( ! mDrawFramebufferStack.empty() )
 				glBindFramebuffer( target, mDrawFramebufferStack.back() );
 	}
@@ -1241,17 +1233,7 @@ void Context::framebufferDeleted( const Fbo *fbo )
 // States
 void Context::setBoolState( GLenum cap, GLboolean value )
 {
-	bool needsToBeSet = true;
-	auto cached = mBoolStateStack.find( cap );
-	if( ( cached != mBoolStateStack.end() ) && ( ! cached->second.empty() ) && ( cached->second.back() == value ) )
-		needsToBeSet = false;
-	if( cached == mBoolStateStack.end() ) {
-		mBoolStateStack[cap] = vector<GLboolean>();
-		mBoolStateStack[cap].push_back( value );
-	}
-	else
-		mBoolStateStack[cap].back() = value;
-	if( needsToBeSet ) {
+	if( countStateChange( StateCounters::CAPABILITY, setStackState( mBoolStateStack[cap], value ) ) ) {
 		if( value )
 			glEnable( cap );
 		else
@@ -1261,32 +1243,22 @@ void Context::setBoolState( GLenum cap, GLboolean value )
 
 void Context::setBoolState( GLenum cap, GLboolean value, const std::function<void(GLboolean)> &setter )
 {
-	bool needsToBeSet = true;
-	auto cached = mBoolStateStack.find( cap );
-	if( ( cached != mBoolStateStack.end() ) && ( ! cached->second.empty() ) && ( cached->second.back() == value ) )
-		needsToBeSet = false;
-	if( cached == mBoolStateStack.end() ) {
-		mBoolStateStack[cap] = vector<GLboolean>();
-		mBoolStateStack[cap].push_back( value );
-	}
-	else
-		mBoolStateStack[cap].back() = value;
-	if( needsToBeSet )
+	if( countStateChange( StateCounters::CAPABILITY, setStackState( mBoolStateStack[cap], value ) ) )
 		setter( value );
 }
 
 void Context::pushBoolState( GLenum cap, GLboolean value )
 {
+	auto &stack = mBoolStateStack[cap];
 	bool needsToBeSet = true;
-	auto cached = mBoolStateStack.find( cap );
-	if( ( cached != mBoolStateStack.end() ) && ( ! cached->second.empty() ) && ( cached->second.back() == value ) )
+	if( ( ! stack.empty() ) && ( stack.back() == value ) )
 		needsToBeSet = false;
-	else if( cached == mBoolStateStack.end() ) {
-		mBoolStateStack[cap] = vector<GLboolean>();
-		mBoolStateStack[cap].push_back( glIsEnabled( cap ) );
-	}
-	mBoolStateStack[cap].push_back( value );
-	if( needsToBeSet ) {
+	if( needsToBeSet )
+		flushStreamingDraw();
+	if( stack.empty() )
+		stack.push_back( glIsEnabled( cap ) );
+	stack.push_back( value );
+	if( countStateChange( StateCounters::CAPABILITY, needsToBeSet ) ) {
 		if( value )
 			glEnable( cap );
 		else
@@ -1302,13 +1274,14 @@ void Context::pushBoolState( GLenum cap )
 
 void Context::popBoolState( GLenum cap, bool forceRestore )
 {
-	auto cached = mBoolStateStack.find( cap );
-	if( ( cached != mBoolStateStack.end() ) && ( ! cached->second.empty() ) ) {
-		GLboolean prevValue = cached->second.back();
-		cached->second.pop_back();
-		if( ! cached->second.empty() ) {
-			if( forceRestore || ( cached->second.back() != prevValue ) ) {
-				if( cached->second.back() )
+	auto &stack = mBoolStateStack[cap];
+	if( ! stack.empty() ) {
+		GLboolean prevValue = stack.back();
+		stack.pop_back();
+		if( ! stack.empty() ) {
+			if( countStateChange( StateCounters::CAPABILITY, forceRestore || ( stack.back() != prevValue ) ) ) {
+				flushStreamingDraw();
+				if( stack.back() )
 					glEnable( cap );
 				else
 					glDisable( cap );
@@ -1327,18 +1300,16 @@ void Context::enable( GLenum cap, GLboolean value )
 
 GLboolean Context::getBoolState( GLenum cap )
 {
-	auto cached = mBoolStateStack.find( cap );
-	if( ( cached == mBoolStateStack.end() ) || cached->second.empty() ) {
+	auto &stack = mBoolStateStack[cap];
+	if( stack.empty() ) {
 		GLboolean result = glIsEnabled( cap );
-		if( cached == mBoolStateStack.end() )
-			mBoolStateStack[cap] = vector<GLboolean>();
 		// push twice to accommodate later pop
-		mBoolStateStack[cap].push_back( result );
-		mBoolStateStack[cap].push_back( result );
+		stack.push_back( result );
+		stack.push_back( result );
 		return result;
 	}
 	else
-		return cached->second.back();
+		return stack.back();
 }
 
 ///////////////////////////////////////////////////////////////////////////////////////////////////
@@ -1354,7 +1325,7 @@ void Context::blendFuncSeparate( GLenum srcRGB, GLenum dstRGB, GLenum srcAlpha,
 	needsChange = setStackState<GLint>( mBlendDstRgbStack, dstRGB ) || needsChange;
 	needsChange = setStackState<GLint>( mBlendSrcAlphaStack, srcAlpha ) || needsChange;
 	needsChange = setStackState<GLint>( mBlendDstAlphaStack, dstAlpha ) || needsChange;
-	if( needsChange )
+	if( countStateChange( StateCounters::BLEND, needsChange ) )
 		glBlendFuncSeparate( srcRGB, dstRGB, srcAlpha, dstAlpha );
 }
 
@@ -1364,7 +1335,7 @@ void Context::pushBlendFuncSeparate( GLenum srcRGB, GLenum dstRGB, GLenum srcAlp
 	needsChange = pushStackState<GLint>( mBlendDstRgbStack, dstRGB ) || needsChange;
 	needsChange = pushStackState<GLint>( mBlendSrcAlphaStack, srcAlpha ) || needsChange;
 	needsChange = pushStackState<GLint>( mBlendDstAlphaStack, dstAlpha ) || needsChange;
-	if( needsChange )
+	if( countStateChange( StateCounters::BLEND, needsChange ) )
 		glBlendFuncSeparate( srcRGB, dstRGB, srcAlpha, dstAlpha );
 }
 
@@ -1386,7 +1357,7 @@ void Context::popBlendFuncSeparate( bool forceRestore )
 	needsChange = popStackState<GLint>( mBlendSrcAlphaStack ) || needsChange;
 	needsChange = popStackState<GLint>( mBlendDstAlphaStack ) || needsChange;
 	needsChange = forceRestore || needsChange;
-	if( needsChange && ( ! mBlendSrcRgbStack.empty() ) && ( ! mBlendSrcAlphaStack.empty() ) && ( ! mBlendDstRgbStack.empty() ) && ( ! mBlendDstAlphaStack.empty() ) )
+	if( countStateChange( StateCounters::BLEND, needsChange ) && ( ! mBlendSrcRgbStack.empty() ) && ( ! mBlendSrcAlphaStack.empty() ) && ( ! mBlendDstRgbStack.empty() ) && ( ! mBlendDstAlphaStack.empty() ) )
 		glBlendFuncSeparate( mBlendSrcRgbStack.back(), mBlendDstRgbStack.back(), mBlendSrcAlphaStack.back(), mBlendDstAlphaStack.back() );
 }
 
@@ -1421,13 +1392,13 @@ void Context::getBlendFuncSeparate( GLenum *resultSrcRGB, GLenum *resultDstRGB,
 // LineWidth
 void Context::lineWidth( float lineWidth )
 {
-	if( setStackState<float>( mLineWidthStack, lineWidth ) )
+	if( countStateChange( StateCounters::RASTER, setStackState<float>( mLineWidthStack, lineWidth ) ) )
 		glLineWidth( lineWidth );
 }
 
 void Context::pushLineWidth( float lineWidth )
 {
-	if( pushStackState<float>( mLineWidthStack, lineWidth ) )
+	if( countStateChange( StateCounters::RASTER, pushStackState<float>( mLineWidthStack, lineWidth ) ) )
 		glLineWidth( lineWidth );
 }
 
@@ -1440,7 +1411,7 @@ void Context::popLineWidth( bool forceRestore )
 {
 	if( mLineWidthStack.empty() )
 		CI_LOG_E( "LineWidth stack underflow" );
-	else if( popStackState<float>( mLineWidthStack ) || forceRestore )
+	else if( countStateChange( StateCounters::RASTER, popStackState<float>( mLineWidthStack ) || forceRestore ) )
 		glLineWidth( getLineWidth() );
 }
 
@@ -1461,14 +1432,14 @@ float Context::getLineWidth()
 // DepthMask
 void Context::depthMask( GLboolean enable )
 {
-	if( setStackState( mDepthMaskStack, enable ) ) {
+	if( countStateChange( StateCounters::DEPTH, setStackState( mDepthMaskStack, enable ) ) ) {
 		glDepthMask( enable );
 	}
 }
 
 void Context::pushDepthMask( GLboolean enable )
 {
-	if( pushStackState( mDepthMaskStack, enable ) ) {
+	if( countStateChange( StateCounters::DEPTH, pushStackState( mDepthMaskStack, enable ) ) ) {
 		glDepthMask( enable );
 	}
 }
@@ -1482,7 +1453,7 @@ void Context::popDepthMask( bool forceRestore )
 {
 	if( mDepthMaskStack.empty() )
 		CI_LOG_E( "Depth mask stack underflow" );
-	else if( popStackState( mDepthMaskStack ) || forceRestore )
+	else if( countStateChange( StateCounters::DEPTH, popStackState( mDepthMaskStack ) || forceRestore ) )
 		glDepthMask( getDepthMask() );
 }
 
@@ -1505,7 +1476,7 @@ void Context::depthFunc( GLenum func )
 	if( func != GL_NEVER && func != GL_LESS && func != GL_EQUAL && func != GL_LEQUAL && func != GL_GREATER && func != GL_NOTEQUAL && func != GL_GEQUAL && func != GL_ALWAYS )
 		CI_LOG_E( "Wrong enum for the depth buffer comparison function" );
 	
-	if( setStackState( mDepthFuncStack, func ) ) {
+	if( countStateChange( StateCounters::DEPTH, setStackState( mDepthFuncStack, func ) ) ) {
 		glDepthFunc( func );
 	}
 }
@@ -1515,7 +1486,7 @@ void Context::pushDepthFunc( GLenum func )
 	if( func != GL_NEVER && func != GL_LESS && func != GL_EQUAL && func != GL_LEQUAL && func != GL_GREATER && func != GL_NOTEQUAL && func != GL_GEQUAL && func != GL_ALWAYS )
 		CI_LOG_E( "Wrong enum for the depth buffer comparison function" );
 	
-	if( pushStackState( mDepthFuncStack, func ) ) {
+	if( countStateChange( StateCounters::DEPTH, pushStackState( mDepthFuncStack, func ) ) ) {
 		glDepthFunc( func );
 	}
 }
@@ -1529,7 +1500,7 @@ void Context::popDepthFunc( bool forceRestore )
 {
 	if( mDepthFuncStack.empty() )
 		CI_LOG_E( "Depth function stack underflow" );
-	else if( popStackState( mDepthFuncStack ) || forceRestore )
+	else if( countStateChange( StateCounters::DEPTH, popStackState( mDepthFuncStack ) || forceRestore ) )
 		glDepthFunc( getDepthFunc() );
 }
 
@@ -1553,7 +1524,7 @@ void Context::polygonMode( GLenum face, GLenum mode )
 	if( face != GL_FRONT_AND_BACK )
 		CI_LOG_E( "Only GL_FRONT_AND_BACK is legal for polygonMode face" );
 
-	if( setStackState( mPolygonModeStack, mode ) )
+	if( countStateChange( StateCounters::RASTER, setStackState( mPolygonModeStack, mode ) ) )
 		glPolygonMode( GL_FRONT_AND_BACK, mode );
 }
 
@@ -1562,7 +1533,7 @@ void Context::pushPolygonMode( GLenum face, GLenum mode )
 	if( face != GL_FRONT_AND_BACK )
 		CI_LOG_E( "Only GL_FRONT_AND_BACK is legal for polygonMode face" );
 
-	if( pushStackState( mPolygonModeStack, mode ) )
+	if( countStateChange( StateCounters::RASTER, pushStackState( mPolygonModeStack, mode ) ) )
 		glPolygonMode( GL_FRONT_AND_BACK, mode );
 }
 
@@ -1581,7 +1552,7 @@ void Context::popPolygonMode( GLenum face, bool forceRefresh )
 
 	if( mPolygonModeStack.empty() )
 		CI_LOG_E( "Polygon mode stack underflow" );
-	else if( popStackState( mPolygonModeStack ) || forceRefresh )
+	else if( countStateChange( StateCounters::RASTER, popStackState( mPolygonModeStack ) || forceRefresh ) )
 		glPolygonMode( GL_FRONT_AND_BACK, getPolygonMode( GL_FRONT_AND_BACK ) );
 }
 
@@ -1601,48 +1572,90 @@ GLenum Context::getPolygonMode( GLenum face )
 
 #endif // ! defined( CINDER_GL_ES )
 
+//////////////////////////////////////////////////////////////////////////////////////////
+// StateCounters
+uint32_t StateCounters::getNumIssued() const
+{
+	uint32_t result = 0;
+	for( auto count : mIssued )
+		result += count;
+	return result;
+}
+
+uint32_t StateCounters::getNumElided() const
+{
+	uint32_t result = 0;
+	for( auto count : mElided )
+		result += count;
+	return result;
+}
+
+const char* StateCounters::getCategoryName( Category category )
+{
+	switch( category ) {
+		case BUFFER:		return "buffer";
+		case RENDERBUFFER:	return "renderbuffer";
+		case FRAMEBUFFER:	return "framebuffer";
+		case VAO:			return "vao";
+		case GLSL_PROG:		return "glsl prog";
+		case TEXTURE:		return "texture";
+		case SAMPLER:		return "sampler";
+		case CAPABILITY:	return "capability";
+		case BLEND:			return "blend";
+		case DEPTH:			return "depth";
+		case VIEWPORT:		return "viewport";
+		case RASTER:		return "raster";
+		default:			return "unknown";
+	}
+}
+
 //////////////////////////////////////////////////////////////////////////////////////////
 // Templated stack management routines
-template<typename T>
-bool Context::pushStackState( std::vector<T> &stack, T value )
+template<typename T, size_t N>
+bool Context::pushStackState( StateStack<T,N> &stack, T value )
 {
 	bool needsToBeSet = true;
 	if( ( ! stack.empty() ) && ( stack.back() == value ) )
 		needsToBeSet = false;
+	if( needsToBeSet )
+		flushStreamingDraw();
 	stack.push_back( value );
 	return needsToBeSet;
 }
 
-template<typename T>
-bool Context::popStackState( std::vector<T> &stack )
+template<typename T, size_t N>
+bool Context::popStackState( StateStack<T,N> &stack )
 {
 	if( ! stack.empty() ) {
 		T prevValue = stack.back();
 		stack.pop_back();
-		if( ! stack.empty() )
-			return stack.back() != prevValue;
-		else
-			return true;
+		if( ( ! stack.empty() ) && ( stack.back() == prevValue ) )
+			return false;
 	}
-	else
-		return true;
+
+	flushStreamingDraw();
+	return true;
 }
 
-template<typename T>
-bool Context::setStackState( std::vector<T> &stack, T value )
+template<typename T, size_t N>
+bool Context::setStackState( StateStack<T,N> &stack, T value )
 {
 	bool needsToBeSet = true;
 	if( ( ! stack.empty() ) && ( stack.back() == value ) )
 		needsToBeSet = false;
-	else if( stack.empty() )
+	else if( stack.empty() ) {
+		flushStreamingDraw();
 		stack.push_back( value );
-	else
+	}
+	else {
+		flushStreamingDraw();
 		stack.back() = value;
+	}
 	return needsToBeSet;
 }
 
-template<typename T>
-bool Context::getStackState( std::vector<T> &stack, T *result )
+template<typename T, size_t N>
+bool Context::getStackState( StateStack<T,N> &stack, T *result )
 {
 	if( stack.empty() )
 		return false;
@@ -1824,11 +1837,13 @@ void Context::vertexAttrib4f( GLuint index, float v0, float v1, float v2, float
 // draw*
 void Context::drawArrays( GLenum mode, GLint first, GLsizei count )
 {
+	flushStreamingDraw();
 	glDrawArrays( mode, first, count );
 }
 
 void Context::drawElements( GLenum mode, GLsizei count, GLenum type, const GLvoid *indices )
 {
+	flushStreamingDraw();
 	glDrawElements( mode, count, type, indices );
 }
 
@@ -1836,11 +1851,13 @@ void Context::drawElements( GLenum mode, GLsizei count, GLenum type, const GLvoi
 
 void Context::multiDrawArrays( GLenum mode, GLint *first, GLsizei *count, GLsizei primcount )
 {
+	flushStreamingDraw();
 	glMultiDrawArrays( mode, first, count, primcount );
 }
 
 void Context::multiDrawElements( GLenum mode, GLsizei *count, GLenum type, const GLvoid * const *indices, GLsizei primcount )
 {
+	flushStreamingDraw();
 	glMultiDrawElements( mode, count, type, indices, primcount );
 }
 
@@ -1850,6 +1867,7 @@ void Context::multiDrawElements( GLenum mode, GLsizei *count, GLenum type, const
 
 void Context::drawArraysInstanced( GLenum mode, GLint first, GLsizei count, GLsizei primcount )
 {
+	flushStreamingDraw();
 #if defined( CINDER_GL_ANGLE )
 	glDrawArraysInstancedANGLE( mode, first, count, primcount );
 #elif defined( CINDER_GL_ES_2 ) && defined( CINDER_COCOA_TOUCH )
@@ -1861,6 +1879,7 @@ void Context::drawArraysInstanced( GLenum mode, GLint first, GLsizei count, GLsi
 
 void Context::drawElementsInstanced( GLenum mode, GLsizei count, GLenum type, const GLvoid *indices, GLsizei primcount )
 {
+	flushStreamingDraw();
 #if defined( CINDER_GL_ANGLE )
 	glDrawElementsInstancedANGLE( mode, count, type, indices, primcount );
 #elif defined( CINDER_GL_ES_2 ) && defined( CINDER_COCOA_TOUCH )
@@ -1876,11 +1895,13 @@ void Context::drawElementsInstanced( GLenum mode, GLsizei count, GLenum type, co
 
 void Context::drawArraysIndirect( GLenum mode, const GLvoid *indirect )
 {
+	flushStreamingDraw();
 	glDrawArraysIndirect( mode, indirect );
 }
 
 void Context::drawElementsIndirect( GLenum mode, GLenum type, const GLvoid *indirect )
 {
+	flushStreamingDraw();
 	glDrawElementsIndirect( mode, type, indirect );
 }
 
@@ -1890,11 +1911,13 @@ void Context::drawElementsIndirect( GLenum mode, GLenum type, const GLvoid *indi
 
 void Context::multiDrawArraysIndirect( GLenum mode, const GLvoid *indirect, GLsizei drawcount, GLsizei stride )
 {
+	flushStreamingDraw();
 	glMultiDrawArraysIndirect( mode, indirect, drawcount, stride );
 }
 
 void Context::multiDrawElementsIndirect( GLenum mode, GLenum type, const GLvoid *indirect, GLsizei drawcount, GLsizei stride )
 {
+	flushStreamingDraw();
 	glMultiDrawElementsIndirect( mode, type, indirect, drawcount, stride );
 }
 
@@ -2123,6 +2146,115 @@ VboRef Context::getDefaultElementVbo( size_t requiredSize )
 	return mDefaultElementVbo;
 }
 
+///////////////////////////////////////////////////////////////////////////////////////////
+// Streaming draw
+namespace {
+
+// a full batch fills one segment of the ring; larger single draws grow it
+const size_t sMaxStreamingDrawVertices = 16384;
+const size_t sNumStreamingDrawSegments = 3;
+
+} // anonymous namespace
+
+void Context::enableStreamingDraw( bool enable )
+{
+	if( ! enable )
+		flushStreamingDraw();
+
+	mStreamingDrawEnabled = enable;
+}
+
+void Context::streamingDraw( GLenum mode, const vec3 *positions, size_t numVertices, const vec3 *normals, const vec2 *texCoords, const ColorAf *colors )
+{
+	const GlslProg *glslProg = getGlslProg();
+	const mat4 &viewMatrix = mViewMatrixStack.back();
+	const mat4 &projectionMatrix = mProjectionMatrixStack.back();
+
+	if( ! mStreamingDrawVertices.empty() ) {
+		if( ( glslProg != mStreamingDrawGlslProg ) || ( mode != mStreamingDrawMode ) || ( viewMatrix != mStreamingDrawViewMatrix )
+			|| ( projectionMatrix != mStreamingDrawProjectionMatrix ) || ( mStreamingDrawVertices.size() + numVertices > sMaxStreamingDrawVertices ) )
+			flushStreamingDraw();
+	}
+
+	if( mStreamingDrawVertices.empty() ) {
+		mStreamingDrawGlslProg = glslProg;
+		glslProg->mStreamingDrawContext = this;
+		mStreamingDrawMode = mode;
+		mStreamingDrawViewMatrix = viewMatrix;
+		mStreamingDrawProjectionMatrix = projectionMatrix;
+	}
+
+	const mat4 &modelMatrix = mModelMatrixStack.back();
+	const mat3 normalMatrix = normals ? glm::transpose( glm::inverse( mat3( modelMatrix ) ) ) : mat3();
+
+	const size_t first = mStreamingDrawVertices.size();
+	mStreamingDrawVertices.resize( first + numVertices );
+	StreamingDrawVertex *vertex = mStreamingDrawVertices.data() + first;
+	for( size_t i = 0; i < numVertices; ++i, ++vertex ) {
+		vertex->position = modelMatrix * vec4( positions[i], 1 );
+		vertex->normal = normals ? normalMatrix * normals[i] : vec3( 0 );
+		vertex->texCoord = texCoords ? texCoords[i] : vec2( 0 );
+		vertex->color = colors ? colors[i] : mColor;
+	}
+}
+
+void Context::flushStreamingDrawImpl()
+{
+	static_assert( sizeof(StreamingDrawVertex) == 13 * sizeof(float), "StreamingDrawVertex must be tightly packed" );
+
+	const GlslProg *glslProg = mStreamingDrawGlslProg;
+	const GLsizei count = (GLsizei)mStreamingDrawVertices.size();
+
+	if( ! mStreamingDrawBuffer )
+		mStreamingDrawBuffer = StreamingBuffer::create( GL_ARRAY_BUFFER, sNumStreamingDrawSegments * sMaxStreamingDrawVertices * sizeof(StreamingDrawVertex), sNumStreamingDrawSegments );
+	const GLintptr offset = mStreamingDrawBuffer->write( mStreamingDrawVertices.data(), count * sizeof(StreamingDrawVertex), sizeof(StreamingDrawVertex) );
+
+	// empty the batch before touching any state, which would otherwise flush recursively
+	mStreamingDrawVertices.clear();
+	mStreamingDrawGlslProg = nullptr;
+	glslProg->mStreamingDrawContext = nullptr;
+
+	if( ! mStreamingDrawVao )
+		mStreamingDrawVao = Vao::create();
+	pushVao( mStreamingDrawVao );
+	pushGlslProg( glslProg );
+
+	const std::array<int,4> locations = { glslProg->getAttribSemanticLocation( geom::Attrib::POSITION ), glslProg->getAttribSemanticLocation( geom::Attrib::NORMAL ),
+										glslProg->getAttribSemanticLocation( geom::Attrib::TEX_COORD_0 ), glslProg->getAttribSemanticLocation( geom::Attrib::COLOR ) };
+	const GLuint bufferId = mStreamingDrawBuffer->getBuffer()->getId();
+	if( ( locations != mStreamingDrawVaoLocations ) || ( bufferId != mStreamingDrawVaoBufferId ) ) {
+		ScopedBuffer bufferBindScp( mStreamingDrawBuffer->getBuffer() );
+		for( int loc : mStreamingDrawVaoLocations ) {
+			if( loc >= 0 )
+				disableVertexAttribArray( loc );
+		}
+		const GLint dims[4] = { 4, 3, 2, 4 };
+		const size_t offsets[4] = { 0, sizeof(vec4), sizeof(vec4) + sizeof(vec3), sizeof(vec4) + sizeof(vec3) + sizeof(vec2) };
+		for( size_t i = 0; i < locations.size(); ++i ) {
+			if( locations[i] >= 0 ) {
+				enableVertexAttribArray( locations[i] );
+				vertexAttribPointer( locations[i], dims[i], GL_FLOAT, GL_FALSE, sizeof(StreamingDrawVertex), (const GLvoid*)offsets[i] );
+			}
+		}
+		mStreamingDrawVaoLocations = locations;
+		mStreamingDrawVaoBufferId = bufferId;
+	}
+
+	// vertices have already been transformed by their model matrices
+	const mat4 modelMatrix = mModelMatrixStack.back(), viewMatrix = mViewMatrixStack.back(), projectionMatrix = mProjectionMatrixStack.back();
+	mModelMatrixStack.back() = mat4();
+	mViewMatrixStack.back() = mStreamingDrawViewMatrix;
+	mProjectionMatrixStack.back() = mStreamingDrawProjectionMatrix;
+	setDefaultShaderVars();
+	drawArrays( mStreamingDrawMode, GLint( offset / sizeof(StreamingDrawVertex) ), count );
+	mModelMatrixStack.back() = modelMatrix;
+	mViewMatrixStack.back() = viewMatrix;
+	mProjectionMatrixStack.back() = projectionMatrix;
+
+	popGlslProg();
+	popVao();
+}
+
 ///////////////////////////////////////////////////////////////////////////////////////////
 #if defined( CINDER_GL_HAS_DEBUG_OUTPUT )
 namespace {
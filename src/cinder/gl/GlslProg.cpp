@@ -26,13 +26,17 @@
 #include "cinder/gl/Context.h"
 #include "cinder/gl/ConstantConversions.h"
 #include "cinder/gl/Environment.h"
+#include "cinder/gl/ProgramBinaryCache.h"
 #include "cinder/gl/scoped.h"
 #include "cinder/Log.h"
 #include "cinder/Noncopyable.h"
+#include "cinder/Timer.h"
 #include "cinder/Utilities.h"
 
 #include "glm/gtc/type_ptr.hpp"
 
+#include <iomanip>
+#include <limits>
 #include <type_traits>
 
 // For stoi and std:;to_string
@@ -98,6 +102,190 @@ class UniformValueCache : cinder::Noncopyable {
 	std::unique_ptr<bool[]>			mValidBytes;
 	uint32_t						mBufferSize;
 };
+
+// Maps names to active uniforms with a flat open-addressing hash table, built once after linking so that findUniform()
+// neither scans mUniforms nor allocates. Besides exact names, array uniforms are indexed by their base name ("lights"),
+// and uniforms inside arrays of structs by their base name plus everything from the first ']' ("lights" + "].color").
+// Only the first active uniform is kept for each of these, matching the order the previous linear search resolved in.
+class UniformNameIndex : cinder::Noncopyable {
+  public:
+	enum Kind : uint32_t { EXACT, BASE, BASE_MEMBER };
+
+	UniformNameIndex( const std::vector<GlslProg::Uniform> &uniforms )
+		: mUniforms( uniforms )
+	{
+		// each uniform adds at most three entries; keep the load factor at or below one half
+		size_t capacity = 16;
+		while( capacity < uniforms.size() * 6 )
+			capacity *= 2;
+		mEntries.resize( capacity );
+		mMask = capacity - 1;
+
+		for( uint32_t i = 0; i < (uint32_t)uniforms.size(); ++i ) {
+			const string &name = uniforms[i].getName();
+			insert( EXACT, i, name.data(), name.size(), nullptr, 0 );
+
+			size_t leftBracket = name.find( '[' );
+			if( leftBracket == string::npos )
+				continue;
+			insert( BASE, i, name.data(), leftBracket, nullptr, 0 );
+			size_t rightBracket = name.find( ']' );
+			if( rightBracket != string::npos && rightBracket + 1 < name.size() )
+				insert( BASE_MEMBER, i, name.data(), leftBracket, name.data() + rightBracket, name.size() - rightBracket );
+		}
+	}
+
+	const GlslProg::Uniform* find( Kind kind, const char *base, size_t baseLength, const char *member = nullptr, size_t memberLength = 0 ) const
+	{
+		uint32_t hash = hashKey( kind, base, baseLength, member, memberLength );
+		for( size_t slot = hash & mMask; mEntries[slot].mUniformIndex != EMPTY; slot = ( slot + 1 ) & mMask ) {
+			const Entry &entry = mEntries[slot];
+			if( entry.mHash == hash && entry.mKind == kind && keyEquals( entry.mUniformIndex, kind, base, baseLength, member, memberLength ) )
+				return &mUniforms[entry.mUniformIndex];
+		}
+
+		return nullptr;
+	}
+
+  private:
+	static const uint32_t EMPTY = 0xFFFFFFFF;
+
+	struct Entry {
+		Entry() : mHash( 0 ), mUniformIndex( EMPTY ), mKind( EXACT ) {}
+
+		uint32_t	mHash;
+		uint32_t	mUniformIndex;
+		Kind		mKind;
+	};
+
+	// FNV-1a over the base and member, seeded by the kind so that "example" as an exact and as a base name don't collide
+	static uint32_t hashKey( Kind kind, const char *base, size_t baseLength, const char *member, size_t memberLength )
+	{
+		uint32_t hash = 2166136261u ^ ( (uint32_t)kind * 0x9E3779B9u );
+		for( size_t c = 0; c < baseLength; ++c )
+			hash = ( hash ^ (uint8_t)base[c] ) * 16777619u;
+		for( size_t c = 0; c < memberLength; ++c )
+			hash = ( hash ^ (uint8_t)member[c] ) * 16777619u;
+		return hash;
+	}
+
+	bool keyEquals( uint32_t uniformIndex, Kind kind, const char *base, size_t baseLength, const char *member, size_t memberLength ) const
+	{
+		const string &name = mUniforms[uniformIndex].getName();
+		if( kind == EXACT )
+			return name.size() == baseLength && memcmp( name.data(), base, baseLength ) == 0;
+
+		size_t leftBracket = name.find( '[' );
+		if( leftBracket != baseLength || memcmp( name.data(), base, baseLength ) != 0 )
+			return false;
+		if( kind == BASE )
+			return true;
+
+		size_t rightBracket = name.find( ']' );
+		return name.size() - rightBracket == memberLength && memcmp( name.data() + rightBracket, member, memberLength ) == 0;
+	}
+
+	void insert( Kind kind, uint32_t uniformIndex, const char *base, size_t baseLength, const char *member, size_t memberLength )
+	{
+		uint32_t hash = hashKey( kind, base, baseLength, member, memberLength );
+		size_t slot = hash & mMask;
+		for( ; mEntries[slot].mUniformIndex != EMPTY; slot = ( slot + 1 ) & mMask ) {
+			const Entry &entry = mEntries[slot];
+			// an earlier uniform already answers this key
+			if( entry.mHash == hash && entry.mKind == kind && keyEquals( entry.mUniformIndex, kind, base, baseLength, member, memberLength ) )
+				return;
+		}
+
+		mEntries[slot].mHash = hash;
+		mEntries[slot].mUniformIndex = uniformIndex;
+		mEntries[slot].mKind = kind;
+	}
+
+	const std::vector<GlslProg::Uniform>	&mUniforms;
+	std::vector<Entry>						mEntries;
+	size_t									mMask;
+};
+
+namespace {
+
+// Parses the array index between \a begin and \a end the way std::stoi() did before: leading whitespace, an optional sign
+// and at least one digit, ignoring anything after the digits. Returns false for a non-number or an out of range value.
+bool parseUniformArrayIndex( const char *begin, const char *end, int *result )
+{
+	while( begin < end && isspace( (unsigned char)*begin ) )
+		++begin;
+
+	bool negative = false;
+	if( begin < end && ( *begin == '-' || *begin == '+' ) )
+		negative = *begin++ == '-';
+	if( begin == end || ! isdigit( (unsigned char)*begin ) )
+		return false;
+
+	int64_t value = 0;
+	for( ; begin < end && isdigit( (unsigned char)*begin ); ++begin ) {
+		value = value * 10 + ( *begin - '0' );
+		if( value > (int64_t)std::numeric_limits<int>::max() + 1 )
+			return false;
+	}
+	if( negative )
+		value = -value;
+	if( value > std::numeric_limits<int>::max() )
+		return false;
+
+	*result = (int)value;
+	return true;
+}
+
+struct ShaderStage {
+	GLint				mType;
+	const std::string	*mSource;
+	std::string			mPreprocessedSource;
+	GLuint				mHandle;
+};
+
+// Everything that ends up in the linked executable: the expanded sources (which include the ShaderPreprocessor's defines and
+// version, also hashed on their own), the locations bound before linking, and the driver that would produce the binary.
+uint64_t calcProgramBinaryKey( const GlslProg::Format &format, const vector<ShaderStage> &stages )
+{
+	uint64_t key = ProgramBinaryCache::hash( nullptr, 0 );
+	for( const auto &stage : stages ) {
+		key = ProgramBinaryCache::hash( &stage.mType, sizeof( stage.mType ), key );
+		key = ProgramBinaryCache::hash( stage.mPreprocessedSource, key );
+	}
+
+	if( format.getPreprocessor() ) {
+		for( const auto &define : format.getPreprocessor()->getDefines() ) {
+			key = ProgramBinaryCache::hash( define.first, key );
+			key = ProgramBinaryCache::hash( define.second, key );
+		}
+		int version = format.getPreprocessor()->getVersion();
+		key = ProgramBinaryCache::hash( &version, sizeof( version ), key );
+	}
+
+	for( const auto &attrib : format.getAttributes() ) {
+		GLint loc = attrib.getLocation();
+		geom::Attrib semantic = attrib.getSemantic();
+		key = ProgramBinaryCache::hash( attrib.getName(), key );
+		key = ProgramBinaryCache::hash( &loc, sizeof( loc ), key );
+		key = ProgramBinaryCache::hash( &semantic, sizeof( semantic ), key );
+	}
+#if ! defined( CINDER_GL_ES )
+	for( const auto &fragDataLocation : format.getFragDataLocations() ) {
+		key = ProgramBinaryCache::hash( fragDataLocation.first, key );
+		key = ProgramBinaryCache::hash( &fragDataLocation.second, sizeof( fragDataLocation.second ), key );
+	}
+#endif
+#if defined( CINDER_GL_HAS_TRANSFORM_FEEDBACK )
+	for( const auto &varying : format.getVaryings() )
+		key = ProgramBinaryCache::hash( varying, key );
+	GLenum transformFormat = format.getTransformFormat();
+	key = ProgramBinaryCache::hash( &transformFormat, sizeof( transformFormat ), key );
+#endif
+
+	return ProgramBinaryCache::hashDriver( key );
+}
+
+} // anonymous namespace
 	
 //////////////////////////////////////////////////////////////////////////
 // GlslProg::Attribute
@@ -472,6 +660,9 @@ GlslProgRef GlslProg::create( const string &vertexShader, const string &fragment
 	
 GlslProg::~GlslProg()
 {
+	if( mStreamingDrawContext )
+		mStreamingDrawContext->flushStreamingDraw();
+
 	auto ctx = gl::context();
 	if( ctx )
 		ctx->glslProgDeleted( this );
@@ -485,26 +676,41 @@ GlslProg::~GlslProg()
 // GlslProg
 
 GlslProg::GlslProg( const Format &format )
-	: mUniformValueCache( nullptr )
+	: mUniformValueCache( nullptr ), mStreamingDrawContext( nullptr )
 #if defined( CINDER_GL_HAS_TRANSFORM_FEEDBACK )
 		, mTransformFeedbackFormat( -1 )
 #endif
 {
 	mHandle = glCreateProgram();
 
-	GLuint vertexHandle = loadShader( format.getVertex(), format.mVertexShaderPath, GL_VERTEX_SHADER, format.getPreprocessor() );
-	GLuint fragmentHandle = loadShader( format.getFragment(), format.mFragmentShaderPath, GL_FRAGMENT_SHADER, format.getPreprocessor() );
+	auto binaryCache = ProgramBinaryCache::get();
+	const bool binaryCacheEnabled = binaryCache->isEnabled();
+	ProgramBinaryCache::ProgramTiming timing = {};
+	Timer timer( true );
+
+	// every stage is expanded up front, since the preprocessed sources are part of the program binary cache key
+	vector<ShaderStage> stages;
+	auto addStage = [&]( GLint type, const std::string &source, const fs::path &path ) {
+		if( ! source.empty() )
+			stages.push_back( { type, &source, preprocessShader( source, path, format.getPreprocessor() ), 0 } );
+	};
+	addStage( GL_VERTEX_SHADER, format.getVertex(), format.mVertexShaderPath );
+	addStage( GL_FRAGMENT_SHADER, format.getFragment(), format.mFragmentShaderPath );
 #if defined( CINDER_GL_HAS_GEOM_SHADER )
-	GLuint geometryHandle = loadShader( format.getGeometry(), format.mGeometryShaderPath, GL_GEOMETRY_SHADER, format.getPreprocessor() );
+	addStage( GL_GEOMETRY_SHADER, format.getGeometry(), format.mGeometryShaderPath );
 #endif
 #if defined( CINDER_GL_HAS_TESS_SHADER )
-	GLuint tessellationCtrlHandle = loadShader( format.getTessellationCtrl(), format.mTessellationCtrlShaderPath, GL_TESS_CONTROL_SHADER, format.getPreprocessor() );
-	GLuint tessellationEvalHandle = loadShader( format.getTessellationEval(), format.mTessellationEvalShaderPath, GL_TESS_EVALUATION_SHADER, format.getPreprocessor() );
+	addStage( GL_TESS_CONTROL_SHADER, format.getTessellationCtrl(), format.mTessellationCtrlShaderPath );
+	addStage( GL_TESS_EVALUATION_SHADER, format.getTessellationEval(), format.mTessellationEvalShaderPath );
 #endif
 #if defined( CINDER_GL_HAS_COMPUTE_SHADER )
-	GLuint computeHandle = loadShader( format.getCompute(), format.mComputeShaderPath, GL_COMPUTE_SHADER, format.getPreprocessor() );
+	addStage( GL_COMPUTE_SHADER, format.getCompute(), format.mComputeShaderPath );
 #endif
 
+	if( binaryCacheEnabled )
+		timing.mKey = calcProgramBinaryKey( format, stages );
+	timing.mPreprocessSeconds = timer.getSeconds();
+
 	auto &userDefinedAttribs = format.getAttributes();
 	
 	bool foundPositionSemantic = false;
@@ -564,28 +770,40 @@ GlslProg::GlslProg( const Format &format )
 		glBindFragDataLocation( mHandle, fragDataLocation.second, fragDataLocation.first.c_str() );
 #endif
 
-	link();
+	bool loadedFromCache = false;
+	if( binaryCacheEnabled ) {
+		timer.start();
+		loadedFromCache = binaryCache->load( mHandle, timing.mKey );
+		timing.mLoadSeconds = timer.getSeconds();
+	}
 
-	// Detach all shaders, allowing GL to free the associated memory
-	if( vertexHandle )
-		glDetachShader( mHandle, vertexHandle );
-	if( fragmentHandle )
-		glDetachShader( mHandle, fragmentHandle );
-#if defined( CINDER_GL_HAS_GEOM_SHADER )
-	if( geometryHandle )
-		glDetachShader( mHandle, geometryHandle );
-#endif
-#if defined( CINDER_GL_HAS_TESS_SHADER )
-	if( tessellationCtrlHandle )
-		glDetachShader( mHandle, tessellationCtrlHandle );
-	if( tessellationEvalHandle )
-		glDetachShader( mHandle, tessellationEvalHandle );
-#endif
-#if defined( CINDER_GL_HAS_COMPUTE_SHADER )
-	if( computeHandle )
-		glDetachShader( mHandle, computeHandle );	
+	if( ! loadedFromCache ) {
+		timer.start();
+		for( auto &stage : stages )
+			stage.mHandle = loadShader( stage.mPreprocessedSource, *stage.mSource, stage.mType );
+		timing.mCompileSeconds = timer.getSeconds();
+
+#if ! defined( CINDER_GL_ES_2 )
+		if( binaryCacheEnabled )
+			glProgramParameteri( mHandle, GL_PROGRAM_BINARY_RETRIEVABLE_HINT, GL_TRUE );
 #endif
-	
+		timer.start();
+		link();
+		timing.mLinkSeconds = timer.getSeconds();
+
+		// Detach all shaders, allowing GL to free the associated memory
+		for( const auto &stage : stages ) {
+			if( stage.mHandle )
+				glDetachShader( mHandle, stage.mHandle );
+		}
+
+		if( binaryCacheEnabled ) {
+			timer.start();
+			binaryCache->save( mHandle, timing.mKey );
+			timing.mSaveSeconds = timer.getSeconds();
+		}
+	}
+
 	cacheActiveAttribs();
 	cacheActiveUniforms();
 #if defined( CINDER_GL_HAS_TRANSFORM_FEEDBACK )
@@ -641,6 +859,24 @@ GlslProg::GlslProg( const Format &format )
     
 	setLabel( format.getLabel() );
 	gl::context()->glslProgCreated( this );
+
+	if( binaryCache->isTimingEnabled() ) {
+		timing.mLoadedFromCache = loadedFromCache;
+		if( ! mLabel.empty() )
+			timing.mName = mLabel;
+		else if( ! format.mVertexShaderPath.empty() )
+			timing.mName = format.mVertexShaderPath.filename().string();
+		else {
+			// the key as it appears in the binary's file name
+			stringstream ss;
+			if( timing.mKey )
+				ss << hex << setw( 16 ) << setfill( '0' ) << timing.mKey;
+			else
+				ss << "program " << mHandle;
+			timing.mName = ss.str();
+		}
+		binaryCache->addTiming( timing );
+	}
 }
 
 GlslProg::UniformSemanticMap& GlslProg::getDefaultUniformNameToSemanticMap()
@@ -691,25 +927,26 @@ GlslProg::AttribSemanticMap& GlslProg::getDefaultAttribNameToSemanticMap()
 	return sDefaultAttribNameToSemanticMap;
 }
 
-GLuint GlslProg::loadShader( const string &shaderSource, const fs::path &shaderPath, GLint shaderType, const ShaderPreprocessorRef &preprocessor )
+std::string GlslProg::preprocessShader( const std::string &shaderSource, const fs::path &shaderPath, const ShaderPreprocessorRef &preprocessor )
+{
+	if( ! preprocessor )
+		return shaderSource;
+
+	set<fs::path> includedFiles;
+	string preprocessedSource = preprocessor->parse( shaderSource, shaderPath, &includedFiles );
+	mShaderPreprocessorIncludedFiles.insert( mShaderPreprocessorIncludedFiles.end(), includedFiles.begin(), includedFiles.end() );
+	return preprocessedSource;
+}
+
+GLuint GlslProg::loadShader( const std::string &preprocessedSource, const std::string &shaderSource, GLint shaderType )
 {
 	GLuint handle = 0;
 
-	if( ! shaderSource.empty() ) {
+	if( ! preprocessedSource.empty() ) {
 		handle = glCreateShader( shaderType );
 
-		if( preprocessor ) {
-			set<fs::path> includedFiles;
-			string preprocessedSource = preprocessor->parse( shaderSource, shaderPath, &includedFiles );
-			mShaderPreprocessorIncludedFiles.insert( mShaderPreprocessorIncludedFiles.end(), includedFiles.begin(), includedFiles.end() );
-
-			const char *cStr = preprocessedSource.c_str();
-			glShaderSource( handle, 1, reinterpret_cast<const GLchar**>( &cStr ), NULL );
-		}
-		else {
-			const char *cStr = shaderSource.c_str();
-			glShaderSource( handle, 1, reinterpret_cast<const GLchar**>( &cStr ), NULL );
-		}
+		const char *cStr = preprocessedSource.c_str();
+		glShaderSource( handle, 1, reinterpret_cast<const GLchar**>( &cStr ), NULL );
 
 		glCompileShader( handle );
 
@@ -848,6 +1085,8 @@ void GlslProg::cacheActiveUniforms()
 	if( numActiveUniforms )
 		mUniformValueCache = unique_ptr<UniformValueCache>( new UniformValueCache( uniformValueCacheSize ) );
 #endif
+
+	mUniformNameIndex = unique_ptr<UniformNameIndex>( new UniformNameIndex( mUniforms ) );
 }
 
 #if defined( CINDER_GL_HAS_UNIFORM_BLOCKS )
@@ -1089,77 +1328,44 @@ const GlslProg::Attribute* GlslProg::findAttrib( geom::Attrib semantic ) const
 
 const GlslProg::Uniform* GlslProg::findUniform( const std::string &name, int *resultLocation ) const
 {
+	if( ! mUniformNameIndex )
+		return nullptr;
+
 	// first check if there is an exact name match with mUniforms and simply return it if we find one
-	for( const auto & uniform : mUniforms ) {
-		if( uniform.mName == name ) {
-			if( resultLocation ) {
-				*resultLocation = uniform.mLoc;
-			}
-			return &uniform;
-		}
+	const Uniform *resultUniform = mUniformNameIndex->find( UniformNameIndex::EXACT, name.data(), name.size() );
+	if( resultUniform ) {
+		if( resultLocation )
+			*resultLocation = resultUniform->mLoc;
+		return resultUniform;
 	}
 
 	// search for array brackets, they need to be handled as a special case
 	size_t requestedNameLeftSquareBracket = name.find( '[' );
-	size_t requestedNameRightSquareBracket = ( requestedNameLeftSquareBracket != string::npos ? name.find( ']' ) : string::npos );
-
-	// if we didn't find an exact match, look for the array version in the active uniforms list
-	bool needsLocationOffset = false;
-	const Uniform* resultUniform = nullptr;	
-	for( const auto &uniform : mUniforms ) {
-		size_t activeUniformLeftSquareBracket = uniform.mName.find( '[' );
-		// skip match detection if this active uniform isn't an array
-		if( activeUniformLeftSquareBracket == string::npos )
-			continue;
-
-		string uniformBaseName = uniform.mName.substr( 0, activeUniformLeftSquareBracket );
-		if( requestedNameLeftSquareBracket == string::npos ) {
-			// name is non-indexed, try to match the uniform base name with the entire requested uniform name
-			if( uniformBaseName == name ) {
-				resultUniform = &uniform;
-				break;
-			}
-		}
-		else {
-			// try to find a match between the active uniform base name and the requested uniform's base name
-			if( uniformBaseName == name.substr( 0, requestedNameLeftSquareBracket ) ) {
-				// If the requested name is an array of structs and a struct member is part of it, make sure it matches the active uniform too
-				if( name.size() - 1 > requestedNameRightSquareBracket ) {
-					// try to match the struct member portion of each name
-					if( name.substr( requestedNameRightSquareBracket, name.size() ) == uniform.mName.substr( uniform.mName.find( ']' ), name.size() ) ) {
-						resultUniform = &uniform;
-						needsLocationOffset = true;
-						break;
-					}
-				}
-				else {
-					// the bases of the requested and active uniform match
-					resultUniform = &uniform;
-					needsLocationOffset = true;
-					break;
-				}
-			}
-		}
+	if( requestedNameLeftSquareBracket == string::npos ) {
+		// name is non-indexed, try to match the base name of an array uniform with the entire requested uniform name
+		resultUniform = mUniformNameIndex->find( UniformNameIndex::BASE, name.data(), name.size() );
+		if( resultLocation && resultUniform )
+			*resultLocation = resultUniform->mLoc;
+		return resultUniform;
 	}
 
+	// If the requested name is an array of structs and a struct member is part of it, make sure it matches the active uniform too
+	size_t requestedNameRightSquareBracket = name.find( ']' );
+	if( requestedNameRightSquareBracket != string::npos && requestedNameRightSquareBracket + 1 < name.size() )
+		resultUniform = mUniformNameIndex->find( UniformNameIndex::BASE_MEMBER, name.data(), requestedNameLeftSquareBracket,
+												name.data() + requestedNameRightSquareBracket, name.size() - requestedNameRightSquareBracket );
+	else
+		resultUniform = mUniformNameIndex->find( UniformNameIndex::BASE, name.data(), requestedNameLeftSquareBracket );
+
 	if( resultLocation && resultUniform ) {
-		if( needsLocationOffset ) {
-			CI_ASSERT( requestedNameLeftSquareBracket != string::npos && requestedNameRightSquareBracket != string::npos );
-
-			// pull out the index and use it as an offset location for the resulting uniform
-			// the try / catch handles cases where the index is a non-number, in which case we don't have a match
-			try {
-				string indexStr = name.substr( requestedNameLeftSquareBracket + 1, requestedNameRightSquareBracket - requestedNameLeftSquareBracket - 1 );
-				*resultLocation = resultUniform->mLoc + stoi( indexStr );
-			}
-			catch( std::logic_error & ) {
-				return nullptr;
-			}
-		}
-		else
-			*resultLocation = resultUniform->mLoc;
+		// pull out the index and use it as an offset location for the resulting uniform, a non-number index means we don't have a match
+		const char *indexEnd = name.data() + ( requestedNameRightSquareBracket != string::npos && requestedNameRightSquareBracket > requestedNameLeftSquareBracket ? requestedNameRightSquareBracket : name.size() );
+		int index;
+		if( ! parseUniformArrayIndex( name.data() + requestedNameLeftSquareBracket + 1, indexEnd, &index ) )
+			return nullptr;
+		*resultLocation = resultUniform->mLoc + index;
 	}
-	
+
 	return resultUniform;
 }
 
@@ -1320,6 +1526,10 @@ GlslProg::TransformFeedbackVaryings* GlslProg::findTransformFeedbackVaryings( co
 
 bool GlslProg::checkUniformValueCache( const Uniform &uniform, int location, const void *val, int count ) const
 {
+	// a pending streaming draw batch was meant to see the previous value
+	if( mStreamingDrawContext )
+		mStreamingDrawContext->flushStreamingDraw();
+
 	if( mUniformValueCache )
 		return mUniformValueCache->shouldBuffer( uniform.mBytePointer, uniform.mTypeSize, location - uniform.mLoc, count, val );
 	else // no uniform cache means we've disabled it
@@ -1971,6 +2181,117 @@ void GlslProg::uniformMatFunc( int location, const mat4 *data, int count, bool t
     glUniformMatrix4fv( location, count, ( transpose ) ? GL_TRUE : GL_FALSE, glm::value_ptr( *data ) );
 }
 
+//////////////////////////////////////////////////////////////////////////
+// UniformHandle
+
+template<typename T>
+GlslProg::UniformHandle<T> GlslProg::getUniformHandle( const std::string &name ) const
+{
+	int uniformLocation = -1;
+	auto found = findUniform( name, &uniformLocation );
+	if( ! found ) {
+		logMissingUniform( name );
+		return UniformHandle<T>();
+	}
+	if( ! checkUniformType<T>( found->mType ) ) {
+		logUniformWrongType( found->mName, found->mType, cppTypeToGlslTypeName<T>() );
+		return UniformHandle<T>();
+	}
+
+	return UniformHandle<T>( this, found, uniformLocation );
+}
+
+template<typename T>
+void GlslProg::uniform( const UniformHandle<T> &handle, const typename UniformHandle<T>::value_type &data ) const
+{
+	CI_ASSERT_MSG( ! handle || handle.mGlslProg == this, "UniformHandle belongs to a different GlslProg" );
+	if( handle && checkUniformValueCache( *handle.mUniform, handle.mLocation, &data, 1 ) )
+		uniformFunc( handle.mLocation, data );
+}
+
+template<typename T>
+void GlslProg::uniform( const UniformHandle<T> &handle, const typename UniformHandle<T>::value_type *data, int count ) const
+{
+	CI_ASSERT_MSG( ! handle || handle.mGlslProg == this, "UniformHandle belongs to a different GlslProg" );
+	if( handle && checkUniformValueCache( *handle.mUniform, handle.mLocation, data, count ) )
+		uniformFunc( handle.mLocation, data, count );
+}
+
+void GlslProg::uniform( const UniformHandle<mat2> &handle, const mat2 &data, bool transpose ) const
+{
+	CI_ASSERT_MSG( ! handle || handle.mGlslProg == this, "UniformHandle belongs to a different GlslProg" );
+	if( handle && checkUniformValueCache( *handle.mUniform, handle.mLocation, &data, 1 ) )
+		uniformMatFunc( handle.mLocation, data, transpose );
+}
+
+void GlslProg::uniform( const UniformHandle<mat3> &handle, const mat3 &data, bool transpose ) const
+{
+	CI_ASSERT_MSG( ! handle || handle.mGlslProg == this, "UniformHandle belongs to a different GlslProg" );
+	if( handle && checkUniformValueCache( *handle.mUniform, handle.mLocation, &data, 1 ) )
+		uniformMatFunc( handle.mLocation, data, transpose );
+}
+
+void GlslProg::uniform( const UniformHandle<mat4> &handle, const mat4 &data, bool transpose ) const
+{
+	CI_ASSERT_MSG( ! handle || handle.mGlslProg == this, "UniformHandle belongs to a different GlslProg" );
+	if( handle && checkUniformValueCache( *handle.mUniform, handle.mLocation, &data, 1 ) )
+		uniformMatFunc( handle.mLocation, data, transpose );
+}
+
+void GlslProg::uniform( const UniformHandle<mat2> &handle, const mat2 *data, int count, bool transpose ) const
+{
+	CI_ASSERT_MSG( ! handle || handle.mGlslProg == this, "UniformHandle belongs to a different GlslProg" );
+	if( handle && checkUniformValueCache( *handle.mUniform, handle.mLocation, data, count ) )
+		uniformMatFunc( handle.mLocation, data, count, transpose );
+}
+
+void GlslProg::uniform( const UniformHandle<mat3> &handle, const mat3 *data, int count, bool transpose ) const
+{
+	CI_ASSERT_MSG( ! handle || handle.mGlslProg == this, "UniformHandle belongs to a different GlslProg" );
+	if( handle && checkUniformValueCache( *handle.mUniform, handle.mLocation, data, count ) )
+		uniformMatFunc( handle.mLocation, data, count, transpose );
+}
+
+void GlslProg::uniform( const UniformHandle<mat4> &handle, const mat4 *data, int count, bool transpose ) const
+{
+	CI_ASSERT_MSG( ! handle || handle.mGlslProg == this, "UniformHandle belongs to a different GlslProg" );
+	if( handle && checkUniformValueCache( *handle.mUniform, handle.mLocation, data, count ) )
+		uniformMatFunc( handle.mLocation, data, count, transpose );
+}
+
+#define GLSLPROG_UNIFORM_HANDLE_PROTOTYPES(T)\
+	template GlslProg::UniformHandle<T> GlslProg::getUniformHandle<T>( const std::string &name ) const;\
+	template void GlslProg::uniform<T>( const UniformHandle<T> &handle, const T &data ) const;
+
+#define GLSLPROG_UNIFORM_HANDLE_ARRAY_PROTOTYPES(T)\
+	template void GlslProg::uniform<T>( const UniformHandle<T> &handle, const T *data, int count ) const;
+
+GLSLPROG_UNIFORM_HANDLE_PROTOTYPES(bool)
+GLSLPROG_UNIFORM_HANDLE_PROTOTYPES(int)
+GLSLPROG_UNIFORM_HANDLE_PROTOTYPES(float)
+GLSLPROG_UNIFORM_HANDLE_PROTOTYPES(ivec2)
+GLSLPROG_UNIFORM_HANDLE_PROTOTYPES(ivec3)
+GLSLPROG_UNIFORM_HANDLE_PROTOTYPES(ivec4)
+GLSLPROG_UNIFORM_HANDLE_PROTOTYPES(vec2)
+GLSLPROG_UNIFORM_HANDLE_PROTOTYPES(vec3)
+GLSLPROG_UNIFORM_HANDLE_PROTOTYPES(vec4)
+GLSLPROG_UNIFORM_HANDLE_ARRAY_PROTOTYPES(int)
+GLSLPROG_UNIFORM_HANDLE_ARRAY_PROTOTYPES(float)
+GLSLPROG_UNIFORM_HANDLE_ARRAY_PROTOTYPES(ivec2)
+GLSLPROG_UNIFORM_HANDLE_ARRAY_PROTOTYPES(vec2)
+GLSLPROG_UNIFORM_HANDLE_ARRAY_PROTOTYPES(vec3)
+GLSLPROG_UNIFORM_HANDLE_ARRAY_PROTOTYPES(vec4)
+#if ! defined( CINDER_GL_ES_2 )
+GLSLPROG_UNIFORM_HANDLE_PROTOTYPES(uint32_t)
+GLSLPROG_UNIFORM_HANDLE_PROTOTYPES(uvec2)
+GLSLPROG_UNIFORM_HANDLE_PROTOTYPES(uvec3)
+GLSLPROG_UNIFORM_HANDLE_PROTOTYPES(uvec4)
+GLSLPROG_UNIFORM_HANDLE_ARRAY_PROTOTYPES(uint32_t)
+#endif
+template GlslProg::UniformHandle<mat2> GlslProg::getUniformHandle<mat2>( const std::string &name ) const;
+template GlslProg::UniformHandle<mat3> GlslProg::getUniformHandle<mat3>( const std::string &name ) const;
+template GlslProg::UniformHandle<mat4> GlslProg::getUniformHandle<mat4>( const std::string &name ) const;
+
 std::ostream& operator<<( std::ostream &os, const GlslProg &rhs )
 {
 	os << "ID: " << rhs.mHandle << std::endl;
@@ -0,0 +1,446 @@
+/*
+ Copyright (c) 2026, The Cinder Project
+
+ This code is intended to be used with the Cinder C++ library, http://libcinder.org
+
+ Redistribution and use in source and binary forms, with or without modification, are permitted provided that
+ the following conditions are met:
+
+    * Redistributions of source code must retain the above copyright notice, this list of conditions and
+	the following disclaimer.
+    * Redistributions in binary form must reproduce the above copyright notice, this list of conditions and
+	the following disclaimer in the documentation and/or other materials provided with the distribution.
+
+ THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED
+ WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A
+ PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR
+ ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+ TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+ NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ POSSIBILITY OF SUCH DAMAGE.
+*/
+
+#include "cinder/gl/GlyphAtlas.h"
+
+#if ( defined( CINDER_ANDROID ) || defined( CINDER_LINUX ) ) && defined( CINDER_GL_HAS_DRAW_INSTANCED )
+
+#include "cinder/gl/Context.h"
+#include "cinder/gl/scoped.h"
+#include "cinder/gl/wrapper.h"
+#include "cinder/Log.h"
+#include "cinder/Noncopyable.h"
+#include "cinder/Text.h"
+
+#include "ft2build.h"
+#include FT_FREETYPE_H
+#if ( FREETYPE_MAJOR == 2 ) && ( FREETYPE_MINOR < 11 )
+	#include FT_INTERNAL_OBJECTS_H // no FT_Get_Transform()
+#endif
+
+#include <algorithm>
+#include <cstring>
+
+using namespace std;
+
+namespace cinder { namespace gl {
+
+namespace {
+
+// Clears the transform of a face that's shared with TextureFont and TextBox, which set a pen transform, and restores it afterwards
+class ScopedIdentityTransform : private Noncopyable {
+  public:
+	ScopedIdentityTransform( FT_Face face )
+		: mFace( face )
+	{
+#if ( FREETYPE_MAJOR == 2 ) && ( FREETYPE_MINOR < 11 )
+		mMatrix = face->internal->transform_matrix;
+		mDelta = face->internal->transform_delta;
+#else
+		FT_Get_Transform( face, &mMatrix, &mDelta );
+#endif
+		FT_Set_Transform( face, nullptr, nullptr );
+	}
+
+	~ScopedIdentityTransform()
+	{
+		FT_Set_Transform( mFace, &mMatrix, &mDelta );
+	}
+
+  private:
+	FT_Face		mFace;
+	FT_Matrix	mMatrix;
+	FT_Vector	mDelta;
+};
+
+} // anonymous namespace
+
+//////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// GlyphAtlas
+GlyphAtlasRef GlyphAtlas::create( const Font &font, const Format &format )
+{
+	return GlyphAtlasRef( new GlyphAtlas( font, format ) );
+}
+
+GlyphAtlas::GlyphAtlas( const Font &font, const Format &format )
+	: mFont( font ), mFormat( format ), mClock( 0 ), mBatchStart( 0 ), mNumEvictions( 0 )
+{
+	// rows are uploaded as tightly-packed single bytes, so keep them aligned to the default GL_UNPACK_ALIGNMENT
+	mFormat.pageSize( ( std::max( mFormat.getPageWidth(), 4 ) + 3 ) & ~3, std::max( mFormat.getPageHeight(), 1 ) );
+	mFormat.maxPages( std::max<size_t>( mFormat.getMaxPages(), 1 ) );
+}
+
+const GlyphAtlas::Entry* GlyphAtlas::acquire( Font::Glyph glyph )
+{
+	auto existing = mEntries.find( glyph );
+	if( existing != mEntries.end() ) {
+		if( existing->second.mArea.calcArea() > 0 )
+			touch( existing->second.mPage );
+		return &existing->second;
+	}
+	if( mFailedGlyphs.count( glyph ) )
+		return nullptr;
+
+	FT_Face face = mFont.getFreetypeFace();
+	ScopedIdentityTransform transformScp( face );
+	if( FT_Load_Glyph( face, glyph, FT_LOAD_RENDER ) != 0 ) {
+		CI_LOG_W( "failed to render glyph " << glyph << " of font " << mFont.getName() );
+		mFailedGlyphs.insert( glyph );
+		return nullptr;
+	}
+
+	const FT_GlyphSlot slot = face->glyph;
+	const FT_Bitmap &bitmap = slot->bitmap;
+	Entry entry;
+	entry.mPage = 0;
+	entry.mOffset = ivec2( slot->bitmap_left, -slot->bitmap_top );
+	const int32_t width = (int32_t)bitmap.width, height = (int32_t)bitmap.rows;
+
+	if( width > 0 && height > 0 ) {
+		ivec2 position;
+		if( ! allocate( width, height, &entry.mPage, &position ) ) {
+			// unlike a full batch, a glyph larger than a page never fits
+			if( ! fitsInPage( width, height ) )
+				mFailedGlyphs.insert( glyph );
+			return nullptr;
+		}
+		entry.mArea = Area( position, position + ivec2( width, height ) );
+
+		Page &page = mPages[entry.mPage];
+		const int32_t pageWidth = mFormat.getPageWidth();
+		for( int32_t y = 0; y < height; ++y ) {
+			const uint8_t *src = bitmap.buffer + y * bitmap.pitch;
+			uint8_t *dst = page.mPixels.data() + ( position.y + y ) * pageWidth + position.x;
+			if( bitmap.pixel_mode == FT_PIXEL_MODE_MONO ) {
+				for( int32_t x = 0; x < width; ++x )
+					dst[x] = ( src[x >> 3] & ( 0x80 >> ( x & 7 ) ) ) ? 255 : 0;
+			}
+			else
+				memcpy( dst, src, width );
+		}
+
+		page.mGlyphs.push_back( glyph );
+		page.mDirtyBegin = std::min( page.mDirtyBegin, position.y );
+		page.mDirtyEnd = std::max( page.mDirtyEnd, position.y + height );
+		touch( entry.mPage );
+	}
+
+	return &mEntries.emplace( glyph, entry ).first->second;
+}
+
+bool GlyphAtlas::fitsInPage( int32_t width, int32_t height ) const
+{
+	const int32_t padding = mFormat.getPadding();
+	return width + padding * 2 <= mFormat.getPageWidth() && height + padding * 2 <= mFormat.getPageHeight();
+}
+
+bool GlyphAtlas::allocate( int32_t width, int32_t height, uint32_t *page, ivec2 *position )
+{
+	if( ! fitsInPage( width, height ) ) {
+		CI_LOG_W( "glyph of " << width << "x" << height << " pixels doesn't fit in a " << mFormat.getPageWidth() << "x" << mFormat.getPageHeight() << " page" );
+		return false;
+	}
+
+	const int32_t padding = mFormat.getPadding();
+	width += padding * 2;
+	height += padding * 2;
+
+	// prefer the most recently used page that has room, so that the glyphs of a batch tend to share a page
+	vector<uint32_t> order( mPages.size() );
+	for( uint32_t p = 0; p < order.size(); ++p )
+		order[p] = p;
+	sort( order.begin(), order.end(), [this]( uint32_t a, uint32_t b ) { return mPages[a].mLastUsed > mPages[b].mLastUsed; } );
+	for( uint32_t p : order ) {
+		if( allocateInPage( mPages[p], width, height, position ) ) {
+			*page = p;
+			*position += ivec2( padding );
+			return true;
+		}
+	}
+
+	if( mPages.size() < mFormat.getMaxPages() ) {
+		addPage();
+		*page = uint32_t( mPages.size() - 1 );
+	}
+	else {
+		// reuse the least recently used page, unless it's part of the current batch
+		*page = order.back();
+		if( mPages[*page].mLastUsed > mBatchStart ) {
+			CI_LOG_W( "all " << mPages.size() << " pages are in use by the current batch; increase GlyphAtlas::Format::maxPages() or pageSize()" );
+			return false;
+		}
+		evictPage( *page );
+	}
+
+	allocateInPage( mPages[*page], width, height, position );
+	*position += ivec2( padding );
+	return true;
+}
+
+bool GlyphAtlas::allocateInPage( Page &page, int32_t width, int32_t height, ivec2 *position )
+{
+	// shelf packing: the first shelf that's tall enough without wasting more than a third of its height
+	for( auto &shelf : page.mShelves ) {
+		if( shelf.mHeight >= height && shelf.mHeight * 2 <= height * 3 && shelf.mX + width <= mFormat.getPageWidth() ) {
+			*position = ivec2( shelf.mX, shelf.mY );
+			shelf.mX += width;
+			return true;
+		}
+	}
+
+	if( page.mNextShelfY + height > mFormat.getPageHeight() )
+		return false;
+
+	page.mShelves.push_back( { page.mNextShelfY, height, width } );
+	*position = ivec2( 0, page.mNextShelfY );
+	page.mNextShelfY += height;
+	return true;
+}
+
+void GlyphAtlas::addPage()
+{
+	Page page;
+	page.mPixels.assign( size_t( mFormat.getPageWidth() ) * mFormat.getPageHeight(), 0 );
+	page.mNextShelfY = 0;
+	page.mDirtyBegin = mFormat.getPageHeight();
+	page.mDirtyEnd = 0;
+	page.mLastUsed = 0;
+	mPages.push_back( std::move( page ) );
+}
+
+void GlyphAtlas::evictPage( uint32_t pageIndex )
+{
+	Page &page = mPages[pageIndex];
+	for( Font::Glyph glyph : page.mGlyphs )
+		mEntries.erase( glyph );
+	page.mGlyphs.clear();
+	page.mShelves.clear();
+	page.mNextShelfY = 0;
+	fill( page.mPixels.begin(), page.mPixels.end(), 0 );
+	page.mDirtyBegin = 0;
+	page.mDirtyEnd = mFormat.getPageHeight();
+	++mNumEvictions;
+}
+
+void GlyphAtlas::upload()
+{
+	const int32_t pageWidth = mFormat.getPageWidth();
+	for( auto &page : mPages ) {
+		if( ! page.mTexture ) {
+			auto textureFormat = Texture2d::Format().internalFormat( GL_R8 ).minFilter( GL_LINEAR ).magFilter( GL_LINEAR ).wrap( GL_CLAMP_TO_EDGE ).dataType( GL_UNSIGNED_BYTE );
+			page.mTexture = Texture2d::create( page.mPixels.data(), GL_RED, pageWidth, mFormat.getPageHeight(), textureFormat );
+			page.mDirtyBegin = mFormat.getPageHeight();
+			page.mDirtyEnd = 0;
+		}
+		else if( page.mDirtyBegin < page.mDirtyEnd ) {
+			page.mTexture->update( page.mPixels.data() + size_t( page.mDirtyBegin ) * pageWidth, GL_RED, GL_UNSIGNED_BYTE, 0, pageWidth, page.mDirtyEnd - page.mDirtyBegin, ivec2( 0, page.mDirtyBegin ) );
+			page.mDirtyBegin = mFormat.getPageHeight();
+			page.mDirtyEnd = 0;
+		}
+	}
+}
+
+const GlslProgRef& GlyphAtlas::getDefaultGlslProg()
+{
+	if( ! mDefaultGlsl ) {
+#if defined( CINDER_GL_ES )
+		const char *version = "#version 300 es\nprecision highp float;\n";
+#else
+		const char *version = "#version 150\n";
+#endif
+		const string vertex = string( version ) +
+			"uniform mat4 ciModelViewProjection;\n"
+			"in vec4 ciColor;\n"
+			"in vec4 ciGlyphRect;\n"
+			"in vec4 ciGlyphTexCoords;\n"
+			"in vec4 ciGlyphColor;\n"
+			"out vec2 vTexCoord;\n"
+			"out vec4 vColor;\n"
+			"void main() {\n"
+			"	vec2 corner = vec2( gl_VertexID & 1, gl_VertexID >> 1 );\n"
+			"	vTexCoord = mix( ciGlyphTexCoords.xy, ciGlyphTexCoords.zw, corner );\n"
+			"	vColor = ciColor * ciGlyphColor;\n"
+			"	gl_Position = ciModelViewProjection * vec4( ciGlyphRect.xy + ciGlyphRect.zw * corner, 0.0, 1.0 );\n"
+			"}\n";
+		const string fragment = string( version ) +
+			"uniform sampler2D uTex0;\n"
+			"in vec2 vTexCoord;\n"
+			"in vec4 vColor;\n"
+			"out vec4 oColor;\n"
+			"void main() {\n"
+			"	oColor = vec4( vColor.rgb, vColor.a * texture( uTex0, vTexCoord ).r );\n"
+			"}\n";
+		mDefaultGlsl = GlslProg::create( GlslProg::Format().vertex( vertex ).fragment( fragment ) );
+		mDefaultGlsl->uniform( "uTex0", 0 );
+	}
+
+	return mDefaultGlsl;
+}
+
+//////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// TextRun
+TextRunRef TextRun::create( const GlyphAtlasRef &atlas )
+{
+	return TextRunRef( new TextRun( atlas ) );
+}
+
+TextRunRef TextRun::create( const GlyphAtlasRef &atlas, const std::string &str, const ColorA8u &color )
+{
+	TextRunRef result( new TextRun( atlas ) );
+	result->append( str, vec2(), color );
+	return result;
+}
+
+TextRun::TextRun( const GlyphAtlasRef &atlas )
+	: mAtlas( atlas ), mDirty( true ), mBuiltEvictions( 0 )
+{
+}
+
+void TextRun::append( const std::vector<std::pair<Font::Glyph,vec2>> &glyphPlacements, const vec2 &offset, const ColorA8u &color )
+{
+	mGlyphs.reserve( mGlyphs.size() + glyphPlacements.size() );
+	for( const auto &placement : glyphPlacements )
+		mGlyphs.push_back( { placement.first, placement.second + offset, color } );
+	mDirty = true;
+}
+
+void TextRun::append( const std::string &str, const vec2 &offset, const ColorA8u &color )
+{
+	TextBox tbox = TextBox().font( mAtlas->getFont() ).text( str ).size( TextBox::GROW, TextBox::GROW );
+	append( tbox.measureGlyphs(), offset, color );
+}
+
+void TextRun::clear()
+{
+	mGlyphs.clear();
+	mDirty = true;
+}
+
+void TextRun::build()
+{
+	// resolve every glyph first, as rasterizing may evict a page and invalidate entries from a previous batch
+	mAtlas->beginBatch();
+	vector<const GlyphAtlas::Entry*> entries( mGlyphs.size() );
+	vector<uint32_t> pageCounts;
+	for( size_t i = 0; i < mGlyphs.size(); ++i ) {
+		entries[i] = mAtlas->acquire( mGlyphs[i].mGlyph );
+		if( entries[i] && entries[i]->mArea.calcArea() > 0 ) {
+			if( entries[i]->mPage >= pageCounts.size() )
+				pageCounts.resize( entries[i]->mPage + 1, 0 );
+			++pageCounts[entries[i]->mPage];
+		}
+		else
+			entries[i] = nullptr;
+	}
+
+	// instances are grouped by page so that each page is one contiguous draw
+	mPageRanges.clear();
+	vector<uint32_t> pageStarts( pageCounts.size() );
+	uint32_t numInstances = 0;
+	for( uint32_t p = 0; p < pageCounts.size(); ++p ) {
+		pageStarts[p] = numInstances;
+		numInstances += pageCounts[p];
+		if( pageCounts[p] > 0 )
+			mPageRanges.emplace_back( p, pageCounts[p] );
+	}
+
+	const vec2 pageSize( mAtlas->getFormat().getPageWidth(), mAtlas->getFormat().getPageHeight() );
+	vector<Instance> instances( numInstances );
+	for( size_t i = 0; i < mGlyphs.size(); ++i ) {
+		const GlyphAtlas::Entry *entry = entries[i];
+		if( ! entry )
+			continue;
+		const vec2 upperLeft = floor( mGlyphs[i].mPosition ) + vec2( entry->mOffset );
+		const vec2 size( entry->mArea.getSize() );
+		Instance &instance = instances[pageStarts[entry->mPage]++];
+		instance.mRect = vec4( upperLeft, size );
+		instance.mTexCoords = vec4( vec2( entry->mArea.getUL() ) / pageSize, vec2( entry->mArea.getLR() ) / pageSize );
+		instance.mColor = mGlyphs[i].mColor;
+	}
+
+	const size_t bytes = instances.size() * sizeof(Instance);
+	if( ! mInstanceVbo || mInstanceVbo->getSize() < bytes )
+		mInstanceVbo = Vbo::create( GL_ARRAY_BUFFER, bytes, instances.data(), GL_STATIC_DRAW );
+	else if( bytes > 0 )
+		mInstanceVbo->bufferSubData( 0, bytes, instances.data() );
+
+	mBuiltEvictions = mAtlas->getNumEvictions();
+	mDirty = false;
+}
+
+void TextRun::draw( const vec2 &baseline, const GlslProgRef &glslIn )
+{
+	if( mGlyphs.empty() )
+		return;
+
+	if( mDirty || mBuiltEvictions != mAtlas->getNumEvictions() )
+		build();
+	if( mPageRanges.empty() )
+		return;
+
+	const GlslProgRef &glsl = glslIn ? glslIn : mAtlas->getDefaultGlslProg();
+	const GLint rectLoc = glsl->getAttribLocation( "ciGlyphRect" );
+	const GLint texCoordsLoc = glsl->getAttribLocation( "ciGlyphTexCoords" );
+	const GLint colorLoc = glsl->getAttribLocation( "ciGlyphColor" );
+
+	auto ctx = gl::context();
+	if( mVaoGlsl != glsl ) {
+		mVao = Vao::create();
+		ScopedVao vaoScp( mVao );
+		for( GLint loc : { rectLoc, texCoordsLoc, colorLoc } ) {
+			if( loc >= 0 ) {
+				ctx->enableVertexAttribArray( loc );
+				ctx->vertexAttribDivisor( loc, 1 );
+			}
+		}
+		mVaoGlsl = glsl;
+	}
+
+	mAtlas->upload();
+	ScopedGlslProg glslScp( glsl );
+	ScopedVao vaoScp( mVao );
+	ScopedBuffer bufferScp( mInstanceVbo );
+	ScopedModelMatrix modelScp;
+	gl::translate( floor( baseline ) );
+	ctx->setDefaultShaderVars();
+
+	size_t firstInstance = 0;
+	for( const auto &range : mPageRanges ) {
+		mAtlas->touch( range.first );
+		ScopedTextureBind texScp( mAtlas->getTexture( range.first ), 0 );
+		// without baseInstance, each page's instances are reached by offsetting the attribute pointers
+		const size_t offset = firstInstance * sizeof(Instance);
+		if( rectLoc >= 0 )
+			ctx->vertexAttribPointer( rectLoc, 4, GL_FLOAT, GL_FALSE, sizeof(Instance), (const GLvoid*)( offset + offsetof( Instance, mRect ) ) );
+		if( texCoordsLoc >= 0 )
+			ctx->vertexAttribPointer( texCoordsLoc, 4, GL_FLOAT, GL_FALSE, sizeof(Instance), (const GLvoid*)( offset + offsetof( Instance, mTexCoords ) ) );
+		if( colorLoc >= 0 )
+			ctx->vertexAttribPointer( colorLoc, 4, GL_UNSIGNED_BYTE, GL_TRUE, sizeof(Instance), (const GLvoid*)( offset + offsetof( Instance, mColor ) ) );
+		ctx->drawArraysInstanced( GL_TRIANGLE_STRIP, 0, 4, (GLsizei)range.second );
+		firstInstance += range.second;
+	}
+}
+
+} } // namespace cinder::gl
+
+#endif // ( defined( CINDER_ANDROID ) || defined( CINDER_LINUX ) ) && defined( CINDER_GL_HAS_DRAW_INSTANCED )
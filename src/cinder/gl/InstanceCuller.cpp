@@ -0,0 +1,431 @@
+/*
+ Copyright (c) 2026, The Cinder Project
+
+ This code is intended to be used with the Cinder C++ library, http://libcinder.org
+
+ Redistribution and use in source and binary forms, with or without modification, are permitted provided that
+ the following conditions are met:
+
+    * Redistributions of source code must retain the above copyright notice, this list of conditions and
+	the following disclaimer.
+    * Redistributions in binary form must reproduce the above copyright notice, this list of conditions and
+	the following disclaimer in the documentation and/or other materials provided with the distribution.
+
+ THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED
+ WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A
+ PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR
+ ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+ TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+ NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ POSSIBILITY OF SUCH DAMAGE.
+*/
+
+#include "cinder/gl/InstanceCuller.h"
+
+#if defined( CINDER_GL_HAS_MULTI_DRAW_INDIRECT )
+
+#include "cinder/gl/Context.h"
+#include "cinder/gl/scoped.h"
+#include "cinder/ip/Parallel.h"
+#include "cinder/CinderAssert.h"
+
+#include <algorithm>
+#include <cmath>
+
+#if defined( __SSE2__ ) || defined( _M_X64 ) || ( defined( _M_IX86_FP ) && _M_IX86_FP >= 2 )
+	#include <emmintrin.h>
+	#define CINDER_GL_CULL_SSE2
+#elif defined( __ARM_NEON ) || defined( __ARM_NEON__ )
+	#include <arm_neon.h>
+	#define CINDER_GL_CULL_NEON
+#endif
+
+using namespace std;
+
+namespace cinder { namespace gl {
+
+namespace {
+
+// Instances culled per parallelFor() range; each range keeps its own lists of visible ids, which are then concatenated in order
+const size_t CULL_CHUNK_SIZE = 16384;
+
+// The frustum's planes in the form the cull test uses: a box is outside when dot( n, center ) + dot( |n|, extents ) - d < 0 for any plane
+struct CullPlanes {
+	CullPlanes( const Frustumf &frustum )
+	{
+		for( int p = 0; p < 6; ++p ) {
+			const Planef &plane = frustum.getPlane( (Frustumf::FrustumSection)p );
+			mNormal[p] = plane.getNormal();
+			mAbsNormal[p] = glm::abs( plane.getNormal() );
+			mDistance[p] = plane.getDistance();
+		}
+	}
+
+	vec3	mNormal[6], mAbsNormal[6];
+	float	mDistance[6];
+};
+
+// Returns the LOD for a squared distance from the eye, or lodMaxDistancesSq.size() when it's beyond the last one
+inline size_t selectLod( float distanceSq, const vector<float> &lodMaxDistancesSq )
+{
+	size_t lod = 0;
+	while( lod < lodMaxDistancesSq.size() && distanceSq >= lodMaxDistancesSq[lod] )
+		++lod;
+	return lod;
+}
+
+// The scalar test, with its operations in the same order as the vectorized one so both agree on boxes touching a plane
+inline bool isVisible( const CullPlanes &planes, const vec3 &center, const vec3 &extents )
+{
+	for( int p = 0; p < 6; ++p ) {
+		const vec3 &n = planes.mNormal[p], &a = planes.mAbsNormal[p];
+		float d = ( n.x * center.x + n.y * center.y ) + n.z * center.z;
+		float r = ( a.x * extents.x + a.y * extents.y ) + a.z * extents.z;
+		if( ( d + r ) - planes.mDistance[p] < 0 )
+			return false;
+	}
+
+	return true;
+}
+
+void cullRange( const CullPlanes &planes, const vec3 &eye, const InstanceCuller::Instance *instances, size_t begin, size_t end, const vector<float> &lodMaxDistancesSq, vector<vector<uint32_t>> *visible )
+{
+	size_t i = begin;
+#if defined( CINDER_GL_CULL_SSE2 ) || defined( CINDER_GL_CULL_NEON )
+	for( ; i + 4 <= end; i += 4 ) {
+		// transpose four instances into x, y and z lanes
+		alignas(16) float c[3][4], e[3][4], distanceSq[4];
+		for( int k = 0; k < 4; ++k ) {
+			const auto &instance = instances[i + k];
+			for( int axis = 0; axis < 3; ++axis ) {
+				c[axis][k] = instance.mCenter[axis];
+				e[axis][k] = instance.mExtents[axis];
+			}
+		}
+
+		int mask;
+  #if defined( CINDER_GL_CULL_SSE2 )
+		const __m128 cx = _mm_load_ps( c[0] ), cy = _mm_load_ps( c[1] ), cz = _mm_load_ps( c[2] );
+		const __m128 ex = _mm_load_ps( e[0] ), ey = _mm_load_ps( e[1] ), ez = _mm_load_ps( e[2] );
+		__m128 inside = _mm_castsi128_ps( _mm_set1_epi32( -1 ) );
+		for( int p = 0; p < 6; ++p ) {
+			const vec3 &n = planes.mNormal[p], &a = planes.mAbsNormal[p];
+			__m128 d = _mm_add_ps( _mm_add_ps( _mm_mul_ps( _mm_set1_ps( n.x ), cx ), _mm_mul_ps( _mm_set1_ps( n.y ), cy ) ), _mm_mul_ps( _mm_set1_ps( n.z ), cz ) );
+			__m128 r = _mm_add_ps( _mm_add_ps( _mm_mul_ps( _mm_set1_ps( a.x ), ex ), _mm_mul_ps( _mm_set1_ps( a.y ), ey ) ), _mm_mul_ps( _mm_set1_ps( a.z ), ez ) );
+			__m128 s = _mm_sub_ps( _mm_add_ps( d, r ), _mm_set1_ps( planes.mDistance[p] ) );
+			inside = _mm_and_ps( inside, _mm_cmpge_ps( s, _mm_setzero_ps() ) );
+		}
+		mask = _mm_movemask_ps( inside );
+		if( ! mask )
+			continue;
+		const __m128 dx = _mm_sub_ps( cx, _mm_set1_ps( eye.x ) ), dy = _mm_sub_ps( cy, _mm_set1_ps( eye.y ) ), dz = _mm_sub_ps( cz, _mm_set1_ps( eye.z ) );
+		_mm_store_ps( distanceSq, _mm_add_ps( _mm_add_ps( _mm_mul_ps( dx, dx ), _mm_mul_ps( dy, dy ) ), _mm_mul_ps( dz, dz ) ) );
+  #else
+		const float32x4_t cx = vld1q_f32( c[0] ), cy = vld1q_f32( c[1] ), cz = vld1q_f32( c[2] );
+		const float32x4_t ex = vld1q_f32( e[0] ), ey = vld1q_f32( e[1] ), ez = vld1q_f32( e[2] );
+		uint32x4_t inside = vdupq_n_u32( 0xFFFFFFFF );
+		for( int p = 0; p < 6; ++p ) {
+			const vec3 &n = planes.mNormal[p], &a = planes.mAbsNormal[p];
+			// multiplies and adds are kept separate (no vmlaq) to round like the scalar test
+			float32x4_t d = vaddq_f32( vaddq_f32( vmulq_n_f32( cx, n.x ), vmulq_n_f32( cy, n.y ) ), vmulq_n_f32( cz, n.z ) );
+			float32x4_t r = vaddq_f32( vaddq_f32( vmulq_n_f32( ex, a.x ), vmulq_n_f32( ey, a.y ) ), vmulq_n_f32( ez, a.z ) );
+			float32x4_t s = vsubq_f32( vaddq_f32( d, r ), vdupq_n_f32( planes.mDistance[p] ) );
+			inside = vandq_u32( inside, vcgeq_f32( s, vdupq_n_f32( 0 ) ) );
+		}
+		alignas(16) uint32_t lanes[4];
+		vst1q_u32( lanes, inside );
+		mask = ( lanes[0] & 1 ) | ( lanes[1] & 2 ) | ( lanes[2] & 4 ) | ( lanes[3] & 8 );
+		if( ! mask )
+			continue;
+		const float32x4_t dx = vsubq_f32( cx, vdupq_n_f32( eye.x ) ), dy = vsubq_f32( cy, vdupq_n_f32( eye.y ) ), dz = vsubq_f32( cz, vdupq_n_f32( eye.z ) );
+		vst1q_f32( distanceSq, vaddq_f32( vaddq_f32( vmulq_f32( dx, dx ), vmulq_f32( dy, dy ) ), vmulq_f32( dz, dz ) ) );
+  #endif
+
+		for( int k = 0; k < 4; ++k ) {
+			if( mask & ( 1 << k ) ) {
+				size_t lod = selectLod( distanceSq[k], lodMaxDistancesSq );
+				if( lod < lodMaxDistancesSq.size() )
+					(*visible)[lod].push_back( instances[i + k].mId );
+			}
+		}
+	}
+#endif
+
+	for( ; i < end; ++i ) {
+		const auto &instance = instances[i];
+		if( isVisible( planes, instance.mCenter, instance.mExtents ) ) {
+			const vec3 delta = instance.mCenter - eye;
+			size_t lod = selectLod( ( delta.x * delta.x + delta.y * delta.y ) + delta.z * delta.z, lodMaxDistancesSq );
+			if( lod < lodMaxDistancesSq.size() )
+				(*visible)[lod].push_back( instance.mId );
+		}
+	}
+}
+
+// Mirrors cullRange(): one invocation per instance, appending visible ids to their LOD's region through the instance count of its draw command
+const char *CULL_COMPUTE_SHADER =
+	"struct Instance { vec3 center; uint id; vec3 extents; float pad; };\n"
+	"struct DrawCommand { uint count; uint instanceCount; uint firstIndex; int baseVertex; uint baseInstance; };\n"
+	"layout( local_size_x = WORK_GROUP_SIZE ) in;\n"
+	"layout( std430, binding = 0 ) readonly buffer Instances { Instance uInstances[]; };\n"
+	"layout( std430, binding = 1 ) writeonly buffer VisibleIds { uint uVisibleIds[]; };\n"
+	"layout( std430, binding = 2 ) buffer DrawCommands { DrawCommand uCommands[]; };\n"
+	"uniform vec4 uPlanes[6];\n"
+	"uniform vec3 uEye;\n"
+	"uniform uint uNumInstances;\n"
+	"uniform uint uCapacity;\n"
+	"uniform int uNumLods;\n"
+	"uniform float uLodMaxDistancesSq[MAX_LODS];\n"
+	"void main() {\n"
+	"	uint i = gl_GlobalInvocationID.x;\n"
+	"	if( i >= uNumInstances )\n"
+	"		return;\n"
+	"	vec3 center = uInstances[i].center;\n"
+	"	vec3 extents = uInstances[i].extents;\n"
+	"	for( int p = 0; p < 6; ++p ) {\n"
+	"		vec3 n = uPlanes[p].xyz, a = abs( uPlanes[p].xyz );\n"
+	"		precise float d = ( n.x * center.x + n.y * center.y ) + n.z * center.z;\n"
+	"		precise float r = ( a.x * extents.x + a.y * extents.y ) + a.z * extents.z;\n"
+	"		precise float s = ( d + r ) - uPlanes[p].w;\n"
+	"		if( s < 0.0 )\n"
+	"			return;\n"
+	"	}\n"
+	"	vec3 delta = center - uEye;\n"
+	"	precise float distanceSq = ( delta.x * delta.x + delta.y * delta.y ) + delta.z * delta.z;\n"
+	"	int lod = 0;\n"
+	"	while( lod < uNumLods && distanceSq >= uLodMaxDistancesSq[lod] )\n"
+	"		++lod;\n"
+	"	if( lod == uNumLods )\n"
+	"		return;\n"
+	"	uint slot = atomicAdd( uCommands[lod].instanceCount, 1u );\n"
+	"	uVisibleIds[uint( lod ) * uCapacity + slot] = uInstances[i].id;\n"
+	"}\n";
+
+} // anonymous namespace
+
+//////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// InstanceCuller::Format
+InstanceCuller::Format::Format()
+	: mIndexType( GL_UNSIGNED_INT ), mCpu( false ), mWorkGroupSize( 256 )
+{
+}
+
+InstanceCuller::Format& InstanceCuller::Format::lod( GLuint numIndices, GLuint firstIndex, GLint baseVertex, float maxDistance )
+{
+	CI_ASSERT_MSG( mLods.size() < MAX_LODS, "InstanceCuller supports at most MAX_LODS LODs" );
+	mLods.push_back( { numIndices, firstIndex, baseVertex, maxDistance } );
+	return *this;
+}
+
+//////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// InstanceCuller
+InstanceCullerRef InstanceCuller::create( const Format &format )
+{
+	return InstanceCullerRef( new InstanceCuller( format ) );
+}
+
+InstanceCuller::InstanceCuller( const Format &format )
+	: mFormat( format ), mCapacity( 0 ), mDirtyBegin( 0 ), mDirtyEnd( 0 )
+{
+	static_assert( sizeof(Instance) == 8 * sizeof(float), "Instance must match its std430 layout" );
+	static_assert( sizeof(DrawCommand) == 5 * sizeof(GLuint), "DrawCommand must be tightly packed" );
+
+	if( mFormat.getLods().empty() )
+		mFormat.lod( 0 );
+	for( const auto &lod : mFormat.getLods() )
+		mLodMaxDistancesSq.push_back( lod.mMaxDistance * lod.mMaxDistance );
+
+	mInstancesVbo = Vbo::create( GL_SHADER_STORAGE_BUFFER );
+	mVisibleIdsVbo = Vbo::create( GL_ARRAY_BUFFER );
+	mIndirectVbo = Vbo::create( GL_DRAW_INDIRECT_BUFFER );
+
+	if( ! mFormat.isCpu() ) {
+		const string header = "#version 430\n"
+			"#define WORK_GROUP_SIZE " + to_string( mFormat.getWorkGroupSize() ) + "\n"
+			"#define MAX_LODS " + to_string( MAX_LODS ) + "\n";
+		mCullGlsl = GlslProg::create( GlslProg::Format().compute( header + CULL_COMPUTE_SHADER ) );
+	}
+}
+
+void InstanceCuller::setInstances( const Instance *instances, size_t count )
+{
+	mInstances.assign( instances, instances + count );
+	mDirtyBegin = 0;
+	mDirtyEnd = count;
+}
+
+void InstanceCuller::setInstance( size_t index, const Instance &instance )
+{
+	mInstances[index] = instance;
+	mDirtyBegin = std::min( mDirtyBegin, index );
+	mDirtyEnd = std::max( mDirtyEnd, index + 1 );
+}
+
+void InstanceCuller::upload()
+{
+	// the buffers are respecified rather than recreated when they grow, so Vaos referring to them stay valid
+	if( mInstances.size() > mCapacity || ! mCapacity ) {
+		mCapacity = std::max<size_t>( mInstances.size() + mInstances.size() / 2, 1024 );
+		mVisibleIdsVbo->bufferData( mCapacity * mFormat.getLods().size() * sizeof(uint32_t), nullptr, GL_DYNAMIC_COPY );
+		if( ! mFormat.isCpu() ) {
+			mInstancesVbo->bufferData( mCapacity * sizeof(Instance), nullptr, GL_DYNAMIC_DRAW );
+			mDirtyBegin = 0;
+			mDirtyEnd = mInstances.size();
+		}
+	}
+
+	if( ! mFormat.isCpu() && mDirtyBegin < mDirtyEnd )
+		mInstancesVbo->bufferSubData( mDirtyBegin * sizeof(Instance), ( mDirtyEnd - mDirtyBegin ) * sizeof(Instance), mInstances.data() + mDirtyBegin );
+	mDirtyBegin = mInstances.size();
+	mDirtyEnd = 0;
+
+	mCommands.clear();
+	const auto &lods = mFormat.getLods();
+	for( size_t lod = 0; lod < lods.size(); ++lod )
+		mCommands.push_back( { lods[lod].mNumIndices, 0, lods[lod].mFirstIndex, lods[lod].mBaseVertex, GLuint( lod * mCapacity ) } );
+}
+
+void InstanceCuller::cull( const Camera &camera )
+{
+	cull( Frustumf( camera ), camera.getEyePoint() );
+}
+
+void InstanceCuller::cull( const Frustumf &frustum, const vec3 &eye )
+{
+	upload();
+	if( mFormat.isCpu() )
+		cullCpu( frustum, eye );
+	else
+		cullGpu( frustum, eye );
+}
+
+void InstanceCuller::cullGpu( const Frustumf &frustum, const vec3 &eye )
+{
+	// the instance counts start at 0 and are incremented by the compute shader
+	mIndirectVbo->bufferData( mCommands.size() * sizeof(DrawCommand), mCommands.data(), GL_DYNAMIC_COPY );
+	if( mInstances.empty() )
+		return;
+
+	vec4 planes[6];
+	for( int p = 0; p < 6; ++p ) {
+		const Planef &plane = frustum.getPlane( (Frustumf::FrustumSection)p );
+		planes[p] = vec4( plane.getNormal(), plane.getDistance() );
+	}
+	float lodMaxDistancesSq[MAX_LODS] = {};
+	std::copy( mLodMaxDistancesSq.begin(), mLodMaxDistancesSq.end(), lodMaxDistancesSq );
+
+	auto ctx = gl::context();
+	ScopedGlslProg glslScp( mCullGlsl );
+	mCullGlsl->uniform( "uPlanes", planes, 6 );
+	mCullGlsl->uniform( "uEye", eye );
+	mCullGlsl->uniform( "uNumInstances", (uint32_t)mInstances.size() );
+	mCullGlsl->uniform( "uCapacity", (uint32_t)mCapacity );
+	mCullGlsl->uniform( "uNumLods", (int)mLodMaxDistancesSq.size() );
+	mCullGlsl->uniform( "uLodMaxDistancesSq", lodMaxDistancesSq, (int)MAX_LODS );
+	ctx->bindBufferBase( GL_SHADER_STORAGE_BUFFER, 0, mInstancesVbo );
+	ctx->bindBufferBase( GL_SHADER_STORAGE_BUFFER, 1, mVisibleIdsVbo );
+	ctx->bindBufferBase( GL_SHADER_STORAGE_BUFFER, 2, mIndirectVbo );
+
+	const GLuint workGroupSize = mFormat.getWorkGroupSize();
+	dispatchCompute( GLuint( ( mInstances.size() + workGroupSize - 1 ) / workGroupSize ) );
+	memoryBarrier( GL_COMMAND_BARRIER_BIT | GL_VERTEX_ATTRIB_ARRAY_BARRIER_BIT | GL_SHADER_STORAGE_BARRIER_BIT | GL_BUFFER_UPDATE_BARRIER_BIT );
+}
+
+void InstanceCuller::cullCpu( const Frustumf &frustum, const vec3 &eye )
+{
+	vector<float> lodMaxDistances;
+	for( const auto &lod : mFormat.getLods() )
+		lodMaxDistances.push_back( lod.mMaxDistance );
+	cullInstances( frustum, eye, mInstances.data(), mInstances.size(), lodMaxDistances, &mCpuVisible );
+
+	for( size_t lod = 0; lod < mCpuVisible.size(); ++lod ) {
+		mCommands[lod].mInstanceCount = (GLuint)mCpuVisible[lod].size();
+		if( ! mCpuVisible[lod].empty() )
+			mVisibleIdsVbo->bufferSubData( lod * mCapacity * sizeof(uint32_t), mCpuVisible[lod].size() * sizeof(uint32_t), mCpuVisible[lod].data() );
+	}
+	mIndirectVbo->bufferData( mCommands.size() * sizeof(DrawCommand), mCommands.data(), GL_DYNAMIC_DRAW );
+}
+
+void InstanceCuller::cullInstances( const Frustumf &frustum, const vec3 &eye, const Instance *instances, size_t count, const vector<float> &lodMaxDistances, vector<vector<uint32_t>> *visible )
+{
+	vector<float> lodMaxDistancesSq;
+	for( float distance : lodMaxDistances )
+		lodMaxDistancesSq.push_back( distance * distance );
+
+	const CullPlanes planes( frustum );
+	const size_t numChunks = ( count + CULL_CHUNK_SIZE - 1 ) / CULL_CHUNK_SIZE;
+	vector<vector<vector<uint32_t>>> chunks( numChunks, vector<vector<uint32_t>>( lodMaxDistances.size() ) );
+	ip::parallelFor( numChunks, 1, [&]( size_t begin, size_t end ) {
+		for( size_t chunk = begin; chunk < end; ++chunk )
+			cullRange( planes, eye, instances, chunk * CULL_CHUNK_SIZE, std::min( count, ( chunk + 1 ) * CULL_CHUNK_SIZE ), lodMaxDistancesSq, &chunks[chunk] );
+	} );
+
+	visible->resize( lodMaxDistances.size() );
+	for( size_t lod = 0; lod < lodMaxDistances.size(); ++lod ) {
+		auto &ids = (*visible)[lod];
+		ids.clear();
+		for( const auto &chunk : chunks )
+			ids.insert( ids.end(), chunk[lod].begin(), chunk[lod].end() );
+	}
+}
+
+void InstanceCuller::draw( GLenum mode )
+{
+	if( ! mCapacity )
+		return;
+
+	auto ctx = gl::context();
+	ctx->setDefaultShaderVars();
+	ScopedBuffer indirectScp( mIndirectVbo );
+	ctx->multiDrawElementsIndirect( mode, mFormat.getIndexType(), nullptr, (GLsizei)mCommands.size(), 0 );
+}
+
+void InstanceCuller::setupVisibleIdsAttrib( GLint location )
+{
+	auto ctx = gl::context();
+	if( ! mCapacity )
+		upload();
+
+	ScopedBuffer idsScp( mVisibleIdsVbo );
+	ctx->enableVertexAttribArray( location );
+	ctx->vertexAttribIPointer( location, 1, GL_UNSIGNED_INT, 0, nullptr );
+	ctx->vertexAttribDivisor( location, 1 );
+}
+
+vector<uint32_t> InstanceCuller::readVisibleCounts() const
+{
+	vector<uint32_t> result;
+	if( mFormat.isCpu() ) {
+		for( const auto &ids : mCpuVisible )
+			result.push_back( (uint32_t)ids.size() );
+	}
+	else if( mCapacity ) {
+		vector<DrawCommand> commands( mCommands.size() );
+		mIndirectVbo->getBufferSubData( 0, commands.size() * sizeof(DrawCommand), commands.data() );
+		for( const auto &command : commands )
+			result.push_back( command.mInstanceCount );
+	}
+
+	return result;
+}
+
+vector<vector<uint32_t>> InstanceCuller::readVisibleIds() const
+{
+	if( mFormat.isCpu() )
+		return mCpuVisible;
+
+	vector<vector<uint32_t>> result;
+	const auto counts = readVisibleCounts();
+	for( size_t lod = 0; lod < counts.size(); ++lod ) {
+		result.emplace_back( counts[lod] );
+		if( counts[lod] )
+			mVisibleIdsVbo->getBufferSubData( lod * mCapacity * sizeof(uint32_t), counts[lod] * sizeof(uint32_t), result.back().data() );
+	}
+
+	return result;
+}
+
+} } // namespace cinder::gl
+
+#endif // defined( CINDER_GL_HAS_MULTI_DRAW_INDIRECT )
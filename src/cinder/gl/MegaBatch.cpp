@@ -0,0 +1,332 @@
+/*
+ Copyright (c) 2026, The Cinder Project
+
+ This code is intended to be used with the Cinder C++ library, http://libcinder.org
+
+ Redistribution and use in source and binary forms, with or without modification, are permitted provided that
+ the following conditions are met:
+
+    * Redistributions of source code must retain the above copyright notice, this list of conditions and
+	the following disclaimer.
+    * Redistributions in binary form must reproduce the above copyright notice, this list of conditions and
+	the following disclaimer in the documentation and/or other materials provided with the distribution.
+
+ THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED
+ WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A
+ PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR
+ ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+ TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+ NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ POSSIBILITY OF SUCH DAMAGE.
+*/
+
+#include "cinder/gl/MegaBatch.h"
+
+#if defined( CINDER_GL_HAS_MULTI_DRAW_INDIRECT )
+
+#include "cinder/gl/Context.h"
+#include "cinder/gl/scoped.h"
+#include "cinder/Log.h"
+
+#include <limits>
+#include <numeric>
+
+namespace cinder { namespace gl {
+
+namespace {
+
+// Writes a geom::Source into a range of the MegaBatch's interleaved vertices, and appends its indices as triangles
+class MegaBatchGeomTarget : public geom::Target {
+  public:
+	MegaBatchGeomTarget( const std::vector<std::pair<geom::Attrib,uint8_t>> &attribs, const std::vector<size_t> &offsets, size_t stride, float *vertices, size_t numVertices, std::vector<uint32_t> *indices )
+		: mAttribs( attribs ), mOffsets( offsets ), mStride( stride ), mVertices( vertices ), mNumVertices( numVertices ), mIndices( indices )
+	{}
+
+	uint8_t	getAttribDims( geom::Attrib attr ) const override
+	{
+		for( const auto &attrib : mAttribs ) {
+			if( attrib.first == attr )
+				return attrib.second;
+		}
+		return 0;
+	}
+
+	void copyAttrib( geom::Attrib attr, uint8_t dims, size_t strideBytes, const float *srcData, size_t count ) override
+	{
+		for( size_t i = 0; i < mAttribs.size(); ++i ) {
+			if( mAttribs[i].first == attr ) {
+				geom::copyData( dims, strideBytes, srcData, std::min( count, mNumVertices ), mAttribs[i].second, mStride * sizeof(float), mVertices + mOffsets[i] );
+				return;
+			}
+		}
+	}
+
+	void copyIndices( geom::Primitive primitive, const uint32_t *source, size_t numIndices, uint8_t /*requiredBytesPerIndex*/ ) override
+	{
+		size_t numTriangleIndices = numIndices;
+		if( primitive == geom::Primitive::TRIANGLE_STRIP || primitive == geom::Primitive::TRIANGLE_FAN )
+			numTriangleIndices = ( numIndices >= 3 ) ? ( numIndices - 2 ) * 3 : 0;
+
+		const size_t first = mIndices->size();
+		mIndices->resize( first + numTriangleIndices );
+		copyIndexDataForceTriangles( primitive, source, numIndices, 0, mIndices->data() + first );
+	}
+
+  private:
+	const std::vector<std::pair<geom::Attrib,uint8_t>>	&mAttribs;
+	const std::vector<size_t>							&mOffsets;
+	size_t												mStride;
+	float												*mVertices;
+	size_t												mNumVertices;
+	std::vector<uint32_t>								*mIndices;
+};
+
+// Uploads elements [uploaded, count) of 'data'. When 'buffer' is too small it's reallocated with room to grow and refilled entirely, and true is returned.
+template<typename T>
+bool uploadTail( VboRef *buffer, GLenum target, const T *data, size_t count, size_t uploaded )
+{
+	const size_t bytes = count * sizeof(T);
+	if( ! *buffer || (*buffer)->getSize() < bytes ) {
+		*buffer = Vbo::create( target, std::max<size_t>( bytes + bytes / 2, 4096 ), nullptr, GL_STATIC_DRAW );
+		(*buffer)->bufferSubData( 0, bytes, data );
+		return true;
+	}
+	else if( uploaded < count )
+		(*buffer)->bufferSubData( uploaded * sizeof(T), ( count - uploaded ) * sizeof(T), data + uploaded );
+
+	return false;
+}
+
+} // anonymous namespace
+
+//////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// MegaBatch::Format
+MegaBatch::Format::Format()
+	: mStorageBinding( 0 ), mDrawIdAttrib( "ciDrawId" )
+{
+	mAttribs.emplace_back( geom::Attrib::POSITION, 3 );
+	mAttribs.emplace_back( geom::Attrib::NORMAL, 3 );
+	mAttribs.emplace_back( geom::Attrib::TEX_COORD_0, 2 );
+}
+
+MegaBatch::Format& MegaBatch::Format::attrib( geom::Attrib attrib, uint8_t dims )
+{
+	for( auto &existing : mAttribs ) {
+		if( existing.first == attrib ) {
+			existing.second = dims;
+			return *this;
+		}
+	}
+
+	mAttribs.emplace_back( attrib, dims );
+	return *this;
+}
+
+//////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// MegaBatch
+MegaBatchRef MegaBatch::create( const GlslProgRef &glsl, const Format &format )
+{
+	return MegaBatchRef( new MegaBatch( glsl, format ) );
+}
+
+MegaBatch::MegaBatch( const GlslProgRef &glsl, const Format &format )
+	: mFormat( format ), mGlsl( glsl ), mVertexStride( 0 ), mNumVertices( 0 ), mNumVisible( 0 ),
+	mUploadedVertices( 0 ), mUploadedIndices( 0 ), mUploadedObjects( 0 ),
+	mDrawDataDirtyBegin( std::numeric_limits<size_t>::max() ), mDrawDataDirtyEnd( 0 ), mCommandsDirty( true ), mVaoDirty( true )
+{
+	static_assert( sizeof(DrawData) == 20 * sizeof(float), "DrawData must match its std430 layout" );
+	static_assert( sizeof(DrawCommand) == 5 * sizeof(GLuint), "DrawCommand must be tightly packed" );
+
+	for( const auto &attrib : mFormat.getAttribs() ) {
+		mAttribOffsets.push_back( mVertexStride );
+		mVertexStride += attrib.second;
+	}
+}
+
+uint32_t MegaBatch::add( const geom::Source &source, const mat4 &modelMatrix, const ColorAf &color )
+{
+	const geom::Primitive primitive = source.getPrimitive();
+	if( primitive != geom::Primitive::TRIANGLES && primitive != geom::Primitive::TRIANGLE_STRIP && primitive != geom::Primitive::TRIANGLE_FAN )
+		throw geom::ExcIllegalPrimitiveType();
+
+	Object object;
+	object.mBaseVertex = (uint32_t)mNumVertices;
+	object.mFirstIndex = (uint32_t)mIndices.size();
+	object.mVisible = true;
+
+	geom::AttribSet attribs;
+	for( const auto &attrib : mFormat.getAttribs() )
+		attribs.insert( attrib.first );
+
+	const size_t numVertices = source.getNumVertices();
+	mVertices.resize( ( mNumVertices + numVertices ) * mVertexStride, 0.0f );
+	MegaBatchGeomTarget target( mFormat.getAttribs(), mAttribOffsets, mVertexStride, mVertices.data() + mNumVertices * mVertexStride, numVertices, &mIndices );
+	source.loadInto( &target, attribs );
+	// if source is non-indexed, generate indices
+	if( source.getNumIndices() == 0 )
+		target.generateIndices( primitive, numVertices );
+
+	mNumVertices += numVertices;
+	object.mNumIndices = uint32_t( mIndices.size() - object.mFirstIndex );
+
+	const uint32_t index = (uint32_t)mObjects.size();
+	mObjects.push_back( object );
+	mDrawData.push_back( { modelMatrix, color } );
+	mDrawDataDirtyBegin = std::min<size_t>( mDrawDataDirtyBegin, index );
+	mDrawDataDirtyEnd = index + 1;
+	++mNumVisible;
+	mCommandsDirty = true;
+
+	return index;
+}
+
+uint32_t MegaBatch::add( const VboMeshRef &vboMesh, const mat4 &modelMatrix, const ColorAf &color )
+{
+	return add( *vboMesh->createSource(), modelMatrix, color );
+}
+
+void MegaBatch::clear()
+{
+	mObjects.clear();
+	mDrawData.clear();
+	mVertices.clear();
+	mIndices.clear();
+	mNumVertices = mNumVisible = 0;
+	// the draw ids are the same for any set of objects, so those stay uploaded
+	mUploadedVertices = mUploadedIndices = 0;
+	mDrawDataDirtyBegin = std::numeric_limits<size_t>::max();
+	mDrawDataDirtyEnd = 0;
+	mCommandsDirty = true;
+}
+
+void MegaBatch::setModelMatrix( uint32_t object, const mat4 &modelMatrix )
+{
+	mDrawData[object].mModelMatrix = modelMatrix;
+	mDrawDataDirtyBegin = std::min<size_t>( mDrawDataDirtyBegin, object );
+	mDrawDataDirtyEnd = std::max<size_t>( mDrawDataDirtyEnd, object + 1 );
+}
+
+void MegaBatch::setColor( uint32_t object, const ColorAf &color )
+{
+	mDrawData[object].mColor = color;
+	mDrawDataDirtyBegin = std::min<size_t>( mDrawDataDirtyBegin, object );
+	mDrawDataDirtyEnd = std::max<size_t>( mDrawDataDirtyEnd, object + 1 );
+}
+
+void MegaBatch::setVisible( uint32_t object, bool visible )
+{
+	if( mObjects[object].mVisible != visible ) {
+		mObjects[object].mVisible = visible;
+		mNumVisible = visible ? mNumVisible + 1 : mNumVisible - 1;
+		mCommandsDirty = true;
+	}
+}
+
+void MegaBatch::replaceGlslProg( const GlslProgRef &glsl )
+{
+	mGlsl = glsl;
+	mVaoDirty = true;
+}
+
+void MegaBatch::upload()
+{
+	// geometry is append-only, so only what was added since the last upload is new
+	if( uploadTail( &mVertexVbo, GL_ARRAY_BUFFER, mVertices.data(), mNumVertices * mVertexStride, mUploadedVertices * mVertexStride ) )
+		mVaoDirty = true;
+	if( uploadTail( &mIndexVbo, GL_ELEMENT_ARRAY_BUFFER, mIndices.data(), mIndices.size(), mUploadedIndices ) )
+		mVaoDirty = true;
+	mUploadedVertices = mNumVertices;
+	mUploadedIndices = mIndices.size();
+
+	// each object's draw id is its index, fetched through an instanced attribute offset by the command's baseInstance
+	if( mUploadedObjects < mObjects.size() ) {
+		std::vector<uint32_t> drawIds( mObjects.size() );
+		std::iota( drawIds.begin(), drawIds.end(), 0 );
+		if( uploadTail( &mDrawIdVbo, GL_ARRAY_BUFFER, drawIds.data(), drawIds.size(), mUploadedObjects ) )
+			mVaoDirty = true;
+		mUploadedObjects = mObjects.size();
+	}
+
+	const size_t drawDataBytes = mDrawData.size() * sizeof(DrawData);
+	if( ! mDrawDataSsbo || mDrawDataSsbo->getSize() < drawDataBytes ) {
+		mDrawDataSsbo = Ssbo::create( std::max<size_t>( drawDataBytes + drawDataBytes / 2, 64 * sizeof(DrawData) ), nullptr, GL_DYNAMIC_DRAW );
+		mDrawDataSsbo->bufferSubData( 0, drawDataBytes, mDrawData.data() );
+	}
+	else if( mDrawDataDirtyBegin < mDrawDataDirtyEnd )
+		mDrawDataSsbo->bufferSubData( mDrawDataDirtyBegin * sizeof(DrawData), ( mDrawDataDirtyEnd - mDrawDataDirtyBegin ) * sizeof(DrawData), mDrawData.data() + mDrawDataDirtyBegin );
+	mDrawDataDirtyBegin = std::numeric_limits<size_t>::max();
+	mDrawDataDirtyEnd = 0;
+
+	if( mCommandsDirty ) {
+		mCommands.clear();
+		for( size_t i = 0; i < mObjects.size(); ++i ) {
+			const auto &object = mObjects[i];
+			if( object.mVisible && object.mNumIndices > 0 )
+				mCommands.push_back( { object.mNumIndices, 1, object.mFirstIndex, (GLint)object.mBaseVertex, (GLuint)i } );
+		}
+
+		if( ! mIndirectVbo )
+			mIndirectVbo = Vbo::create( GL_DRAW_INDIRECT_BUFFER );
+		mIndirectVbo->bufferData( mCommands.size() * sizeof(DrawCommand), mCommands.data(), GL_DYNAMIC_DRAW );
+		mCommandsDirty = false;
+	}
+
+	if( mVaoDirty )
+		buildVao();
+}
+
+void MegaBatch::buildVao()
+{
+	auto ctx = gl::context();
+
+	mVao = Vao::create();
+	ScopedVao vaoScp( mVao );
+	{
+		ScopedBuffer vertexScp( mVertexVbo );
+		const auto &attribs = mFormat.getAttribs();
+		for( size_t i = 0; i < attribs.size(); ++i ) {
+			GLint loc = mGlsl->getAttribSemanticLocation( attribs[i].first );
+			if( loc >= 0 ) {
+				ctx->enableVertexAttribArray( loc );
+				ctx->vertexAttribPointer( loc, attribs[i].second, GL_FLOAT, GL_FALSE, GLsizei( mVertexStride * sizeof(float) ), (const GLvoid*)( mAttribOffsets[i] * sizeof(float) ) );
+			}
+		}
+	}
+
+	GLint drawIdLoc = mGlsl->getAttribLocation( mFormat.getDrawIdAttrib() );
+	if( drawIdLoc >= 0 ) {
+		ScopedBuffer drawIdScp( mDrawIdVbo );
+		ctx->enableVertexAttribArray( drawIdLoc );
+		ctx->vertexAttribIPointer( drawIdLoc, 1, GL_UNSIGNED_INT, 0, nullptr );
+		ctx->vertexAttribDivisor( drawIdLoc, 1 );
+	}
+	else
+		CI_LOG_W( "GlslProg has no '" << mFormat.getDrawIdAttrib() << "' attribute; every object will be drawn with the DrawData of object 0" );
+
+	// the element array binding is part of the VAO
+	mIndexVbo->bind();
+	mVaoDirty = false;
+}
+
+void MegaBatch::draw()
+{
+	if( mNumVisible == 0 )
+		return;
+
+	upload();
+	if( mCommands.empty() )
+		return;
+
+	auto ctx = gl::context();
+	ScopedGlslProg glslScp( mGlsl );
+	ScopedVao vaoScp( mVao );
+	ctx->setDefaultShaderVars();
+	ctx->bindBufferBase( GL_SHADER_STORAGE_BUFFER, mFormat.getStorageBinding(), mDrawDataSsbo );
+	ScopedBuffer indirectScp( mIndirectVbo );
+	ctx->multiDrawElementsIndirect( GL_TRIANGLES, GL_UNSIGNED_INT, nullptr, (GLsizei)mCommands.size(), 0 );
+}
+
+} } // namespace cinder::gl
+
+#endif // defined( CINDER_GL_HAS_MULTI_DRAW_INDIRECT )
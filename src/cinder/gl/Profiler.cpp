@@ -0,0 +1,426 @@
+/*
+ Copyright (c) 2026, The Cinder Project
+
+ This code is intended to be used with the Cinder C++ library, http://libcinder.org
+
+ Redistribution and use in source and binary forms, with or without modification, are permitted provided that
+ the following conditions are met:
+
+    * Redistributions of source code must retain the above copyright notice, this list of conditions and
+	the following disclaimer.
+    * Redistributions in binary form must reproduce the above copyright notice, this list of conditions and
+	the following disclaimer in the documentation and/or other materials provided with the distribution.
+
+ THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED
+ WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A
+ PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR
+ ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+ TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+ NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ POSSIBILITY OF SUCH DAMAGE.
+*/
+
+#include "cinder/gl/Profiler.h"
+#include "cinder/gl/Context.h"
+#include "cinder/Log.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <fstream>
+#include <iomanip>
+
+using namespace std;
+
+namespace cinder { namespace gl {
+
+namespace {
+
+uint64_t cpuNanoseconds()
+{
+	return (uint64_t)chrono::duration_cast<chrono::nanoseconds>( chrono::steady_clock::now().time_since_epoch() ).count();
+}
+
+bool isTimerQuerySupported()
+{
+#if defined( CINDER_GL_ES )
+	return false;
+#else
+	return Context::getCurrent() && ( GLAD_GL_VERSION_3_3 || GLAD_GL_ARB_timer_query );
+#endif
+}
+
+Profiler::Stats calcStats( vector<float> values )
+{
+	Profiler::Stats result;
+	if( values.empty() )
+		return result;
+
+	sort( values.begin(), values.end() );
+	double sum = 0;
+	for( float value : values )
+		sum += value;
+
+	// nearest-rank percentiles
+	auto percentile = [&values]( double p ) {
+		const size_t rank = (size_t)ceil( p * values.size() );
+		return (double)values[std::max<size_t>( rank, 1 ) - 1];
+	};
+
+	result.mMean = sum / values.size();
+	result.mMin = values.front();
+	result.mMax = values.back();
+	result.mP50 = percentile( 0.50 );
+	result.mP95 = percentile( 0.95 );
+	result.mP99 = percentile( 0.99 );
+	return result;
+}
+
+void writeJsonString( ostream &os, const string &str )
+{
+	os << '"';
+	for( char c : str ) {
+		if( c == '"' || c == '\\' )
+			os << '\\' << c;
+		else if( (unsigned char)c < 0x20 )
+			os << "\\u" << hex << setw( 4 ) << setfill( '0' ) << (int)c << dec << setfill( ' ' );
+		else
+			os << c;
+	}
+	os << '"';
+}
+
+void writeTraceEvent( ostream &os, const string &name, const char *category, int track, double beginMicroseconds, double durationMicroseconds )
+{
+	os << ",\n{\"name\":";
+	writeJsonString( os, name );
+	os << ",\"cat\":\"" << category << "\",\"ph\":\"X\",\"pid\":1,\"tid\":" << track << ",\"ts\":" << beginMicroseconds << ",\"dur\":" << durationMicroseconds << "}";
+}
+
+} // anonymous namespace
+
+Profiler::Profiler( const Options &options )
+	: mOptions( options ), mEnabled( true ), mEnableNextFrame( true ), mGpuTiming( false ),
+	mNumFrames( 0 ), mLastResolvedFrame( 0 ), mCapturing( false ), mMaxCaptureFrames( 0 ), mCaptureStartFrame( 0 ),
+	mNumQueriesAllocated( 0 ), mNumStalls( 0 )
+{
+	mFrame.mIndex = 0;
+	mFrame.mCpuBegin = cpuNanoseconds();
+	mFrame.mGpuTimed = false;
+}
+
+Profiler* Profiler::get()
+{
+	// never destroyed, since its queries can't be deleted once the gl::Context is gone. GPU timing starts with the first frame
+	// recorded while a gl::Context is current.
+	static Profiler *sInstance = new Profiler();
+	return sInstance;
+}
+
+int32_t Profiler::findChild( int32_t parent, const char *name )
+{
+	if( parent >= 0 ) {
+		for( int32_t child : mNodes[parent].mChildren ) {
+			if( mNodes[child].mName == name )
+				return child;
+		}
+	}
+	else {
+		for( int32_t node = 0; node < (int32_t)mNodes.size(); ++node ) {
+			if( mNodes[node].mParent < 0 && mNodes[node].mName == name )
+				return node;
+		}
+	}
+
+	Node node;
+	node.mName = name;
+	node.mParent = parent;
+	node.mDepth = ( parent >= 0 ) ? mNodes[parent].mDepth + 1 : 0;
+	mNodes.push_back( node );
+	const int32_t result = (int32_t)mNodes.size() - 1;
+	if( parent >= 0 )
+		mNodes[parent].mChildren.push_back( result );
+	return result;
+}
+
+#if ! defined( CINDER_GL_ES )
+QueryRef Profiler::timestamp()
+{
+	QueryRef result;
+	if( mQueryPool.empty() ) {
+		result = Query::create( GL_TIMESTAMP );
+		++mNumQueriesAllocated;
+	}
+	else {
+		result = std::move( mQueryPool.back() );
+		mQueryPool.pop_back();
+	}
+
+	glQueryCounter( result->getId(), GL_TIMESTAMP );
+	mFrame.mLastQuery = result;
+	return result;
+}
+#endif
+
+void Profiler::beginFrame()
+{
+	// Checked here rather than at construction, which may happen before there is a gl::Context. Once enabled, GPU timing stays on.
+	if( ! mGpuTiming && mOptions.isGpuTiming() )
+		mGpuTiming = isTimerQuerySupported();
+
+	mFrame.mGpuTimed = mGpuTiming;
+}
+
+void Profiler::begin( const char *name )
+{
+	if( ! mEnabled )
+		return;
+
+	if( mFrame.mSamples.empty() )
+		beginFrame();
+
+	Sample sample;
+	sample.mNode = findChild( mStack.empty() ? -1 : mFrame.mSamples[mStack.back()].mNode, name );
+	sample.mGpuBegin = sample.mGpuEnd = 0;
+#if ! defined( CINDER_GL_ES )
+	if( mGpuTiming )
+		sample.mGpuBeginQuery = timestamp();
+#endif
+	sample.mCpuBegin = cpuNanoseconds();
+	sample.mCpuEnd = sample.mCpuBegin;
+
+	mStack.push_back( mFrame.mSamples.size() );
+	mFrame.mSamples.push_back( std::move( sample ) );
+}
+
+void Profiler::end()
+{
+	if( ! mEnabled || mStack.empty() )
+		return;
+
+	Sample &sample = mFrame.mSamples[mStack.back()];
+	mStack.pop_back();
+	sample.mCpuEnd = cpuNanoseconds();
+#if ! defined( CINDER_GL_ES )
+	if( mGpuTiming )
+		sample.mGpuEndQuery = timestamp();
+#endif
+}
+
+void Profiler::endFrame()
+{
+	if( ! mStack.empty() ) {
+		CI_LOG_W( "Closing " << mStack.size() << " scope(s) left open at the end of the frame" );
+		while( ! mStack.empty() )
+			end();
+	}
+
+	const uint64_t now = cpuNanoseconds();
+	if( mEnabled ) {
+		mFrame.mCpuEnd = now;
+		mFrame.mGpuOffset = 0;
+#if ! defined( CINDER_GL_ES )
+		if( mFrame.mGpuTimed && mCapturing ) {
+			GLint64 gpuNow = 0;
+			glGetInteger64v( GL_TIMESTAMP, &gpuNow );
+			mFrame.mGpuOffset = (int64_t)gpuNow - (int64_t)cpuNanoseconds();
+		}
+#endif
+		mFrameHistory.push_back( float( ( now - mFrame.mCpuBegin ) / 1.0e6 ) );
+		while( mFrameHistory.size() > mOptions.getHistorySize() )
+			mFrameHistory.pop_front();
+		mPendingFrames.push_back( std::move( mFrame ) );
+	}
+
+	mFrame = Frame();
+	mFrame.mIndex = ++mNumFrames;
+	mFrame.mCpuBegin = now;
+	mFrame.mGpuTimed = false;
+
+	while( ! mPendingFrames.empty() ) {
+		Frame &oldest = mPendingFrames.front();
+		if( ! isReady( oldest ) ) {
+			if( mPendingFrames.size() <= mOptions.getMaxFramesInFlight() )
+				break;
+			++mNumStalls;
+		}
+
+		resolve( oldest );
+		accumulate( oldest );
+		if( mCapturing && oldest.mIndex >= mCaptureStartFrame ) {
+			mCapture.push_back( std::move( oldest ) );
+			if( mCapture.size() >= mMaxCaptureFrames )
+				mCapturing = false;
+		}
+		mPendingFrames.pop_front();
+	}
+
+	mEnabled = mEnableNextFrame;
+}
+
+bool Profiler::isReady( const Frame &frame ) const
+{
+#if ! defined( CINDER_GL_ES )
+	// queries complete in the order they're issued
+	if( frame.mLastQuery )
+		return frame.mLastQuery->isReady();
+#endif
+	return true;
+}
+
+void Profiler::resolve( Frame &frame )
+{
+#if ! defined( CINDER_GL_ES )
+	for( auto &sample : frame.mSamples ) {
+		if( sample.mGpuBeginQuery ) {
+			sample.mGpuBegin = sample.mGpuBeginQuery->getValueUInt64();
+			mQueryPool.push_back( std::move( sample.mGpuBeginQuery ) );
+		}
+		if( sample.mGpuEndQuery ) {
+			sample.mGpuEnd = sample.mGpuEndQuery->getValueUInt64();
+			mQueryPool.push_back( std::move( sample.mGpuEndQuery ) );
+		}
+		sample.mGpuBeginQuery.reset();
+		sample.mGpuEndQuery.reset();
+	}
+	frame.mLastQuery.reset();
+#endif
+}
+
+void Profiler::accumulate( const Frame &frame )
+{
+	mHistories.resize( mNodes.size() );
+	vector<History::Entry> entries( mNodes.size(), History::Entry{ frame.mIndex, 0, 0, 0 } );
+	for( const auto &sample : frame.mSamples ) {
+		auto &entry = entries[sample.mNode];
+		entry.mCpuMs += float( ( sample.mCpuEnd - sample.mCpuBegin ) / 1.0e6 );
+		if( sample.mGpuEnd > sample.mGpuBegin )
+			entry.mGpuMs += float( ( sample.mGpuEnd - sample.mGpuBegin ) / 1.0e6 );
+		++entry.mCalls;
+	}
+
+	mLastResolvedFrame = frame.mIndex;
+	for( size_t node = 0; node < entries.size(); ++node ) {
+		if( entries[node].mCalls == 0 )
+			continue;
+		auto &history = mHistories[node].mEntries;
+		history.push_back( entries[node] );
+		while( ! history.empty() && ! isInHistory( history.front() ) )
+			history.pop_front();
+	}
+}
+
+bool Profiler::isInHistory( const History::Entry &entry ) const
+{
+	return entry.mFrame + mOptions.getHistorySize() > mLastResolvedFrame;
+}
+
+vector<Profiler::ScopeStats> Profiler::getStats() const
+{
+	vector<ScopeStats> result;
+	for( int32_t node = 0; node < (int32_t)mNodes.size(); ++node ) {
+		if( mNodes[node].mParent < 0 )
+			appendStats( node, &result );
+	}
+
+	return result;
+}
+
+void Profiler::appendStats( int32_t node, vector<ScopeStats> *result ) const
+{
+	if( node >= (int32_t)mHistories.size() )
+		return;
+
+	vector<float> cpuMs, gpuMs;
+	size_t numCalls = 0;
+	for( const auto &entry : mHistories[node].mEntries ) {
+		if( ! isInHistory( entry ) )
+			continue;
+		cpuMs.push_back( entry.mCpuMs );
+		gpuMs.push_back( entry.mGpuMs );
+		numCalls += entry.mCalls;
+	}
+	// a scope that wasn't entered can't have children that were
+	if( cpuMs.empty() )
+		return;
+
+	ScopeStats stats;
+	stats.mName = mNodes[node].mName;
+	stats.mPath = stats.mName;
+	for( int32_t parent = mNodes[node].mParent; parent >= 0; parent = mNodes[parent].mParent )
+		stats.mPath = mNodes[parent].mName + "/" + stats.mPath;
+	stats.mDepth = mNodes[node].mDepth;
+	stats.mNumFrames = cpuMs.size();
+	stats.mCallsPerFrame = numCalls / (double)cpuMs.size();
+	stats.mCpu = calcStats( std::move( cpuMs ) );
+	stats.mGpu = calcStats( std::move( gpuMs ) );
+	result->push_back( stats );
+
+	for( int32_t child : mNodes[node].mChildren )
+		appendStats( child, result );
+}
+
+Profiler::Stats Profiler::getFrameStats() const
+{
+	return calcStats( getFrameHistory() );
+}
+
+vector<float> Profiler::getFrameHistory() const
+{
+	return vector<float>( mFrameHistory.begin(), mFrameHistory.end() );
+}
+
+void Profiler::clearStats()
+{
+	mHistories.clear();
+	mFrameHistory.clear();
+}
+
+void Profiler::startCapture( size_t maxFrames )
+{
+	mCapture.clear();
+	mMaxCaptureFrames = std::max<size_t>( maxFrames, 1 );
+	// frames still waiting for the GPU were closed without measuring the clock offset
+	mCaptureStartFrame = mFrame.mIndex;
+	mCapturing = true;
+}
+
+void Profiler::writeChromeTrace( ostream &os ) const
+{
+	os << "{\"traceEvents\":[\n";
+	os << "{\"name\":\"process_name\",\"ph\":\"M\",\"pid\":1,\"args\":{\"name\":\"Cinder\"}},\n";
+	os << "{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,\"tid\":1,\"args\":{\"name\":\"CPU\"}},\n";
+	os << "{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,\"tid\":2,\"args\":{\"name\":\"GPU\"}}";
+
+	if( ! mCapture.empty() ) {
+		const int64_t base = (int64_t)mCapture.front().mCpuBegin;
+		os << fixed << setprecision( 3 );
+		for( const auto &frame : mCapture ) {
+			writeTraceEvent( os, "Frame " + to_string( frame.mIndex ), "frame", 1, ( (int64_t)frame.mCpuBegin - base ) / 1000.0, ( frame.mCpuEnd - frame.mCpuBegin ) / 1000.0 );
+			for( const auto &sample : frame.mSamples ) {
+				const string &name = mNodes[sample.mNode].mName;
+				writeTraceEvent( os, name, "cpu", 1, ( (int64_t)sample.mCpuBegin - base ) / 1000.0, ( sample.mCpuEnd - sample.mCpuBegin ) / 1000.0 );
+				if( frame.mGpuTimed && sample.mGpuEnd >= sample.mGpuBegin && sample.mGpuBegin != 0 ) {
+					const int64_t gpuBegin = (int64_t)sample.mGpuBegin - frame.mGpuOffset - base;
+					writeTraceEvent( os, name, "gpu", 2, gpuBegin / 1000.0, ( sample.mGpuEnd - sample.mGpuBegin ) / 1000.0 );
+				}
+			}
+		}
+	}
+
+	os << "\n],\"displayTimeUnit\":\"ms\"}\n";
+}
+
+void Profiler::writeChromeTrace( const fs::path &path ) const
+{
+	ofstream os( path.string(), ofstream::binary );
+	if( ! os ) {
+		CI_LOG_E( "Failed to open " << path << " for writing" );
+		return;
+	}
+
+	writeChromeTrace( os );
+}
+
+} } // namespace cinder::gl
@@ -0,0 +1,266 @@
+/*
+ Copyright (c) 2026, The Cinder Project
+
+ This code is intended to be used with the Cinder C++ library, http://libcinder.org
+
+ Redistribution and use in source and binary forms, with or without modification, are permitted provided that
+ the following conditions are met:
+
+    * Redistributions of source code must retain the above copyright notice, this list of conditions and
+	the following disclaimer.
+    * Redistributions in binary form must reproduce the above copyright notice, this list of conditions and
+	the following disclaimer in the documentation and/or other materials provided with the distribution.
+
+ THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED
+ WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A
+ PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR
+ ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+ TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+ NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ POSSIBILITY OF SUCH DAMAGE.
+*/
+
+#include "cinder/gl/ProgramBinaryCache.h"
+#include "cinder/gl/wrapper.h"
+#include "cinder/Log.h"
+#include "cinder/Stream.h"
+
+#include <iomanip>
+#include <sstream>
+
+using namespace std;
+
+namespace cinder { namespace gl {
+
+namespace {
+
+const uint32_t	BINARY_MAGIC = 0x42504943; // "CIPB"
+const uint32_t	BINARY_FILE_VERSION = 1;
+const char		*BINARY_EXTENSION = ".cibin";
+
+bool isProgramBinarySupported()
+{
+#if defined( CINDER_GL_ES_2 )
+	return false;
+#else
+  #if ! defined( CINDER_GL_ES )
+	if( ! ( GLAD_GL_VERSION_4_1 || GLAD_GL_ARB_get_program_binary ) )
+		return false;
+  #endif
+	// some drivers expose the entry points without supporting any binary format
+	GLint numFormats = 0;
+	glGetIntegerv( GL_NUM_PROGRAM_BINARY_FORMATS, &numFormats );
+	return numFormats > 0;
+#endif
+}
+
+} // anonymous namespace
+
+ProgramBinaryCache* ProgramBinaryCache::get()
+{
+	static ProgramBinaryCache sInstance;
+	return &sInstance;
+}
+
+ProgramBinaryCache::ProgramBinaryCache()
+	: mEnabled( false ), mTimingEnabled( false ), mTimingLogEnabled( false ), mNumHits( 0 ), mNumMisses( 0 )
+{
+}
+
+void ProgramBinaryCache::enable( const fs::path &directory )
+{
+	mDirectory = directory;
+	mEnabled = true;
+	mNumHits = mNumMisses = 0;
+}
+
+void ProgramBinaryCache::disable()
+{
+	mEnabled = false;
+}
+
+bool ProgramBinaryCache::isEnabled() const
+{
+	if( ! mEnabled )
+		return false;
+
+	// a process may create contexts from several drivers, so this can't be decided once
+	return isProgramBinarySupported();
+}
+
+void ProgramBinaryCache::clear()
+{
+	std::error_code ec;
+	if( mDirectory.empty() || ! fs::is_directory( mDirectory, ec ) )
+		return;
+
+	for( fs::directory_iterator it( mDirectory, ec ), end; ! ec && it != end; it.increment( ec ) ) {
+		if( it->path().extension() == BINARY_EXTENSION )
+			fs::remove( it->path(), ec );
+	}
+}
+
+uint64_t ProgramBinaryCache::hash( const void *data, size_t size, uint64_t hash )
+{
+	const uint8_t *bytes = reinterpret_cast<const uint8_t*>( data );
+	for( size_t i = 0; i < size; ++i )
+		hash = ( hash ^ bytes[i] ) * 1099511628211ULL;
+	return hash;
+}
+
+uint64_t ProgramBinaryCache::hash( const std::string &str, uint64_t hash )
+{
+	uint64_t length = str.size();
+	hash = ProgramBinaryCache::hash( &length, sizeof( length ), hash );
+	return ProgramBinaryCache::hash( str.data(), str.size(), hash );
+}
+
+uint64_t ProgramBinaryCache::hashDriver( uint64_t key )
+{
+	key = hash( getVendorString(), key );
+	key = hash( getString( GL_RENDERER ), key );
+	key = hash( getVersionString(), key );
+	return hash( &BINARY_FILE_VERSION, sizeof( BINARY_FILE_VERSION ), key );
+}
+
+fs::path ProgramBinaryCache::getBinaryPath( uint64_t key ) const
+{
+	stringstream ss;
+	ss << hex << setw( 16 ) << setfill( '0' ) << key << BINARY_EXTENSION;
+	return mDirectory / ss.str();
+}
+
+bool ProgramBinaryCache::load( GLuint program, uint64_t key )
+{
+#if defined( CINDER_GL_ES_2 )
+	return false;
+#else
+	const fs::path path = getBinaryPath( key );
+	std::error_code ec;
+	if( ! fs::exists( path, ec ) ) {
+		++mNumMisses;
+		return false;
+	}
+
+	bool loaded = false;
+	try {
+		IStreamFileRef stream = loadFileStream( path );
+		if( stream ) {
+			uint32_t magic, fileVersion, binaryFormat, binarySize;
+			uint64_t fileKey;
+			stream->readLittle( &magic );
+			stream->readLittle( &fileVersion );
+			stream->readLittle( &fileKey );
+			stream->readLittle( &binaryFormat );
+			stream->readLittle( &binarySize );
+			if( magic == BINARY_MAGIC && fileVersion == BINARY_FILE_VERSION && fileKey == key && binarySize > 0 && (off_t)binarySize == stream->size() - stream->tell() ) {
+				vector<uint8_t> binary( binarySize );
+				stream->readData( binary.data(), binarySize );
+				glProgramBinary( program, (GLenum)binaryFormat, binary.data(), (GLsizei)binarySize );
+
+				GLint status = GL_FALSE;
+				glGetProgramiv( program, GL_LINK_STATUS, &status );
+				loaded = ( status == GL_TRUE );
+			}
+		}
+	}
+	catch( const std::exception &exc ) {
+		CI_LOG_W( "failed to read program binary " << path << ": " << exc.what() );
+	}
+
+	if( ! loaded ) {
+		// truncated, written by another version, or rejected by the driver; it will be replaced once the program links from source
+		CI_LOG_I( "discarding program binary " << path );
+		fs::remove( path, ec );
+		++mNumMisses;
+		return false;
+	}
+
+	++mNumHits;
+	return true;
+#endif
+}
+
+void ProgramBinaryCache::save( GLuint program, uint64_t key )
+{
+#if ! defined( CINDER_GL_ES_2 )
+	GLint binarySize = 0;
+	glGetProgramiv( program, GL_PROGRAM_BINARY_LENGTH, &binarySize );
+	if( binarySize <= 0 )
+		return;
+
+	vector<uint8_t> binary( binarySize );
+	GLenum binaryFormat = 0;
+	GLsizei length = 0;
+	glGetProgramBinary( program, binarySize, &length, &binaryFormat, binary.data() );
+	if( length <= 0 )
+		return;
+
+	// write to a temporary file and rename it, so that a crash or a concurrent process never leaves a partial binary behind the key
+	const fs::path path = getBinaryPath( key );
+	fs::path tempPath = path;
+	tempPath += ".tmp";
+	try {
+		{
+			OStreamFileRef stream = writeFileStream( tempPath, true );
+			if( ! stream )
+				throw StreamExc( "couldn't open " + tempPath.string() );
+			stream->writeLittle( BINARY_MAGIC );
+			stream->writeLittle( BINARY_FILE_VERSION );
+			stream->writeLittle( key );
+			stream->writeLittle( (uint32_t)binaryFormat );
+			stream->writeLittle( (uint32_t)length );
+			stream->writeData( binary.data(), length );
+		}
+		fs::rename( tempPath, path );
+	}
+	catch( const std::exception &exc ) {
+		CI_LOG_W( "failed to write program binary " << path << ": " << exc.what() );
+		std::error_code ec;
+		fs::remove( tempPath, ec );
+	}
+#endif
+}
+
+void ProgramBinaryCache::addTiming( const ProgramTiming &timing )
+{
+	if( ! mTimingEnabled )
+		return;
+
+	mTimings.push_back( timing );
+	if( mTimingLogEnabled ) {
+		CI_LOG_I( "\"" << timing.mName << "\" " << ( timing.mLoadedFromCache ? "loaded" : "compiled" ) << " in " << timing.getTotalSeconds() * 1000 << " ms (preprocess: "
+			<< timing.mPreprocessSeconds * 1000 << ", compile: " << timing.mCompileSeconds * 1000 << ", link: " << timing.mLinkSeconds * 1000
+			<< ", load: " << timing.mLoadSeconds * 1000 << ", save: " << timing.mSaveSeconds * 1000 << ")" );
+	}
+}
+
+void ProgramBinaryCache::printTimings( std::ostream &os ) const
+{
+	const auto flags = os.flags();
+	const auto precision = os.precision();
+
+	os << "program                         source  preprocess ms  compile ms  link ms  load ms  save ms  total ms" << endl;
+	ProgramTiming total = {};
+	for( const auto &timing : mTimings ) {
+		string name = timing.mName.size() > 30 ? "..." + timing.mName.substr( timing.mName.size() - 27 ) : timing.mName;
+		os << left << setw( 30 ) << name << right << "  " << setw( 6 ) << ( timing.mLoadedFromCache ? "cache" : "source" ) << fixed << setprecision( 3 )
+			<< "  " << setw( 13 ) << timing.mPreprocessSeconds * 1000 << "  " << setw( 10 ) << timing.mCompileSeconds * 1000 << "  " << setw( 7 ) << timing.mLinkSeconds * 1000
+			<< "  " << setw( 7 ) << timing.mLoadSeconds * 1000 << "  " << setw( 7 ) << timing.mSaveSeconds * 1000 << "  " << setw( 8 ) << timing.getTotalSeconds() * 1000 << endl;
+
+		total.mPreprocessSeconds += timing.mPreprocessSeconds;
+		total.mCompileSeconds += timing.mCompileSeconds;
+		total.mLinkSeconds += timing.mLinkSeconds;
+		total.mLoadSeconds += timing.mLoadSeconds;
+		total.mSaveSeconds += timing.mSaveSeconds;
+	}
+	os << left << setw( 30 ) << ( to_string( mTimings.size() ) + " programs" ) << right << "  " << setw( 6 ) << "" << fixed << setprecision( 3 )
+		<< "  " << setw( 13 ) << total.mPreprocessSeconds * 1000 << "  " << setw( 10 ) << total.mCompileSeconds * 1000 << "  " << setw( 7 ) << total.mLinkSeconds * 1000
+		<< "  " << setw( 7 ) << total.mLoadSeconds * 1000 << "  " << setw( 7 ) << total.mSaveSeconds * 1000 << "  " << setw( 8 ) << total.getTotalSeconds() * 1000 << endl;
+
+	os.flags( flags );
+	os.precision( precision );
+}
+
+} } // namespace cinder::gl
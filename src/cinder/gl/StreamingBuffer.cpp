@@ -0,0 +1,146 @@
+/*
+ Copyright (c) 2026, The Cinder Project
+
+ This code is intended to be used with the Cinder C++ library, http://libcinder.org
+
+ Redistribution and use in source and binary forms, with or without modification, are permitted provided that
+ the following conditions are met:
+
+    * Redistributions of source code must retain the above copyright notice, this list of conditions and
+	the following disclaimer.
+    * Redistributions in binary form must reproduce the above copyright notice, this list of conditions and
+	the following disclaimer in the documentation and/or other materials provided with the distribution.
+
+ THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED
+ WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A
+ PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR
+ ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+ TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+ NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ POSSIBILITY OF SUCH DAMAGE.
+*/
+
+#include "cinder/gl/StreamingBuffer.h"
+#include "cinder/gl/scoped.h"
+
+#include <cstring>
+
+namespace cinder { namespace gl {
+
+namespace {
+
+GLsizeiptr roundUp( GLsizeiptr value, GLsizeiptr multiple )
+{
+	return ( ( value + multiple - 1 ) / multiple ) * multiple;
+}
+
+} // anonymous namespace
+
+StreamingBufferRef StreamingBuffer::create( GLenum target, GLsizeiptr size, size_t numSegments )
+{
+	return StreamingBufferRef( new StreamingBuffer( target, size, numSegments ) );
+}
+
+StreamingBuffer::StreamingBuffer( GLenum target, GLsizeiptr size, size_t numSegments )
+	: mTarget( target ), mSize( 0 ), mHead( 0 ), mNumSegments( std::max<size_t>( 1, numSegments ) ), mCurrentSegment( 0 ), mMappedData( nullptr )
+{
+	allocate( size );
+}
+
+StreamingBuffer::~StreamingBuffer()
+{
+	// deleting the buffer implicitly unmaps it, and the Context may already be gone
+	mMappedData = nullptr;
+}
+
+void StreamingBuffer::allocate( GLsizeiptr size )
+{
+	release();
+
+	mSize = roundUp( std::max<GLsizeiptr>( 1, size ), (GLsizeiptr)mNumSegments );
+	mHead = 0;
+	mCurrentSegment = 0;
+
+#if defined( GL_VERSION_4_4 )
+	if( GLAD_GL_VERSION_4_4 || GLAD_GL_ARB_buffer_storage ) {
+		const GLbitfield flags = GL_MAP_WRITE_BIT | GL_MAP_PERSISTENT_BIT | GL_MAP_COHERENT_BIT;
+		mBuffer = Vbo::create( mTarget );
+		ScopedBuffer bufferBind( mBuffer );
+		glBufferStorage( mTarget, mSize, nullptr, flags );
+		mMappedData = reinterpret_cast<uint8_t*>( glMapBufferRange( mTarget, 0, mSize, flags ) );
+	}
+#endif
+	// immutable storage can't be respecified, so start over with a regular buffer if mapping failed
+	if( ! mMappedData )
+		mBuffer = Vbo::create( mTarget, mSize, nullptr, GL_STREAM_DRAW );
+
+#if ! defined( CINDER_GL_ES ) || defined( CINDER_GL_ES_3 )
+	mSegmentFences.assign( mNumSegments, nullptr );
+#endif
+}
+
+void StreamingBuffer::release()
+{
+	if( mMappedData ) {
+		mBuffer->unmap();
+		mMappedData = nullptr;
+	}
+	mBuffer.reset();
+
+#if ! defined( CINDER_GL_ES ) || defined( CINDER_GL_ES_3 )
+	mSegmentFences.clear();
+#endif
+}
+
+void StreamingBuffer::beginSegment( size_t segment )
+{
+#if ! defined( CINDER_GL_ES ) || defined( CINDER_GL_ES_3 )
+	mSegmentFences[mCurrentSegment] = Sync::create();
+	if( mSegmentFences[segment] ) {
+		mSegmentFences[segment]->clientWaitSync();
+		mSegmentFences[segment].reset();
+	}
+#endif
+	mCurrentSegment = segment;
+}
+
+GLintptr StreamingBuffer::write( const void *data, GLsizeiptr size, GLsizeiptr alignment )
+{
+	alignment = std::max<GLsizeiptr>( 1, alignment );
+	if( size > getSegmentSize() )
+		allocate( roundUp( size, alignment ) * (GLsizeiptr)mNumSegments );
+
+	GLintptr offset = roundUp( mHead, alignment );
+	if( offset + size > mSize ) {
+		beginSegment( 0 );
+		offset = 0;
+	}
+	else {
+		const size_t lastSegment = size_t( ( offset + std::max<GLsizeiptr>( 1, size ) - 1 ) / getSegmentSize() );
+		for( size_t segment = mCurrentSegment + 1; segment <= lastSegment; ++segment )
+			beginSegment( segment );
+	}
+
+	if( mMappedData ) {
+		memcpy( mMappedData + offset, data, size );
+	}
+	else {
+		void *dst = nullptr;
+#if defined( CINDER_GL_HAS_MAP_BUFFER_RANGE ) && ( ! defined( CINDER_GL_ES ) || defined( CINDER_GL_ES_3 ) )
+		// the segment fences already guarantee the GPU is done with this range
+		dst = mBuffer->mapBufferRange( offset, size, GL_MAP_WRITE_BIT | GL_MAP_INVALIDATE_RANGE_BIT | GL_MAP_UNSYNCHRONIZED_BIT );
+		if( dst ) {
+			memcpy( dst, data, size );
+			mBuffer->unmap();
+		}
+#endif
+		if( ! dst )
+			mBuffer->bufferSubData( offset, size, data );
+	}
+
+	mHead = offset + size;
+	return offset;
+}
+
+} } // namespace cinder::gl
@@ -0,0 +1,419 @@
+/*
+ Copyright (c) 2026, The Cinder Project
+
+ This code is intended to be used with the Cinder C++ library, http://libcinder.org
+
+ Redistribution and use in source and binary forms, with or without modification, are permitted provided that
+ the following conditions are met:
+
+    * Redistributions of source code must retain the above copyright notice, this list of conditions and
+	the following disclaimer.
+    * Redistributions in binary form must reproduce the above copyright notice, this list of conditions and
+	the following disclaimer in the documentation and/or other materials provided with the distribution.
+
+ THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED
+ WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A
+ PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR
+ ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+ TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+ NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ POSSIBILITY OF SUCH DAMAGE.
+*/
+
+#include "cinder/gl/TextureStreamingService.h"
+
+#if ! defined( CINDER_GL_ES ) || defined( CINDER_GL_ES_3 )
+
+#include "cinder/gl/Context.h"
+#include "cinder/gl/scoped.h"
+#include "cinder/gl/StreamingBuffer.h"
+#include "cinder/ip/Flip.h"
+#include "cinder/Thread.h"
+
+#include <algorithm>
+
+using namespace std;
+
+namespace cinder { namespace gl {
+
+namespace {
+
+// Rates are recomputed once this much time has passed between calls to update()
+const double RATE_INTERVAL_SECONDS = 0.5;
+
+// Decodes into tightly packed RGB or RGBA rows, flipped to match the Texture's orientation
+template<typename T>
+void packImage( const ImageSourceRef &imageSource, bool alpha, bool topDown, vector<uint8_t> *result )
+{
+	SurfaceT<T> decoded( imageSource, SurfaceConstraintsDefault(), alpha );
+	const int32_t rowBytes = decoded.getWidth() * ( alpha ? 4 : 3 ) * (int32_t)sizeof(T);
+	result->resize( rowBytes * decoded.getHeight() );
+
+	SurfaceT<T> packed( reinterpret_cast<T*>( result->data() ), decoded.getWidth(), decoded.getHeight(), rowBytes, alpha ? SurfaceChannelOrder::RGBA : SurfaceChannelOrder::RGB );
+	if( topDown )
+		packed.copyFrom( decoded, decoded.getBounds() );
+	else
+		ip::flipVertical( decoded, &packed );
+}
+
+} // anonymous namespace
+
+///////////////////////////////////////////////////////////////////////////////
+// TextureStreamRequest
+TextureStreamRequest::TextureStreamRequest( const function<ImageSourceRef ()> &loadFn, const function<void ( Texture2dRef )> &callback, const Texture2d::Format &format, int priority )
+	: mLoadFn( loadFn ), mCallback( callback ), mFormat( format ), mPriority( priority ), mState( QUEUED )
+{
+}
+
+bool TextureStreamRequest::setState( State expected, State desired )
+{
+	int state = expected;
+	return mState.compare_exchange_strong( state, desired );
+}
+
+bool TextureStreamRequest::finish( State state )
+{
+	int current = mState.load();
+	while( current < COMPLETED ) {
+		if( mState.compare_exchange_weak( current, state ) )
+			return true;
+	}
+
+	return false;
+}
+
+void TextureStreamRequest::cancel()
+{
+	if( finish( CANCELED ) && mDecodeRequest )
+		mDecodeRequest->cancel();
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// TextureStreamingService
+bool TextureStreamingService::DecodedImage::operator<( const DecodedImage &rhs ) const
+{
+	const int priority = mRequest->getPriority(), rhsPriority = rhs.mRequest->getPriority();
+	return priority < rhsPriority || ( priority == rhsPriority && mSequence > rhs.mSequence );
+}
+
+bool TextureStreamingService::QueuedRequest::operator<( const QueuedRequest &rhs ) const
+{
+	const int priority = mRequest->getPriority(), rhsPriority = rhs.mRequest->getPriority();
+	return priority < rhsPriority || ( priority == rhsPriority && mSequence > rhs.mSequence );
+}
+
+TextureStreamingService::TextureStreamingService( const Options &options )
+	: mOptions( options ), mResidentBytes( 0 ), mSequence( 0 ), mNumCompleted( 0 ), mNumFailed( 0 ),
+	mRateDecodedBytes( 0 ), mRateUploadedBytes( 0 ), mDecodeBytesPerSecond( 0 ), mUploadBytesPerSecond( 0 ),
+	mUploadSequence( 0 ), mInFlightBytes( 0 ), mDecodedBytes( 0 ), mUploadedBytes( 0 ), mQuit( false )
+{
+	mDecoder.reset( new ImageDecodeService( ImageDecodeService::Options().numThreads( options.getNumDecodeThreads() ).dispatchToApp( false ) ) );
+	mRateTimer.start();
+
+	// the upload Context has to be created on the thread of the Context it shares with
+	ContextRef uploadContext = Context::create( context() );
+	mUploadThread = thread( bind( &TextureStreamingService::uploadThreadEntry, this, uploadContext ) );
+}
+
+TextureStreamingService::~TextureStreamingService()
+{
+	cancelAll();
+	// no decoding thread can reach the upload queue once the decoder is gone
+	mDecoder.reset();
+
+	{
+		lock_guard<mutex> lock( mMutex );
+		mQuit = true;
+	}
+	mUploadCond.notify_all();
+	mUploadThread.join();
+}
+
+TextureStreamRequestRef TextureStreamingService::load( const fs::path &path, const function<void ( Texture2dRef )> &callback, const Texture2d::Format &format, int priority )
+{
+	return enqueue( [path] { return loadImage( path ); }, callback, format, priority );
+}
+
+TextureStreamRequestRef TextureStreamingService::load( const DataSourceRef &dataSource, const function<void ( Texture2dRef )> &callback, const Texture2d::Format &format, int priority )
+{
+	return enqueue( [dataSource] { return loadImage( dataSource ); }, callback, format, priority );
+}
+
+TextureStreamRequestRef TextureStreamingService::enqueue( const function<ImageSourceRef ()> &loadFn, const function<void ( Texture2dRef )> &callback, const Texture2d::Format &format, int priority )
+{
+	TextureStreamRequestRef request( new TextureStreamRequest( loadFn, callback, format, priority ) );
+	mQueued.push_back( { request, mSequence++ } );
+	push_heap( mQueued.begin(), mQueued.end() );
+
+	admit();
+	return request;
+}
+
+void TextureStreamingService::admit()
+{
+	const size_t budget = mOptions.getMemoryBudget();
+	while( ! mQueued.empty() ) {
+		const TextureStreamRequestRef &request = mQueued.front().mRequest;
+		if( budget && request->getState() == TextureStreamRequest::QUEUED ) {
+			// the size of an image isn't known until it's decoded, so limit how many are decoded at once to bound the overshoot
+			if( mDecoding.size() >= mDecoder->getNumThreads() )
+				break;
+			const bool idle = mDecoding.empty() && mInFlightBytes == 0;
+			if( mResidentBytes + mInFlightBytes >= budget && ! idle )
+				break;
+		}
+
+		pop_heap( mQueued.begin(), mQueued.end() );
+		TextureStreamRequestRef admitted = mQueued.back().mRequest;
+		mQueued.pop_back();
+		if( ! admitted->setState( TextureStreamRequest::QUEUED, TextureStreamRequest::DECODING ) )
+			continue;
+
+		mDecoding.push_back( admitted );
+		admitted->mDecodeRequest = mDecoder->enqueue( [this, admitted] { decode( admitted ); }, [] {}, admitted->getPriority() );
+	}
+}
+
+void TextureStreamingService::decode( const TextureStreamRequestRef &request )
+{
+	if( request->getState() != TextureStreamRequest::DECODING )
+		return;
+
+	DecodedImage image;
+	try {
+		ImageSourceRef imageSource = request->mLoadFn();
+		image.mAlpha = imageSource->hasAlpha();
+		image.mFloat = imageSource->getDataType() == ImageIo::FLOAT32 || imageSource->getDataType() == ImageIo::FLOAT16;
+		if( image.mFloat )
+			packImage<float>( imageSource, image.mAlpha, request->mFormat.isLoadTopDown(), &image.mData );
+		else
+			packImage<uint8_t>( imageSource, image.mAlpha, request->mFormat.isLoadTopDown(), &image.mData );
+		image.mWidth = imageSource->getWidth();
+		image.mHeight = imageSource->getHeight();
+	}
+	catch( ... ) {
+		fail( request, current_exception(), 0 );
+		return;
+	}
+
+	// a full mip chain adds a third to the base level
+	image.mTextureBytes = image.mData.size();
+	if( request->mFormat.hasMipmapping() )
+		image.mTextureBytes += image.mTextureBytes / 3;
+	image.mRequest = request;
+	mDecodedBytes += image.mData.size();
+
+	{
+		lock_guard<mutex> lock( mMutex );
+		if( ! request->setState( TextureStreamRequest::DECODING, TextureStreamRequest::UPLOADING ) )
+			return;
+		mInFlightBytes += image.mTextureBytes;
+		image.mSequence = mUploadSequence++;
+		mUploadQueue.push_back( std::move( image ) );
+		push_heap( mUploadQueue.begin(), mUploadQueue.end() );
+	}
+	mUploadCond.notify_one();
+}
+
+void TextureStreamingService::uploadThreadEntry( ContextRef context )
+{
+	ThreadSetup threadSetup;
+	context->makeCurrent();
+	StreamingBufferRef ring = StreamingBuffer::create( GL_PIXEL_UNPACK_BUFFER, (GLsizeiptr)mOptions.getPboRingSize() );
+
+	while( true ) {
+		DecodedImage image;
+		{
+			unique_lock<mutex> lock( mMutex );
+			mUploadCond.wait( lock, [this] { return mQuit || ! mUploadQueue.empty(); } );
+			if( mQuit )
+				break;
+			pop_heap( mUploadQueue.begin(), mUploadQueue.end() );
+			image = std::move( mUploadQueue.back() );
+			mUploadQueue.pop_back();
+		}
+
+		if( image.mRequest->getState() != TextureStreamRequest::UPLOADING ) {
+			mInFlightBytes -= image.mTextureBytes;
+			continue;
+		}
+
+		try {
+			upload( image, ring.get() );
+		}
+		catch( ... ) {
+			fail( image.mRequest, current_exception(), image.mTextureBytes );
+		}
+	}
+
+	ring.reset();
+}
+
+void TextureStreamingService::upload( DecodedImage &image, StreamingBuffer *ring )
+{
+	Texture2d::Format format = image.mRequest->mFormat;
+	if( format.getInternalFormat() == -1 ) {
+		if( image.mFloat )
+			format.setInternalFormat( image.mAlpha ? GL_RGBA32F : GL_RGB32F );
+		else
+			format.setInternalFormat( image.mAlpha ? GL_RGBA8 : GL_RGB8 );
+	}
+	Texture2dRef texture = Texture2d::create( image.mWidth, image.mHeight, format );
+
+	const GLintptr offset = ring->write( image.mData.data(), (GLsizeiptr)image.mData.size(), 16 );
+	{
+		ScopedBuffer bufferBind( ring->getBuffer() );
+		ScopedTextureBind textureBind( texture );
+		glPixelStorei( GL_UNPACK_ALIGNMENT, 1 );
+		glTexSubImage2D( texture->getTarget(), 0, 0, 0, image.mWidth, image.mHeight, image.mAlpha ? GL_RGBA : GL_RGB,
+				image.mFloat ? GL_FLOAT : GL_UNSIGNED_BYTE, reinterpret_cast<const GLvoid*>( offset ) );
+		if( texture->hasMipmapping() )
+			glGenerateMipmap( texture->getTarget() );
+	}
+
+	// the fence is waited on by update() on the other Context, so it has to reach the GPU now
+	SyncRef fence = Sync::create();
+	glFlush();
+	mUploadedBytes += image.mData.size();
+
+	lock_guard<mutex> lock( mMutex );
+	mUploaded.push_back( { image.mRequest, texture, fence, image.mTextureBytes } );
+}
+
+void TextureStreamingService::fail( const TextureStreamRequestRef &request, exception_ptr exception, size_t inFlightBytes )
+{
+	request->mException = exception;
+	lock_guard<mutex> lock( mMutex );
+	mFailed.emplace_back( request, inFlightBytes );
+}
+
+size_t TextureStreamingService::update()
+{
+	mDecoder->update();
+
+	vector<pair<TextureStreamRequestRef, size_t>> failed;
+	{
+		lock_guard<mutex> lock( mMutex );
+		mAwaitingFence.insert( mAwaitingFence.end(), mUploaded.begin(), mUploaded.end() );
+		mUploaded.clear();
+		failed.swap( mFailed );
+	}
+
+	// collect everything first, since callbacks are free to load or cancel other requests
+	struct Ready {
+		TextureStreamRequestRef		mRequest;
+		Texture2dRef				mTexture;
+		size_t						mTextureBytes;
+	};
+	vector<Ready> ready;
+	for( auto &entry : failed ) {
+		mInFlightBytes -= entry.second;
+		ready.push_back( { entry.first, nullptr, 0 } );
+	}
+
+	for( auto it = mAwaitingFence.begin(); it != mAwaitingFence.end(); ) {
+		if( it->mFence->clientWaitSync( 0, 0 ) == GL_TIMEOUT_EXPIRED ) {
+			++it;
+			continue;
+		}
+
+		mInFlightBytes -= it->mTextureBytes;
+		ready.push_back( { it->mRequest, it->mTexture, it->mTextureBytes } );
+		it = mAwaitingFence.erase( it );
+	}
+
+	mDecoding.erase( remove_if( mDecoding.begin(), mDecoding.end(), []( const TextureStreamRequestRef &request ) {
+		return request->getState() != TextureStreamRequest::DECODING; } ), mDecoding.end() );
+
+	for( auto it = mResident.begin(); it != mResident.end(); ) {
+		if( it->mTexture.expired() ) {
+			mResidentBytes -= it->mBytes;
+			it = mResident.erase( it );
+		}
+		else
+			++it;
+	}
+
+	size_t numCalled = 0;
+	for( auto &entry : ready ) {
+		// an earlier callback may have canceled this request
+		if( ! entry.mRequest->finish( entry.mTexture ? TextureStreamRequest::COMPLETED : TextureStreamRequest::FAILED ) )
+			continue;
+
+		if( entry.mTexture ) {
+			entry.mRequest->mTexture = entry.mTexture;
+			mResident.push_back( { entry.mTexture, entry.mTextureBytes } );
+			mResidentBytes += entry.mTextureBytes;
+			++mNumCompleted;
+		}
+		else
+			++mNumFailed;
+
+		if( entry.mRequest->mCallback )
+			entry.mRequest->mCallback( entry.mTexture );
+		++numCalled;
+	}
+
+	admit();
+	updateRates();
+
+	return numCalled;
+}
+
+void TextureStreamingService::updateRates()
+{
+	const double elapsed = mRateTimer.getSeconds();
+	if( elapsed < RATE_INTERVAL_SECONDS )
+		return;
+
+	const uint64_t decoded = mDecodedBytes, uploaded = mUploadedBytes;
+	mDecodeBytesPerSecond = ( decoded - mRateDecodedBytes ) / elapsed;
+	mUploadBytesPerSecond = ( uploaded - mRateUploadedBytes ) / elapsed;
+	mRateDecodedBytes = decoded;
+	mRateUploadedBytes = uploaded;
+	mRateTimer.start();
+}
+
+void TextureStreamingService::cancelAll()
+{
+	for( auto &queued : mQueued )
+		queued.mRequest->cancel();
+	mQueued.clear();
+
+	for( auto &request : mDecoding )
+		request->cancel();
+	for( auto &uploaded : mAwaitingFence )
+		uploaded.mRequest->cancel();
+
+	lock_guard<mutex> lock( mMutex );
+	for( auto &image : mUploadQueue )
+		image.mRequest->cancel();
+	for( auto &uploaded : mUploaded )
+		uploaded.mRequest->cancel();
+}
+
+TextureStreamingService::Stats TextureStreamingService::getStats() const
+{
+	Stats result;
+	result.mNumQueued = mQueued.size();
+	result.mNumDecoding = mDecoding.size();
+	result.mNumAwaitingFence = mAwaitingFence.size();
+	result.mResidentBytes = mResidentBytes;
+	result.mInFlightBytes = mInFlightBytes;
+	result.mDecodeBytesPerSecond = mDecodeBytesPerSecond;
+	result.mUploadBytesPerSecond = mUploadBytesPerSecond;
+	result.mTotalBytesUploaded = mUploadedBytes;
+	result.mNumCompleted = mNumCompleted;
+	result.mNumFailed = mNumFailed;
+
+	lock_guard<mutex> lock( mMutex );
+	result.mNumUploadQueued = mUploadQueue.size();
+	result.mNumAwaitingFence += mUploaded.size();
+
+	return result;
+}
+
+} } // namespace cinder::gl
+
+#endif // ! defined( CINDER_GL_ES ) || defined( CINDER_GL_ES_3 )
@@ -27,6 +27,8 @@
 #include "cinder/gl/Environment.h"
 #include "cinder/Log.h"
 
+#include <functional>
+
 using namespace std;
 
 namespace cinder { namespace gl {
@@ -285,6 +287,67 @@ VboMeshRef VboMesh::create( const geom::Source &source, const std::vector<std::p
 	return VboMeshRef( new VboMesh( source, vertexArrayLayouts, indexVbo ) );
 }
 
+VboMeshRef VboMesh::create( const MappedTriMesh &mesh )
+{
+	return create( mesh, mesh.getAvailableAttribs() );
+}
+
+namespace {
+
+// fills a newly allocated static VBO of \a size bytes with \a decode, writing into the mapped buffer where possible
+VboRef createDecodedVbo( GLenum target, size_t size, const std::function<void( void* )> &decode )
+{
+	auto result = Vbo::create( target, size, nullptr, GL_STATIC_DRAW );
+#if defined( CINDER_GL_HAS_MAP_BUFFER ) || defined( CINDER_GL_HAS_MAP_BUFFER_RANGE )
+	void *mapped = result->mapReplace();
+	if( mapped ) {
+		decode( mapped );
+		result->unmap();
+		return result;
+	}
+#endif
+	std::vector<uint8_t> decoded( size );
+	decode( decoded.data() );
+	result->bufferSubData( 0, size, decoded.data() );
+	return result;
+}
+
+} // anonymous namespace
+
+VboMeshRef VboMesh::create( const MappedTriMesh &mesh, const geom::AttribSet &requestedAttribs )
+{
+	const size_t numVertices = mesh.getNumVertices();
+	std::vector<pair<geom::BufferLayout,VboRef>> vertexArrayBuffers;
+	for( geom::Attrib attrib : requestedAttribs ) {
+		const uint8_t dims = mesh.getAttribDims( attrib );
+		if( dims == 0 )
+			continue;
+
+		const size_t size = numVertices * dims * sizeof( float );
+		VboRef vbo;
+		if( const float *data = mesh.getAttribData( attrib ) )
+			vbo = Vbo::create( GL_ARRAY_BUFFER, size, data, GL_STATIC_DRAW );
+		else
+			vbo = createDecodedVbo( GL_ARRAY_BUFFER, size, [&]( void *ptr ) { mesh.decodeAttrib( attrib, static_cast<float*>( ptr ) ); } );
+
+		geom::BufferLayout layout;
+		layout.append( attrib, dims, 0, 0 );
+		vertexArrayBuffers.emplace_back( layout, vbo );
+	}
+
+	VboRef indexVbo;
+	const size_t numIndices = mesh.getNumIndices();
+	if( numIndices ) {
+		const size_t size = numIndices * sizeof( uint32_t );
+		if( const uint32_t *data = mesh.getIndexData() )
+			indexVbo = Vbo::create( GL_ELEMENT_ARRAY_BUFFER, size, data, GL_STATIC_DRAW );
+		else
+			indexVbo = createDecodedVbo( GL_ELEMENT_ARRAY_BUFFER, size, [&]( void *ptr ) { mesh.decodeIndices( static_cast<uint32_t*>( ptr ) ); } );
+	}
+
+	return create( (uint32_t)numVertices, GL_TRIANGLES, vertexArrayBuffers, (uint32_t)numIndices, GL_UNSIGNED_INT, indexVbo );
+}
+
 VboMeshRef VboMesh::create( uint32_t numVertices, GLenum glPrimitive, const std::vector<pair<geom::BufferLayout,VboRef>> &vertexArrayBuffers, uint32_t numIndices, GLenum indexType, const VboRef &indexVbo )
 {
 	return VboMeshRef( new VboMesh( numVertices, numIndices, glPrimitive, indexType, vertexArrayBuffers, indexVbo ) );
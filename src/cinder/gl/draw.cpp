@@ -113,6 +113,26 @@ void multiDrawElementsIndirect( GLenum mode, GLenum type, const GLvoid *indirect
 
 namespace {
 
+vec3 toVec3( const vec2 &v )	{ return vec3( v, 0 ); }
+vec3 toVec3( const vec3 &v )	{ return v; }
+
+// Appends a line strip to the streaming draw batch as \c GL_LINES, since strips can't be concatenated
+template<typename T>
+void streamingDrawLineStrip( Context *ctx, const T *points, size_t numPoints, bool isClosed )
+{
+	if( numPoints < 2 )
+		return;
+
+	const size_t numSegments = isClosed ? numPoints : numPoints - 1;
+	vector<vec3> vertices( numSegments * 2 );
+	for( size_t i = 0; i < numSegments; ++i ) {
+		vertices[i * 2 + 0] = toVec3( points[i] );
+		vertices[i * 2 + 1] = toVec3( points[( i + 1 ) % numPoints] );
+	}
+
+	ctx->streamingDraw( GL_LINES, vertices.data(), vertices.size() );
+}
+
 std::array<vec3, 8> getCubePoints( const vec3 &c, const vec3 &size )
 {
 	vec3 s = size * 0.5f;																			// origin points
@@ -174,6 +194,21 @@ void drawCubeImpl( const vec3 &c, const vec3 &size, bool faceColors )
 		return;
 	}
 
+	if( ctx->isStreamingDrawEnabled() ) {
+		vec3 streamPositions[36], streamNormals[36];
+		vec2 streamTexCoords[36];
+		ColorAf streamColors[36];
+		for( int i = 0; i < 36; ++i ) {
+			const int v = elements[i];
+			streamPositions[i] = vec3( vertices[v*3+0], vertices[v*3+1], vertices[v*3+2] );
+			streamNormals[i] = vec3( normals[v*3+0], normals[v*3+1], normals[v*3+2] );
+			streamTexCoords[i] = vec2( texs[v*2+0], texs[v*2+1] );
+			streamColors[i] = ColorAf( colors[v*4+0] / 255.0f, colors[v*4+1] / 255.0f, colors[v*4+2] / 255.0f, colors[v*4+3] / 255.0f );
+		}
+		ctx->streamingDraw( GL_TRIANGLES, streamPositions, 36, streamNormals, streamTexCoords, faceColors ? streamColors : nullptr );
+		return;
+	}
+
 	bool hasPositions = curGlslProg->hasAttribSemantic( geom::Attrib::POSITION );
 	bool hasNormals = curGlslProg->hasAttribSemantic( geom::Attrib::NORMAL );
 	bool hasTextureCoords = curGlslProg->hasAttribSemantic( geom::Attrib::TEX_COORD_0 );
@@ -262,6 +297,14 @@ void drawStrokedCube( const vec3 &center, const vec3 &size )
 		CI_LOG_E( "No GLSL program bound" );
 		return;
 	}
+
+	if( ctx->isStreamingDrawEnabled() ) {
+		vec3 streamPositions[24];
+		for( size_t i = 0; i < indices.size(); ++i )
+			streamPositions[i] = vertices[indices[i]];
+		ctx->streamingDraw( GL_LINES, streamPositions, 24 );
+		return;
+	}
 	
 	ctx->pushVao();
 	ctx->getDefaultVao()->replacementBindBegin();
@@ -339,6 +382,11 @@ void draw( const Path2d &path, float approximationScale )
 	}
 
 	vector<vec2> points = path.subdivide( approximationScale );
+	if( ctx->isStreamingDrawEnabled() ) {
+		streamingDrawLineStrip( ctx, points.data(), points.size(), false );
+		return;
+	}
+
 	VboRef arrayVbo = ctx->getDefaultArrayVbo( sizeof(vec2) * points.size() );
 	arrayVbo->bufferSubData( 0, sizeof(vec2) * points.size(), points.data() );
 
@@ -373,6 +421,11 @@ void draw( const PolyLine2 &polyLine )
 	}
 
 	const vector<vec2> &points = polyLine.getPoints();
+	if( ctx->isStreamingDrawEnabled() ) {
+		streamingDrawLineStrip( ctx, points.data(), points.size(), polyLine.isClosed() );
+		return;
+	}
+
 	VboRef arrayVbo = ctx->getDefaultArrayVbo( sizeof(vec2) * points.size() );
 	arrayVbo->bufferSubData( 0, sizeof(vec2) * points.size(), points.data() );
 
@@ -399,6 +452,11 @@ void draw( const std::vector<vec3> &points, bool isClosed )
 		CI_LOG_E( "No GLSL program bound" );
 		return;
 	}
+
+	if( ctx->isStreamingDrawEnabled() ) {
+		streamingDrawLineStrip( ctx, points.data(), points.size(), isClosed );
+		return;
+	}
 	
 	VboRef arrayVbo = ctx->getDefaultArrayVbo( sizeof(vec3) * points.size() );
 	arrayVbo->bufferSubData( 0, sizeof(vec3) * points.size(), points.data() );
@@ -431,6 +489,11 @@ void drawLine( const vec3 &a, const vec3 &b )
 		return;
 	}
 
+	if( ctx->isStreamingDrawEnabled() ) {
+		ctx->streamingDraw( GL_LINES, points.data(), points.size() );
+		return;
+	}
+
 	ctx->pushVao();
 	ctx->getDefaultVao()->replacementBindBegin();
 
@@ -461,6 +524,12 @@ void drawLine( const vec2 &a, const vec2 &b )
 		return;
 	}
 
+	if( ctx->isStreamingDrawEnabled() ) {
+		const vec3 streamPositions[2] = { vec3( a, 0 ), vec3( b, 0 ) };
+		ctx->streamingDraw( GL_LINES, streamPositions, 2 );
+		return;
+	}
+
 	ctx->pushVao();
 	ctx->getDefaultVao()->replacementBindBegin();
 
@@ -943,6 +1012,19 @@ void drawSolidRect( const Rectf &r, const vec2 &upperLeftTexCoord, const vec2 &l
 	verts[3*2+0] = r.getX1(); texs[3*2+0] = upperLeftTexCoord.x;
 	verts[3*2+1] = r.getY2(); texs[3*2+1] = lowerRightTexCoord.y;
 
+	if( ctx->isStreamingDrawEnabled() ) {
+		// the strip's two triangles, keeping its winding
+		static const int strip[6] = { 0, 1, 2, 2, 1, 3 };
+		vec3 streamPositions[6];
+		vec2 streamTexCoords[6];
+		for( int i = 0; i < 6; ++i ) {
+			streamPositions[i] = vec3( verts[strip[i]*2+0], verts[strip[i]*2+1], 0 );
+			streamTexCoords[i] = vec2( texs[strip[i]*2+0], texs[strip[i]*2+1] );
+		}
+		ctx->streamingDraw( GL_TRIANGLES, streamPositions, 6, nullptr, streamTexCoords );
+		return;
+	}
+
 	ctx->pushVao();
 	ctx->getDefaultVao()->replacementBindBegin();
 	VboRef defaultVbo = ctx->getDefaultArrayVbo( sizeof(float)*16 );
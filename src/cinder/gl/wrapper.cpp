@@ -205,6 +205,16 @@ void setDefaultShaderVars()
 	ctx->setDefaultShaderVars();
 }
 
+void enableStreamingDraw( bool enable )
+{
+	context()->enableStreamingDraw( enable );
+}
+
+void flushStreamingDraw()
+{
+	context()->flushStreamingDraw();
+}
+
 void clear( const ColorA& color, bool clearDepthBuffer )
 {
 	clearColor( color );
@@ -219,6 +229,7 @@ void clear( const ColorA& color, bool clearDepthBuffer )
 
 void clear( GLbitfield mask )
 {
+    context()->flushStreamingDraw();
     glClear( mask );
 }
 
@@ -248,6 +259,7 @@ void clearStencil( const int s )
 
 void colorMask( GLboolean red, GLboolean green, GLboolean blue, GLboolean alpha )
 {
+    context()->flushStreamingDraw();
     glColorMask( red, green, blue, alpha );
 }
 
@@ -259,16 +271,19 @@ void depthMask( GLboolean flag )
 
 void stencilFunc( GLenum func, GLint ref, GLuint mask )
 {
+    context()->flushStreamingDraw();
     glStencilFunc( func, ref, mask );
 }
 
 void stencilOp( GLenum fail, GLenum zfail, GLenum zpass )
 {
+    context()->flushStreamingDraw();
     glStencilOp( fail, zfail, zpass );
 }
 
 void stencilMask( GLuint mask )
 {
+	context()->flushStreamingDraw();
 	glStencilMask( mask );
 }
 
@@ -894,6 +909,7 @@ void lineWidth( float width )
 
 void pointSize( float size )
 {
+	context()->flushStreamingDraw();
 	glPointSize( size );
 }
 
@@ -958,11 +974,13 @@ void readBuffer( GLenum src )
 
 void drawBuffers( GLsizei num, const GLenum *bufs )
 {
+	context()->flushStreamingDraw();
 	glDrawBuffers( num, bufs );
 }
 
 void drawBuffer( GLenum dst )
 {
+	context()->flushStreamingDraw();
 #if ! defined( CINDER_GL_ES )
 	glDrawBuffer( dst );
 #else
@@ -974,6 +992,7 @@ void drawBuffer( GLenum dst )
 
 void readPixels( GLint x, GLint y, GLsizei width, GLsizei height, GLenum format, GLenum type, GLvoid *data )
 {
+	context()->flushStreamingDraw();
 	glReadPixels( x, y, width, height, format, type, data );
 }
 
@@ -0,0 +1,851 @@
+/*
+ Copyright (c) 2026, The Cinder Project
+
+ This code is intended to be used with the Cinder C++ library, http://libcinder.org
+
+ Redistribution and use in source and binary forms, with or without modification, are permitted provided that
+ the following conditions are met:
+
+    * Redistributions of source code must retain the above copyright notice, this list of conditions and
+	the following disclaimer.
+    * Redistributions in binary form must reproduce the above copyright notice, this list of conditions and
+	the following disclaimer in the documentation and/or other materials provided with the distribution.
+
+ THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED
+ WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A
+ PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR
+ ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+ TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+ NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ POSSIBILITY OF SUCH DAMAGE.
+*/
+
+#include "cinder/ip/BlockCompress.h"
+#include "cinder/ip/Parallel.h"
+#include "cinder/CinderAssert.h"
+
+#include <algorithm>
+#include <cfloat>
+#include <cmath>
+#include <cstring>
+
+#if defined( __SSE2__ ) || defined( _M_X64 ) || ( defined( _M_IX86_FP ) && _M_IX86_FP >= 2 )
+	#include <emmintrin.h>
+	#define CINDER_IP_SSE2
+#elif defined( __ARM_NEON ) || defined( __ARM_NEON__ )
+	#include <arm_neon.h>
+	#define CINDER_IP_NEON
+#endif
+
+using namespace std;
+
+namespace cinder { namespace ip {
+
+namespace {
+
+// A 4x4 block as planar floats in the range [0,255]: red, green, blue and alpha
+struct Block {
+	float	c[4][16];
+};
+
+// Returns the summed squared error over channels [firstChannel, firstChannel + numChannels) of matching each pixel of 'block'
+// to its nearest of the 'numEntries' colors of 'palette', and writes the chosen palette index of each pixel to 'indices'. Ties go to the lower index.
+float selectIndices( const Block &block, int firstChannel, int numChannels, const float (*palette)[4], int numEntries, uint8_t indices[16] )
+{
+	float totalError = 0;
+#if defined( CINDER_IP_SSE2 )
+	for( int group = 0; group < 16; group += 4 ) {
+		__m128 pixels[4];
+		for( int ch = 0; ch < numChannels; ++ch )
+			pixels[ch] = _mm_loadu_ps( &block.c[firstChannel + ch][group] );
+
+		__m128 bestError = _mm_set1_ps( FLT_MAX ), bestIndex = _mm_setzero_ps();
+		for( int e = 0; e < numEntries; ++e ) {
+			__m128 error = _mm_setzero_ps();
+			for( int ch = 0; ch < numChannels; ++ch ) {
+				__m128 d = _mm_sub_ps( pixels[ch], _mm_set1_ps( palette[e][firstChannel + ch] ) );
+				error = _mm_add_ps( error, _mm_mul_ps( d, d ) );
+			}
+			__m128 better = _mm_cmplt_ps( error, bestError );
+			bestError = _mm_min_ps( error, bestError );
+			bestIndex = _mm_or_ps( _mm_and_ps( better, _mm_set1_ps( (float)e ) ), _mm_andnot_ps( better, bestIndex ) );
+		}
+
+		alignas(16) float errors[4];
+		alignas(16) int32_t groupIndices[4];
+		_mm_store_ps( errors, bestError );
+		_mm_store_si128( (__m128i*)groupIndices, _mm_cvttps_epi32( bestIndex ) );
+		for( int i = 0; i < 4; ++i ) {
+			totalError += errors[i];
+			indices[group + i] = (uint8_t)groupIndices[i];
+		}
+	}
+#elif defined( CINDER_IP_NEON )
+	for( int group = 0; group < 16; group += 4 ) {
+		float32x4_t pixels[4];
+		for( int ch = 0; ch < numChannels; ++ch )
+			pixels[ch] = vld1q_f32( &block.c[firstChannel + ch][group] );
+
+		float32x4_t bestError = vdupq_n_f32( FLT_MAX ), bestIndex = vdupq_n_f32( 0 );
+		for( int e = 0; e < numEntries; ++e ) {
+			float32x4_t error = vdupq_n_f32( 0 );
+			for( int ch = 0; ch < numChannels; ++ch ) {
+				float32x4_t d = vsubq_f32( pixels[ch], vdupq_n_f32( palette[e][firstChannel + ch] ) );
+				error = vmlaq_f32( error, d, d );
+			}
+			uint32x4_t better = vcltq_f32( error, bestError );
+			bestError = vminq_f32( error, bestError );
+			bestIndex = vbslq_f32( better, vdupq_n_f32( (float)e ), bestIndex );
+		}
+
+		float errors[4];
+		int32_t groupIndices[4];
+		vst1q_f32( errors, bestError );
+		vst1q_s32( groupIndices, vcvtq_s32_f32( bestIndex ) );
+		for( int i = 0; i < 4; ++i ) {
+			totalError += errors[i];
+			indices[group + i] = (uint8_t)groupIndices[i];
+		}
+	}
+#else
+	for( int i = 0; i < 16; ++i ) {
+		float bestError = FLT_MAX;
+		uint8_t bestIndex = 0;
+		for( int e = 0; e < numEntries; ++e ) {
+			float error = 0;
+			for( int ch = firstChannel; ch < firstChannel + numChannels; ++ch ) {
+				float d = block.c[ch][i] - palette[e][ch];
+				error += d * d;
+			}
+			if( error < bestError ) {
+				bestError = error;
+				bestIndex = (uint8_t)e;
+			}
+		}
+		totalError += bestError;
+		indices[i] = bestIndex;
+	}
+#endif
+	return totalError;
+}
+
+// Finds the endpoints e0 and e1 minimizing the squared error of each pixel against e0 + t * ( e1 - e0 ), given each pixel's 't'. Returns false if the system is singular.
+bool leastSquaresEndpoints( const Block &block, int firstChannel, int numChannels, const float t[16], float e0[4], float e1[4] )
+{
+	float a = 0, b = 0, c = 0;
+	float x0[4] = {}, x1[4] = {};
+	for( int i = 0; i < 16; ++i ) {
+		const float s = 1 - t[i];
+		a += s * s;
+		b += s * t[i];
+		c += t[i] * t[i];
+		for( int ch = firstChannel; ch < firstChannel + numChannels; ++ch ) {
+			x0[ch] += s * block.c[ch][i];
+			x1[ch] += t[i] * block.c[ch][i];
+		}
+	}
+
+	const float det = a * c - b * b;
+	if( fabs( det ) < 1e-6f )
+		return false;
+
+	for( int ch = firstChannel; ch < firstChannel + numChannels; ++ch ) {
+		e0[ch] = glm::clamp( ( c * x0[ch] - b * x1[ch] ) / det, 0.0f, 255.0f );
+		e1[ch] = glm::clamp( ( a * x1[ch] - b * x0[ch] ) / det, 0.0f, 255.0f );
+	}
+	return true;
+}
+
+// Endpoints at the extremes of the block's projection onto its principal axis, which is found by power iteration on the covariance
+void principalAxisEndpoints( const Block &block, int firstChannel, int numChannels, float e0[4], float e1[4] )
+{
+	float mean[4] = {};
+	for( int ch = firstChannel; ch < firstChannel + numChannels; ++ch ) {
+		for( int i = 0; i < 16; ++i )
+			mean[ch] += block.c[ch][i];
+		mean[ch] /= 16;
+	}
+
+	float cov[4][4] = {};
+	for( int i = 0; i < 16; ++i ) {
+		for( int j = firstChannel; j < firstChannel + numChannels; ++j ) {
+			for( int k = firstChannel; k < firstChannel + numChannels; ++k )
+				cov[j][k] += ( block.c[j][i] - mean[j] ) * ( block.c[k][i] - mean[k] );
+		}
+	}
+
+	float axis[4] = { 1, 1, 1, 1 };
+	for( int iteration = 0; iteration < 8; ++iteration ) {
+		float next[4] = {}, length = 0;
+		for( int j = firstChannel; j < firstChannel + numChannels; ++j ) {
+			for( int k = firstChannel; k < firstChannel + numChannels; ++k )
+				next[j] += cov[j][k] * axis[k];
+			length = std::max( length, fabs( next[j] ) );
+		}
+		if( length < 1e-6f )
+			break;
+		for( int j = firstChannel; j < firstChannel + numChannels; ++j )
+			axis[j] = next[j] / length;
+	}
+
+	float minT = FLT_MAX, maxT = -FLT_MAX, lengthSq = 0;
+	for( int ch = firstChannel; ch < firstChannel + numChannels; ++ch )
+		lengthSq += axis[ch] * axis[ch];
+	for( int i = 0; i < 16; ++i ) {
+		float t = 0;
+		for( int ch = firstChannel; ch < firstChannel + numChannels; ++ch )
+			t += ( block.c[ch][i] - mean[ch] ) * axis[ch];
+		minT = std::min( minT, t / lengthSq );
+		maxT = std::max( maxT, t / lengthSq );
+	}
+
+	for( int ch = firstChannel; ch < firstChannel + numChannels; ++ch ) {
+		e0[ch] = glm::clamp( mean[ch] + minT * axis[ch], 0.0f, 255.0f );
+		e1[ch] = glm::clamp( mean[ch] + maxT * axis[ch], 0.0f, 255.0f );
+	}
+}
+
+// Endpoints at the corners of the block's bounding box, inset by 1/16th of its extent to reduce the error of the interior colors
+void boundingBoxEndpoints( const Block &block, int firstChannel, int numChannels, float e0[4], float e1[4] )
+{
+	for( int ch = firstChannel; ch < firstChannel + numChannels; ++ch ) {
+		const float lo = *min_element( block.c[ch], block.c[ch] + 16 ), hi = *max_element( block.c[ch], block.c[ch] + 16 );
+		const float inset = ( hi - lo ) / 16;
+		e0[ch] = lo + inset;
+		e1[ch] = hi - inset;
+	}
+}
+
+void writeLittleEndian16( uint8_t *dst, uint16_t value )
+{
+	dst[0] = uint8_t( value & 0xFF );
+	dst[1] = uint8_t( value >> 8 );
+}
+
+uint16_t readLittleEndian16( const uint8_t *src )
+{
+	return uint16_t( src[0] | ( src[1] << 8 ) );
+}
+
+// ----------------------------------------------------------------------------------------------------
+// BC1
+
+uint16_t packRgb565( const float color[4] )
+{
+	const int r = (int)glm::clamp( color[0] * 31 / 255 + 0.5f, 0.0f, 31.0f );
+	const int g = (int)glm::clamp( color[1] * 63 / 255 + 0.5f, 0.0f, 63.0f );
+	const int b = (int)glm::clamp( color[2] * 31 / 255 + 0.5f, 0.0f, 31.0f );
+	return uint16_t( ( r << 11 ) | ( g << 5 ) | b );
+}
+
+void unpackRgb565( uint16_t packed, int rgb[3] )
+{
+	const int r = ( packed >> 11 ) & 31, g = ( packed >> 5 ) & 63, b = packed & 31;
+	rgb[0] = ( r << 3 ) | ( r >> 2 );
+	rgb[1] = ( g << 2 ) | ( g >> 4 );
+	rgb[2] = ( b << 3 ) | ( b >> 2 );
+}
+
+// Fills the BC1 palette that the decoder derives from c0 and c1. Returns the number of entries that opaque pixels may use.
+int bc1Palette( uint16_t c0, uint16_t c1, bool fourColor, float palette[4][4] )
+{
+	int a[3], b[3];
+	unpackRgb565( c0, a );
+	unpackRgb565( c1, b );
+	for( int ch = 0; ch < 3; ++ch ) {
+		palette[0][ch] = (float)a[ch];
+		palette[1][ch] = (float)b[ch];
+		if( fourColor ) {
+			palette[2][ch] = float( ( 2 * a[ch] + b[ch] ) / 3 );
+			palette[3][ch] = float( ( a[ch] + 2 * b[ch] ) / 3 );
+		}
+		else {
+			palette[2][ch] = float( ( a[ch] + b[ch] ) / 2 );
+			palette[3][ch] = 0;
+		}
+	}
+	for( int e = 0; e < 4; ++e )
+		palette[e][3] = 255;
+	if( ! fourColor )
+		palette[3][3] = 0;
+
+	return fourColor ? 4 : 3;
+}
+
+struct Bc1Result {
+	uint16_t	c0, c1;
+	uint8_t		indices[16];
+	float		error;
+};
+
+// Quantizes e0 and e1 and picks indices. Four-color mode needs c0 > c1, three-color mode c0 <= c1.
+void evaluateBc1( const Block &block, const float e0[4], const float e1[4], bool fourColor, Bc1Result *result )
+{
+	uint16_t c0 = packRgb565( e0 ), c1 = packRgb565( e1 );
+	if( fourColor ? ( c0 < c1 ) : ( c0 > c1 ) )
+		std::swap( c0, c1 );
+
+	result->c0 = c0;
+	result->c1 = c1;
+	if( fourColor && c0 == c1 ) {
+		// the decoder would switch to three-color mode, whose entry 0 is still exact
+		float palette[4][4];
+		bc1Palette( c0, c1, true, palette );
+		fill( result->indices, result->indices + 16, 0 );
+		result->error = selectIndices( block, 0, 3, palette, 1, result->indices );
+		return;
+	}
+
+	float palette[4][4];
+	const int numEntries = bc1Palette( c0, c1, fourColor, palette );
+	result->error = selectIndices( block, 0, 3, palette, numEntries, result->indices );
+}
+
+// Encodes the color of 'block' as BC1. With 'punchThrough', pixels whose alpha is below 128 are encoded as transparent.
+void encodeBc1( const Block &blockIn, bool punchThrough, BlockQuality quality, uint8_t *dst )
+{
+	Block block = blockIn;
+	bool transparent[16] = {};
+	int firstOpaque = -1;
+	for( int i = 0; i < 16; ++i ) {
+		transparent[i] = punchThrough && block.c[3][i] < 128;
+		if( ! transparent[i] && firstOpaque < 0 )
+			firstOpaque = i;
+	}
+
+	if( firstOpaque < 0 ) {
+		// c0 <= c1 selects three-color mode, whose index 3 is transparent
+		memset( dst, 0, 4 );
+		memset( dst + 4, 0xFF, 4 );
+		return;
+	}
+
+	// transparent pixels don't constrain the endpoints, so they stand in for an opaque one
+	const bool fourColor = find( transparent, transparent + 16, true ) == transparent + 16;
+	for( int i = 0; i < 16; ++i ) {
+		if( transparent[i] ) {
+			for( int ch = 0; ch < 3; ++ch )
+				block.c[ch][i] = block.c[ch][firstOpaque];
+		}
+	}
+
+	float e0[4], e1[4];
+	Bc1Result best;
+	if( quality == BlockQuality::FAST )
+		boundingBoxEndpoints( block, 0, 3, e0, e1 );
+	else
+		principalAxisEndpoints( block, 0, 3, e0, e1 );
+	evaluateBc1( block, e0, e1, fourColor, &best );
+
+	if( quality == BlockQuality::BEST ) {
+		Bc1Result candidate;
+		boundingBoxEndpoints( block, 0, 3, e0, e1 );
+		evaluateBc1( block, e0, e1, fourColor, &candidate );
+		if( candidate.error < best.error )
+			best = candidate;
+	}
+
+	const int numRefinements = ( quality == BlockQuality::FAST ) ? 0 : ( quality == BlockQuality::NORMAL ) ? 1 : 4;
+	for( int refinement = 0; refinement < numRefinements && best.error > 0; ++refinement ) {
+		// the weight of c1 in each palette entry
+		const float fourColorT[4] = { 0, 1, 1 / 3.0f, 2 / 3.0f }, threeColorT[3] = { 0, 1, 0.5f };
+		float t[16];
+		for( int i = 0; i < 16; ++i )
+			t[i] = fourColor ? fourColorT[best.indices[i]] : threeColorT[best.indices[i]];
+		if( ! leastSquaresEndpoints( block, 0, 3, t, e0, e1 ) )
+			break;
+
+		Bc1Result candidate;
+		evaluateBc1( block, e0, e1, fourColor, &candidate );
+		if( candidate.error >= best.error )
+			break;
+		best = candidate;
+	}
+
+	writeLittleEndian16( dst, best.c0 );
+	writeLittleEndian16( dst + 2, best.c1 );
+	uint32_t bits = 0;
+	for( int i = 0; i < 16; ++i )
+		bits |= uint32_t( transparent[i] ? 3 : best.indices[i] ) << ( i * 2 );
+	for( int i = 0; i < 4; ++i )
+		dst[4 + i] = uint8_t( bits >> ( i * 8 ) );
+}
+
+void decodeBc1( const uint8_t *src, bool alwaysFourColor, uint8_t pixels[16][4] )
+{
+	const uint16_t c0 = readLittleEndian16( src ), c1 = readLittleEndian16( src + 2 );
+	float palette[4][4];
+	bc1Palette( c0, c1, alwaysFourColor || c0 > c1, palette );
+	for( int i = 0; i < 16; ++i ) {
+		const int index = ( src[4 + i / 4] >> ( ( i % 4 ) * 2 ) ) & 3;
+		for( int ch = 0; ch < 4; ++ch )
+			pixels[i][ch] = (uint8_t)palette[index][ch];
+	}
+}
+
+// ----------------------------------------------------------------------------------------------------
+// BC4
+
+void bc4Palette( int a0, int a1, float palette[8][4] )
+{
+	palette[0][0] = (float)a0;
+	palette[1][0] = (float)a1;
+	if( a0 > a1 ) {
+		for( int k = 2; k < 8; ++k )
+			palette[k][0] = float( ( ( 8 - k ) * a0 + ( k - 1 ) * a1 ) / 7 );
+	}
+	else {
+		for( int k = 2; k < 6; ++k )
+			palette[k][0] = float( ( ( 6 - k ) * a0 + ( k - 1 ) * a1 ) / 5 );
+		palette[6][0] = 0;
+		palette[7][0] = 255;
+	}
+}
+
+struct Bc4Result {
+	int			a0, a1;
+	uint8_t		indices[16];
+	float		error;
+};
+
+void evaluateBc4( const Block &block, int channel, int a0, int a1, Bc4Result *result )
+{
+	float palette[8][4];
+	bc4Palette( a0, a1, palette );
+	// selectIndices() reads palette[e][channel]
+	if( channel != 0 ) {
+		for( int e = 0; e < 8; ++e )
+			palette[e][channel] = palette[e][0];
+	}
+
+	result->a0 = a0;
+	result->a1 = a1;
+	result->error = selectIndices( block, channel, 1, palette, 8, result->indices );
+}
+
+// Encodes 'channel' of 'block' as a BC4 block
+void encodeBc4( const Block &block, int channel, BlockQuality quality, uint8_t *dst )
+{
+	const float *values = block.c[channel];
+	const int lo = (int)*min_element( values, values + 16 ), hi = (int)*max_element( values, values + 16 );
+
+	Bc4Result best;
+	// a0 > a1 selects the eight-value mode, a0 == a1 a constant block
+	evaluateBc4( block, channel, hi, lo, &best );
+
+	const int numRefinements = ( quality == BlockQuality::FAST ) ? 0 : ( quality == BlockQuality::NORMAL ) ? 1 : 4;
+	for( int refinement = 0; refinement < numRefinements && best.error > 0 && best.a0 > best.a1; ++refinement ) {
+		float t[16];
+		for( int i = 0; i < 16; ++i )
+			t[i] = ( best.indices[i] < 2 ) ? float( best.indices[i] ) : ( best.indices[i] - 1 ) / 7.0f;
+		float e0[4], e1[4];
+		if( ! leastSquaresEndpoints( block, channel, 1, t, e0, e1 ) )
+			break;
+
+		const int a0 = int( e0[channel] + 0.5f ), a1 = int( e1[channel] + 0.5f );
+		if( a0 <= a1 )
+			break;
+		Bc4Result candidate;
+		evaluateBc4( block, channel, a0, a1, &candidate );
+		if( candidate.error >= best.error )
+			break;
+		best = candidate;
+	}
+
+	if( quality == BlockQuality::BEST && hi > lo ) {
+		// the six-value mode has exact 0 and 255, which frees its endpoints to span the remaining values
+		int innerLo = 255, innerHi = 0;
+		for( int i = 0; i < 16; ++i ) {
+			const int v = (int)values[i];
+			if( v > 0 && v < 255 ) {
+				innerLo = std::min( innerLo, v );
+				innerHi = std::max( innerHi, v );
+			}
+		}
+		if( innerLo <= innerHi ) {
+			Bc4Result candidate;
+			evaluateBc4( block, channel, innerLo, innerHi, &candidate );
+			if( candidate.error < best.error )
+				best = candidate;
+		}
+	}
+
+	dst[0] = (uint8_t)best.a0;
+	dst[1] = (uint8_t)best.a1;
+	uint64_t bits = 0;
+	for( int i = 0; i < 16; ++i )
+		bits |= uint64_t( best.indices[i] ) << ( i * 3 );
+	for( int i = 0; i < 6; ++i )
+		dst[2 + i] = uint8_t( bits >> ( i * 8 ) );
+}
+
+void decodeBc4( const uint8_t *src, int channel, uint8_t pixels[16][4] )
+{
+	float palette[8][4];
+	bc4Palette( src[0], src[1], palette );
+	uint64_t bits = 0;
+	for( int i = 0; i < 6; ++i )
+		bits |= uint64_t( src[2 + i] ) << ( i * 8 );
+	for( int i = 0; i < 16; ++i )
+		pixels[i][channel] = (uint8_t)palette[( bits >> ( i * 3 ) ) & 7][0];
+}
+
+// ----------------------------------------------------------------------------------------------------
+// BC7
+
+const int sBc7Weights2[4] = { 0, 21, 43, 64 };
+const int sBc7Weights3[8] = { 0, 9, 18, 27, 37, 46, 55, 64 };
+const int sBc7Weights4[16] = { 0, 4, 9, 13, 17, 21, 26, 30, 34, 38, 43, 47, 51, 55, 60, 64 };
+
+int bc7Interpolate( int e0, int e1, int weight )
+{
+	return ( ( 64 - weight ) * e0 + weight * e1 + 32 ) >> 6;
+}
+
+// Writes bits least-significant first, as BC7 lays them out
+class BitWriter {
+  public:
+	BitWriter( uint8_t *dst ) : mDst( dst ), mPosition( 0 ) { memset( dst, 0, 16 ); }
+
+	void write( uint32_t value, int numBits )
+	{
+		for( int i = 0; i < numBits; ++i, ++mPosition ) {
+			if( ( value >> i ) & 1 )
+				mDst[mPosition >> 3] |= uint8_t( 1 << ( mPosition & 7 ) );
+		}
+	}
+
+  private:
+	uint8_t		*mDst;
+	int			mPosition;
+};
+
+class BitReader {
+  public:
+	BitReader( const uint8_t *src ) : mSrc( src ), mPosition( 0 ) {}
+
+	uint32_t read( int numBits )
+	{
+		uint32_t result = 0;
+		for( int i = 0; i < numBits; ++i, ++mPosition )
+			result |= uint32_t( ( mSrc[mPosition >> 3] >> ( mPosition & 7 ) ) & 1 ) << i;
+		return result;
+	}
+
+  private:
+	const uint8_t	*mSrc;
+	int				mPosition;
+};
+
+struct Bc7Mode6Result {
+	int			q[2][4]; // 7-bit endpoints
+	int			p[2];    // p-bits
+	uint8_t		indices[16];
+	float		error;
+};
+
+// Quantizes 'e' to 7 bits per channel plus the shared p-bit 'pbit'. Returns the squared quantization error.
+float quantizeBc7Mode6( const float e[4], int pbit, int q[4] )
+{
+	float error = 0;
+	for( int ch = 0; ch < 4; ++ch ) {
+		q[ch] = (int)glm::clamp( ( e[ch] - pbit ) / 2 + 0.5f, 0.0f, 127.0f );
+		const float d = float( ( q[ch] << 1 ) | pbit ) - e[ch];
+		error += d * d;
+	}
+	return error;
+}
+
+void evaluateBc7Mode6( const Block &block, const int q[2][4], const int p[2], Bc7Mode6Result *result )
+{
+	float palette[16][4];
+	for( int k = 0; k < 16; ++k ) {
+		for( int ch = 0; ch < 4; ++ch )
+			palette[k][ch] = (float)bc7Interpolate( ( q[0][ch] << 1 ) | p[0], ( q[1][ch] << 1 ) | p[1], sBc7Weights4[k] );
+	}
+
+	memcpy( result->q, q, sizeof(result->q) );
+	memcpy( result->p, p, sizeof(result->p) );
+	result->error = selectIndices( block, 0, 4, palette, 16, result->indices );
+}
+
+// Quantizes a pair of endpoints, choosing each p-bit by its quantization error, or with 'searchPBits', by the block error of all four combinations
+void evaluateBc7Mode6( const Block &block, const float e0[4], const float e1[4], bool searchPBits, Bc7Mode6Result *result )
+{
+	int q[2][4], p[2];
+	if( searchPBits ) {
+		result->error = FLT_MAX;
+		for( int combination = 0; combination < 4; ++combination ) {
+			p[0] = combination & 1;
+			p[1] = combination >> 1;
+			quantizeBc7Mode6( e0, p[0], q[0] );
+			quantizeBc7Mode6( e1, p[1], q[1] );
+			Bc7Mode6Result candidate;
+			evaluateBc7Mode6( block, q, p, &candidate );
+			if( candidate.error < result->error )
+				*result = candidate;
+		}
+	}
+	else {
+		const float *e[2] = { e0, e1 };
+		for( int i = 0; i < 2; ++i ) {
+			int q0[4], q1[4];
+			const float error0 = quantizeBc7Mode6( e[i], 0, q0 ), error1 = quantizeBc7Mode6( e[i], 1, q1 );
+			p[i] = ( error1 < error0 ) ? 1 : 0;
+			memcpy( q[i], p[i] ? q1 : q0, sizeof(q0) );
+		}
+		evaluateBc7Mode6( block, q, p, result );
+	}
+}
+
+void encodeBc7( const Block &block, BlockQuality quality, uint8_t *dst )
+{
+	const bool searchPBits = ( quality == BlockQuality::BEST );
+	float e0[4], e1[4];
+	if( quality == BlockQuality::FAST )
+		boundingBoxEndpoints( block, 0, 4, e0, e1 );
+	else
+		principalAxisEndpoints( block, 0, 4, e0, e1 );
+
+	Bc7Mode6Result best;
+	evaluateBc7Mode6( block, e0, e1, searchPBits, &best );
+
+	const int numRefinements = ( quality == BlockQuality::FAST ) ? 0 : ( quality == BlockQuality::NORMAL ) ? 1 : 4;
+	for( int refinement = 0; refinement < numRefinements && best.error > 0; ++refinement ) {
+		float t[16];
+		for( int i = 0; i < 16; ++i )
+			t[i] = sBc7Weights4[best.indices[i]] / 64.0f;
+		if( ! leastSquaresEndpoints( block, 0, 4, t, e0, e1 ) )
+			break;
+
+		Bc7Mode6Result candidate;
+		evaluateBc7Mode6( block, e0, e1, searchPBits, &candidate );
+		if( candidate.error >= best.error )
+			break;
+		best = candidate;
+	}
+
+	// the anchor (first) index is stored without its high bit, so it must be below 8; flipping the endpoints mirrors the weights
+	if( best.indices[0] >= 8 ) {
+		for( int ch = 0; ch < 4; ++ch )
+			std::swap( best.q[0][ch], best.q[1][ch] );
+		std::swap( best.p[0], best.p[1] );
+		for( int i = 0; i < 16; ++i )
+			best.indices[i] = uint8_t( 15 - best.indices[i] );
+	}
+
+	BitWriter writer( dst );
+	writer.write( 1 << 6, 7 );
+	for( int ch = 0; ch < 4; ++ch ) {
+		writer.write( best.q[0][ch], 7 );
+		writer.write( best.q[1][ch], 7 );
+	}
+	writer.write( best.p[0], 1 );
+	writer.write( best.p[1], 1 );
+	writer.write( best.indices[0], 3 );
+	for( int i = 1; i < 16; ++i )
+		writer.write( best.indices[i], 4 );
+}
+
+// Modes 4 and 5: one subset with separate color and alpha indices and an optional channel rotation
+void decodeBc7SeparateAlpha( BitReader &reader, int mode, uint8_t pixels[16][4] )
+{
+	const int rotation = reader.read( 2 );
+	const int indexSelection = ( mode == 4 ) ? reader.read( 1 ) : 0;
+	const int colorBits = ( mode == 4 ) ? 5 : 7, alphaBits = ( mode == 4 ) ? 6 : 8;
+
+	int endpoints[2][4];
+	for( int ch = 0; ch < 3; ++ch ) {
+		for( int e = 0; e < 2; ++e ) {
+			const int v = reader.read( colorBits );
+			endpoints[e][ch] = ( v << ( 8 - colorBits ) ) | ( v >> ( 2 * colorBits - 8 ) );
+		}
+	}
+	for( int e = 0; e < 2; ++e ) {
+		const int v = reader.read( alphaBits );
+		endpoints[e][3] = ( alphaBits == 8 ) ? v : ( ( v << ( 8 - alphaBits ) ) | ( v >> ( 2 * alphaBits - 8 ) ) );
+	}
+
+	// mode 4 has 2 and 3-bit index sets, mode 5 two 2-bit sets; the anchor of each is one bit shorter
+	const int bits0 = 2, bits1 = ( mode == 4 ) ? 3 : 2;
+	int indices0[16], indices1[16];
+	for( int i = 0; i < 16; ++i )
+		indices0[i] = reader.read( i == 0 ? bits0 - 1 : bits0 );
+	for( int i = 0; i < 16; ++i )
+		indices1[i] = reader.read( i == 0 ? bits1 - 1 : bits1 );
+
+	for( int i = 0; i < 16; ++i ) {
+		int colorIndex = indices0[i], alphaIndex = indices1[i];
+		int colorBitsUsed = bits0, alphaBitsUsed = bits1;
+		if( indexSelection ) {
+			std::swap( colorIndex, alphaIndex );
+			std::swap( colorBitsUsed, alphaBitsUsed );
+		}
+		const int colorWeight = ( colorBitsUsed == 2 ) ? sBc7Weights2[colorIndex] : sBc7Weights3[colorIndex];
+		const int alphaWeight = ( alphaBitsUsed == 2 ) ? sBc7Weights2[alphaIndex] : sBc7Weights3[alphaIndex];
+
+		int color[4];
+		for( int ch = 0; ch < 3; ++ch )
+			color[ch] = bc7Interpolate( endpoints[0][ch], endpoints[1][ch], colorWeight );
+		color[3] = bc7Interpolate( endpoints[0][3], endpoints[1][3], alphaWeight );
+		if( rotation > 0 )
+			std::swap( color[3], color[rotation - 1] );
+		for( int ch = 0; ch < 4; ++ch )
+			pixels[i][ch] = (uint8_t)color[ch];
+	}
+}
+
+void decodeBc7( const uint8_t *src, uint8_t pixels[16][4] )
+{
+	BitReader reader( src );
+	int mode = 0;
+	while( mode < 8 && reader.read( 1 ) == 0 )
+		++mode;
+
+	if( mode == 4 || mode == 5 )
+		decodeBc7SeparateAlpha( reader, mode, pixels );
+	else if( mode == 6 ) {
+		int endpoints[2][4];
+		for( int ch = 0; ch < 4; ++ch ) {
+			endpoints[0][ch] = reader.read( 7 ) << 1;
+			endpoints[1][ch] = reader.read( 7 ) << 1;
+		}
+		const int p0 = reader.read( 1 ), p1 = reader.read( 1 );
+		for( int ch = 0; ch < 4; ++ch ) {
+			endpoints[0][ch] |= p0;
+			endpoints[1][ch] |= p1;
+		}
+		for( int i = 0; i < 16; ++i ) {
+			const int weight = sBc7Weights4[reader.read( i == 0 ? 3 : 4 )];
+			for( int ch = 0; ch < 4; ++ch )
+				pixels[i][ch] = (uint8_t)bc7Interpolate( endpoints[0][ch], endpoints[1][ch], weight );
+		}
+	}
+	else
+		memset( pixels, 0, 16 * 4 );
+}
+
+// ----------------------------------------------------------------------------------------------------
+
+void loadBlock( const Surface8u &surface, int32_t blockX, int32_t blockY, Block *block )
+{
+	const uint8_t redOffset = surface.getRedOffset(), greenOffset = surface.getGreenOffset(), blueOffset = surface.getBlueOffset();
+	const bool hasAlpha = surface.hasAlpha();
+	const uint8_t alphaOffset = hasAlpha ? surface.getAlphaOffset() : 0;
+	const int32_t maxX = surface.getWidth() - 1, maxY = surface.getHeight() - 1;
+	for( int y = 0; y < 4; ++y ) {
+		const uint8_t *row = surface.getData( ivec2( 0, std::min( blockY * 4 + y, maxY ) ) );
+		for( int x = 0; x < 4; ++x ) {
+			const uint8_t *pixel = row + std::min( blockX * 4 + x, maxX ) * surface.getPixelInc();
+			const int i = y * 4 + x;
+			block->c[0][i] = pixel[redOffset];
+			block->c[1][i] = pixel[greenOffset];
+			block->c[2][i] = pixel[blueOffset];
+			block->c[3][i] = hasAlpha ? pixel[alphaOffset] : 255.0f;
+		}
+	}
+}
+
+} // anonymous namespace
+
+size_t getBlockBytes( BlockFormat format )
+{
+	return ( format == BlockFormat::BC1 || format == BlockFormat::BC4 ) ? 8 : 16;
+}
+
+size_t getBlockCompressedSize( BlockFormat format, int32_t width, int32_t height )
+{
+	return size_t( ( width + 3 ) / 4 ) * size_t( ( height + 3 ) / 4 ) * getBlockBytes( format );
+}
+
+void blockCompress( const Surface8u &surface, BlockFormat format, uint8_t *dst, BlockQuality quality )
+{
+	const int32_t blocksWide = ( surface.getWidth() + 3 ) / 4, blocksHigh = ( surface.getHeight() + 3 ) / 4;
+	const size_t blockBytes = getBlockBytes( format );
+	const bool punchThrough = surface.hasAlpha();
+
+	// BEST is several times slower per block, so it gets smaller ranges
+	const size_t grainSize = std::max<size_t>( 1, ( quality == BlockQuality::BEST ? 256 : 1024 ) / std::max( blocksWide, 1 ) );
+	parallelFor( blocksHigh, grainSize, [&]( size_t y0, size_t y1 ) {
+		Block block;
+		for( size_t by = y0; by < y1; ++by ) {
+			uint8_t *out = dst + by * blocksWide * blockBytes;
+			for( int32_t bx = 0; bx < blocksWide; ++bx, out += blockBytes ) {
+				loadBlock( surface, bx, (int32_t)by, &block );
+				switch( format ) {
+					case BlockFormat::BC1:
+						encodeBc1( block, punchThrough, quality, out );
+					break;
+					case BlockFormat::BC3:
+						encodeBc4( block, 3, quality, out );
+						encodeBc1( block, false, quality, out + 8 );
+					break;
+					case BlockFormat::BC4:
+						encodeBc4( block, 0, quality, out );
+					break;
+					case BlockFormat::BC5:
+						encodeBc4( block, 0, quality, out );
+						encodeBc4( block, 1, quality, out + 8 );
+					break;
+					case BlockFormat::BC7:
+						encodeBc7( block, quality, out );
+					break;
+				}
+			}
+		}
+	} );
+}
+
+std::vector<uint8_t> blockCompressCopy( const Surface8u &surface, BlockFormat format, BlockQuality quality )
+{
+	std::vector<uint8_t> result( getBlockCompressedSize( format, surface.getWidth(), surface.getHeight() ) );
+	blockCompress( surface, format, result.data(), quality );
+	return result;
+}
+
+Surface8u blockDecompress( const uint8_t *src, BlockFormat format, int32_t width, int32_t height )
+{
+	Surface8u result( width, height, true, SurfaceChannelOrder::RGBA );
+	const int32_t blocksWide = ( width + 3 ) / 4, blocksHigh = ( height + 3 ) / 4;
+	const size_t blockBytes = getBlockBytes( format );
+
+	for( int32_t by = 0; by < blocksHigh; ++by ) {
+		for( int32_t bx = 0; bx < blocksWide; ++bx, src += blockBytes ) {
+			uint8_t pixels[16][4] = {};
+			switch( format ) {
+				case BlockFormat::BC1:
+					decodeBc1( src, false, pixels );
+				break;
+				case BlockFormat::BC3:
+					decodeBc1( src + 8, true, pixels );
+					decodeBc4( src, 3, pixels );
+				break;
+				case BlockFormat::BC4:
+					decodeBc4( src, 0, pixels );
+					for( auto &pixel : pixels )
+						pixel[3] = 255;
+				break;
+				case BlockFormat::BC5:
+					decodeBc4( src, 0, pixels );
+					decodeBc4( src + 8, 1, pixels );
+					for( auto &pixel : pixels )
+						pixel[3] = 255;
+				break;
+				case BlockFormat::BC7:
+					decodeBc7( src, pixels );
+				break;
+			}
+
+			for( int y = 0; y < 4 && by * 4 + y < height; ++y ) {
+				uint8_t *row = result.getData( ivec2( bx * 4, by * 4 + y ) );
+				for( int x = 0; x < 4 && bx * 4 + x < width; ++x )
+					memcpy( row + x * 4, pixels[y * 4 + x], 4 );
+			}
+		}
+	}
+
+	return result;
+}
+
+} } // namespace cinder::ip
@@ -21,6 +21,24 @@
 */
 
 #include "cinder/ip/Blur.h"
+#include "cinder/ip/Parallel.h"
+#include "cinder/ip/SeparableFilter.h"
+
+#include <algorithm>
+#include <cmath>
+#include <memory>
+#include <type_traits>
+#include <vector>
+
+#if defined( __SSE2__ ) || defined( _M_X64 ) || ( defined( _M_IX86_FP ) && _M_IX86_FP >= 2 )
+	#include <emmintrin.h>
+	#define CINDER_IP_SSE2
+#elif defined( __ARM_NEON ) || defined( __ARM_NEON__ )
+	#include <arm_neon.h>
+	#define CINDER_IP_NEON
+#endif
+
+using std::vector;
 
 namespace cinder { namespace ip { 
 
@@ -52,13 +70,29 @@ uint8_t getPixelDataOffset( const ChannelT<T> & /*surface*/ )
 	return 0;
 }
 
+// Returns the number of rows or columns that each parallelFor() range should cover, so that each thread gets several ranges.
+// Images smaller than \a minPixels are processed in a single range on the calling thread.
+size_t getGrainSize( size_t count, size_t numPixels, size_t minPixels = 64 * 1024 )
+{
+	if( numPixels < minPixels )
+		return count;
+
+	const size_t numRanges = getMaxThreads() * 4;
+	return std::max<size_t>( 1, ( count + numRanges - 1 ) / numRanges );
+}
+
 // Core implementation of stackBlur algorithm due to Mario Klingemann.
 // http://incubator.quasimondo.com/processing/fast_blur_deluxe.php
+// The horizontal pass is split into bands of rows and the vertical pass into strips of columns, which are processed in parallel.
+// Within a strip, every column advances one row at a time so that memory is read a row at a time.
 template<typename T, typename SUMT, typename IMAGET, uint8_t CHANNELS>
 void stackBlur_impl( const IMAGET &srcSurface, IMAGET *dstSurface, const Area &area, int radius )
 {
 	const int32_t width = area.getWidth();
 	const int32_t height = area.getHeight();
+	if( width <= 0 || height <= 0 )
+		return;
+
 	const int32_t widthMinusOne = width - 1;
 	const int32_t heightMinusOne = height - 1;
 	const int32_t div = radius + radius + 1;
@@ -75,137 +109,336 @@ void stackBlur_impl( const IMAGET &srcSurface, IMAGET *dstSurface, const Area &a
 	srcPixelData += getPixelDataOffset( srcSurface );
 	dstPixelData += getPixelDataOffset( *dstSurface );
 
-	std::unique_ptr<SUMT[]> stack( new SUMT[div*CHANNELS] );
-	SUMT *tempPixelData = (SUMT*)malloc(width * height * sizeof(SUMT) * CHANNELS);
-	SUMT *channelData = tempPixelData;
+	std::unique_ptr<SUMT[]> tempPixelData( new SUMT[width * height * CHANNELS] );
+	SUMT *channelData = tempPixelData.get();
 
-	SUMT *sir;
-	SUMT inSum[CHANNELS], outSum[CHANNELS], sum[CHANNELS];
-	int32_t p, yp;
-	int stackPointer, rbs;
-    
-	int yi = 0;
-	for( int32_t y = 0; y < height; y++ ) {
-		for( int c = 0; c < CHANNELS; ++c )
-			inSum[c] = outSum[c] = sum[c] = 0;
-		
-		for( int32_t i = -radius;i <= radius; i++ ) {
-			sir = &stack[(i + radius)*CHANNELS];
-			size_t offset = y * srcRowInc + std::min(widthMinusOne, std::max(i, 0)) * srcPixelInc;
-			rbs = radiusPlusOne - abs(i);
-			for( int c = 0; c < CHANNELS; ++c )
-				sir[c] = srcPixelData[offset + c];
-		
+	parallelFor( height, getGrainSize( height, width * height ), [&]( size_t y0, size_t y1 ) {
+		std::unique_ptr<SUMT[]> stack( new SUMT[div*CHANNELS] );
+		SUMT *sir;
+		SUMT inSum[CHANNELS], outSum[CHANNELS], sum[CHANNELS];
+		int stackPointer, rbs;
+
+		for( int32_t y = (int32_t)y0; y < (int32_t)y1; y++ ) {
+			int32_t yi = y * width;
 			for( int c = 0; c < CHANNELS; ++c )
-				sum[c] += sir[c] * rbs;
-			if( i > 0 )
+				inSum[c] = outSum[c] = sum[c] = 0;
+
+			for( int32_t i = -radius;i <= radius; i++ ) {
+				sir = &stack[(i + radius)*CHANNELS];
+				size_t offset = y * srcRowInc + std::min(widthMinusOne, std::max(i, 0)) * srcPixelInc;
+				rbs = radiusPlusOne - abs(i);
 				for( int c = 0; c < CHANNELS; ++c )
-					inSum[c] += sir[c];
-			else
+					sir[c] = srcPixelData[offset + c];
+
 				for( int c = 0; c < CHANNELS; ++c )
-					outSum[c] += sir[c];
-		}
-		stackPointer = radius;
-		
-		for( int32_t x = 0; x < width; x++ ) {
-			for( int c = 0; c < CHANNELS; ++c ) {
-				if( std::is_integral<SUMT>::value )
-					channelData[c+yi*CHANNELS] = sum[c] / divisor;
+					sum[c] += sir[c] * rbs;
+				if( i > 0 )
+					for( int c = 0; c < CHANNELS; ++c )
+						inSum[c] += sir[c];
 				else
-					channelData[c+yi*CHANNELS] = sum[c] * invDivisor;
-				sum[c] -= outSum[c];
-			}
-			
-			int stackStart = stackPointer - radius + div;
-			sir = &stack[(stackStart % div)*CHANNELS];
-			
-			for( int c = 0; c < CHANNELS; ++c )
-				outSum[c] -= sir[c];
-			
-			size_t offset = y * srcRowInc + std::min(x + radius + 1, widthMinusOne) * srcPixelInc;
-			for( int c = 0; c < CHANNELS; ++c ) {
-				sir[c] = srcPixelData[offset+c];
-				inSum[c] += sir[c];
-				sum[c] += inSum[c];
+					for( int c = 0; c < CHANNELS; ++c )
+						outSum[c] += sir[c];
 			}
-			
-			stackPointer = (stackPointer + 1) % div;
-			sir = &stack[stackPointer*CHANNELS];
+			stackPointer = radius;
+
+			for( int32_t x = 0; x < width; x++ ) {
+				for( int c = 0; c < CHANNELS; ++c ) {
+					if( std::is_integral<SUMT>::value )
+						channelData[c+yi*CHANNELS] = sum[c] / divisor;
+					else
+						channelData[c+yi*CHANNELS] = sum[c] * invDivisor;
+					sum[c] -= outSum[c];
+				}
+
+				int stackStart = stackPointer - radius + div;
+				sir = &stack[(stackStart % div)*CHANNELS];
 
-			for( int c = 0; c < CHANNELS; ++c ) {
-				outSum[c] += sir[c];
-				inSum[c] -= sir[c];
-			}
-			
-			yi++;
-		}
-	}
-    
-	for( int32_t x = 0; x < width; x++ ) {
-		for( int c = 0; c < CHANNELS; ++c )
-			inSum[c] = outSum[c] = sum[c] = 0;
-
-		yp = -radius * width;
-		for( int i = -radius; i <= radius; i++ ) {
-			yi = std::max(0, yp) + x;
-			
-			sir = &stack[(i + radius)*CHANNELS];
-			
-			for( int c = 0; c < CHANNELS; ++c )
-				sir[c] = channelData[c+yi*CHANNELS];
-			
-			rbs = radiusPlusOne - abs(i);
-			
-			for( int c = 0; c < CHANNELS; ++c )
-				sum[c] += channelData[c+yi*CHANNELS] * rbs;
-			
-			if( i > 0 )
 				for( int c = 0; c < CHANNELS; ++c )
+					outSum[c] -= sir[c];
+
+				size_t offset = y * srcRowInc + std::min(x + radius + 1, widthMinusOne) * srcPixelInc;
+				for( int c = 0; c < CHANNELS; ++c ) {
+					sir[c] = srcPixelData[offset+c];
 					inSum[c] += sir[c];
-			else
-				for( int c = 0; c < CHANNELS; ++c )
+					sum[c] += inSum[c];
+				}
+
+				stackPointer = (stackPointer + 1) % div;
+				sir = &stack[stackPointer*CHANNELS];
+
+				for( int c = 0; c < CHANNELS; ++c ) {
 					outSum[c] += sir[c];
-			
-			if( i < heightMinusOne )
-				yp += width;
+					inSum[c] -= sir[c];
+				}
+
+				yi++;
+			}
 		}
-		size_t offset = x * dstPixelInc;
-		stackPointer = radius;
-		for( int32_t y = 0; y < height; y++) {
-			for( int c = 0; c < CHANNELS; ++c ) {
-				if( std::is_integral<SUMT>::value )
-					dstPixelData[offset + c] = (T)(sum[c] / divisor);
+	} );
+
+	const int32_t STRIP_WIDTH = 32;
+	const int32_t numStrips = ( width + STRIP_WIDTH - 1 ) / STRIP_WIDTH;
+	parallelFor( numStrips, getGrainSize( numStrips, width * height ), [&]( size_t strip0, size_t strip1 ) {
+		const size_t maxLength = STRIP_WIDTH * CHANNELS;
+		std::unique_ptr<SUMT[]> stack( new SUMT[div * maxLength] );
+		std::unique_ptr<SUMT[]> sums( new SUMT[3 * maxLength] );
+		SUMT *sum = sums.get(), *inSum = sum + maxLength, *outSum = inSum + maxLength;
+
+		for( int32_t strip = (int32_t)strip0; strip < (int32_t)strip1; strip++ ) {
+			const int32_t x0 = strip * STRIP_WIDTH;
+			const int32_t stripWidth = std::min( STRIP_WIDTH, width - x0 );
+			const int32_t length = stripWidth * CHANNELS;
+			const SUMT *column = channelData + x0 * CHANNELS;
+
+			for( int32_t j = 0; j < length; j++ )
+				inSum[j] = outSum[j] = sum[j] = 0;
+
+			for( int32_t i = -radius; i <= radius; i++ ) {
+				const SUMT *row = column + std::min( heightMinusOne, std::max( i, 0 ) ) * width * CHANNELS;
+				SUMT *sir = &stack[(i + radius) * maxLength];
+				const int rbs = radiusPlusOne - abs( i );
+				for( int32_t j = 0; j < length; j++ ) {
+					sir[j] = row[j];
+					sum[j] += row[j] * rbs;
+				}
+				if( i > 0 )
+					for( int32_t j = 0; j < length; j++ )
+						inSum[j] += sir[j];
 				else
-					dstPixelData[offset + c] = (T)(sum[c] * invDivisor);
-				sum[c] -= outSum[c];
+					for( int32_t j = 0; j < length; j++ )
+						outSum[j] += sir[j];
 			}
-			
-			int stackStart = stackPointer - radius + div;
-			sir = &stack[(stackStart % div)*CHANNELS];
-			
-			for( int c = 0; c < CHANNELS; ++c )
-				outSum[c] -= sir[c];
-			
-			p = x + std::min( y + radiusPlusOne, heightMinusOne ) * width;
-			
-			for( int c = 0; c < CHANNELS; ++c ) {
-				sir[c] = channelData[c+p*CHANNELS];
-				inSum[c] += sir[c];
-				sum[c] += inSum[c];
+
+			int stackPointer = radius;
+			T *dst = dstPixelData + x0 * dstPixelInc;
+			for( int32_t y = 0; y < height; y++ ) {
+				for( int32_t x = 0; x < stripWidth; x++ ) {
+					for( int c = 0; c < CHANNELS; ++c ) {
+						if( std::is_integral<SUMT>::value )
+							dst[x * dstPixelInc + c] = (T)(sum[x * CHANNELS + c] / divisor);
+						else
+							dst[x * dstPixelInc + c] = (T)(sum[x * CHANNELS + c] * invDivisor);
+					}
+				}
+
+				const SUMT *row = column + std::min( y + radiusPlusOne, heightMinusOne ) * width * CHANNELS;
+				SUMT *sir = &stack[((stackPointer - radius + div) % div) * maxLength];
+				for( int32_t j = 0; j < length; j++ ) {
+					sum[j] -= outSum[j];
+					outSum[j] -= sir[j];
+					sir[j] = row[j];
+					inSum[j] += sir[j];
+					sum[j] += inSum[j];
+				}
+
+				stackPointer = (stackPointer + 1) % div;
+				sir = &stack[stackPointer * maxLength];
+				for( int32_t j = 0; j < length; j++ ) {
+					outSum[j] += sir[j];
+					inSum[j] -= sir[j];
+				}
+
+				dst += dstRowInc;
 			}
-			
-			stackPointer = (stackPointer + 1) % div;
-			sir = &stack[stackPointer*CHANNELS];
-
-			for( int c = 0; c < CHANNELS; ++c ) {
-				outSum[c] += sir[c];
-				inSum[c] -= sir[c];
-			}			
-			offset += dstRowInc;
+		}
+	} );
+}
+
+// The samples of a Surface or Channel that boxBlur_impl() filters: numChannels samples per pixel, pixelInc apart
+template<typename T>
+struct BlurPlane {
+	T			*data;
+	ptrdiff_t	rowBytes;
+	int32_t		pixelInc, numChannels;
+
+	T*	getRow( int32_t y ) const	{ return reinterpret_cast<T*>( reinterpret_cast<typename std::conditional<std::is_const<T>::value, const uint8_t, uint8_t>::type*>( data ) + y * rowBytes ); }
+};
+
+template<typename T>
+BlurPlane<T> getBlurPlane( SurfaceT<T> &surface, const Area &area )
+{
+	// whole pixels, including alpha or any unused channel, so that rows are contiguous
+	return { surface.getData( area.getUL() ), surface.getRowBytes(), surface.getPixelInc(), surface.getPixelInc() };
+}
+
+template<typename T>
+BlurPlane<T> getBlurPlane( ChannelT<T> &channel, const Area &area )
+{
+	return { channel.getData( area.getUL() ), channel.getRowBytes(), channel.getIncrement(), 1 };
+}
+
+// Box filters a row of \a width pixels of \a C interleaved channels, extending the edge pixels.
+void boxFilterRow( const float *in, float *out, int32_t width, int32_t C, int32_t radius )
+{
+	const double scale = 1.0 / ( 2 * radius + 1 );
+	const int32_t widthMinusOne = width - 1;
+	// pixels whose window lies entirely inside the row need no clamping
+	const int32_t interiorBegin = std::min( radius, width );
+	const int32_t interiorEnd = std::max( interiorBegin, width - radius - 1 );
+	for( int32_t c = 0; c < C; c++ ) {
+		// accumulate in double, since the running sum adds and subtracts width times
+		double sum = 0;
+		for( int32_t k = -radius; k <= radius; k++ )
+			sum += in[std::min( std::max( k, 0 ), widthMinusOne ) * C + c];
+
+		int32_t x = 0;
+		for( ; x < interiorBegin; x++ ) {
+			out[x * C + c] = float( sum * scale );
+			sum += in[std::min( x + radius + 1, widthMinusOne ) * C + c] - in[std::max( x - radius, 0 ) * C + c];
+		}
+		const float *add = in + ( radius + 1 ) * C + c, *sub = in - radius * C + c;
+		for( ; x < interiorEnd; x++ ) {
+			out[x * C + c] = float( sum * scale );
+			sum += add[x * C] - sub[x * C];
+		}
+		for( ; x < width; x++ ) {
+			out[x * C + c] = float( sum * scale );
+			sum += in[std::min( x + radius + 1, widthMinusOne ) * C + c] - in[std::max( x - radius, 0 ) * C + c];
 		}
 	}
+}
+
+// Box filters \a height rows of \a length floats down each column, extending the edge rows. \a sum must hold \a length floats.
+void boxFilterColumns( const float *in, float *out, int32_t length, int32_t height, int32_t radius, float *sum )
+{
+	const float scale = 1.0f / ( 2 * radius + 1 );
+	const int32_t heightMinusOne = height - 1;
 
-	free( tempPixelData );
+	std::fill( sum, sum + length, 0.0f );
+	for( int32_t k = -radius; k <= radius; k++ ) {
+		const float *row = in + std::min( std::max( k, 0 ), heightMinusOne ) * length;
+		for( int32_t j = 0; j < length; j++ )
+			sum[j] += row[j];
+	}
+
+	for( int32_t y = 0; y < height; y++ ) {
+		const float *add = in + std::min( y + radius + 1, heightMinusOne ) * length;
+		const float *sub = in + std::max( y - radius, 0 ) * length;
+		float *dst = out + y * length;
+
+		int32_t j = 0;
+#if defined( CINDER_IP_SSE2 )
+		const __m128 scale4 = _mm_set1_ps( scale );
+		for( ; j + 4 <= length; j += 4 ) {
+			__m128 s = _mm_loadu_ps( sum + j );
+			_mm_storeu_ps( dst + j, _mm_mul_ps( s, scale4 ) );
+			_mm_storeu_ps( sum + j, _mm_add_ps( s, _mm_sub_ps( _mm_loadu_ps( add + j ), _mm_loadu_ps( sub + j ) ) ) );
+		}
+#elif defined( CINDER_IP_NEON )
+		for( ; j + 4 <= length; j += 4 ) {
+			float32x4_t s = vld1q_f32( sum + j );
+			vst1q_f32( dst + j, vmulq_n_f32( s, scale ) );
+			vst1q_f32( sum + j, vaddq_f32( s, vsubq_f32( vld1q_f32( add + j ), vld1q_f32( sub + j ) ) ) );
+		}
+#endif
+		for( ; j < length; j++ ) {
+			dst[j] = sum[j] * scale;
+			sum[j] += add[j] - sub[j];
+		}
+	}
+}
+
+// Blurs \a width x \a height pixels of \a src into \a dst (which may be the same pixels) with \a passes box filters, in floating point.
+// Rows are filtered in parallel bands into a float image, which is then filtered in parallel strips of columns.
+template<typename T>
+void boxBlur_impl( const BlurPlane<const T> &src, const BlurPlane<T> &dst, int32_t width, int32_t height, int radius, int passes )
+{
+	const int32_t C = src.numChannels;
+	const size_t rowLength = width * C;
+	std::unique_ptr<float[]> image( new float[rowLength * height] );
+
+	parallelFor( height, getGrainSize( height, width * height ), [&]( size_t y0, size_t y1 ) {
+		vector<float> ping( rowLength ), pong( rowLength );
+		for( int32_t y = (int32_t)y0; y < (int32_t)y1; y++ ) {
+			const T *srcRow = src.getRow( y );
+			if( src.pixelInc == C )
+				detail::convertToFloat( srcRow, ping.data(), rowLength );
+			else {
+				for( int32_t x = 0; x < width; x++ )
+					ping[x] = (float)srcRow[x * src.pixelInc];
+			}
+
+			float *in = ping.data(), *out = pong.data();
+			for( int pass = 0; pass < passes; pass++ ) {
+				boxFilterRow( in, ( pass == passes - 1 ) ? &image[y * rowLength] : out, width, C, radius );
+				std::swap( in, out );
+			}
+		}
+	} );
+
+	const int32_t STRIP_WIDTH = 64;
+	const int32_t numStrips = ( width + STRIP_WIDTH - 1 ) / STRIP_WIDTH;
+	parallelFor( numStrips, getGrainSize( numStrips, width * height ), [&]( size_t strip0, size_t strip1 ) {
+		const size_t maxLength = STRIP_WIDTH * C;
+		vector<float> ping( maxLength * height ), pong( maxLength * height ), sum( maxLength );
+		vector<T> dstRow( dst.pixelInc == C ? 0 : STRIP_WIDTH );
+
+		for( int32_t strip = (int32_t)strip0; strip < (int32_t)strip1; strip++ ) {
+			const int32_t x0 = strip * STRIP_WIDTH;
+			const int32_t stripWidth = std::min( STRIP_WIDTH, width - x0 );
+			const int32_t length = stripWidth * C;
+
+			for( int32_t y = 0; y < height; y++ )
+				std::copy( &image[y * rowLength + x0 * C], &image[y * rowLength + x0 * C] + length, &ping[y * length] );
+
+			float *in = ping.data(), *out = pong.data();
+			for( int pass = 0; pass < passes; pass++ ) {
+				boxFilterColumns( in, out, length, height, radius, sum.data() );
+				std::swap( in, out );
+			}
+
+			for( int32_t y = 0; y < height; y++ ) {
+				T *dstPixels = dst.getRow( y ) + x0 * dst.pixelInc;
+				if( dst.pixelInc == C )
+					detail::convertFromFloat( in + y * length, dstPixels, length );
+				else {
+					detail::convertFromFloat( in + y * length, dstRow.data(), length );
+					for( int32_t x = 0; x < stripWidth; x++ )
+						dstPixels[x * dst.pixelInc] = dstRow[x];
+				}
+			}
+		}
+	} );
+}
+
+template<typename IMAGET>
+void boxBlur_impl( const IMAGET &srcImage, IMAGET *dstImage, const Area &area, int radius, int passes )
+{
+	if( radius < 1 || passes < 1 || area.getWidth() <= 0 || area.getHeight() <= 0 )
+		return;
+
+	auto src = getBlurPlane( const_cast<IMAGET&>( srcImage ), area );
+	auto dst = getBlurPlane( *dstImage, area );
+	typedef typename std::remove_pointer<decltype( dst.data )>::type T;
+	boxBlur_impl<T>( { src.data, src.rowBytes, src.pixelInc, src.numChannels }, dst, area.getWidth(), area.getHeight(), radius, passes );
+}
+
+std::vector<float> makeGaussianWeights( float sigma )
+{
+	const int32_t radius = std::max( 1, (int32_t)ceil( 3 * sigma ) );
+	std::vector<float> result( 2 * radius + 1 );
+	for( int32_t i = -radius; i <= radius; i++ )
+		result[i + radius] = exp( -( i * i ) / ( 2 * sigma * sigma ) );
+
+	return result;
+}
+
+// separableFilter() reads rows that neighboring bands write, so in-place blurs filter from a copy of the area.
+template<typename IMAGET>
+void gaussianBlur_impl( const IMAGET &srcImage, IMAGET *dstImage, const Area &area, float sigma )
+{
+	if( sigma <= 0 || area.getWidth() <= 0 || area.getHeight() <= 0 )
+		return;
+
+	const auto weights = makeGaussianWeights( sigma );
+	auto kernelX = SeparableKernel::createConvolution( area.getWidth(), weights );
+	auto kernelY = SeparableKernel::createConvolution( area.getHeight(), weights );
+	if( &srcImage == dstImage ) {
+		IMAGET copy = srcImage.clone( area );
+		separableFilter( copy, copy.getBounds(), dstImage, area, *kernelX, *kernelY );
+	}
+	else
+		separableFilter( srcImage, area, dstImage, area, *kernelX, *kernelY );
 }
 
 } // anonymous namespace
@@ -405,4 +638,106 @@ Channel32f stackBlurCopy( const Channel32f &channel, int radius )
 	return result;
 }
 
+///////////////////////////////////////////////////////////////////////////////////
+// boxBlur
+template<typename T>
+void boxBlur( SurfaceT<T> *surface, int radius, int passes )
+{
+	boxBlur_impl( *surface, surface, surface->getBounds(), radius, passes );
+}
+
+template<typename T>
+void boxBlur( SurfaceT<T> *surface, const Area &area, int radius, int passes )
+{
+	boxBlur_impl( *surface, surface, area.getClipBy( surface->getBounds() ), radius, passes );
+}
+
+template<typename T>
+SurfaceT<T> boxBlurCopy( const SurfaceT<T> &surface, int radius, int passes )
+{
+	SurfaceT<T> result = surface.clone( radius < 1 || passes < 1 );
+	boxBlur_impl( surface, &result, surface.getBounds(), radius, passes );
+	return result;
+}
+
+template<typename T>
+void boxBlur( ChannelT<T> *channel, int radius, int passes )
+{
+	boxBlur_impl( *channel, channel, channel->getBounds(), radius, passes );
+}
+
+template<typename T>
+void boxBlur( ChannelT<T> *channel, const Area &area, int radius, int passes )
+{
+	boxBlur_impl( *channel, channel, area.getClipBy( channel->getBounds() ), radius, passes );
+}
+
+template<typename T>
+ChannelT<T> boxBlurCopy( const ChannelT<T> &channel, int radius, int passes )
+{
+	ChannelT<T> result = channel.clone( radius < 1 || passes < 1 );
+	boxBlur_impl( channel, &result, channel.getBounds(), radius, passes );
+	return result;
+}
+
+///////////////////////////////////////////////////////////////////////////////////
+// gaussianBlur
+template<typename T>
+void gaussianBlur( SurfaceT<T> *surface, float sigma )
+{
+	gaussianBlur_impl( *surface, surface, surface->getBounds(), sigma );
+}
+
+template<typename T>
+void gaussianBlur( SurfaceT<T> *surface, const Area &area, float sigma )
+{
+	gaussianBlur_impl( *surface, surface, area.getClipBy( surface->getBounds() ), sigma );
+}
+
+template<typename T>
+SurfaceT<T> gaussianBlurCopy( const SurfaceT<T> &surface, float sigma )
+{
+	SurfaceT<T> result = surface.clone( sigma <= 0 );
+	gaussianBlur_impl( surface, &result, surface.getBounds(), sigma );
+	return result;
+}
+
+template<typename T>
+void gaussianBlur( ChannelT<T> *channel, float sigma )
+{
+	gaussianBlur_impl( *channel, channel, channel->getBounds(), sigma );
+}
+
+template<typename T>
+void gaussianBlur( ChannelT<T> *channel, const Area &area, float sigma )
+{
+	gaussianBlur_impl( *channel, channel, area.getClipBy( channel->getBounds() ), sigma );
+}
+
+template<typename T>
+ChannelT<T> gaussianBlurCopy( const ChannelT<T> &channel, float sigma )
+{
+	ChannelT<T> result = channel.clone( sigma <= 0 );
+	gaussianBlur_impl( channel, &result, channel.getBounds(), sigma );
+	return result;
+}
+
+#define blur_PROTOTYPES(T)\
+	template CI_API void boxBlur( SurfaceT<T> *surface, int radius, int passes ); \
+	template CI_API void boxBlur( SurfaceT<T> *surface, const Area &area, int radius, int passes ); \
+	template CI_API SurfaceT<T> boxBlurCopy( const SurfaceT<T> &surface, int radius, int passes ); \
+	template CI_API void boxBlur( ChannelT<T> *channel, int radius, int passes ); \
+	template CI_API void boxBlur( ChannelT<T> *channel, const Area &area, int radius, int passes ); \
+	template CI_API ChannelT<T> boxBlurCopy( const ChannelT<T> &channel, int radius, int passes ); \
+	template CI_API void gaussianBlur( SurfaceT<T> *surface, float sigma ); \
+	template CI_API void gaussianBlur( SurfaceT<T> *surface, const Area &area, float sigma ); \
+	template CI_API SurfaceT<T> gaussianBlurCopy( const SurfaceT<T> &surface, float sigma ); \
+	template CI_API void gaussianBlur( ChannelT<T> *channel, float sigma ); \
+	template CI_API void gaussianBlur( ChannelT<T> *channel, const Area &area, float sigma ); \
+	template CI_API ChannelT<T> gaussianBlurCopy( const ChannelT<T> &channel, float sigma );
+
+blur_PROTOTYPES(uint8_t)
+blur_PROTOTYPES(uint16_t)
+blur_PROTOTYPES(float)
+
 } } // namespace cinder::ip
@@ -0,0 +1,195 @@
+/*
+ Copyright (c) 2026, The Cinder Project
+
+ This code is intended to be used with the Cinder C++ library, http://libcinder.org
+
+ Redistribution and use in source and binary forms, with or without modification, are permitted provided that
+ the following conditions are met:
+
+    * Redistributions of source code must retain the above copyright notice, this list of conditions and
+	the following disclaimer.
+    * Redistributions in binary form must reproduce the above copyright notice, this list of conditions and
+	the following disclaimer in the documentation and/or other materials provided with the distribution.
+
+ THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED
+ WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A
+ PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR
+ ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+ TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+ NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ POSSIBILITY OF SUCH DAMAGE.
+*/
+
+#include "cinder/ip/Parallel.h"
+#include "cinder/Thread.h"
+
+#include <algorithm>
+#include <atomic>
+#include <deque>
+#include <exception>
+#include <memory>
+#include <vector>
+
+using namespace std;
+
+namespace cinder { namespace ip {
+
+namespace {
+
+std::atomic<size_t> sMaxThreads( 0 );
+
+// One parallelFor() call. Ranges are claimed through an atomic counter by the calling thread and any workers that pick the job up.
+struct Job {
+	Job( const function<void ( size_t, size_t )> &fn, size_t count, size_t grainSize )
+		: mFn( fn ), mCount( count ), mGrainSize( grainSize ), mNumRanges( ( count + grainSize - 1 ) / grainSize ), mNextRange( 0 ), mNumRangesDone( 0 )
+	{}
+
+	void process()
+	{
+		size_t numCompleted = 0;
+		while( true ) {
+			size_t range = mNextRange.fetch_add( 1 );
+			if( range >= mNumRanges )
+				break;
+
+			size_t begin = range * mGrainSize;
+			try {
+				mFn( begin, min( mCount, begin + mGrainSize ) );
+			}
+			catch( ... ) {
+				lock_guard<mutex> lock( mMutex );
+				if( ! mException )
+					mException = current_exception();
+			}
+			numCompleted++;
+		}
+
+		if( numCompleted ) {
+			lock_guard<mutex> lock( mMutex );
+			mNumRangesDone += numCompleted;
+			if( mNumRangesDone == mNumRanges )
+				mDoneCond.notify_all();
+		}
+	}
+
+	void waitUntilDone()
+	{
+		unique_lock<mutex> lock( mMutex );
+		mDoneCond.wait( lock, [this] { return mNumRangesDone == mNumRanges; } );
+		if( mException )
+			rethrow_exception( mException );
+	}
+
+	// only called while ranges remain, so the caller of parallelFor() (which owns fn) is still waiting
+	const function<void ( size_t, size_t )>	&mFn;
+	const size_t			mCount, mGrainSize, mNumRanges;
+	std::atomic<size_t>		mNextRange;
+	size_t					mNumRangesDone;
+	exception_ptr			mException;
+	mutex					mMutex;
+	condition_variable		mDoneCond;
+};
+
+// Threads are created on demand, up to getMaxThreads() - 1, and live until exit. Each queue entry asks one worker to help with a Job.
+class WorkerPool {
+  public:
+	static WorkerPool* get()
+	{
+		static WorkerPool sInstance;
+		return &sInstance;
+	}
+
+	~WorkerPool()
+	{
+		{
+			lock_guard<mutex> lock( mMutex );
+			mQuit = true;
+		}
+		mCond.notify_all();
+		for( auto &thread : mThreads )
+			thread.join();
+	}
+
+	void post( const shared_ptr<Job> &job, size_t numHelpers )
+	{
+		{
+			lock_guard<mutex> lock( mMutex );
+			while( mThreads.size() < numHelpers )
+				mThreads.emplace_back( &WorkerPool::run, this );
+
+			for( size_t i = 0; i < numHelpers; i++ )
+				mQueue.push_back( job );
+		}
+		mCond.notify_all();
+	}
+
+  private:
+	WorkerPool() : mQuit( false )	{}
+
+	void run()
+	{
+		ThreadSetup threadSetup;
+
+		while( true ) {
+			shared_ptr<Job> job;
+			{
+				unique_lock<mutex> lock( mMutex );
+				mCond.wait( lock, [this] { return mQuit || ! mQueue.empty(); } );
+				if( mQuit )
+					return;
+
+				job = move( mQueue.front() );
+				mQueue.pop_front();
+			}
+
+			job->process();
+		}
+	}
+
+	vector<thread>				mThreads;
+	deque<shared_ptr<Job>>		mQueue;
+	bool						mQuit;
+	mutex						mMutex;
+	condition_variable			mCond;
+};
+
+} // anonymous namespace
+
+void setMaxThreads( size_t numThreads )
+{
+	sMaxThreads = numThreads;
+}
+
+size_t getMaxThreads()
+{
+	size_t result = sMaxThreads;
+	if( result == 0 )
+		result = thread::hardware_concurrency();
+
+	return max<size_t>( result, 1 );
+}
+
+void parallelFor( size_t count, size_t grainSize, const function<void ( size_t begin, size_t end )> &fn )
+{
+	if( count == 0 )
+		return;
+
+	grainSize = max<size_t>( grainSize, 1 );
+	const size_t numRanges = ( count + grainSize - 1 ) / grainSize;
+	const size_t numThreads = min( getMaxThreads(), numRanges );
+
+	if( numThreads <= 1 ) {
+		for( size_t begin = 0; begin < count; begin += grainSize )
+			fn( begin, min( count, begin + grainSize ) );
+
+		return;
+	}
+
+	auto job = make_shared<Job>( fn, count, grainSize );
+	WorkerPool::get()->post( job, numThreads - 1 );
+	job->process();
+	job->waitUntilDone();
+}
+
+} } // namespace cinder::ip
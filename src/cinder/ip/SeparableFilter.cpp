@@ -0,0 +1,581 @@
+/*
+ Copyright (c) 2026, The Cinder Project
+
+ This code is intended to be used with the Cinder C++ library, http://libcinder.org
+
+ Redistribution and use in source and binary forms, with or without modification, are permitted provided that
+ the following conditions are met:
+
+    * Redistributions of source code must retain the above copyright notice, this list of conditions and
+	the following disclaimer.
+    * Redistributions in binary form must reproduce the above copyright notice, this list of conditions and
+	the following disclaimer in the documentation and/or other materials provided with the distribution.
+
+ THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED
+ WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A
+ PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR
+ ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+ TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+ NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ POSSIBILITY OF SUCH DAMAGE.
+*/
+
+#include "cinder/ip/SeparableFilter.h"
+#include "cinder/ip/Parallel.h"
+#include "cinder/ChanTraits.h"
+#include "cinder/CinderAssert.h"
+
+#include <algorithm>
+#include <cstring>
+#include <type_traits>
+
+#if defined( __SSE2__ ) || defined( _M_X64 ) || ( defined( _M_IX86_FP ) && _M_IX86_FP >= 2 )
+	#include <emmintrin.h>
+	#define CINDER_IP_SSE2
+#elif defined( __ARM_NEON ) || defined( __ARM_NEON__ )
+	#include <arm_neon.h>
+	#define CINDER_IP_NEON
+#endif
+
+using namespace std;
+
+namespace cinder { namespace ip {
+
+// ----------------------------------------------------------------------------------------------------
+// SeparableKernel
+// ----------------------------------------------------------------------------------------------------
+
+SeparableKernel::SeparableKernel( int32_t srcLength, const vector<int32_t> &start, const vector<vector<float>> &weights )
+	: mSrcLength( srcLength ), mMaxCount( 1 ), mMinStart( srcLength ), mMaxEnd( 0 ), mStart( start ), mCount( start.size() )
+{
+	for( size_t i = 0; i < start.size(); i++ ) {
+		mCount[i] = (int32_t)weights[i].size();
+		mMaxCount = max( mMaxCount, mCount[i] );
+		mMinStart = min( mMinStart, mStart[i] );
+		mMaxEnd = max( mMaxEnd, mStart[i] + mCount[i] );
+	}
+
+	mStride = ( mMaxCount + 3 ) & ~3;
+	mWeights.resize( start.size() * mStride, 0 );
+	for( size_t i = 0; i < start.size(); i++ )
+		copy( weights[i].begin(), weights[i].end(), mWeights.begin() + i * mStride );
+}
+
+// The mapping from destination sample b to the continuous source coordinate of its center is ( b + 0.5 ) / ( dstLength / srcLength ).
+SeparableKernelRef SeparableKernel::createResample( int32_t srcLength, int32_t dstLength, const FilterBase &filter )
+{
+	const float scale = dstLength / (float)srcLength;
+	const float filterScale = max( 1.0f, 1.0f / scale );
+	const float support = max( 0.5f, filterScale * filter.getSupport() );
+
+	vector<int32_t> starts( dstLength );
+	vector<vector<float>> sampleWeights( dstLength );
+	vector<float> w;
+	for( int32_t b = 0; b < dstLength; b++ ) {
+		const float center = ( b + 0.5f ) / scale;
+		const int32_t start = max<int32_t>( 0, (int32_t)( center - support + 0.5f ) );
+		const int32_t end = min<int32_t>( srcLength, (int32_t)( center + support + 0.5f ) );
+
+		w.resize( max( 0, end - start ) );
+		float sum = 0;
+		for( int32_t i = start; i < end; i++ ) {
+			w[i - start] = filter( ( i + 0.5f - center ) / filterScale );
+			sum += w[i - start];
+		}
+
+		// skip leading and trailing zeros
+		int32_t first = start, last = end - 1;
+		while( first <= last && w[first - start] == 0 )
+			first++;
+		while( last >= first && w[last - start] == 0 )
+			last--;
+
+		if( sum == 0 || first > last ) {
+			// degenerate filter, so use the nearest source sample
+			starts[b] = min<int32_t>( srcLength - 1, max<int32_t>( 0, ( start + end ) >> 1 ) );
+			sampleWeights[b].assign( 1, 1.0f );
+		}
+		else {
+			starts[b] = first;
+			for( int32_t i = first; i <= last; i++ )
+				sampleWeights[b].push_back( w[i - start] / sum );
+		}
+	}
+
+	return SeparableKernelRef( new SeparableKernel( srcLength, starts, sampleWeights ) );
+}
+
+SeparableKernelRef SeparableKernel::createConvolution( int32_t length, const vector<float> &weights )
+{
+	CI_ASSERT( weights.size() % 2 == 1 );
+
+	const int32_t radius = int32_t( weights.size() / 2 );
+	float sum = 0;
+	for( float w : weights )
+		sum += w;
+	const float scale = ( sum == 0 ) ? 1.0f : 1.0f / sum;
+
+	vector<int32_t> starts( length );
+	vector<vector<float>> sampleWeights( length );
+	for( int32_t i = 0; i < length; i++ ) {
+		// taps that fall past the edges are applied to the edge sample
+		starts[i] = max( 0, i - radius );
+		auto &w = sampleWeights[i];
+		w.assign( min( length, i + radius + 1 ) - starts[i], 0.0f );
+		for( int32_t k = -radius; k <= radius; k++ )
+			w[min( max( i + k, 0 ), length - 1 ) - starts[i]] += weights[k + radius] * scale;
+	}
+
+	return SeparableKernelRef( new SeparableKernel( length, starts, sampleWeights ) );
+}
+
+namespace {
+
+// ----------------------------------------------------------------------------------------------------
+// Row conversion
+// ----------------------------------------------------------------------------------------------------
+
+inline float toFloat( float v )		{ return v; }
+inline float toFloat( uint8_t v )	{ return v; }
+inline float toFloat( uint16_t v )	{ return v; }
+
+template<typename T>
+inline T fromFloat( float v )
+{
+	// round to nearest and saturate
+	return static_cast<T>( std::min( std::max( v, 0.0f ), (float)CHANTRAIT<T>::max() ) + 0.5f );
+}
+
+template<>
+inline float fromFloat<float>( float v )
+{
+	return v;
+}
+
+void contiguousToFloat( const uint8_t *src, float *dst, size_t length )
+{
+	size_t i = 0;
+#if defined( CINDER_IP_SSE2 )
+	const __m128i zero = _mm_setzero_si128();
+	for( ; i + 16 <= length; i += 16 ) {
+		__m128i v8 = _mm_loadu_si128( (const __m128i *)( src + i ) );
+		__m128i lo16 = _mm_unpacklo_epi8( v8, zero );
+		__m128i hi16 = _mm_unpackhi_epi8( v8, zero );
+		_mm_storeu_ps( dst + i, _mm_cvtepi32_ps( _mm_unpacklo_epi16( lo16, zero ) ) );
+		_mm_storeu_ps( dst + i + 4, _mm_cvtepi32_ps( _mm_unpackhi_epi16( lo16, zero ) ) );
+		_mm_storeu_ps( dst + i + 8, _mm_cvtepi32_ps( _mm_unpacklo_epi16( hi16, zero ) ) );
+		_mm_storeu_ps( dst + i + 12, _mm_cvtepi32_ps( _mm_unpackhi_epi16( hi16, zero ) ) );
+	}
+#elif defined( CINDER_IP_NEON )
+	for( ; i + 16 <= length; i += 16 ) {
+		uint8x16_t v8 = vld1q_u8( src + i );
+		uint16x8_t lo16 = vmovl_u8( vget_low_u8( v8 ) );
+		uint16x8_t hi16 = vmovl_u8( vget_high_u8( v8 ) );
+		vst1q_f32( dst + i, vcvtq_f32_u32( vmovl_u16( vget_low_u16( lo16 ) ) ) );
+		vst1q_f32( dst + i + 4, vcvtq_f32_u32( vmovl_u16( vget_high_u16( lo16 ) ) ) );
+		vst1q_f32( dst + i + 8, vcvtq_f32_u32( vmovl_u16( vget_low_u16( hi16 ) ) ) );
+		vst1q_f32( dst + i + 12, vcvtq_f32_u32( vmovl_u16( vget_high_u16( hi16 ) ) ) );
+	}
+#endif
+	for( ; i < length; i++ )
+		dst[i] = src[i];
+}
+
+void contiguousToFloat( const uint16_t *src, float *dst, size_t length )
+{
+	size_t i = 0;
+#if defined( CINDER_IP_SSE2 )
+	const __m128i zero = _mm_setzero_si128();
+	for( ; i + 8 <= length; i += 8 ) {
+		__m128i v16 = _mm_loadu_si128( (const __m128i *)( src + i ) );
+		_mm_storeu_ps( dst + i, _mm_cvtepi32_ps( _mm_unpacklo_epi16( v16, zero ) ) );
+		_mm_storeu_ps( dst + i + 4, _mm_cvtepi32_ps( _mm_unpackhi_epi16( v16, zero ) ) );
+	}
+#elif defined( CINDER_IP_NEON )
+	for( ; i + 8 <= length; i += 8 ) {
+		uint16x8_t v16 = vld1q_u16( src + i );
+		vst1q_f32( dst + i, vcvtq_f32_u32( vmovl_u16( vget_low_u16( v16 ) ) ) );
+		vst1q_f32( dst + i + 4, vcvtq_f32_u32( vmovl_u16( vget_high_u16( v16 ) ) ) );
+	}
+#endif
+	for( ; i < length; i++ )
+		dst[i] = src[i];
+}
+
+void contiguousFromFloat( const float *src, uint8_t *dst, size_t length )
+{
+	size_t i = 0;
+#if defined( CINDER_IP_SSE2 )
+	const __m128 zero = _mm_setzero_ps(), maxValue = _mm_set1_ps( 255.0f ), half = _mm_set1_ps( 0.5f );
+	for( ; i + 16 <= length; i += 16 ) {
+		__m128i v[4];
+		for( int j = 0; j < 4; j++ )
+			v[j] = _mm_cvttps_epi32( _mm_add_ps( _mm_min_ps( _mm_max_ps( _mm_loadu_ps( src + i + j * 4 ), zero ), maxValue ), half ) );
+		_mm_storeu_si128( (__m128i *)( dst + i ), _mm_packus_epi16( _mm_packs_epi32( v[0], v[1] ), _mm_packs_epi32( v[2], v[3] ) ) );
+	}
+#elif defined( CINDER_IP_NEON )
+	const float32x4_t zero = vdupq_n_f32( 0 ), maxValue = vdupq_n_f32( 255.0f ), half = vdupq_n_f32( 0.5f );
+	for( ; i + 8 <= length; i += 8 ) {
+		uint32x4_t lo = vcvtq_u32_f32( vaddq_f32( vminq_f32( vmaxq_f32( vld1q_f32( src + i ), zero ), maxValue ), half ) );
+		uint32x4_t hi = vcvtq_u32_f32( vaddq_f32( vminq_f32( vmaxq_f32( vld1q_f32( src + i + 4 ), zero ), maxValue ), half ) );
+		vst1_u8( dst + i, vmovn_u16( vcombine_u16( vmovn_u32( lo ), vmovn_u32( hi ) ) ) );
+	}
+#endif
+	for( ; i < length; i++ )
+		dst[i] = fromFloat<uint8_t>( src[i] );
+}
+
+void contiguousFromFloat( const float *src, uint16_t *dst, size_t length )
+{
+	size_t i = 0;
+#if defined( CINDER_IP_SSE2 )
+	// SSE2 has no unsigned 32 -> 16 bit pack, so values are biased into the signed range and back
+	const __m128 zero = _mm_setzero_ps(), maxValue = _mm_set1_ps( 65535.0f ), half = _mm_set1_ps( 0.5f );
+	const __m128i bias32 = _mm_set1_epi32( 32768 ), bias16 = _mm_set1_epi16( (short)0x8000 );
+	for( ; i + 8 <= length; i += 8 ) {
+		__m128i lo = _mm_cvttps_epi32( _mm_add_ps( _mm_min_ps( _mm_max_ps( _mm_loadu_ps( src + i ), zero ), maxValue ), half ) );
+		__m128i hi = _mm_cvttps_epi32( _mm_add_ps( _mm_min_ps( _mm_max_ps( _mm_loadu_ps( src + i + 4 ), zero ), maxValue ), half ) );
+		__m128i packed = _mm_packs_epi32( _mm_sub_epi32( lo, bias32 ), _mm_sub_epi32( hi, bias32 ) );
+		_mm_storeu_si128( (__m128i *)( dst + i ), _mm_xor_si128( packed, bias16 ) );
+	}
+#elif defined( CINDER_IP_NEON )
+	const float32x4_t zero = vdupq_n_f32( 0 ), maxValue = vdupq_n_f32( 65535.0f ), half = vdupq_n_f32( 0.5f );
+	for( ; i + 8 <= length; i += 8 ) {
+		uint32x4_t lo = vcvtq_u32_f32( vaddq_f32( vminq_f32( vmaxq_f32( vld1q_f32( src + i ), zero ), maxValue ), half ) );
+		uint32x4_t hi = vcvtq_u32_f32( vaddq_f32( vminq_f32( vmaxq_f32( vld1q_f32( src + i + 4 ), zero ), maxValue ), half ) );
+		vst1q_u16( dst + i, vcombine_u16( vmovn_u32( lo ), vmovn_u32( hi ) ) );
+	}
+#endif
+	for( ; i < length; i++ )
+		dst[i] = fromFloat<uint16_t>( src[i] );
+}
+
+void contiguousToFloat( const float *src, float *dst, size_t length )
+{
+	memcpy( dst, src, length * sizeof( float ) );
+}
+
+void contiguousFromFloat( const float *src, float *dst, size_t length )
+{
+	memcpy( dst, src, length * sizeof( float ) );
+}
+
+// Converts \a numPixels pixels of \a numChannels samples, \a pixelInc apart, into numPixels * lanes floats. With 4 lanes,
+// a fourth channel that isn't part of the pixel is set to zero.
+template<typename T>
+void expandToFloat( const T *src, int32_t pixelInc, int32_t numChannels, int32_t lanes, int32_t numPixels, float *dst )
+{
+	if( pixelInc == lanes ) {
+		contiguousToFloat( src, dst, numPixels * lanes );
+	}
+	else if( pixelInc == 3 && lanes == 4 ) {
+		for( int32_t p = 0; p < numPixels; p++ ) {
+			dst[p * 4] = toFloat( src[p * 3] );
+			dst[p * 4 + 1] = toFloat( src[p * 3 + 1] );
+			dst[p * 4 + 2] = toFloat( src[p * 3 + 2] );
+			dst[p * 4 + 3] = 0;
+		}
+	}
+	else {
+		for( int32_t p = 0; p < numPixels; p++ ) {
+			int32_t c = 0;
+			for( ; c < numChannels; c++ )
+				dst[p * lanes + c] = toFloat( src[p * pixelInc + c] );
+			for( ; c < lanes; c++ )
+				dst[p * lanes + c] = 0;
+		}
+	}
+}
+
+// Returns a row of floats in the layout of expandToFloat(), which is \a src itself when no conversion is needed.
+template<typename T>
+const float* rowToFloat( const T *src, int32_t pixelInc, int32_t numChannels, int32_t lanes, int32_t numPixels, float *scratch )
+{
+	expandToFloat( src, pixelInc, numChannels, lanes, numPixels, scratch );
+	return scratch;
+}
+
+template<>
+const float* rowToFloat<float>( const float *src, int32_t pixelInc, int32_t numChannels, int32_t lanes, int32_t numPixels, float *scratch )
+{
+	if( pixelInc == lanes )
+		return src;
+
+	expandToFloat( src, pixelInc, numChannels, lanes, numPixels, scratch );
+	return scratch;
+}
+
+template<typename T>
+void floatToRow( const float *src, T *dst, int32_t pixelInc, int32_t numChannels, int32_t lanes, int32_t numPixels )
+{
+	if( pixelInc == lanes ) {
+		contiguousFromFloat( src, dst, numPixels * lanes );
+		return;
+	}
+
+	for( int32_t p = 0; p < numPixels; p++ ) {
+		for( int32_t c = 0; c < numChannels; c++ )
+			dst[p * pixelInc + c] = fromFloat<T>( src[p * lanes + c] );
+	}
+}
+
+// ----------------------------------------------------------------------------------------------------
+// Filtering
+// ----------------------------------------------------------------------------------------------------
+
+// Horizontal pass over a row of 4 lane pixels: each tap scales a whole pixel.
+void filterRow4( const SeparableKernel &kx, const float *src, float *dst )
+{
+	const int32_t minStart = kx.getSrcRange().first;
+	for( int32_t b = 0; b < kx.getDstLength(); b++ ) {
+		const float *w = kx.getWeights( b );
+		const float *s = src + ( kx.getStart( b ) - minStart ) * 4;
+		const int32_t count = kx.getCount( b );
+		// even and odd taps are summed separately to halve the dependency chain
+#if defined( CINDER_IP_SSE2 )
+		__m128 sum0 = _mm_mul_ps( _mm_set1_ps( w[0] ), _mm_loadu_ps( s ) );
+		__m128 sum1 = _mm_setzero_ps();
+		int32_t t = 1;
+		for( ; t + 2 <= count; t += 2 ) {
+			sum1 = _mm_add_ps( sum1, _mm_mul_ps( _mm_set1_ps( w[t] ), _mm_loadu_ps( s + t * 4 ) ) );
+			sum0 = _mm_add_ps( sum0, _mm_mul_ps( _mm_set1_ps( w[t + 1] ), _mm_loadu_ps( s + t * 4 + 4 ) ) );
+		}
+		if( t < count )
+			sum1 = _mm_add_ps( sum1, _mm_mul_ps( _mm_set1_ps( w[t] ), _mm_loadu_ps( s + t * 4 ) ) );
+		_mm_storeu_ps( dst + b * 4, _mm_add_ps( sum0, sum1 ) );
+#elif defined( CINDER_IP_NEON )
+		float32x4_t sum0 = vmulq_n_f32( vld1q_f32( s ), w[0] );
+		float32x4_t sum1 = vdupq_n_f32( 0 );
+		int32_t t = 1;
+		for( ; t + 2 <= count; t += 2 ) {
+			sum1 = vmlaq_n_f32( sum1, vld1q_f32( s + t * 4 ), w[t] );
+			sum0 = vmlaq_n_f32( sum0, vld1q_f32( s + t * 4 + 4 ), w[t + 1] );
+		}
+		if( t < count )
+			sum1 = vmlaq_n_f32( sum1, vld1q_f32( s + t * 4 ), w[t] );
+		vst1q_f32( dst + b * 4, vaddq_f32( sum0, sum1 ) );
+#else
+		float sum[4] = { 0, 0, 0, 0 };
+		for( int32_t t = 0; t < count; t++ ) {
+			for( int c = 0; c < 4; c++ )
+				sum[c] += w[t] * s[t * 4 + c];
+		}
+		for( int c = 0; c < 4; c++ )
+			dst[b * 4 + c] = sum[c];
+#endif
+	}
+}
+
+// Horizontal pass over a row of single samples: each destination sample is a dot product of the weights with contiguous source samples.
+void filterRow1( const SeparableKernel &kx, const float *src, float *dst )
+{
+	const int32_t minStart = kx.getSrcRange().first;
+	for( int32_t b = 0; b < kx.getDstLength(); b++ ) {
+		const float *w = kx.getWeights( b );
+		const float *s = src + ( kx.getStart( b ) - minStart );
+		const int32_t count = kx.getCount( b );
+		int32_t t = 0;
+		float sum = 0;
+#if defined( CINDER_IP_SSE2 )
+		if( count >= 4 ) {
+			__m128 sum4 = _mm_setzero_ps();
+			for( ; t + 4 <= count; t += 4 )
+				sum4 = _mm_add_ps( sum4, _mm_mul_ps( _mm_loadu_ps( w + t ), _mm_loadu_ps( s + t ) ) );
+			sum4 = _mm_add_ps( sum4, _mm_movehl_ps( sum4, sum4 ) );
+			sum4 = _mm_add_ss( sum4, _mm_shuffle_ps( sum4, sum4, 1 ) );
+			sum = _mm_cvtss_f32( sum4 );
+		}
+#elif defined( CINDER_IP_NEON )
+		if( count >= 4 ) {
+			float32x4_t sum4 = vdupq_n_f32( 0 );
+			for( ; t + 4 <= count; t += 4 )
+				sum4 = vmlaq_f32( sum4, vld1q_f32( w + t ), vld1q_f32( s + t ) );
+			float32x2_t sum2 = vadd_f32( vget_low_f32( sum4 ), vget_high_f32( sum4 ) );
+			sum = vget_lane_f32( vpadd_f32( sum2, sum2 ), 0 );
+		}
+#endif
+		for( ; t < count; t++ )
+			sum += w[t] * s[t];
+
+		dst[b] = sum;
+	}
+}
+
+// Vertical pass: dst[i] = sum over k of weights[k] * rows[k][i]
+void accumulateRows( const float * const *rows, const float *weights, int32_t count, float *dst, size_t length )
+{
+	size_t i = 0;
+	// 16 columns at a time, so that enough independent sums are in flight to hide the latency of each add
+#if defined( CINDER_IP_SSE2 )
+	for( ; i + 16 <= length; i += 16 ) {
+		__m128 sum[4];
+		__m128 w = _mm_set1_ps( weights[0] );
+		for( int j = 0; j < 4; j++ )
+			sum[j] = _mm_mul_ps( w, _mm_loadu_ps( rows[0] + i + j * 4 ) );
+		for( int32_t k = 1; k < count; k++ ) {
+			w = _mm_set1_ps( weights[k] );
+			for( int j = 0; j < 4; j++ )
+				sum[j] = _mm_add_ps( sum[j], _mm_mul_ps( w, _mm_loadu_ps( rows[k] + i + j * 4 ) ) );
+		}
+		for( int j = 0; j < 4; j++ )
+			_mm_storeu_ps( dst + i + j * 4, sum[j] );
+	}
+#elif defined( CINDER_IP_NEON )
+	for( ; i + 16 <= length; i += 16 ) {
+		float32x4_t sum[4];
+		for( int j = 0; j < 4; j++ )
+			sum[j] = vmulq_n_f32( vld1q_f32( rows[0] + i + j * 4 ), weights[0] );
+		for( int32_t k = 1; k < count; k++ ) {
+			for( int j = 0; j < 4; j++ )
+				sum[j] = vmlaq_n_f32( sum[j], vld1q_f32( rows[k] + i + j * 4 ), weights[k] );
+		}
+		for( int j = 0; j < 4; j++ )
+			vst1q_f32( dst + i + j * 4, sum[j] );
+	}
+#endif
+	for( ; i < length; i++ ) {
+		float sum = weights[0] * rows[0][i];
+		for( int32_t k = 1; k < count; k++ )
+			sum += weights[k] * rows[k][i];
+		dst[i] = sum;
+	}
+}
+
+// A block of pixels in a Surface or Channel. data points to the first sample of the filtered area.
+template<typename T>
+struct Plane {
+	T			*data;
+	ptrdiff_t	rowBytes;
+	int32_t		pixelInc;
+
+	T*	getRow( int32_t y ) const	{ return reinterpret_cast<T*>( reinterpret_cast<typename std::conditional<std::is_const<T>::value, const uint8_t, uint8_t>::type*>( data ) + y * rowBytes ); }
+};
+
+// Filters destination rows [dstY0, dstY1). Horizontally filtered source rows are kept in a ring of ky.getMaxCount() rows, so each source row
+// is filtered once per band and the working set stays a few rows of the destination width.
+template<typename T>
+void filterRows( const Plane<const T> &src, const Plane<T> &dst, int32_t numChannels, int32_t lanes, const SeparableKernel &kx, const SeparableKernel &ky, int32_t dstY0, int32_t dstY1 )
+{
+	const size_t rowLength = kx.getDstLength() * lanes;
+	const int32_t minStart = kx.getSrcRange().first;
+	const int32_t srcSpan = kx.getSrcRange().second - minStart;
+	const int32_t ringSize = ky.getMaxCount();
+
+	vector<float> srcScratch( srcSpan * lanes );
+	vector<float> ring( ringSize * rowLength );
+	vector<int32_t> ringRows( ringSize, -1 );
+	vector<const float*> rows( ringSize );
+	vector<float> accum( rowLength );
+
+	for( int32_t y = dstY0; y < dstY1; y++ ) {
+		const int32_t start = ky.getStart( y ), count = ky.getCount( y );
+		for( int32_t k = 0; k < count; k++ ) {
+			const int32_t srcY = start + k;
+			const int32_t slot = srcY % ringSize;
+			float *line = &ring[slot * rowLength];
+			if( ringRows[slot] != srcY ) {
+				const float *srcRow = rowToFloat( src.getRow( srcY ) + minStart * src.pixelInc, src.pixelInc, numChannels, lanes, srcSpan, srcScratch.data() );
+				if( lanes == 4 )
+					filterRow4( kx, srcRow, line );
+				else
+					filterRow1( kx, srcRow, line );
+				ringRows[slot] = srcY;
+			}
+			rows[k] = line;
+		}
+
+		accumulateRows( rows.data(), ky.getWeights( y ), count, accum.data(), rowLength );
+		floatToRow( accum.data(), dst.getRow( y ), dst.pixelInc, numChannels, lanes, kx.getDstLength() );
+	}
+}
+
+template<typename T>
+void filterPlane( const Plane<const T> &src, const Plane<T> &dst, int32_t numChannels, int32_t lanes, const SeparableKernel &kx, const SeparableKernel &ky )
+{
+	const size_t dstHeight = ky.getDstLength();
+
+	// small images aren't worth waking other threads for. Otherwise bands are sized so that each thread gets several of them
+	const size_t srcRows = ky.getSrcRange().second - ky.getSrcRange().first;
+	const size_t work = ( srcRows * kx.getMaxCount() + dstHeight * ky.getMaxCount() ) * kx.getDstLength() * lanes;
+	size_t grainSize = dstHeight;
+	if( work >= ( 1 << 20 ) ) {
+		const size_t numBands = getMaxThreads() * 4;
+		grainSize = std::max<size_t>( 8, ( dstHeight + numBands - 1 ) / numBands );
+	}
+
+	parallelFor( dstHeight, grainSize, [&]( size_t begin, size_t end ) {
+		filterRows( src, dst, numChannels, lanes, kx, ky, (int32_t)begin, (int32_t)end );
+	} );
+}
+
+} // anonymous namespace
+
+// ----------------------------------------------------------------------------------------------------
+// separableFilter
+// ----------------------------------------------------------------------------------------------------
+
+template<typename T>
+void separableFilter( const SurfaceT<T> &srcSurface, const Area &srcArea, SurfaceT<T> *dstSurface, const Area &dstArea, const SeparableKernel &kernelX, const SeparableKernel &kernelY )
+{
+	CI_ASSERT( kernelX.getSrcLength() == srcArea.getWidth() && kernelY.getSrcLength() == srcArea.getHeight() );
+	CI_ASSERT( kernelX.getDstLength() == dstArea.getWidth() && kernelY.getDstLength() == dstArea.getHeight() );
+	if( dstArea.getWidth() <= 0 || dstArea.getHeight() <= 0 )
+		return;
+
+	if( srcSurface.getChannelOrder() == dstSurface->getChannelOrder() ) {
+		// same layout, so whole pixels are filtered at once (including any unused fourth channel)
+		const int32_t pixelInc = srcSurface.getPixelInc();
+		Plane<const T> src = { srcSurface.getData( srcArea.getUL() ), srcSurface.getRowBytes(), pixelInc };
+		Plane<T> dst = { dstSurface->getData( dstArea.getUL() ), dstSurface->getRowBytes(), pixelInc };
+		filterPlane( src, dst, pixelInc, 4, kernelX, kernelY );
+		return;
+	}
+
+	vector<const ChannelT<T>*> srcChannels = { &srcSurface.getChannelRed(), &srcSurface.getChannelGreen(), &srcSurface.getChannelBlue() };
+	vector<ChannelT<T>*> dstChannels = { &dstSurface->getChannelRed(), &dstSurface->getChannelGreen(), &dstSurface->getChannelBlue() };
+	if( srcSurface.hasAlpha() && dstSurface->hasAlpha() ) {
+		srcChannels.push_back( &srcSurface.getChannelAlpha() );
+		dstChannels.push_back( &dstSurface->getChannelAlpha() );
+	}
+
+	for( size_t c = 0; c < srcChannels.size(); c++ ) {
+		Plane<const T> src = { srcChannels[c]->getData( srcArea.getUL() ), srcChannels[c]->getRowBytes(), srcChannels[c]->getIncrement() };
+		Plane<T> dst = { dstChannels[c]->getData( dstArea.getUL() ), dstChannels[c]->getRowBytes(), dstChannels[c]->getIncrement() };
+		filterPlane( src, dst, 1, 1, kernelX, kernelY );
+	}
+}
+
+template<typename T>
+void separableFilter( const ChannelT<T> &srcChannel, const Area &srcArea, ChannelT<T> *dstChannel, const Area &dstArea, const SeparableKernel &kernelX, const SeparableKernel &kernelY )
+{
+	CI_ASSERT( kernelX.getSrcLength() == srcArea.getWidth() && kernelY.getSrcLength() == srcArea.getHeight() );
+	CI_ASSERT( kernelX.getDstLength() == dstArea.getWidth() && kernelY.getDstLength() == dstArea.getHeight() );
+	if( dstArea.getWidth() <= 0 || dstArea.getHeight() <= 0 )
+		return;
+
+	Plane<const T> src = { srcChannel.getData( srcArea.getUL() ), srcChannel.getRowBytes(), srcChannel.getIncrement() };
+	Plane<T> dst = { dstChannel->getData( dstArea.getUL() ), dstChannel->getRowBytes(), dstChannel->getIncrement() };
+	filterPlane( src, dst, 1, 1, kernelX, kernelY );
+}
+
+#define separableFilter_PROTOTYPES(T)\
+	template CI_API void separableFilter( const SurfaceT<T> &srcSurface, const Area &srcArea, SurfaceT<T> *dstSurface, const Area &dstArea, const SeparableKernel &kernelX, const SeparableKernel &kernelY ); \
+	template CI_API void separableFilter( const ChannelT<T> &srcChannel, const Area &srcArea, ChannelT<T> *dstChannel, const Area &dstArea, const SeparableKernel &kernelX, const SeparableKernel &kernelY );
+
+separableFilter_PROTOTYPES(uint8_t)
+separableFilter_PROTOTYPES(uint16_t)
+separableFilter_PROTOTYPES(float)
+
+namespace detail {
+
+void convertToFloat( const uint8_t *src, float *dst, size_t length )	{ contiguousToFloat( src, dst, length ); }
+void convertToFloat( const uint16_t *src, float *dst, size_t length )	{ contiguousToFloat( src, dst, length ); }
+void convertToFloat( const float *src, float *dst, size_t length )		{ contiguousToFloat( src, dst, length ); }
+void convertFromFloat( const float *src, uint8_t *dst, size_t length )	{ contiguousFromFloat( src, dst, length ); }
+void convertFromFloat( const float *src, uint16_t *dst, size_t length )	{ contiguousFromFloat( src, dst, length ); }
+void convertFromFloat( const float *src, float *dst, size_t length )	{ contiguousFromFloat( src, dst, length ); }
+
+} // namespace detail
+
+} } // namespace cinder::ip
@@ -0,0 +1,78 @@
+// Writes a torus with positions, normals and texture coordinates as an OBJ file and times each phase of loading it with ObjLoader, on one thread
+// and on all threads, followed by loadObjCached() parsing it and writing the cache, and then loading that cache.
+//
+// usage: ObjLoaderBenchmark [torus segments] [iterations]
+
+#include "cinder/ObjLoader.h"
+#include "cinder/TriMesh.h"
+#include "cinder/ip/Parallel.h"
+
+#include <chrono>
+#include <iomanip>
+#include <iostream>
+#include <string>
+
+using namespace std;
+using namespace ci;
+
+void printTiming( const string &name, const ObjLoader::Timing &timing, size_t fileSize )
+{
+	cout << left << setw( 14 ) << name << right << fixed << setprecision( 1 );
+	for( double seconds : { timing.mReadSeconds, timing.mCountSeconds, timing.mParseSeconds, timing.mMergeSeconds, timing.mLoadSeconds, timing.getTotalSeconds() } )
+		cout << setw( 10 ) << seconds * 1000;
+	cout << setw( 10 ) << fileSize / ( 1024.0 * 1024.0 ) / timing.getTotalSeconds() << endl;
+}
+
+void bench( const string &name, const fs::path &path, size_t numThreads, int iterations )
+{
+	ip::setMaxThreads( numThreads );
+	ObjLoader::Timing total = {};
+	for( int i = 0; i < iterations; ++i ) {
+		ObjLoader loader( loadFile( path ) );
+		loader.getNumIndices();
+		total.mReadSeconds += loader.getTiming().mReadSeconds / iterations;
+		total.mCountSeconds += loader.getTiming().mCountSeconds / iterations;
+		total.mParseSeconds += loader.getTiming().mParseSeconds / iterations;
+		total.mMergeSeconds += loader.getTiming().mMergeSeconds / iterations;
+		total.mLoadSeconds += loader.getTiming().mLoadSeconds / iterations;
+	}
+	ip::setMaxThreads( 0 );
+
+	printTiming( name, total, fs::file_size( path ) );
+}
+
+double milliseconds( const function<void ()> &fn )
+{
+	auto begin = chrono::high_resolution_clock::now();
+	fn();
+	return chrono::duration<double, milli>( chrono::high_resolution_clock::now() - begin ).count();
+}
+
+int main( int argc, char *argv[] )
+{
+	int segments = argc > 1 ? stoi( argv[1] ) : 1024;
+	int iterations = argc > 2 ? stoi( argv[2] ) : 3;
+
+	const fs::path path = fs::temp_directory_path() / "ObjLoaderBenchmark.obj";
+	const fs::path cachePath = fs::temp_directory_path() / "ObjLoaderBenchmark.obj.msh";
+	writeObj( writeFile( path ), geom::Torus().subdivisionsAxis( segments ).subdivisionsHeight( segments / 2 ) );
+	cout << "OBJ of " << fs::file_size( path ) / ( 1024.0 * 1024.0 ) << " MiB; milliseconds per phase:" << endl;
+	cout << left << setw( 14 ) << "threads" << right;
+	for( const char *column : { "read", "count", "parse", "merge", "load", "total", "MiB/s" } )
+		cout << setw( 10 ) << column;
+	cout << endl;
+
+	bench( "1", path, 1, iterations );
+	bench( to_string( ip::getMaxThreads() ), path, 0, iterations );
+
+	fs::remove( cachePath );
+	geom::SourceRef source;
+	double parseMs = milliseconds( [&] { source = loadObjCached( path, cachePath ); } );
+	double cachedMs = milliseconds( [&] { source = loadObjCached( path, cachePath ); } );
+	cout << "loadObjCached: " << setprecision( 1 ) << parseMs << " ms parsing and writing a " << fs::file_size( cachePath ) / ( 1024.0 * 1024.0 ) << " MiB cache, "
+		<< setprecision( 3 ) << cachedMs << " ms loading it" << endl;
+
+	fs::remove( path );
+	fs::remove( cachePath );
+	return 0;
+}
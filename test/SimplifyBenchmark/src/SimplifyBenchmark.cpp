@@ -0,0 +1,115 @@
+// Times TriMesh::simplify() down to several ratios of the original triangles, on one thread and on all threads, and TriMesh::calcLodChain().
+// The error reported is the largest quadric error of a collapse, relative to the largest extent of the mesh; the deviation is the largest
+// distance of a triangle's centroid from the rippled torus surface, measured the same way, as a check that the error is meaningful.
+//
+// usage: SimplifyBenchmark [torus segments] [iterations]
+
+#include "cinder/TriMesh.h"
+#include "cinder/ip/Parallel.h"
+
+#include <chrono>
+#include <functional>
+#include <iomanip>
+#include <iostream>
+#include <string>
+#include <vector>
+
+using namespace std;
+using namespace ci;
+
+const float RIPPLE = 0.02f;
+
+float minorRadius( float u, float v )
+{
+	return 0.25f + RIPPLE * sin( u * 7 ) * cos( v * 5 );
+}
+
+// A torus with a rippled surface, standing in for a dense scan: a welded grid of segments x segments / 2 quads with texture coordinates.
+TriMesh makeTorus( int segments )
+{
+	const int rings = segments / 2;
+	TriMesh result( TriMesh::Format().positions().normals().texCoords0( 2 ) );
+	for( int s = 0; s < segments; ++s ) {
+		for( int r = 0; r < rings; ++r ) {
+			float u = s * 2 * (float)M_PI / segments, v = r * 2 * (float)M_PI / rings;
+			float minor = minorRadius( u, v );
+			result.appendPosition( vec3( ( 1 + minor * cos( v ) ) * cos( u ), minor * sin( v ), ( 1 + minor * cos( v ) ) * sin( u ) ) );
+			result.appendTexCoord0( vec2( s / (float)segments, r / (float)rings ) );
+		}
+	}
+	for( int s = 0; s < segments; ++s ) {
+		for( int r = 0; r < rings; ++r ) {
+			uint32_t i0 = s * rings + r, i1 = ( ( s + 1 ) % segments ) * rings + r;
+			uint32_t i2 = ( ( s + 1 ) % segments ) * rings + ( r + 1 ) % rings, i3 = s * rings + ( r + 1 ) % rings;
+			result.appendTriangle( i0, i2, i1 );
+			result.appendTriangle( i0, i3, i2 );
+		}
+	}
+	result.recalculateNormals();
+
+	return result;
+}
+
+// the largest distance of a triangle's centroid from the surface, approximated as the distance from the tube at the centroid's angles
+float maxDeviation( const TriMesh &mesh )
+{
+	float result = 0;
+	for( size_t t = 0; t < mesh.getNumTriangles(); ++t ) {
+		vec3 a, b, c;
+		mesh.getTriangleVertices( t, &a, &b, &c );
+		vec3 p = ( a + b + c ) / 3.0f;
+		float u = atan2( p.z, p.x );
+		vec2 tube( length( vec2( p.x, p.z ) ) - 1, p.y );
+		float v = atan2( tube.y, tube.x );
+		result = std::max( result, std::abs( length( tube ) - minorRadius( u, v ) ) );
+	}
+
+	// relative to the largest extent
+	return result / ( 2 * ( 1.25f + RIPPLE ) );
+}
+
+double millisecondsPer( int iterations, const function<void ()> &fn )
+{
+	double result = 0;
+	for( int i = 0; i < iterations; i++ ) {
+		auto begin = chrono::high_resolution_clock::now();
+		fn();
+		result += chrono::duration<double, milli>( chrono::high_resolution_clock::now() - begin ).count();
+	}
+
+	return result / iterations;
+}
+
+int main( int argc, char *argv[] )
+{
+	int segments = argc > 1 ? stoi( argv[1] ) : 1024;
+	int iterations = argc > 2 ? stoi( argv[2] ) : 3;
+	const size_t maxThreads = ip::getMaxThreads();
+
+	TriMesh torus = makeTorus( segments );
+	cout << "rippled torus of " << torus.getNumTriangles() << " triangles, " << maxThreads << " threads, milliseconds per call:" << endl;
+	cout << left << setw( 10 ) << "ratio" << right << setw( 12 ) << "triangles" << setw( 12 ) << "error" << setw( 12 ) << "deviation";
+	cout << setw( 12 ) << "1 thread" << setw( 12 ) << "threads" << endl;
+
+	for( float ratio : { 0.5f, 0.1f, 0.01f } ) {
+		TriMesh result;
+		float error = 0;
+		auto run = [&] { result = torus; error = result.simplify( ratio, 1.0f ); };
+		ip::setMaxThreads( 1 );
+		double singleMs = millisecondsPer( iterations, run );
+		ip::setMaxThreads( maxThreads );
+		double multiMs = millisecondsPer( iterations, run );
+
+		cout << left << setw( 10 ) << ratio << right << setw( 12 ) << result.getNumTriangles() << setw( 12 ) << setprecision( 5 ) << error;
+		cout << setw( 12 ) << maxDeviation( result ) << fixed << setprecision( 1 ) << setw( 12 ) << singleMs << setw( 12 ) << multiMs << defaultfloat << endl;
+	}
+
+	vector<vector<uint32_t>> chain;
+	vector<float> errors;
+	double chainMs = millisecondsPer( iterations, [&] { chain = torus.calcLodChain( 5, 0.25f, 1.0f, &errors ); } );
+	cout << "LOD chain of " << chain.size() << " levels in " << fixed << setprecision( 1 ) << chainMs << " ms:" << defaultfloat << endl;
+	for( size_t level = 0; level < chain.size(); ++level )
+		cout << setw( 4 ) << level << setw( 12 ) << chain[level].size() / 3 << setw( 12 ) << setprecision( 5 ) << errors[level] << endl;
+
+	return 0;
+}
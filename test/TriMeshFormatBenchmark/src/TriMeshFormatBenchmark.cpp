@@ -0,0 +1,90 @@
+// Compares the size on disk and the time to load a large mesh written as version 2 and as version 3 with each combination of quantization
+// and index compression. 'read' is TriMesh::read(); 'map' opens a MappedTriMesh, and 'decode' additionally decodes every attribute and the
+// indices into memory, which is the work gl::VboMesh::create( MappedTriMesh ) does into mapped buffers (not measured here, since it needs a
+// GL context). Files are read back right after writing them, so the timings are for a warm file cache.
+//
+// usage: TriMeshFormatBenchmark [torus segments] [iterations]
+
+#include "cinder/TriMesh.h"
+#include "cinder/DataSource.h"
+#include "cinder/DataTarget.h"
+
+#include <chrono>
+#include <functional>
+#include <iomanip>
+#include <iostream>
+#include <string>
+#include <vector>
+
+using namespace std;
+using namespace ci;
+
+double millisecondsPer( int iterations, const function<void ()> &fn )
+{
+	double result = 0;
+	for( int i = 0; i < iterations; i++ ) {
+		auto begin = chrono::high_resolution_clock::now();
+		fn();
+		result += chrono::duration<double, milli>( chrono::high_resolution_clock::now() - begin ).count();
+	}
+
+	return result / iterations;
+}
+
+void printRow( const string &name, const fs::path &path, double readMs, double mapMs, double decodeMs )
+{
+	cout << left << setw( 24 ) << name << right << fixed << setprecision( 1 ) << setw( 10 ) << fs::file_size( path ) / ( 1024.0 * 1024.0 )
+		<< setw( 10 ) << readMs;
+	if( mapMs >= 0 )
+		cout << setw( 10 ) << setprecision( 3 ) << mapMs << setw( 10 ) << setprecision( 1 ) << decodeMs;
+	cout << endl;
+}
+
+void benchV3( const string &name, const TriMesh &mesh, const TriMesh::WriteOptions &options, int iterations )
+{
+	const fs::path path = fs::temp_directory_path() / "TriMeshFormatBenchmark.msh";
+	mesh.write( writeFile( path ), options );
+
+	TriMesh loaded;
+	double readMs = millisecondsPer( iterations, [&] { loaded.read( loadFile( path ) ); } );
+	double mapMs = millisecondsPer( iterations, [&] { MappedTriMesh mapped( loadFile( path ) ); } );
+
+	vector<float> attribData;
+	vector<uint32_t> indices( mesh.getNumIndices() );
+	double decodeMs = millisecondsPer( iterations, [&] {
+		MappedTriMesh mapped( loadFile( path ) );
+		for( geom::Attrib attrib : mapped.getAvailableAttribs() ) {
+			attribData.resize( mapped.getNumVertices() * mapped.getAttribDims( attrib ) );
+			mapped.decodeAttrib( attrib, attribData.data() );
+		}
+		mapped.decodeIndices( indices.data() );
+	} );
+
+	printRow( name, path, readMs, mapMs, decodeMs );
+	fs::remove( path );
+}
+
+int main( int argc, char *argv[] )
+{
+	int segments = argc > 1 ? stoi( argv[1] ) : 1024;
+	int iterations = argc > 2 ? stoi( argv[2] ) : 5;
+
+	const TriMesh mesh( geom::Torus().subdivisionsAxis( segments ).subdivisionsHeight( segments / 2 ),
+		TriMesh::Format().positions().normals().texCoords0( 2 ).tangents() );
+	cout << mesh.getNumVertices() << " vertices with normals, tangents and texture coordinates, " << mesh.getNumTriangles() << " triangles" << endl;
+	cout << left << setw( 24 ) << "format" << right << setw( 10 ) << "MiB" << setw( 10 ) << "read ms" << setw( 10 ) << "map ms" << setw( 10 ) << "decode ms" << endl;
+
+	const fs::path path = fs::temp_directory_path() / "TriMeshFormatBenchmark_v2.msh";
+	mesh.write( writeFile( path ) );
+	TriMesh loaded;
+	double readMs = millisecondsPer( iterations, [&] { loaded.read( loadFile( path ) ); } );
+	printRow( "v2", path, readMs, -1, -1 );
+	fs::remove( path );
+
+	benchV3( "v3", mesh, TriMesh::WriteOptions(), iterations );
+	benchV3( "v3 compressed indices", mesh, TriMesh::WriteOptions().compressIndices(), iterations );
+	benchV3( "v3 quantized", mesh, TriMesh::WriteOptions().quantize(), iterations );
+	benchV3( "v3 quantized compressed", mesh, TriMesh::WriteOptions().quantize().compressIndices(), iterations );
+
+	return 0;
+}
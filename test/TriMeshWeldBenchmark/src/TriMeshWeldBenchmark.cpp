@@ -0,0 +1,267 @@
+// Times TriMesh::weld(), smooth TriMesh::recalculateNormals() with each geom::NormalWeighting and TriMesh::recalculateTangents()
+// on a wavy torus emitted as a triangle soup of 100k, 1M and 10M triangles, on one thread and on all threads.
+// The previous implementations, an O(n^2) search for shared positions and a sequential tangent loop, are reproduced below
+// in the legacy namespace for comparison; the quadratic one only runs on meshes of up to [legacy vertex limit] vertices.
+// The largest component difference from the legacy result is printed as a sanity check.
+//
+// usage: TriMeshWeldBenchmark [max triangles] [legacy vertex limit] [iterations]
+
+#include "cinder/TriMesh.h"
+#include "cinder/ip/Parallel.h"
+
+#include <chrono>
+#include <cfloat>
+#include <functional>
+#include <iomanip>
+#include <iostream>
+#include <string>
+#include <vector>
+
+using namespace std;
+using namespace ci;
+
+namespace legacy {
+
+// TriMesh::recalculateNormals( true, weighted )
+void recalculateSmoothNormals( const vector<float> &positions, const vector<uint32_t> &indices, bool weighted, vector<vec3> *normals )
+{
+	size_t numPositions = positions.size() / 3;
+	normals->assign( numPositions, vec3() );
+
+	std::vector<uint32_t> uniquePositions( numPositions, 0 );
+	for( uint32_t i = 0; i < numPositions; ++i ) {
+		if( uniquePositions[i] == 0 ) {
+			uniquePositions[i] = i + 1;
+			const vec3 &v0 = *(const vec3*)(&positions[i * 3]);
+			for( size_t j = i + 1; j < numPositions; ++j ) {
+				const vec3 &v1 = *(const vec3*)(&positions[j * 3]);
+				if( length2( v1 - v0 ) < FLT_EPSILON )
+					uniquePositions[j] = uniquePositions[i];
+			}
+		}
+	}
+
+	size_t numTriangles = indices.size() / 3;
+	for( size_t i = 0; i < numTriangles; ++i ) {
+		uint32_t index0 = uniquePositions[indices[i * 3 + 0]] - 1;
+		uint32_t index1 = uniquePositions[indices[i * 3 + 1]] - 1;
+		uint32_t index2 = uniquePositions[indices[i * 3 + 2]] - 1;
+
+		const vec3 &v0 = *(const vec3*)(&positions[index0 * 3]);
+		const vec3 &v1 = *(const vec3*)(&positions[index1 * 3]);
+		const vec3 &v2 = *(const vec3*)(&positions[index2 * 3]);
+
+		vec3 e0 = v1 - v0;
+		vec3 e1 = v2 - v0;
+		vec3 e2 = v2 - v1;
+
+		if( length2( e0 ) < FLT_EPSILON )
+			continue;
+		if( length2( e1 ) < FLT_EPSILON )
+			continue;
+		if( length2( e2 ) < FLT_EPSILON )
+			continue;
+
+		vec3 normal = cross( e0, e1 );
+		if( ! weighted )
+			normal = normalize( normal );
+
+		(*normals)[index0] += normal;
+		(*normals)[index1] += normal;
+		(*normals)[index2] += normal;
+	}
+
+	for( auto &normal : *normals )
+		normal = normalize( normal );
+
+	for( size_t i = 0; i < numPositions; ++i )
+		(*normals)[i] = (*normals)[uniquePositions[i] - 1];
+}
+
+// geom::calculateTangents()
+void calculateTangents( size_t numIndices, const uint32_t *indices, size_t numVertices, const vec3 *positions, const vec3 *normals, const vec2 *texCoords, vector<vec3> *resultTangents )
+{
+	resultTangents->assign( numVertices, vec3( 0 ) );
+
+	size_t numTriangles = numIndices / 3;
+	for( size_t i = 0; i < numTriangles; ++i ) {
+		uint32_t index0 = indices[i * 3];
+		uint32_t index1 = indices[i * 3 + 1];
+		uint32_t index2 = indices[i * 3 + 2];
+
+		const vec3 &v0 = positions[index0];
+		const vec3 &v1 = positions[index1];
+		const vec3 &v2 = positions[index2];
+
+		const vec2 &w0 = texCoords[index0];
+		const vec2 &w1 = texCoords[index1];
+		const vec2 &w2 = texCoords[index2];
+
+		float x1 = v1.x - v0.x;
+		float x2 = v2.x - v0.x;
+		float y1 = v1.y - v0.y;
+		float y2 = v2.y - v0.y;
+		float z1 = v1.z - v0.z;
+		float z2 = v2.z - v0.z;
+
+		float s1 = w1.x - w0.x;
+		float s2 = w2.x - w0.x;
+		float t1 = w1.y - w0.y;
+		float t2 = w2.y - w0.y;
+
+		float r = (s1 * t2 - s2 * t1);
+		if( r != 0.0f ) r = 1.0f / r;
+
+		vec3 tangent( (t2 * x1 - t1 * x2) * r, (t2 * y1 - t1 * y2) * r, (t2 * z1 - t1 * z2) * r );
+
+		(*resultTangents)[index0] += tangent;
+		(*resultTangents)[index1] += tangent;
+		(*resultTangents)[index2] += tangent;
+	}
+
+	for( size_t i = 0; i < numVertices; ++i ) {
+		vec3 normal = normals[i];
+		vec3 tangent = (*resultTangents)[i];
+		(*resultTangents)[i] = ( tangent - normal * dot( normal, tangent ) );
+
+		float len = length2( (*resultTangents)[i] );
+		if( len > 0.0f )
+			(*resultTangents)[i] /= sqrt( len );
+	}
+}
+
+} // namespace legacy
+
+// A torus with a rippled surface, as a triangle soup: every triangle has its own 3 vertices, so welding has work to do.
+TriMesh makeSoup( size_t numTriangles )
+{
+	const int segments = std::max( 4, (int)sqrt( numTriangles / 2.0 ) );
+	const int rings = std::max( 4, (int)( numTriangles / 2 / segments ) );
+
+	auto position = [&]( int s, int r ) {
+		float u = s % segments * 2 * (float)M_PI / segments, v = r % rings * 2 * (float)M_PI / rings;
+		float minor = 0.25f + 0.02f * sin( u * 7 ) * cos( v * 5 );
+		return vec3( ( 1 + minor * cos( v ) ) * cos( u ), minor * sin( v ), ( 1 + minor * cos( v ) ) * sin( u ) );
+	};
+	auto texCoord = [&]( int s, int r ) {
+		return vec2( s / (float)segments, r / (float)rings );
+	};
+
+	TriMesh result( TriMesh::Format().positions().texCoords0( 2 ) );
+	const int corners[6][2] = { { 0, 0 }, { 1, 0 }, { 1, 1 }, { 0, 0 }, { 1, 1 }, { 0, 1 } };
+	for( int s = 0; s < segments; ++s ) {
+		for( int r = 0; r < rings; ++r ) {
+			for( const auto &corner : corners ) {
+				result.appendPosition( position( s + corner[0], r + corner[1] ) );
+				result.appendTexCoord0( texCoord( s + corner[0], r + corner[1] ) );
+			}
+		}
+	}
+	for( uint32_t i = 0; i < (uint32_t)result.getNumVertices(); i += 3 )
+		result.appendTriangle( i, i + 1, i + 2 );
+
+	return result;
+}
+
+double millisecondsPer( int iterations, const function<void ()> &fn )
+{
+	double result = 0;
+	for( int i = 0; i < iterations; i++ ) {
+		auto begin = chrono::high_resolution_clock::now();
+		fn();
+		result += chrono::duration<double, milli>( chrono::high_resolution_clock::now() - begin ).count();
+	}
+
+	return result / iterations;
+}
+
+float maxDifference( const vector<vec3> &a, const vector<vec3> &b )
+{
+	float result = 0;
+	for( size_t i = 0; i < a.size(); i++ )
+		for( int c = 0; c < 3; c++ )
+			result = std::max( result, fabsf( a[i][c] - b[i][c] ) );
+
+	return result;
+}
+
+void printRow( const string &name, size_t numTriangles, double legacyMs, double singleMs, double multiMs, float difference )
+{
+	cout << left << setw( 18 ) << name << setw( 12 ) << numTriangles << right << fixed << setprecision( 1 );
+	if( legacyMs > 0 )
+		cout << setw( 12 ) << legacyMs;
+	else
+		cout << setw( 12 ) << "-";
+	cout << setw( 12 ) << singleMs << setw( 12 ) << multiMs;
+	if( legacyMs > 0 )
+		cout << setw( 11 ) << setprecision( 1 ) << legacyMs / multiMs << "x" << setw( 12 ) << setprecision( 6 ) << difference;
+	cout << endl;
+}
+
+// times fn() on one thread and on all threads; fn() receives a fresh copy of 'mesh' each time
+void bench( const string &name, const TriMesh &mesh, int iterations, double legacyMs, const function<void ( TriMesh* )> &fn, const function<float ( const TriMesh& )> &difference = nullptr )
+{
+	const size_t maxThreads = ip::getMaxThreads();
+	TriMesh result;
+	auto run = [&] {
+		double ms = 0;
+		for( int i = 0; i < iterations; ++i ) {
+			result = mesh;
+			ms += millisecondsPer( 1, [&] { fn( &result ); } );
+		}
+		return ms / iterations;
+	};
+
+	ip::setMaxThreads( 1 );
+	double singleMs = run();
+	ip::setMaxThreads( maxThreads );
+	double multiMs = run();
+
+	printRow( name, mesh.getNumTriangles(), legacyMs, singleMs, multiMs, ( legacyMs > 0 && difference ) ? difference( result ) : 0 );
+}
+
+void benchSize( size_t numTriangles, size_t legacyVertexLimit, int iterations )
+{
+	TriMesh soup = makeSoup( numTriangles );
+
+	// smooth normals straight from the soup, which includes finding the shared positions
+	vector<vec3> legacyNormals;
+	double legacyNormalsMs = 0;
+	if( soup.getNumVertices() <= legacyVertexLimit )
+		legacyNormalsMs = millisecondsPer( 1, [&] { legacy::recalculateSmoothNormals( soup.getBufferPositions(), soup.getIndices(), false, &legacyNormals ); } );
+	bench( "soup normals", soup, iterations, legacyNormalsMs, []( TriMesh *mesh ) { mesh->recalculateNormals( true, false ); },
+		[&]( const TriMesh &result ) { return maxDifference( legacyNormals, result.getNormals() ); } );
+
+	bench( "weld", soup, iterations, 0, []( TriMesh *mesh ) { mesh->weld(); } );
+
+	TriMesh welded = soup;
+	welded.weld();
+	bench( "normals uniform", welded, iterations, 0, []( TriMesh *mesh ) { mesh->recalculateNormals( geom::NormalWeighting::UNIFORM, true ); } );
+	bench( "normals area", welded, iterations, 0, []( TriMesh *mesh ) { mesh->recalculateNormals( geom::NormalWeighting::AREA, true ); } );
+	bench( "normals angle", welded, iterations, 0, []( TriMesh *mesh ) { mesh->recalculateNormals( geom::NormalWeighting::ANGLE, true ); } );
+
+	welded.recalculateNormals( geom::NormalWeighting::ANGLE, true );
+	vector<vec3> legacyTangents;
+	double legacyTangentsMs = millisecondsPer( iterations, [&] {
+		legacy::calculateTangents( welded.getNumIndices(), welded.getIndices().data(), welded.getNumVertices(), welded.getPositions<3>(), welded.getNormals().data(), welded.getTexCoords0<2>(), &legacyTangents );
+	} );
+	bench( "tangents", welded, iterations, legacyTangentsMs, []( TriMesh *mesh ) { mesh->recalculateTangents(); },
+		[&]( const TriMesh &result ) { return maxDifference( legacyTangents, result.getTangents() ); } );
+}
+
+int main( int argc, char *argv[] )
+{
+	size_t maxTriangles = argc > 1 ? stoull( argv[1] ) : 10000000;
+	size_t legacyVertexLimit = argc > 2 ? stoull( argv[2] ) : 300000;
+	int iterations = argc > 3 ? stoi( argv[3] ) : 3;
+
+	cout << ip::getMaxThreads() << " threads, milliseconds per call:" << endl;
+	cout << left << setw( 18 ) << "operation" << setw( 12 ) << "triangles" << right << setw( 12 ) << "legacy" << setw( 12 ) << "1 thread";
+	cout << setw( 12 ) << "threads" << setw( 12 ) << "speedup" << setw( 12 ) << "max diff" << endl;
+
+	for( size_t numTriangles : { (size_t)100000, (size_t)1000000, (size_t)10000000 } )
+		if( numTriangles <= maxTriangles )
+			benchSize( numTriangles, legacyVertexLimit, iterations );
+
+	return 0;
+}
@@ -0,0 +1,109 @@
+// Reports the simulated post-transform vertex cache efficiency of meshes as generated, as a loader with arbitrary triangle order would emit
+// them, and after TriMesh::optimize() with and without overdraw optimization, along with how long optimizing takes. ACMR is vertices
+// transformed per triangle and ATVR per vertex, for a FIFO cache of [cache size] entries.
+// Triangulator output is 2D, so overdraw optimization is skipped for it.
+//
+// usage: VertexCacheBenchmark [cache size] [iterations]
+
+#include "cinder/TriMesh.h"
+#include "cinder/Triangulate.h"
+#include "cinder/Shape2d.h"
+
+#include <algorithm>
+#include <array>
+#include <chrono>
+#include <functional>
+#include <iomanip>
+#include <iostream>
+#include <random>
+#include <string>
+#include <vector>
+
+using namespace std;
+using namespace ci;
+
+// the same triangles in random order, as from a loader that doesn't care
+TriMesh shuffleTriangles( TriMesh mesh )
+{
+	vector<array<uint32_t, 3>> triangles( mesh.getNumTriangles() );
+	for( size_t t = 0; t < triangles.size(); ++t )
+		triangles[t] = { mesh.getIndices()[t * 3], mesh.getIndices()[t * 3 + 1], mesh.getIndices()[t * 3 + 2] };
+	std::shuffle( triangles.begin(), triangles.end(), std::mt19937( 1 ) );
+	for( size_t t = 0; t < triangles.size(); ++t )
+		std::copy( triangles[t].begin(), triangles[t].end(), mesh.getIndices().begin() + t * 3 );
+
+	return mesh;
+}
+
+// a star with many points, which triangulates into long slivers
+Shape2d makeStar( int points )
+{
+	Shape2d result;
+	for( int i = 0; i < points * 2; ++i ) {
+		float angle = i * (float)M_PI / points, radius = ( i % 2 ) ? 0.4f : 1.0f;
+		vec2 p( radius * cos( angle ), radius * sin( angle ) );
+		if( i == 0 )
+			result.moveTo( p );
+		else
+			result.lineTo( p );
+	}
+	result.close();
+
+	return result;
+}
+
+double millisecondsPer( int iterations, const function<void ()> &fn )
+{
+	double result = 0;
+	for( int i = 0; i < iterations; i++ ) {
+		auto begin = chrono::high_resolution_clock::now();
+		fn();
+		result += chrono::duration<double, milli>( chrono::high_resolution_clock::now() - begin ).count();
+	}
+
+	return result / iterations;
+}
+
+void printStats( const TriMesh &mesh, size_t cacheSize )
+{
+	auto stats = geom::calculateVertexCacheStats( mesh.getNumIndices(), mesh.getIndices().data(), mesh.getNumVertices(), cacheSize );
+	cout << setw( 8 ) << setprecision( 3 ) << stats.mAcmr << setw( 8 ) << stats.mAtvr;
+}
+
+void bench( const string &name, const TriMesh &mesh, size_t cacheSize, int iterations )
+{
+	cout << left << setw( 18 ) << name << setw( 10 ) << mesh.getNumTriangles() << right << fixed;
+	printStats( mesh, cacheSize );
+
+	TriMesh shuffled = shuffleTriangles( mesh );
+	printStats( shuffled, cacheSize );
+
+	TriMesh optimized;
+	double cacheMs = millisecondsPer( iterations, [&] { optimized = shuffled; optimized.optimize( cacheSize, 0 ); } );
+	printStats( optimized, cacheSize );
+
+	double overdrawMs = millisecondsPer( iterations, [&] { optimized = shuffled; optimized.optimize( cacheSize ); } );
+	printStats( optimized, cacheSize );
+
+	cout << setw( 12 ) << setprecision( 1 ) << cacheMs << setw( 12 ) << overdrawMs << endl;
+}
+
+int main( int argc, char *argv[] )
+{
+	size_t cacheSize = argc > 1 ? stoull( argv[1] ) : 16;
+	int iterations = argc > 2 ? stoi( argv[2] ) : 3;
+
+	cout << "FIFO cache of " << cacheSize << " entries; ACMR / ATVR as generated, shuffled, optimized for the cache, and for cache and overdraw; milliseconds to optimize:" << endl;
+	cout << left << setw( 18 ) << "mesh" << setw( 10 ) << "triangles" << right;
+	for( const char *column : { "gen", "", "shuffled", "", "cache", "", "overdraw", "" } )
+		cout << setw( 8 ) << column;
+	cout << setw( 12 ) << "cache ms" << setw( 12 ) << "overdraw ms" << endl;
+
+	bench( "sphere", TriMesh( geom::Sphere().subdivisions( 200 ) ), cacheSize, iterations );
+	bench( "teapot", TriMesh( geom::Teapot().subdivisions( 32 ) ), cacheSize, iterations );
+	bench( "torus", TriMesh( geom::Torus().subdivisionsAxis( 512 ).subdivisionsHeight( 256 ) ), cacheSize, iterations );
+	bench( "extrude", TriMesh( geom::Extrude( makeStar( 2000 ), 0.5f ).subdivisions( 16 ) ), cacheSize, iterations );
+	bench( "triangulator", Triangulator( makeStar( 20000 ) ).calcMesh(), cacheSize, iterations );
+
+	return 0;
+}
@@ -0,0 +1,111 @@
+// Compares audio::ConvolverNode against direct time-domain convolution for impulse responses of 1k to 256k samples.
+// Reports the realtime factor of each, which is the number of seconds of audio convolved per second of wall-clock time.
+// ConvolverNode is measured by rendering white noise with audio::ContextOffline, so its background thread is included.
+//
+// usage: ConvolverBenchmark [seconds to render] [milliseconds per direct convolution measurement]
+
+#include "cinder/audio/ContextOffline.h"
+#include "cinder/audio/ConvolverNode.h"
+#include "cinder/audio/GenNode.h"
+
+#include <chrono>
+#include <iostream>
+#include <iomanip>
+#include <random>
+#include <string>
+#include <vector>
+
+using namespace std;
+using namespace ci;
+
+static const size_t SAMPLE_RATE			= 44100;
+static const size_t FRAMES_PER_BLOCK	= 512;
+
+static audio::BufferRef makeImpulseResponse( size_t length )
+{
+	// exponentially decaying noise, like a reverb tail
+	mt19937 rng( 1 );
+	uniform_real_distribution<float> dist( -1, 1 );
+
+	auto result = make_shared<audio::Buffer>( length );
+	for( size_t i = 0; i < length; i++ )
+		result->getData()[i] = dist( rng ) * exp( -6.0f * float( i ) / float( length ) );
+
+	return result;
+}
+
+static double benchConvolverNode( const audio::BufferRef &impulseResponse, double seconds )
+{
+	auto ctx = make_shared<audio::ContextOffline>( audio::OutputOfflineNode::Format().sampleRate( SAMPLE_RATE ).framesPerBlock( FRAMES_PER_BLOCK ).channels( 1 ) );
+	auto noise = ctx->makeNode( new audio::GenNoiseNode );
+	auto convolver = ctx->makeNode( new audio::ConvolverNode( impulseResponse ) );
+
+	noise >> convolver >> ctx->getOutput();
+	noise->enable();
+	ctx->enable();
+
+	ctx->getOutputOffline()->renderSeconds( seconds );
+	return ctx->getOutputOffline()->getLastRealtimeFactor();
+}
+
+static double benchDirect( const audio::BufferRef &impulseResponse, double milliseconds, float *sink )
+{
+	typedef chrono::high_resolution_clock Clock;
+
+	const size_t irLength = impulseResponse->getNumFrames();
+	const float *ir = impulseResponse->getData();
+
+	// input history is kept in reverse so that each output sample is a dot product over contiguous arrays
+	vector<float> history( irLength + FRAMES_PER_BLOCK, 0 );
+	vector<float> output( FRAMES_PER_BLOCK );
+	mt19937 rng( 2 );
+	uniform_real_distribution<float> dist( -1, 1 );
+
+	size_t numFrames = 0;
+	auto begin = Clock::now();
+	double elapsedSeconds = 0;
+	while( elapsedSeconds * 1000.0 < milliseconds ) {
+		copy( history.begin(), history.begin() + irLength, history.begin() + FRAMES_PER_BLOCK );
+		for( size_t i = 0; i < FRAMES_PER_BLOCK; i++ )
+			history[FRAMES_PER_BLOCK - 1 - i] = dist( rng );
+
+		for( size_t i = 0; i < FRAMES_PER_BLOCK; i++ ) {
+			const float *x = &history[FRAMES_PER_BLOCK - 1 - i];
+			float sum = 0;
+			for( size_t j = 0; j < irLength; j++ )
+				sum += x[j] * ir[j];
+
+			output[i] = sum;
+		}
+
+		*sink += output[0];
+		numFrames += FRAMES_PER_BLOCK;
+		elapsedSeconds = chrono::duration<double>( Clock::now() - begin ).count();
+	}
+
+	return (double)numFrames / (double)SAMPLE_RATE / elapsedSeconds;
+}
+
+int main( int argc, char *argv[] )
+{
+	double seconds = argc > 1 ? stod( argv[1] ) : 30.0;
+	double milliseconds = argc > 2 ? stod( argv[2] ) : 500.0;
+
+	cout << "realtime factor at " << SAMPLE_RATE << " hz, " << FRAMES_PER_BLOCK << " frames per block:" << endl;
+	cout << left << setw( 12 ) << "ir length" << right << setw( 16 ) << "direct" << setw( 16 ) << "ConvolverNode" << setw( 12 ) << "speedup" << endl;
+
+	float sink = 0;
+	for( size_t irLength = 1024; irLength <= 256 * 1024; irLength *= 4 ) {
+		auto impulseResponse = makeImpulseResponse( irLength );
+
+		double direct = benchDirect( impulseResponse, milliseconds, &sink );
+		double partitioned = benchConvolverNode( impulseResponse, seconds );
+
+		cout << left << setw( 12 ) << irLength << right << fixed << setprecision( 2 ) << setw( 16 ) << direct << setw( 16 ) << partitioned;
+		cout << setw( 11 ) << setprecision( 1 ) << partitioned / direct << "x" << endl;
+	}
+
+	// print the sink so that the direct convolution isn't optimized away
+	cout << endl << "(" << sink << ")" << endl;
+	return 0;
+}
@@ -0,0 +1,128 @@
+// Times the audio::dsp vector math and conversion routines at each supported dsp::SimdLevel, for block sizes that
+// are typical of audio processing. Reports the throughput of each routine in millions of samples per second.
+//
+// usage: DspBenchmark [milliseconds per measurement]
+
+#include "cinder/audio/dsp/Dsp.h"
+#include "cinder/audio/dsp/Converter.h"
+#include "cinder/audio/Buffer.h"
+
+#include <chrono>
+#include <functional>
+#include <iostream>
+#include <iomanip>
+#include <random>
+#include <string>
+
+using namespace std;
+using namespace ci;
+
+// Buffers shared by all routines, sized for the largest block and channel count.
+struct BenchData {
+	BenchData( size_t maxFrames, size_t maxChannels )
+		: mA( maxFrames * maxChannels ), mB( maxFrames * maxChannels ), mResult( maxFrames * maxChannels ), mInt16( maxFrames * maxChannels )
+	{
+		mt19937 rng( 1 );
+		uniform_real_distribution<float> dist( -1, 1 );
+		for( size_t i = 0; i < mA.getSize(); i++ ) {
+			mA[i] = dist( rng );
+			mB[i] = dist( rng );
+		}
+	}
+
+	audio::Buffer			mA, mB, mResult;
+	vector<int16_t>			mInt16;
+	float					mSink = 0;
+};
+
+// Returns the number of samples processed in one call for a block of numFrames.
+typedef function<size_t ( BenchData *data, size_t numFrames )> RoutineFn;
+
+static double benchRoutine( const RoutineFn &fn, BenchData *data, size_t numFrames, double milliseconds )
+{
+	typedef chrono::high_resolution_clock Clock;
+
+	// warm up caches and let the cpu clock settle
+	for( int i = 0; i < 100; i++ )
+		fn( data, numFrames );
+
+	size_t numSamples = 0;
+	size_t numCalls = 1;
+	auto begin = Clock::now();
+	double elapsedSeconds = 0;
+	while( elapsedSeconds * 1000.0 < milliseconds ) {
+		for( size_t i = 0; i < numCalls; i++ )
+			numSamples += fn( data, numFrames );
+
+		elapsedSeconds = chrono::duration<double>( Clock::now() - begin ).count();
+		numCalls *= 2;
+	}
+
+	return (double)numSamples / elapsedSeconds / 1.0e6;
+}
+
+static const char* simdLevelToString( audio::dsp::SimdLevel level )
+{
+	switch( level ) {
+		case audio::dsp::SimdLevel::NONE:	return "NONE";
+		case audio::dsp::SimdLevel::SSE2:	return "SSE2";
+		case audio::dsp::SimdLevel::AVX2:	return "AVX2";
+		case audio::dsp::SimdLevel::NEON:	return "NEON";
+	}
+	return "(unknown)";
+}
+
+int main( int argc, char *argv[] )
+{
+	double milliseconds = argc > 1 ? stod( argv[1] ) : 50.0;
+
+	const vector<size_t> blockSizes = { 64, 128, 256, 512, 1024, 2048, 4096 };
+	const size_t maxChannels = 64;
+
+	vector<pair<string, RoutineFn>> routines = {
+		{ "add", []( BenchData *d, size_t n ) { audio::dsp::add( d->mA.getData(), d->mB.getData(), d->mResult.getData(), n ); return n; } },
+		{ "mul scalar", []( BenchData *d, size_t n ) { audio::dsp::mul( d->mA.getData(), 0.5f, d->mResult.getData(), n ); return n; } },
+		{ "addMul", []( BenchData *d, size_t n ) { audio::dsp::addMul( d->mA.getData(), d->mB.getData(), 0.5f, d->mResult.getData(), n ); return n; } },
+		{ "sum", []( BenchData *d, size_t n ) { d->mSink += audio::dsp::sum( d->mA.getData(), n ); return n; } },
+		{ "rms", []( BenchData *d, size_t n ) { d->mSink += audio::dsp::rms( d->mA.getData(), n ); return n; } },
+		{ "float -> int16", []( BenchData *d, size_t n ) { audio::dsp::convert( d->mA.getData(), d->mInt16.data(), n ); return n; } },
+		{ "int16 -> float", []( BenchData *d, size_t n ) { audio::dsp::convert( d->mInt16.data(), d->mResult.getData(), n ); return n; } },
+		{ "interleave 2ch", []( BenchData *d, size_t n ) { audio::dsp::interleave( d->mA.getData(), d->mResult.getData(), n, 2, n ); return n * 2; } },
+		{ "deinterleave 2ch", []( BenchData *d, size_t n ) { audio::dsp::deinterleave( d->mA.getData(), d->mResult.getData(), n, 2, n ); return n * 2; } },
+		{ "interleave 2ch int16", []( BenchData *d, size_t n ) { audio::dsp::interleave( d->mA.getData(), d->mInt16.data(), n, 2, n ); return n * 2; } },
+		{ "deinterleave 2ch int16", []( BenchData *d, size_t n ) { audio::dsp::deinterleave( d->mInt16.data(), d->mResult.getData(), n, 2, n ); return n * 2; } },
+		{ "interleave 8ch", []( BenchData *d, size_t n ) { audio::dsp::interleave( d->mA.getData(), d->mResult.getData(), n, 8, n ); return n * 8; } },
+		{ "interleave 64ch", []( BenchData *d, size_t n ) { audio::dsp::interleave( d->mA.getData(), d->mResult.getData(), n, 64, n ); return n * 64; } },
+		{ "deinterleave 64ch", []( BenchData *d, size_t n ) { audio::dsp::deinterleave( d->mA.getData(), d->mResult.getData(), n, 64, n ); return n * 64; } }
+	};
+
+	BenchData data( blockSizes.back(), maxChannels );
+
+	for( auto level : { audio::dsp::SimdLevel::NONE, audio::dsp::SimdLevel::SSE2, audio::dsp::SimdLevel::AVX2, audio::dsp::SimdLevel::NEON } ) {
+		if( ! audio::dsp::isSimdLevelSupported( level ) )
+			continue;
+
+		audio::dsp::setSimdLevel( level );
+
+		cout << endl << "SimdLevel::" << simdLevelToString( level ) << ", millions of samples per second per frames-per-block:" << endl;
+		cout << left << setw( 26 ) << "routine";
+		for( size_t blockSize : blockSizes )
+			cout << right << setw( 10 ) << blockSize;
+		cout << endl;
+
+		for( const auto &routine : routines ) {
+			cout << left << setw( 26 ) << routine.first;
+			for( size_t blockSize : blockSizes ) {
+				double throughput = benchRoutine( routine.second, &data, blockSize, milliseconds );
+				cout << right << setw( 10 ) << fixed << setprecision( 0 ) << throughput << flush;
+			}
+			cout << endl;
+		}
+	}
+
+	audio::dsp::setSimdLevel( audio::dsp::getSupportedSimdLevel() );
+
+	// print the sink so that the reductions aren't optimized away
+	cout << endl << "(" << data.mSink << ")" << endl;
+	return 0;
+}
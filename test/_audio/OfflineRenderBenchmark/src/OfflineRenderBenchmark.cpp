@@ -0,0 +1,125 @@
+// Renders a few representative Node graphs with audio::ContextOffline and reports the realtime factor for each,
+// which is the number of seconds of audio rendered per second of wall-clock time. Each graph is rendered once on a single
+// thread and once more with Context::setNumProcessingThreads(), if more than one processing thread is requested.
+//
+// usage: OfflineRenderBenchmark [seconds to render] [path to .wav file for the last graph] [number of processing threads]
+
+#include "cinder/audio/ContextOffline.h"
+#include "cinder/audio/GenNode.h"
+#include "cinder/audio/FilterNode.h"
+#include "cinder/audio/GainNode.h"
+#include "cinder/audio/Target.h"
+
+#include <algorithm>
+#include <functional>
+#include <iostream>
+#include <iomanip>
+#include <string>
+#include <thread>
+
+using namespace std;
+using namespace ci;
+
+typedef function<void ( const audio::ContextOfflineRef & )> GraphBuilderFn;
+
+// GenSineNode -> GainNode
+static void buildSineGain( const audio::ContextOfflineRef &ctx )
+{
+	auto gen = ctx->makeNode( new audio::GenSineNode( 440 ) );
+	auto gain = ctx->makeNode( new audio::GainNode( 0.5f ) );
+
+	gen >> gain >> ctx->getOutput();
+	gen->enable();
+}
+
+// GenOscNode -> FilterLowPassNode -> GainNode, with the cutoff and gain ramping
+static void buildOscFilterGain( const audio::ContextOfflineRef &ctx )
+{
+	auto gen = ctx->makeNode( new audio::GenOscNode( audio::WaveformType::SAWTOOTH, 110 ) );
+	auto lowpass = ctx->makeNode( new audio::FilterLowPassNode );
+	auto gain = ctx->makeNode( new audio::GainNode( 0 ) );
+
+	gen >> lowpass >> gain >> ctx->getOutput();
+	gen->enable();
+	lowpass->setCutoffFreq( 2000 );
+	gain->getParam()->applyRamp( 0.5f, 1.0f );
+}
+
+// NUM_VOICES of the above summed into a master GainNode
+static void buildVoices( const audio::ContextOfflineRef &ctx, size_t numVoices )
+{
+	auto master = ctx->makeNode( new audio::GainNode( 1.0f / (float)numVoices ) );
+	master >> ctx->getOutput();
+
+	for( size_t i = 0; i < numVoices; i++ ) {
+		auto gen = ctx->makeNode( new audio::GenOscNode( audio::WaveformType::SAWTOOTH, 55.0f * float( 1 + i % 12 ) ) );
+		auto lowpass = ctx->makeNode( new audio::FilterLowPassNode );
+		auto gain = ctx->makeNode( new audio::GainNode( 0 ) );
+
+		gen >> lowpass >> gain >> master;
+		gen->enable();
+		lowpass->setCutoffFreq( 800.0f + 100.0f * (float)i );
+		gain->getParam()->applyRamp( 1.0f, 0.01f );
+	}
+}
+
+static double benchGraph( const GraphBuilderFn &buildFn, size_t framesPerBlock, size_t numThreads, double seconds, const fs::path &outputPath = fs::path() )
+{
+	auto ctx = make_shared<audio::ContextOffline>( audio::OutputOfflineNode::Format().sampleRate( 48000 ).framesPerBlock( framesPerBlock ) );
+	ctx->setNumProcessingThreads( numThreads );
+	buildFn( ctx );
+	ctx->enable();
+
+	auto output = ctx->getOutputOffline();
+	if( ! outputPath.empty() )
+		output->setTargetFile( audio::TargetFile::create( outputPath, output->getOutputSampleRate(), output->getNumChannels(), audio::SampleType::INT_16 ) );
+
+	output->renderSeconds( seconds );
+	output->setTargetFile( nullptr );
+
+	return output->getLastRealtimeFactor();
+}
+
+int main( int argc, char *argv[] )
+{
+	double seconds = argc > 1 ? stod( argv[1] ) : 30.0;
+	fs::path outputPath = argc > 2 ? fs::path( argv[2] ) : fs::path();
+	size_t numThreads = argc > 3 ? (size_t)stoul( argv[3] ) : std::max<size_t>( thread::hardware_concurrency(), 1 );
+
+	vector<pair<string, GraphBuilderFn>> graphs = {
+		{ "sine -> gain", buildSineGain },
+		{ "osc -> lowpass -> gain", buildOscFilterGain },
+		{ "16 voices", bind( buildVoices, placeholders::_1, 16 ) },
+		{ "128 voices", bind( buildVoices, placeholders::_1, 128 ) }
+	};
+
+	const vector<size_t> blockSizes = { 64, 512, 4096, 16384 };
+
+	cout << "rendering " << seconds << " seconds per graph, realtime factor per frames-per-block:" << endl;
+	cout << left << setw( 36 ) << "graph";
+	for( size_t blockSize : blockSizes )
+		cout << right << setw( 12 ) << blockSize;
+	cout << endl;
+
+	vector<size_t> threadCounts = { 1 };
+	if( numThreads > 1 )
+		threadCounts.push_back( numThreads );
+
+	for( size_t i = 0; i < graphs.size(); i++ ) {
+		for( size_t threads : threadCounts ) {
+			string name = graphs[i].first;
+			if( threads > 1 )
+				name += " (" + to_string( threads ) + " threads)";
+
+			cout << left << setw( 36 ) << name;
+			for( size_t blockSize : blockSizes ) {
+				bool writeFile = ( i == graphs.size() - 1 && blockSize == blockSizes.back() && threads == threadCounts.back() );
+				double rtf = benchGraph( graphs[i].second, blockSize, threads, seconds, writeFile ? outputPath : fs::path() );
+				cout << right << setw( 11 ) << fixed << setprecision( 1 ) << rtf << "x" << flush;
+			}
+			cout << endl;
+		}
+	}
+
+	return 0;
+}
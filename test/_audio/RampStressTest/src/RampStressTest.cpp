@@ -0,0 +1,99 @@
+// Drives an audio::ContextOffline from a thread paced like a hardware callback, while the main thread schedules Param ramps
+// as fast as requested. Reports the number of xruns (blocks that finished after their deadline) and the worst block time,
+// which shows whether user thread ramp scheduling ever stalls the render callback.
+//
+// usage: RampStressTest [ramps per second] [seconds] [frames per block] [number of voices]
+
+#include "cinder/audio/ContextOffline.h"
+#include "cinder/audio/GenNode.h"
+#include "cinder/audio/GainNode.h"
+
+#include <atomic>
+#include <chrono>
+#include <iostream>
+#include <string>
+#include <thread>
+#include <vector>
+
+using namespace std;
+using namespace ci;
+
+typedef chrono::steady_clock Clock;
+
+int main( int argc, char *argv[] )
+{
+	const double rampsPerSecond = argc > 1 ? stod( argv[1] ) : 10000.0;
+	const double seconds = argc > 2 ? stod( argv[2] ) : 10.0;
+	const size_t framesPerBlock = argc > 3 ? (size_t)stoul( argv[3] ) : 128;
+	const size_t numVoices = argc > 4 ? (size_t)stoul( argv[4] ) : 32;
+	const size_t sampleRate = 48000;
+
+	auto ctx = make_shared<audio::ContextOffline>( audio::OutputOfflineNode::Format().sampleRate( sampleRate ).framesPerBlock( framesPerBlock ) );
+	auto master = ctx->makeNode( new audio::GainNode( 1.0f / (float)numVoices ) );
+	master >> ctx->getOutput();
+
+	vector<audio::GainNodeRef> gains;
+	for( size_t i = 0; i < numVoices; i++ ) {
+		auto gen = ctx->makeNode( new audio::GenSineNode( 110.0f * float( 1 + i % 8 ) ) );
+		auto gain = ctx->makeNode( new audio::GainNode( 0 ) );
+		gen >> gain >> master;
+		gen->enable();
+		gains.push_back( gain );
+	}
+
+	ctx->enable();
+
+	const auto blockPeriod = chrono::duration_cast<Clock::duration>( chrono::duration<double>( (double)framesPerBlock / (double)sampleRate ) );
+	const size_t numBlocks = size_t( seconds * sampleRate ) / framesPerBlock;
+
+	atomic<bool> rendering( true );
+	size_t numXruns = 0;
+	double maxBlockSeconds = 0;
+
+	thread audioThread( [&] {
+		auto output = ctx->getOutputOffline();
+		auto deadline = Clock::now() + blockPeriod;
+		for( size_t i = 0; i < numBlocks; i++ ) {
+			auto begin = Clock::now();
+			output->renderBlock();
+			auto end = Clock::now();
+
+			maxBlockSeconds = max( maxBlockSeconds, chrono::duration<double>( end - begin ).count() );
+			if( end > deadline ) {
+				numXruns++;
+				deadline = end; // resync, like a device would after an underrun
+			}
+			else
+				this_thread::sleep_until( deadline );
+
+			deadline += blockPeriod;
+		}
+		rendering = false;
+	} );
+
+	// schedule ramps in small bursts, as a UI thread would once per frame
+	const auto burstPeriod = chrono::milliseconds( 16 );
+	const size_t rampsPerBurst = max<size_t>( 1, size_t( rampsPerSecond * 0.016 ) );
+	size_t numRamps = 0;
+	auto nextBurst = Clock::now();
+	while( rendering ) {
+		for( size_t i = 0; i < rampsPerBurst; i++ ) {
+			auto &gain = gains[numRamps % gains.size()];
+			gain->getParam()->applyRamp( float( numRamps % 7 ) / 7.0f, 0.005 );
+			gain->getParam()->appendRamp( 0, 0.02 );
+			numRamps++;
+		}
+
+		nextBurst += burstPeriod;
+		this_thread::sleep_until( nextBurst );
+	}
+
+	audioThread.join();
+
+	const double blockMillis = 1000.0 * (double)framesPerBlock / (double)sampleRate;
+	cout << "blocks: " << numBlocks << " (" << blockMillis << " ms each), voices: " << numVoices << endl;
+	cout << "ramps scheduled: " << numRamps << " (" << (double)numRamps / seconds << " per second)" << endl;
+	cout << "xruns: " << numXruns << ", worst block: " << maxBlockSeconds * 1000.0 << " ms" << endl;
+
+	return numXruns ? 1 : 0;
+}
@@ -0,0 +1,156 @@
+// Captures every frame of an animated scene, either synchronously with Fbo::readPixels8u() / copyWindowSurface() or through
+// gl::AsyncReadback8u, and reports the frame time of each. With 'w' the captured frames are written to disk as PNGs by the
+// readback's encoder threads. Also runs under the headless EGL renderer.
+//
+// keys: 'a' toggles async readback, 'f' switches between the Fbo and the window, 'w' toggles writing frames to disk
+
+#include "cinder/app/App.h"
+#include "cinder/app/RendererGl.h"
+#include "cinder/gl/gl.h"
+#include "cinder/ImageIo.h"
+#include "cinder/Timer.h"
+
+#include <iomanip>
+
+using namespace ci;
+using namespace ci::app;
+using namespace std;
+
+class AsyncReadbackTestApp : public App {
+  public:
+	static void prepareSettings( Settings *settings );
+
+	void setup() override;
+	void keyDown( KeyEvent event ) override;
+	void draw() override;
+
+  private:
+	void	renderScene();
+	void	createReadback();
+	void	verifyFrame( const Surface8u &surface, uint64_t id );
+
+	gl::FboRef					mFbo;
+	gl::AsyncReadback8uRef		mReadback;
+	bool						mAsync = true, mReadFbo = true, mWriteFrames = false;
+	fs::path					mFramesPath;
+
+	Timer						mFrameTimer;
+	double						mFrameSecondsTotal = 0;
+	int							mNumFrames = 0;
+	size_t						mNumCaptured = 0;
+};
+
+void AsyncReadbackTestApp::prepareSettings( Settings *settings )
+{
+	settings->setWindowSize( 1280, 720 );
+	settings->disableFrameRate();
+}
+
+void AsyncReadbackTestApp::setup()
+{
+	gl::enableVerticalSync( false );
+	mFbo = gl::Fbo::create( 1920, 1080, gl::Fbo::Format().samples( 4 ) );
+	mFramesPath = getAppPath() / "frames";
+	createReadback();
+
+	console() << "source  mode   write  ms/frame  captured  stalls" << endl;
+	mFrameTimer.start();
+}
+
+void AsyncReadbackTestApp::createReadback()
+{
+	// finishes the previous readback's pending frames and encodes
+	mReadback.reset();
+
+	auto format = gl::AsyncReadback8u::Format().depth( 3 ).alpha( false ).callback( [this]( const Surface8u &surface, uint64_t id ) { verifyFrame( surface, id ); } );
+	if( mWriteFrames ) {
+		fs::create_directories( mFramesPath );
+		fs::path framesPath = mFramesPath;
+		format.encoder( [framesPath]( const Surface8u &surface, uint64_t id ) {
+			writeImage( framesPath / ( "frame_" + to_string( id ) + ".png" ), surface );
+		}, 3 );
+	}
+
+	mReadback = gl::AsyncReadback8u::create( format );
+}
+
+void AsyncReadbackTestApp::verifyFrame( const Surface8u &surface, uint64_t id )
+{
+	// the scene's top-left quadrant is red, which catches flipped or misplaced reads
+	if( surface.getWidth() > 0 && surface.getPixel( ivec2( 4, 4 ) ).r < 200 )
+		console() << "frame " << id << " has unexpected contents: " << surface.getPixel( ivec2( 4, 4 ) ) << endl;
+	++mNumCaptured;
+}
+
+void AsyncReadbackTestApp::keyDown( KeyEvent event )
+{
+	if( event.getChar() == 'a' )
+		mAsync = ! mAsync;
+	else if( event.getChar() == 'f' )
+		mReadFbo = ! mReadFbo;
+	else if( event.getChar() == 'w' ) {
+		mWriteFrames = ! mWriteFrames;
+		createReadback();
+	}
+	else
+		return;
+
+	mFrameSecondsTotal = 0;
+	mNumFrames = 0;
+	mNumCaptured = 0;
+}
+
+void AsyncReadbackTestApp::renderScene()
+{
+	gl::clear( Color( 0.1f, 0.1f, 0.15f ) );
+	gl::setMatricesWindow( gl::getViewport().second );
+	const vec2 size = vec2( gl::getViewport().second );
+
+	gl::color( 1, 0, 0 );
+	gl::drawSolidRect( Rectf( vec2( 0 ), size * 0.5f ) );
+	gl::color( 0, 1, 0 );
+	for( int i = 0; i < 200; ++i ) {
+		float t = (float)getElapsedSeconds() + i * 0.1f;
+		gl::drawSolidCircle( size * vec2( 0.5f + 0.4f * cos( t * 0.7f ), 0.5f + 0.4f * sin( t * 1.3f ) ), 20 );
+	}
+}
+
+void AsyncReadbackTestApp::draw()
+{
+	if( mReadFbo ) {
+		{
+			gl::ScopedFramebuffer fboScp( mFbo );
+			gl::ScopedViewport viewportScp( mFbo->getSize() );
+			renderScene();
+		}
+		gl::clear();
+		gl::setMatricesWindow( getWindowSize() );
+		gl::color( Color::white() );
+		gl::draw( mFbo->getColorTexture(), Rectf( getWindowBounds() ) );
+
+		if( mAsync )
+			mReadback->read( mFbo );
+		else
+			verifyFrame( mFbo->readPixels8u( mFbo->getBounds() ), 0 );
+	}
+	else {
+		renderScene();
+		if( mAsync )
+			mReadback->readWindow( toPixels( getWindowBounds() ), toPixels( getWindowHeight() ) );
+		else
+			verifyFrame( Surface8u( copyWindowSurface() ), 0 );
+	}
+	mReadback->update();
+
+	mFrameSecondsTotal += mFrameTimer.getSeconds();
+	mFrameTimer.start();
+	if( ++mNumFrames == 120 ) {
+		console() << setw( 6 ) << ( mReadFbo ? "fbo" : "window" ) << "  " << setw( 5 ) << ( mAsync ? "async" : "sync" ) << "  " << setw( 5 ) << ( mWriteFrames ? "yes" : "no" )
+				<< "  " << setw( 8 ) << fixed << setprecision( 3 ) << mFrameSecondsTotal / mNumFrames * 1000 << "  " << setw( 8 ) << mNumCaptured << "  " << setw( 6 ) << mReadback->getNumStalls() << endl;
+		mFrameSecondsTotal = 0;
+		mNumFrames = 0;
+		mNumCaptured = 0;
+	}
+}
+
+CINDER_APP( AsyncReadbackTestApp, RendererGl, &AsyncReadbackTestApp::prepareSettings )
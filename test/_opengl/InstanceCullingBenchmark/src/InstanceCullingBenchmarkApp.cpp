@@ -0,0 +1,265 @@
+// Draws 500,000 spheres with three levels of detail and reports the CPU and GPU time per frame when culled with a loop over
+// Frustum::intersects() that re-uploads the visible instances, with gl::InstanceCuller's compute shader, and with its CPU path.
+//
+// keys: 'c' cycles between the culling modes, 'v' checks that the compute shader and the CPU path find the same visible instances
+
+#include "cinder/app/App.h"
+#include "cinder/app/RendererGl.h"
+#include "cinder/gl/gl.h"
+#include "cinder/gl/InstanceCuller.h"
+#include "cinder/gl/Query.h"
+#include "cinder/Rand.h"
+#include "cinder/Timer.h"
+#include "cinder/TriMesh.h"
+
+#include <iomanip>
+
+using namespace ci;
+using namespace ci::app;
+using namespace std;
+
+class InstanceCullingBenchmarkApp : public App {
+  public:
+	static void prepareSettings( Settings *settings );
+
+	void setup() override;
+	void keyDown( KeyEvent event ) override;
+	void draw() override;
+
+  private:
+	enum Mode { LOOP, GPU, CPU, NUM_MODES };
+
+	void	validate();
+	void	resetStats();
+
+	vector<gl::InstanceCuller::Instance>	mInstances;
+	vector<vec4>							mPositions; // xyz and scale
+	gl::InstanceCullerRef					mGpuCuller, mCpuCuller;
+	gl::GlslProgRef							mCulledGlsl, mLoopGlsl;
+	gl::VboRef								mVertexVbo, mIndexVbo, mLoopInstancesVbo;
+	gl::SsboRef								mPositionsSsbo;
+	gl::VaoRef								mGpuVao, mCpuVao, mLoopVao;
+	GLuint									mLod0Indices = 0;
+	Mode									mMode = GPU;
+
+	CameraPersp								mCamera;
+	gl::QueryTimeSwappedRef					mGpuQuery;
+	double									mCpuMsTotal = 0, mGpuMsTotal = 0;
+	int										mNumFrames = 0;
+};
+
+void InstanceCullingBenchmarkApp::prepareSettings( Settings *settings )
+{
+	settings->setWindowSize( 1280, 720 );
+	settings->disableFrameRate();
+}
+
+void InstanceCullingBenchmarkApp::setup()
+{
+	gl::enableVerticalSync( false );
+	mGpuQuery = gl::QueryTimeSwapped::create();
+	mCamera.setPerspective( 60, getWindowAspectRatio(), 1, 2000 );
+
+	// three spheres of decreasing detail share one vertex and one index buffer
+	vector<float> vertices;
+	vector<uint32_t> indices;
+	gl::InstanceCuller::Format format;
+	const int subdivisions[] = { 32, 12, 4 };
+	const float lodDistances[] = { 150, 400, 1200 };
+	for( int lod = 0; lod < 3; ++lod ) {
+		TriMesh mesh( geom::Sphere().subdivisions( subdivisions[lod] ), TriMesh::Format().positions().normals() );
+		const GLint baseVertex = GLint( vertices.size() / 6 );
+		format.lod( (GLuint)mesh.getNumIndices(), (GLuint)indices.size(), baseVertex, lodDistances[lod] );
+		if( lod == 0 )
+			mLod0Indices = (GLuint)mesh.getNumIndices();
+		for( size_t v = 0; v < mesh.getNumVertices(); ++v ) {
+			const vec3 &p = mesh.getPositions<3>()[v], &n = mesh.getNormals()[v];
+			vertices.insert( vertices.end(), { p.x, p.y, p.z, n.x, n.y, n.z } );
+		}
+		indices.insert( indices.end(), mesh.getIndices().begin(), mesh.getIndices().end() );
+	}
+	mVertexVbo = gl::Vbo::create( GL_ARRAY_BUFFER, vertices );
+	mIndexVbo = gl::Vbo::create( GL_ELEMENT_ARRAY_BUFFER, indices );
+
+	Rand rnd( 1 );
+	for( uint32_t i = 0; i < 500000; ++i ) {
+		const vec3 position( rnd.nextFloat( -1000, 1000 ), rnd.nextFloat( -60, 60 ), rnd.nextFloat( -1000, 1000 ) );
+		const float scale = rnd.nextFloat( 0.5f, 2 );
+		mPositions.emplace_back( position, scale );
+		mInstances.emplace_back( position, vec3( scale ), i );
+	}
+	mPositionsSsbo = gl::Ssbo::create( mPositions.size() * sizeof(vec4), mPositions.data(), GL_STATIC_DRAW );
+	mLoopInstancesVbo = gl::Vbo::create( GL_ARRAY_BUFFER, mPositions.size() * sizeof(vec4), nullptr, GL_STREAM_DRAW );
+
+	mGpuCuller = gl::InstanceCuller::create( format );
+	mCpuCuller = gl::InstanceCuller::create( gl::InstanceCuller::Format( format ).cpu() );
+	mGpuCuller->setInstances( mInstances );
+	mCpuCuller->setInstances( mInstances );
+
+	const string fragment = CI_GLSL( 430,
+		in vec3 vNormal;
+		out vec4 oColor;
+
+		void main() {
+			oColor = vec4( vec3( 0.9, 0.8, 0.6 ) * max( 0.1, normalize( vNormal ).z ), 1.0 );
+		}
+	);
+	mCulledGlsl = gl::GlslProg::create( gl::GlslProg::Format()
+		.vertex( CI_GLSL( 430,
+			uniform mat4 ciViewProjection;
+			uniform mat3 ciNormalMatrix;
+			in vec4 ciPosition;
+			in vec3 ciNormal;
+			in uint ciInstanceId;
+			layout( std430, binding = 0 ) readonly buffer Positions { vec4 uPositions[]; };
+			out vec3 vNormal;
+
+			void main() {
+				vec4 position = uPositions[ciInstanceId];
+				vNormal = ciNormalMatrix * ciNormal;
+				gl_Position = ciViewProjection * vec4( ciPosition.xyz * position.w + position.xyz, 1.0 );
+			}
+		) )
+		.fragment( fragment ) );
+	mLoopGlsl = gl::GlslProg::create( gl::GlslProg::Format()
+		.vertex( CI_GLSL( 430,
+			uniform mat4 ciViewProjection;
+			uniform mat3 ciNormalMatrix;
+			in vec4 ciPosition;
+			in vec3 ciNormal;
+			in vec4 aInstancePosition;
+			out vec3 vNormal;
+
+			void main() {
+				vNormal = ciNormalMatrix * ciNormal;
+				gl_Position = ciViewProjection * vec4( ciPosition.xyz * aInstancePosition.w + aInstancePosition.xyz, 1.0 );
+			}
+		) )
+		.fragment( fragment ) );
+
+	auto ctx = gl::context();
+	auto setupVao = [&]( const gl::GlslProgRef &glsl ) {
+		auto vao = gl::Vao::create();
+		gl::ScopedVao vaoScp( vao );
+		gl::ScopedBuffer vertexScp( mVertexVbo );
+		GLint positionLoc = glsl->getAttribSemanticLocation( geom::Attrib::POSITION ), normalLoc = glsl->getAttribSemanticLocation( geom::Attrib::NORMAL );
+		ctx->enableVertexAttribArray( positionLoc );
+		ctx->vertexAttribPointer( positionLoc, 3, GL_FLOAT, GL_FALSE, 6 * sizeof(float), nullptr );
+		ctx->enableVertexAttribArray( normalLoc );
+		ctx->vertexAttribPointer( normalLoc, 3, GL_FLOAT, GL_FALSE, 6 * sizeof(float), (const GLvoid*)( 3 * sizeof(float) ) );
+		mIndexVbo->bind();
+		return vao;
+	};
+
+	mGpuVao = setupVao( mCulledGlsl );
+	{
+		gl::ScopedVao vaoScp( mGpuVao );
+		mGpuCuller->setupVisibleIdsAttrib( mCulledGlsl->getAttribLocation( "ciInstanceId" ) );
+	}
+	mCpuVao = setupVao( mCulledGlsl );
+	{
+		gl::ScopedVao vaoScp( mCpuVao );
+		mCpuCuller->setupVisibleIdsAttrib( mCulledGlsl->getAttribLocation( "ciInstanceId" ) );
+	}
+	mLoopVao = setupVao( mLoopGlsl );
+	{
+		gl::ScopedVao vaoScp( mLoopVao );
+		gl::ScopedBuffer instancesScp( mLoopInstancesVbo );
+		GLint loc = mLoopGlsl->getAttribLocation( "aInstancePosition" );
+		ctx->enableVertexAttribArray( loc );
+		ctx->vertexAttribPointer( loc, 4, GL_FLOAT, GL_FALSE, 0, nullptr );
+		ctx->vertexAttribDivisor( loc, 1 );
+	}
+
+	console() << "instances  mode  CPU ms/frame  GPU ms/frame" << endl;
+}
+
+void InstanceCullingBenchmarkApp::resetStats()
+{
+	mCpuMsTotal = mGpuMsTotal = 0;
+	mNumFrames = 0;
+}
+
+void InstanceCullingBenchmarkApp::keyDown( KeyEvent event )
+{
+	if( event.getChar() == 'c' ) {
+		mMode = Mode( ( mMode + 1 ) % NUM_MODES );
+		resetStats();
+	}
+	else if( event.getChar() == 'v' )
+		validate();
+}
+
+void InstanceCullingBenchmarkApp::validate()
+{
+	mGpuCuller->cull( mCamera );
+	mCpuCuller->cull( mCamera );
+	auto gpu = mGpuCuller->readVisibleIds(), cpu = mCpuCuller->readVisibleIds();
+
+	// the compute shader appends in whatever order its invocations run
+	size_t numDifferent = 0;
+	for( size_t lod = 0; lod < gpu.size(); ++lod ) {
+		sort( gpu[lod].begin(), gpu[lod].end() );
+		vector<uint32_t> difference;
+		set_symmetric_difference( gpu[lod].begin(), gpu[lod].end(), cpu[lod].begin(), cpu[lod].end(), back_inserter( difference ) );
+		console() << "lod " << lod << ": " << gpu[lod].size() << " visible on the GPU, " << cpu[lod].size() << " on the CPU" << endl;
+		numDifferent += difference.size();
+	}
+	console() << ( numDifferent == 0 ? "GPU and CPU culling agree" : "GPU and CPU culling differ on " + to_string( numDifferent ) + " instances" ) << endl;
+}
+
+void InstanceCullingBenchmarkApp::draw()
+{
+	const float t = (float)getElapsedSeconds() * 0.1f;
+	mCamera.lookAt( vec3( cos( t ) * 300, 40, sin( t ) * 300 ), vec3( cos( t + 0.5f ) * 600, 0, sin( t + 0.5f ) * 600 ) );
+
+	gl::clear();
+	gl::setMatrices( mCamera );
+	gl::ScopedDepth depthScp( true );
+
+	Timer cpuTimer( true );
+	mGpuQuery->begin();
+
+	if( mMode == LOOP ) {
+		const Frustumf frustum( mCamera );
+		vector<vec4> visible;
+		for( const auto &instance : mInstances ) {
+			if( frustum.intersects( AxisAlignedBox( instance.mCenter - instance.mExtents, instance.mCenter + instance.mExtents ) ) )
+				visible.push_back( mPositions[instance.mId] );
+		}
+		mLoopInstancesVbo->bufferSubData( 0, visible.size() * sizeof(vec4), visible.data() );
+
+		gl::ScopedGlslProg glslScp( mLoopGlsl );
+		gl::ScopedVao vaoScp( mLoopVao );
+		gl::setDefaultShaderVars();
+		gl::drawElementsInstanced( GL_TRIANGLES, mLod0Indices, GL_UNSIGNED_INT, nullptr, (GLsizei)visible.size() );
+	}
+	else {
+		auto &culler = ( mMode == GPU ) ? mGpuCuller : mCpuCuller;
+		culler->cull( mCamera );
+
+		gl::ScopedGlslProg glslScp( mCulledGlsl );
+		gl::ScopedVao vaoScp( mMode == GPU ? mGpuVao : mCpuVao );
+		gl::context()->bindBufferBase( GL_SHADER_STORAGE_BUFFER, 0, mPositionsSsbo );
+		culler->draw();
+	}
+
+	mGpuQuery->end();
+	cpuTimer.stop();
+
+	// the first few frames include allocations and shader compilation
+	if( getElapsedFrames() > 10 ) {
+		mCpuMsTotal += cpuTimer.getSeconds() * 1000;
+		mGpuMsTotal += mGpuQuery->getElapsedMilliseconds();
+		++mNumFrames;
+	}
+
+	if( mNumFrames == 60 ) {
+		const char *modeNames[] = { "loop", "gpu", "cpu" };
+		console() << setw( 9 ) << mInstances.size() << "  " << setw( 4 ) << modeNames[mMode]
+				<< "  " << setw( 12 ) << fixed << setprecision( 3 ) << mCpuMsTotal / mNumFrames << "  " << setw( 12 ) << mGpuMsTotal / mNumFrames << endl;
+		resetStats();
+	}
+}
+
+CINDER_APP( InstanceCullingBenchmarkApp, RendererGl( RendererGl::Options().version( 4, 3 ) ), &InstanceCullingBenchmarkApp::prepareSettings )
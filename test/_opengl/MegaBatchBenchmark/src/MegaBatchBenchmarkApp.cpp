@@ -0,0 +1,189 @@
+// Draws 10,000 spinning cubes, spheres and icosahedrons, each with its own model matrix and color, and reports the CPU
+// submission time and GPU time per frame when drawn as individual gl::Batches versus a single gl::MegaBatch.
+//
+// keys: 'm' toggles between Batches and the MegaBatch, 'h' hides or shows every other object
+
+#include "cinder/app/App.h"
+#include "cinder/app/RendererGl.h"
+#include "cinder/gl/gl.h"
+#include "cinder/gl/Query.h"
+#include "cinder/Rand.h"
+#include "cinder/Timer.h"
+
+#include <iomanip>
+
+using namespace ci;
+using namespace ci::app;
+using namespace std;
+
+class MegaBatchBenchmarkApp : public App {
+  public:
+	static void prepareSettings( Settings *settings );
+
+	void setup() override;
+	void keyDown( KeyEvent event ) override;
+	void update() override;
+	void draw() override;
+
+  private:
+	void	resetStats();
+
+	struct Object {
+		vec3	position, axis;
+		float	speed;
+		size_t	shape;
+		ColorAf	color;
+		bool	visible = true;
+	};
+	vector<Object>			mObjects;
+	vector<gl::BatchRef>	mBatches;
+	gl::MegaBatchRef		mMegaBatch;
+	bool					mUseMegaBatch = true, mHalfHidden = false;
+
+	CameraPersp				mCamera;
+	gl::QueryTimeSwappedRef	mGpuQuery;
+	double					mCpuMsTotal = 0, mGpuMsTotal = 0;
+	int						mNumFrames = 0;
+};
+
+void MegaBatchBenchmarkApp::prepareSettings( Settings *settings )
+{
+	settings->setWindowSize( 1280, 720 );
+	settings->disableFrameRate();
+}
+
+void MegaBatchBenchmarkApp::setup()
+{
+	gl::enableVerticalSync( false );
+	mGpuQuery = gl::QueryTimeSwapped::create();
+	mCamera.setPerspective( 60, getWindowAspectRatio(), 1, 1000 );
+	mCamera.lookAt( vec3( 0, 0, 160 ), vec3( 0 ) );
+
+	// the Batches share the stock lambert shader, the MegaBatch fetches its matrix and color from the storage buffer
+	auto lambert = gl::getStockShader( gl::ShaderDef().color().lambert() );
+	auto megaGlsl = gl::GlslProg::create( gl::GlslProg::Format()
+		.vertex( CI_GLSL( 430,
+			uniform mat4 ciViewProjection;
+			uniform mat4 ciViewMatrix;
+			in vec4 ciPosition;
+			in vec3 ciNormal;
+			in uint ciDrawId;
+
+			struct DrawData { mat4 modelMatrix; vec4 color; };
+			layout( std430, binding = 0 ) buffer DrawDataBuffer { DrawData uDrawData[]; };
+
+			out vec4 vColor;
+			out vec3 vNormal;
+
+			void main() {
+				mat4 modelMatrix = uDrawData[ciDrawId].modelMatrix;
+				vColor = uDrawData[ciDrawId].color;
+				vNormal = mat3( ciViewMatrix ) * mat3( modelMatrix ) * ciNormal;
+				gl_Position = ciViewProjection * modelMatrix * ciPosition;
+			}
+		) )
+		.fragment( CI_GLSL( 430,
+			in vec4 vColor;
+			in vec3 vNormal;
+			out vec4 oColor;
+
+			void main() {
+				oColor = vec4( vColor.rgb * max( 0.0, normalize( vNormal ).z ), vColor.a );
+			}
+		) ) );
+
+	vector<geom::SourceRef> shapes;
+	shapes.emplace_back( geom::Cube().size( vec3( 2 ) ).clone() );
+	shapes.emplace_back( geom::Sphere().radius( 1.2f ).subdivisions( 16 ).clone() );
+	shapes.emplace_back( geom::Icosahedron().clone() );
+	for( const auto &shape : shapes )
+		mBatches.push_back( gl::Batch::create( *shape, lambert ) );
+	mMegaBatch = gl::MegaBatch::create( megaGlsl );
+
+	Rand rnd( 1 );
+	mObjects.resize( 10000 );
+	for( auto &object : mObjects ) {
+		object.position = rnd.nextVec3() * rnd.nextFloat( 10, 120 );
+		object.axis = rnd.nextVec3();
+		object.speed = rnd.nextFloat( -2, 2 );
+		object.shape = rnd.nextUint( (uint32_t)shapes.size() );
+		object.color = ColorAf( rnd.nextFloat(), rnd.nextFloat(), rnd.nextFloat(), 1 );
+		mMegaBatch->add( *shapes[object.shape], translate( object.position ), object.color );
+	}
+
+	console() << "objects  visible  mode        CPU ms/frame  GPU ms/frame" << endl;
+}
+
+void MegaBatchBenchmarkApp::resetStats()
+{
+	mCpuMsTotal = mGpuMsTotal = 0;
+	mNumFrames = 0;
+}
+
+void MegaBatchBenchmarkApp::keyDown( KeyEvent event )
+{
+	if( event.getChar() == 'm' )
+		mUseMegaBatch = ! mUseMegaBatch;
+	else if( event.getChar() == 'h' ) {
+		mHalfHidden = ! mHalfHidden;
+		for( size_t i = 1; i < mObjects.size(); i += 2 ) {
+			mObjects[i].visible = ! mHalfHidden;
+			mMegaBatch->setVisible( (uint32_t)i, ! mHalfHidden );
+		}
+	}
+	else
+		return;
+
+	resetStats();
+}
+
+void MegaBatchBenchmarkApp::update()
+{
+	const float t = (float)getElapsedSeconds();
+	for( size_t i = 0; i < mObjects.size(); ++i ) {
+		const auto &object = mObjects[i];
+		if( object.visible )
+			mMegaBatch->setModelMatrix( (uint32_t)i, rotate( translate( object.position ), t * object.speed, object.axis ) );
+	}
+}
+
+void MegaBatchBenchmarkApp::draw()
+{
+	gl::clear();
+	gl::setMatrices( mCamera );
+	gl::ScopedDepth depthScp( true );
+
+	Timer cpuTimer( true );
+	mGpuQuery->begin();
+
+	if( mUseMegaBatch )
+		mMegaBatch->draw();
+	else {
+		for( size_t i = 0; i < mObjects.size(); ++i ) {
+			if( ! mObjects[i].visible )
+				continue;
+			gl::ScopedModelMatrix modelScp;
+			gl::setModelMatrix( mMegaBatch->getModelMatrix( (uint32_t)i ) );
+			gl::color( mObjects[i].color );
+			mBatches[mObjects[i].shape]->draw();
+		}
+	}
+
+	mGpuQuery->end();
+	cpuTimer.stop();
+
+	// the first few frames include allocations and shader compilation
+	if( getElapsedFrames() > 10 ) {
+		mCpuMsTotal += cpuTimer.getSeconds() * 1000;
+		mGpuMsTotal += mGpuQuery->getElapsedMilliseconds();
+		++mNumFrames;
+	}
+
+	if( mNumFrames == 120 ) {
+		console() << setw( 7 ) << mObjects.size() << "  " << setw( 7 ) << mMegaBatch->getNumVisible() << "  " << setw( 10 ) << left << ( mUseMegaBatch ? "megabatch" : "batches" ) << right
+				<< "  " << setw( 12 ) << fixed << setprecision( 3 ) << mCpuMsTotal / mNumFrames << "  " << setw( 12 ) << mGpuMsTotal / mNumFrames << endl;
+		resetStats();
+	}
+}
+
+CINDER_APP( MegaBatchBenchmarkApp, RendererGl( RendererGl::Options().version( 4, 3 ) ), &MegaBatchBenchmarkApp::prepareSettings )
@@ -0,0 +1,98 @@
+// Profiles a few nested passes with CI_PROFILE_SCOPE() and shows the global gl::Profiler in an ImGui window.
+//
+// keys: 't' captures 120 frames and writes them to profiler_trace.json in the documents folder, for chrome://tracing or ui.perfetto.dev
+
+#include "cinder/app/App.h"
+#include "cinder/app/RendererGl.h"
+#include "cinder/gl/gl.h"
+#include "cinder/gl/Profiler.h"
+#include "cinder/CinderImGui.h"
+#include "cinder/Rand.h"
+#include "cinder/Utilities.h"
+
+using namespace ci;
+using namespace ci::app;
+using namespace std;
+
+class ProfilerTestApp : public App {
+  public:
+	void setup() override;
+	void keyDown( KeyEvent event ) override;
+	void update() override;
+	void draw() override;
+
+  private:
+	void	drawPass( int numCircles, float radius );
+
+	gl::FboRef		mFbo;
+	bool			mWriteTrace = false;
+};
+
+void ProfilerTestApp::setup()
+{
+	ImGui::Initialize();
+	mFbo = gl::Fbo::create( 1024, 1024 );
+}
+
+void ProfilerTestApp::keyDown( KeyEvent event )
+{
+	if( event.getChar() == 't' ) {
+		gl::Profiler::get()->startCapture( 120 );
+		mWriteTrace = true;
+	}
+}
+
+void ProfilerTestApp::update()
+{
+	CI_PROFILE_SCOPE( "update" );
+	ImGui::ProfilerWindow();
+}
+
+void ProfilerTestApp::drawPass( int numCircles, float radius )
+{
+	Rand rnd( numCircles );
+	for( int i = 0; i < numCircles; ++i ) {
+		gl::color( rnd.nextFloat(), rnd.nextFloat(), rnd.nextFloat(), 0.2f );
+		gl::drawSolidCircle( vec2( rnd.nextFloat( 1024 ), rnd.nextFloat( 1024 ) ), radius );
+	}
+}
+
+void ProfilerTestApp::draw()
+{
+	{
+		CI_PROFILE_SCOPE( "offscreen" );
+		gl::ScopedFramebuffer fboScp( mFbo );
+		gl::ScopedViewport viewportScp( mFbo->getSize() );
+		gl::ScopedMatrices matricesScp;
+		gl::setMatricesWindow( mFbo->getSize() );
+		gl::ScopedBlendAlpha blendScp;
+		gl::clear();
+		{
+			CI_PROFILE_SCOPE( "small circles" );
+			drawPass( 4000, 4 );
+		}
+		{
+			CI_PROFILE_SCOPE( "large circles" );
+			drawPass( 200, 200 );
+		}
+	}
+
+	{
+		CI_PROFILE_SCOPE( "composite" );
+		gl::clear();
+		gl::setMatricesWindow( getWindowSize() );
+		gl::color( Color::white() );
+		gl::draw( mFbo->getColorTexture(), getWindowBounds() );
+	}
+
+	gl::Profiler::get()->endFrame();
+
+	if( mWriteTrace && ! gl::Profiler::get()->isCapturing() ) {
+		const fs::path path = getDocumentsDirectory() / "profiler_trace.json";
+		gl::Profiler::get()->writeChromeTrace( path );
+		console() << "wrote " << gl::Profiler::get()->getNumCapturedFrames() << " frames to " << path << endl;
+		mWriteTrace = false;
+	}
+}
+
+CINDER_APP( ProfilerTestApp, RendererGl )
@@ -0,0 +1,116 @@
+// Builds every stock shader variation and a handful of user programs with gl::ProgramBinaryCache enabled, then prints how long
+// each program took to preprocess, compile, link, load and save. The first run compiles from source and fills the cache, later
+// runs (or 'r') should load every program from it.
+//
+// keys: 'r' rebuilds all programs, 'c' clears the cache, 'd' toggles the cache
+
+#include "cinder/app/App.h"
+#include "cinder/app/RendererGl.h"
+#include "cinder/gl/gl.h"
+#include "cinder/Timer.h"
+
+using namespace ci;
+using namespace ci::app;
+using namespace std;
+
+class ProgramBinaryCacheTestApp : public App {
+  public:
+	void setup() override;
+	void keyDown( KeyEvent event ) override;
+	void draw() override;
+
+  private:
+	void	buildPrograms();
+
+	vector<gl::GlslProgRef>	mPrograms;
+};
+
+void ProgramBinaryCacheTestApp::setup()
+{
+	auto cache = gl::ProgramBinaryCache::get();
+	cache->enable( getAppPath() / "program_binaries" );
+	cache->enableTiming();
+	console() << "program binaries: " << cache->getDirectory() << ( cache->isEnabled() ? "" : " (unsupported by this context)" ) << endl;
+
+	buildPrograms();
+}
+
+void ProgramBinaryCacheTestApp::buildPrograms()
+{
+	auto cache = gl::ProgramBinaryCache::get();
+	cache->clearTimings();
+	mPrograms.clear();
+
+	Timer timer( true );
+
+	// the stock shaders, built directly so that the Context's stock shader cache doesn't hide them on rebuilds
+	for( int flags = 0; flags < 16; ++flags ) {
+		gl::ShaderDef def;
+		if( flags & 1 )
+			def.color();
+		if( flags & 2 )
+			def.texture();
+		if( flags & 4 )
+			def.lambert();
+		if( flags & 8 )
+			def.uniformBasedPosAndTexCoord();
+		mPrograms.push_back( gl::env()->buildShader( def ) );
+	}
+
+	// the same source with different defines must produce distinct binaries
+	for( int numLights = 1; numLights <= 4; ++numLights ) {
+		auto format = gl::GlslProg::Format()
+			.vertex( CI_GLSL( 150,
+				uniform mat4 ciModelViewProjection;
+				in vec4 ciPosition;
+				in vec3 ciNormal;
+				out vec3 vNormal;
+				void main() {
+					vNormal = ciNormal;
+					gl_Position = ciModelViewProjection * ciPosition;
+				}
+			) )
+			.fragment( CI_GLSL( 150,
+				uniform vec3 uLightDirections[NUM_LIGHTS];
+				in vec3 vNormal;
+				out vec4 oColor;
+				void main() {
+					float diffuse = 0.0;
+					for( int i = 0; i < NUM_LIGHTS; ++i )
+						diffuse += max( dot( normalize( vNormal ), uLightDirections[i] ), 0.0 );
+					oColor = vec4( vec3( diffuse ), 1.0 );
+				}
+			) )
+			.define( "NUM_LIGHTS", to_string( numLights ) )
+			.label( "lights " + to_string( numLights ) );
+		mPrograms.push_back( gl::GlslProg::create( format ) );
+	}
+
+	cache->printTimings( console() );
+	console() << "total: " << timer.getSeconds() * 1000 << " ms, hits: " << cache->getNumHits() << ", misses: " << cache->getNumMisses() << endl;
+}
+
+void ProgramBinaryCacheTestApp::keyDown( KeyEvent event )
+{
+	auto cache = gl::ProgramBinaryCache::get();
+	if( event.getChar() == 'r' )
+		buildPrograms();
+	else if( event.getChar() == 'c' ) {
+		cache->clear();
+		console() << "cleared " << cache->getDirectory() << endl;
+	}
+	else if( event.getChar() == 'd' ) {
+		if( cache->isEnabled() )
+			cache->disable();
+		else
+			cache->enable( getAppPath() / "program_binaries" );
+		console() << "program binary cache " << ( cache->isEnabled() ? "enabled" : "disabled" ) << endl;
+	}
+}
+
+void ProgramBinaryCacheTestApp::draw()
+{
+	gl::clear();
+}
+
+CINDER_APP( ProgramBinaryCacheTestApp, RendererGl )
@@ -0,0 +1,101 @@
+// Draws a grid of Batches that share a handful of textures and GlslProgs, and prints the gl::Context's state counters
+// for the previous frame, showing how many GL state changes were issued versus elided as redundant.
+//
+// keys: 's' toggles sorting the draws by GlslProg and texture, which should raise the elided counts
+
+#include "cinder/app/App.h"
+#include "cinder/app/RendererGl.h"
+#include "cinder/gl/gl.h"
+#include "cinder/Rand.h"
+
+#include <iomanip>
+
+using namespace ci;
+using namespace ci::app;
+using namespace std;
+
+class StateCountersTestApp : public App {
+  public:
+	void setup() override;
+	void keyDown( KeyEvent event ) override;
+	void draw() override;
+
+  private:
+	void	printCounters( const gl::StateCounters &counters );
+
+	struct Item {
+		vec2	position;
+		size_t	batch, texture;
+	};
+
+	vector<gl::BatchRef>		mBatches;
+	vector<gl::Texture2dRef>	mTextures;
+	vector<Item>				mItems;
+	bool						mSorted = false;
+};
+
+void StateCountersTestApp::setup()
+{
+	auto lambert = gl::getStockShader( gl::ShaderDef().texture().lambert() );
+	auto unlit = gl::getStockShader( gl::ShaderDef().texture() );
+	mBatches.push_back( gl::Batch::create( geom::Cube().size( vec3( 24 ) ), lambert ) );
+	mBatches.push_back( gl::Batch::create( geom::Sphere().radius( 14 ), lambert ) );
+	mBatches.push_back( gl::Batch::create( geom::Rect( Rectf( -12, -12, 12, 12 ) ), unlit ) );
+
+	Rand rnd( 1 );
+	for( int i = 0; i < 4; ++i ) {
+		Surface8u surface( 16, 16, false );
+		for( int32_t y = 0; y < 16; ++y ) {
+			for( int32_t x = 0; x < 16; ++x )
+				surface.setPixel( ivec2( x, y ), Color8u( rnd.nextUint() & 255, rnd.nextUint() & 255, rnd.nextUint() & 255 ) );
+		}
+		mTextures.push_back( gl::Texture2d::create( surface ) );
+	}
+
+	for( int y = 0; y < 20; ++y ) {
+		for( int x = 0; x < 30; ++x )
+			mItems.push_back( { vec2( 20 + x * 40, 20 + y * 36 ), rnd.nextUint( (uint32_t)mBatches.size() ), rnd.nextUint( (uint32_t)mTextures.size() ) } );
+	}
+}
+
+void StateCountersTestApp::keyDown( KeyEvent event )
+{
+	if( event.getChar() == 's' ) {
+		mSorted = ! mSorted;
+		if( mSorted )
+			stable_sort( mItems.begin(), mItems.end(), []( const Item &a, const Item &b ) { return ( a.batch != b.batch ) ? a.batch < b.batch : a.texture < b.texture; } );
+		else
+			shuffle( mItems.begin(), mItems.end(), std::mt19937( 1 ) );
+	}
+}
+
+void StateCountersTestApp::draw()
+{
+	gl::clear();
+	gl::setMatricesWindow( getWindowSize() );
+	gl::ScopedDepth depthScp( true );
+
+	for( const auto &item : mItems ) {
+		gl::ScopedTextureBind texScp( mTextures[item.texture] );
+		gl::ScopedModelMatrix modelScp;
+		gl::translate( item.position );
+		gl::rotate( (float)getElapsedSeconds(), vec3( 1, 1, 0 ) );
+		mBatches[item.batch]->draw();
+	}
+
+	if( getElapsedFrames() % 120 == 0 )
+		printCounters( gl::context()->getLastFrameStateCounters() );
+}
+
+void StateCountersTestApp::printCounters( const gl::StateCounters &counters )
+{
+	console() << ( mSorted ? "sorted" : "unsorted" ) << " draws, last frame:" << endl;
+	for( int c = 0; c < gl::StateCounters::NUM_CATEGORIES; ++c ) {
+		auto category = gl::StateCounters::Category( c );
+		console() << "  " << setw( 12 ) << left << gl::StateCounters::getCategoryName( category ) << right
+				<< setw( 8 ) << counters.getNumIssued( category ) << " issued" << setw( 8 ) << counters.getNumElided( category ) << " elided" << endl;
+	}
+	console() << "  " << setw( 12 ) << left << "total" << right << setw( 8 ) << counters.getNumIssued() << " issued" << setw( 8 ) << counters.getNumElided() << " elided" << endl;
+}
+
+CINDER_APP( StateCountersTestApp, RendererGl( RendererGl::Options().msaa( 4 ) ) )
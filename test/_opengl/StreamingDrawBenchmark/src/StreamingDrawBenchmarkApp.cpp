@@ -0,0 +1,133 @@
+// Draws N thousand gl::drawLine() and gl::drawSolidRect() calls per frame, each with its own color and model matrix,
+// and reports the CPU submission time and GPU time per frame with and without Context::enableStreamingDraw().
+//
+// keys: 's' toggles streaming draw, up / down change the number of draws by 1000, 'c' switches between lines, rects and both
+
+#include "cinder/app/App.h"
+#include "cinder/app/RendererGl.h"
+#include "cinder/gl/gl.h"
+#include "cinder/gl/Query.h"
+#include "cinder/Rand.h"
+#include "cinder/Timer.h"
+
+#include <iomanip>
+
+using namespace ci;
+using namespace ci::app;
+using namespace std;
+
+class StreamingDrawBenchmarkApp : public App {
+  public:
+	static void prepareSettings( Settings *settings );
+
+	void setup() override;
+	void keyDown( KeyEvent event ) override;
+	void draw() override;
+
+  private:
+	enum Content { LINES_AND_RECTS, LINES, RECTS };
+
+	void	resetStats();
+
+	struct Primitive {
+		vec2	position, extent;
+		float	rotation;
+		ColorAf	color;
+	};
+	vector<Primitive>		mPrimitives;
+	size_t					mNumDraws = 5000;
+	Content					mContent = LINES_AND_RECTS;
+	bool					mStreaming = true;
+
+	gl::QueryTimeSwappedRef	mGpuQuery;
+	double					mCpuMsTotal = 0, mGpuMsTotal = 0;
+	int						mNumFrames = 0;
+};
+
+void StreamingDrawBenchmarkApp::prepareSettings( Settings *settings )
+{
+	settings->setWindowSize( 1280, 720 );
+	settings->disableFrameRate();
+}
+
+void StreamingDrawBenchmarkApp::setup()
+{
+	gl::enableVerticalSync( false );
+	mGpuQuery = gl::QueryTimeSwapped::create();
+
+	Rand rnd( 1 );
+	mPrimitives.resize( 100000 );
+	for( auto &primitive : mPrimitives ) {
+		primitive.position = vec2( rnd.nextFloat( 1280 ), rnd.nextFloat( 720 ) );
+		primitive.extent = vec2( rnd.nextFloat( 2, 24 ), rnd.nextFloat( 2, 24 ) );
+		primitive.rotation = rnd.nextFloat( 2 * (float)M_PI );
+		primitive.color = ColorAf( rnd.nextFloat(), rnd.nextFloat(), rnd.nextFloat(), 0.75f );
+	}
+
+	console() << "draws/frame  mode       content          CPU ms/frame  GPU ms/frame" << endl;
+}
+
+void StreamingDrawBenchmarkApp::resetStats()
+{
+	mCpuMsTotal = mGpuMsTotal = 0;
+	mNumFrames = 0;
+}
+
+void StreamingDrawBenchmarkApp::keyDown( KeyEvent event )
+{
+	if( event.getChar() == 's' )
+		mStreaming = ! mStreaming;
+	else if( event.getChar() == 'c' )
+		mContent = Content( ( mContent + 1 ) % 3 );
+	else if( event.getCode() == KeyEvent::KEY_UP )
+		mNumDraws = std::min<size_t>( mNumDraws + 1000, mPrimitives.size() );
+	else if( event.getCode() == KeyEvent::KEY_DOWN )
+		mNumDraws = std::max<size_t>( mNumDraws, 2000 ) - 1000;
+	else
+		return;
+
+	resetStats();
+}
+
+void StreamingDrawBenchmarkApp::draw()
+{
+	gl::clear();
+	gl::setMatricesWindow( getWindowSize() );
+	gl::ScopedGlslProg glslScp( gl::getStockShader( gl::ShaderDef().color() ) );
+
+	Timer cpuTimer( true );
+	mGpuQuery->begin();
+	gl::enableStreamingDraw( mStreaming );
+
+	for( size_t i = 0; i < mNumDraws; ++i ) {
+		const auto &primitive = mPrimitives[i];
+		gl::color( primitive.color );
+		gl::ScopedModelMatrix modelScp;
+		gl::translate( primitive.position );
+		gl::rotate( primitive.rotation );
+		if( mContent != RECTS )
+			gl::drawLine( -primitive.extent, primitive.extent );
+		if( mContent != LINES )
+			gl::drawSolidRect( Rectf( -primitive.extent * 0.5f, primitive.extent * 0.5f ) );
+	}
+
+	gl::enableStreamingDraw( false );
+	mGpuQuery->end();
+	cpuTimer.stop();
+
+	// the first few frames include allocations and shader compilation
+	if( getElapsedFrames() > 10 ) {
+		mCpuMsTotal += cpuTimer.getSeconds() * 1000;
+		mGpuMsTotal += mGpuQuery->getElapsedMilliseconds();
+		++mNumFrames;
+	}
+
+	if( mNumFrames == 120 ) {
+		const char *contentNames[] = { "lines + rects", "lines", "rects" };
+		console() << setw( 11 ) << mNumDraws << "  " << setw( 9 ) << left << ( mStreaming ? "streaming" : "default" ) << "  " << setw( 15 ) << contentNames[mContent] << right
+				<< "  " << setw( 12 ) << fixed << setprecision( 3 ) << mCpuMsTotal / mNumFrames << "  " << setw( 12 ) << mGpuMsTotal / mNumFrames << endl;
+		resetStats();
+	}
+}
+
+CINDER_APP( StreamingDrawBenchmarkApp, RendererGl, &StreamingDrawBenchmarkApp::prepareSettings )
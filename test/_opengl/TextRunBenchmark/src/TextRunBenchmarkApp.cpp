@@ -0,0 +1,139 @@
+// Draws 100,000 glyphs per frame as 2,000 lines of text, and reports the CPU submission time and GPU time per frame
+// using TextureFont::drawString() for each line versus a single retained gl::TextRun drawn from a gl::GlyphAtlas.
+//
+// keys: 'm' toggles between TextureFont and TextRun, 'r' regenerates the text, which rebuilds the TextRun
+
+#include "cinder/app/App.h"
+#include "cinder/app/RendererGl.h"
+#include "cinder/gl/gl.h"
+#include "cinder/gl/Query.h"
+#include "cinder/Rand.h"
+#include "cinder/Timer.h"
+
+#include <iomanip>
+
+using namespace ci;
+using namespace ci::app;
+using namespace std;
+
+class TextRunBenchmarkApp : public App {
+  public:
+	static void prepareSettings( Settings *settings );
+
+	void setup() override;
+	void keyDown( KeyEvent event ) override;
+	void draw() override;
+
+  private:
+	void	generateText();
+	void	resetStats();
+
+	struct Line {
+		string		text;
+		vec2		baseline;
+		ColorA8u	color;
+	};
+	vector<Line>			mLines;
+	gl::TextureFontRef		mTextureFont;
+	gl::GlyphAtlasRef		mAtlas;
+	gl::TextRunRef			mTextRun;
+	bool					mUseTextRun = true;
+	uint32_t				mSeed = 1;
+
+	gl::QueryTimeSwappedRef	mGpuQuery;
+	double					mCpuMsTotal = 0, mGpuMsTotal = 0;
+	int						mNumFrames = 0;
+};
+
+void TextRunBenchmarkApp::prepareSettings( Settings *settings )
+{
+	settings->setWindowSize( 1280, 720 );
+	settings->disableFrameRate();
+}
+
+void TextRunBenchmarkApp::setup()
+{
+	gl::enableVerticalSync( false );
+	mGpuQuery = gl::QueryTimeSwapped::create();
+
+	Font font( "Arial", 14 );
+	mTextureFont = gl::TextureFont::create( font );
+	mAtlas = gl::GlyphAtlas::create( font, gl::GlyphAtlas::Format().pageSize( 512, 512 ) );
+	mTextRun = gl::TextRun::create( mAtlas );
+	generateText();
+
+	console() << "glyphs/frame  mode         CPU ms/frame  GPU ms/frame  atlas pages  atlas glyphs" << endl;
+}
+
+void TextRunBenchmarkApp::generateText()
+{
+	const string alphabet = "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz1234567890().?!,:;'&*=+-/@#_[]<>%";
+	Rand rnd( mSeed++ );
+	mLines.resize( 2000 );
+	mTextRun->clear();
+	for( size_t i = 0; i < mLines.size(); ++i ) {
+		auto &line = mLines[i];
+		line.text.resize( 50 );
+		for( auto &ch : line.text )
+			ch = alphabet[rnd.nextUint( (uint32_t)alphabet.size() )];
+		line.baseline = vec2( ( i % 4 ) * 320 + 4, ( i / 4 ) % 48 * 15 + 14 );
+		line.color = ColorA8u( 128 + rnd.nextUint( 128 ), 128 + rnd.nextUint( 128 ), 128 + rnd.nextUint( 128 ), 255 );
+		mTextRun->append( line.text, line.baseline, line.color );
+	}
+}
+
+void TextRunBenchmarkApp::resetStats()
+{
+	mCpuMsTotal = mGpuMsTotal = 0;
+	mNumFrames = 0;
+}
+
+void TextRunBenchmarkApp::keyDown( KeyEvent event )
+{
+	if( event.getChar() == 'm' )
+		mUseTextRun = ! mUseTextRun;
+	else if( event.getChar() == 'r' )
+		generateText();
+	else
+		return;
+
+	resetStats();
+}
+
+void TextRunBenchmarkApp::draw()
+{
+	gl::clear();
+	gl::setMatricesWindow( getWindowSize() );
+	gl::ScopedBlendAlpha blendScp;
+
+	Timer cpuTimer( true );
+	mGpuQuery->begin();
+
+	if( mUseTextRun )
+		mTextRun->draw();
+	else {
+		for( const auto &line : mLines ) {
+			gl::color( line.color );
+			mTextureFont->drawString( line.text, line.baseline );
+		}
+	}
+
+	mGpuQuery->end();
+	cpuTimer.stop();
+
+	// the first few frames include allocations, rasterization and shader compilation
+	if( getElapsedFrames() > 10 ) {
+		mCpuMsTotal += cpuTimer.getSeconds() * 1000;
+		mGpuMsTotal += mGpuQuery->getElapsedMilliseconds();
+		++mNumFrames;
+	}
+
+	if( mNumFrames == 120 ) {
+		console() << setw( 12 ) << mTextRun->getNumGlyphs() << "  " << setw( 11 ) << left << ( mUseTextRun ? "textrun" : "texturefont" ) << right
+				<< "  " << setw( 12 ) << fixed << setprecision( 3 ) << mCpuMsTotal / mNumFrames << "  " << setw( 12 ) << mGpuMsTotal / mNumFrames
+				<< "  " << setw( 11 ) << mAtlas->getNumPages() << "  " << setw( 12 ) << mAtlas->getNumGlyphs() << endl;
+		resetStats();
+	}
+}
+
+CINDER_APP( TextRunBenchmarkApp, RendererGl, &TextRunBenchmarkApp::prepareSettings )
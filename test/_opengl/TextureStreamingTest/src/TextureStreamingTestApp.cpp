@@ -0,0 +1,171 @@
+// Loads a few hundred large images into Textures, either synchronously with gl::Texture2d::create() or through a
+// gl::TextureStreamingService, and reports the longest frame while loading along with the service's Stats.
+// The images are generated into a temporary folder on the first run.
+//
+// keys: 's' toggles streaming, 'r' reloads, 'm' toggles mipmapping, 'b' toggles a 256MB memory budget
+
+#include "cinder/app/App.h"
+#include "cinder/app/RendererGl.h"
+#include "cinder/gl/gl.h"
+#include "cinder/gl/TextureStreamingService.h"
+#include "cinder/ImageIo.h"
+#include "cinder/Rand.h"
+#include "cinder/Timer.h"
+
+#include <iomanip>
+
+using namespace ci;
+using namespace ci::app;
+using namespace std;
+
+class TextureStreamingTestApp : public App {
+  public:
+	static void prepareSettings( Settings *settings );
+
+	void setup() override;
+	void keyDown( KeyEvent event ) override;
+	void update() override;
+	void draw() override;
+
+  private:
+	void	generateImages();
+	void	reload();
+	void	printStatus();
+
+	vector<fs::path>			mPaths;
+	vector<gl::Texture2dRef>	mTextures;
+	size_t						mNumLoaded = 0;
+
+	gl::TextureStreamingServiceRef	mService;
+	bool						mStreaming = true, mMipmap = true, mBudget = false;
+
+	Timer						mFrameTimer, mLoadTimer;
+	double						mLongestFrameMs = 0;
+	bool						mLoading = false;
+};
+
+void TextureStreamingTestApp::prepareSettings( Settings *settings )
+{
+	settings->setWindowSize( 1280, 720 );
+	settings->disableFrameRate();
+}
+
+void TextureStreamingTestApp::setup()
+{
+	gl::enableVerticalSync( false );
+	generateImages();
+	reload();
+}
+
+void TextureStreamingTestApp::generateImages()
+{
+	const fs::path folder = fs::temp_directory_path() / "cinder_TextureStreamingTest";
+	fs::create_directories( folder );
+
+	Rand rnd( 1 );
+	for( int i = 0; i < 300; ++i ) {
+		fs::path path = folder / ( "image" + to_string( i ) + ".jpg" );
+		if( ! fs::exists( path ) ) {
+			Surface8u surface( 2048, 1024, false );
+			const Color8u tint( rnd.nextUint() & 255, rnd.nextUint() & 255, rnd.nextUint() & 255 );
+			for( int32_t y = 0; y < surface.getHeight(); ++y ) {
+				for( int32_t x = 0; x < surface.getWidth(); ++x )
+					surface.setPixel( ivec2( x, y ), Color8u( ( x ^ y ) & tint.r, ( x + i * 7 ) & tint.g, ( y * 3 ) & tint.b ) );
+			}
+			writeImage( path, surface );
+		}
+		mPaths.push_back( path );
+	}
+}
+
+void TextureStreamingTestApp::reload()
+{
+	// dropping the service cancels whatever is still loading
+	mService.reset();
+	mTextures.assign( mPaths.size(), nullptr );
+	mNumLoaded = 0;
+	mLongestFrameMs = 0;
+	mLoading = true;
+	mLoadTimer.start();
+	mFrameTimer.start();
+
+	const auto format = gl::Texture2d::Format().mipmap( mMipmap ).minFilter( mMipmap ? GL_LINEAR_MIPMAP_LINEAR : GL_LINEAR );
+	if( ! mStreaming ) {
+		// what a scene does today: everything is decoded and uploaded before the next frame
+		for( size_t i = 0; i < mPaths.size(); ++i )
+			mTextures[i] = gl::Texture2d::create( loadImage( mPaths[i] ), format );
+		mNumLoaded = mPaths.size();
+		return;
+	}
+
+	mService = gl::TextureStreamingService::create( gl::TextureStreamingService::Options().memoryBudget( mBudget ? 256 * 1024 * 1024 : 0 ) );
+	for( size_t i = 0; i < mPaths.size(); ++i ) {
+		// the first row on screen loads first
+		const int priority = i < 20 ? 1 : 0;
+		mService->load( mPaths[i], [this, i]( gl::Texture2dRef texture ) {
+			mTextures[i] = texture;
+			++mNumLoaded;
+		}, format, priority );
+	}
+}
+
+void TextureStreamingTestApp::keyDown( KeyEvent event )
+{
+	if( event.getChar() == 's' )
+		mStreaming = ! mStreaming;
+	else if( event.getChar() == 'm' )
+		mMipmap = ! mMipmap;
+	else if( event.getChar() == 'b' )
+		mBudget = ! mBudget;
+	else if( event.getChar() != 'r' )
+		return;
+
+	reload();
+}
+
+void TextureStreamingTestApp::update()
+{
+	if( mService )
+		mService->update();
+}
+
+void TextureStreamingTestApp::printStatus()
+{
+	console() << setw( 9 ) << left << ( mStreaming ? "streaming" : "sync" ) << right << "  mipmap: " << mMipmap << "  budget: " << mBudget
+			<< fixed << setprecision( 1 ) << "  loaded " << mNumLoaded << " in " << mLoadTimer.getSeconds() << "s  longest frame: " << mLongestFrameMs << "ms";
+
+	if( mService ) {
+		auto stats = mService->getStats();
+		console() << "  decode: " << stats.mDecodeBytesPerSecond / ( 1024 * 1024 ) << "MB/s  upload: " << stats.mUploadBytesPerSecond / ( 1024 * 1024 ) << "MB/s"
+				<< "  queued/decoding/uploading: " << stats.mNumQueued << "/" << stats.mNumDecoding << "/" << stats.mNumUploadQueued + stats.mNumAwaitingFence
+				<< "  resident: " << stats.mResidentBytes / ( 1024 * 1024 ) << "MB";
+	}
+	console() << endl;
+}
+
+void TextureStreamingTestApp::draw()
+{
+	mLongestFrameMs = std::max( mLongestFrameMs, mFrameTimer.getSeconds() * 1000 );
+	mFrameTimer.start();
+
+	gl::clear();
+	gl::setMatricesWindow( getWindowSize() );
+
+	const int columns = 20;
+	const vec2 cellSize( getWindowWidth() / float( columns ), getWindowWidth() / float( columns * 2 ) );
+	for( size_t i = 0; i < mTextures.size(); ++i ) {
+		const vec2 position( ( i % columns ) * cellSize.x, ( i / columns ) * cellSize.y );
+		if( mTextures[i] )
+			gl::draw( mTextures[i], Rectf( position, position + cellSize ) );
+	}
+
+	if( mLoading && mNumLoaded == mPaths.size() ) {
+		mLoadTimer.stop();
+		mLoading = false;
+		printStatus();
+	}
+	else if( mLoading && getElapsedFrames() % 60 == 0 )
+		printStatus();
+}
+
+CINDER_APP( TextureStreamingTestApp, RendererGl, &TextureStreamingTestApp::prepareSettings )
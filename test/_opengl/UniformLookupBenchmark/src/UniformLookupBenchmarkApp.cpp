@@ -0,0 +1,230 @@
+// Sets 20k uniforms per frame on a program with plain, array and array of struct uniforms and reports the time spent
+// per frame by each path: the previous linear findUniform() scan (reproduced below), the hashed findUniform(),
+// GlslProg::uniform() by name and GlslProg::uniform() with a precompiled UniformHandle.
+
+#include "cinder/app/App.h"
+#include "cinder/app/RendererGl.h"
+#include "cinder/gl/gl.h"
+#include "cinder/Timer.h"
+
+#include <iomanip>
+
+using namespace ci;
+using namespace ci::app;
+using namespace std;
+
+namespace legacy {
+
+// GlslProg::findUniform() before the name index, a linear scan with substr() for array and struct names
+const gl::GlslProg::Uniform* findUniform( const vector<gl::GlslProg::Uniform> &uniforms, const std::string &name, int *resultLocation )
+{
+	for( const auto &uniform : uniforms ) {
+		if( uniform.getName() == name ) {
+			if( resultLocation )
+				*resultLocation = uniform.getLocation();
+			return &uniform;
+		}
+	}
+
+	size_t requestedNameLeftSquareBracket = name.find( '[' );
+	size_t requestedNameRightSquareBracket = ( requestedNameLeftSquareBracket != string::npos ? name.find( ']' ) : string::npos );
+
+	bool needsLocationOffset = false;
+	const gl::GlslProg::Uniform* resultUniform = nullptr;
+	for( const auto &uniform : uniforms ) {
+		size_t activeUniformLeftSquareBracket = uniform.getName().find( '[' );
+		if( activeUniformLeftSquareBracket == string::npos )
+			continue;
+
+		string uniformBaseName = uniform.getName().substr( 0, activeUniformLeftSquareBracket );
+		if( requestedNameLeftSquareBracket == string::npos ) {
+			if( uniformBaseName == name ) {
+				resultUniform = &uniform;
+				break;
+			}
+		}
+		else if( uniformBaseName == name.substr( 0, requestedNameLeftSquareBracket ) ) {
+			if( name.size() - 1 > requestedNameRightSquareBracket ) {
+				if( name.substr( requestedNameRightSquareBracket, name.size() ) == uniform.getName().substr( uniform.getName().find( ']' ), name.size() ) ) {
+					resultUniform = &uniform;
+					needsLocationOffset = true;
+					break;
+				}
+			}
+			else {
+				resultUniform = &uniform;
+				needsLocationOffset = true;
+				break;
+			}
+		}
+	}
+
+	if( resultLocation && resultUniform ) {
+		if( needsLocationOffset ) {
+			try {
+				string indexStr = name.substr( requestedNameLeftSquareBracket + 1, requestedNameRightSquareBracket - requestedNameLeftSquareBracket - 1 );
+				*resultLocation = resultUniform->getLocation() + stoi( indexStr );
+			}
+			catch( std::logic_error & ) {
+				return nullptr;
+			}
+		}
+		else
+			*resultLocation = resultUniform->getLocation();
+	}
+
+	return resultUniform;
+}
+
+} // namespace legacy
+
+class UniformLookupBenchmarkApp : public App {
+  public:
+	void setup() override;
+	void draw() override;
+
+  private:
+	enum Path { LEGACY_LOOKUP, HASHED_LOOKUP, SET_BY_NAME, SET_BY_HANDLE, NUM_PATHS };
+
+	void	run( Path path, int iteration );
+
+	gl::GlslProgRef		mGlslProg;
+	gl::BatchRef		mBatch;
+	vector<string>		mFloatNames, mVec3Names, mVec4Names;
+	vector<gl::GlslProg::UniformHandle<float>>	mFloatHandles;
+	vector<gl::GlslProg::UniformHandle<vec3>>	mVec3Handles;
+	vector<gl::GlslProg::UniformHandle<vec4>>	mVec4Handles;
+
+	double				mMsTotal[NUM_PATHS] = {};
+	int					mNumFrames = 0;
+	volatile int		mLocationSum = 0;
+};
+
+static const int	NUM_SETS_PER_FRAME = 20000;
+
+void UniformLookupBenchmarkApp::setup()
+{
+	gl::enableVerticalSync( false );
+	disableFrameRate();
+
+	mGlslProg = gl::GlslProg::create( CI_GLSL( 150,
+		uniform mat4 ciModelViewProjection;
+		in vec4 ciPosition;
+		void main() {
+			gl_Position = ciModelViewProjection * ciPosition;
+		}
+	), CI_GLSL( 150,
+		struct Light {
+			vec3	position;
+			vec3	color;
+			float	intensity;
+		};
+		uniform Light	uLights[4];
+		uniform vec4	uTints[8];
+		uniform float	uWeights[8];
+		uniform float	uScale;
+		uniform vec3	uAmbient;
+		uniform vec4	uBaseColor;
+		out vec4 oColor;
+		void main() {
+			vec3 color = uAmbient;
+			for( int i = 0; i < 4; ++i )
+				color += uLights[i].color * uLights[i].intensity / ( 1.0 + length( uLights[i].position ) );
+			vec4 tint = vec4( 0.0 );
+			for( int i = 0; i < 8; ++i )
+				tint += uTints[i] * uWeights[i];
+			oColor = uBaseColor * vec4( color, 1.0 ) * tint * uScale;
+		}
+	) );
+	mBatch = gl::Batch::create( geom::Rect( Rectf( -1, -1, 1, 1 ) ), mGlslProg );
+
+	mFloatNames = { "uScale", "uWeights", "uWeights[3]", "uWeights[7]", "uLights[0].intensity", "uLights[3].intensity" };
+	mVec3Names = { "uAmbient", "uLights[1].position", "uLights[2].color", "uLights[3].position" };
+	mVec4Names = { "uBaseColor", "uTints", "uTints[2]", "uTints[6]" };
+	for( const auto &name : mFloatNames )
+		mFloatHandles.push_back( mGlslProg->getUniformHandle<float>( name ) );
+	for( const auto &name : mVec3Names )
+		mVec3Handles.push_back( mGlslProg->getUniformHandle<vec3>( name ) );
+	for( const auto &name : mVec4Names )
+		mVec4Handles.push_back( mGlslProg->getUniformHandle<vec4>( name ) );
+
+	// both lookups need to agree before their timings mean anything
+	for( const auto *names : { &mFloatNames, &mVec3Names, &mVec4Names } ) {
+		for( const auto &name : *names ) {
+			int legacyLocation = -1, hashedLocation = -1;
+			legacy::findUniform( mGlslProg->getActiveUniforms(), name, &legacyLocation );
+			mGlslProg->findUniform( name, &hashedLocation );
+			if( legacyLocation != hashedLocation )
+				console() << "mismatch for " << name << ": " << legacyLocation << " vs. " << hashedLocation << endl;
+		}
+	}
+
+	console() << "sets/frame  legacy lookup ms  hashed lookup ms  uniform( name ) ms  uniform( handle ) ms" << endl;
+}
+
+void UniformLookupBenchmarkApp::run( Path path, int iteration )
+{
+	const size_t numNames = mFloatNames.size() + mVec3Names.size() + mVec4Names.size();
+	const auto &uniforms = mGlslProg->getActiveUniforms();
+	int location;
+
+	for( int i = 0; i < NUM_SETS_PER_FRAME; ++i ) {
+		// vary the values so that the uniform value cache doesn't skip the GL calls
+		const float value = float( iteration * NUM_SETS_PER_FRAME + i );
+		size_t n = i % numNames;
+		if( n < mFloatNames.size() ) {
+			switch( path ) {
+				case LEGACY_LOOKUP: legacy::findUniform( uniforms, mFloatNames[n], &location ); mLocationSum += location; break;
+				case HASHED_LOOKUP: mGlslProg->findUniform( mFloatNames[n], &location ); mLocationSum += location; break;
+				case SET_BY_NAME: mGlslProg->uniform( mFloatNames[n], value ); break;
+				default: mGlslProg->uniform( mFloatHandles[n], value );
+			}
+			continue;
+		}
+
+		n -= mFloatNames.size();
+		if( n < mVec3Names.size() ) {
+			switch( path ) {
+				case LEGACY_LOOKUP: legacy::findUniform( uniforms, mVec3Names[n], &location ); mLocationSum += location; break;
+				case HASHED_LOOKUP: mGlslProg->findUniform( mVec3Names[n], &location ); mLocationSum += location; break;
+				case SET_BY_NAME: mGlslProg->uniform( mVec3Names[n], vec3( value ) ); break;
+				default: mGlslProg->uniform( mVec3Handles[n], vec3( value ) );
+			}
+			continue;
+		}
+
+		n -= mVec3Names.size();
+		switch( path ) {
+			case LEGACY_LOOKUP: legacy::findUniform( uniforms, mVec4Names[n], &location ); mLocationSum += location; break;
+			case HASHED_LOOKUP: mGlslProg->findUniform( mVec4Names[n], &location ); mLocationSum += location; break;
+			case SET_BY_NAME: mGlslProg->uniform( mVec4Names[n], vec4( value ) ); break;
+			default: mGlslProg->uniform( mVec4Handles[n], vec4( value ) );
+		}
+	}
+}
+
+void UniformLookupBenchmarkApp::draw()
+{
+	gl::clear();
+	gl::ScopedGlslProg glslScp( mGlslProg );
+
+	for( int path = 0; path < NUM_PATHS; ++path ) {
+		Timer timer( true );
+		run( Path( path ), getElapsedFrames() );
+		mMsTotal[path] += timer.getSeconds() * 1000;
+	}
+	mBatch->draw();
+
+	if( ++mNumFrames == 120 ) {
+		const int columnWidths[NUM_PATHS] = { 16, 16, 18, 20 };
+		console() << setw( 10 ) << NUM_SETS_PER_FRAME << fixed << setprecision( 3 );
+		for( int path = 0; path < NUM_PATHS; ++path ) {
+			console() << "  " << setw( columnWidths[path] ) << mMsTotal[path] / mNumFrames;
+			mMsTotal[path] = 0;
+		}
+		console() << endl;
+		mNumFrames = 0;
+	}
+}
+
+CINDER_APP( UniformLookupBenchmarkApp, RendererGl )
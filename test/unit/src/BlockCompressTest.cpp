@@ -0,0 +1,223 @@
+#include "catch.hpp"
+#include "cinder/ip/BlockCompress.h"
+#include "cinder/ip/Parallel.h"
+#include "cinder/ImageTargetFileBcn.h"
+#include "cinder/Rand.h"
+#include "cinder/Stream.h"
+#include "cinder/app/Platform.h"
+
+using namespace cinder;
+using namespace std;
+
+namespace {
+
+// smooth color and alpha ramps with a little noise, which block compression should reproduce closely
+Surface8u makeGradientSurface( int32_t width, int32_t height, uint32_t seed )
+{
+	Surface8u result( width, height, true, SurfaceChannelOrder::RGBA );
+	Rand rnd( seed );
+	for( int32_t y = 0; y < height; y++ ) {
+		for( int32_t x = 0; x < width; x++ ) {
+			const int noise = (int)rnd.nextUint( 5 ) - 2;
+			result.setPixel( ivec2( x, y ), ColorA8u( glm::clamp( x * 255 / width + noise, 0, 255 ), y * 255 / height, ( x + y ) * 127 / ( width + height ), 255 - x * 255 / width ) );
+		}
+	}
+
+	return result;
+}
+
+Surface8u makeNoiseSurface( int32_t width, int32_t height, uint32_t seed )
+{
+	Surface8u result( width, height, true, SurfaceChannelOrder::RGBA );
+	Rand rnd( seed );
+	for( int32_t y = 0; y < height; y++ ) {
+		uint8_t *row = result.getData( ivec2( 0, y ) );
+		for( int32_t i = 0; i < width * 4; i++ )
+			row[i] = uint8_t( rnd.nextUint( 256 ) );
+	}
+
+	return result;
+}
+
+// root mean square difference over the first \a numChannels channels
+float rmsError( const Surface8u &a, const Surface8u &b, int numChannels )
+{
+	double sum = 0;
+	for( int32_t y = 0; y < a.getHeight(); y++ ) {
+		for( int32_t x = 0; x < a.getWidth(); x++ ) {
+			ColorA8u pa = a.getPixel( ivec2( x, y ) ), pb = b.getPixel( ivec2( x, y ) );
+			for( int c = 0; c < numChannels; c++ )
+				sum += ( float( pa[c] ) - float( pb[c] ) ) * ( float( pa[c] ) - float( pb[c] ) );
+		}
+	}
+
+	return (float)sqrt( sum / ( a.getWidth() * a.getHeight() * numChannels ) );
+}
+
+float roundTripError( const Surface8u &surface, ip::BlockFormat format, ip::BlockQuality quality, int numChannels )
+{
+	auto encoded = ip::blockCompressCopy( surface, format, quality );
+	return rmsError( surface, ip::blockDecompress( encoded.data(), format, surface.getWidth(), surface.getHeight() ), numChannels );
+}
+
+} // anonymous namespace
+
+TEST_CASE( "ip/BlockCompress" )
+{
+	const ip::BlockFormat formats[] = { ip::BlockFormat::BC1, ip::BlockFormat::BC3, ip::BlockFormat::BC4, ip::BlockFormat::BC5, ip::BlockFormat::BC7 };
+	// number of channels each format in formats[] stores
+	const int formatChannels[] = { 3, 4, 1, 2, 4 };
+
+	SECTION( "sizes" )
+	{
+		REQUIRE( ip::getBlockBytes( ip::BlockFormat::BC1 ) == 8 );
+		REQUIRE( ip::getBlockBytes( ip::BlockFormat::BC4 ) == 8 );
+		REQUIRE( ip::getBlockBytes( ip::BlockFormat::BC3 ) == 16 );
+		REQUIRE( ip::getBlockBytes( ip::BlockFormat::BC7 ) == 16 );
+		REQUIRE( ip::getBlockCompressedSize( ip::BlockFormat::BC1, 16, 16 ) == 128 );
+		REQUIRE( ip::getBlockCompressedSize( ip::BlockFormat::BC5, 5, 1 ) == 32 );
+		REQUIRE( ip::getBlockCompressedSize( ip::BlockFormat::BC7, 1, 1 ) == 16 );
+		REQUIRE( ip::blockCompressCopy( Surface8u( 13, 7, true ), ip::BlockFormat::BC3 ).size() == 4 * 2 * 16 );
+	}
+
+	SECTION( "solid blocks round trip" )
+	{
+		Surface8u surface( 8, 8, true, SurfaceChannelOrder::RGBA );
+		const ColorA8u colors[] = { ColorA8u( 0, 0, 0, 255 ), ColorA8u( 255, 255, 255, 255 ), ColorA8u( 200, 100, 50, 255 ), ColorA8u( 17, 230, 128, 255 ) };
+		for( int32_t y = 0; y < 8; y++ ) {
+			for( int32_t x = 0; x < 8; x++ )
+				surface.setPixel( ivec2( x, y ), colors[( y / 4 ) * 2 + x / 4] );
+		}
+
+		for( size_t f = 0; f < 5; f++ ) {
+			for( auto quality : { ip::BlockQuality::FAST, ip::BlockQuality::NORMAL, ip::BlockQuality::BEST } ) {
+				auto encoded = ip::blockCompressCopy( surface, formats[f], quality );
+				Surface8u decoded = ip::blockDecompress( encoded.data(), formats[f], 8, 8 );
+				for( int32_t y = 0; y < 8; y++ ) {
+					for( int32_t x = 0; x < 8; x++ ) {
+						ColorA8u expected = surface.getPixel( ivec2( x, y ) ), actual = decoded.getPixel( ivec2( x, y ) );
+						// BC1's 5:6:5 endpoints can only get within a few steps of an arbitrary color through interpolation
+						const int tolerance = ( formats[f] == ip::BlockFormat::BC1 || formats[f] == ip::BlockFormat::BC3 ) ? 4 : 1;
+						for( int c = 0; c < formatChannels[f]; c++ )
+							REQUIRE( abs( int( expected[c] ) - int( actual[c] ) ) <= tolerance );
+					}
+				}
+			}
+		}
+	}
+
+	SECTION( "gradients round trip within tolerance" )
+	{
+		// odd sizes exercise the partial blocks at the edges
+		Surface8u surface = makeGradientSurface( 61, 35, 1 );
+		// BC1 is tested opaque, since the alpha ramp would otherwise switch half of the blocks to punch-through
+		Surface8u opaque( 61, 35, false );
+		opaque.copyFrom( surface, surface.getBounds() );
+		const float maxErrors[] = { 4.0f, 4.0f, 1.0f, 1.0f, 4.0f };
+		for( size_t f = 0; f < 5; f++ ) {
+			const Surface8u &input = ( formats[f] == ip::BlockFormat::BC1 ) ? opaque : surface;
+			float fast = roundTripError( input, formats[f], ip::BlockQuality::FAST, formatChannels[f] );
+			float normal = roundTripError( input, formats[f], ip::BlockQuality::NORMAL, formatChannels[f] );
+			float best = roundTripError( input, formats[f], ip::BlockQuality::BEST, formatChannels[f] );
+			REQUIRE( normal < maxErrors[f] );
+			REQUIRE( best <= normal + 0.01f );
+			REQUIRE( best <= fast + 0.01f );
+		}
+	}
+
+	SECTION( "BEST is no worse than FAST on noise" )
+	{
+		Surface8u surface = makeNoiseSurface( 32, 32, 2 );
+		for( size_t f = 0; f < 5; f++ )
+			REQUIRE( roundTripError( surface, formats[f], ip::BlockQuality::BEST, formatChannels[f] ) <= roundTripError( surface, formats[f], ip::BlockQuality::FAST, formatChannels[f] ) );
+	}
+
+	SECTION( "output doesn't depend on the number of threads" )
+	{
+		Surface8u surface = makeNoiseSurface( 256, 130, 3 );
+		const int maxThreads = ip::getMaxThreads();
+		for( auto format : formats ) {
+			ip::setMaxThreads( 1 );
+			auto single = ip::blockCompressCopy( surface, format );
+			ip::setMaxThreads( 4 );
+			auto multi = ip::blockCompressCopy( surface, format );
+			REQUIRE( single == multi );
+		}
+		ip::setMaxThreads( maxThreads );
+	}
+
+	SECTION( "BC1 punch-through alpha" )
+	{
+		Surface8u surface = makeGradientSurface( 8, 8, 4 );
+		for( int32_t y = 0; y < 8; y++ ) {
+			for( int32_t x = 0; x < 8; x++ ) {
+				ColorA8u color = surface.getPixel( ivec2( x, y ) );
+				color.a = ( ( x + y ) % 3 == 0 ) ? 0 : 255;
+				surface.setPixel( ivec2( x, y ), color );
+			}
+		}
+
+		auto encoded = ip::blockCompressCopy( surface, ip::BlockFormat::BC1 );
+		Surface8u decoded = ip::blockDecompress( encoded.data(), ip::BlockFormat::BC1, 8, 8 );
+		for( int32_t y = 0; y < 8; y++ ) {
+			for( int32_t x = 0; x < 8; x++ )
+				REQUIRE( decoded.getPixel( ivec2( x, y ) ).a == surface.getPixel( ivec2( x, y ) ).a );
+		}
+
+		// without alpha the 1-bit mode is never used
+		Surface8u opaque( 8, 8, false );
+		opaque.copyFrom( surface, surface.getBounds() );
+		encoded = ip::blockCompressCopy( opaque, ip::BlockFormat::BC1 );
+		decoded = ip::blockDecompress( encoded.data(), ip::BlockFormat::BC1, 8, 8 );
+		for( int32_t y = 0; y < 8; y++ ) {
+			for( int32_t x = 0; x < 8; x++ )
+				REQUIRE( decoded.getPixel( ivec2( x, y ) ).a == 255 );
+		}
+	}
+
+	SECTION( "ImageTargetFileBcn writes DDS and KTX" )
+	{
+		// the Platform registers the "dds" and "ktx" ImageTargets
+		app::Platform::get();
+		Surface8u surface = makeGradientSurface( 64, 40, 5 );
+
+		// 64x40 down to 1x1 in 7 levels
+		size_t mipChainSize = 0;
+		for( int level = 0; level < 7; level++ )
+			mipChainSize += ip::getBlockCompressedSize( ip::BlockFormat::BC3, std::max( 1, 64 >> level ), std::max( 1, 40 >> level ) );
+
+		const fs::path ddsPath = fs::temp_directory_path() / "cinder_BlockCompressTest.dds";
+		writeImage( writeFile( ddsPath ), surface, ImageTarget::Options(), "dds" );
+		auto ddsData = loadFile( ddsPath )->getBuffer();
+		const uint8_t *dds = (const uint8_t*)ddsData->getData();
+		const uint32_t *ddsHeader = (const uint32_t*)( dds + 4 );
+		REQUIRE( memcmp( dds, "DDS ", 4 ) == 0 );
+		REQUIRE( ddsHeader[0] == 124 );
+		REQUIRE( ddsHeader[2] == 40 );
+		REQUIRE( ddsHeader[3] == 64 );
+		REQUIRE( ddsHeader[6] == 7 );
+		REQUIRE( memcmp( &ddsHeader[20], "DXT5", 4 ) == 0 );
+		REQUIRE( ddsData->getSize() == 128 + mipChainSize );
+		Surface8u decoded = ip::blockDecompress( dds + 128, ip::BlockFormat::BC3, 64, 40 );
+		REQUIRE( rmsError( surface, decoded, 4 ) < 4 );
+		fs::remove( ddsPath );
+
+		const fs::path ktxPath = fs::temp_directory_path() / "cinder_BlockCompressTest.ktx";
+		// the file is closed once the ImageTarget is destroyed
+		writeImage( ImageTargetFileBcn::create( writeFile( ktxPath ), surface, ImageTargetFileBcn::Format().blockFormat( ip::BlockFormat::BC7 ).mipmaps( false ), "ktx" ), surface );
+		auto ktxData = loadFile( ktxPath )->getBuffer();
+		const uint8_t *ktx = (const uint8_t*)ktxData->getData();
+		const uint32_t *ktxHeader = (const uint32_t*)( ktx + 12 );
+		REQUIRE( ktx[1] == 'K' );
+		REQUIRE( ktxHeader[0] == 0x04030201 );
+		REQUIRE( ktxHeader[4] == 0x8E8C );
+		REQUIRE( ktxHeader[6] == 64 );
+		REQUIRE( ktxHeader[7] == 40 );
+		REQUIRE( ktxHeader[11] == 1 );
+		REQUIRE( ktxHeader[13] == 16 * 10 * 16 );
+		REQUIRE( ktxData->getSize() == 12 + 13 * 4 + 4 + 16 * 10 * 16 );
+		decoded = ip::blockDecompress( ktx + 12 + 13 * 4 + 4, ip::BlockFormat::BC7, 64, 40 );
+		REQUIRE( rmsError( surface, decoded, 4 ) < 4 );
+		fs::remove( ktxPath );
+	}
+}
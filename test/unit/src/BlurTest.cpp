@@ -0,0 +1,237 @@
+#include "catch.hpp"
+#include "cinder/ip/Blur.h"
+#include "cinder/ip/Parallel.h"
+#include "cinder/ip/Fill.h"
+#include "cinder/Rand.h"
+
+using namespace cinder;
+using namespace std;
+
+namespace {
+
+template<typename T>
+ChannelT<T> makeNoiseChannel( int32_t width, int32_t height, uint32_t seed )
+{
+	ChannelT<T> result( width, height );
+	Rand rnd( seed );
+	for( int32_t y = 0; y < height; y++ ) {
+		for( int32_t x = 0; x < width; x++ )
+			*result.getData( x, y ) = T( rnd.nextFloat() * CHANTRAIT<T>::max() );
+	}
+
+	return result;
+}
+
+template<typename T>
+bool valuesEqual( const ChannelT<T> &a, const ChannelT<T> &b )
+{
+	for( int32_t y = 0; y < a.getHeight(); y++ ) {
+		for( int32_t x = 0; x < a.getWidth(); x++ ) {
+			if( a.getValue( ivec2( x, y ) ) != b.getValue( ivec2( x, y ) ) )
+				return false;
+		}
+	}
+
+	return true;
+}
+
+// stackBlur is a triangle filter applied to rows and then columns, truncating after each pass
+Channel8u referenceStackBlur( const Channel8u &src, int radius )
+{
+	const int32_t w = src.getWidth(), h = src.getHeight();
+	const int32_t divisor = ( radius + 1 ) * ( radius + 1 );
+	vector<int32_t> temp( w * h );
+	for( int32_t y = 0; y < h; y++ ) {
+		for( int32_t x = 0; x < w; x++ ) {
+			int32_t sum = 0;
+			for( int k = -radius; k <= radius; k++ )
+				sum += src.getValue( ivec2( glm::clamp( x + k, 0, w - 1 ), y ) ) * ( radius + 1 - abs( k ) );
+			temp[y * w + x] = sum / divisor;
+		}
+	}
+
+	Channel8u result( w, h );
+	for( int32_t y = 0; y < h; y++ ) {
+		for( int32_t x = 0; x < w; x++ ) {
+			int32_t sum = 0;
+			for( int k = -radius; k <= radius; k++ )
+				sum += temp[glm::clamp( y + k, 0, h - 1 ) * w + x] * ( radius + 1 - abs( k ) );
+			*result.getData( x, y ) = uint8_t( sum / divisor );
+		}
+	}
+
+	return result;
+}
+
+Channel32f referenceBoxBlur( const Channel32f &src, int radius, int passes )
+{
+	const int32_t w = src.getWidth(), h = src.getHeight();
+	vector<float> a( w * h ), b( w * h );
+	for( int32_t y = 0; y < h; y++ ) {
+		for( int32_t x = 0; x < w; x++ )
+			a[y * w + x] = src.getValue( ivec2( x, y ) );
+	}
+
+	for( int pass = 0; pass < passes; pass++ ) {
+		for( int32_t y = 0; y < h; y++ ) {
+			for( int32_t x = 0; x < w; x++ ) {
+				float sum = 0;
+				for( int k = -radius; k <= radius; k++ )
+					sum += a[y * w + glm::clamp( x + k, 0, w - 1 )];
+				b[y * w + x] = sum / ( 2 * radius + 1 );
+			}
+		}
+		swap( a, b );
+	}
+	for( int pass = 0; pass < passes; pass++ ) {
+		for( int32_t y = 0; y < h; y++ ) {
+			for( int32_t x = 0; x < w; x++ ) {
+				float sum = 0;
+				for( int k = -radius; k <= radius; k++ )
+					sum += a[glm::clamp( y + k, 0, h - 1 ) * w + x];
+				b[y * w + x] = sum / ( 2 * radius + 1 );
+			}
+		}
+		swap( a, b );
+	}
+
+	Channel32f result( w, h );
+	for( int32_t y = 0; y < h; y++ ) {
+		for( int32_t x = 0; x < w; x++ )
+			*result.getData( x, y ) = a[y * w + x];
+	}
+
+	return result;
+}
+
+} // anonymous namespace
+
+TEST_CASE( "ip/Blur" )
+{
+	SECTION( "stackBlur matches reference" )
+	{
+		auto src = makeNoiseChannel<uint8_t>( 97, 61, 1 );
+		for( int radius : { 1, 4, 40 } )
+			REQUIRE( valuesEqual( ip::stackBlurCopy( src, radius ), referenceStackBlur( src, radius ) ) );
+	}
+
+	SECTION( "stackBlur doesn't depend on thread count" )
+	{
+		auto src = makeNoiseChannel<uint16_t>( 517, 301, 2 );
+		Surface8u surface( 517, 301, true );
+		for( int32_t y = 0; y < 301; y++ ) {
+			for( int32_t x = 0; x < 517; x++ )
+				surface.setPixel( ivec2( x, y ), ColorA8u( src.getValue( ivec2( x, y ) ) >> 8, x, y, src.getValue( ivec2( x, y ) ) & 255 ) );
+		}
+		const size_t maxThreads = ip::getMaxThreads();
+
+		ip::setMaxThreads( 1 );
+		Channel16u singleChannel = ip::stackBlurCopy( src, 9 );
+		Surface8u singleSurface = ip::stackBlurCopy( surface, 9 );
+		ip::setMaxThreads( 4 );
+		Channel16u multiChannel = ip::stackBlurCopy( src, 9 );
+		Surface8u multiSurface = ip::stackBlurCopy( surface, 9 );
+		ip::setMaxThreads( maxThreads );
+
+		REQUIRE( valuesEqual( singleChannel, multiChannel ) );
+		for( int32_t y = 0; y < 301; y++ ) {
+			for( int32_t x = 0; x < 517; x++ )
+				REQUIRE( singleSurface.getPixel( ivec2( x, y ) ) == multiSurface.getPixel( ivec2( x, y ) ) );
+		}
+	}
+
+	SECTION( "boxBlur matches reference" )
+	{
+		auto src = makeNoiseChannel<float>( 83, 70, 3 );
+		for( int passes : { 1, 3 } ) {
+			Channel32f expected = referenceBoxBlur( src, 5, passes );
+			Channel32f result = ip::boxBlurCopy( src, 5, passes );
+			for( int32_t y = 0; y < 70; y++ ) {
+				for( int32_t x = 0; x < 83; x++ )
+					REQUIRE( result.getValue( ivec2( x, y ) ) == Approx( expected.getValue( ivec2( x, y ) ) ).margin( 1e-5 ) );
+			}
+		}
+	}
+
+	SECTION( "constant image stays constant" )
+	{
+		Surface8u src( 150, 90, true );
+		ip::fill( &src, ColorA8u( 10, 100, 200, 255 ) );
+		Surface8u box = ip::boxBlurCopy( src, 7 );
+		Surface8u gaussian = ip::gaussianBlurCopy( src, 4.5f );
+		ip::stackBlur( &src, 12 );
+		for( int32_t y = 0; y < 90; y++ ) {
+			for( int32_t x = 0; x < 150; x++ ) {
+				REQUIRE( box.getPixel( ivec2( x, y ) ) == ColorA8u( 10, 100, 200, 255 ) );
+				REQUIRE( gaussian.getPixel( ivec2( x, y ) ) == ColorA8u( 10, 100, 200, 255 ) );
+				REQUIRE( src.getPixel( ivec2( x, y ) ) == ColorA8u( 10, 100, 200, 255 ) );
+			}
+		}
+	}
+
+	SECTION( "gaussianBlur of an impulse is a normalized Gaussian" )
+	{
+		const float sigma = 3.0f;
+		Channel32f impulse( 64, 64 );
+		ip::fill( &impulse, 0.0f );
+		*impulse.getData( 32, 32 ) = 1.0f;
+		ip::gaussianBlur( &impulse, sigma );
+
+		float sum = 0;
+		for( int32_t y = 0; y < 64; y++ ) {
+			for( int32_t x = 0; x < 64; x++ )
+				sum += impulse.getValue( ivec2( x, y ) );
+		}
+		REQUIRE( sum == Approx( 1.0f ).epsilon( 1e-5 ) );
+
+		for( int d = 1; d <= 9; d++ ) {
+			REQUIRE( impulse.getValue( ivec2( 32 - d, 32 ) ) == Approx( impulse.getValue( ivec2( 32 + d, 32 ) ) ) );
+			REQUIRE( impulse.getValue( ivec2( 32, 32 - d ) ) == Approx( impulse.getValue( ivec2( 32 + d, 32 ) ) ) );
+			const float ratio = impulse.getValue( ivec2( 32 + d, 32 ) ) / impulse.getValue( ivec2( 32, 32 ) );
+			REQUIRE( ratio == Approx( exp( -d * d / ( 2 * sigma * sigma ) ) ).epsilon( 1e-4 ) );
+		}
+		REQUIRE( impulse.getValue( ivec2( 32 + 10, 32 ) ) == 0.0f );
+	}
+
+	SECTION( "in-place matches copy" )
+	{
+		auto src = makeNoiseChannel<uint8_t>( 120, 80, 4 );
+		Surface16u surface( 120, 80, false, SurfaceChannelOrder::BGR );
+		for( int32_t y = 0; y < 80; y++ ) {
+			for( int32_t x = 0; x < 120; x++ )
+				surface.setPixel( ivec2( x, y ), ColorT<uint16_t>( src.getValue( ivec2( x, y ) ) * 257, x * 500, y * 800 ) );
+		}
+
+		Surface16u gaussianCopy = ip::gaussianBlurCopy( surface, 2.0f );
+		Surface16u boxCopy = ip::boxBlurCopy( surface, 3, 2 );
+		Surface16u gaussianInPlace = surface.clone(), boxInPlace = surface.clone();
+		ip::gaussianBlur( &gaussianInPlace, 2.0f );
+		ip::boxBlur( &boxInPlace, 3, 2 );
+		for( int32_t y = 0; y < 80; y++ ) {
+			for( int32_t x = 0; x < 120; x++ ) {
+				REQUIRE( ( gaussianCopy.getPixel( ivec2( x, y ) ) == gaussianInPlace.getPixel( ivec2( x, y ) ) ) );
+				REQUIRE( ( boxCopy.getPixel( ivec2( x, y ) ) == boxInPlace.getPixel( ivec2( x, y ) ) ) );
+			}
+		}
+	}
+
+	SECTION( "area leaves the rest untouched" )
+	{
+		auto src = makeNoiseChannel<uint8_t>( 60, 50, 5 );
+		const Area area( 10, 5, 40, 35 );
+		Channel8u areaBlurred = src.clone(), box = src.clone();
+		ip::gaussianBlur( &areaBlurred, area, 1.5f );
+		ip::boxBlur( &box, area, 2 );
+		Channel8u expected = ip::gaussianBlurCopy( src.clone( area ), 1.5f );
+		for( int32_t y = 0; y < 50; y++ ) {
+			for( int32_t x = 0; x < 60; x++ ) {
+				if( area.contains( ivec2( x, y ) ) )
+					REQUIRE( areaBlurred.getValue( ivec2( x, y ) ) == expected.getValue( ivec2( x, y ) - area.getUL() ) );
+				else {
+					REQUIRE( areaBlurred.getValue( ivec2( x, y ) ) == src.getValue( ivec2( x, y ) ) );
+					REQUIRE( box.getValue( ivec2( x, y ) ) == src.getValue( ivec2( x, y ) ) );
+				}
+			}
+		}
+	}
+}
@@ -0,0 +1,112 @@
+#include "catch.hpp"
+#include "cinder/gl/GlyphAtlas.h"
+
+#if ( defined( CINDER_ANDROID ) || defined( CINDER_LINUX ) ) && defined( CINDER_GL_HAS_DRAW_INSTANCED )
+
+using namespace cinder;
+using namespace std;
+
+namespace {
+
+// Page textures are only created by upload(), so allocation and eviction can be exercised without a gl::Context or a Font
+class TestAtlas : public gl::GlyphAtlas {
+  public:
+	TestAtlas( const Format &format )
+		: GlyphAtlas( Font(), format )
+	{}
+
+	using GlyphAtlas::allocate;
+
+	//! Allocates a \a width x \a height glyph, returning its page or -1 on failure
+	int allocatePage( int32_t width, int32_t height, ivec2 *position = nullptr )
+	{
+		uint32_t page;
+		ivec2 pos;
+		if( ! allocate( width, height, &page, &pos ) )
+			return -1;
+		if( position )
+			*position = pos;
+		return (int)page;
+	}
+};
+
+} // anonymous namespace
+
+TEST_CASE( "gl/GlyphAtlas" )
+{
+	SECTION( "page width is rounded up to a multiple of 4" )
+	{
+		TestAtlas atlas( gl::GlyphAtlas::Format().pageSize( 61, 10 ) );
+		REQUIRE( atlas.getFormat().getPageWidth() == 64 );
+		REQUIRE( atlas.getFormat().getPageHeight() == 10 );
+	}
+
+	SECTION( "shelf packing" )
+	{
+		TestAtlas atlas( gl::GlyphAtlas::Format().pageSize( 64, 64 ).padding( 1 ) );
+		ivec2 position;
+
+		// 12 x 12 with padding, so five fit on a shelf
+		for( int i = 0; i < 5; ++i ) {
+			REQUIRE( atlas.allocatePage( 10, 10, &position ) == 0 );
+			REQUIRE( position == ivec2( 1 + 12 * i, 1 ) );
+		}
+		REQUIRE( atlas.allocatePage( 10, 10, &position ) == 0 );
+		REQUIRE( position == ivec2( 1, 13 ) );
+
+		// a glyph shorter than two thirds of a shelf starts a new one rather than waste it
+		REQUIRE( atlas.allocatePage( 10, 5, &position ) == 0 );
+		REQUIRE( position == ivec2( 1, 25 ) );
+		// while a slightly shorter one shares the second shelf
+		REQUIRE( atlas.allocatePage( 10, 9, &position ) == 0 );
+		REQUIRE( position == ivec2( 13, 13 ) );
+		// and one that fits the new shelf goes there
+		REQUIRE( atlas.allocatePage( 20, 4, &position ) == 0 );
+		REQUIRE( position == ivec2( 13, 25 ) );
+
+		REQUIRE( atlas.getNumPages() == 1 );
+		REQUIRE( ! atlas.getTexture( 0 ) );
+	}
+
+	SECTION( "glyphs larger than a page are rejected" )
+	{
+		TestAtlas atlas( gl::GlyphAtlas::Format().pageSize( 16, 16 ).padding( 1 ) );
+		REQUIRE( atlas.allocatePage( 15, 4 ) == -1 );
+		REQUIRE( atlas.allocatePage( 4, 15 ) == -1 );
+		REQUIRE( atlas.getNumPages() == 0 );
+		REQUIRE( atlas.allocatePage( 14, 14 ) == 0 );
+	}
+
+	SECTION( "the least recently used page is evicted" )
+	{
+		// every glyph fills a whole page
+		TestAtlas atlas( gl::GlyphAtlas::Format().pageSize( 16, 16 ).padding( 1 ).maxPages( 3 ) );
+		for( uint32_t page = 0; page < 3; ++page ) {
+			REQUIRE( atlas.allocatePage( 14, 14 ) == (int)page );
+			atlas.touch( page );
+		}
+		REQUIRE( atlas.getNumEvictions() == 0 );
+
+		atlas.touch( 0 );
+		atlas.beginBatch();
+		REQUIRE( atlas.allocatePage( 14, 14 ) == 1 );
+		REQUIRE( atlas.getNumEvictions() == 1 );
+		atlas.touch( 1 );
+		REQUIRE( atlas.allocatePage( 14, 14 ) == 2 );
+		atlas.touch( 2 );
+		REQUIRE( atlas.getNumEvictions() == 2 );
+
+		// page 0 was last used before the batch started, pages 1 and 2 are in use by it
+		REQUIRE( atlas.allocatePage( 14, 14 ) == 0 );
+		atlas.touch( 0 );
+		REQUIRE( atlas.allocatePage( 14, 14 ) == -1 );
+		REQUIRE( atlas.getNumEvictions() == 3 );
+
+		// which no longer holds in the next batch
+		atlas.beginBatch();
+		REQUIRE( atlas.allocatePage( 14, 14 ) == 1 );
+		REQUIRE( atlas.getNumPages() == 3 );
+	}
+}
+
+#endif // ( defined( CINDER_ANDROID ) || defined( CINDER_LINUX ) ) && defined( CINDER_GL_HAS_DRAW_INSTANCED )
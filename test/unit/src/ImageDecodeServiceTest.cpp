@@ -0,0 +1,141 @@
+#include "catch.hpp"
+#include "cinder/ImageDecodeService.h"
+#include "cinder/ImageIo.h"
+#include "cinder/Rand.h"
+#include "cinder/app/Platform.h"
+
+#include <condition_variable>
+
+using namespace cinder;
+using namespace std;
+
+namespace {
+
+fs::path writeTestImage( const string &fileName, int32_t width, int32_t height )
+{
+	Surface8u surface( width, height, true );
+	Rand rnd( width * height );
+	for( int32_t y = 0; y < height; y++ ) {
+		for( int32_t x = 0; x < width; x++ )
+			surface.setPixel( ivec2( x, y ), ColorA8u( x, y, rnd.nextUint() & 255, 255 ) );
+	}
+
+	fs::path result = fs::temp_directory_path() / fileName;
+	writeImage( result, surface );
+	return result;
+}
+
+// Blocks a decoding thread until open() is called, so that the order of the requests behind it can be controlled
+class Gate {
+  public:
+	void wait()
+	{
+		unique_lock<mutex> lock( mMutex );
+		mCond.wait( lock, [this] { return mOpen; } );
+	}
+
+	void open()
+	{
+		lock_guard<mutex> lock( mMutex );
+		mOpen = true;
+		mCond.notify_all();
+	}
+
+  private:
+	mutex				mMutex;
+	condition_variable	mCond;
+	bool				mOpen = false;
+};
+
+} // anonymous namespace
+
+TEST_CASE( "ImageDecodeService" )
+{
+	// the Platform registers the image handlers
+	app::Platform::get();
+	const fs::path imagePath = writeTestImage( "cinder_ImageDecodeServiceTest.png", 37, 23 );
+	ImageDecodeService service( ImageDecodeService::Options().numThreads( 1 ).dispatchToApp( false ) );
+
+	SECTION( "decodes a Surface and an ImageSource" )
+	{
+		Surface8uRef surface;
+		ImageSourceRef imageSource;
+		auto surfaceRequest = service.loadSurface<uint8_t>( imagePath, [&]( Surface8uRef result ) { surface = result; } );
+		auto sourceRequest = service.loadImage( loadFile( imagePath ), [&]( ImageSourceRef result ) { imageSource = result; } );
+
+		surfaceRequest->wait();
+		sourceRequest->wait();
+		REQUIRE( surfaceRequest->getState() == ImageDecodeRequest::DECODED );
+		REQUIRE( ! surface );
+
+		REQUIRE( service.update() == 2 );
+		REQUIRE( surfaceRequest->getState() == ImageDecodeRequest::COMPLETED );
+		REQUIRE( surface );
+		REQUIRE( surface->getSize() == ivec2( 37, 23 ) );
+		REQUIRE( surface->getPixel( ivec2( 30, 20 ) ).r == 30 );
+		REQUIRE( surface->getPixel( ivec2( 30, 20 ) ).g == 20 );
+		REQUIRE( imageSource );
+		REQUIRE( imageSource->getWidth() == 37 );
+
+		REQUIRE( service.update() == 0 );
+	}
+
+	SECTION( "higher priorities decode first" )
+	{
+		Gate gate;
+		service.enqueue( [&] { gate.wait(); }, [] {}, 1000 );
+
+		vector<int> order;
+		for( int priority : { 0, 5, -3, 5, 10 } )
+			service.enqueue( [] {}, [&order, priority] { order.push_back( priority ); }, priority );
+		REQUIRE( service.getNumQueued() >= 5 );
+
+		gate.open();
+		auto last = service.enqueue( [] {}, [] {}, -100 );
+		last->wait();
+		service.update();
+
+		REQUIRE( order == vector<int>( { 10, 5, 5, 0, -3 } ) );
+	}
+
+	SECTION( "canceled requests never call back" )
+	{
+		Gate gate;
+		auto blocking = service.enqueue( [&] { gate.wait(); }, [] {}, 1000 );
+
+		bool called = false;
+		auto queued = service.loadSurface<float>( imagePath, [&]( Surface32fRef ) { called = true; } );
+		queued->cancel();
+		REQUIRE( queued->getState() == ImageDecodeRequest::CANCELED );
+
+		gate.open();
+		blocking->wait();
+		auto decoded = service.loadImage( imagePath, [&]( ImageSourceRef ) { called = true; } );
+		decoded->wait();
+		decoded->cancel();
+
+		service.update();
+		REQUIRE( ! called );
+		REQUIRE( decoded->getState() == ImageDecodeRequest::CANCELED );
+		REQUIRE( blocking->getState() == ImageDecodeRequest::COMPLETED );
+	}
+
+	SECTION( "failures call back with null" )
+	{
+		bool called = false;
+		Surface16uRef surface = Surface16u::create( 1, 1, false );
+		auto request = service.loadSurface<uint16_t>( fs::temp_directory_path() / "cinder_ImageDecodeServiceTest_missing.png", [&]( Surface16uRef result ) {
+			called = true;
+			surface = result;
+		} );
+
+		request->wait();
+		service.update();
+		REQUIRE( called );
+		REQUIRE( ! surface );
+		REQUIRE( request->getState() == ImageDecodeRequest::FAILED );
+		REQUIRE( request->getException() );
+	}
+
+	fs::remove( imagePath );
+}
@@ -0,0 +1,132 @@
+#include "catch.hpp"
+#include "cinder/gl/InstanceCuller.h"
+
+#if defined( CINDER_GL_HAS_MULTI_DRAW_INDIRECT )
+
+#include "cinder/ip/Parallel.h"
+#include "cinder/Rand.h"
+
+#include <algorithm>
+
+using namespace cinder;
+using namespace std;
+
+namespace {
+
+vector<gl::InstanceCuller::Instance> makeInstances( size_t count, uint32_t seed )
+{
+	vector<gl::InstanceCuller::Instance> result;
+	Rand rnd( seed );
+	for( size_t i = 0; i < count; ++i )
+		result.emplace_back( rnd.nextVec3() * rnd.nextFloat( 0, 200 ), vec3( rnd.nextFloat( 0.1f, 3 ), rnd.nextFloat( 0.1f, 3 ), rnd.nextFloat( 0.1f, 3 ) ), (uint32_t)i );
+
+	return result;
+}
+
+CameraPersp makeCamera()
+{
+	CameraPersp result( 640, 480, 60, 1, 150 );
+	result.lookAt( vec3( 10, 20, 100 ), vec3( 0, 5, 0 ) );
+	return result;
+}
+
+// the smallest distance from any of the box's corners to any of the frustum's planes; rounding may decide boxes this close either way
+float boundaryDistance( const Frustumf &frustum, const gl::InstanceCuller::Instance &instance )
+{
+	float result = FLT_MAX;
+	for( int p = 0; p < 6; ++p ) {
+		const Planef &plane = frustum.getPlane( (Frustumf::FrustumSection)p );
+		result = std::min( result, std::abs( plane.distance( instance.mCenter ) + dot( abs( plane.getNormal() ), instance.mExtents ) ) );
+	}
+
+	return result;
+}
+
+} // anonymous namespace
+
+TEST_CASE( "gl/InstanceCuller" )
+{
+	const size_t maxThreads = ip::getMaxThreads();
+	const CameraPersp camera = makeCamera();
+	const Frustumf frustum( camera );
+
+	SECTION( "matches Frustum::intersects()" )
+	{
+		// an odd count exercises the scalar tail after the 4-wide groups
+		auto instances = makeInstances( 20003, 1 );
+		vector<vector<uint32_t>> visible;
+		gl::InstanceCuller::cullInstances( frustum, camera.getEyePoint(), instances.data(), instances.size(), { FLT_MAX }, &visible );
+		REQUIRE( visible.size() == 1 );
+		REQUIRE( is_sorted( visible[0].begin(), visible[0].end() ) );
+
+		size_t numVisible = 0, numMismatched = 0;
+		for( const auto &instance : instances ) {
+			bool expected = frustum.intersects( AxisAlignedBox( instance.mCenter - instance.mExtents, instance.mCenter + instance.mExtents ) );
+			bool culled = binary_search( visible[0].begin(), visible[0].end(), instance.mId );
+			numVisible += expected ? 1 : 0;
+			if( expected != culled ) {
+				REQUIRE( boundaryDistance( frustum, instance ) < 1e-3f );
+				++numMismatched;
+			}
+		}
+
+		REQUIRE( numVisible > 100 );
+		REQUIRE( numVisible < instances.size() / 2 );
+		REQUIRE( numMismatched <= 2 );
+	}
+
+	SECTION( "selects LODs by distance from the eye" )
+	{
+		auto instances = makeInstances( 5001, 2 );
+		const vector<float> lodMaxDistances = { 40, 80, 120 };
+		vector<vector<uint32_t>> visible, all;
+		gl::InstanceCuller::cullInstances( frustum, camera.getEyePoint(), instances.data(), instances.size(), lodMaxDistances, &visible );
+		gl::InstanceCuller::cullInstances( frustum, camera.getEyePoint(), instances.data(), instances.size(), { FLT_MAX }, &all );
+		REQUIRE( visible.size() == 3 );
+
+		size_t numLodded = 0;
+		for( size_t lod = 0; lod < visible.size(); ++lod ) {
+			REQUIRE( ! visible[lod].empty() );
+			numLodded += visible[lod].size();
+			for( uint32_t id : visible[lod] ) {
+				REQUIRE( binary_search( all[0].begin(), all[0].end(), id ) );
+				float distance = glm::distance( instances[id].mCenter, camera.getEyePoint() );
+				REQUIRE( distance < lodMaxDistances[lod] + 1e-3f );
+				if( lod > 0 )
+					REQUIRE( distance > lodMaxDistances[lod - 1] - 1e-3f );
+			}
+		}
+
+		// instances beyond the last LOD are dropped
+		size_t numBeyond = 0;
+		for( uint32_t id : all[0] )
+			numBeyond += glm::distance( instances[id].mCenter, camera.getEyePoint() ) >= 120 ? 1 : 0;
+		REQUIRE( numLodded + numBeyond == all[0].size() );
+	}
+
+	SECTION( "results don't depend on the number of threads" )
+	{
+		auto instances = makeInstances( 100000, 3 );
+		vector<vector<uint32_t>> single, multi;
+		ip::setMaxThreads( 1 );
+		gl::InstanceCuller::cullInstances( frustum, camera.getEyePoint(), instances.data(), instances.size(), { 50, 150 }, &single );
+		ip::setMaxThreads( 4 );
+		gl::InstanceCuller::cullInstances( frustum, camera.getEyePoint(), instances.data(), instances.size(), { 50, 150 }, &multi );
+		ip::setMaxThreads( maxThreads );
+		REQUIRE( single == multi );
+	}
+
+	SECTION( "ids are passed through" )
+	{
+		auto instances = makeInstances( 7, 4 );
+		for( auto &instance : instances ) {
+			instance.mCenter = vec3( 0, 5, 0 );
+			instance.mId += 1000;
+		}
+		vector<vector<uint32_t>> visible;
+		gl::InstanceCuller::cullInstances( frustum, camera.getEyePoint(), instances.data(), instances.size(), { FLT_MAX }, &visible );
+		REQUIRE( visible[0] == vector<uint32_t>( { 1000, 1001, 1002, 1003, 1004, 1005, 1006 } ) );
+	}
+}
+
+#endif // defined( CINDER_GL_HAS_MULTI_DRAW_INDIRECT )
@@ -2,6 +2,11 @@
 #include "catch.hpp"
 #include "cinder/ObjLoader.h"
 #include "cinder/TriMesh.h"
+#include "cinder/ip/Parallel.h"
+
+#include <cstring>
+#include <random>
+#include <sstream>
 
 using namespace cinder;
 
@@ -95,3 +100,174 @@ SECTION( "ObjLoader successfully parses faces with line continuations." )
 }
 
 } // ObjLoader tests
+
+TEST_CASE( "ObjLoader parallel parsing" )
+{
+SECTION( "Negative indices count back from the vertices so far, across groups." )
+{
+	const std::string data = "g first\nv 0 0 0\nv 1 0 0\nv 1 1 0\nvt 0 0\nvt 1 0\nvt 1 1\nvn 0 0 1\nf -3/-3/-1 -2/-2/-1 -1/-1/-1\n"
+		"g second\r\nv 0 0 1\r\nv 1 0 1\r\nv 1 1 1\r\nf -3//-1 -2//-1 -1//-1\r\n";
+	ObjLoader obj( IStreamMem::create( data.c_str(), data.size() ) );
+	REQUIRE( obj.getNumGroups() == 2 );
+	const auto &groups = obj.getGroups();
+	REQUIRE( groups[0].mName == "first" );
+	REQUIRE( groups[1].mName == "second" );
+	REQUIRE( groups[0].mFaces[0].mVertexIndices == std::vector<int32_t>( { 0, 1, 2 } ) );
+	REQUIRE( groups[0].mFaces[0].mTexCoordIndices == std::vector<int32_t>( { 0, 1, 2 } ) );
+	REQUIRE( groups[0].mFaces[0].mNormalIndices == std::vector<int32_t>( { 0, 0, 0 } ) );
+	REQUIRE( groups[0].mHasTexCoords );
+	REQUIRE( groups[0].mHasNormals );
+	REQUIRE( groups[1].mFaces[0].mVertexIndices == std::vector<int32_t>( { 3, 4, 5 } ) );
+	REQUIRE( groups[1].mBaseVertexOffset == 3 );
+	REQUIRE( ! groups[1].mHasTexCoords );
+	REQUIRE( groups[1].mHasNormals );
+
+	TriMesh mesh( obj.groupName( "second" ) );
+	REQUIRE( mesh.getNumTriangles() == 1 );
+	REQUIRE( mesh.getPositions<3>()[0] == vec3( 0, 0, 1 ) );
+}
+
+SECTION( "Floats parse as strtof() does." )
+{
+	std::mt19937 rng( 1 );
+	std::uniform_real_distribution<float> mantissa( -1000, 1000 );
+	std::uniform_int_distribution<int> exponent( -40, 38 ), format( 0, 4 );
+	std::vector<std::string> tokens = { "0", "-0", "+5", ".5", "5.", "-.25e1", "1E+3", "3.4028235e38", "1e-45", "0.1", "0.333333333333333333333333", "inf", "-nan" };
+	while( tokens.size() % 9 || tokens.size() < 3000 ) { // whole triangles of whole vertices
+		char token[64];
+		const float value = mantissa( rng ) * std::pow( 10.0f, exponent( rng ) / 4.0f );
+		const char *formats[] = { "%g", "%.9g", "%e", "%.3f", "%.17g" };
+		snprintf( token, sizeof( token ), formats[format( rng )], value );
+		tokens.push_back( token );
+	}
+
+	std::string data;
+	for( size_t i = 0; i < tokens.size(); i += 3 )
+		data += "v " + tokens[i] + " " + tokens[i + 1] + "\t" + tokens[i + 2] + "\n";
+	for( size_t i = 1; i <= tokens.size() / 3; i += 3 )
+		data += "f " + std::to_string( i ) + " " + std::to_string( i + 1 ) + " " + std::to_string( i + 2 ) + "\n";
+
+	ObjLoader obj( IStreamMem::create( data.c_str(), data.size() ) );
+	TriMesh mesh( obj );
+	REQUIRE( mesh.getNumVertices() * 3 == tokens.size() );
+	for( size_t i = 0; i < tokens.size(); ++i ) {
+		const float expected = strtof( tokens[i].c_str(), nullptr ), parsed = mesh.getBufferPositions()[i];
+		INFO( tokens[i] );
+		REQUIRE( ( std::memcmp( &expected, &parsed, sizeof( float ) ) == 0 || ( std::isnan( expected ) && std::isnan( parsed ) ) ) );
+	}
+}
+
+SECTION( "Files spanning many chunks parse as one." )
+{
+	// a grid of quads in groups that change every few rows, with continuations and a mix of line endings and absolute and relative indices
+	const int size = 300;
+	std::ostringstream os;
+	os << "# grid\n";
+	for( int y = 0; y <= size; ++y ) {
+		for( int x = 0; x <= size; ++x ) {
+			os << "v " << x * 0.5f << " " << y * 0.25f << ( ( x % 97 ) ? " " : " \\\n " ) << x + y << ( ( x % 2 ) ? "\r\n" : "\n" );
+			os << "vt " << x / (float)size << " " << y / (float)size << "\n";
+		}
+	}
+	os << "vn 0 0 1\n";
+	for( int y = 0; y < size; ++y ) {
+		if( y % 7 == 0 )
+			os << "g rows" << y << "\n";
+		for( int x = 0; x < size; ++x ) {
+			int i = y * ( size + 1 ) + x + 1;
+			if( ( x + y ) % 2 )
+				os << "f " << i << "/" << i << "/1 " << i + 1 << "/" << i + 1 << "/1 " << i + size + 2 << "/" << i + size + 2 << "/1 " << i + size + 1 << "/" << i + size + 1 << "/1\n";
+			else {
+				int relative = i - ( size + 1 ) * ( size + 1 ) - 1;
+				os << "f " << relative << "/" << relative << "/-1 " << relative + 1 << "/" << relative + 1 << "/-1 " << relative + size + 2 << "/" << relative + size + 2 << "/-1 "
+					<< relative + size + 1 << "/" << relative + size + 1 << "/-1\n";
+			}
+		}
+	}
+	const std::string data = os.str();
+	REQUIRE( data.size() > 3 * 1024 * 1024 );
+
+	const size_t maxThreads = ip::getMaxThreads();
+	auto load = [&]( size_t numThreads ) {
+		ip::setMaxThreads( numThreads );
+		ObjLoader obj( IStreamMem::create( data.c_str(), data.size() ) );
+		ip::setMaxThreads( maxThreads );
+		REQUIRE( obj.getNumGroups() == ( size + 6 ) / 7 );
+		size_t numFaces = 0;
+		for( const auto &group : obj.getGroups() ) {
+			numFaces += group.mFaces.size();
+			REQUIRE( group.mHasTexCoords );
+			REQUIRE( group.mHasNormals );
+		}
+		REQUIRE( numFaces == size * size );
+		return TriMesh( obj );
+	};
+
+	TriMesh mesh = load( 4 );
+	REQUIRE( mesh.getNumVertices() == ( size + 1 ) * ( size + 1 ) );
+	REQUIRE( mesh.getNumTriangles() == size * size * 2 );
+	for( size_t v = 0; v < mesh.getNumVertices(); ++v ) {
+		const vec3 p = mesh.getPositions<3>()[v];
+		REQUIRE( p.z == p.x * 2 + p.y * 4 );
+		REQUIRE( mesh.getTexCoords0<2>()[v].x == Approx( p.x * 2 / size ).margin( 1e-5 ) );
+		REQUIRE( mesh.getNormals()[v] == vec3( 0, 0, 1 ) );
+	}
+
+	TriMesh single = load( 1 );
+	REQUIRE( single.getBufferPositions() == mesh.getBufferPositions() );
+	REQUIRE( single.getIndices() == mesh.getIndices() );
+}
+
+SECTION( "Malformed faces throw." )
+{
+	for( std::string data : { "v 0 0 0\nf 1 2 3\n", "v 0 0 0\nf 1 x 1\n", "v 0 0 0\nf 0 1 1\n", "v 0 0 0\nf -2 1 1\n" } ) {
+		INFO( data );
+		REQUIRE_THROWS_AS( ObjLoader( IStreamMem::create( data.c_str(), data.size() ) ), cinder::Exception );
+	}
+}
+
+SECTION( "loadObjCached writes a cache and loads it next time." )
+{
+	const fs::path objPath = fs::temp_directory_path() / "ObjLoaderTest_cube.obj";
+	const fs::path cachePath = fs::temp_directory_path() / "ObjLoaderTest_cube.obj.msh";
+	fs::remove( cachePath );
+	writeObj( writeFile( objPath ), geom::Cube() );
+
+	geom::SourceRef parsed = loadObjCached( objPath );
+	REQUIRE( fs::exists( cachePath ) );
+	REQUIRE( std::dynamic_pointer_cast<MappedTriMesh>( parsed ) == nullptr );
+
+	geom::SourceRef cached = loadObjCached( objPath );
+	REQUIRE( std::dynamic_pointer_cast<MappedTriMesh>( cached ) != nullptr );
+	TriMesh a( *parsed ), b( *cached );
+	REQUIRE( a.getNumTriangles() == 12 );
+	REQUIRE( a.getBufferPositions() == b.getBufferPositions() );
+	REQUIRE( a.getNormals() == b.getNormals() );
+	REQUIRE( a.getIndices() == b.getIndices() );
+	REQUIRE( ! fs::exists( cachePath.string() + ".tmp" ) );
+
+	// loading without normals uses a cache of its own
+	const fs::path positionsCachePath = fs::temp_directory_path() / "ObjLoaderTest_cube.obj.nonormals.msh";
+	fs::remove( positionsCachePath );
+	geom::SourceRef positions = loadObjCached( objPath, fs::path(), false );
+	REQUIRE( fs::exists( positionsCachePath ) );
+	REQUIRE( ! TriMesh( *positions ).hasNormals() );
+	REQUIRE( ! TriMesh( *loadObjCached( objPath, fs::path(), false ) ).hasNormals() );
+	REQUIRE( TriMesh( *loadObjCached( objPath ) ).hasNormals() );
+
+	fs::remove( objPath );
+	fs::remove( cachePath );
+	fs::remove( positionsCachePath );
+}
+
+SECTION( "Timing covers each phase." )
+{
+	const std::string data = "v 1 1 -1\nv 1 1 1\nv -1 1 1\nv -1 1 -1\nf 1 4 3 2\n";
+	ObjLoader obj( IStreamMem::create( data.c_str(), data.size() ) );
+	REQUIRE( obj.getTiming().mLoadSeconds == 0 );
+	REQUIRE( obj.getNumIndices() == 6 );
+	REQUIRE( obj.getTiming().mParseSeconds > 0 );
+	REQUIRE( obj.getTiming().getTotalSeconds() >= obj.getTiming().mParseSeconds + obj.getTiming().mLoadSeconds );
+}
+
+} // ObjLoader parallel parsing tests
@@ -0,0 +1,153 @@
+#include "catch.hpp"
+#include "cinder/gl/Profiler.h"
+
+#include <sstream>
+
+using namespace cinder;
+using namespace std;
+
+namespace {
+
+// GPU timing needs a gl::Context, so these only exercise the CPU side
+gl::Profiler::Options cpuOnly()
+{
+	return gl::Profiler::Options().gpuTiming( false );
+}
+
+void recordFrame( gl::Profiler &profiler )
+{
+	{
+		gl::ScopedProfile update( "update", &profiler );
+		gl::ScopedProfile physics( "physics", &profiler );
+	}
+	{
+		gl::ScopedProfile draw( "draw", &profiler );
+		for( int i = 0; i < 3; ++i ) {
+			gl::ScopedProfile shadows( "shadows", &profiler );
+		}
+	}
+	profiler.endFrame();
+}
+
+} // anonymous namespace
+
+TEST_CASE( "gl/Profiler" )
+{
+	SECTION( "nested scopes form a tree" )
+	{
+		gl::Profiler profiler( cpuOnly() );
+		REQUIRE( ! profiler.isGpuTiming() );
+		for( int frame = 0; frame < 10; ++frame )
+			recordFrame( profiler );
+
+		auto stats = profiler.getStats();
+		REQUIRE( stats.size() == 4 );
+		REQUIRE( stats[0].mPath == "update" );
+		REQUIRE( stats[1].mPath == "update/physics" );
+		REQUIRE( stats[1].mDepth == 1 );
+		REQUIRE( stats[2].mPath == "draw" );
+		REQUIRE( stats[3].mPath == "draw/shadows" );
+		REQUIRE( stats[3].mName == "shadows" );
+		REQUIRE( stats[3].mCallsPerFrame == 3 );
+		REQUIRE( stats[3].mNumFrames == 10 );
+
+		for( const auto &scope : stats ) {
+			REQUIRE( scope.mCpu.mMin <= scope.mCpu.mP50 );
+			REQUIRE( scope.mCpu.mP50 <= scope.mCpu.mP95 );
+			REQUIRE( scope.mCpu.mP95 <= scope.mCpu.mP99 );
+			REQUIRE( scope.mCpu.mP99 <= scope.mCpu.mMax );
+			REQUIRE( scope.mCpu.mMean <= scope.mCpu.mMax );
+			REQUIRE( scope.mGpu.mMax == 0 );
+		}
+		REQUIRE( profiler.getStats()[2].mCpu.mMean >= profiler.getStats()[3].mCpu.mMean );
+		REQUIRE( profiler.getFrameHistory().size() == 10 );
+	}
+
+	SECTION( "statistics only cover the history" )
+	{
+		gl::Profiler profiler( cpuOnly().historySize( 5 ) );
+		profiler.begin( "old" );
+		profiler.end();
+		profiler.endFrame();
+		for( int frame = 0; frame < 8; ++frame )
+			recordFrame( profiler );
+
+		auto stats = profiler.getStats();
+		REQUIRE( stats.size() == 4 );
+		REQUIRE( stats[0].mNumFrames == 5 );
+		REQUIRE( profiler.getFrameHistory().size() == 5 );
+
+		profiler.clearStats();
+		REQUIRE( profiler.getStats().empty() );
+	}
+
+	SECTION( "open scopes are closed by endFrame() and disabling skips frames" )
+	{
+		gl::Profiler profiler( cpuOnly() );
+		profiler.begin( "outer" );
+		profiler.begin( "inner" );
+		profiler.endFrame();
+		profiler.end();
+
+		profiler.setEnabled( false );
+		profiler.endFrame();
+		profiler.begin( "skipped" );
+		profiler.end();
+		profiler.endFrame();
+
+		auto stats = profiler.getStats();
+		REQUIRE( stats.size() == 2 );
+		REQUIRE( stats[1].mPath == "outer/inner" );
+		REQUIRE( stats[0].mNumFrames == 1 );
+	}
+
+	SECTION( "GPU timing waits for a gl::Context" )
+	{
+		gl::Profiler profiler;
+		REQUIRE( profiler.getOptions().isGpuTiming() );
+		recordFrame( profiler );
+		REQUIRE( ! profiler.isGpuTiming() );
+		REQUIRE( profiler.getNumQueriesAllocated() == 0 );
+		REQUIRE( profiler.getStats().size() == 4 );
+	}
+
+	SECTION( "CI_PROFILE_SCOPE records into the global profiler" )
+	{
+		gl::Profiler *global = gl::Profiler::get();
+		const size_t numFrames = global->getFrameHistory().size();
+		{
+			CI_PROFILE_SCOPE( "global" );
+		}
+		global->endFrame();
+		REQUIRE( global->getFrameHistory().size() == numFrames + 1 );
+
+		// leave nothing behind for other tests
+		global->clearStats();
+	}
+
+	SECTION( "captures export as Chrome trace JSON" )
+	{
+		gl::Profiler profiler( cpuOnly() );
+		recordFrame( profiler );
+		profiler.startCapture( 2 );
+		for( int frame = 0; frame < 4; ++frame ) {
+			profiler.begin( "\"quoted\"\\" );
+			profiler.end();
+			recordFrame( profiler );
+		}
+		REQUIRE( ! profiler.isCapturing() );
+		REQUIRE( profiler.getNumCapturedFrames() == 2 );
+
+		ostringstream os;
+		profiler.writeChromeTrace( os );
+		const string json = os.str();
+		REQUIRE( json.find( "{\"traceEvents\":[" ) == 0 );
+		REQUIRE( json.find( "\"name\":\"\\\"quoted\\\"\\\\\"" ) != string::npos );
+		REQUIRE( json.find( "\"cat\":\"gpu\"" ) == string::npos );
+
+		size_t numShadows = 0;
+		for( size_t pos = json.find( "\"name\":\"shadows\"" ); pos != string::npos; pos = json.find( "\"name\":\"shadows\"", pos + 1 ) )
+			++numShadows;
+		REQUIRE( numShadows == 6 );
+	}
+}
@@ -0,0 +1,78 @@
+#include "catch.hpp"
+#include "cinder/gl/ProgramBinaryCache.h"
+#include "cinder/Stream.h"
+
+using namespace cinder;
+using namespace std;
+
+TEST_CASE( "gl/ProgramBinaryCache" )
+{
+	auto cache = gl::ProgramBinaryCache::get();
+	const fs::path directory = fs::temp_directory_path() / "cinder_ProgramBinaryCacheTest";
+
+	SECTION( "keys are stable FNV-1a hashes" )
+	{
+		REQUIRE( gl::ProgramBinaryCache::hash( nullptr, 0 ) == 14695981039346656037ULL );
+		REQUIRE( gl::ProgramBinaryCache::hash( "a", 1 ) == 0xaf63dc4c8601ec8cULL );
+		REQUIRE( gl::ProgramBinaryCache::hash( "foobar", 6 ) == 0x85944171f73967e8ULL );
+
+		// strings are length prefixed, so moving characters between consecutive strings changes the key
+		uint64_t ab_c = gl::ProgramBinaryCache::hash( string( "c" ), gl::ProgramBinaryCache::hash( string( "ab" ) ) );
+		uint64_t a_bc = gl::ProgramBinaryCache::hash( string( "bc" ), gl::ProgramBinaryCache::hash( string( "a" ) ) );
+		REQUIRE( ab_c != a_bc );
+	}
+
+	SECTION( "unusable binaries are discarded" )
+	{
+		cache->enable( directory );
+		REQUIRE( ! cache->load( 0, 0x1234 ) );
+		REQUIRE( cache->getNumMisses() == 1 );
+
+		const fs::path corruptPath = directory / "0000000000005678.cibin";
+		{
+			auto stream = writeFileStream( corruptPath, true );
+			stream->writeLittle( (uint32_t)0xDEADBEEF );
+		}
+		REQUIRE( ! cache->load( 0, 0x5678 ) );
+		REQUIRE( ! fs::exists( corruptPath ) );
+		REQUIRE( cache->getNumMisses() == 2 );
+		REQUIRE( cache->getNumHits() == 0 );
+		cache->disable();
+	}
+
+	SECTION( "clear() only removes binaries" )
+	{
+		cache->enable( directory );
+		writeFileStream( directory / "00000000000000aa.cibin", true )->writeLittle( (uint32_t)1 );
+		writeFileStream( directory / "notes.txt", true )->writeLittle( (uint32_t)1 );
+		cache->clear();
+		REQUIRE( ! fs::exists( directory / "00000000000000aa.cibin" ) );
+		REQUIRE( fs::exists( directory / "notes.txt" ) );
+		cache->disable();
+	}
+
+	SECTION( "timings are only recorded when enabled" )
+	{
+		gl::ProgramBinaryCache::ProgramTiming timing = {};
+		timing.mName = "test";
+		timing.mCompileSeconds = 0.25;
+		timing.mLinkSeconds = 0.5;
+		cache->addTiming( timing );
+		REQUIRE( cache->getTimings().empty() );
+
+		cache->enableTiming();
+		cache->addTiming( timing );
+		REQUIRE( cache->getTimings().size() == 1 );
+		REQUIRE( cache->getTimings()[0].getTotalSeconds() == Approx( 0.75 ) );
+
+		stringstream ss;
+		cache->printTimings( ss );
+		REQUIRE( ss.str().find( "test" ) != string::npos );
+
+		cache->enableTiming( false );
+		cache->clearTimings();
+	}
+
+	std::error_code ec;
+	fs::remove_all( directory, ec );
+}
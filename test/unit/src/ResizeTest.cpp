@@ -0,0 +1,225 @@
+#include "catch.hpp"
+#include "cinder/ip/Resize.h"
+#include "cinder/ip/Parallel.h"
+#include "cinder/Rand.h"
+
+#include <cstring>
+
+using namespace cinder;
+using namespace std;
+
+namespace {
+
+template<typename T>
+SurfaceT<T> makeNoiseSurface( int32_t width, int32_t height, const SurfaceChannelOrder &channelOrder, uint32_t seed )
+{
+	SurfaceT<T> result( width, height, channelOrder.hasAlpha(), channelOrder );
+	Rand rnd( seed );
+	for( int32_t y = 0; y < height; y++ ) {
+		T *row = result.getData( ivec2( 0, y ) );
+		for( int32_t i = 0; i < width * result.getPixelInc(); i++ )
+			row[i] = T( rnd.nextFloat() * CHANTRAIT<T>::max() );
+	}
+
+	return result;
+}
+
+template<typename T>
+bool pixelsEqual( const SurfaceT<T> &a, const SurfaceT<T> &b )
+{
+	if( a.getSize() != b.getSize() )
+		return false;
+
+	for( int32_t y = 0; y < a.getHeight(); y++ ) {
+		for( int32_t x = 0; x < a.getWidth(); x++ ) {
+			if( a.getPixel( ivec2( x, y ) ) != b.getPixel( ivec2( x, y ) ) )
+				return false;
+		}
+	}
+
+	return true;
+}
+
+// largest difference between any channel of any pixel
+template<typename T>
+float maxDifference( const SurfaceT<T> &a, const SurfaceT<T> &b )
+{
+	float result = 0;
+	for( int32_t y = 0; y < a.getHeight(); y++ ) {
+		for( int32_t x = 0; x < a.getWidth(); x++ ) {
+			ColorAT<T> pa = a.getPixel( ivec2( x, y ) ), pb = b.getPixel( ivec2( x, y ) );
+			for( int c = 0; c < 4; c++ )
+				result = std::max( result, fabs( float( pa[c] ) - float( pb[c] ) ) );
+		}
+	}
+
+	return result;
+}
+
+// only differs from a box filter where |x| is between 0.2 and 0.3, which a few samples of its function could miss
+class FilterNotch : public FilterBase {
+  public:
+	FilterNotch( float depth ) : FilterBase( 1.0f ), mDepth( depth ) {}
+
+	float operator()( float x ) const override
+	{
+		const float a = std::abs( x );
+		if( a >= 0.5f )
+			return 0;
+		return ( a > 0.2f && a < 0.3f ) ? 1 - mDepth : 1;
+	}
+
+  private:
+	float mDepth;
+};
+
+template<typename T>
+void testIdentity()
+{
+	auto src = makeNoiseSurface<T>( 67, 41, SurfaceChannelOrder::RGBA, 1 );
+	SurfaceT<T> dst( src.getWidth(), src.getHeight(), true );
+	ip::resize( src, &dst, FilterTriangle() );
+	REQUIRE( pixelsEqual( src, dst ) );
+}
+
+} // anonymous namespace
+
+TEST_CASE( "ip/Resize" )
+{
+	SECTION( "same size is identity" )
+	{
+		testIdentity<uint8_t>();
+		testIdentity<uint16_t>();
+		testIdentity<float>();
+	}
+
+	SECTION( "constant image stays constant" )
+	{
+		const FilterBox box;
+		const FilterTriangle triangle;
+		const FilterCubic cubic;
+		const FilterCatmullRom catmullRom;
+		const FilterMitchell mitchell;
+		const FilterSincBlackman sinc;
+		const FilterGaussian gaussian;
+		const FilterBase *filters[] = { &box, &triangle, &cubic, &catmullRom, &mitchell, &sinc, &gaussian };
+
+		for( auto filter : filters ) {
+			for( auto dstSize : { ivec2( 13, 7 ), ivec2( 180, 97 ) } ) {
+				Surface8u src8( 64, 48, false, SurfaceChannelOrder::RGB );
+				memset( src8.getData(), 77, src8.getRowBytes() * src8.getHeight() );
+				Surface8u dst8 = ip::resizeCopy( src8, src8.getBounds(), dstSize, *filter );
+				for( int32_t y = 0; y < dstSize.y; y++ ) {
+					for( int32_t x = 0; x < dstSize.x * 3; x++ )
+						REQUIRE( (int)dst8.getData( ivec2( 0, y ) )[x] == 77 );
+				}
+
+				Channel32f src32( 64, 48 );
+				for( int32_t y = 0; y < 48; y++ )
+					std::fill( src32.getData( 0, y ), src32.getData( 0, y ) + 64, 0.25f );
+				Channel32f dst32( dstSize.x, dstSize.y );
+				ip::resize( src32, &dst32, *filter );
+				for( int32_t y = 0; y < dstSize.y; y++ ) {
+					for( int32_t x = 0; x < dstSize.x; x++ )
+						REQUIRE( dst32.getValue( ivec2( x, y ) ) == Approx( 0.25f ).epsilon( 1e-5 ) );
+				}
+			}
+		}
+	}
+
+	SECTION( "result doesn't depend on thread count" )
+	{
+		auto src = makeNoiseSurface<uint8_t>( 1031, 777, SurfaceChannelOrder::RGBA, 2 );
+		const size_t maxThreads = ip::getMaxThreads();
+
+		ip::setMaxThreads( 1 );
+		Surface8u single = ip::resizeCopy( src, src.getBounds(), ivec2( 301, 203 ), FilterMitchell() );
+		ip::setMaxThreads( 4 );
+		Surface8u multi = ip::resizeCopy( src, src.getBounds(), ivec2( 301, 203 ), FilterMitchell() );
+		ip::setMaxThreads( maxThreads );
+
+		REQUIRE( pixelsEqual( single, multi ) );
+	}
+
+	// a differing order filters channel by channel, which may sum in a different order and round the other way
+	SECTION( "channel orders may differ" )
+	{
+		auto src = makeNoiseSurface<uint16_t>( 120, 90, SurfaceChannelOrder::RGBA, 3 );
+		Surface16u rgba( 50, 70, true, SurfaceChannelOrder::RGBA );
+		Surface16u bgra( 50, 70, true, SurfaceChannelOrder::BGRA );
+		ip::resize( src, &rgba, FilterCatmullRom() );
+		ip::resize( src, &bgra, FilterCatmullRom() );
+		REQUIRE( maxDifference( rgba, bgra ) <= 1 );
+
+		auto srcRgb = makeNoiseSurface<uint16_t>( 120, 90, SurfaceChannelOrder::RGB, 3 );
+		Surface16u rgb( 50, 70, false, SurfaceChannelOrder::RGB );
+		Surface16u rgbx( 50, 70, false, SurfaceChannelOrder::RGBX );
+		ip::resize( srcRgb, &rgb, FilterCatmullRom() );
+		ip::resize( srcRgb, &rgbx, FilterCatmullRom() );
+		REQUIRE( maxDifference( rgb, rgbx ) <= 1 );
+	}
+
+	SECTION( "8u matches 32f" )
+	{
+		auto src8 = makeNoiseSurface<uint8_t>( 200, 150, SurfaceChannelOrder::RGB, 4 );
+		Surface32f src32( src8 );
+		Surface8u dst8 = ip::resizeCopy( src8, src8.getBounds(), ivec2( 77, 51 ), FilterTriangle() );
+		Surface32f dst32 = ip::resizeCopy( src32, src32.getBounds(), ivec2( 77, 51 ), FilterTriangle() );
+		for( int32_t y = 0; y < 51; y++ ) {
+			for( int32_t x = 0; x < 77; x++ ) {
+				ColorA8u a = dst8.getPixel( ivec2( x, y ) );
+				ColorAf b = dst32.getPixel( ivec2( x, y ) );
+				REQUIRE( fabs( a.r - b.r * 255 ) <= 0.5f + 1e-3f );
+				REQUIRE( fabs( a.g - b.g * 255 ) <= 0.5f + 1e-3f );
+				REQUIRE( fabs( a.b - b.b * 255 ) <= 0.5f + 1e-3f );
+			}
+		}
+	}
+
+	SECTION( "cached weights are keyed by filter parameters" )
+	{
+		auto src = makeNoiseSurface<float>( 90, 60, SurfaceChannelOrder::RGB, 5 );
+
+		ip::resizeClearCache();
+		Surface32f expected = ip::resizeCopy( src, src.getBounds(), ivec2( 40, 25 ), FilterMitchell( 2.0f, 0.0f, 0.5f ) );
+		ip::resizeClearCache();
+		ip::resizeCopy( src, src.getBounds(), ivec2( 40, 25 ), FilterMitchell() );
+		ip::resizeCopy( src, src.getBounds(), ivec2( 40, 25 ), FilterGaussian( 2.0f ) );
+		Surface32f result = ip::resizeCopy( src, src.getBounds(), ivec2( 40, 25 ), FilterMitchell( 2.0f, 0.0f, 0.5f ) );
+
+		REQUIRE( pixelsEqual( expected, result ) );
+	}
+
+	SECTION( "filters without cache parameters aren't cached" )
+	{
+		auto src = makeNoiseSurface<float>( 90, 60, SurfaceChannelOrder::RGB, 6 );
+
+		ip::resizeClearCache();
+		Surface32f expected = ip::resizeCopy( src, src.getBounds(), ivec2( 40, 25 ), FilterNotch( 0.5f ) );
+		ip::resizeClearCache();
+		Surface32f other = ip::resizeCopy( src, src.getBounds(), ivec2( 40, 25 ), FilterNotch( 0 ) );
+		Surface32f result = ip::resizeCopy( src, src.getBounds(), ivec2( 40, 25 ), FilterNotch( 0.5f ) );
+
+		REQUIRE( ! pixelsEqual( expected, other ) );
+		REQUIRE( pixelsEqual( expected, result ) );
+	}
+
+	SECTION( "sub-area of a Channel" )
+	{
+		auto src = makeNoiseSurface<uint8_t>( 64, 64, SurfaceChannelOrder::RGB, 6 );
+		Channel8u &srcRed = src.getChannelRed();
+		Channel8u copy( 32, 32 );
+		for( int32_t y = 0; y < 32; y++ ) {
+			for( int32_t x = 0; x < 32; x++ )
+				*copy.getData( x, y ) = srcRed.getValue( ivec2( x + 16, y + 8 ) );
+		}
+
+		Channel8u fromArea( 20, 20 ), fromCopy( 20, 20 );
+		ip::resize( srcRed, Area( 16, 8, 48, 40 ), &fromArea, fromArea.getBounds(), FilterCubic() );
+		ip::resize( copy, &fromCopy, FilterCubic() );
+		for( int32_t y = 0; y < 20; y++ ) {
+			for( int32_t x = 0; x < 20; x++ )
+				REQUIRE( fromArea.getValue( ivec2( x, y ) ) == fromCopy.getValue( ivec2( x, y ) ) );
+		}
+	}
+}
@@ -0,0 +1,174 @@
+#include "catch.hpp"
+#include "cinder/TriMesh.h"
+#include "cinder/ip/Parallel.h"
+
+#include <algorithm>
+#include <set>
+
+using namespace cinder;
+using namespace std;
+
+namespace {
+
+// a flat grid in the xz plane, so that its interior collapses without error while its border stays put
+TriMesh makeGrid( int size )
+{
+	TriMesh result( TriMesh::Format().positions().normals().texCoords0( 2 ) );
+	for( int y = 0; y <= size; ++y ) {
+		for( int x = 0; x <= size; ++x ) {
+			result.appendPosition( vec3( x / (float)size, 0, y / (float)size ) );
+			result.appendNormal( vec3( 0, 1, 0 ) );
+			result.appendTexCoord0( vec2( x / (float)size, y / (float)size ) );
+		}
+	}
+	for( int y = 0; y < size; ++y ) {
+		for( int x = 0; x < size; ++x ) {
+			uint32_t i = y * ( size + 1 ) + x;
+			result.appendTriangle( i, i + size + 1, i + 1 );
+			result.appendTriangle( i + 1, i + size + 1, i + size + 2 );
+		}
+	}
+
+	return result;
+}
+
+bool isOnBorder( const vec3 &p )
+{
+	return p.x == 0 || p.x == 1 || p.z == 0 || p.z == 1;
+}
+
+// largest distance of a triangle's centroid from the unit sphere
+float maxSphereDeviation( const TriMesh &mesh )
+{
+	float result = 0;
+	for( size_t t = 0; t < mesh.getNumTriangles(); ++t ) {
+		vec3 a, b, c;
+		mesh.getTriangleVertices( t, &a, &b, &c );
+		result = std::max( result, std::abs( 1 - length( ( a + b + c ) / 3.0f ) ) );
+	}
+
+	return result;
+}
+
+} // anonymous namespace
+
+TEST_CASE( "Simplify" )
+{
+	SECTION( "TriMesh::simplify reduces to the target and keeps attributes" )
+	{
+		const TriMesh sphere( geom::Sphere().subdivisions( 64 ) );
+		set<tuple<float, float, float, float, float>> original;
+		for( size_t v = 0; v < sphere.getNumVertices(); ++v ) {
+			vec3 p = sphere.getPositions<3>()[v];
+			original.emplace( p.x, p.y, p.z, sphere.getTexCoords0<2>()[v].x, sphere.getTexCoords0<2>()[v].y );
+		}
+
+		TriMesh result = sphere;
+		float error = result.simplify( 0.1f, 1.0f );
+		REQUIRE( result.getNumTriangles() <= sphere.getNumTriangles() / 10 );
+		REQUIRE( result.getNumTriangles() > sphere.getNumTriangles() / 20 );
+		REQUIRE( error > 0 );
+		REQUIRE( error < 0.05f );
+		REQUIRE( maxSphereDeviation( result ) < 0.05f );
+
+		// vertices are a subset of the original ones, with matching attributes
+		REQUIRE( result.getNumVertices() < sphere.getNumVertices() );
+		REQUIRE( result.getNormals().size() == result.getNumVertices() );
+		for( size_t v = 0; v < result.getNumVertices(); ++v ) {
+			vec3 p = result.getPositions<3>()[v];
+			REQUIRE( original.count( make_tuple( p.x, p.y, p.z, result.getTexCoords0<2>()[v].x, result.getTexCoords0<2>()[v].y ) ) == 1 );
+		}
+		for( uint32_t index : result.getIndices() )
+			REQUIRE( index < result.getNumVertices() );
+	}
+
+	SECTION( "the error limit stops simplification" )
+	{
+		const TriMesh sphere( geom::Sphere().subdivisions( 64 ) );
+		TriMesh loose = sphere, tight = sphere;
+		float looseError = loose.simplify( 0, 0.05f );
+		float tightError = tight.simplify( 0, 0.005f );
+		REQUIRE( looseError <= 0.05f );
+		REQUIRE( tightError <= 0.005f );
+		REQUIRE( tight.getNumTriangles() > loose.getNumTriangles() );
+		REQUIRE( tight.getNumTriangles() < sphere.getNumTriangles() );
+	}
+
+	SECTION( "borders are kept" )
+	{
+		const TriMesh grid = makeGrid( 16 );
+		vector<uint32_t> indices( grid.getNumIndices() );
+		float error = 1;
+		size_t numIndices = geom::simplify( grid.getNumIndices(), grid.getIndices().data(), grid.getNumVertices(), grid.getPositions<3>(),
+			0, 0.001f, indices.data(), &error );
+		REQUIRE( error == 0 );
+
+		// every interior vertex is gone, and the 64 border vertices fan into one triangle fewer than there are
+		set<uint32_t> referenced( indices.begin(), indices.begin() + numIndices );
+		size_t numBorder = 0;
+		for( uint32_t v = 0; v < grid.getNumVertices(); ++v )
+			numBorder += isOnBorder( grid.getPositions<3>()[v] ) ? 1 : 0;
+		REQUIRE( numBorder == 64 );
+		REQUIRE( referenced.size() == numBorder );
+		for( uint32_t v : referenced )
+			REQUIRE( isOnBorder( grid.getPositions<3>()[v] ) );
+		REQUIRE( numIndices / 3 == numBorder - 2 );
+
+		// the triangles still face up
+		for( size_t i = 0; i < numIndices; i += 3 ) {
+			const vec3 *p = grid.getPositions<3>();
+			REQUIRE( cross( p[indices[i + 1]] - p[indices[i]], p[indices[i + 2]] - p[indices[i]] ).y > 0 );
+		}
+	}
+
+	SECTION( "geom::Simplify" )
+	{
+		float error = -1;
+		TriMesh result( geom::Sphere().subdivisions( 64 ) >> geom::Simplify().targetTriangles( 500 ).targetError( 1.0f ).resultError( &error ) );
+		REQUIRE( result.getNumTriangles() <= 500 );
+		REQUIRE( result.getNumTriangles() > 400 );
+		REQUIRE( result.hasNormals() );
+		REQUIRE( result.hasTexCoords0() );
+		REQUIRE( error > 0 );
+		REQUIRE( maxSphereDeviation( result ) < 0.05f );
+
+		// faces are simplified across the seams between them, without an error, down to the 8 corners
+		TriMesh cube( geom::Cube().subdivisions( 8 ) >> geom::Simplify( 0, 0.001f ) );
+		REQUIRE( cube.getNumTriangles() == 12 );
+	}
+
+	SECTION( "calcLodChain" )
+	{
+		const TriMesh sphere( geom::Sphere().subdivisions( 64 ) );
+		vector<float> errors;
+		auto chain = sphere.calcLodChain( 4, 0.25f, 1.0f, &errors );
+		REQUIRE( chain.size() == 4 );
+		REQUIRE( errors.size() == 4 );
+		REQUIRE( errors[0] == 0 );
+		REQUIRE( chain[0] == sphere.getIndices() );
+		for( size_t level = 1; level < chain.size(); ++level ) {
+			REQUIRE( chain[level].size() % 3 == 0 );
+			REQUIRE( chain[level].size() / 3 <= chain[level - 1].size() / 3 / 4 );
+			REQUIRE( errors[level] >= errors[level - 1] );
+			REQUIRE( *max_element( chain[level].begin(), chain[level].end() ) < sphere.getNumVertices() );
+		}
+	}
+
+	SECTION( "results don't depend on the number of threads" )
+	{
+		const TriMesh torus( geom::Torus().subdivisionsAxis( 128 ).subdivisionsHeight( 64 ) );
+		const size_t maxThreads = ip::getMaxThreads();
+		auto run = [&]( size_t numThreads ) {
+			ip::setMaxThreads( numThreads );
+			TriMesh result = torus;
+			result.simplify( 0.05f, 1.0f );
+			return result;
+		};
+
+		TriMesh single = run( 1 );
+		TriMesh multi = run( 4 );
+		ip::setMaxThreads( maxThreads );
+		REQUIRE( single.getIndices() == multi.getIndices() );
+		REQUIRE( single.getBufferPositions() == multi.getBufferPositions() );
+	}
+}
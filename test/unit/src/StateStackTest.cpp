@@ -0,0 +1,73 @@
+#include "catch.hpp"
+#include "cinder/gl/StateStack.h"
+
+using namespace cinder;
+using namespace std;
+
+TEST_CASE( "gl/StateStack" )
+{
+	SECTION( "pushes and pops past the inline capacity" )
+	{
+		gl::StateStack<int,4> stack;
+		REQUIRE( stack.empty() );
+		for( int i = 0; i < 11; ++i ) {
+			stack.push_back( i );
+			REQUIRE( stack.back() == i );
+		}
+		REQUIRE( stack.size() == 11 );
+
+		for( int i = 10; i >= 0; --i ) {
+			REQUIRE( stack.back() == i );
+			stack.pop_back();
+		}
+		REQUIRE( stack.empty() );
+
+		// the overflow storage is reused rather than appended to
+		for( int i = 0; i < 7; ++i )
+			stack.push_back( -i );
+		REQUIRE( stack.back() == -6 );
+		stack.back() = 42;
+		stack.pop_back();
+		stack.push_back( 7 );
+		REQUIRE( stack.back() == 7 );
+		REQUIRE( stack.size() == 7 );
+
+		stack.clear();
+		REQUIRE( stack.empty() );
+	}
+
+	SECTION( "keyed stacks are independent and stable" )
+	{
+		gl::KeyedStateStacks<GLint,gl::NUM_BUFFER_TARGETS,gl::bufferTargetIndex> stacks;
+		stacks[GL_ARRAY_BUFFER].push_back( 1 );
+		stacks[GL_ELEMENT_ARRAY_BUFFER].push_back( 2 );
+		REQUIRE( stacks[GL_ARRAY_BUFFER].back() == 1 );
+		REQUIRE( stacks[GL_ELEMENT_ARRAY_BUFFER].back() == 2 );
+
+		// keys without a compact index fall back to the overflow list
+		const GLenum unknownA = 0x1234, unknownB = 0x5678;
+		REQUIRE( gl::bufferTargetIndex( unknownA ) == -1 );
+		auto &a = stacks[unknownA];
+		a.push_back( 3 );
+		stacks[unknownB].push_back( 4 );
+		REQUIRE( &stacks[unknownA] == &a );
+		REQUIRE( a.back() == 3 );
+		REQUIRE( stacks[unknownB].back() == 4 );
+		REQUIRE( stacks[GL_ARRAY_BUFFER].size() == 1 );
+	}
+
+	SECTION( "compact indices are unique" )
+	{
+		vector<bool> seen( gl::NUM_CAPABILITIES, false );
+		for( GLenum cap : { GL_BLEND, GL_CULL_FACE, GL_DEPTH_TEST, GL_DEPTH_WRITEMASK, GL_SCISSOR_TEST, GL_STENCIL_TEST, GL_DITHER, GL_POLYGON_OFFSET_FILL } ) {
+			int index = gl::capabilityIndex( cap );
+			REQUIRE( index >= 0 );
+			REQUIRE( index < (int)gl::NUM_CAPABILITIES );
+			REQUIRE( ! seen[index] );
+			seen[index] = true;
+		}
+
+		REQUIRE( gl::textureTargetIndex( GL_TEXTURE_2D ) != gl::textureTargetIndex( GL_TEXTURE_CUBE_MAP ) );
+		REQUIRE( gl::textureTargetIndex( GL_ARRAY_BUFFER ) == -1 );
+	}
+}
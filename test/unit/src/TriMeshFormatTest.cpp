@@ -0,0 +1,191 @@
+#include "catch.hpp"
+#include "cinder/TriMesh.h"
+#include "cinder/DataSource.h"
+#include "cinder/DataTarget.h"
+#include "cinder/Exception.h"
+
+#include <fstream>
+
+using namespace cinder;
+using namespace std;
+
+namespace {
+
+fs::path tempPath( const string &name )
+{
+	return fs::temp_directory_path() / ( "TriMeshFormatTest_" + name );
+}
+
+TriMesh writeAndRead( const TriMesh &mesh, const fs::path &path, const TriMesh::WriteOptions &options )
+{
+	mesh.write( writeFile( path ), options );
+	TriMesh result;
+	result.read( loadFile( path ) );
+	return result;
+}
+
+// in double precision, since a float acos() of nearly parallel vectors is off by more than the quantization error
+double maxAngleDegrees( const vector<vec3> &a, const vector<vec3> &b )
+{
+	double result = 0;
+	for( size_t i = 0; i < a.size(); ++i ) {
+		const dvec3 u = normalize( dvec3( a[i] ) ), v = normalize( dvec3( b[i] ) );
+		result = std::max( result, glm::degrees( std::atan2( length( cross( u, v ) ), dot( u, v ) ) ) );
+	}
+
+	return result;
+}
+
+} // anonymous namespace
+
+TEST_CASE( "TriMeshFormat" )
+{
+	const TriMesh mesh( geom::Teapot().subdivisions( 12 ), TriMesh::Format().positions().normals().texCoords0( 2 ).tangents() );
+	REQUIRE( mesh.getNumVertices() > 0 );
+	REQUIRE( mesh.hasTangents() );
+
+	SECTION( "version 2 still round trips" )
+	{
+		const fs::path path = tempPath( "v2.msh" );
+		mesh.write( writeFile( path ) );
+		TriMesh result;
+		result.read( loadFile( path ) );
+		REQUIRE( result.getBufferPositions() == mesh.getBufferPositions() );
+		REQUIRE( result.getNormals() == mesh.getNormals() );
+		REQUIRE( result.getIndices() == mesh.getIndices() );
+		fs::remove( path );
+	}
+
+	SECTION( "version 3 without quantization is exact" )
+	{
+		const fs::path path = tempPath( "v3.msh" );
+		TriMesh result = writeAndRead( mesh, path, TriMesh::WriteOptions() );
+		REQUIRE( result.getBufferPositions() == mesh.getBufferPositions() );
+		REQUIRE( result.getNormals() == mesh.getNormals() );
+		REQUIRE( result.getTangents() == mesh.getTangents() );
+		REQUIRE( result.getBufferTexCoords0() == mesh.getBufferTexCoords0() );
+		REQUIRE( result.getIndices() == mesh.getIndices() );
+
+		// blocks are aligned for mapping
+		MappedTriMesh mapped( loadFile( path ) );
+		REQUIRE( mapped.getFileSize() == fs::file_size( path ) );
+		REQUIRE( reinterpret_cast<uintptr_t>( mapped.getAttribData( geom::POSITION ) ) % 64 == 0 );
+		REQUIRE( mapped.getIndexData() != nullptr );
+		fs::remove( path );
+	}
+
+	SECTION( "quantization stays within its bounds" )
+	{
+		const fs::path path = tempPath( "v3q.msh" );
+		TriMesh result = writeAndRead( mesh, path, TriMesh::WriteOptions().quantize() );
+
+		AxisAlignedBox bounds = mesh.calcBoundingBox();
+		const vec3 tolerance = bounds.getSize() / 131070.0f * 1.01f;
+		for( size_t v = 0; v < mesh.getNumVertices(); ++v ) {
+			const vec3 delta = abs( result.getPositions<3>()[v] - mesh.getPositions<3>()[v] );
+			REQUIRE( all( lessThanEqual( delta, tolerance ) ) );
+		}
+
+		REQUIRE( maxAngleDegrees( result.getNormals(), mesh.getNormals() ) < 0.01 );
+		REQUIRE( maxAngleDegrees( result.getTangents(), mesh.getTangents() ) < 0.01 );
+
+		for( size_t i = 0; i < mesh.getBufferTexCoords0().size(); ++i ) {
+			const float expected = mesh.getBufferTexCoords0()[i];
+			REQUIRE( std::abs( result.getBufferTexCoords0()[i] - expected ) <= std::abs( expected ) / 2048.0f + 1e-7f );
+		}
+
+		REQUIRE( result.getIndices() == mesh.getIndices() );
+		fs::remove( path );
+	}
+
+	SECTION( "compressed indices are exact and smaller" )
+	{
+		TriMesh big( geom::Torus().subdivisionsAxis( 512 ).subdivisionsHeight( 256 ) );
+		const fs::path path = tempPath( "v3c.msh" );
+		TriMesh result = writeAndRead( big, path, TriMesh::WriteOptions().attribs( { geom::POSITION } ).compressIndices() );
+		REQUIRE( result.getIndices() == big.getIndices() );
+
+		MappedTriMesh mapped( loadFile( path ) );
+		REQUIRE( mapped.getIndexData() == nullptr );
+		REQUIRE( mapped.getFileSize() < big.getNumVertices() * sizeof( vec3 ) + big.getNumIndices() * 2 );
+		fs::remove( path );
+	}
+
+	SECTION( "MappedTriMesh from a file and from a buffer" )
+	{
+		const fs::path path = tempPath( "v3m.msh" );
+		mesh.write( writeFile( path ), TriMesh::WriteOptions().quantizeNormals().compressIndices() );
+
+		MappedTriMesh fromFile( loadFile( path ) );
+		MappedTriMesh fromBuffer( DataSourceBuffer::create( loadFile( path )->getBuffer() ) );
+		for( const MappedTriMesh *mapped : { &fromFile, &fromBuffer } ) {
+			REQUIRE( mapped->getNumVertices() == mesh.getNumVertices() );
+			REQUIRE( mapped->getNumIndices() == mesh.getNumIndices() );
+			REQUIRE( mapped->getAvailableAttribs() == geom::AttribSet( { geom::POSITION, geom::NORMAL, geom::TANGENT, geom::TEX_COORD_0 } ) );
+			REQUIRE( mapped->getAttribDims( geom::TEX_COORD_0 ) == 2 );
+			REQUIRE( mapped->getAttribDims( geom::COLOR ) == 0 );
+			REQUIRE( mapped->getAttribData( geom::NORMAL ) == nullptr );
+			REQUIRE( equal( mesh.getBufferPositions().begin(), mesh.getBufferPositions().end(), mapped->getAttribData( geom::POSITION ) ) );
+
+			vector<uint32_t> indices( mapped->getNumIndices() );
+			mapped->decodeIndices( indices.data() );
+			REQUIRE( indices == mesh.getIndices() );
+
+			// as a geom::Source
+			TriMesh loaded( *mapped, TriMesh::Format().positions().normals() );
+			REQUIRE( loaded.getBufferPositions() == mesh.getBufferPositions() );
+			REQUIRE( maxAngleDegrees( loaded.getNormals(), mesh.getNormals() ) < 0.01 );
+			REQUIRE( loaded.getIndices() == mesh.getIndices() );
+			REQUIRE( ! loaded.hasTexCoords0() );
+		}
+		fs::remove( path );
+	}
+
+	SECTION( "the attribs mask limits what is written" )
+	{
+		const fs::path path = tempPath( "v3a.msh" );
+		TriMesh result = writeAndRead( mesh, path, TriMesh::WriteOptions().attribs( { geom::POSITION, geom::TEX_COORD_0 } ) );
+		REQUIRE( result.getBufferPositions() == mesh.getBufferPositions() );
+		REQUIRE( result.getBufferTexCoords0() == mesh.getBufferTexCoords0() );
+		REQUIRE( ! result.hasNormals() );
+		REQUIRE( ! result.hasTangents() );
+		fs::remove( path );
+	}
+
+	SECTION( "invalid files throw" )
+	{
+		const fs::path path = tempPath( "v3t.msh" );
+		mesh.write( writeFile( path ), TriMesh::WriteOptions().compressIndices() );
+		BufferRef buffer = loadFile( path )->getBuffer();
+		fs::remove( path );
+
+		BufferRef truncated = Buffer::create( buffer->getSize() / 2 );
+		memcpy( truncated->getData(), buffer->getData(), truncated->getSize() );
+		REQUIRE_THROWS_AS( MappedTriMesh( DataSourceBuffer::create( truncated ) ), cinder::Exception );
+		TriMesh readTruncated;
+		REQUIRE_THROWS_AS( readTruncated.read( DataSourceBuffer::create( truncated ) ), cinder::Exception );
+
+		BufferRef wrongVersion = Buffer::create( buffer->getSize() );
+		memcpy( wrongVersion->getData(), buffer->getData(), buffer->getSize() );
+		static_cast<uint8_t*>( wrongVersion->getData() )[0] = 7;
+		REQUIRE_THROWS_AS( MappedTriMesh( DataSourceBuffer::create( wrongVersion ) ), cinder::Exception );
+		TriMesh readWrongVersion;
+		REQUIRE_THROWS( readWrongVersion.read( DataSourceBuffer::create( wrongVersion ) ) );
+	}
+
+	SECTION( "indices out of range throw" )
+	{
+		TriMesh corrupt( TriMesh::Format().positions() );
+		corrupt.appendPositions( mesh.getPositions<3>(), 3 );
+		corrupt.appendTriangle( 0, 1, 3 );
+
+		const fs::path path = tempPath( "v3r.msh" );
+		for( const auto &options : { TriMesh::WriteOptions(), TriMesh::WriteOptions().compressIndices() } ) {
+			corrupt.write( writeFile( path ), options );
+			TriMesh result;
+			REQUIRE_THROWS_AS( result.read( loadFile( path ) ), cinder::Exception );
+			REQUIRE_THROWS_AS( TriMesh( MappedTriMesh( loadFile( path ) ) ), cinder::Exception );
+		}
+		fs::remove( path );
+	}
+}
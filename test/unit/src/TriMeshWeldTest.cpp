@@ -0,0 +1,163 @@
+#include "catch.hpp"
+#include "cinder/TriMesh.h"
+#include "cinder/ip/Parallel.h"
+#include "cinder/Rand.h"
+
+#include <algorithm>
+#include <cstring>
+#include <random>
+
+using namespace cinder;
+using namespace std;
+
+namespace {
+
+// the O(n^2) definition calculateWeldRemap() follows: the lowest-indexed match, with chains of matches resolved to their start
+vector<uint32_t> bruteForceRemap( const vector<vec3> &positions, float epsilon )
+{
+	vector<uint32_t> result( positions.size() );
+	for( size_t v = 0; v < positions.size(); ++v ) {
+		result[v] = (uint32_t)v;
+		for( size_t c = 0; c < v; ++c ) {
+			if( length2( positions[c] - positions[v] ) <= epsilon * epsilon ) {
+				result[v] = (uint32_t)c;
+				break;
+			}
+		}
+		result[v] = result[result[v]];
+	}
+
+	return result;
+}
+
+} // anonymous namespace
+
+TEST_CASE( "TriMeshWeld" )
+{
+	SECTION( "calculateWeldRemap matches brute force" )
+	{
+		// clusters of nearby points, so that most cells see several candidates and some chains form
+		Rand rnd( 17 );
+		vector<vec3> positions;
+		for( int cluster = 0; cluster < 200; ++cluster ) {
+			vec3 center = rnd.nextVec3() * 10.0f;
+			for( int i = 0; i < 10; ++i )
+				positions.push_back( center + rnd.nextVec3() * rnd.nextFloat( 0, 0.02f ) );
+		}
+		std::shuffle( positions.begin(), positions.end(), std::mt19937( 17 ) );
+
+		for( float epsilon : { 0.0f, 0.001f, 0.01f, 0.05f } ) {
+			vector<uint32_t> remap;
+			size_t numUnique = geom::calculateWeldRemap( positions.size(), positions.data(), epsilon, &remap );
+			auto expected = bruteForceRemap( positions, epsilon );
+			REQUIRE( remap == expected );
+			size_t numExpected = 0;
+			for( size_t v = 0; v < expected.size(); ++v )
+				numExpected += ( expected[v] == v ) ? 1 : 0;
+			REQUIRE( numUnique == numExpected );
+		}
+	}
+
+	SECTION( "exact weld treats -0 and +0 alike" )
+	{
+		vector<vec3> positions = { vec3( 0, 1, 2 ), vec3( -0.0f, 1, 2 ), vec3( 0, 1, 2.0001f ) };
+		vector<uint32_t> remap;
+		REQUIRE( geom::calculateWeldRemap( positions.size(), positions.data(), 0, &remap ) == 2 );
+		REQUIRE( remap == vector<uint32_t>( { 0, 0, 2 } ) );
+	}
+
+	SECTION( "TriMesh::weld" )
+	{
+		TriMesh cube = TriMesh( geom::Cube() );
+		REQUIRE( cube.getNumVertices() == 24 );
+
+		// every corner is shared by 3 faces with distinct normals and texture coordinates
+		TriMesh attribs = cube;
+		attribs.weld();
+		REQUIRE( attribs.getNumVertices() == 24 );
+
+		TriMesh positions = cube;
+		positions.weld( 0, true );
+		REQUIRE( positions.getNumVertices() == 8 );
+		REQUIRE( positions.getNumIndices() == cube.getNumIndices() );
+		REQUIRE( positions.getNormals().size() == 8 );
+		REQUIRE( positions.getBufferTexCoords0().size() == 8 * 2 );
+		for( size_t i = 0; i < cube.getNumIndices(); ++i )
+			REQUIRE( positions.getPositions<3>()[positions.getIndices()[i]] == cube.getPositions<3>()[cube.getIndices()[i]] );
+	}
+
+	SECTION( "TriMesh::weld on a non-indexed mesh" )
+	{
+		// two triangles sharing an edge, drawn without indices
+		const vector<vec3> soup = { vec3( 0, 0, 0 ), vec3( 1, 0, 0 ), vec3( 0, 1, 0 ), vec3( 1, 0, 0 ), vec3( 1, 1, 0 ), vec3( 0, 1, 0 ) };
+		TriMesh mesh( TriMesh::Format().positions() );
+		for( const vec3 &position : soup )
+			mesh.appendPosition( position );
+		REQUIRE( mesh.getNumIndices() == 0 );
+
+		mesh.weld( 0, true );
+		REQUIRE( mesh.getNumVertices() == 4 );
+		REQUIRE( mesh.getNumIndices() == soup.size() );
+		for( size_t i = 0; i < soup.size(); ++i )
+			REQUIRE( mesh.getPositions<3>()[mesh.getIndices()[i]] == soup[i] );
+	}
+
+	SECTION( "geom::Weld" )
+	{
+		TriMesh attribs( geom::Cube() >> geom::Weld() );
+		REQUIRE( attribs.getNumVertices() == 24 );
+
+		TriMesh positions( geom::Cube() >> geom::Weld( 0.001f ).positionsOnly() );
+		REQUIRE( positions.getNumVertices() == 8 );
+		REQUIRE( positions.getNumIndices() == 36 );
+	}
+
+	SECTION( "angle weighted normals don't depend on tessellation" )
+	{
+		TriMesh cube = TriMesh( geom::Cube() );
+		REQUIRE( cube.recalculateNormals( geom::NormalWeighting::ANGLE, true ) );
+		for( size_t v = 0; v < cube.getNumVertices(); ++v ) {
+			vec3 expected = normalize( sign( cube.getPositions<3>()[v] ) );
+			REQUIRE( length( cube.getNormals()[v] - expected ) < 1e-5f );
+		}
+
+		// flat normals are the face normals the cube was generated with
+		const TriMesh reference = TriMesh( geom::Cube() );
+		REQUIRE( cube.recalculateNormals( false, false ) );
+		for( size_t v = 0; v < cube.getNumVertices(); ++v )
+			REQUIRE( length( cube.getNormals()[v] - reference.getNormals()[v] ) < 1e-5f );
+	}
+
+	SECTION( "results don't depend on the number of threads" )
+	{
+		// enough triangles that several threads gather rather than scatter
+		TriMesh sphere( geom::Sphere().subdivisions( 160 ) );
+		const size_t maxThreads = ip::getMaxThreads();
+		auto run = [&]( size_t numThreads ) {
+			ip::setMaxThreads( numThreads );
+			TriMesh result = sphere;
+			result.recalculateNormals( geom::NormalWeighting::AREA, true );
+			result.recalculateTangents();
+			result.recalculateBitangents();
+			return result;
+		};
+
+		TriMesh single = run( 1 );
+		TriMesh multi = run( 4 );
+		ip::setMaxThreads( maxThreads );
+
+		// compared bitwise, as the bitangents at the poles, where the tangents vanish, are NaN
+		auto bitwiseEqual = []( const vector<vec3> &a, const vector<vec3> &b ) {
+			return ( a.size() == b.size() ) && ( memcmp( a.data(), b.data(), a.size() * sizeof( vec3 ) ) == 0 );
+		};
+		REQUIRE( bitwiseEqual( single.getNormals(), multi.getNormals() ) );
+		REQUIRE( bitwiseEqual( single.getTangents(), multi.getTangents() ) );
+		REQUIRE( bitwiseEqual( single.getBitangents(), multi.getBitangents() ) );
+
+		// the seam is smoothed, so normals point away from the center
+		for( size_t v = 0; v < single.getNumVertices(); ++v ) {
+			REQUIRE( dot( single.getNormals()[v], normalize( single.getPositions<3>()[v] ) ) > 0.999f );
+			REQUIRE( std::abs( dot( single.getNormals()[v], single.getTangents()[v] ) ) < 1e-4f );
+		}
+	}
+}
@@ -0,0 +1,151 @@
+#include "catch.hpp"
+#include "cinder/TriMesh.h"
+
+#include <algorithm>
+#include <array>
+#include <random>
+
+using namespace cinder;
+using namespace std;
+
+namespace {
+
+// a grid of quads with its triangles shuffled, as a loader might emit them
+TriMesh makeShuffledGrid( int size )
+{
+	TriMesh result( TriMesh::Format().positions().texCoords0( 2 ) );
+	for( int y = 0; y <= size; ++y ) {
+		for( int x = 0; x <= size; ++x ) {
+			// a bump, so that clusters face different ways
+			vec2 p( x / (float)size - 0.5f, y / (float)size - 0.5f );
+			result.appendPosition( vec3( p.x, 0.3f * cos( p.x * 3 ) * cos( p.y * 3 ), p.y ) );
+			result.appendTexCoord0( p );
+		}
+	}
+
+	vector<array<uint32_t, 3>> triangles;
+	for( int y = 0; y < size; ++y ) {
+		for( int x = 0; x < size; ++x ) {
+			uint32_t i = y * ( size + 1 ) + x;
+			triangles.push_back( { i, i + size + 1, i + 1 } );
+			triangles.push_back( { i + 1, i + size + 1, i + size + 2 } );
+		}
+	}
+	std::shuffle( triangles.begin(), triangles.end(), std::mt19937( 5 ) );
+	for( const auto &tri : triangles )
+		result.appendTriangle( tri[0], tri[1], tri[2] );
+
+	return result;
+}
+
+// the triangles of 'mesh' by position, each rotated to start at its smallest corner so that winding is preserved, in sorted order
+vector<array<float, 9>> canonicalTriangles( const TriMesh &mesh )
+{
+	vector<array<float, 9>> result;
+	const vec3 *positions = mesh.getPositions<3>();
+	for( size_t t = 0; t < mesh.getNumTriangles(); ++t ) {
+		array<vec3, 3> corners;
+		for( int k = 0; k < 3; ++k )
+			corners[k] = positions[mesh.getIndices()[t * 3 + k]];
+		auto less = []( const vec3 &a, const vec3 &b ) { return std::tie( a.x, a.y, a.z ) < std::tie( b.x, b.y, b.z ); };
+		std::rotate( corners.begin(), std::min_element( corners.begin(), corners.end(), less ), corners.end() );
+		array<float, 9> tri;
+		for( int k = 0; k < 3; ++k )
+			for( int c = 0; c < 3; ++c )
+				tri[k * 3 + c] = corners[k][c];
+		result.push_back( tri );
+	}
+	std::sort( result.begin(), result.end() );
+	return result;
+}
+
+} // anonymous namespace
+
+TEST_CASE( "VertexCache" )
+{
+	SECTION( "calculateVertexCacheStats" )
+	{
+		const uint32_t single[] = { 0, 1, 2 };
+		auto stats = geom::calculateVertexCacheStats( 3, single, 3 );
+		REQUIRE( stats.mAcmr == 3 );
+		REQUIRE( stats.mAtvr == 1 );
+
+		// a cache of 3 keeps the edge shared by the first two triangles, then the third flushes it
+		const uint32_t quads[] = { 0, 1, 2, 2, 1, 3, 4, 5, 6, 0, 1, 2 };
+		stats = geom::calculateVertexCacheStats( 12, quads, 7, 3 );
+		REQUIRE( stats.mAcmr == Approx( 10 / 4.0f ) );
+		REQUIRE( stats.mAtvr == Approx( 10 / 7.0f ) );
+	}
+
+	SECTION( "optimizeVertexCache keeps the triangles and lowers the ACMR" )
+	{
+		TriMesh grid = makeShuffledGrid( 64 );
+		const auto expected = canonicalTriangles( grid );
+		auto before = geom::calculateVertexCacheStats( grid.getNumIndices(), grid.getIndices().data(), grid.getNumVertices() );
+
+		TriMesh optimized = grid;
+		geom::optimizeVertexCache( optimized.getNumIndices(), optimized.getIndices().data(), optimized.getNumVertices(), optimized.getIndices().data() );
+		auto after = geom::calculateVertexCacheStats( optimized.getNumIndices(), optimized.getIndices().data(), optimized.getNumVertices() );
+		REQUIRE( canonicalTriangles( optimized ) == expected );
+		REQUIRE( before.mAcmr > 2.5f );
+		REQUIRE( after.mAcmr < 0.8f );
+		REQUIRE( after.mAtvr < 1.5f );
+	}
+
+	SECTION( "optimizeOverdraw stays near the threshold" )
+	{
+		TriMesh grid = makeShuffledGrid( 64 );
+		auto &indices = grid.getIndices();
+		geom::optimizeVertexCache( indices.size(), indices.data(), grid.getNumVertices(), indices.data() );
+		const auto expected = canonicalTriangles( grid );
+		auto cacheOptimized = geom::calculateVertexCacheStats( indices.size(), indices.data(), grid.getNumVertices() );
+
+		geom::optimizeOverdraw( indices.size(), indices.data(), grid.getNumVertices(), grid.getPositions<3>(), indices.data(), 16, 1.05f );
+		auto after = geom::calculateVertexCacheStats( indices.size(), indices.data(), grid.getNumVertices() );
+		REQUIRE( canonicalTriangles( grid ) == expected );
+		// the threshold applies to each cluster as simulated from a cold cache, so it bounds the whole only loosely
+		REQUIRE( after.mAcmr <= cacheOptimized.mAcmr * 1.1f );
+	}
+
+	SECTION( "geom::Optimize and TriMesh::optimize" )
+	{
+		TriMesh grid = makeShuffledGrid( 32 );
+		const auto expected = canonicalTriangles( grid );
+
+		geom::VertexCacheStats before, after;
+		TriMesh optimized( grid >> geom::Optimize().stats( &before, &after ) );
+		REQUIRE( optimized.getNumIndices() == grid.getNumIndices() );
+		REQUIRE( canonicalTriangles( optimized ) == expected );
+		REQUIRE( after.mAcmr < before.mAcmr * 0.5f );
+		auto measured = geom::calculateVertexCacheStats( optimized.getNumIndices(), optimized.getIndices().data(), optimized.getNumVertices() );
+		REQUIRE( measured.mAcmr == after.mAcmr );
+
+		// vertices are in order of first use, and carry their texture coordinates along
+		uint32_t next = 0;
+		for( uint32_t index : optimized.getIndices() ) {
+			REQUIRE( index <= next );
+			next = std::max( next, index + 1 );
+		}
+		for( size_t v = 0; v < optimized.getNumVertices(); ++v ) {
+			const vec3 &p = optimized.getPositions<3>()[v];
+			REQUIRE( optimized.getTexCoords0<2>()[v] == vec2( p.x, p.z ) );
+		}
+
+		TriMesh inPlace = grid;
+		inPlace.optimize();
+		REQUIRE( inPlace.getIndices() == optimized.getIndices() );
+		REQUIRE( inPlace.getBufferPositions() == optimized.getBufferPositions() );
+		REQUIRE( inPlace.getBufferTexCoords0() == optimized.getBufferTexCoords0() );
+	}
+
+	SECTION( "non-indexed triangles become indexed" )
+	{
+		TriMesh soup( TriMesh::Format().positions() );
+		for( int i = 0; i < 6; ++i )
+			soup.appendPosition( vec3( i % 2, i / 2, 0 ) );
+
+		TriMesh optimized( soup >> geom::Optimize() );
+		REQUIRE( optimized.getNumVertices() == 6 );
+		REQUIRE( optimized.getIndices() == vector<uint32_t>( { 0, 1, 2, 3, 4, 5 } ) );
+	}
+}
@@ -0,0 +1,86 @@
+#include "catch.hpp"
+
+#include "cinder/audio/dsp/CommandQueue.h"
+
+#include <memory>
+#include <thread>
+#include <vector>
+
+using namespace std;
+using namespace cinder::audio;
+
+TEST_CASE( "audio/CommandQueue" )
+{
+
+SECTION( "commands are processed in order" )
+{
+	dsp::CommandQueue queue( 16 );
+	vector<int> result;
+	for( int i = 0; i < 10; i++ )
+		REQUIRE( queue.push( [&result, i] { result.push_back( i ); } ) );
+
+	REQUIRE( result.empty() );
+	REQUIRE( queue.process() == 10 );
+	REQUIRE( result.size() == 10 );
+	for( int i = 0; i < 10; i++ )
+		REQUIRE( result[i] == i );
+
+	REQUIRE( queue.process() == 0 );
+}
+
+SECTION( "push fails when full" )
+{
+	dsp::CommandQueue queue( 4 );
+	REQUIRE( queue.getCapacity() == 4 );
+
+	for( int i = 0; i < 4; i++ )
+		REQUIRE( queue.push( [] {} ) );
+
+	REQUIRE( ! queue.push( [] {} ) );
+	queue.process();
+	REQUIRE( queue.push( [] {} ) );
+}
+
+SECTION( "captures are released by the producer" )
+{
+	dsp::CommandQueue queue( 4 );
+	auto captured = make_shared<int>( 0 );
+	weak_ptr<int> weak = captured;
+
+	queue.push( [captured] { (*captured)++; } );
+	captured.reset();
+
+	queue.process();
+	REQUIRE( ! weak.expired() );
+
+	queue.collect();
+	REQUIRE( weak.expired() );
+}
+
+SECTION( "concurrent producer and consumer" )
+{
+	const int numCommands = 10000;
+	dsp::CommandQueue queue( 64 );
+	vector<int> result;
+	result.reserve( numCommands );
+
+	thread producer( [&] {
+		for( int i = 0; i < numCommands; i++ ) {
+			while( ! queue.push( [&result, i] { result.push_back( i ); } ) )
+				this_thread::yield();
+		}
+	} );
+
+	while( result.size() < (size_t)numCommands )
+		queue.process();
+
+	producer.join();
+
+	bool inOrder = true;
+	for( int i = 0; i < numCommands; i++ )
+		inOrder &= ( result[i] == i );
+
+	REQUIRE( inOrder );
+}
+
+} // "audio/CommandQueue"
@@ -0,0 +1,206 @@
+#include "catch.hpp"
+
+#include "cinder/audio/ContextOffline.h"
+#include "cinder/audio/GainNode.h"
+#include "cinder/audio/Target.h"
+#include "cinder/audio/Utilities.h"
+#include "cinder/Filesystem.h"
+
+using namespace std;
+using namespace ci::audio;
+
+namespace {
+
+// Writes a constant value within the scheduled process range, so that the first processed frame can be located exactly.
+class ConstantNode : public Node {
+  public:
+	ConstantNode( float value ) : Node( Format().channels( 1 ).autoEnable( false ) ), mValue( value )	{}
+
+  protected:
+	void process( Buffer *buffer ) override
+	{
+		const auto &range = getProcessFramesRange();
+		for( size_t ch = 0; ch < buffer->getNumChannels(); ch++ ) {
+			float *channel = buffer->getChannel( ch );
+			for( size_t i = range.first; i < range.second; i++ )
+				channel[i] = mValue;
+		}
+	}
+
+	float mValue;
+};
+
+// Writes the index of each frame processed by the Context, so that gaps and repeats in the output are visible.
+class FrameIndexNode : public Node {
+  public:
+	FrameIndexNode() : Node( Format().channels( 1 ) )	{}
+
+  protected:
+	void process( Buffer *buffer ) override
+	{
+		const float firstFrame = (float)getContext()->getNumProcessedFrames();
+		float *channel = buffer->getChannel( 0 );
+		for( size_t i = 0; i < buffer->getNumFrames(); i++ )
+			channel[i] = firstFrame + (float)i;
+	}
+};
+
+// Collects the first channel of everything written to it.
+class CaptureTargetFile : public TargetFile {
+  public:
+	CaptureTargetFile( size_t sampleRate ) : TargetFile( sampleRate, 1, SampleType::FLOAT_32 )	{}
+
+	vector<float> mFrames;
+
+  protected:
+	void performWrite( const Buffer *buffer, size_t numFrames, size_t frameOffset ) override
+	{
+		const float *channel = buffer->getChannel( 0 ) + frameOffset;
+		mFrames.insert( mFrames.end(), channel, channel + numFrames );
+	}
+};
+
+const size_t SAMPLE_RATE		= 44100;
+const size_t FRAMES_PER_BLOCK	= 256;
+
+ContextOfflineRef makeContext( size_t numChannels )
+{
+	auto format = OutputOfflineNode::Format().sampleRate( SAMPLE_RATE ).framesPerBlock( FRAMES_PER_BLOCK ).channels( numChannels );
+	return make_shared<ContextOffline>( format );
+}
+
+} // anonymous namespace
+
+TEST_CASE( "audio/ContextOffline" )
+{
+
+SECTION( "renders requested frames" )
+{
+	auto ctx = makeContext( 1 );
+	auto constant = ctx->makeNode( new ConstantNode( 0.5f ) );
+	constant >> ctx->getOutput();
+	constant->enable();
+	ctx->enable();
+
+	auto output = ctx->getOutputOffline();
+	REQUIRE( output );
+	REQUIRE( ctx->getFramesPerBlock() == FRAMES_PER_BLOCK );
+
+	uint64_t numRendered = output->renderFrames( 1000 );
+	REQUIRE( numRendered == 1000 );
+	REQUIRE( output->getNumRenderedFrames() == 1000 );
+	REQUIRE( ctx->getNumProcessedFrames() == 4 * FRAMES_PER_BLOCK ); // whole blocks are processed
+
+	const Buffer *rendered = output->renderBlock();
+	REQUIRE( rendered );
+	for( size_t i = 0; i < FRAMES_PER_BLOCK; i++ )
+		REQUIRE( rendered->getChannel( 0 )[i] == 0.5f );
+}
+
+SECTION( "consecutive renders are continuous" )
+{
+	auto ctx = makeContext( 1 );
+	auto frameIndex = ctx->makeNode( new FrameIndexNode );
+	frameIndex >> ctx->getOutput();
+	ctx->enable();
+
+	auto target = make_shared<CaptureTargetFile>( SAMPLE_RATE );
+	auto output = ctx->getOutputOffline();
+	output->setTargetFile( target );
+
+	// partial blocks, a part of the leftover frames, then whole blocks that first flush the rest of them
+	REQUIRE( output->renderSeconds( 0.5 ) == SAMPLE_RATE / 2 );
+	REQUIRE( output->renderSeconds( 0.5 ) == SAMPLE_RATE / 2 );
+	REQUIRE( output->renderFrames( 10 ) == 10 );
+	REQUIRE( output->renderBlock() );
+	REQUIRE( output->renderFrames( 3 * FRAMES_PER_BLOCK + 7 ) == 3 * FRAMES_PER_BLOCK + 7 );
+	output->setTargetFile( nullptr );
+
+	REQUIRE( output->getNumRenderedFrames() == target->mFrames.size() );
+	REQUIRE( ctx->getNumProcessedFrames() - output->getNumRenderedFrames() < FRAMES_PER_BLOCK );
+	for( size_t i = 0; i < target->mFrames.size(); i++ )
+		REQUIRE( target->mFrames[i] == (float)i );
+}
+
+SECTION( "disabled context renders nothing" )
+{
+	auto ctx = makeContext( 1 );
+	auto constant = ctx->makeNode( new ConstantNode( 1 ) );
+	constant >> ctx->getOutput();
+
+	REQUIRE( ctx->getOutputOffline()->renderBlock() == nullptr );
+	REQUIRE( ctx->getOutputOffline()->renderFrames( FRAMES_PER_BLOCK ) == 0 );
+}
+
+SECTION( "scheduled event is sample accurate" )
+{
+	auto ctx = makeContext( 1 );
+	auto constant = ctx->makeNode( new ConstantNode( 1 ) );
+	constant >> ctx->getOutput();
+	ctx->enable();
+
+	const uint64_t enableFrame = 1000;
+	constant->enable( (double)enableFrame / (double)SAMPLE_RATE );
+	REQUIRE( timeToFrame( (double)enableFrame / (double)SAMPLE_RATE, (double)SAMPLE_RATE ) == enableFrame );
+
+	auto output = ctx->getOutputOffline();
+	for( uint64_t blockStart = 0; blockStart < 2048; blockStart += FRAMES_PER_BLOCK ) {
+		const float *rendered = output->renderBlock()->getChannel( 0 );
+		for( size_t i = 0; i < FRAMES_PER_BLOCK; i++ ) {
+			float expected = blockStart + i < enableFrame ? 0.0f : 1.0f;
+			REQUIRE( rendered[i] == expected );
+		}
+	}
+}
+
+SECTION( "param ramp follows processed time" )
+{
+	auto ctx = makeContext( 1 );
+	auto constant = ctx->makeNode( new ConstantNode( 1 ) );
+	auto gain = ctx->makeNode( new GainNode( 0 ) );
+	constant >> gain >> ctx->getOutput();
+	constant->enable();
+	ctx->enable();
+
+	// ramp from 0 to 1 over exactly 4 blocks
+	const double rampSeconds = double( 4 * FRAMES_PER_BLOCK ) / double( SAMPLE_RATE );
+	gain->getParam()->applyRamp( 0, 1, (float)rampSeconds );
+
+	auto output = ctx->getOutputOffline();
+	float lastValue = -1;
+	for( size_t block = 0; block < 4; block++ ) {
+		const float *rendered = output->renderBlock()->getChannel( 0 );
+		for( size_t i = 0; i < FRAMES_PER_BLOCK; i++ ) {
+			REQUIRE( rendered[i] >= lastValue );
+			lastValue = rendered[i];
+		}
+	}
+
+	REQUIRE( lastValue == Approx( 1.0f ).epsilon( 0.01f ) );
+	REQUIRE( output->renderBlock()->getChannel( 0 )[0] == 1.0f );
+}
+
+SECTION( "streams to wav TargetFile" )
+{
+	const ci::fs::path path = ci::fs::temp_directory_path() / "ContextOfflineUnit.wav";
+	const size_t numChannels = 2;
+	const uint64_t numFrames = 3000;
+	{
+		auto ctx = makeContext( numChannels );
+		auto constant = ctx->makeNode( new ConstantNode( 0.25f ) );
+		constant >> ctx->getOutput();
+		constant->enable();
+		ctx->enable();
+
+		TargetFileRef target = TargetFile::create( path, SAMPLE_RATE, numChannels, SampleType::INT_16 );
+		REQUIRE( target );
+		ctx->getOutputOffline()->setTargetFile( target );
+		REQUIRE( ctx->getOutputOffline()->renderFrames( numFrames ) == numFrames );
+		ctx->getOutputOffline()->setTargetFile( nullptr );
+	}
+
+	REQUIRE( ci::fs::file_size( path ) == 44 + numFrames * numChannels * sizeof( int16_t ) );
+	ci::fs::remove( path );
+}
+
+} // "audio/ContextOffline"
@@ -0,0 +1,191 @@
+#include "catch.hpp"
+
+#include "cinder/audio/ContextOffline.h"
+#include "cinder/audio/ConvolverNode.h"
+#include "cinder/audio/SamplePlayerNode.h"
+#include "cinder/audio/dsp/Convolver.h"
+
+#include <random>
+
+using namespace std;
+using namespace ci::audio;
+
+namespace {
+
+vector<float> makeNoise( size_t length, unsigned int seed )
+{
+	mt19937 rng( seed );
+	uniform_real_distribution<float> dist( -1, 1 );
+
+	vector<float> result( length );
+	for( auto &sample : result )
+		sample = dist( rng );
+
+	return result;
+}
+
+vector<float> convolveDirect( const float *input, size_t inputLength, const float *ir, size_t irLength )
+{
+	vector<float> result( inputLength, 0 );
+	for( size_t i = 0; i < inputLength; i++ ) {
+		double sum = 0;
+		for( size_t j = 0; j < irLength && j <= i; j++ )
+			sum += (double)input[i - j] * (double)ir[j];
+
+		result[i] = (float)sum;
+	}
+
+	return result;
+}
+
+float maxDifference( const float *a, const float *b, size_t length )
+{
+	float result = 0;
+	for( size_t i = 0; i < length; i++ )
+		result = max( result, abs( a[i] - b[i] ) );
+
+	return result;
+}
+
+const float TOLERANCE = 1e-4f;
+
+} // anonymous namespace
+
+TEST_CASE( "audio/Convolver" )
+{
+
+SECTION( "dsp::Convolver matches direct convolution" )
+{
+	const size_t inputLength = 3000;
+	auto input = makeNoise( inputLength, 1 );
+
+	for( size_t blockSize : { 16, 64 } ) {
+		for( size_t irLength : { 1, 5, 16, 64, 100, 1000 } ) {
+			auto ir = makeNoise( irLength, (unsigned int)irLength );
+			auto expected = convolveDirect( input.data(), inputLength, ir.data(), irLength );
+
+			// process in uneven chunks, so that blocks are completed at every possible offset
+			dsp::Convolver convolver( blockSize, ir.data(), irLength );
+			REQUIRE( convolver.getNumPartitions() == ( irLength + blockSize - 1 ) / blockSize );
+
+			vector<float> result( inputLength );
+			mt19937 rng( 2 );
+			for( size_t pos = 0; pos < inputLength; ) {
+				size_t numFrames = min<size_t>( rng() % 200 + 1, inputLength - pos );
+				convolver.process( input.data() + pos, result.data() + pos, numFrames );
+				pos += numFrames;
+			}
+
+			INFO( "block size: " << blockSize << ", ir length: " << irLength );
+			REQUIRE( maxDifference( result.data(), expected.data(), inputLength ) < TOLERANCE );
+		}
+	}
+}
+
+SECTION( "dsp::Convolver processes in-place and resets" )
+{
+	auto input = makeNoise( 500, 3 );
+	auto ir = makeNoise( 80, 4 );
+	auto expected = convolveDirect( input.data(), input.size(), ir.data(), ir.size() );
+
+	dsp::Convolver convolver( 32, ir.data(), ir.size() );
+	for( int i = 0; i < 2; i++ ) {
+		auto data = input;
+		convolver.process( data.data(), data.data(), data.size() );
+		REQUIRE( maxDifference( data.data(), expected.data(), data.size() ) < TOLERANCE );
+
+		convolver.reset();
+	}
+}
+
+SECTION( "ConvolverNode matches direct convolution" )
+{
+	const size_t headBlockSize = 16;
+	const size_t tailBlockSize = 64;
+	const size_t inputLength = 4000;
+
+	// head only, head + tail0, and head + tail0 + background tail, including lengths at the partition boundaries
+	for( size_t irLength : { 10, 64, 65, 100, 128, 129, 1000 } ) {
+		for( size_t irChannels : { 1, 2 } ) {
+			auto ctx = make_shared<ContextOffline>( OutputOfflineNode::Format().framesPerBlock( 96 ).channels( 2 ) );
+
+			auto input = make_shared<Buffer>( inputLength, 2 );
+			for( size_t ch = 0; ch < 2; ch++ ) {
+				auto noise = makeNoise( inputLength, unsigned( 10 + ch ) );
+				copy( noise.begin(), noise.end(), input->getChannel( ch ) );
+			}
+
+			auto ir = make_shared<Buffer>( irLength, irChannels );
+			for( size_t ch = 0; ch < irChannels; ch++ ) {
+				auto noise = makeNoise( irLength, unsigned( 20 + ch ) );
+				copy( noise.begin(), noise.end(), ir->getChannel( ch ) );
+			}
+
+			auto player = ctx->makeNode( new BufferPlayerNode( input ) );
+			auto convolver = ctx->makeNode( new ConvolverNode( ir ) );
+			convolver->setBlockSizes( headBlockSize, tailBlockSize );
+			REQUIRE( convolver->getHeadBlockSize() == headBlockSize );
+			REQUIRE( convolver->getTailBlockSize() == tailBlockSize );
+
+			player >> convolver >> ctx->getOutput();
+			player->enable();
+			ctx->enable();
+
+			Buffer result( inputLength, 2 );
+			for( size_t pos = 0; pos < inputLength; ) {
+				const Buffer *block = ctx->getOutputOffline()->renderBlock();
+				size_t numFrames = min( block->getNumFrames(), inputLength - pos );
+				result.copyOffset( *block, numFrames, pos, 0 );
+				pos += numFrames;
+			}
+
+			for( size_t ch = 0; ch < 2; ch++ ) {
+				auto expected = convolveDirect( input->getChannel( ch ), inputLength, ir->getChannel( ch % irChannels ), irLength );
+
+				INFO( "ir length: " << irLength << ", ir channels: " << irChannels << ", channel: " << ch );
+				REQUIRE( maxDifference( result.getChannel( ch ), expected.data(), inputLength ) < TOLERANCE );
+			}
+		}
+	}
+}
+
+SECTION( "ConvolverNode without impulse response is silent" )
+{
+	auto ctx = make_shared<ContextOffline>( OutputOfflineNode::Format().framesPerBlock( 64 ).channels( 1 ) );
+
+	auto input = make_shared<Buffer>( 1000, 1 );
+	input->getChannel( 0 )[0] = 1;
+
+	auto player = ctx->makeNode( new BufferPlayerNode( input ) );
+	auto convolver = ctx->makeNode( new ConvolverNode );
+	player >> convolver >> ctx->getOutput();
+	player->enable();
+	ctx->enable();
+
+	const Buffer *block = ctx->getOutputOffline()->renderBlock();
+	REQUIRE( block->getChannel( 0 )[0] == 0 );
+
+	// an impulse response set while initialized takes effect from the next block
+	auto ir = make_shared<Buffer>( 300, 1 );
+	ir->getChannel( 0 )[0] = 0.5f;
+	ir->getChannel( 0 )[250] = 0.25f;
+	convolver->setBlockSizes( 16, 64 );
+	convolver->setImpulseResponse( ir );
+
+	player->seek( 0 );
+	block = ctx->getOutputOffline()->renderBlock();
+	REQUIRE( block->getChannel( 0 )[0] == Approx( 0.5f ) );
+
+	for( int i = 0; i < 3; i++ )
+		block = ctx->getOutputOffline()->renderBlock();
+	REQUIRE( block->getChannel( 0 )[250 - 3 * 64] == Approx( 0.25f ) );
+
+	// reset() clears the tail that is still ringing out
+	convolver->reset();
+	player->seek( 0 );
+	player->disable();
+	block = ctx->getOutputOffline()->renderBlock();
+	REQUIRE( block );
+}
+
+} // "audio/Convolver"
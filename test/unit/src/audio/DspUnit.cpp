@@ -0,0 +1,180 @@
+#include "catch.hpp"
+#include "utils.h"
+
+#include "cinder/audio/dsp/Dsp.h"
+#include "cinder/audio/dsp/Converter.h"
+
+#include <vector>
+
+using namespace std;
+using namespace ci;
+
+namespace {
+
+const vector<size_t> LENGTHS = { 1, 3, 4, 7, 8, 15, 16, 31, 64, 513 };
+const vector<size_t> NUM_CHANNELS = { 1, 2, 3, 4, 5, 8, 64 };
+
+vector<audio::dsp::SimdLevel> getSupportedLevels()
+{
+	vector<audio::dsp::SimdLevel> result;
+	for( auto level : { audio::dsp::SimdLevel::SSE2, audio::dsp::SimdLevel::AVX2, audio::dsp::SimdLevel::NEON } ) {
+		if( audio::dsp::isSimdLevelSupported( level ) )
+			result.push_back( level );
+	}
+	return result;
+}
+
+// Restores the default SimdLevel when leaving the current scope.
+struct ScopedSimdLevel {
+	ScopedSimdLevel( audio::dsp::SimdLevel level )	{ audio::dsp::setSimdLevel( level ); }
+	~ScopedSimdLevel()								{ audio::dsp::setSimdLevel( audio::dsp::getSupportedSimdLevel() ); }
+};
+
+} // anonymous namespace
+
+TEST_CASE( "audio/Dsp" )
+{
+
+SECTION( "simd level" )
+{
+	REQUIRE( audio::dsp::isSimdLevelSupported( audio::dsp::SimdLevel::NONE ) );
+	REQUIRE( audio::dsp::getSimdLevel() == audio::dsp::getSupportedSimdLevel() );
+
+	ScopedSimdLevel scopedLevel( audio::dsp::SimdLevel::NONE );
+	REQUIRE( audio::dsp::getSimdLevel() == audio::dsp::SimdLevel::NONE );
+}
+
+SECTION( "vector math matches scalar" )
+{
+	for( auto level : getSupportedLevels() ) {
+		for( size_t length : LENGTHS ) {
+			audio::Buffer a( length ), b( length );
+			fillRandom( &a );
+			fillRandom( &b );
+
+			audio::Buffer expected( length ), result( length );
+			float expectedSum, expectedRms;
+			{
+				ScopedSimdLevel scopedLevel( audio::dsp::SimdLevel::NONE );
+				audio::dsp::addMul( a.getData(), b.getData(), 0.5f, expected.getData(), length );
+				audio::dsp::mul( expected.getData(), b.getData(), expected.getData(), length );
+				audio::dsp::sub( expected.getData(), 0.25f, expected.getData(), length );
+				expectedSum = audio::dsp::sum( a.getData(), length );
+				expectedRms = audio::dsp::rms( a.getData(), length );
+			}
+
+			ScopedSimdLevel scopedLevel( level );
+			audio::dsp::addMul( a.getData(), b.getData(), 0.5f, result.getData(), length );
+			audio::dsp::mul( result.getData(), b.getData(), result.getData(), length );
+			audio::dsp::sub( result.getData(), 0.25f, result.getData(), length );
+
+			REQUIRE( maxError( expected, result ) < ACCEPTABLE_FLOAT_ERROR );
+			REQUIRE( audio::dsp::sum( a.getData(), length ) == Approx( expectedSum ).epsilon( 0.0001 ) );
+			REQUIRE( audio::dsp::rms( a.getData(), length ) == Approx( expectedRms ) );
+
+			audio::dsp::fill( 0.5f, result.getData(), length );
+			audio::dsp::add( result.getData(), 0.25f, result.getData(), length );
+			audio::dsp::add( result.getData(), result.getData(), result.getData(), length );
+			for( size_t i = 0; i < length; i++ )
+				REQUIRE( result[i] == 1.5f );
+
+			a[length / 2] = 3;
+			audio::dsp::normalize( a.getData(), length, 2 );
+			REQUIRE( a[length / 2] == Approx( 2 ) );
+		}
+	}
+}
+
+SECTION( "int16 conversion matches scalar and clamps" )
+{
+	for( auto level : getSupportedLevels() ) {
+		for( size_t length : LENGTHS ) {
+			audio::Buffer source( length );
+			fillRandom( &source );
+			source[0] = 1.0f;
+			source[length - 1] = -1.5f;
+
+			vector<int16_t> expected( length ), result( length );
+			audio::Buffer expectedFloat( length ), resultFloat( length );
+			{
+				ScopedSimdLevel scopedLevel( audio::dsp::SimdLevel::NONE );
+				audio::dsp::convert( source.getData(), expected.data(), length );
+				audio::dsp::convert( expected.data(), expectedFloat.getData(), length );
+			}
+
+			ScopedSimdLevel scopedLevel( level );
+			audio::dsp::convert( source.getData(), result.data(), length );
+			audio::dsp::convert( result.data(), resultFloat.getData(), length );
+
+			REQUIRE( result == expected );
+			REQUIRE( maxError( expectedFloat, resultFloat ) == 0 );
+			REQUIRE( result[length - 1] == -32768 );
+			if( length > 1 )
+				REQUIRE( result[0] == 32767 );
+		}
+	}
+}
+
+SECTION( "interleaving matches scalar" )
+{
+	for( auto level : getSupportedLevels() ) {
+		for( size_t numChannels : NUM_CHANNELS ) {
+			for( size_t numFrames : LENGTHS ) {
+				// copy fewer frames than the channel size, to exercise the non-interleaved stride
+				const size_t numCopyFrames = numFrames > 1 ? numFrames - 1 : numFrames;
+				audio::Buffer source( numFrames, numChannels );
+				fillRandom( &source );
+
+				vector<float> expected( numCopyFrames * numChannels ), result( numCopyFrames * numChannels );
+				audio::Buffer expectedDeinterleaved( numFrames, numChannels ), resultDeinterleaved( numFrames, numChannels );
+				vector<int16_t> expectedInt16( numCopyFrames * numChannels ), resultInt16( numCopyFrames * numChannels );
+				audio::Buffer expectedFromInt16( numFrames, numChannels ), resultFromInt16( numFrames, numChannels );
+				{
+					ScopedSimdLevel scopedLevel( audio::dsp::SimdLevel::NONE );
+					audio::dsp::interleave( source.getData(), expected.data(), numFrames, numChannels, numCopyFrames );
+					audio::dsp::deinterleave( expected.data(), expectedDeinterleaved.getData(), numFrames, numChannels, numCopyFrames );
+					audio::dsp::interleave( source.getData(), expectedInt16.data(), numFrames, numChannels, numCopyFrames );
+					audio::dsp::deinterleave( expectedInt16.data(), expectedFromInt16.getData(), numFrames, numChannels, numCopyFrames );
+				}
+
+				ScopedSimdLevel scopedLevel( level );
+				audio::dsp::interleave( source.getData(), result.data(), numFrames, numChannels, numCopyFrames );
+				audio::dsp::deinterleave( result.data(), resultDeinterleaved.getData(), numFrames, numChannels, numCopyFrames );
+				audio::dsp::interleave( source.getData(), resultInt16.data(), numFrames, numChannels, numCopyFrames );
+				audio::dsp::deinterleave( resultInt16.data(), resultFromInt16.getData(), numFrames, numChannels, numCopyFrames );
+
+				REQUIRE( result == expected );
+				REQUIRE( maxError( expectedDeinterleaved, resultDeinterleaved ) == 0 );
+				REQUIRE( resultInt16 == expectedInt16 );
+				REQUIRE( maxError( expectedFromInt16, resultFromInt16 ) == 0 );
+
+				// round trip of the copied frames
+				for( size_t ch = 0; ch < numChannels; ch++ ) {
+					for( size_t i = 0; i < numCopyFrames; i++ )
+						REQUIRE( resultDeinterleaved.getChannel( ch )[i] == source.getChannel( ch )[i] );
+				}
+			}
+		}
+	}
+}
+
+SECTION( "deinterleave int24" )
+{
+	// two channels, two frames: 1, -1, 0.5, -0.5 (scaled by 8388607)
+	const int32_t samples[] = { 8388607, -8388607, 4194303, -4194303 };
+	char interleaved[12];
+	for( size_t i = 0; i < 4; i++ ) {
+		interleaved[i * 3] = char( samples[i] & 255 );
+		interleaved[i * 3 + 1] = char( ( samples[i] >> 8 ) & 255 );
+		interleaved[i * 3 + 2] = char( ( samples[i] >> 16 ) & 255 );
+	}
+
+	audio::Buffer result( 2, 2 );
+	audio::dsp::deinterleaveInt24ToFloat( interleaved, result.getData(), 2, 2, 2 );
+	REQUIRE( result.getChannel( 0 )[0] == Approx( 1 ) );
+	REQUIRE( result.getChannel( 0 )[1] == Approx( 0.5f ) );
+	REQUIRE( result.getChannel( 1 )[0] == Approx( -1 ) );
+	REQUIRE( result.getChannel( 1 )[1] == Approx( -0.5f ) );
+}
+
+} // "audio/Dsp"
@@ -0,0 +1,268 @@
+#include "catch.hpp"
+
+#include "cinder/audio/ContextOffline.h"
+#include "cinder/audio/FileBlockCache.h"
+#include "cinder/audio/SamplePlayerNode.h"
+#include "cinder/audio/Target.h"
+#include "cinder/Filesystem.h"
+
+#include <chrono>
+#include <thread>
+
+using namespace std;
+using namespace ci::audio;
+
+namespace {
+
+const size_t SAMPLE_RATE		= 44100;
+const size_t NUM_CHANNELS		= 2;
+const size_t NUM_FRAMES			= 10000;
+const size_t FRAMES_PER_BLOCK	= 1000;
+
+// Serves samples from a Buffer, so that the decoded path is tested independently of the platform's file decoders.
+// Reports the wav written from the same Buffer as its DataSource, which lets the cache memory-map it.
+class SourceFileBuffer : public SourceFile {
+  public:
+	SourceFileBuffer( const BufferRef &buffer, const ci::fs::path &path, size_t sampleRate = 0 )
+		: SourceFile( sampleRate ), mBuffer( buffer ), mPath( path )
+	{
+		mFileNumFrames = mBuffer->getNumFrames();
+		setupSampleRateConversion();
+	}
+
+	SourceFileRef	cloneWithSampleRate( size_t sampleRate ) const override	{ return make_shared<SourceFileBuffer>( mBuffer, mPath, sampleRate ); }
+	ci::DataSourceRef	getDataSource() const override	{ return ci::DataSourcePath::create( mPath ); }
+	size_t	getNumChannels() const override			{ return mBuffer->getNumChannels(); }
+	size_t	getSampleRateNative() const override	{ return SAMPLE_RATE; }
+
+  protected:
+	size_t performRead( Buffer *buffer, size_t bufferFrameOffset, size_t numFramesNeeded ) override
+	{
+		buffer->copyOffset( *mBuffer, numFramesNeeded, bufferFrameOffset, mReadPos );
+		return numFramesNeeded;
+	}
+
+	void performSeek( size_t readPositionFrames ) override	{}
+
+	BufferRef		mBuffer;
+	ci::fs::path	mPath;
+};
+
+BufferRef makeSignal( size_t numFrames )
+{
+	auto result = make_shared<Buffer>( numFrames, NUM_CHANNELS );
+	for( size_t ch = 0; ch < NUM_CHANNELS; ch++ ) {
+		for( size_t i = 0; i < numFrames; i++ )
+			result->getChannel( ch )[i] = float( int( ( i * 7 + ch * 13 ) % 2001 ) - 1000 ) / 1024.0f;
+	}
+
+	return result;
+}
+
+// Writes signal to a wav at path and returns a SourceFile for it
+SourceFileRef makeSourceFile( const BufferRef &signal, const ci::fs::path &path, SampleType sampleType = SampleType::FLOAT_32 )
+{
+	{
+		auto target = TargetFile::create( path, SAMPLE_RATE, signal->getNumChannels(), sampleType );
+		target->write( signal.get() );
+	}
+
+	return make_shared<SourceFileBuffer>( signal, path );
+}
+
+FileBlockCacheRef makeCache( bool memoryMapping, size_t maxBytes = 64 * 1024 * 1024 )
+{
+	return FileBlockCache::create( FileBlockCache::Format().framesPerBlock( FRAMES_PER_BLOCK ).memoryMapping( memoryMapping ).maxBytes( maxBytes ) );
+}
+
+float maxDifference( const Buffer &a, const Buffer &b )
+{
+	REQUIRE( a.getSize() == b.getSize() );
+
+	float result = 0;
+	for( size_t i = 0; i < a.getSize(); i++ )
+		result = max( result, abs( a.getData()[i] - b.getData()[i] ) );
+
+	return result;
+}
+
+// Renders NUM_FRAMES of three players in an offline context, the third one looping a section of the file
+template <typename MakePlayerFn>
+Buffer renderPlayers( const MakePlayerFn &makePlayer )
+{
+	auto ctx = make_shared<ContextOffline>( OutputOfflineNode::Format().sampleRate( SAMPLE_RATE ).framesPerBlock( 256 ).channels( NUM_CHANNELS ) );
+
+	vector<SamplePlayerNodeRef> players;
+	for( size_t i = 0; i < 3; i++ ) {
+		players.push_back( makePlayer( ctx.get() ) );
+		players.back() >> ctx->getOutput();
+	}
+
+	players[1]->seek( 2500 );
+	players[2]->setLoopBegin( 1500 );
+	players[2]->setLoopEnd( 3700 );
+	players[2]->setLoopEnabled();
+	for( auto &player : players )
+		player->enable();
+
+	ctx->enable();
+
+	Buffer result( NUM_FRAMES, NUM_CHANNELS );
+	for( size_t frame = 0; frame < NUM_FRAMES; ) {
+		const Buffer *block = ctx->getOutputOffline()->renderBlock();
+		size_t numCopyFrames = min( block->getNumFrames(), NUM_FRAMES - frame );
+		result.copyOffset( *block, numCopyFrames, frame, 0 );
+		frame += numCopyFrames;
+	}
+
+	return result;
+}
+
+} // anonymous namespace
+
+TEST_CASE( "audio/FileBlockCache" )
+{
+	const ci::fs::path path = ci::fs::temp_directory_path() / "FileBlockCacheUnit.wav";
+	auto signal = makeSignal( NUM_FRAMES );
+
+SECTION( "decoded blocks match source" )
+{
+	auto cache = makeCache( false );
+	auto stream = cache->openStream( makeSourceFile( signal, path ) );
+	REQUIRE( ! stream->isMemoryMapped() );
+	REQUIRE( stream->getNumFrames() == NUM_FRAMES );
+	REQUIRE( stream->getNumChannels() == NUM_CHANNELS );
+
+	// reads that start and end within blocks, span several blocks and run past the end
+	const size_t readPositions[] = { 0, 999, 1000, 4321, 9500 };
+	for( size_t readPos : readPositions ) {
+		Buffer result( 2500, NUM_CHANNELS );
+		size_t numRead = stream->readBlocking( &result, 0, readPos, result.getNumFrames() );
+		REQUIRE( numRead == min<size_t>( result.getNumFrames(), NUM_FRAMES - readPos ) );
+
+		Buffer expected( result.getNumFrames(), NUM_CHANNELS );
+		expected.copyOffset( *signal, numRead, 0, readPos );
+		REQUIRE( maxDifference( result, expected ) == 0 );
+	}
+}
+
+SECTION( "read doesn't block" )
+{
+	auto cache = makeCache( false );
+	auto stream = cache->openStream( makeSourceFile( signal, path ) );
+
+	// nothing is loaded until requested
+	Buffer result( 512, NUM_CHANNELS );
+	REQUIRE( stream->read( &result, 0, 3000, 512 ) == 0 );
+
+	stream->prefetch( 3000 );
+
+	size_t numRead = 0;
+	for( int i = 0; i < 1000 && ! numRead; i++ ) {
+		this_thread::sleep_for( chrono::milliseconds( 1 ) );
+		numRead = stream->read( &result, 0, 3000, 512 );
+	}
+
+	REQUIRE( numRead == 512 );
+	REQUIRE( result.getChannel( 1 )[0] == signal->getChannel( 1 )[3000] );
+}
+
+SECTION( "memory-mapped wav" )
+{
+	for( auto sampleType : { SampleType::FLOAT_32, SampleType::INT_16, SampleType::INT_24 } ) {
+		auto cache = makeCache( true );
+		auto stream = cache->openStream( makeSourceFile( signal, path, sampleType ) );
+		REQUIRE( stream->isMemoryMapped() );
+		REQUIRE( stream->getNumFrames() == NUM_FRAMES );
+		REQUIRE( cache->getNumMemoryMappedStreams() == 1 );
+
+		// converted directly from the mapping, so reads never come up short
+		Buffer result( NUM_FRAMES, NUM_CHANNELS );
+		REQUIRE( stream->read( &result, 0, 0, NUM_FRAMES ) == NUM_FRAMES );
+		REQUIRE( cache->getNumBytesCached() == 0 );
+
+		float tolerance = sampleType == SampleType::FLOAT_32 ? 0 : 1e-4f;
+		REQUIRE( maxDifference( result, *signal ) <= tolerance );
+	}
+}
+
+SECTION( "samplerate mismatch isn't memory-mapped" )
+{
+	auto cache = makeCache( true );
+	auto stream = cache->openStream( makeSourceFile( signal, path ), SAMPLE_RATE * 2 );
+	REQUIRE( ! stream->isMemoryMapped() );
+	REQUIRE( stream->getNumFrames() == NUM_FRAMES * 2 );
+}
+
+SECTION( "streams of the same file share blocks" )
+{
+	auto cache = makeCache( false );
+	auto sourceA = makeSourceFile( signal, path );
+	auto sourceB = make_shared<SourceFileBuffer>( signal, path );
+
+	vector<unique_ptr<FileBlockCache::Stream>> streams;
+	streams.push_back( cache->openStream( sourceA ) );
+	streams.push_back( cache->openStream( sourceA ) );
+	streams.push_back( cache->openStream( sourceB ) );
+	REQUIRE( cache->getNumFilesOpen() == 1 );
+
+	Buffer result( NUM_FRAMES, NUM_CHANNELS );
+	for( auto &stream : streams )
+		REQUIRE( stream->readBlocking( &result, 0, 0, NUM_FRAMES ) == NUM_FRAMES );
+
+	REQUIRE( cache->getNumBlocksCached() == NUM_FRAMES / FRAMES_PER_BLOCK );
+	REQUIRE( cache->getNumBytesCached() == NUM_FRAMES * NUM_CHANNELS * sizeof( float ) );
+
+	streams.clear();
+	cache->clear();
+	REQUIRE( cache->getNumBlocksCached() == 0 );
+	REQUIRE( cache->getNumFilesOpen() == 0 );
+}
+
+SECTION( "evicts least recently used blocks" )
+{
+	const size_t blockBytes = FRAMES_PER_BLOCK * NUM_CHANNELS * sizeof( float );
+	auto cache = makeCache( false, 3 * blockBytes );
+	{
+		auto stream = cache->openStream( makeSourceFile( signal, path ) );
+
+		Buffer result( 100, NUM_CHANNELS );
+		for( size_t readPos = 0; readPos < NUM_FRAMES; readPos += result.getNumFrames() ) {
+			REQUIRE( stream->readBlocking( &result, 0, readPos, result.getNumFrames() ) == result.getNumFrames() );
+			REQUIRE( result.getChannel( 0 )[0] == signal->getChannel( 0 )[readPos] );
+
+			// blocks that a stream is reading from may exceed the limit, the rest are evicted
+			REQUIRE( cache->getNumBytesCached() <= 7 * blockBytes );
+		}
+	}
+
+	REQUIRE( cache->getNumBytesCached() <= 3 * blockBytes );
+	REQUIRE( cache->getNumFilesOpen() == 1 );
+
+	cache->clear();
+	REQUIRE( cache->getNumFilesOpen() == 0 );
+}
+
+SECTION( "FilePlayerNode matches BufferPlayerNode" )
+{
+	auto sourceFile = makeSourceFile( signal, path );
+	Buffer expected = renderPlayers( [&]( Context *ctx ) -> SamplePlayerNodeRef {
+		return ctx->makeNode( new BufferPlayerNode( signal ) );
+	} );
+
+	for( bool memoryMapping : { false, true } ) {
+		auto cache = makeCache( memoryMapping );
+		Buffer result = renderPlayers( [&]( Context *ctx ) -> SamplePlayerNodeRef {
+			auto player = ctx->makeNode( new FilePlayerNode( sourceFile, cache ) );
+			REQUIRE( player->getBlockCache() == cache );
+			return player;
+		} );
+
+		// the players are gone, but decoded blocks keep their file open until evicted
+		REQUIRE( cache->getNumFilesOpen() == ( memoryMapping ? 0 : 1 ) );
+		REQUIRE( maxDifference( result, expected ) == 0 );
+	}
+}
+
+	ci::fs::remove( path );
+} // "audio/FileBlockCache"
@@ -0,0 +1,229 @@
+#include "catch.hpp"
+
+#include "cinder/audio/ContextOffline.h"
+#include "cinder/audio/ParallelGraphProcessor.h"
+#include "cinder/audio/GenNode.h"
+#include "cinder/audio/GainNode.h"
+#include "cinder/audio/FilterNode.h"
+#include "cinder/audio/PanNode.h"
+#include "cinder/audio/DelayNode.h"
+
+#include <atomic>
+#include <cstring>
+
+using namespace std;
+using namespace ci::audio;
+
+namespace {
+
+// Records whether its Context reported being on the audio thread while processing.
+class AudioThreadCheckNode : public Node {
+  public:
+	AudioThreadCheckNode() : Node( Format().channels( 1 ) ), mNumProcessed( 0 ), mNumNotAudioThread( 0 )	{}
+
+	atomic<size_t>	mNumProcessed, mNumNotAudioThread;
+
+  protected:
+	void process( Buffer *buffer ) override
+	{
+		mNumProcessed++;
+		if( ! getContext()->isAudioThread() )
+			mNumNotAudioThread++;
+	}
+};
+
+const size_t NUM_VOICES			= 32;
+const size_t NUM_SUBMIX_VOICES	= 8;
+
+ContextOfflineRef makeContext()
+{
+	return make_shared<ContextOffline>( OutputOfflineNode::Format().sampleRate( 44100 ).framesPerBlock( 256 ) );
+}
+
+// osc -> lowpass -> gain (ramping) -> pan
+NodeRef makeVoice( const ContextRef &ctx, size_t index )
+{
+	auto osc = ctx->makeNode( new GenTriangleNode( 55.0f * float( 1 + index % 12 ) ) );
+	auto lowpass = ctx->makeNode( new FilterLowPassNode );
+	auto gain = ctx->makeNode( new GainNode( 0 ) );
+	auto pan = ctx->makeNode( new Pan2dNode );
+
+	osc >> lowpass >> gain >> pan;
+	lowpass->setCutoffFreq( 400.0f + 50.0f * float( index ) );
+	gain->getParam()->applyRamp( 1.0f / float( 1 + index % 5 ), 0.01f * float( 1 + index ) );
+	pan->setPos( float( index % 7 ) / 6.0f );
+	return pan;
+}
+
+// NUM_VOICES voices summed into a master GainNode, along with a submix of NUM_SUBMIX_VOICES voices and a feedback delay.
+GainNodeRef buildGraph( const ContextRef &ctx )
+{
+	auto master = ctx->makeNode( new GainNode( 1.0f / float( NUM_VOICES ) ) );
+	master >> ctx->getOutput();
+
+	for( size_t i = 0; i < NUM_VOICES; i++ )
+		makeVoice( ctx, i ) >> master;
+
+	auto submix = ctx->makeNode( new GainNode( 0.5f ) );
+	for( size_t i = 0; i < NUM_SUBMIX_VOICES; i++ )
+		makeVoice( ctx, NUM_VOICES + i ) >> submix;
+
+	submix >> master;
+
+	auto delayInput = ctx->makeNode( new GenSineNode( 220 ) );
+	auto delay = ctx->makeNode( new DelayNode );
+	auto feedback = ctx->makeNode( new GainNode( 0.5f ) );
+	delay->setDelaySeconds( 0.01f );
+	delayInput >> delay >> feedback >> delay >> master;
+
+	return master;
+}
+
+void requireEqualRenders( const ContextOfflineRef &ctxA, const ContextOfflineRef &ctxB, size_t numBlocks )
+{
+	for( size_t block = 0; block < numBlocks; block++ ) {
+		const Buffer *a = ctxA->getOutputOffline()->renderBlock();
+		const Buffer *b = ctxB->getOutputOffline()->renderBlock();
+		REQUIRE( a );
+		REQUIRE( b );
+		REQUIRE( a->getSize() == b->getSize() );
+		REQUIRE( memcmp( a->getData(), b->getData(), a->getSize() * sizeof( float ) ) == 0 );
+	}
+}
+
+} // anonymous namespace
+
+TEST_CASE( "audio/ParallelGraphProcessor" )
+{
+
+SECTION( "partitions independent inputs" )
+{
+	auto ctx = makeContext();
+	buildGraph( ctx );
+
+	ParallelGraphProcessor processor( 3 );
+	{
+		lock_guard<mutex> lock( ctx->getMutex() );
+		processor.partition( { ctx->getOutput() } );
+	}
+
+	// every voice and the submix are independent inputs of master, the submix voices are nested in a second stage.
+	// The delay is part of a feedback cycle and is left to the audio thread.
+	REQUIRE( processor.getNumThreads() == 3 );
+	REQUIRE( processor.getNumSubgraphs() == NUM_VOICES + 1 + NUM_SUBMIX_VOICES );
+	REQUIRE( processor.getNumStages() == 2 );
+
+	processor.clear();
+	REQUIRE( processor.getNumSubgraphs() == 0 );
+	REQUIRE( processor.getNumStages() == 0 );
+}
+
+SECTION( "shared inputs are not partitioned" )
+{
+	auto ctx = makeContext();
+	auto gen = ctx->makeNode( new GenSineNode( 440 ) );
+	auto gainA = ctx->makeNode( new GainNode( 0.5f ) );
+	auto gainB = ctx->makeNode( new GainNode( 0.25f ) );
+	gen >> gainA >> ctx->getOutput();
+	gen >> gainB >> ctx->getOutput();
+
+	ParallelGraphProcessor processor( 2 );
+	lock_guard<mutex> lock( ctx->getMutex() );
+	processor.partition( { ctx->getOutput() } );
+	REQUIRE( processor.getNumSubgraphs() == 0 );
+}
+
+SECTION( "output is identical to single-threaded" )
+{
+	auto ctxSingle = makeContext();
+	auto ctxParallel = makeContext();
+	ctxParallel->setNumProcessingThreads( 4 );
+	REQUIRE( ctxSingle->getNumProcessingThreads() == 1 );
+	REQUIRE( ctxParallel->getNumProcessingThreads() == 4 );
+
+	auto masterSingle = buildGraph( ctxSingle );
+	auto masterParallel = buildGraph( ctxParallel );
+	ctxSingle->enable();
+	ctxParallel->enable();
+
+	requireEqualRenders( ctxSingle, ctxParallel, 100 );
+
+	// changing the graph while rendering repartitions it
+	for( size_t i = 0; i < 4; i++ ) {
+		makeVoice( ctxSingle, 100 + i ) >> masterSingle;
+		makeVoice( ctxParallel, 100 + i ) >> masterParallel;
+		requireEqualRenders( ctxSingle, ctxParallel, 10 );
+	}
+
+	// as does changing the number of threads
+	ctxParallel->setNumProcessingThreads( 2 );
+	requireEqualRenders( ctxSingle, ctxParallel, 50 );
+	ctxParallel->setNumProcessingThreads( 1 );
+	REQUIRE( ctxParallel->getNumProcessingThreads() == 1 );
+	requireEqualRenders( ctxSingle, ctxParallel, 50 );
+}
+
+SECTION( "output created while connecting" )
+{
+	// the output is created while gain is being configured, with the Context's mutex locked
+	auto ctx = makeContext();
+	ctx->setNumProcessingThreads( 2 );
+	auto gen = ctx->makeNode( new GenSineNode( 440 ) );
+	auto gain = ctx->makeNode( new GainNode( 0.5f ) );
+	gen >> gain >> ctx->getOutput();
+
+	ctx->enable();
+	REQUIRE( ctx->getOutputOffline()->renderFrames( 1024 ) == 1024 );
+}
+
+SECTION( "processing mode is restored" )
+{
+	// mono, so that the gains can process in-place
+	auto ctx = make_shared<ContextOffline>( OutputOfflineNode::Format().channels( 1 ).framesPerBlock( 256 ) );
+	ctx->setNumProcessingThreads( 2 );
+
+	vector<GainNodeRef> gains;
+	for( size_t i = 0; i < 4; i++ ) {
+		gains.push_back( ctx->makeNode( new GainNode( 0.25f ) ) );
+		ctx->makeNode( new GenSineNode( 110.0f * float( i + 1 ) ) ) >> gains.back() >> ctx->getOutput();
+		REQUIRE( gains.back()->getProcessesInPlace() );
+	}
+
+	// partitioned on the audio thread before the first block
+	ctx->enable();
+	ctx->getOutputOffline()->renderBlock();
+	for( const auto &gain : gains )
+		REQUIRE( ! gain->getProcessesInPlace() );
+
+	// a root that gains a second output must keep summing
+	auto monitor = ctx->makeNode( new GainNode );
+	gains[0] >> monitor >> ctx->getOutput();
+	ctx->getOutputOffline()->renderBlock();
+
+	ctx->setNumProcessingThreads( 1 );
+	REQUIRE( ! gains[0]->getProcessesInPlace() );
+	for( size_t i = 1; i < gains.size(); i++ )
+		REQUIRE( gains[i]->getProcessesInPlace() );
+}
+
+SECTION( "workers are audio threads" )
+{
+	auto ctx = makeContext();
+	ctx->setNumProcessingThreads( 4 );
+
+	vector<shared_ptr<AudioThreadCheckNode>> nodes;
+	for( size_t i = 0; i < 16; i++ ) {
+		nodes.push_back( ctx->makeNode( new AudioThreadCheckNode ) );
+		nodes.back() >> ctx->getOutput();
+	}
+
+	ctx->enable();
+	ctx->getOutputOffline()->renderFrames( 256 * 20 );
+
+	for( const auto &node : nodes ) {
+		REQUIRE( node->mNumProcessed == 20 );
+		REQUIRE( node->mNumNotAudioThread == 0 );
+	}
+}
+
+} // "audio/ParallelGraphProcessor"
@@ -0,0 +1,136 @@
+#include "catch.hpp"
+
+#include "cinder/audio/ContextOffline.h"
+#include "cinder/audio/GainNode.h"
+#include "cinder/audio/GenNode.h"
+
+#include <thread>
+
+using namespace std;
+using namespace ci::audio;
+
+namespace {
+
+const size_t SAMPLE_RATE		= 44100;
+const size_t FRAMES_PER_BLOCK	= 256;
+
+ContextOfflineRef makeContext()
+{
+	auto format = OutputOfflineNode::Format().sampleRate( SAMPLE_RATE ).framesPerBlock( FRAMES_PER_BLOCK ).channels( 1 );
+	return make_shared<ContextOffline>( format );
+}
+
+// Renders from a separate thread, so that the calling thread acts as the user thread.
+void renderBlocksOnAudioThread( const ContextOfflineRef &ctx, size_t numBlocks )
+{
+	thread audioThread( [ctx, numBlocks] {
+		for( size_t i = 0; i < numBlocks; i++ )
+			ctx->getOutputOffline()->renderBlock();
+	} );
+	audioThread.join();
+}
+
+} // anonymous namespace
+
+TEST_CASE( "audio/Param" )
+{
+	auto ctx = makeContext();
+	auto gen = ctx->makeNode( new GenSineNode( 440 ) );
+	auto gain = ctx->makeNode( new GainNode( 0 ) );
+	gen >> gain >> ctx->getOutput();
+	gen->enable();
+
+	Param *param = gain->getParam();
+
+SECTION( "disabled context applies ramps immediately" )
+{
+	param->applyRamp( 1, 0.1 );
+	REQUIRE( param->getNumEvents() == 1 );
+
+	param->appendRamp( 0.5f, 0.1 );
+	REQUIRE( param->getNumEvents() == 2 );
+	REQUIRE( param->findEndTimeAndValue().first == Approx( 0.2 ) );
+	REQUIRE( param->findEndTimeAndValue().second == 0.5f );
+
+	param->reset();
+	REQUIRE( param->getNumEvents() == 0 );
+	REQUIRE( param->findDuration() == 0 );
+}
+
+SECTION( "enabled context queues ramps for the audio thread" )
+{
+	ctx->enable();
+
+	param->applyRamp( 1, 0.1 );
+	REQUIRE( param->getNumEvents() == 0 ); // not processed until the next block
+	REQUIRE( param->findDuration() == Approx( 0.1f ) );
+
+	param->appendRamp( 0.5f, 0.1 );
+	REQUIRE( param->findEndTimeAndValue().first == Approx( 0.2 ) );
+	REQUIRE( param->findEndTimeAndValue().second == 0.5f );
+
+	renderBlocksOnAudioThread( ctx, 1 );
+	REQUIRE( param->getNumEvents() == 2 );
+	REQUIRE( param->getValue() > 0 );
+
+	// render past the end of both ramps
+	renderBlocksOnAudioThread( ctx, size_t( 0.25 * SAMPLE_RATE ) / FRAMES_PER_BLOCK );
+	REQUIRE( param->getNumEvents() == 0 );
+	REQUIRE( param->getValue() == 0.5f );
+	REQUIRE( param->findEndTimeAndValue().second == 0.5f );
+}
+
+SECTION( "applyRamp replaces queued ramps" )
+{
+	ctx->enable();
+
+	param->applyRamp( 1, 0.1 );
+	param->applyRamp( 0.25f, 0.01 );
+	REQUIRE( param->findEndTimeAndValue().second == 0.25f );
+
+	renderBlocksOnAudioThread( ctx, size_t( 0.1 * SAMPLE_RATE ) / FRAMES_PER_BLOCK );
+	REQUIRE( param->getNumEvents() == 0 );
+	REQUIRE( param->getValue() == 0.25f );
+}
+
+SECTION( "setValue cancels queued ramps" )
+{
+	ctx->enable();
+
+	param->applyRamp( 1, 0.1 );
+	param->setValue( 0.75f );
+	REQUIRE( param->getValue() == 0.75f );
+	REQUIRE( param->findDuration() == 0 );
+
+	renderBlocksOnAudioThread( ctx, 4 );
+	REQUIRE( param->getNumEvents() == 0 );
+	REQUIRE( param->getValue() == 0.75f );
+}
+
+SECTION( "ramps scheduled while rendering" )
+{
+	ctx->enable();
+
+	const size_t numBlocks = 500;
+	const size_t maxRamps = 10000;
+	atomic<bool> rendering( true );
+	thread audioThread( [&] {
+		for( size_t i = 0; i < numBlocks; i++ )
+			ctx->getOutputOffline()->renderBlock();
+		rendering = false;
+	} );
+
+	size_t numRamps = 0;
+	while( rendering && numRamps < maxRamps ) {
+		param->applyRamp( float( numRamps % 100 ) / 100.0f, 0.001 );
+		numRamps++;
+	}
+	audioThread.join();
+
+	const float lastValue = float( ( numRamps - 1 ) % 100 ) / 100.0f;
+	renderBlocksOnAudioThread( ctx, 2 );
+	REQUIRE( param->getNumEvents() == 0 );
+	REQUIRE( param->getValue() == lastValue );
+}
+
+} // "audio/Param"